@@ -0,0 +1,21 @@
+// Generated by snn_core/Tools/snn_plan from the cifar_snn layer table.
+// Regenerate with the snn_arena_headers target after changing the model.
+#ifndef CIFAR_SNN_ARENA_H
+#define CIFAR_SNN_ARENA_H
+
+// Peak activation memory of snn_network_inference(); keeping every
+// layer output live for the whole inference would take 9320 bytes.
+#if defined(SNN_INT8_WEIGHTS)
+#define CIFAR_SNN_ARENA_SIZE 8192
+#elif defined(SNN_CODEBOOK_WEIGHTS)
+#define CIFAR_SNN_ARENA_SIZE 5232
+#else
+#define CIFAR_SNN_ARENA_SIZE 5120
+#endif
+
+// Memory of snn_stream_run(); int8 and codebook builds cannot stream.
+#if !defined(SNN_INT8_WEIGHTS) && !defined(SNN_CODEBOOK_WEIGHTS)
+#define CIFAR_SNN_STREAM_SIZE 4800
+#endif
+
+#endif // CIFAR_SNN_ARENA_H
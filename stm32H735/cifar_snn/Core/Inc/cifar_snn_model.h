@@ -0,0 +1,10 @@
+#ifndef CIFAR_SNN_MODEL_H
+#define CIFAR_SNN_MODEL_H
+
+#include "snn_network.h"
+
+// conv1/2/3 -> LIF -> pool, then fc1 -> LIF -> fc2 -> LIF, forwarding
+// 0/1 spikes between layers and decoding the fc2 spikes.
+extern const SNNNetwork cifar_snn_network;
+
+#endif // CIFAR_SNN_MODEL_H
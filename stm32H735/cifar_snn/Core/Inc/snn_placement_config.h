@@ -0,0 +1,15 @@
+// Generated by snn_core/Tools/snn_place from the cifar_snn layer table, host
+// timings and code sizes. Regenerate with the snn_placement_headers target
+// after changing the model; included by snn_placement.h in builds with
+// SNN_TCM_PLACEMENT. Tags left out keep flash and RAM_D1.
+#ifndef SNN_PLACEMENT_CONFIG_H
+#define SNN_PLACEMENT_CONFIG_H
+
+#define SNN_PLACE_CONV2D_SPECIALIZED SNN_ITCM        // 3643 bytes, 76% of the time
+#define SNN_PLACE_LINEAR_SPIKES SNN_ITCM             // 174 bytes, 19% of the time
+#define SNN_PLACE_MAXPOOL2D SNN_ITCM                 // 485 bytes, 0% of the time
+#define SNN_PLACE_LIF SNN_ITCM                       // 1186 bytes, 5% of the time
+#define SNN_PLACE_ARENA SNN_DTCM                     // 5120 bytes, 5614.7 accesses per byte
+#define SNN_PLACE_RESULTS SNN_RAM_D3                 // 3096 bytes, 0.0 accesses per byte
+
+#endif // SNN_PLACEMENT_CONFIG_H
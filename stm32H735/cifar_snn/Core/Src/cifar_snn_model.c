@@ -0,0 +1,124 @@
+#include "cifar_snn_model.h"
+#include "cifar_parameters.h"
+
+// SNN_INT8_WEIGHTS builds run on the int8 weights of cifar_snn_q8.h and
+// SNN_CODEBOOK_WEIGHTS builds on the 4-bit codebook weights of
+// cifar_snn_codebook.h; both leave the float weights out of flash. The
+// snn_q8_headers and snn_codebook_headers targets write the headers once
+// cifar_parameters.h is in place. At a bit over 4 MB in float, the
+// codebook build is the only one whose weights fit the 1 MB of flash.
+// SNN_OSPI_WEIGHTS builds leave the float weights to the OctoSPI flash,
+// where main.c rebases the network onto them; SNN_OSPI_MODEL builds run the
+// model blob there and keep only the layer table and specialised kernels.
+#if defined(SNN_OSPI_WEIGHTS) || defined(SNN_OSPI_MODEL)
+#define WEIGHTS(name) NULL
+#define QUANTIZED NULL
+#define CODEBOOK NULL
+#elif defined(SNN_INT8_WEIGHTS)
+#include "cifar_snn_q8.h"
+#define WEIGHTS(name) NULL
+#define QUANTIZED cifar_snn_quantized
+#define CODEBOOK NULL
+#elif defined(SNN_CODEBOOK_WEIGHTS)
+#include "cifar_snn_codebook.h"
+#define WEIGHTS(name) NULL
+#define QUANTIZED NULL
+#define CODEBOOK cifar_snn_codebook
+#else
+#define WEIGHTS(name) name
+#define QUANTIZED NULL
+#define CODEBOOK NULL
+#endif
+
+// SNN_FIXED_MEMBRANES builds keep the LIF membranes in Q16.16 fixed point
+#ifdef SNN_FIXED_MEMBRANES
+#define FIXED_MEMBRANES 1
+#else
+#define FIXED_MEMBRANES 0
+#endif
+
+// The 3x3 convolutions on dense input run as Winograd F(2x2,3x3) on the
+// kernels of cifar_snn_winograd.h, once snn_winograd_headers has generated
+// it; SNN_DIRECT_CONV builds run them direct
+#if !defined(SNN_DIRECT_CONV) && !defined(SNN_INT8_WEIGHTS) && !defined(SNN_CODEBOOK_WEIGHTS) && \
+    !defined(SNN_OSPI_WEIGHTS) && !defined(SNN_OSPI_MODEL) && __has_include("cifar_snn_winograd.h")
+#include "cifar_snn_winograd.h"
+#define WINOGRAD cifar_snn_winograd
+#else
+#define WINOGRAD NULL
+#endif
+
+// SNN_SPARSE_FC builds run fc1 and fc2 on the block-sparse weights of
+// cifar_snn_sparse.h, once snn_sparse_headers has generated it, and leave
+// their dense weights out of flash
+#if defined(SNN_SPARSE_FC) && !defined(SNN_INT8_WEIGHTS) && !defined(SNN_CODEBOOK_WEIGHTS) && \
+    !defined(SNN_OSPI_WEIGHTS) && !defined(SNN_OSPI_MODEL) && __has_include("cifar_snn_sparse.h")
+#include "cifar_snn_sparse.h"
+#define SPARSE cifar_snn_sparse
+#define FC_WEIGHTS(name) NULL
+#else
+#define SPARSE NULL
+#define FC_WEIGHTS(name) WEIGHTS(name)
+#endif
+
+#define INPUT_SIZE 32
+#define THRESHOLD 1
+#define TIMESTEPS 1
+#define MAX_EVENT_RATE 0.3
+
+#define LIF1_BETA 0.9f
+#define LIF2_BETA 0.9f
+#define LIF3_BETA 0.9f
+#define LIF4_BETA 0.9f
+#define LIF5_BETA 0.9f
+
+// SNN_CACHE_ENABLE builds run with the caches on (snn_cache_init()) and
+// compute conv1, the one layer on float input, in tiles sized to the L1
+// D-cache in place of its specialised kernel
+#ifdef SNN_CACHE_ENABLE
+#define CONV1_LAYER SNN_TILED_CONV2D
+#else
+#define CONV1_LAYER SNN_CONV2D
+#endif
+
+// conv1 sees the image, conv2 and conv3 the packed spikes of the layer
+// before; each gets the kernel for its input specialised to its shape
+SNN_SPECIALIZE_CONV2D(cifar_snn_conv1, CONV1_IN_CHANNELS, INPUT_SIZE, CONV1_KERNEL_SIZE, CONV1_STRIDE, CONV1_PADDING);
+SNN_SPECIALIZE_CONV2D_SPIKES(cifar_snn_conv2, CONV2_IN_CHANNELS, INPUT_SIZE/2, CONV2_KERNEL_SIZE, CONV2_STRIDE,
+                             CONV2_PADDING);
+SNN_SPECIALIZE_CONV2D_SPIKES(cifar_snn_conv3, CONV3_IN_CHANNELS, INPUT_SIZE/4, CONV3_KERNEL_SIZE, CONV3_STRIDE,
+                             CONV3_PADDING);
+
+static const SNNConvKernel* const cifar_snn_kernels[] = {
+    &cifar_snn_conv1, NULL, &cifar_snn_conv2, NULL, &cifar_snn_conv3, NULL, NULL, NULL,
+};
+
+static const SNNLayer cifar_snn_layers[] = {
+    CONV1_LAYER(CONV1_IN_CHANNELS, CONV1_OUT_CHANNELS, INPUT_SIZE, CONV1_KERNEL_SIZE, CONV1_STRIDE, CONV1_PADDING,
+                WEIGHTS(conv1_weights), NULL, SNN_ACT_LIF_SPIKE_BITS, LIF1_BETA, THRESHOLD),
+    SNN_MAXPOOL2D(CONV1_OUT_CHANNELS, INPUT_SIZE, 2, 2),
+    SNN_EVENT_CONV2D(CONV2_IN_CHANNELS, CONV2_OUT_CHANNELS, INPUT_SIZE/2, CONV2_KERNEL_SIZE, CONV2_STRIDE, CONV2_PADDING,
+                     WEIGHTS(conv2_weights), NULL, SNN_ACT_LIF_SPIKE_BITS, LIF2_BETA, THRESHOLD, MAX_EVENT_RATE),
+    SNN_MAXPOOL2D(CONV2_OUT_CHANNELS, INPUT_SIZE/2, 2, 2),
+    SNN_EVENT_CONV2D(CONV3_IN_CHANNELS, CONV3_OUT_CHANNELS, INPUT_SIZE/4, CONV3_KERNEL_SIZE, CONV3_STRIDE, CONV3_PADDING,
+                     WEIGHTS(conv3_weights), NULL, SNN_ACT_LIF_SPIKE_BITS, LIF3_BETA, THRESHOLD, MAX_EVENT_RATE),
+    SNN_MAXPOOL2D(CONV3_OUT_CHANNELS, INPUT_SIZE/4, 2, 2),
+    SNN_LINEAR(FC1_IN_FEATURES, FC1_OUT_FEATURES,
+               FC_WEIGHTS(fc1_weights), NULL, SNN_ACT_LIF_SPIKE_BITS, LIF4_BETA, THRESHOLD),
+    SNN_LINEAR(FC2_IN_FEATURES, FC2_OUT_FEATURES,
+               FC_WEIGHTS(fc2_weights), NULL, SNN_ACT_LIF_SPIKE, LIF5_BETA, THRESHOLD),
+};
+
+const SNNNetwork cifar_snn_network = {
+    "cifar_snn",
+    cifar_snn_layers,
+    sizeof(cifar_snn_layers) / sizeof(cifar_snn_layers[0]),
+    TIMESTEPS,
+    QUANTIZED,
+    FIXED_MEMBRANES,
+    WINOGRAD,
+    cifar_snn_kernels,
+    NULL,
+    SPARSE,
+    CODEBOOK,
+};
@@ -23,274 +23,85 @@
 /* Private includes ----------------------------------------------------------*/
 /* USER CODE BEGIN Includes */
 #include <stdio.h>
-#include <stdbool.h>
-#include <math.h>
 #include "cifar10_images.h"
-#include "cifar_parameters.h"
+#include "cifar_snn_model.h"
+#include "cifar_snn_arena.h"
+#include "snn_placement.h"
+#include "snn_cache.h"
+#include "snn_weights.h"
+#include "snn_blob.h"
+#include "snn_mdma.h"
 
 #define INPUT_SIZE 32
-#define THRESHOLD 1
-
-#define LIF1_BETA 0.9
-#define LIF2_BETA 0.9
-#define LIF3_BETA 0.9
-#define LIF4_BETA 0.9
-#define LIF5_BETA 0.9
-
-typedef struct {
-    float membrane_potential;
-    bool should_spike;
-} LIFNeuron;
-
-typedef struct {
-    int in_channels;
-    int out_channels;
-    int kernel_size;
-    int stride;
-    int padding;
-    const float (*weights)[CONV1_IN_CHANNELS][CONV1_KERNEL_SIZE][CONV1_KERNEL_SIZE];
-} conv1;
-
-typedef struct {
-    int in_channels;
-    int out_channels;
-    int kernel_size;
-    int stride;
-    int padding;
-    const float (*weights)[CONV2_IN_CHANNELS][CONV2_KERNEL_SIZE][CONV2_KERNEL_SIZE];
-} conv2;
-
-typedef struct {
-    int in_channels;
-    int out_channels;
-    int kernel_size;
-    int stride;
-    int padding;
-    const float (*weights)[CONV3_IN_CHANNELS][CONV3_KERNEL_SIZE][CONV3_KERNEL_SIZE];
-} conv3;
-
-typedef struct {
-    const float (*weights)[FC1_OUT_FEATURES][FC1_IN_FEATURES];
-} FullyConnectedLayer;
-
-typedef struct {
-    const float (*weights)[FC2_OUT_FEATURES][FC2_IN_FEATURES];
-} FullyConnectedLayer2;
-
-// Function to apply Leaky Integrate and Fire (LIF) neuron update
-void update_neuron(LIFNeuron *neuron, float input_current, float beta, float threshold) {
-    neuron->membrane_potential = (beta * neuron->membrane_potential + input_current);
-
-    if (neuron->should_spike) {
-        neuron->membrane_potential = 0;
-        neuron->should_spike = false;
-    } else if (neuron->membrane_potential >= threshold) {
-        neuron->should_spike = true;
-    }
-}
 
-// Function to perform 2D convolution
-void conv1_2d(const float* input, float* output, const conv1* conv_layer, int input_size) {
-    int output_size = (input_size - conv_layer->kernel_size + 2 * conv_layer->padding) / conv_layer->stride + 1;
-
-    for (int oc = 0; oc < conv_layer->out_channels; ++oc) {
-        for (int oh = 0; oh < output_size; ++oh) {
-            for (int ow = 0; ow < output_size; ++ow) {
-                float sum = 0;
-                for (int ic = 0; ic < conv_layer->in_channels; ++ic) {
-                    for (int kh = 0; kh < conv_layer->kernel_size; ++kh) {
-                        for (int kw = 0; kw < conv_layer->kernel_size; ++kw) {
-                            int ih = oh * conv_layer->stride + kh - conv_layer->padding;
-                            int iw = ow * conv_layer->stride + kw - conv_layer->padding;
-                            if (ih >= 0 && ih < input_size && iw >= 0 && iw < input_size) {
-                                sum += input[ic * input_size * input_size + ih * input_size + iw] * conv_layer->weights[oc][ic][kh][kw];
-                            }
-                        }
-                    }
-                }
-                output[oc * output_size * output_size + oh * output_size + ow] = sum;
-            }
-        }
-    }
-}
+// Layer outputs, placed by snn_plan so dead buffers are reused, and by
+// snn_place in DTCM when it fits there
+static uint8_t snn_arena[CIFAR_SNN_ARENA_SIZE] SNN_PLACE_ARENA __attribute__((aligned(SNN_ARENA_ALIGNMENT)));
 
-// Function to perform 2D convolution
-void conv2_2d(float* input, float* output, const conv2* conv_layer, int input_size) {
-    int output_size = (input_size - conv_layer->kernel_size + 2 * conv_layer->padding) / conv_layer->stride + 1;
-
-    for (int oc = 0; oc < conv_layer->out_channels; ++oc) {
-        for (int oh = 0; oh < output_size; ++oh) {
-            for (int ow = 0; ow < output_size; ++ow) {
-                float sum = 0;
-                for (int ic = 0; ic < conv_layer->in_channels; ++ic) {
-                    for (int kh = 0; kh < conv_layer->kernel_size; ++kh) {
-                        for (int kw = 0; kw < conv_layer->kernel_size; ++kw) {
-                            int ih = oh * conv_layer->stride + kh - conv_layer->padding;
-                            int iw = ow * conv_layer->stride + kw - conv_layer->padding;
-                            if (ih >= 0 && ih < input_size && iw >= 0 && iw < input_size) {
-                                sum += input[ic * input_size * input_size + ih * input_size + iw] * conv_layer->weights[oc][ic][kh][kw];
-                            }
-                        }
-                    }
-                }
-                output[oc * output_size * output_size + oh * output_size + ow] = sum;
-            }
-        }
-    }
-}
+// Per-step and per-layer cycle counts of the last inference, for the debugger
+static SNNRunResult snn_result SNN_PLACE_RESULTS;
 
-// Function to perform 2D convolution
-void conv3_2d(float* input, float* output, const conv3* conv_layer, int input_size) {
-    int output_size = (input_size - conv_layer->kernel_size + 2 * conv_layer->padding) / conv_layer->stride + 1;
-
-    for (int oc = 0; oc < conv_layer->out_channels; ++oc) {
-        for (int oh = 0; oh < output_size; ++oh) {
-            for (int ow = 0; ow < output_size; ++ow) {
-                float sum = 0;
-                for (int ic = 0; ic < conv_layer->in_channels; ++ic) {
-                    for (int kh = 0; kh < conv_layer->kernel_size; ++kh) {
-                        for (int kw = 0; kw < conv_layer->kernel_size; ++kw) {
-                            int ih = oh * conv_layer->stride + kh - conv_layer->padding;
-                            int iw = ow * conv_layer->stride + kw - conv_layer->padding;
-                            if (ih >= 0 && ih < input_size && iw >= 0 && iw < input_size) {
-                                sum += input[ic * input_size * input_size + ih * input_size + iw] * conv_layer->weights[oc][ic][kh][kw];
-                            }
-                        }
-                    }
-                }
-                output[oc * output_size * output_size + oh * output_size + ow] = sum;
-            }
-        }
-    }
+static uint32_t snn_cycles(void) {
+    return DWT->CYCCNT;
 }
 
-// Function to perform 2D max pooling
-void maxpool2d(float* input, float* output, int in_channels, int input_size, int kernel_size, int stride) {
-    int output_size = (input_size - kernel_size) / stride + 1;
-
-    for (int ic = 0; ic < in_channels; ++ic) {
-        for (int oh = 0; oh < output_size; ++oh) {
-            for (int ow = 0; ow < output_size; ++ow) {
-                int ih = oh * stride;
-                int iw = ow * stride;
-                float max_value = input[ic * input_size * input_size + ih * input_size + iw];
-                for (int kh = 0; kh < kernel_size; ++kh) {
-                    for (int kw = 0; kw < kernel_size; ++kw) {
-                        int nih = ih + kh;
-                        int niw = iw + kw;
-                        if (nih < input_size && niw < input_size) {
-                            float value = input[ic * input_size * input_size + nih * input_size + niw];
-                            if (value > max_value) {
-                                max_value = value;
-                            }
-                        }
-                    }
-                }
-                output[ic * output_size * output_size + oh * output_size + ow] = max_value;
-            }
-        }
-    }
-}
+// The network inference runs; SNN_OSPI_WEIGHTS builds point it at
+// cifar_snn_network rebased onto the OctoSPI flash, SNN_OSPI_MODEL builds
+// at the model blob there
+static const SNNNetwork* snn_network = &cifar_snn_network;
+
+#if defined(SNN_OSPI_MODEL) && defined(SNN_OSPI_WEIGHTS)
+#error "SNN_OSPI_MODEL and SNN_OSPI_WEIGHTS both claim the start of the OctoSPI flash"
+#endif
+
+#ifdef SNN_OSPI_MODEL
+// SNN_OSPI_MODEL builds run whatever model blob (snn_blob.h, written by
+// snn_blob) is programmed at the start of the OctoSPI flash, in place
+// through the memory mapping, so a retrained or reshaped model only needs
+// the flash reprogrammed. It must take 3x32x32 images and fit snn_arena.
+// Layers of the shapes cifar_snn_kernels were specialised for keep
+// running on them.
+#define OSPI_MODEL_BASE 0x90000000u
+#define OSPI_MODEL_BYTES (64u << 20)
+
+static SNNBlobModel snn_ospi_model;
+#endif
+
+#ifdef SNN_OSPI_WEIGHTS
+// SNN_OSPI_WEIGHTS builds leave the float weights out of internal flash.
+// The weight image of cifar_snn_network (snn_weights_image_write) is
+// programmed at the start of the OctoSPI flash, which OCTOSPI1 maps at
+// OSPI_WEIGHTS_BASE. SNN_OSPI_STAGING bytes of RAM, at least the
+// snn_weights_channel_bytes() of the network, make the kernels read
+// staged copies of the weights; 0 has them read the mapping in place.
+// SNN_MDMA_PREFETCH builds split the staging in two halves of at least
+// that each and have MDMA copy the next chunk into one while the layer
+// computes on the other; snn_weight_source.stats keeps the copy and stall
+// cycles of each layer for the debugger.
+#define OSPI_WEIGHTS_BASE 0x90000000u
+#ifndef SNN_OSPI_STAGING
+#ifdef SNN_MDMA_PREFETCH
+#define SNN_OSPI_STAGING (2 * 16384)
+#else
+#define SNN_OSPI_STAGING 0
+#endif
+#endif
+
+static SNNLayer snn_ospi_layers[SNN_MAX_LAYERS];
+static SNNNetwork snn_ospi_network;
+static SNNWeightSource snn_weight_source;
+#ifdef SNN_MDMA_PREFETCH
+static SNNAsyncCopy snn_weight_copy;
+#endif
+#if SNN_OSPI_STAGING > 0
+static uint8_t snn_weight_staging[SNN_OSPI_STAGING] SNN_DTCM __attribute__((aligned(SNN_CACHE_LINE_BYTES)));
+#endif
+#endif
 
 // Function to perform inference
-int inference(const float input_image[3][INPUT_SIZE][INPUT_SIZE], conv1* conv1, conv2* conv2, conv3* conv3, FullyConnectedLayer* fc_layer1, FullyConnectedLayer2* fc_layer2) {
-    // Step 1: Convolutional Layer 1
-    float conv1_output[CONV1_OUT_CHANNELS][INPUT_SIZE][INPUT_SIZE] = {0};
-    LIFNeuron lif1_neurons[CONV1_OUT_CHANNELS * INPUT_SIZE * INPUT_SIZE] = {0};
-    conv1_2d(&input_image[0][0][0], &conv1_output[0][0][0], conv1, INPUT_SIZE);
-
-    // Step 2: Apply LIF neurons to conv1 output
-    for (int i = 0; i < CONV1_OUT_CHANNELS * INPUT_SIZE * INPUT_SIZE; i++) {
-        update_neuron(&lif1_neurons[i], conv1_output[0][0][i], LIF1_BETA, THRESHOLD);
-        conv1_output[0][0][i] = lif1_neurons[i].should_spike ? 1.0 : 0.0;
-    }
-
-    // Step 3: Max Pooling 1
-    int pool1_output_size = INPUT_SIZE / 2;
-    float pool1_output[CONV1_OUT_CHANNELS][INPUT_SIZE / 2][INPUT_SIZE / 2] = {0};
-    maxpool2d(&conv1_output[0][0][0], &pool1_output[0][0][0], CONV1_OUT_CHANNELS, INPUT_SIZE, 2, 2);
-
-    // Step 4: Convolutional Layer 2
-    int conv2_input_size = pool1_output_size;
-    float conv2_output[CONV2_OUT_CHANNELS][INPUT_SIZE / 2][INPUT_SIZE / 2] = {0};
-    LIFNeuron lif2_neurons[CONV2_OUT_CHANNELS * (INPUT_SIZE / 2) * (INPUT_SIZE / 2)] = {0};
-    conv2_2d(&pool1_output[0][0][0], &conv2_output[0][0][0], conv2, conv2_input_size);
-
-    // Step 5: Apply LIF neurons to conv2 output
-    for (int i = 0; i < CONV2_OUT_CHANNELS * conv2_input_size * conv2_input_size; i++) {
-        update_neuron(&lif2_neurons[i], conv2_output[0][0][i], LIF2_BETA, THRESHOLD);
-        conv2_output[0][0][i] = lif2_neurons[i].should_spike ? 1.0 : 0.0;
-    }
-
-    // Step 6: Max Pooling 2
-    int pool2_output_size = conv2_input_size / 2;
-    float pool2_output[CONV2_OUT_CHANNELS][(INPUT_SIZE / 2)/2][(INPUT_SIZE / 2)/2] = {0};
-    maxpool2d(&conv2_output[0][0][0], &pool2_output[0][0][0], CONV2_OUT_CHANNELS, conv2_input_size, 2, 2);
-
-    // Step 7: Convolutional Layer 3
-    int conv3_input_size = pool2_output_size;
-    float conv3_output[CONV3_OUT_CHANNELS][(INPUT_SIZE / 2)/2][(INPUT_SIZE / 2)/2] = {0};
-    LIFNeuron lif3_neurons[CONV3_OUT_CHANNELS * (INPUT_SIZE / 2)/2 * (INPUT_SIZE / 2)/2] = {0};
-    conv3_2d(&pool2_output[0][0][0], &conv3_output[0][0][0], conv3, conv3_input_size);
-
-    // Step 8: Apply LIF neurons to conv3 output
-    for (int i = 0; i < CONV3_OUT_CHANNELS * conv3_input_size * conv3_input_size; i++) {
-        update_neuron(&lif3_neurons[i], conv3_output[0][0][i], LIF3_BETA, THRESHOLD);
-        conv3_output[0][0][i] = lif3_neurons[i].should_spike ? 1.0 : 0.0;
-    }
-
-    // Step 9: Max Pooling 3
-    int pool3_output_size = conv3_input_size / 2;
-    float pool3_output[CONV3_OUT_CHANNELS][(INPUT_SIZE / 2)/2/2][(INPUT_SIZE / 2)/2/2] = {0};
-    maxpool2d(&conv3_output[0][0][0], &pool3_output[0][0][0], CONV3_OUT_CHANNELS, conv3_input_size, 2, 2);
-
-    // Step 10: Fully Connected Layer 1
-    int fc1_input_size = CONV3_OUT_CHANNELS * pool3_output_size * pool3_output_size;
-    float fc1_input[fc1_input_size];
-    for (int c = 0; c < CONV3_OUT_CHANNELS; c++) {
-        for (int h = 0; h < pool3_output_size; h++) {
-            for (int w = 0; w < pool3_output_size; w++) {
-                fc1_input[c * pool3_output_size * pool3_output_size + h * pool3_output_size + w] = pool3_output[c][h][w];
-            }
-        }
-    }
-
-    float fc1_output[FC1_OUT_FEATURES] = {0};
-    LIFNeuron lif4_neurons[FC1_OUT_FEATURES] = {0};
-
-    for (int i = 0; i < FC1_OUT_FEATURES; i++) {
-        float sum = 0;
-        for (int j = 0; j < fc1_input_size; j++) {
-            sum += (fc1_weights[i][j]) * fc1_input[j];
-        }
-        update_neuron(&lif4_neurons[i], sum, LIF4_BETA, THRESHOLD);
-        fc1_output[i] = lif4_neurons[i].should_spike ? 1.0 : 0.0;
-    }
-
-    // Step 11: Fully Connected Layer 2
-    float fc2_output[FC2_OUT_FEATURES] = {0};
-    LIFNeuron lif5_neurons[FC2_OUT_FEATURES] = {0};
-
-    for (int i = 0; i < FC2_OUT_FEATURES; i++) {
-        float sum = 0;
-        for (int j = 0; j < FC1_OUT_FEATURES; j++) {
-            sum += (fc2_weights[i][j]) * fc1_output[j];
-        }
-        update_neuron(&lif5_neurons[i], sum, LIF5_BETA, THRESHOLD);
-        fc2_output[i] = lif5_neurons[i].should_spike ? 1.0 : 0.0;
-    }
-
-    // Determine the predicted class (the index of the maximum value in fc2_output)
-    int predicted_class = 0;
-    float max_value = fc2_output[0];
-    for (int i = 1; i < FC2_OUT_FEATURES; i++) {
-        if (fc2_output[i] > max_value) {
-            max_value = fc2_output[i];
-            predicted_class = i;
-        }
-    }
-
-    return predicted_class;
+int inference(const float input_image[3][INPUT_SIZE][INPUT_SIZE]) {
+    SNNRunConfig config = {0, snn_cycles};
+    return snn_network_run(snn_network, &input_image[0][0][0], snn_arena, sizeof(snn_arena), &config, &snn_result);
 }
 /* USER CODE END Includes */
 
@@ -375,6 +186,127 @@ static void MX_USART1_UART_Init(void);
 
 /* Private user code ---------------------------------------------------------*/
 /* USER CODE BEGIN 0 */
+#if defined(SNN_OSPI_WEIGHTS) || defined(SNN_OSPI_MODEL)
+/**
+  * @brief OCTOSPI1 Initialization Function: the MX25LM51245G of the
+  *        H735G-DK, still in its 1-line SPI mode after reset, mapped at
+  *        0x90000000 for reads with FAST READ4B
+  * @param None
+  * @retval None
+  */
+static void MX_OCTOSPI1_MemoryMapped_Init(void)
+{
+  OSPIM_CfgTypeDef sOspiManagerCfg = {0};
+  OSPI_RegularCmdTypeDef sCommand = {0};
+  OSPI_MemoryMappedTypeDef sMemMappedCfg = {0};
+
+  hospi1.Instance = OCTOSPI1;
+  hospi1.Init.FifoThreshold = 4;
+  hospi1.Init.DualQuad = HAL_OSPI_DUALQUAD_DISABLE;
+  hospi1.Init.MemoryType = HAL_OSPI_MEMTYPE_MACRONIX;
+  hospi1.Init.DeviceSize = 26;
+  hospi1.Init.ChipSelectHighTime = 2;
+  hospi1.Init.FreeRunningClock = HAL_OSPI_FREERUNCLK_DISABLE;
+  hospi1.Init.ClockMode = HAL_OSPI_CLOCK_MODE_0;
+  hospi1.Init.WrapSize = HAL_OSPI_WRAP_NOT_SUPPORTED;
+  hospi1.Init.ClockPrescaler = 4;
+  hospi1.Init.SampleShifting = HAL_OSPI_SAMPLE_SHIFTING_HALFCYCLE;
+  hospi1.Init.DelayHoldQuarterCycle = HAL_OSPI_DHQC_DISABLE;
+  hospi1.Init.ChipSelectBoundary = 0;
+  hospi1.Init.DelayBlockBypass = HAL_OSPI_DELAY_BLOCK_BYPASSED;
+  hospi1.Init.MaxTran = 0;
+  hospi1.Init.Refresh = 0;
+  if (HAL_OSPI_Init(&hospi1) != HAL_OK)
+  {
+    Error_Handler();
+  }
+  sOspiManagerCfg.ClkPort = 1;
+  sOspiManagerCfg.DQSPort = 1;
+  sOspiManagerCfg.NCSPort = 1;
+  sOspiManagerCfg.IOLowPort = HAL_OSPIM_IOPORT_1_LOW;
+  sOspiManagerCfg.IOHighPort = HAL_OSPIM_IOPORT_1_HIGH;
+  sOspiManagerCfg.Req2AckTime = 1;
+  if (HAL_OSPIM_Config(&hospi1, &sOspiManagerCfg, HAL_OSPI_TIMEOUT_DEFAULT_VALUE) != HAL_OK)
+  {
+    Error_Handler();
+  }
+
+  // FAST READ4B: command, 4-byte address and data on one line, 8 dummy cycles
+  sCommand.OperationType = HAL_OSPI_OPTYPE_READ_CFG;
+  sCommand.FlashId = HAL_OSPI_FLASH_ID_1;
+  sCommand.Instruction = 0x0C;
+  sCommand.InstructionMode = HAL_OSPI_INSTRUCTION_1_LINE;
+  sCommand.InstructionSize = HAL_OSPI_INSTRUCTION_8_BITS;
+  sCommand.InstructionDtrMode = HAL_OSPI_INSTRUCTION_DTR_DISABLE;
+  sCommand.AddressMode = HAL_OSPI_ADDRESS_1_LINE;
+  sCommand.AddressSize = HAL_OSPI_ADDRESS_32_BITS;
+  sCommand.AddressDtrMode = HAL_OSPI_ADDRESS_DTR_DISABLE;
+  sCommand.AlternateBytesMode = HAL_OSPI_ALTERNATE_BYTES_NONE;
+  sCommand.DataMode = HAL_OSPI_DATA_1_LINE;
+  sCommand.DataDtrMode = HAL_OSPI_DATA_DTR_DISABLE;
+  sCommand.DummyCycles = 8;
+  sCommand.DQSMode = HAL_OSPI_DQS_DISABLE;
+  sCommand.SIOOMode = HAL_OSPI_SIOO_INST_EVERY_CMD;
+  if (HAL_OSPI_Command(&hospi1, &sCommand, HAL_OSPI_TIMEOUT_DEFAULT_VALUE) != HAL_OK)
+  {
+    Error_Handler();
+  }
+  // The mapping needs a write command too; PAGE PROGRAM4B, never issued
+  sCommand.OperationType = HAL_OSPI_OPTYPE_WRITE_CFG;
+  sCommand.Instruction = 0x12;
+  sCommand.DummyCycles = 0;
+  if (HAL_OSPI_Command(&hospi1, &sCommand, HAL_OSPI_TIMEOUT_DEFAULT_VALUE) != HAL_OK)
+  {
+    Error_Handler();
+  }
+
+  sMemMappedCfg.TimeOutActivation = HAL_OSPI_TIMEOUT_COUNTER_DISABLE;
+  if (HAL_OSPI_MemoryMapped(&hospi1, &sMemMappedCfg) != HAL_OK)
+  {
+    Error_Handler();
+  }
+}
+#endif
+
+#ifdef SNN_OSPI_WEIGHTS
+// Point inference at the weights in the OctoSPI flash
+static void snn_ospi_weights_init(void)
+{
+#if defined(SNN_MDMA_PREFETCH)
+  snn_mdma_init(&snn_weight_copy, snn_cycles);
+  snn_weights_prefetch(&snn_weight_source, snn_weight_staging, sizeof(snn_weight_staging), &snn_weight_copy,
+                       &snn_ospi_network);
+#elif SNN_OSPI_STAGING > 0
+  snn_weights_copy(&snn_weight_source, snn_weight_staging, sizeof(snn_weight_staging));
+#else
+  snn_weights_mapped(&snn_weight_source);
+#endif
+  if (snn_network_rebase(&cifar_snn_network, (const void*)OSPI_WEIGHTS_BASE,
+                         snn_weights_image_size(&cifar_snn_network), snn_ospi_layers, &snn_weight_source,
+                         &snn_ospi_network) != 0)
+  {
+    Error_Handler();
+  }
+  snn_network = &snn_ospi_network;
+}
+#endif
+
+#ifdef SNN_OSPI_MODEL
+// Point inference at the model blob in the OctoSPI flash
+static void snn_ospi_model_init(void)
+{
+  const SNNNetwork* network = &snn_ospi_model.network;
+
+  if (snn_blob_load(&snn_ospi_model, (const void*)OSPI_MODEL_BASE, OSPI_MODEL_BYTES) != 0 ||
+      snn_layer_input_count(&network->layers[0]) != 3 * INPUT_SIZE * INPUT_SIZE ||
+      snn_network_arena_size(network, network->timesteps) > sizeof(snn_arena))
+  {
+    Error_Handler();
+  }
+  snn_ospi_model.network.kernels = cifar_snn_network.kernels;
+  snn_network = network;
+}
+#endif
 
 /* USER CODE END 0 */
 
@@ -386,15 +318,6 @@ int main(void)
 {
 
   /* USER CODE BEGIN 1 */
-    // Initialize convolutional layers
-    conv1 conv1 = {CONV1_IN_CHANNELS, CONV1_OUT_CHANNELS, CONV1_KERNEL_SIZE, CONV1_STRIDE, CONV1_PADDING, (const float (*)[CONV1_IN_CHANNELS][CONV1_KERNEL_SIZE][CONV1_KERNEL_SIZE])conv1_weights};
-    conv2 conv2 = {CONV2_IN_CHANNELS, CONV2_OUT_CHANNELS, CONV2_KERNEL_SIZE, CONV2_STRIDE, CONV2_PADDING, (const float (*)[CONV2_IN_CHANNELS][CONV2_KERNEL_SIZE][CONV2_KERNEL_SIZE])conv2_weights};
-    conv3 conv3 = {CONV3_IN_CHANNELS, CONV3_OUT_CHANNELS, CONV3_KERNEL_SIZE, CONV3_STRIDE, CONV3_PADDING, (const float (*)[CONV3_IN_CHANNELS][CONV3_KERNEL_SIZE][CONV3_KERNEL_SIZE])conv3_weights};
-
-    // Initialize fully connected layer
-    FullyConnectedLayer fc_layer1 = {(const float (*)[FC1_OUT_FEATURES][FC1_IN_FEATURES])fc1_weights};
-    FullyConnectedLayer2 fc_layer2 = {(const float (*)[FC2_OUT_FEATURES][FC2_IN_FEATURES])fc2_weights};
-
     int predicted_class;
     uint32_t timestamp0;
     uint32_t timestamp1;
@@ -406,7 +329,12 @@ int main(void)
   HAL_Init();
 
   /* USER CODE BEGIN Init */
-
+  // D2 SRAM is unclocked after reset; then move the tagged kernels and
+  // buffers into place before anything runs from them
+  __HAL_RCC_D2SRAM1_CLK_ENABLE();
+  __HAL_RCC_D2SRAM2_CLK_ENABLE();
+  snn_placement_init();
+  snn_cache_init();
   /* USER CODE END Init */
 
   /* Configure the system clock */
@@ -424,7 +352,17 @@ int main(void)
   MX_TIM1_Init();
   MX_USART1_UART_Init();
   /* USER CODE BEGIN 2 */
-
+  CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+  DWT->LAR = 0xC5ACCE55;
+  DWT->CYCCNT = 0;
+  DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+#ifdef SNN_OSPI_WEIGHTS
+  MX_OCTOSPI1_MemoryMapped_Init();
+  snn_ospi_weights_init();
+#elif defined(SNN_OSPI_MODEL)
+  MX_OCTOSPI1_MemoryMapped_Init();
+  snn_ospi_model_init();
+#endif
   /* USER CODE END 2 */
 
   /* Infinite loop */
@@ -432,7 +370,7 @@ int main(void)
   while (1)
   {
 	  timestamp0 = htim1.Instance->CNT;
-	  predicted_class = inference(cifar10_images[0], &conv1, &conv2, &conv3, &fc_layer1, &fc_layer2);
+	  predicted_class = inference(cifar10_images[0]);
 	  timestamp1 = htim1.Instance->CNT;
 
 	  HAL_Delay(500);
@@ -0,0 +1,21 @@
+// Generated by snn_core/Tools/snn_plan from the mnist_cnn layer table.
+// Regenerate with the snn_arena_headers target after changing the model.
+#ifndef MNIST_CNN_ARENA_H
+#define MNIST_CNN_ARENA_H
+
+// Peak activation memory of snn_network_inference(); keeping every
+// layer output live for the whole inference would take 85496 bytes.
+#if defined(SNN_INT8_WEIGHTS)
+#define MNIST_CNN_ARENA_SIZE 22736
+#elif defined(SNN_CODEBOOK_WEIGHTS)
+#define MNIST_CNN_ARENA_SIZE 20176
+#else
+#define MNIST_CNN_ARENA_SIZE 69776
+#endif
+
+// Memory of snn_stream_run(); int8 and codebook builds cannot stream.
+#if !defined(SNN_INT8_WEIGHTS) && !defined(SNN_CODEBOOK_WEIGHTS)
+#define MNIST_CNN_STREAM_SIZE 17440
+#endif
+
+#endif // MNIST_CNN_ARENA_H
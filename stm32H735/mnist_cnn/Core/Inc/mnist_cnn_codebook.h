@@ -0,0 +1,688 @@
+// Generated by snn_core/Tools/snn_codebook from the mnist_cnn weights.
+// Regenerate with the snn_codebook_headers target after retraining the model.
+#ifndef MNIST_CNN_CODEBOOK_H
+#define MNIST_CNN_CODEBOOK_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "snn_codebook.h"
+
+static const uint8_t mnist_cnn_layer0_indices[72] = {
+    0x8a, 0xcd, 0x9d, 0x6e, 0xc5, 0x54, 0x9f, 0xd6, 0xbb, 0xdc, 0xaa, 0xc9, 0x67, 0xe6, 0x7b, 0x7f,
+    0xd5, 0x56, 0xdb, 0x88, 0xad, 0x63, 0xab, 0xcb, 0xc8, 0x3e, 0x83, 0xdc, 0xb6, 0xab, 0xa9, 0xcb,
+    0xef, 0x89, 0x58, 0x63, 0x98, 0x7a, 0x88, 0x98, 0x58, 0xab, 0xcc, 0xca, 0x9d, 0xca, 0xfa, 0xc8,
+    0x7c, 0xc5, 0xd9, 0x76, 0x7e, 0xc8, 0x9c, 0x9b, 0xcd, 0xcb, 0x8b, 0xba, 0xad, 0xa9, 0xab, 0x06,
+    0xdb, 0x10, 0xae, 0xd5, 0x44, 0xfe, 0xb9, 0xb9,
+};
+
+static const float mnist_cnn_layer0_codebook[16] = {
+    -1.2375288f, -1.16725039f, -0.990450978f, -0.837060869f,
+    -0.729228973f, -0.583011627f, -0.412671149f, -0.292370945f,
+    -0.163103282f, -0.0152944466f, 0.122600369f, 0.285182863f,
+    0.39324519f, 0.500401497f, 0.643433988f, 0.784972131f,
+};
+
+static const uint8_t mnist_cnn_layer2_indices[2304] = {
+    0x78, 0x3a, 0xb7, 0x85, 0x59, 0xa5, 0x48, 0xbc, 0xc7, 0x66, 0x49, 0x87, 0x76, 0xb8, 0xea, 0xa8,
+    0x6e, 0xca, 0x88, 0x76, 0x7b, 0x78, 0xa5, 0x8b, 0x98, 0x85, 0x57, 0x85, 0x5b, 0xaa, 0x87, 0x5a,
+    0x25, 0x15, 0x43, 0x41, 0x88, 0x98, 0x89, 0x88, 0x58, 0x99, 0xa5, 0x8a, 0x9a, 0x85, 0x3b, 0xb9,
+    0x87, 0x89, 0x8b, 0xc8, 0x98, 0x89, 0xb6, 0x6a, 0xaa, 0x87, 0x79, 0x99, 0x96, 0x9a, 0x9a, 0x69,
+    0xb6, 0x87, 0x6a, 0x4b, 0xb7, 0x54, 0x7c, 0xa8, 0xb7, 0x88, 0x8b, 0x95, 0x48, 0xb9, 0xc5, 0x7a,
+    0x8b, 0xa6, 0x8a, 0x69, 0x99, 0xa8, 0xbb, 0xab, 0x4b, 0x99, 0x5a, 0xc7, 0x54, 0xaa, 0x76, 0x65,
+    0x39, 0x95, 0x89, 0xa8, 0xa9, 0x8b, 0x98, 0x18, 0x66, 0x22, 0x33, 0xb8, 0x88, 0x99, 0x88, 0x99,
+    0x98, 0x7a, 0x99, 0xa6, 0x8a, 0xa7, 0x77, 0x89, 0x88, 0xa7, 0x78, 0x7c, 0xb7, 0x58, 0xaa, 0x96,
+    0x5a, 0xa9, 0x98, 0x7a, 0x98, 0x96, 0x77, 0x86, 0x99, 0x9a, 0x6a, 0x65, 0x97, 0xb8, 0x67, 0x8a,
+    0xb9, 0x47, 0x88, 0x97, 0xba, 0x7c, 0xd9, 0x4b, 0x8b, 0x86, 0x96, 0x77, 0x96, 0xcb, 0x8c, 0x83,
+    0x48, 0x85, 0x7c, 0xed, 0x9a, 0xb7, 0x9b, 0x97, 0x7a, 0x55, 0xa9, 0x8b, 0xa6, 0x7a, 0x96, 0x29,
+    0x94, 0xa9, 0x9a, 0xdb, 0x87, 0x79, 0x88, 0x89, 0xa9, 0x77, 0xa6, 0x8a, 0x99, 0x98, 0x77, 0x77,
+    0xa7, 0x8a, 0x77, 0x9a, 0x7a, 0x88, 0x69, 0x85, 0x89, 0x89, 0x88, 0x58, 0x77, 0x99, 0x97, 0x98,
+    0x99, 0x2c, 0x68, 0xa6, 0x7b, 0xc9, 0x5b, 0x9b, 0xb8, 0xba, 0x4a, 0x98, 0x36, 0xaa, 0xa5, 0xa6,
+    0x9a, 0xa7, 0x89, 0x5a, 0x79, 0xa7, 0xbd, 0xdc, 0xc8, 0x4c, 0x37, 0x45, 0x22, 0x34, 0x69, 0x56,
+    0x35, 0x47, 0xb6, 0xba, 0xa8, 0x5a, 0x99, 0x37, 0x58, 0x43, 0x54, 0xb9, 0x99, 0x88, 0x89, 0x88,
+    0xb9, 0x4a, 0xab, 0xa6, 0xa8, 0xca, 0xa7, 0x5a, 0x9a, 0xa7, 0x38, 0x6a, 0x75, 0x66, 0xab, 0xa4,
+    0x49, 0x9a, 0xa9, 0x6a, 0x9b, 0x96, 0x77, 0x85, 0x4a, 0x87, 0x47, 0x66, 0x8a, 0xa6, 0x95, 0xa9,
+    0x44, 0x56, 0xcc, 0x9d, 0x59, 0x58, 0x65, 0x74, 0x56, 0x66, 0x77, 0xc7, 0xaa, 0x29, 0x24, 0x41,
+    0x97, 0xba, 0x86, 0x62, 0x66, 0x61, 0x72, 0x75, 0x99, 0x6b, 0x46, 0x84, 0x77, 0x7a, 0x99, 0xb9,
+    0x7d, 0x57, 0xae, 0xaa, 0x88, 0x99, 0x98, 0x87, 0x69, 0x96, 0xc6, 0xcc, 0x7a, 0x35, 0x55, 0xcb,
+    0xbc, 0x3a, 0xb4, 0x7a, 0x8b, 0x6a, 0x64, 0x9a, 0xaa, 0x9a, 0x65, 0x97, 0xb7, 0xbc, 0x9a, 0x99,
+    0x94, 0x47, 0x85, 0x68, 0x89, 0xa7, 0xb5, 0x68, 0x54, 0xa6, 0x47, 0xab, 0x38, 0x47, 0xab, 0xbd,
+    0xed, 0x88, 0x7c, 0x26, 0xa9, 0x1a, 0x33, 0x66, 0xa1, 0x36, 0xa7, 0x5a, 0x6b, 0xca, 0xac, 0xda,
+    0xa5, 0x87, 0x99, 0x64, 0xa4, 0x58, 0xa9, 0xcb, 0xda, 0x66, 0x97, 0x99, 0x87, 0x98, 0x97, 0x89,
+    0x69, 0x55, 0x8b, 0xa7, 0x89, 0x64, 0xa9, 0x48, 0x9b, 0x79, 0xa5, 0x67, 0xb6, 0x88, 0x54, 0x96,
+    0x59, 0x99, 0x5a, 0x76, 0x7a, 0x95, 0x78, 0x77, 0x79, 0xa8, 0x87, 0x4a, 0x36, 0xab, 0xaa, 0xdc,
+    0x9b, 0x8a, 0x8a, 0x68, 0xb8, 0x99, 0x76, 0xba, 0x98, 0x8a, 0xc9, 0x8b, 0x67, 0x68, 0x64, 0x56,
+    0x76, 0xb6, 0x57, 0xc8, 0xcc, 0xb8, 0x69, 0x87, 0xba, 0x8a, 0xa7, 0x8b, 0x99, 0x87, 0x89, 0x97,
+    0xa8, 0xcd, 0xaa, 0xca, 0x77, 0x99, 0x79, 0x88, 0xa9, 0x88, 0x67, 0x86, 0x89, 0x89, 0xa8, 0x7a,
+    0x88, 0x7a, 0xaa, 0xa9, 0x69, 0x97, 0x99, 0x88, 0x96, 0x67, 0xa9, 0x89, 0x77, 0x88, 0x99, 0xa4,
+    0x56, 0x7a, 0x66, 0xb6, 0x9a, 0xa9, 0xaa, 0x79, 0x5a, 0xb9, 0x79, 0xa8, 0xe8, 0x49, 0xcc, 0x88,
+    0xcc, 0x56, 0xa7, 0x45, 0x67, 0xa7, 0x45, 0x7a, 0x8a, 0x9b, 0xb5, 0x99, 0x87, 0xca, 0x54, 0xb9,
+    0x85, 0x58, 0x57, 0x69, 0xc6, 0x87, 0x8b, 0x79, 0x97, 0x43, 0x41, 0x02, 0x89, 0x78, 0x87, 0x89,
+    0xa8, 0x95, 0x7a, 0x87, 0x99, 0x69, 0xa9, 0x79, 0x78, 0x37, 0xb5, 0xaa, 0xa8, 0x69, 0x48, 0xb8,
+    0x78, 0xa9, 0x88, 0x86, 0x69, 0x87, 0x79, 0xaa, 0xa9, 0x79, 0xb6, 0xcb, 0x48, 0xad, 0x97, 0xbc,
+    0x65, 0xc5, 0xa9, 0x78, 0x58, 0xa7, 0x9a, 0x59, 0x73, 0x38, 0xb4, 0x7a, 0xbc, 0x3b, 0x20, 0x65,
+    0x94, 0x73, 0x04, 0x61, 0x67, 0x8a, 0x7c, 0x43, 0x99, 0xb7, 0xba, 0x66, 0x96, 0x9a, 0x79, 0xda,
+    0x43, 0x96, 0xe8, 0xcc, 0x89, 0x79, 0x88, 0x79, 0x78, 0x88, 0xab, 0x59, 0x76, 0x44, 0xc4, 0x9b,
+    0x99, 0x8a, 0x75, 0x99, 0xa8, 0x9a, 0x77, 0xa8, 0x9a, 0x88, 0x69, 0x87, 0xaa, 0x98, 0x86, 0x87,
+    0x6c, 0x98, 0x99, 0x59, 0x87, 0xba, 0x7b, 0x76, 0x98, 0x99, 0x78, 0x89, 0x88, 0x99, 0x89, 0xa7,
+    0x98, 0x88, 0x98, 0x78, 0x88, 0x87, 0x78, 0x78, 0x98, 0x78, 0x88, 0x89, 0x98, 0x88, 0x88, 0x87,
+    0x88, 0x88, 0x79, 0x89, 0x78, 0x78, 0x88, 0x98, 0x88, 0x79, 0x89, 0x99, 0x88, 0x79, 0x89, 0x89,
+    0x89, 0x88, 0x98, 0x99, 0x99, 0x78, 0x89, 0x97, 0x79, 0x79, 0x87, 0x87, 0x89, 0x98, 0x88, 0x88,
+    0x98, 0x98, 0x78, 0x88, 0x89, 0x89, 0x77, 0x79, 0x87, 0x77, 0x78, 0x88, 0x98, 0x89, 0x89, 0x87,
+    0x77, 0x98, 0x9a, 0x78, 0xa9, 0x7b, 0x8a, 0x76, 0x56, 0x67, 0xa6, 0xcb, 0xa9, 0x89, 0x47, 0x53,
+    0x75, 0x97, 0x23, 0x70, 0xaa, 0xc9, 0x5c, 0x34, 0xab, 0xba, 0xbc, 0x9b, 0xb8, 0xaa, 0x75, 0x56,
+    0x31, 0xdb, 0xcd, 0xee, 0x98, 0x98, 0x88, 0x88, 0xa9, 0x9a, 0xa9, 0x49, 0x55, 0x89, 0xa8, 0xac,
+    0xa8, 0x78, 0x89, 0xab, 0x89, 0x87, 0x9a, 0x99, 0xaa, 0x56, 0xa5, 0xa8, 0x98, 0x7a, 0x77, 0x55,
+    0x77, 0x57, 0x89, 0xa8, 0x89, 0xab, 0x79, 0x46, 0x7a, 0x99, 0x68, 0x7a, 0x77, 0xdb, 0x41, 0x5e,
+    0xa1, 0x8a, 0x57, 0x7a, 0x7a, 0x5a, 0xb5, 0x59, 0xc6, 0x67, 0xdb, 0x58, 0xee, 0xba, 0xae, 0x58,
+    0xa5, 0x77, 0xc8, 0xb8, 0x7a, 0xa9, 0x77, 0xb8, 0xa7, 0xa5, 0xa5, 0xaa, 0x89, 0x99, 0x97, 0x98,
+    0x98, 0x7a, 0x88, 0x77, 0x88, 0x99, 0x99, 0x69, 0x89, 0x99, 0x69, 0x96, 0x78, 0xb9, 0x99, 0x87,
+    0x88, 0x76, 0x99, 0x88, 0x88, 0x89, 0x96, 0x68, 0x78, 0xa7, 0x85, 0xab, 0xbc, 0x64, 0x5c, 0x73,
+    0x7b, 0x5a, 0xda, 0xcb, 0x68, 0x58, 0x58, 0x85, 0x88, 0xaa, 0x86, 0xb7, 0xa5, 0x5b, 0xa8, 0xaa,
+    0x9d, 0xce, 0xec, 0xb9, 0x46, 0x55, 0xc5, 0x7a, 0x79, 0x65, 0x58, 0x94, 0x67, 0x76, 0x99, 0xd8,
+    0x5c, 0x3a, 0x59, 0xab, 0x88, 0x89, 0x87, 0x99, 0x69, 0x86, 0xa5, 0xab, 0x7a, 0x6a, 0x57, 0xc9,
+    0xb8, 0x5a, 0xa8, 0xb8, 0xa6, 0x79, 0x76, 0x4a, 0x9a, 0xab, 0x66, 0x87, 0x84, 0xba, 0x6a, 0x96,
+    0x75, 0x54, 0x66, 0x77, 0x88, 0x77, 0x97, 0x9a, 0x87, 0x78, 0x88, 0x88, 0x8a, 0x57, 0xa6, 0x6a,
+    0xb8, 0x87, 0x77, 0x78, 0xa8, 0x48, 0x42, 0x33, 0x68, 0xb4, 0x68, 0x57, 0x35, 0x56, 0xa3, 0x8a,
+    0x79, 0xa7, 0x67, 0x87, 0x89, 0x9a, 0xa8, 0xaa, 0x7b, 0x23, 0x53, 0x23, 0x89, 0x99, 0x89, 0x99,
+    0x68, 0x87, 0xaa, 0x89, 0xb9, 0x76, 0x77, 0x88, 0x88, 0x79, 0x67, 0x89, 0xb9, 0x8b, 0x96, 0xa8,
+    0x99, 0xa9, 0x8b, 0xa9, 0xa9, 0x8a, 0x99, 0xa8, 0x69, 0xba, 0x98, 0x7b, 0x78, 0xb9, 0x7a, 0xaa,
+    0xba, 0xa9, 0x8a, 0x99, 0x68, 0x97, 0xb7, 0xb8, 0x8b, 0xa6, 0x8b, 0x8a, 0x7a, 0x87, 0x69, 0xcd,
+    0xb6, 0xab, 0x76, 0x8b, 0xd5, 0x9c, 0x5d, 0xc7, 0x67, 0x8a, 0xc5, 0x99, 0xa9, 0x7a, 0xab, 0x56,
+    0xca, 0x83, 0x29, 0xb3, 0x97, 0x97, 0x98, 0x88, 0x99, 0x8a, 0x99, 0x87, 0x69, 0xa7, 0x9a, 0x7a,
+    0x89, 0x98, 0xa8, 0x9b, 0xcb, 0x66, 0xa8, 0x99, 0x79, 0x88, 0x74, 0x78, 0x99, 0x86, 0x66, 0x23,
+    0x33, 0x44, 0x98, 0x85, 0x88, 0x86, 0xa8, 0x7a, 0xaa, 0x5a, 0x76, 0x77, 0xa6, 0x68, 0xb5, 0x3d,
+    0xa7, 0x89, 0x8a, 0x79, 0x98, 0x6a, 0xa6, 0x58, 0x74, 0x22, 0x9c, 0x65, 0xa9, 0xad, 0x8a, 0x75,
+    0x76, 0xa7, 0x96, 0x9a, 0x8a, 0xca, 0x99, 0x8b, 0x86, 0x45, 0xa5, 0xbb, 0x88, 0x89, 0x87, 0x89,
+    0x97, 0xaa, 0x98, 0x79, 0x98, 0xba, 0x7a, 0x87, 0x86, 0xa8, 0x79, 0x79, 0xa8, 0xa6, 0xaa, 0x97,
+    0xa8, 0x98, 0x8a, 0x8a, 0x89, 0x98, 0x88, 0x56, 0x43, 0xa9, 0x76, 0xca, 0x8a, 0xa7, 0x4c, 0x9a,
+    0xac, 0x66, 0x76, 0xc9, 0x9b, 0x67, 0x22, 0x65, 0x7a, 0xac, 0xb8, 0x75, 0xa5, 0xda, 0x6a, 0x28,
+    0x64, 0x57, 0x8a, 0x7a, 0x54, 0x62, 0xa8, 0x8a, 0x58, 0x54, 0xab, 0x9b, 0x65, 0x86, 0xb9, 0xc8,
+    0xab, 0x5b, 0x17, 0xc7, 0x87, 0x88, 0x88, 0x89, 0xa9, 0x67, 0x84, 0xba, 0x9c, 0xbb, 0x67, 0x75,
+    0xb8, 0xab, 0x77, 0x88, 0x98, 0x69, 0x6a, 0x47, 0xa7, 0xbb, 0xb9, 0x79, 0x86, 0xaa, 0xab, 0x6b,
+    0x79, 0x65, 0x98, 0xaa, 0x66, 0x94, 0x7a, 0x9c, 0xa9, 0xba, 0x9c, 0x9a, 0xb5, 0x64, 0x79, 0x72,
+    0x69, 0x78, 0x78, 0x89, 0xc8, 0x79, 0x97, 0xca, 0xcc, 0x79, 0xef, 0xc5, 0x9b, 0x86, 0xbc, 0x67,
+    0x79, 0x65, 0x98, 0x88, 0x89, 0x99, 0x98, 0xc8, 0x98, 0x97, 0xa7, 0xcd, 0x88, 0x88, 0x99, 0x99,
+    0x58, 0x9a, 0xb7, 0xa9, 0x57, 0x66, 0x6a, 0x89, 0x9b, 0x96, 0xbb, 0x8b, 0x76, 0x77, 0x95, 0x8a,
+    0x8a, 0x69, 0x65, 0x97, 0xa8, 0x87, 0x59, 0x9a, 0x44, 0x66, 0xa3, 0xab, 0x85, 0x78, 0x94, 0x68,
+    0x68, 0x64, 0xc8, 0xcb, 0x79, 0x79, 0x56, 0xa7, 0x57, 0x5d, 0x16, 0xb4, 0xaa, 0xb9, 0x27, 0x33,
+    0xb3, 0x77, 0x5d, 0x47, 0x36, 0x5a, 0xc6, 0x67, 0x45, 0x96, 0x66, 0x5a, 0x67, 0x98, 0x8a, 0xd8,
+    0xb7, 0x54, 0xb8, 0xc8, 0x78, 0x99, 0x89, 0x78, 0x58, 0x85, 0xa7, 0xba, 0x8a, 0x6a, 0x44, 0xb5,
+    0xbb, 0x88, 0x75, 0xa5, 0xb8, 0x89, 0x56, 0x67, 0xaa, 0xaa, 0x89, 0x88, 0x86, 0xa9, 0x99, 0x99,
+    0xa8, 0x66, 0x77, 0x86, 0xa5, 0x99, 0xa9, 0x99, 0xa7, 0x8a, 0x9a, 0x56, 0xc7, 0xbc, 0x38, 0x94,
+    0x55, 0x89, 0xa9, 0xcc, 0x45, 0x55, 0x23, 0x44, 0x65, 0x94, 0x7d, 0xb7, 0xbc, 0x34, 0xc2, 0x88,
+    0xbb, 0x7a, 0x44, 0xa9, 0x89, 0x7a, 0x76, 0xb6, 0xba, 0xdb, 0xaf, 0x59, 0x89, 0x87, 0x98, 0x88,
+    0xa9, 0xba, 0x65, 0x56, 0x98, 0x87, 0xaa, 0x9b, 0x45, 0xb6, 0x98, 0x9b, 0x69, 0x96, 0xa8, 0x8a,
+    0x88, 0x77, 0x88, 0x89, 0x86, 0x68, 0x96, 0x7a, 0xa4, 0x85, 0x97, 0xb8, 0xac, 0xa7, 0x87, 0x67,
+    0x79, 0xb8, 0xa9, 0x65, 0x89, 0x98, 0xcc, 0x8b, 0xb9, 0x77, 0xc6, 0x68, 0xb8, 0xa8, 0xaa, 0xaa,
+    0x5d, 0x98, 0x7a, 0xe6, 0x4d, 0x95, 0x85, 0x6a, 0xbd, 0x85, 0x7b, 0x85, 0xa5, 0x89, 0x95, 0x98,
+    0x58, 0x7d, 0xb5, 0x7c, 0x88, 0x89, 0x88, 0x78, 0x59, 0x76, 0xb8, 0x57, 0x69, 0x67, 0xa8, 0xa7,
+    0x96, 0x7a, 0x78, 0xab, 0x96, 0x6a, 0x85, 0x96, 0x6a, 0x95, 0x67, 0x67, 0xa7, 0x59, 0x68, 0x8a,
+    0xa9, 0x9a, 0x8a, 0x59, 0x89, 0xbd, 0x49, 0x98, 0x97, 0x6b, 0x76, 0x65, 0x38, 0xbc, 0xa1, 0x2f,
+    0xd7, 0x99, 0x97, 0x87, 0x84, 0x69, 0xeb, 0x56, 0x3a, 0x93, 0xbc, 0xb6, 0xad, 0xe9, 0x9d, 0x56,
+    0xb8, 0x56, 0xaa, 0x98, 0x86, 0xbb, 0x84, 0xaa, 0xa7, 0x6a, 0x84, 0xaa, 0x77, 0x98, 0x89, 0x87,
+    0x78, 0x8b, 0x86, 0x68, 0x67, 0x98, 0x8a, 0x97, 0x84, 0xa7, 0x59, 0xa9, 0x67, 0x99, 0x98, 0x85,
+    0x6a, 0x96, 0x99, 0x7a, 0x97, 0x67, 0x88, 0x55, 0x78, 0xb7, 0x97, 0x8d, 0x8c, 0xa2, 0x2c, 0xb7,
+    0x9a, 0x7b, 0x89, 0x68, 0xb6, 0x5a, 0x4a, 0x82, 0x59, 0x9a, 0x98, 0x89, 0x9a, 0xa6, 0x89, 0x8a,
+    0x8b, 0xa9, 0x66, 0x63, 0x45, 0x47, 0x66, 0xa8, 0x97, 0xb7, 0x89, 0x9b, 0xb8, 0x68, 0x68, 0xa8,
+    0x98, 0xa7, 0xa9, 0x48, 0x98, 0x98, 0x88, 0x88, 0xa9, 0x99, 0x87, 0x48, 0x96, 0xab, 0xaa, 0x9a,
+    0x77, 0x88, 0xaa, 0x89, 0xb8, 0x97, 0xa9, 0x9a, 0x89, 0x76, 0xa9, 0xa8, 0x79, 0x78, 0x88, 0x66,
+    0xb7, 0x46, 0x97, 0xd7, 0x7a, 0x4a, 0x64, 0x68, 0x89, 0x8b, 0x8b, 0x98, 0x67, 0x73, 0x66, 0x58,
+    0xac, 0x96, 0xbb, 0xb8, 0xa8, 0x0a, 0x63, 0xa6, 0x7a, 0xb9, 0x24, 0x34, 0x85, 0xb9, 0x3b, 0x94,
+    0x69, 0x88, 0xab, 0x97, 0xb8, 0xaa, 0xa8, 0x78, 0xc7, 0x94, 0x8c, 0x97, 0x99, 0x98, 0x98, 0x88,
+    0x99, 0xab, 0x99, 0x87, 0x59, 0x86, 0xab, 0x9b, 0x97, 0x78, 0x97, 0x8a, 0xb8, 0x87, 0xb9, 0xaa,
+    0x69, 0x99, 0x95, 0xa9, 0xb8, 0x79, 0x67, 0x35, 0x72, 0x58, 0x98, 0x99, 0x99, 0x78, 0x59, 0x8b,
+    0xa7, 0x8b, 0x7a, 0x56, 0xd6, 0x48, 0x79, 0x85, 0x43, 0x98, 0x9a, 0x7a, 0x85, 0x75, 0xfc, 0xb6,
+    0x3e, 0x65, 0x66, 0xb4, 0x4a, 0x27, 0xa4, 0x89, 0xab, 0xa4, 0x96, 0x99, 0x99, 0x6a, 0x65, 0x58,
+    0xa8, 0xdb, 0xb6, 0x3a, 0x87, 0x99, 0x99, 0x88, 0x77, 0x9c, 0x95, 0x54, 0xa5, 0xa8, 0x9b, 0x6a,
+    0x45, 0x97, 0x6b, 0x7a, 0x46, 0x97, 0xa9, 0x88, 0x57, 0x66, 0x8a, 0x8a, 0x96, 0x77, 0xa7, 0x98,
+    0xa9, 0x77, 0x89, 0xb7, 0x78, 0x7a, 0x84, 0x84, 0x79, 0x89, 0x78, 0x97, 0x89, 0x98, 0xbd, 0xc5,
+    0xbc, 0xb8, 0xab, 0x87, 0x89, 0xc6, 0xd7, 0xaa, 0x46, 0x84, 0xa4, 0xad, 0xb6, 0xcf, 0x58, 0xba,
+    0x66, 0xaa, 0x56, 0x78, 0x9a, 0x46, 0xac, 0x8a, 0x9b, 0x95, 0xbc, 0x56, 0x98, 0x98, 0x87, 0x87,
+    0x98, 0x96, 0x68, 0x86, 0xaa, 0x89, 0x89, 0x78, 0xa8, 0x79, 0xac, 0x58, 0x98, 0x6a, 0x67, 0x89,
+    0x55, 0xb8, 0x8a, 0x86, 0x68, 0x98, 0x98, 0x64, 0x89, 0x78, 0x9a, 0x87, 0x88, 0x9b, 0xc6, 0xcc,
+    0x69, 0x97, 0xa4, 0x94, 0xdb, 0x44, 0x45, 0x42, 0x85, 0x7a, 0x99, 0x88, 0x75, 0xc8, 0x76, 0x59,
+    0x79, 0xb8, 0x47, 0x89, 0x67, 0x55, 0x77, 0xa8, 0x98, 0x99, 0x7a, 0x8b, 0x6a, 0x97, 0x64, 0x9b,
+    0x26, 0x29, 0x52, 0x13, 0x89, 0x98, 0x98, 0x78, 0x69, 0xc8, 0x75, 0x5c, 0xa9, 0x5b, 0x89, 0xb6,
+    0x82, 0x9b, 0xd9, 0xb8, 0x8c, 0x9c, 0x69, 0x5c, 0xc9, 0x98, 0x8a, 0xa7, 0x86, 0x6c, 0xb8, 0x86,
+    0x74, 0x59, 0x89, 0xca, 0x75, 0x35, 0x48, 0xa5, 0x9b, 0x97, 0x78, 0xab, 0x89, 0xbb, 0xab, 0x3b,
+    0x84, 0x98, 0x78, 0x88, 0xba, 0xba, 0x9b, 0x57, 0xa6, 0x79, 0xb9, 0xaa, 0xca, 0xd9, 0x8e, 0x68,
+    0x87, 0x97, 0xba, 0xa9, 0xa8, 0xb8, 0x97, 0x68, 0x45, 0x76, 0xb9, 0xce, 0x99, 0x98, 0x89, 0x98,
+    0xa8, 0x97, 0x88, 0x89, 0x66, 0x9a, 0x87, 0x99, 0xaa, 0x89, 0x79, 0x69, 0x8a, 0xa8, 0x67, 0x76,
+    0x99, 0x58, 0x77, 0x67, 0x98, 0xa7, 0x87, 0x55, 0xa7, 0x88, 0x53, 0x79, 0xa9, 0xaa, 0x5b, 0x88,
+    0x47, 0x6a, 0x9c, 0xad, 0x65, 0xa5, 0x55, 0x75, 0x58, 0x7a, 0x86, 0x98, 0xcb, 0x68, 0xdb, 0xc4,
+    0xce, 0x9c, 0xbc, 0x96, 0x96, 0x95, 0xb3, 0x79, 0x5b, 0x77, 0x77, 0xa6, 0x99, 0x88, 0x97, 0xb9,
+    0x36, 0x58, 0xd6, 0x5a, 0x99, 0x89, 0x89, 0x98, 0x78, 0x98, 0xa9, 0x98, 0x89, 0x67, 0x59, 0x9b,
+    0xab, 0x77, 0x9c, 0x8b, 0x97, 0x89, 0x95, 0x8a, 0x8b, 0x9a, 0x77, 0x87, 0xa8, 0xa9, 0x79, 0xa6,
+    0x59, 0x96, 0x97, 0x5b, 0x96, 0x76, 0x77, 0x59, 0xa9, 0xc8, 0x77, 0x66, 0x35, 0xa8, 0xa8, 0xa4,
+    0x87, 0xa9, 0xb9, 0x79, 0x8b, 0xc5, 0x8b, 0x7d, 0x73, 0xa6, 0x88, 0xc8, 0x88, 0xdd, 0x65, 0x89,
+    0x69, 0xba, 0x69, 0x8a, 0xa8, 0x59, 0xa8, 0x53, 0x69, 0x89, 0xa6, 0x79, 0x78, 0x88, 0x89, 0x99,
+    0xa9, 0x68, 0x8b, 0x75, 0x37, 0xa9, 0xa7, 0x67, 0x58, 0x84, 0x8a, 0x89, 0x98, 0x56, 0x9a, 0xa9,
+    0x98, 0x68, 0xa3, 0x67, 0x9a, 0x66, 0x48, 0x94, 0x78, 0x7a, 0x9b, 0x7a, 0x79, 0x6b, 0x83, 0x38,
+    0x95, 0x89, 0xaa, 0x78, 0x67, 0xaa, 0x68, 0x67, 0xc7, 0x55, 0x69, 0xa9, 0x89, 0x4a, 0xa9, 0x32,
+    0x66, 0x65, 0x4c, 0x76, 0x55, 0x55, 0xab, 0x32, 0x46, 0x64, 0xa5, 0x98, 0x88, 0xaa, 0x9a, 0x4b,
+    0x95, 0x36, 0xa5, 0x76, 0x98, 0x79, 0x89, 0x97, 0x97, 0xb9, 0x8b, 0x8b, 0x98, 0x95, 0x99, 0xb9,
+    0x89, 0xaa, 0x97, 0x88, 0xb6, 0xbb, 0xa9, 0xbb, 0xb8, 0x99, 0x6a, 0xb7, 0x9a, 0x9a, 0x99, 0x65,
+    0x62, 0x58, 0x55, 0x87, 0x89, 0x99, 0xb8, 0xc9, 0x93, 0x5b, 0x86, 0x65, 0x5b, 0x8a, 0xb6, 0x4c,
+    0xca, 0x76, 0x68, 0x48, 0x98, 0x3a, 0xdd, 0x95, 0x38, 0xa5, 0x4e, 0xd8, 0x7c, 0xaa, 0xb7, 0x74,
+    0x8a, 0x95, 0x77, 0xba, 0x97, 0x7a, 0xa7, 0x4a, 0x60, 0x36, 0x82, 0xd9, 0x79, 0x88, 0x99, 0x99,
+    0xa9, 0x7b, 0x8a, 0x78, 0x97, 0x95, 0x7a, 0x76, 0x77, 0xd9, 0x78, 0x99, 0x96, 0x7b, 0xab, 0x86,
+    0x8a, 0xa9, 0xa8, 0x6a, 0x99, 0x77, 0x89, 0x54, 0x75, 0x69, 0x88, 0x59, 0x69, 0x96, 0x49, 0xba,
+};
+
+static const float mnist_cnn_layer2_codebook[16] = {
+    -0.949144304f, -0.758901119f, -0.61467886f, -0.503221273f,
+    -0.385268211f, -0.280660093f, -0.185542613f, -0.100343436f,
+    -0.0285522602f, 0.0478053428f, 0.131125882f, 0.21674943f,
+    0.315507591f, 0.428376138f, 0.571559787f, 0.734015882f,
+};
+
+static const uint8_t mnist_cnn_layer4_indices[7840] = {
+    0x96, 0x86, 0xb9, 0x65, 0x99, 0x78, 0x78, 0x87, 0x5a, 0x8a, 0x84, 0xca, 0xa5, 0x5b, 0xca, 0x8a,
+    0xa9, 0xd8, 0xcb, 0xb9, 0x97, 0xc9, 0x07, 0x32, 0x98, 0xbb, 0x76, 0x77, 0x68, 0x78, 0x86, 0x9c,
+    0x87, 0xa7, 0x9b, 0xa7, 0xda, 0xac, 0x6a, 0xc9, 0x8a, 0xa8, 0xd9, 0x5c, 0x88, 0x86, 0x4a, 0x62,
+    0x74, 0xa7, 0xa8, 0x89, 0x68, 0x79, 0xb9, 0xd9, 0x96, 0x97, 0xbb, 0xac, 0x68, 0x86, 0xba, 0x8c,
+    0xba, 0x87, 0x39, 0x77, 0x8b, 0x57, 0x89, 0x3e, 0x23, 0x84, 0x47, 0x58, 0xbb, 0x69, 0xa8, 0x77,
+    0x99, 0x98, 0x78, 0xaa, 0x88, 0xbb, 0xcb, 0x8c, 0x99, 0x99, 0xa8, 0xb8, 0x47, 0x79, 0x97, 0x39,
+    0x93, 0x96, 0x89, 0x8b, 0x99, 0xb9, 0xa7, 0xa7, 0x7a, 0x9a, 0xbb, 0x35, 0xb2, 0xcb, 0x96, 0x7c,
+    0x9b, 0x97, 0xaa, 0x72, 0x54, 0xb7, 0xcb, 0x2d, 0x21, 0x85, 0xaa, 0x97, 0x98, 0xa9, 0xb7, 0xa8,
+    0x99, 0xab, 0x9b, 0x98, 0x88, 0x4c, 0x63, 0x42, 0x76, 0x63, 0xd8, 0x44, 0x4a, 0x76, 0xba, 0xdb,
+    0x83, 0x69, 0x86, 0x99, 0x6c, 0x98, 0xb8, 0x6a, 0x79, 0xa9, 0x88, 0xab, 0x7a, 0x9b, 0x85, 0x78,
+    0x77, 0xa9, 0x47, 0xb7, 0x9c, 0x89, 0xb9, 0xaa, 0xa8, 0xba, 0xab, 0x98, 0x98, 0x88, 0xa9, 0xa8,
+    0x96, 0xaa, 0xac, 0x96, 0xcb, 0xaa, 0x46, 0xc7, 0x87, 0x59, 0x97, 0x9a, 0x88, 0x9a, 0xcd, 0x54,
+    0xc7, 0x85, 0x04, 0x56, 0xbb, 0xa9, 0x68, 0xa7, 0x98, 0x77, 0xd9, 0x99, 0x79, 0x76, 0xa7, 0x54,
+    0x40, 0x66, 0x7d, 0x88, 0xad, 0x31, 0x78, 0xd8, 0x9c, 0x5b, 0xb5, 0xa9, 0x99, 0x89, 0x98, 0x89,
+    0x89, 0x99, 0x99, 0x89, 0x89, 0x98, 0xaa, 0x99, 0x98, 0x98, 0x99, 0x99, 0x98, 0x99, 0x98, 0x89,
+    0x99, 0x99, 0x99, 0x99, 0x99, 0x9a, 0x78, 0x68, 0x9a, 0x76, 0x9a, 0xd8, 0xa6, 0x77, 0x66, 0xad,
+    0x68, 0x74, 0x7b, 0xa8, 0x68, 0xa8, 0x9c, 0x88, 0xbb, 0x78, 0x9c, 0x97, 0xbc, 0x88, 0x67, 0x65,
+    0x97, 0xa8, 0x8a, 0xcd, 0xa6, 0x68, 0xca, 0x9c, 0x99, 0xb6, 0xc9, 0xba, 0x79, 0x75, 0x38, 0x8a,
+    0xac, 0x75, 0x79, 0xab, 0x88, 0x55, 0x88, 0xa9, 0x97, 0x77, 0x98, 0x9a, 0x46, 0x98, 0xbb, 0x96,
+    0x92, 0xbb, 0x87, 0x3c, 0xad, 0xc8, 0xb8, 0x57, 0x37, 0x66, 0xba, 0x5c, 0x35, 0x86, 0xa8, 0x8b,
+    0x87, 0xac, 0xba, 0xaa, 0x98, 0xaa, 0x9b, 0xcc, 0x88, 0x8a, 0x3b, 0x64, 0x98, 0x65, 0xb7, 0xbb,
+    0x7a, 0x94, 0xbd, 0xaa, 0xaa, 0xcc, 0xac, 0x88, 0x67, 0x57, 0x89, 0xa9, 0x7c, 0x9a, 0xa5, 0xc8,
+    0x97, 0x6b, 0xab, 0x7a, 0x7a, 0xa8, 0x66, 0x89, 0x89, 0x8b, 0x65, 0xdb, 0x94, 0xb8, 0x78, 0x88,
+    0x9b, 0xa7, 0x88, 0xb5, 0x97, 0xb9, 0x79, 0x6a, 0x98, 0x7c, 0x98, 0x36, 0xb7, 0xb8, 0x9a, 0x79,
+    0x78, 0xa6, 0xaa, 0x78, 0x89, 0xaa, 0xc8, 0x9b, 0xd8, 0xb8, 0x57, 0xb6, 0x6b, 0x79, 0x67, 0xb8,
+    0xa8, 0x34, 0xa6, 0x79, 0x95, 0x5a, 0x8c, 0x98, 0xb8, 0x47, 0x55, 0xbd, 0xaa, 0x85, 0x97, 0x88,
+    0x97, 0x77, 0x6a, 0xaa, 0x69, 0xb7, 0x99, 0x78, 0x89, 0x69, 0xd9, 0xa6, 0x88, 0x79, 0x9b, 0x98,
+    0xcb, 0x9a, 0x86, 0xb7, 0x57, 0x87, 0xcb, 0xca, 0x68, 0xc8, 0x98, 0xaa, 0x7b, 0x8a, 0x8a, 0x98,
+    0xa7, 0xa9, 0x46, 0xa7, 0xc7, 0x85, 0x8a, 0x7c, 0xa9, 0x78, 0x33, 0x52, 0x79, 0xcd, 0x68, 0xd5,
+    0xc6, 0x9b, 0x89, 0x8a, 0x98, 0x7d, 0x63, 0x65, 0xa4, 0x76, 0x67, 0x89, 0x5a, 0x75, 0x99, 0x94,
+    0xaa, 0x77, 0x47, 0xaa, 0x99, 0xbb, 0x8b, 0xab, 0xbb, 0x57, 0x7b, 0xa6, 0x55, 0x9a, 0x66, 0x9a,
+    0xba, 0xbb, 0xc9, 0x9c, 0xad, 0xb9, 0x99, 0x57, 0xc9, 0xab, 0x8c, 0xb6, 0x89, 0x58, 0x45, 0xab,
+    0x25, 0x82, 0x9b, 0x87, 0x79, 0x8c, 0x54, 0x65, 0x79, 0x66, 0x69, 0xab, 0x5a, 0xba, 0xe9, 0xb8,
+    0xe7, 0x8a, 0x7a, 0x5a, 0x9b, 0xbc, 0x55, 0x8b, 0xc9, 0x45, 0x45, 0x9a, 0x9a, 0x56, 0x9a, 0x46,
+    0x49, 0x74, 0x48, 0x87, 0x56, 0x89, 0x86, 0x47, 0x89, 0x68, 0x79, 0xbc, 0xaa, 0xb8, 0xaa, 0x89,
+    0x88, 0xb9, 0x98, 0x89, 0x97, 0x55, 0x87, 0x88, 0x8a, 0x89, 0x88, 0x8a, 0x6a, 0xa7, 0x98, 0xc9,
+    0xc4, 0xc7, 0x8b, 0xa6, 0x8b, 0x98, 0xa9, 0x9a, 0x58, 0x57, 0xb7, 0x9b, 0x9b, 0x9a, 0x9c, 0xab,
+    0x56, 0x8b, 0x97, 0x59, 0x7a, 0x25, 0x68, 0x77, 0x59, 0x47, 0x37, 0xb3, 0xba, 0x89, 0xa8, 0x9a,
+    0x99, 0x7b, 0x98, 0x78, 0x77, 0x8a, 0x87, 0x98, 0x98, 0x87, 0xab, 0x8d, 0x88, 0x88, 0xb9, 0x44,
+    0xd8, 0xa7, 0xda, 0x65, 0x7b, 0x97, 0x6c, 0xac, 0x76, 0x95, 0x89, 0x18, 0x95, 0xc9, 0x77, 0xe7,
+    0xb9, 0x79, 0x58, 0x67, 0x98, 0x99, 0xc7, 0xab, 0xba, 0xd6, 0x68, 0xab, 0xac, 0xa9, 0xa6, 0x8b,
+    0xb0, 0xa8, 0xaa, 0x38, 0x62, 0x86, 0x88, 0x96, 0x95, 0x86, 0xa9, 0xda, 0x6c, 0x88, 0x67, 0xd8,
+    0x7b, 0x43, 0x97, 0xba, 0x7b, 0x77, 0xa9, 0x99, 0x8b, 0xaa, 0x6a, 0xb6, 0x88, 0xa8, 0x78, 0xcb,
+    0xc9, 0x8b, 0x98, 0x88, 0x54, 0xa8, 0x99, 0x96, 0x85, 0x9a, 0xaa, 0x78, 0xaa, 0xbb, 0x9c, 0x77,
+    0x99, 0x99, 0x56, 0xba, 0x05, 0x22, 0xb9, 0x9b, 0x86, 0x65, 0x78, 0x85, 0x77, 0x99, 0x87, 0x59,
+    0xa5, 0xb8, 0x6b, 0xb6, 0x8a, 0xaa, 0xc4, 0xab, 0x49, 0xa7, 0x7a, 0x97, 0xb7, 0x79, 0x99, 0xc8,
+    0x68, 0xea, 0x58, 0xba, 0xa8, 0x98, 0x75, 0x9a, 0xb8, 0x69, 0xa9, 0x56, 0x99, 0x99, 0x69, 0x98,
+    0x49, 0xb9, 0xdc, 0x8a, 0x58, 0x87, 0x88, 0x78, 0x78, 0x99, 0x98, 0x96, 0x76, 0xa7, 0x79, 0x88,
+    0xa7, 0xa9, 0xb7, 0x7a, 0x9a, 0x7c, 0xb9, 0x6c, 0x96, 0xaa, 0xdb, 0x46, 0x94, 0x59, 0x35, 0x85,
+    0x68, 0xca, 0x7b, 0x97, 0x65, 0xbb, 0x68, 0x5b, 0xb5, 0xcc, 0xb9, 0x84, 0xcb, 0x89, 0x67, 0xc9,
+    0x8a, 0x8a, 0x87, 0xcb, 0xdd, 0x89, 0xa8, 0x9b, 0xaa, 0x8d, 0x9b, 0x6c, 0xd8, 0xcc, 0xc8, 0x8a,
+    0x67, 0xa9, 0x76, 0xa8, 0x85, 0x6a, 0x96, 0x66, 0xaa, 0xa7, 0x69, 0xcd, 0xa7, 0x98, 0xea, 0x67,
+    0x8b, 0x49, 0x96, 0xa8, 0xb8, 0xba, 0xab, 0x58, 0xb7, 0x69, 0x7a, 0x9a, 0x3c, 0x75, 0xa6, 0xa9,
+    0x66, 0x8a, 0x8b, 0x69, 0x87, 0x9b, 0x98, 0xbe, 0xaa, 0x98, 0xe8, 0x8d, 0x8b, 0xb9, 0xdd, 0x9b,
+    0x9a, 0x1c, 0xbb, 0xb9, 0xc9, 0xa6, 0x6a, 0x94, 0xc6, 0x9b, 0x88, 0x89, 0xac, 0x77, 0x9a, 0xec,
+    0x67, 0x6a, 0x9b, 0x76, 0xa8, 0xdb, 0x63, 0xaa, 0x99, 0x65, 0xc7, 0xab, 0x7b, 0xc8, 0x8d, 0xa8,
+    0xa6, 0x67, 0xd7, 0xd7, 0xaa, 0x69, 0x78, 0x96, 0xba, 0xaf, 0xc9, 0x9a, 0x79, 0x77, 0xc9, 0x67,
+    0x78, 0x69, 0x86, 0xb7, 0x75, 0xa6, 0x75, 0x78, 0xba, 0xea, 0x9e, 0x9b, 0xeb, 0x6c, 0xac, 0x7b,
+    0x8a, 0x65, 0x99, 0x49, 0x3d, 0x97, 0xa9, 0xa9, 0x45, 0x54, 0x74, 0x58, 0x98, 0x66, 0x76, 0x46,
+    0xb5, 0x79, 0x66, 0xa7, 0x68, 0x9b, 0x99, 0x8b, 0x96, 0x79, 0x89, 0x77, 0xbb, 0x89, 0x78, 0xd7,
+    0x9c, 0x78, 0x78, 0xa5, 0xac, 0xa5, 0x87, 0xd5, 0xab, 0xa8, 0xd9, 0xa9, 0xab, 0x7b, 0xda, 0x99,
+    0x67, 0x78, 0xad, 0xa9, 0x9a, 0x98, 0x96, 0xb6, 0x77, 0x68, 0x87, 0x99, 0xab, 0x4c, 0x79, 0x8d,
+    0x49, 0xc7, 0xb9, 0x9c, 0xaa, 0x8b, 0xc8, 0x9d, 0xaa, 0xda, 0x84, 0xa5, 0x99, 0x88, 0x89, 0x88,
+    0x99, 0x99, 0x89, 0x89, 0x99, 0x89, 0x98, 0x98, 0x99, 0x88, 0x98, 0x99, 0x89, 0x88, 0x98, 0x99,
+    0x99, 0x88, 0x99, 0x88, 0x89, 0x4a, 0x47, 0x79, 0x7c, 0x76, 0x87, 0x78, 0x84, 0x59, 0x66, 0x97,
+    0x8a, 0x36, 0xc6, 0xbc, 0x58, 0xa7, 0x79, 0xab, 0xa8, 0xbb, 0x84, 0x6c, 0x73, 0xa9, 0xc7, 0xc5,
+    0x97, 0xba, 0xac, 0x54, 0x78, 0xa9, 0x68, 0x65, 0x76, 0x88, 0xa4, 0x5a, 0x68, 0x78, 0xc7, 0x49,
+    0x87, 0x97, 0x7c, 0x97, 0x7a, 0x6c, 0xcb, 0x75, 0xbc, 0x7b, 0x53, 0x88, 0x99, 0x9b, 0xc6, 0x78,
+    0xbc, 0xb4, 0xc7, 0x77, 0x97, 0x46, 0xc3, 0x7d, 0x8a, 0x66, 0x67, 0xb7, 0x79, 0xe8, 0xaa, 0xb9,
+    0xaa, 0xa9, 0x8a, 0xca, 0xbb, 0xba, 0x89, 0xfb, 0xaa, 0x89, 0xea, 0xbe, 0xba, 0x99, 0xbc, 0xa7,
+    0xaa, 0x98, 0xbb, 0xa9, 0xba, 0xac, 0xaa, 0x8a, 0xa9, 0xc9, 0x87, 0x47, 0xc9, 0xa8, 0x94, 0x87,
+    0x9c, 0x58, 0xb5, 0x89, 0x76, 0xd8, 0x6b, 0x78, 0x69, 0xac, 0x97, 0x67, 0x9a, 0x49, 0x64, 0x98,
+    0x75, 0x87, 0x99, 0x89, 0xc9, 0x7a, 0x58, 0xb8, 0x8a, 0x78, 0xb8, 0x87, 0xa6, 0x48, 0x87, 0xaa,
+    0xa9, 0x7b, 0x97, 0x9a, 0x98, 0x75, 0x75, 0x87, 0x68, 0xa8, 0x99, 0xbc, 0x69, 0xa8, 0x5b, 0x78,
+    0xc7, 0xb6, 0x58, 0xa7, 0x39, 0x77, 0xd9, 0x8c, 0x66, 0x9c, 0xdd, 0x57, 0x99, 0x66, 0x6b, 0x89,
+    0xa8, 0xd8, 0x5c, 0x9d, 0x38, 0xe7, 0xa8, 0x8b, 0x98, 0x79, 0x87, 0xab, 0xa7, 0x86, 0x74, 0xc6,
+    0x36, 0x9a, 0x77, 0x7b, 0xc3, 0x87, 0x86, 0x6c, 0x93, 0x7a, 0x99, 0x8a, 0x98, 0x67, 0x7a, 0x78,
+    0x85, 0xb6, 0x6d, 0x8b, 0x97, 0x4c, 0xb7, 0xc8, 0x7a, 0xaa, 0x79, 0xb6, 0x5b, 0xb5, 0x98, 0xa6,
+    0x95, 0xa7, 0x89, 0xa5, 0x99, 0xae, 0x88, 0x47, 0x64, 0x6a, 0x59, 0x76, 0x74, 0x36, 0x87, 0x4a,
+    0x86, 0xca, 0x79, 0xba, 0xa8, 0x8a, 0x7a, 0x89, 0xa8, 0x7a, 0x9a, 0x98, 0x86, 0xa8, 0xab, 0x8b,
+    0x66, 0x99, 0x87, 0xa7, 0xa8, 0x69, 0x4d, 0xda, 0x49, 0xa8, 0x84, 0xcc, 0xc8, 0xcb, 0x9b, 0x49,
+    0x97, 0x74, 0xa9, 0xcc, 0xcb, 0x98, 0x9b, 0xb9, 0x7b, 0x97, 0x8a, 0xb8, 0x74, 0xac, 0xa5, 0xda,
+    0x89, 0x73, 0xbb, 0xd6, 0x4c, 0x86, 0xb7, 0x9c, 0x77, 0x89, 0x6b, 0x99, 0xa9, 0xb5, 0x99, 0x94,
+    0xae, 0x97, 0xba, 0xaa, 0x86, 0x88, 0xba, 0x86, 0x89, 0xaa, 0xed, 0x89, 0xba, 0x6b, 0x9a, 0x9b,
+    0x86, 0x88, 0x89, 0x98, 0xb8, 0xa8, 0x6e, 0x49, 0x73, 0xa9, 0x69, 0xa8, 0xb7, 0x7b, 0x65, 0x96,
+    0x9c, 0xca, 0x65, 0xb8, 0x66, 0x95, 0xa8, 0x77, 0xe6, 0xc9, 0xa7, 0x9a, 0x79, 0xc8, 0x9c, 0x8a,
+    0x76, 0xee, 0x88, 0xa8, 0x8b, 0x69, 0x89, 0xdb, 0x75, 0xb6, 0xaa, 0x9d, 0xba, 0xa9, 0x7b, 0x98,
+    0xab, 0x88, 0x77, 0xa8, 0x89, 0xaa, 0x9a, 0x78, 0xca, 0x86, 0x98, 0x96, 0x69, 0x75, 0xb9, 0x94,
+    0x46, 0x98, 0xc8, 0xac, 0xa5, 0x8b, 0x75, 0x77, 0xc5, 0x95, 0xd9, 0xa8, 0x6d, 0x6a, 0x9c, 0x8c,
+    0xa8, 0x84, 0xea, 0x8d, 0x58, 0xa6, 0x9d, 0x6c, 0x97, 0xdd, 0x6a, 0x74, 0xda, 0x5c, 0xab, 0xaa,
+    0x7c, 0x74, 0x98, 0x96, 0x99, 0x88, 0x64, 0x57, 0x98, 0x88, 0x69, 0x94, 0x46, 0xaa, 0x96, 0xa7,
+    0xb5, 0x68, 0x54, 0x69, 0x8c, 0xa7, 0xba, 0x75, 0x88, 0xbb, 0x69, 0xdb, 0x4b, 0x7a, 0x6c, 0xba,
+    0xb9, 0x8a, 0xa5, 0x7a, 0xa9, 0xaa, 0xaa, 0xb5, 0xc7, 0x9a, 0x99, 0x9b, 0x78, 0xa8, 0xc6, 0x89,
+    0x87, 0x67, 0x84, 0x69, 0xc7, 0x7a, 0x89, 0x79, 0x77, 0x6d, 0x89, 0xe8, 0x87, 0x99, 0xdb, 0x7f,
+    0xa9, 0xd9, 0xdb, 0x89, 0x9b, 0xed, 0x7f, 0x77, 0xc9, 0x9a, 0x76, 0x97, 0x9c, 0xac, 0x76, 0x7b,
+    0xb5, 0x85, 0x6a, 0x83, 0xbb, 0x8b, 0x38, 0xc5, 0xbc, 0x97, 0x64, 0x87, 0x85, 0x85, 0x97, 0x6a,
+    0x77, 0x87, 0xaa, 0x96, 0x59, 0x53, 0x98, 0x8a, 0xba, 0xbb, 0x99, 0xc9, 0x8a, 0x8b, 0x88, 0xab,
+    0x99, 0x79, 0x59, 0x75, 0xda, 0xb8, 0x45, 0xdc, 0xc5, 0x7a, 0xc9, 0x9a, 0x9c, 0xe9, 0x89, 0x99,
+    0x7a, 0x69, 0xa9, 0xa6, 0x97, 0x98, 0xaa, 0x76, 0x76, 0x9a, 0x8c, 0xa8, 0xb9, 0xfe, 0x9b, 0x9c,
+    0x9b, 0x9b, 0xab, 0x68, 0x68, 0x87, 0x38, 0x76, 0xa9, 0xad, 0xa8, 0xb5, 0x8a, 0x96, 0x7b, 0x75,
+    0x94, 0x87, 0x9b, 0x38, 0x53, 0xa9, 0x85, 0xaa, 0xa9, 0x88, 0xb9, 0x57, 0x8b, 0x8a, 0x23, 0xa5,
+    0x75, 0xa6, 0x7a, 0x5c, 0xb9, 0x97, 0xba, 0x57, 0x76, 0x95, 0x98, 0xa6, 0x78, 0x76, 0x7a, 0x7b,
+    0xb7, 0x98, 0x75, 0x87, 0xca, 0x8b, 0x46, 0x74, 0x9e, 0x88, 0x7b, 0xaa, 0xa9, 0xa8, 0x56, 0x99,
+    0x99, 0x53, 0x88, 0xa8, 0x57, 0x61, 0x9a, 0x97, 0x56, 0x99, 0x78, 0x98, 0x44, 0x87, 0x98, 0x12,
+    0x74, 0x76, 0x99, 0x87, 0x88, 0xc8, 0x9a, 0xab, 0xb5, 0x6b, 0x86, 0x96, 0x8a, 0xc8, 0x79, 0xea,
+    0x9b, 0xba, 0xba, 0x9c, 0x57, 0xab, 0x9d, 0x75, 0x39, 0x43, 0x79, 0x89, 0x98, 0x6b, 0xa6, 0xa8,
+    0x78, 0x88, 0xdc, 0x9c, 0x67, 0xd9, 0xcb, 0x7a, 0xac, 0x8a, 0x86, 0xca, 0x33, 0xa5, 0xde, 0x89,
+    0x87, 0xc5, 0x7c, 0xf8, 0xfa, 0x59, 0x88, 0x9b, 0xaa, 0x28, 0xab, 0xaa, 0x68, 0x6a, 0xa7, 0x78,
+    0xc7, 0x9a, 0x87, 0xca, 0xac, 0x99, 0xb8, 0x9a, 0xa5, 0xbc, 0x79, 0xa7, 0x88, 0x98, 0x6a, 0x6a,
+    0xba, 0x8b, 0x79, 0xbe, 0xcc, 0x99, 0x8c, 0xb8, 0x78, 0xa8, 0x54, 0x8b, 0x89, 0x55, 0x46, 0xb9,
+    0xa9, 0x49, 0x82, 0xab, 0xb9, 0x79, 0x8a, 0xb9, 0xa8, 0x89, 0x8b, 0x99, 0x7b, 0x44, 0x87, 0xad,
+    0x9a, 0xcb, 0x79, 0x76, 0x97, 0xba, 0x67, 0xba, 0xce, 0x89, 0xd6, 0xde, 0x86, 0x99, 0x99, 0x89,
+    0x99, 0x99, 0x99, 0x98, 0x99, 0x99, 0x7a, 0x98, 0x99, 0x7a, 0x98, 0x99, 0x98, 0x88, 0x89, 0x89,
+    0x88, 0x89, 0x99, 0x99, 0x99, 0xc7, 0xdc, 0x6a, 0xa8, 0xab, 0x8a, 0x34, 0x9b, 0xbb, 0x68, 0x65,
+    0xa9, 0x66, 0xb9, 0x77, 0x98, 0xc8, 0x9b, 0x87, 0x99, 0x8a, 0x72, 0xb6, 0x7b, 0xa7, 0x8d, 0x4a,
+    0x89, 0x79, 0xc9, 0x8b, 0x97, 0x84, 0x9a, 0x3a, 0x66, 0x95, 0x47, 0x95, 0x7a, 0xa9, 0xcc, 0xa8,
+    0xac, 0xcc, 0x55, 0x9a, 0xa9, 0x78, 0xa8, 0x68, 0x78, 0xc7, 0xda, 0x9b, 0xa9, 0x78, 0x77, 0xb9,
+    0xbc, 0xb9, 0xca, 0x8a, 0x7a, 0xbb, 0x6b, 0xdb, 0x67, 0x89, 0x53, 0x43, 0x66, 0x42, 0xa7, 0x88,
+    0x96, 0x98, 0x89, 0x89, 0x85, 0x9a, 0xcb, 0x29, 0x9c, 0xb9, 0x89, 0x87, 0xac, 0xb9, 0xca, 0x79,
+    0x78, 0xfb, 0x66, 0xaa, 0x78, 0x8a, 0xaa, 0xa9, 0xba, 0x9b, 0x7b, 0x98, 0x69, 0x77, 0xad, 0x98,
+    0x68, 0x79, 0x6c, 0x87, 0x6a, 0xac, 0x9d, 0x79, 0xda, 0xba, 0xb9, 0xa5, 0x6c, 0x98, 0x68, 0x67,
+    0xcd, 0x78, 0x88, 0x8a, 0x8a, 0x68, 0xa9, 0x79, 0x95, 0x7b, 0x59, 0x83, 0xa7, 0xca, 0xca, 0xad,
+    0xdc, 0x98, 0x79, 0xab, 0x89, 0x6b, 0x6b, 0x74, 0x89, 0x77, 0xb9, 0xa4, 0xa8, 0x59, 0x63, 0xd6,
+    0x97, 0x58, 0x9b, 0xcc, 0xbb, 0xc9, 0x7b, 0xa5, 0x99, 0x6e, 0x94, 0x67, 0x99, 0x7e, 0x77, 0xc8,
+    0x98, 0x7b, 0x93, 0x94, 0x88, 0xb8, 0x7a, 0x78, 0xa9, 0x7b, 0xcd, 0x69, 0x75, 0xaa, 0xc9, 0x99,
+    0x9b, 0x68, 0xbe, 0x79, 0x68, 0x56, 0x77, 0x66, 0xa7, 0x87, 0x78, 0xa8, 0xd7, 0xa7, 0xaa, 0x85,
+    0x94, 0xa7, 0x58, 0xa6, 0xcc, 0x9c, 0xda, 0x9b, 0xac, 0xbb, 0xbd, 0x96, 0xda, 0x7d, 0x36, 0x5a,
+    0xc9, 0x85, 0xda, 0x7d, 0x86, 0x96, 0xbb, 0x9e, 0xa4, 0x9a, 0x8a, 0x53, 0x67, 0x88, 0x97, 0xb8,
+    0x47, 0xaa, 0xcd, 0x8c, 0x97, 0xcb, 0x89, 0xbb, 0x98, 0x98, 0x98, 0x8a, 0x5e, 0xa8, 0xa7, 0x88,
+    0x57, 0x79, 0xa9, 0x79, 0xb5, 0xa5, 0x79, 0x69, 0x7d, 0x6a, 0xcc, 0x7b, 0x7c, 0xc7, 0xdd, 0x36,
+    0x93, 0x8a, 0x9c, 0xab, 0x49, 0x96, 0x5a, 0xb8, 0xcc, 0x96, 0x46, 0xc8, 0x38, 0x76, 0x65, 0x55,
+    0xc6, 0x9b, 0x66, 0x97, 0x98, 0x8c, 0xdc, 0x86, 0x89, 0x9b, 0x97, 0x89, 0x89, 0x69, 0x8a, 0x9c,
+    0x6a, 0x98, 0xa9, 0xa9, 0x6b, 0x78, 0xab, 0x86, 0xa9, 0xa4, 0x6d, 0x9a, 0xba, 0xb8, 0x7a, 0xa9,
+    0x9a, 0x7b, 0xa8, 0x87, 0xac, 0x79, 0xb3, 0x88, 0xba, 0x86, 0xaa, 0x8b, 0xaa, 0x99, 0xa7, 0x69,
+    0x77, 0xb5, 0xcb, 0x6b, 0xb6, 0x8e, 0xaa, 0x66, 0x7b, 0x7a, 0x6b, 0x98, 0x88, 0x99, 0x9a, 0xa9,
+    0xca, 0x56, 0x62, 0xbc, 0xba, 0x4a, 0x9a, 0xea, 0xb8, 0xaa, 0x47, 0x8b, 0x86, 0xca, 0xab, 0x9a,
+    0x9a, 0x9b, 0x9a, 0x69, 0xa8, 0x88, 0x99, 0x6c, 0x77, 0xb6, 0x88, 0xe8, 0xde, 0x68, 0x88, 0x98,
+    0x98, 0x88, 0x67, 0x65, 0xab, 0x89, 0x45, 0x7a, 0xab, 0x9a, 0x6a, 0x96, 0x98, 0x79, 0x67, 0x77,
+    0x99, 0x9a, 0x69, 0x5a, 0x89, 0xa8, 0x9b, 0x8a, 0x77, 0xcb, 0x8a, 0xbb, 0x9c, 0x47, 0xa7, 0x9b,
+    0x87, 0x84, 0xb8, 0x68, 0xd6, 0x69, 0xcf, 0xbb, 0x85, 0x89, 0xa9, 0x59, 0x94, 0xa8, 0x88, 0x78,
+    0x85, 0x89, 0xb8, 0xac, 0x77, 0xbb, 0x6a, 0x97, 0x97, 0x9b, 0x47, 0x99, 0x89, 0x88, 0xc8, 0x47,
+    0x97, 0x9a, 0x97, 0x79, 0x85, 0x84, 0x89, 0xc9, 0xbd, 0x78, 0xb7, 0xcb, 0x88, 0xab, 0x6a, 0xf9,
+    0x7a, 0x59, 0xb5, 0x65, 0x44, 0x72, 0x97, 0xa9, 0x4d, 0x97, 0xa9, 0xa7, 0x77, 0x99, 0xbc, 0x9a,
+    0xa7, 0xba, 0x98, 0x8c, 0x9a, 0xa5, 0x9a, 0xc7, 0xba, 0x7a, 0xa5, 0xa9, 0x64, 0x97, 0x89, 0x69,
+    0x99, 0x79, 0xb9, 0xb9, 0x88, 0x8b, 0xb8, 0x68, 0x55, 0x96, 0x79, 0x65, 0xb8, 0xaa, 0xdc, 0xb8,
+    0xdb, 0xcc, 0x7c, 0x9b, 0x88, 0x78, 0x88, 0xa8, 0xa6, 0xc7, 0x96, 0x7a, 0xc8, 0x6d, 0x87, 0x78,
+    0xc9, 0x6a, 0x3a, 0x55, 0xb9, 0xd9, 0xca, 0x58, 0x7a, 0xa6, 0x88, 0xb8, 0x99, 0x73, 0x4d, 0x87,
+    0xbb, 0x99, 0x57, 0xac, 0x6a, 0x52, 0x42, 0x88, 0x75, 0xa8, 0x7c, 0x55, 0x86, 0xa1, 0x88, 0x65,
+    0x99, 0xa8, 0x5a, 0x96, 0x96, 0x8c, 0x77, 0xa8, 0x8a, 0x97, 0x99, 0x7e, 0x85, 0x97, 0x9a, 0x5c,
+    0x79, 0x75, 0xa8, 0x8b, 0x88, 0x78, 0x7b, 0x67, 0x77, 0xab, 0x8a, 0x79, 0xa9, 0xa6, 0x26, 0x7b,
+    0xa8, 0x8d, 0xa8, 0xdb, 0x78, 0xb8, 0x99, 0xc8, 0x6a, 0x68, 0x99, 0xaa, 0x75, 0x9a, 0xc7, 0xaa,
+    0xa9, 0x99, 0xb9, 0xaa, 0x7b, 0xb7, 0xd8, 0x2e, 0xa3, 0x98, 0x88, 0x97, 0x85, 0xa8, 0xd6, 0x9b,
+    0x8a, 0xaa, 0xcb, 0x9a, 0xb6, 0x4c, 0xa7, 0x9a, 0x8b, 0x83, 0xba, 0xa9, 0x79, 0x98, 0x9a, 0x37,
+    0x9b, 0xab, 0xb8, 0x98, 0x8b, 0xbd, 0xa9, 0x59, 0x34, 0x97, 0x66, 0x79, 0x77, 0x97, 0x9c, 0x43,
+    0x54, 0x94, 0x68, 0x94, 0xb8, 0x9a, 0xac, 0xcb, 0xde, 0xee, 0xa9, 0x88, 0x99, 0xb9, 0xaa, 0xb8,
+    0xaa, 0xa8, 0x9c, 0x6a, 0x88, 0xca, 0x6a, 0xab, 0x8a, 0xbb, 0x7a, 0x76, 0xbd, 0xb9, 0x7a, 0x54,
+    0xa9, 0x56, 0x98, 0x69, 0xcd, 0x8d, 0x99, 0xa7, 0x89, 0x47, 0xaa, 0xa9, 0x58, 0x78, 0x89, 0xb9,
+    0xab, 0x69, 0xba, 0x59, 0x85, 0x89, 0x89, 0xa8, 0x9a, 0x89, 0xa9, 0x8a, 0x8a, 0x98, 0xa9, 0x89,
+    0xaa, 0x97, 0x98, 0x4b, 0x68, 0x88, 0xd9, 0x6a, 0xa9, 0x97, 0xcc, 0x9d, 0xaa, 0x98, 0x98, 0x9b,
+    0x69, 0x59, 0x50, 0x89, 0x8a, 0xba, 0x8b, 0x57, 0x98, 0x99, 0x38, 0xb8, 0xbd, 0x79, 0x84, 0xcd,
+    0x9d, 0x5b, 0x97, 0x9a, 0x1a, 0x86, 0x99, 0x99, 0x44, 0xd6, 0x6e, 0x74, 0x88, 0x88, 0x98, 0x89,
+    0x99, 0x98, 0x99, 0x9a, 0x88, 0x88, 0x89, 0x88, 0x89, 0x98, 0x9a, 0x88, 0x99, 0x9a, 0x88, 0xa8,
+    0x98, 0x98, 0x88, 0x99, 0x88, 0xda, 0xdc, 0x59, 0xa7, 0x99, 0x98, 0x84, 0xb9, 0xab, 0x7b, 0x76,
+    0x87, 0xbb, 0x35, 0x9a, 0xb9, 0x6b, 0x77, 0x9a, 0x89, 0x77, 0xbc, 0x98, 0x98, 0xab, 0xd7, 0xbe,
+    0x97, 0x8a, 0xa9, 0x69, 0x78, 0xb9, 0x98, 0x3c, 0x76, 0xa7, 0x7a, 0x77, 0x88, 0x8b, 0x97, 0xa9,
+    0x86, 0x99, 0xd7, 0x88, 0x88, 0xa7, 0xa9, 0xa6, 0x88, 0x7e, 0x79, 0x5a, 0x14, 0x8a, 0xa8, 0xad,
+    0x6b, 0x75, 0xbd, 0x58, 0x76, 0x76, 0x7a, 0xa1, 0x95, 0xaa, 0x59, 0x4c, 0xba, 0x8e, 0x89, 0x89,
+    0x88, 0x8a, 0x98, 0x97, 0xa7, 0x88, 0x57, 0x57, 0x8b, 0x78, 0xba, 0xd7, 0x88, 0xc9, 0x5a, 0x7a,
+    0x89, 0x89, 0x86, 0x88, 0x78, 0x97, 0x88, 0x9a, 0x5a, 0x88, 0xc8, 0x7d, 0x92, 0xaa, 0x59, 0x89,
+    0xa8, 0xc9, 0x84, 0xa9, 0xaa, 0x17, 0x83, 0xa9, 0xbc, 0x66, 0x8a, 0x6b, 0xda, 0xba, 0x89, 0xda,
+    0x98, 0xda, 0x88, 0x8a, 0xc7, 0x99, 0x78, 0x86, 0x8b, 0x88, 0x56, 0xca, 0x8a, 0x8a, 0x97, 0x8a,
+    0x79, 0xaa, 0x97, 0x78, 0x99, 0x8b, 0x8b, 0x7c, 0x8c, 0x87, 0x9b, 0x7b, 0x97, 0x7c, 0x34, 0xa8,
+    0xee, 0x7a, 0xa5, 0xc7, 0xcc, 0xac, 0x96, 0x87, 0x7a, 0x86, 0xba, 0xdc, 0xa9, 0x93, 0xb9, 0x9a,
+    0x99, 0x86, 0x83, 0xa6, 0xaa, 0x99, 0x98, 0xd8, 0xa8, 0xda, 0xb9, 0x7c, 0xcb, 0xaa, 0x4a, 0x76,
+    0x8c, 0xd8, 0x76, 0xa8, 0xba, 0xdc, 0x46, 0x8a, 0x6c, 0xaa, 0xb7, 0x9a, 0x8c, 0xa9, 0x88, 0x67,
+    0x9a, 0x88, 0x8a, 0x96, 0x55, 0x75, 0x88, 0x98, 0x96, 0x66, 0x99, 0x9c, 0x9a, 0xc8, 0xb8, 0x88,
+    0x58, 0x8d, 0x68, 0x89, 0x88, 0xcb, 0xbd, 0x6b, 0xa4, 0xba, 0xaa, 0x36, 0x99, 0xa9, 0xaa, 0x66,
+    0xb6, 0x7a, 0x45, 0x87, 0x9b, 0x87, 0x97, 0xaa, 0x79, 0x69, 0xc9, 0xaa, 0xba, 0x68, 0xcc, 0x99,
+    0x7b, 0x75, 0x77, 0x57, 0x57, 0x88, 0xab, 0x69, 0xc7, 0x84, 0x9a, 0xc7, 0x89, 0x7a, 0x54, 0xba,
+    0x5b, 0xcc, 0xa7, 0x96, 0x87, 0x95, 0x98, 0xba, 0x68, 0x67, 0x65, 0x79, 0x35, 0x47, 0xb7, 0xc9,
+    0x9b, 0x77, 0x9d, 0x69, 0xbc, 0xa7, 0x78, 0xa5, 0x7a, 0x87, 0x97, 0x99, 0x88, 0x98, 0xa7, 0x9e,
+    0xb6, 0x8a, 0xa7, 0x8b, 0xc8, 0xb9, 0x8b, 0xa8, 0x99, 0x76, 0x67, 0x7a, 0x77, 0xb8, 0x88, 0xba,
+    0xa8, 0x9b, 0xa9, 0x99, 0xb6, 0x73, 0x7a, 0x6b, 0x66, 0x98, 0xb9, 0x89, 0x87, 0x87, 0x79, 0xfc,
+    0xb9, 0x69, 0x54, 0x9a, 0x9b, 0x99, 0x9a, 0xab, 0xb8, 0xab, 0xca, 0x8c, 0x78, 0x66, 0x99, 0x79,
+    0xae, 0x48, 0x78, 0xc7, 0x4b, 0x57, 0xa9, 0xbc, 0x7b, 0x7a, 0xc6, 0xdb, 0x77, 0x67, 0xb5, 0xaa,
+    0x98, 0x97, 0xb9, 0x88, 0x98, 0x99, 0xa9, 0xeb, 0x9a, 0x89, 0x79, 0x9a, 0x45, 0xa5, 0x88, 0xab,
+    0x87, 0x9a, 0x99, 0xac, 0xac, 0xb8, 0xeb, 0x7a, 0x9a, 0x78, 0x7a, 0x88, 0x87, 0x7a, 0x96, 0x47,
+    0xbb, 0x89, 0x56, 0xc2, 0x76, 0x58, 0x94, 0x99, 0xa8, 0x27, 0x86, 0x56, 0x56, 0xdb, 0x6c, 0x69,
+    0x95, 0xba, 0x8b, 0x4a, 0x98, 0xe9, 0xb9, 0xbb, 0x93, 0x79, 0xaa, 0x68, 0x8a, 0x78, 0xa9, 0x99,
+    0x67, 0xc7, 0x6a, 0x98, 0xb8, 0x69, 0x7a, 0xa9, 0x99, 0x89, 0xba, 0xbb, 0x97, 0x8b, 0xaa, 0x69,
+    0x57, 0x9c, 0xba, 0x77, 0x6a, 0x7c, 0xb9, 0xcd, 0x7d, 0xb7, 0x8b, 0x96, 0x86, 0x85, 0x88, 0x68,
+    0x56, 0x9a, 0x5c, 0x4d, 0xaa, 0xbc, 0x88, 0xb9, 0xa2, 0x85, 0x99, 0x65, 0x8a, 0x86, 0x6b, 0xc9,
+    0x89, 0xc7, 0x79, 0x8b, 0x99, 0x87, 0x87, 0x9a, 0x89, 0x85, 0x9a, 0x89, 0x59, 0x97, 0xab, 0x9b,
+    0x98, 0xbd, 0xa8, 0x7a, 0xa9, 0x8a, 0x97, 0xa7, 0xa9, 0x98, 0x77, 0xdc, 0x8b, 0x68, 0x86, 0x89,
+    0x79, 0x98, 0xa7, 0x86, 0xb9, 0x9e, 0x99, 0x98, 0x88, 0xa8, 0x87, 0xc8, 0xaa, 0xb7, 0xc9, 0x65,
+    0xa7, 0x88, 0x59, 0x95, 0x87, 0xa7, 0x79, 0xca, 0x87, 0x9e, 0x7b, 0x76, 0x97, 0x59, 0xb7, 0x95,
+    0x94, 0x89, 0x88, 0x96, 0x99, 0xcc, 0xcb, 0xa9, 0xdb, 0xdc, 0xaa, 0x78, 0xc8, 0x6e, 0x79, 0xa8,
+    0xb8, 0x98, 0xb8, 0xba, 0x9a, 0xb6, 0xea, 0xcd, 0x98, 0x54, 0x57, 0xc9, 0x6a, 0xcd, 0x8a, 0xd9,
+    0xcb, 0xb9, 0x58, 0xcd, 0x6a, 0x7b, 0x95, 0x89, 0x99, 0x79, 0x29, 0x8c, 0x9a, 0x99, 0xce, 0x8b,
+    0xd4, 0x66, 0xa8, 0xb7, 0xcc, 0x86, 0x88, 0xcc, 0xb8, 0x69, 0x56, 0xb7, 0xbd, 0xba, 0x58, 0x76,
+    0x7a, 0x79, 0x4a, 0x67, 0x93, 0x7a, 0xdf, 0xc8, 0x5c, 0x9b, 0x57, 0x65, 0xb4, 0x79, 0xde, 0xab,
+    0xa7, 0xdb, 0xbc, 0x59, 0x9e, 0x6c, 0x78, 0x86, 0xc6, 0x98, 0x99, 0x49, 0x87, 0x98, 0x98, 0x7d,
+    0x6c, 0xd6, 0x48, 0x88, 0x79, 0x8b, 0x66, 0x86, 0xbb, 0xb5, 0xa9, 0xea, 0x6c, 0x8c, 0x94, 0x9c,
+    0xb7, 0x78, 0xb5, 0xb8, 0x7a, 0x57, 0x57, 0xbc, 0xc8, 0xdb, 0x89, 0x98, 0xa9, 0x89, 0x9f, 0x79,
+    0x97, 0xca, 0x48, 0x34, 0x77, 0x34, 0x77, 0x63, 0xa9, 0x64, 0x8b, 0xba, 0x9a, 0x65, 0x95, 0x8a,
+    0xb8, 0xfb, 0x58, 0x78, 0x25, 0x56, 0x98, 0x6a, 0x23, 0x92, 0x89, 0x55, 0x54, 0xaa, 0xbb, 0x59,
+    0x7a, 0xaa, 0xaa, 0x9b, 0x79, 0x9b, 0x98, 0x58, 0xac, 0x87, 0x88, 0x89, 0x78, 0x99, 0x88, 0x9d,
+    0x9d, 0x88, 0x86, 0xb9, 0xb8, 0x79, 0x43, 0x7a, 0xa5, 0x8b, 0xa8, 0x56, 0x87, 0xa9, 0xe3, 0x99,
+    0x7b, 0xc7, 0xce, 0xa7, 0x76, 0xaa, 0x6d, 0xc7, 0x87, 0x78, 0xd9, 0xb7, 0x58, 0x87, 0xac, 0x5c,
+    0x8b, 0xbd, 0x88, 0xa9, 0xd9, 0x7c, 0x7b, 0x6a, 0x88, 0x9d, 0x80, 0x58, 0x96, 0x99, 0x98, 0x98,
+    0x98, 0x89, 0x98, 0x88, 0x99, 0x98, 0x79, 0x99, 0x98, 0xaa, 0x99, 0x99, 0x98, 0x99, 0x89, 0x89,
+    0x9a, 0x8a, 0x99, 0x99, 0x99, 0x79, 0x34, 0x67, 0xa9, 0x35, 0x21, 0xa6, 0x79, 0x65, 0x79, 0xbb,
+    0xca, 0xba, 0xac, 0xaa, 0xa9, 0xab, 0xc9, 0xaa, 0xa7, 0x6a, 0x8d, 0xa7, 0x89, 0x4b, 0xb6, 0x54,
+    0x89, 0xcb, 0x5c, 0x43, 0xa5, 0x9c, 0x86, 0xd9, 0xab, 0x89, 0x77, 0xab, 0x9a, 0x89, 0x77, 0xb9,
+    0x87, 0xdb, 0xf9, 0x8a, 0xa6, 0xa8, 0x69, 0x97, 0x98, 0x7c, 0x96, 0xa7, 0x7b, 0x75, 0x9a, 0xaa,
+    0x6c, 0xaa, 0x76, 0xbb, 0xba, 0xba, 0x86, 0xa5, 0x9c, 0xa9, 0xd9, 0x9b, 0x58, 0x4c, 0x89, 0x98,
+    0x9a, 0x7a, 0x98, 0xba, 0x9d, 0x99, 0x8c, 0x84, 0x88, 0x58, 0x55, 0x43, 0x86, 0x9b, 0x5b, 0x97,
+    0x88, 0x5a, 0x87, 0x79, 0x88, 0x56, 0x79, 0x99, 0x94, 0x85, 0x99, 0x97, 0x9a, 0xcc, 0xa7, 0x97,
+    0xa9, 0x65, 0x86, 0x87, 0x78, 0xae, 0x77, 0xb9, 0x79, 0xc9, 0xcc, 0xaa, 0x74, 0x79, 0x64, 0x69,
+    0x68, 0x79, 0x98, 0x9d, 0x96, 0x9e, 0x8a, 0x89, 0x65, 0xb6, 0x9e, 0xab, 0xa9, 0xa6, 0x9a, 0x9b,
+    0x77, 0x58, 0x86, 0xcb, 0xe8, 0x87, 0x57, 0x98, 0xa4, 0x98, 0xb9, 0xcb, 0x96, 0xd7, 0xbc, 0xba,
+    0x68, 0xa8, 0x98, 0x59, 0x88, 0x98, 0xb9, 0x95, 0xca, 0x66, 0x8a, 0x57, 0x78, 0x6e, 0xa7, 0xb8,
+    0x8c, 0x58, 0x7c, 0xa6, 0x78, 0xa6, 0xaa, 0xda, 0x94, 0x6c, 0x56, 0x64, 0x79, 0x89, 0xd7, 0xab,
+    0x8a, 0x65, 0xca, 0x99, 0x48, 0x69, 0xaa, 0x55, 0x76, 0x78, 0xa8, 0x9b, 0xaa, 0x78, 0x75, 0xb9,
+    0xb7, 0x5a, 0xa9, 0x97, 0x8d, 0x9a, 0x8a, 0xa8, 0xa8, 0xeb, 0x97, 0x86, 0x33, 0x6d, 0x7b, 0x96,
+    0xba, 0x8b, 0x98, 0x88, 0x96, 0xc4, 0x7a, 0x86, 0x87, 0xc9, 0x8b, 0xdb, 0xdb, 0xcb, 0x93, 0x9d,
+    0xab, 0x6b, 0x9c, 0x99, 0x88, 0xb6, 0xc8, 0x68, 0x97, 0x78, 0x77, 0xa5, 0x78, 0x65, 0xbb, 0x8d,
+    0xbb, 0xba, 0x6b, 0x8b, 0x88, 0x59, 0x9b, 0xcb, 0x78, 0x99, 0xcb, 0x68, 0x58, 0xa8, 0x6d, 0xc6,
+    0x7c, 0x54, 0x79, 0xc8, 0xb5, 0x97, 0xcb, 0xcd, 0xa9, 0x97, 0xdd, 0x9a, 0xcc, 0x8a, 0x9a, 0x87,
+    0xaa, 0x88, 0x97, 0x77, 0x77, 0x96, 0xea, 0x87, 0x9c, 0x87, 0x88, 0x89, 0x58, 0x7b, 0x86, 0x57,
+    0xa5, 0xac, 0xaa, 0xaa, 0xc9, 0x49, 0x99, 0x9a, 0x78, 0x9c, 0x99, 0x8b, 0xa9, 0x8a, 0x77, 0xaa,
+    0x65, 0x76, 0x88, 0x9a, 0x54, 0x89, 0x74, 0x88, 0x88, 0xca, 0xbb, 0x77, 0x86, 0x7a, 0xb6, 0x89,
+    0x89, 0xa7, 0xba, 0x77, 0xbc, 0xc9, 0xbb, 0x7a, 0x37, 0x5b, 0x98, 0x97, 0xaa, 0x88, 0x88, 0x98,
+    0x6c, 0x81, 0x66, 0x8a, 0xc6, 0xc3, 0x58, 0x36, 0xa6, 0xbc, 0x88, 0x68, 0xa9, 0xcb, 0x7a, 0x76,
+    0x68, 0x99, 0x87, 0x98, 0x6a, 0x77, 0x8a, 0x8a, 0xaf, 0x6b, 0x88, 0x68, 0x87, 0x97, 0x9a, 0x59,
+    0xaa, 0xb7, 0xaa, 0x68, 0x8a, 0x76, 0x6b, 0x46, 0x8b, 0x5b, 0x8a, 0xbc, 0xa6, 0x64, 0xa9, 0x8a,
+    0x85, 0x96, 0xdb, 0x7c, 0x9a, 0x8a, 0xdd, 0x82, 0x88, 0xd6, 0x84, 0x87, 0xa8, 0xaa, 0x87, 0xa8,
+    0xcc, 0x8c, 0xcb, 0xcb, 0x99, 0x6d, 0x73, 0x63, 0x68, 0xcc, 0x87, 0x64, 0x9e, 0x77, 0x57, 0x6b,
+    0xad, 0xcb, 0x9a, 0x97, 0xba, 0xb9, 0x8a, 0x95, 0x88, 0xa8, 0xe6, 0x68, 0x56, 0xb3, 0x39, 0x78,
+    0x57, 0x79, 0x79, 0xba, 0xba, 0x9d, 0xcb, 0xb8, 0x66, 0x95, 0xa8, 0x7a, 0xa8, 0x8a, 0xa8, 0x6b,
+    0xab, 0x9a, 0x39, 0xd5, 0x88, 0x67, 0xa7, 0x8a, 0xb6, 0x74, 0x59, 0x9e, 0xbd, 0x89, 0x9c, 0x89,
+    0x7b, 0x3d, 0x57, 0x77, 0x75, 0x66, 0xb7, 0x87, 0x79, 0x78, 0x89, 0x97, 0xac, 0x9a, 0xa9, 0x98,
+    0x57, 0x65, 0xd9, 0x35, 0x64, 0x88, 0xaa, 0x68, 0x59, 0xf7, 0xbc, 0xba, 0x8b, 0xb8, 0x7b, 0x8a,
+    0x58, 0xa5, 0x47, 0x97, 0x37, 0x73, 0x84, 0x79, 0x7c, 0xab, 0x6c, 0x7b, 0xb9, 0xda, 0x79, 0xbb,
+    0x8a, 0x8e, 0x9b, 0x89, 0xaa, 0x97, 0x99, 0x98, 0x89, 0x47, 0x76, 0xc9, 0x89, 0x8e, 0x99, 0xb7,
+    0x58, 0xa8, 0x9b, 0xab, 0xb9, 0xcd, 0xbe, 0x8a, 0xac, 0x83, 0x73, 0xb9, 0x69, 0x68, 0x67, 0x87,
+    0x6a, 0x76, 0x58, 0x59, 0x89, 0x87, 0x44, 0x87, 0x99, 0xb4, 0xbb, 0x67, 0x98, 0x7a, 0x88, 0x88,
+    0x86, 0x69, 0xb5, 0x86, 0xac, 0x88, 0xca, 0x7c, 0xaa, 0x98, 0x98, 0x75, 0x87, 0x8c, 0x78, 0x97,
+    0xb8, 0x59, 0x78, 0xa7, 0x68, 0xa9, 0x77, 0x78, 0x78, 0xa9, 0x57, 0x68, 0x8a, 0xa9, 0x9a, 0x9a,
+    0xaa, 0x8b, 0x9a, 0xaa, 0x88, 0x78, 0x56, 0xab, 0x45, 0x97, 0x47, 0xc6, 0x6c, 0x88, 0x76, 0xa7,
+    0x87, 0xa6, 0x46, 0x77, 0x59, 0xa5, 0x89, 0x98, 0x55, 0x89, 0x98, 0xd8, 0xca, 0xa9, 0x9b, 0xa9,
+    0xad, 0xcc, 0x89, 0xb9, 0x8a, 0x68, 0x6a, 0xb8, 0xbc, 0x6b, 0x78, 0x89, 0x9b, 0x78, 0x4a, 0x63,
+    0x9b, 0x84, 0xb9, 0x76, 0x9a, 0xa9, 0x7a, 0x56, 0xb5, 0xeb, 0x79, 0x89, 0x88, 0x98, 0x75, 0x89,
+    0x99, 0x48, 0x63, 0xc9, 0xaa, 0xbb, 0xd9, 0xac, 0x7b, 0xcb, 0xca, 0xa8, 0xb9, 0x9c, 0xc9, 0x96,
+    0xea, 0x6a, 0x9b, 0x89, 0x44, 0x97, 0x89, 0x66, 0xba, 0xc8, 0x7a, 0x98, 0xcd, 0x7b, 0x99, 0xca,
+    0x89, 0x98, 0x7b, 0x59, 0x98, 0x88, 0x88, 0x68, 0xaa, 0xab, 0x98, 0xa8, 0x97, 0xa8, 0x99, 0x86,
+    0x57, 0x66, 0x97, 0xa6, 0x5a, 0x56, 0xec, 0xdc, 0xaa, 0x99, 0x9b, 0xa9, 0x9a, 0xd8, 0xa9, 0x79,
+    0xaa, 0x9a, 0x7a, 0x55, 0x78, 0x94, 0xa9, 0x69, 0xa7, 0xb8, 0x9a, 0x54, 0xa4, 0xcd, 0x4a, 0x87,
+    0x99, 0x57, 0xaa, 0xa8, 0x67, 0x77, 0xb9, 0x5a, 0xd7, 0x68, 0xd9, 0xa9, 0x99, 0x89, 0x99, 0x89,
+    0x99, 0x88, 0x88, 0x99, 0x98, 0x89, 0xa8, 0xa9, 0x99, 0xa9, 0x8a, 0x89, 0x88, 0xaa, 0x99, 0x8a,
+    0x99, 0x99, 0x99, 0x89, 0x89, 0x68, 0x84, 0x98, 0x69, 0x76, 0xdb, 0x9b, 0x99, 0xa6, 0xcc, 0x5c,
+    0xbc, 0xaa, 0xaa, 0x9a, 0x9b, 0x47, 0x93, 0xb8, 0x7a, 0x97, 0x95, 0xbb, 0x89, 0x69, 0x28, 0x4b,
+    0x98, 0xb6, 0x59, 0x67, 0x5a, 0x79, 0x67, 0xe7, 0x95, 0x9a, 0xba, 0xcd, 0x78, 0xa8, 0xa9, 0x87,
+    0xa9, 0x78, 0x67, 0xa7, 0xa9, 0xb8, 0x79, 0xbb, 0x6b, 0xc6, 0x68, 0x96, 0xdd, 0x9b, 0x69, 0x51,
+    0x87, 0x87, 0x79, 0x76, 0x44, 0x89, 0xa9, 0x66, 0xbc, 0xa8, 0xbb, 0x87, 0xab, 0xed, 0x89, 0x98,
+    0x88, 0x96, 0x88, 0x79, 0x68, 0x7a, 0xb7, 0xcb, 0x97, 0x99, 0xba, 0x98, 0x8a, 0x9b, 0x86, 0x8b,
+    0x7a, 0xab, 0x8c, 0x99, 0x78, 0x9b, 0x88, 0x88, 0x66, 0xbc, 0x98, 0xd4, 0x8a, 0xbb, 0x73, 0xa8,
+    0x97, 0x98, 0x44, 0x85, 0xa7, 0xcb, 0xa5, 0x98, 0x4a, 0x5c, 0x87, 0xc9, 0x86, 0x9e, 0x8c, 0x8b,
+    0x48, 0xd7, 0x9a, 0xa4, 0x7b, 0xa8, 0x58, 0x89, 0xb9, 0x9a, 0x96, 0xaa, 0xbb, 0xab, 0x88, 0x97,
+    0x68, 0x87, 0x8a, 0x97, 0x89, 0xb5, 0xaa, 0xba, 0x78, 0x9a, 0x78, 0x8b, 0x79, 0xb9, 0xbe, 0x54,
+    0x76, 0xca, 0x59, 0x78, 0xb9, 0x75, 0xba, 0xb8, 0x68, 0x89, 0xe9, 0x99, 0x9a, 0x86, 0x99, 0x8a,
+    0x9b, 0x79, 0xb8, 0xba, 0x58, 0x69, 0x99, 0x79, 0x78, 0x36, 0x66, 0xc7, 0xab, 0x75, 0x5c, 0x96,
+    0x79, 0x77, 0xc6, 0xac, 0xbb, 0x8e, 0xb9, 0xca, 0xcc, 0x78, 0x9c, 0x78, 0x59, 0x79, 0xb7, 0x9c,
+    0x7b, 0x8a, 0xbb, 0x5b, 0x67, 0x97, 0xa4, 0x58, 0xa5, 0x8a, 0x77, 0xa9, 0xba, 0x3b, 0x89, 0xbc,
+    0xbb, 0x97, 0x99, 0x98, 0x99, 0x34, 0x95, 0xc8, 0x5c, 0xa8, 0xca, 0xdd, 0xa6, 0xaa, 0xd9, 0xaa,
+    0x9a, 0xc6, 0xba, 0x97, 0xb9, 0x78, 0xb9, 0x99, 0x89, 0x87, 0x58, 0x9a, 0x97, 0xa7, 0x98, 0xc7,
+    0xb8, 0x98, 0x69, 0x9b, 0x8b, 0x78, 0xa8, 0xc8, 0x7a, 0xa9, 0xaa, 0xb9, 0x87, 0x78, 0x94, 0x48,
+    0xd6, 0x67, 0x95, 0x88, 0x78, 0x9c, 0x76, 0x6e, 0x56, 0xba, 0xa9, 0x98, 0xe8, 0xa8, 0x9a, 0x99,
+    0x6c, 0x88, 0x88, 0x98, 0x77, 0x79, 0x5a, 0x68, 0x84, 0x98, 0xc7, 0x88, 0x99, 0x88, 0x98, 0xa3,
+    0x9e, 0x9c, 0x8b, 0xb6, 0xa8, 0xb8, 0xbe, 0x6c, 0x87, 0xb9, 0x78, 0x85, 0x78, 0x98, 0x89, 0x98,
+    0x8a, 0x89, 0x99, 0x89, 0x88, 0x89, 0x6c, 0xb8, 0xb7, 0x8b, 0xda, 0x7a, 0xba, 0xda, 0x57, 0x77,
+    0x54, 0x99, 0x77, 0x7b, 0x8b, 0x68, 0xba, 0x9a, 0xba, 0x97, 0xdc, 0x97, 0xa8, 0x98, 0x88, 0x98,
+    0x65, 0xbe, 0xbb, 0x38, 0xc4, 0xdc, 0xca, 0xdc, 0x9b, 0x9a, 0xc7, 0x9c, 0x86, 0x6b, 0xa9, 0x98,
+    0x77, 0x8a, 0x88, 0x99, 0xa9, 0xa7, 0x88, 0xa8, 0x93, 0x7c, 0x67, 0x67, 0x98, 0xac, 0x69, 0xf9,
+    0xaa, 0x8b, 0x79, 0xab, 0x8a, 0xa7, 0xc9, 0x88, 0x65, 0x8b, 0x78, 0x65, 0x8b, 0x99, 0xba, 0xb8,
+    0x79, 0x8a, 0xbc, 0x97, 0x88, 0xb8, 0x52, 0x76, 0xa8, 0xbd, 0xaa, 0x8a, 0x75, 0xa9, 0xc9, 0x46,
+    0x98, 0xab, 0x67, 0x34, 0x78, 0x88, 0x36, 0x88, 0xdb, 0x85, 0x97, 0xb9, 0x78, 0xa8, 0xaa, 0xd9,
+    0xb5, 0x9c, 0x56, 0xa9, 0x89, 0x98, 0x59, 0x98, 0x9a, 0xa7, 0x5e, 0xa6, 0x89, 0xdc, 0x88, 0xa7,
+    0xab, 0x7a, 0x49, 0xb6, 0xbb, 0xb8, 0x68, 0x33, 0x6c, 0xa9, 0x69, 0x93, 0xa4, 0xa8, 0x89, 0x69,
+    0xc9, 0xba, 0xfb, 0xa8, 0x85, 0xda, 0x9d, 0x99, 0xb8, 0xab, 0x89, 0xba, 0xcb, 0x98, 0x77, 0x6b,
+    0x79, 0x58, 0x97, 0x54, 0x99, 0xba, 0x67, 0x88, 0xf8, 0x8a, 0x9a, 0x88, 0x8a, 0xaa, 0xaa, 0x59,
+    0xba, 0x8a, 0x69, 0xaa, 0xb9, 0xc9, 0x88, 0x79, 0xda, 0x58, 0x87, 0x78, 0x87, 0x89, 0x68, 0xc9,
+    0xa9, 0x79, 0x99, 0x99, 0x88, 0x89, 0x9c, 0x99, 0x85, 0x89, 0x9a, 0x69, 0x8b, 0x6a, 0xa9, 0x8b,
+    0x89, 0x63, 0x87, 0x9c, 0x97, 0x87, 0x77, 0xb7, 0xab, 0x85, 0x67, 0x57, 0x9d, 0xa6, 0x94, 0xb7,
+    0xdd, 0xad, 0x99, 0xdc, 0xbc, 0x9a, 0x3a, 0xbb, 0xba, 0x65, 0x97, 0x9a, 0x6b, 0x65, 0xb7, 0x7a,
+    0x88, 0x89, 0x88, 0x62, 0x82, 0xd8, 0x25, 0x32, 0x79, 0xca, 0xbc, 0xcc, 0xb8, 0xcd, 0xa7, 0x8a,
+    0xab, 0x6a, 0x98, 0xc7, 0x9a, 0x85, 0x89, 0x8b, 0x9a, 0x79, 0x58, 0x78, 0x89, 0x96, 0x77, 0xa3,
+    0x88, 0xcb, 0x8a, 0x88, 0x9a, 0x4a, 0x88, 0x89, 0x97, 0x69, 0x9a, 0x4a, 0x8a, 0xaa, 0xaa, 0x97,
+    0xa8, 0xab, 0x8b, 0x94, 0x99, 0x87, 0x99, 0x34, 0x45, 0x94, 0xfb, 0x8d, 0xba, 0xe9, 0x9c, 0x78,
+    0x9b, 0x9b, 0x6b, 0x77, 0xe8, 0xb9, 0x73, 0x98, 0xcc, 0xb9, 0x79, 0x69, 0x78, 0x9c, 0x99, 0x88,
+    0xc6, 0x8a, 0xd7, 0x8b, 0xb9, 0x98, 0x8a, 0x97, 0x68, 0xa3, 0xa9, 0xac, 0xba, 0x8b, 0x7c, 0x47,
+    0xc7, 0x8a, 0x88, 0xa8, 0x39, 0x87, 0x54, 0xc8, 0x10, 0x82, 0xc9, 0x8c, 0x89, 0x97, 0x76, 0x56,
+    0x79, 0x77, 0x58, 0xca, 0xbd, 0x46, 0xe6, 0xcd, 0x98, 0x43, 0xb7, 0x69, 0x68, 0xb3, 0x26, 0x83,
+    0x7a, 0x6a, 0x97, 0xb9, 0x93, 0xed, 0x9b, 0x66, 0xb5, 0x9b, 0x86, 0x52, 0xb9, 0x88, 0x49, 0xc7,
+    0x66, 0xa9, 0x76, 0x87, 0xa8, 0xa8, 0xaa, 0x79, 0x87, 0x99, 0xa9, 0xa4, 0xab, 0x8b, 0xaa, 0x89,
+    0x76, 0x76, 0x79, 0x9a, 0xa9, 0xa9, 0x68, 0xa7, 0x9b, 0x9a, 0x74, 0xaa, 0xa8, 0x78, 0x85, 0x74,
+    0x86, 0xdb, 0x6a, 0x47, 0xaa, 0x79, 0x78, 0x88, 0x67, 0x77, 0x68, 0x69, 0x75, 0xbd, 0x85, 0x78,
+    0xca, 0x48, 0x57, 0x89, 0x78, 0xa8, 0x85, 0x87, 0x36, 0x9a, 0x8a, 0x99, 0x89, 0x98, 0x99, 0x99,
+    0x89, 0x99, 0x79, 0x97, 0x98, 0x89, 0x98, 0xa9, 0x99, 0x98, 0x98, 0x99, 0x99, 0x98, 0x99, 0x98,
+    0x98, 0x99, 0x88, 0x99, 0x88, 0x89, 0x54, 0x89, 0x98, 0x78, 0xa9, 0xbb, 0x53, 0x76, 0x78, 0x74,
+    0x45, 0x89, 0x84, 0x69, 0xa7, 0x6b, 0x99, 0x78, 0xab, 0x9b, 0x69, 0xd9, 0x6e, 0xb5, 0x8d, 0xe9,
+    0x9b, 0x98, 0xb4, 0x99, 0x88, 0x3c, 0x95, 0x99, 0xa8, 0x63, 0xa9, 0x65, 0xc9, 0xb8, 0xe7, 0x87,
+    0xca, 0x88, 0x8b, 0x96, 0x78, 0x48, 0xc8, 0x8c, 0xdb, 0xc9, 0xab, 0xab, 0x39, 0xbb, 0xca, 0x79,
+    0x5d, 0x7a, 0x9c, 0xd8, 0x9c, 0x98, 0x88, 0x7a, 0x67, 0x88, 0x7a, 0x48, 0xd1, 0xd2, 0x99, 0xaa,
+    0x78, 0x87, 0x79, 0x88, 0xb9, 0x87, 0xa7, 0xba, 0x8c, 0x78, 0xc9, 0x8e, 0x9b, 0x46, 0x68, 0x96,
+    0xb8, 0x64, 0x9c, 0x89, 0xa8, 0xba, 0x88, 0xa9, 0xee, 0xca, 0x9c, 0xcb, 0xac, 0x68, 0xc8, 0x79,
+    0x77, 0x95, 0xad, 0xab, 0xb7, 0xa7, 0x9d, 0xa6, 0xb9, 0xa6, 0x9b, 0x66, 0x87, 0x66, 0x7d, 0xb8,
+    0xaa, 0x6a, 0x97, 0x87, 0x76, 0x96, 0x9a, 0x97, 0x56, 0x94, 0x78, 0x89, 0x67, 0x97, 0xba, 0xaa,
+    0x8a, 0x87, 0xdb, 0x88, 0x8b, 0xc6, 0xb8, 0x58, 0xbd, 0x97, 0xaa, 0x59, 0x66, 0x69, 0x68, 0x99,
+    0x9c, 0xcd, 0x9b, 0x89, 0xb7, 0x55, 0x47, 0x74, 0x86, 0x7c, 0x17, 0xc2, 0x99, 0x48, 0x8d, 0x79,
+    0x87, 0xeb, 0x7b, 0x8b, 0xa8, 0x99, 0xaa, 0x85, 0x8d, 0xaa, 0x57, 0xc7, 0x65, 0xa9, 0x8a, 0xb9,
+    0xd6, 0x98, 0x98, 0x8a, 0xd7, 0x88, 0x64, 0x97, 0x75, 0xba, 0x8b, 0xa9, 0x77, 0x77, 0x87, 0x89,
+    0x88, 0x88, 0xdb, 0xac, 0xaa, 0xbb, 0x49, 0x8a, 0x79, 0x69, 0x88, 0x98, 0xaa, 0xa7, 0x89, 0x34,
+    0x98, 0x98, 0x89, 0xc7, 0x9c, 0x6b, 0x43, 0x88, 0x28, 0x45, 0x97, 0x6c, 0x78, 0x60, 0x99, 0x73,
+    0x69, 0xa7, 0xb8, 0x8c, 0xa9, 0x7a, 0x54, 0x87, 0x99, 0x5b, 0xb9, 0x9d, 0x9b, 0xba, 0x9a, 0xa7,
+    0x69, 0x9b, 0x59, 0xab, 0x86, 0xca, 0xb9, 0xc9, 0x78, 0x69, 0x69, 0x77, 0x98, 0x69, 0x69, 0x88,
+    0x48, 0x59, 0xb4, 0x8d, 0xdb, 0x8a, 0xcc, 0x55, 0x98, 0xc8, 0x79, 0x52, 0x78, 0xb8, 0x37, 0x9a,
+    0x65, 0xab, 0xab, 0xca, 0xb7, 0x9b, 0x57, 0x97, 0x75, 0x79, 0x69, 0x89, 0xd8, 0xfb, 0x8c, 0xa9,
+    0xb9, 0x98, 0x66, 0x8e, 0xbc, 0x8a, 0x53, 0x67, 0x78, 0x59, 0x84, 0xb9, 0x87, 0x79, 0xaa, 0x88,
+    0xa7, 0x89, 0x88, 0x95, 0xce, 0xee, 0xea, 0xb9, 0xbb, 0x88, 0x8a, 0xaa, 0x6b, 0x67, 0xb7, 0xa9,
+    0x66, 0x79, 0x88, 0x9a, 0x86, 0x8a, 0xa9, 0x97, 0x78, 0x45, 0xf9, 0x85, 0xa9, 0xca, 0xa7, 0x88,
+    0xb5, 0xa4, 0x8a, 0x79, 0xba, 0xcc, 0x68, 0x56, 0x43, 0x55, 0x69, 0x53, 0x9a, 0xa8, 0xb7, 0xa9,
+    0x89, 0xa8, 0x99, 0xb8, 0xc7, 0x9b, 0x9a, 0xa8, 0x46, 0x44, 0x66, 0x56, 0x96, 0xcd, 0xaa, 0x35,
+    0xa6, 0x89, 0x4b, 0x73, 0x98, 0x6a, 0x9c, 0xa9, 0x7c, 0x47, 0x8b, 0x87, 0x84, 0xcb, 0xcc, 0xad,
+    0x87, 0xaa, 0xcb, 0x98, 0xb8, 0xca, 0x48, 0xab, 0xac, 0x48, 0xeb, 0xb8, 0x78, 0x78, 0x8b, 0x7a,
+    0x61, 0x77, 0x77, 0x67, 0x79, 0xb7, 0x5b, 0xa6, 0x56, 0x99, 0x86, 0x98, 0x7b, 0x5a, 0xc9, 0x29,
+    0x86, 0xa6, 0x79, 0x8b, 0x8a, 0xa8, 0xba, 0x85, 0xa9, 0xa9, 0x86, 0x77, 0xaa, 0x88, 0xf6, 0xaa,
+    0xa9, 0xa9, 0xaa, 0x9c, 0x59, 0xca, 0xbb, 0x67, 0x78, 0x8c, 0x76, 0x7a, 0xb8, 0x8b, 0xaa, 0x87,
+    0xa7, 0x77, 0x8b, 0x88, 0x55, 0x45, 0x88, 0xb7, 0xcf, 0xaa, 0xc8, 0xbd, 0x79, 0x8a, 0xeb, 0xa9,
+    0xa9, 0xd8, 0x89, 0x74, 0x96, 0x55, 0xb6, 0x8a, 0x79, 0xa7, 0x89, 0x99, 0x78, 0x67, 0x6a, 0xd9,
+    0x8b, 0xb9, 0xa9, 0x88, 0x66, 0x88, 0x78, 0x9a, 0x78, 0x66, 0xca, 0x7a, 0xac, 0x7e, 0xdb, 0x86,
+    0x77, 0x86, 0x8a, 0x94, 0x89, 0x78, 0x98, 0xb8, 0xbc, 0x6a, 0x8a, 0xca, 0x89, 0xc4, 0x99, 0xb9,
+    0x36, 0x98, 0x99, 0x9b, 0x98, 0xa6, 0xc9, 0x5b, 0x6a, 0x68, 0x9a, 0x59, 0x98, 0x78, 0xb3, 0x96,
+    0x97, 0x95, 0xa5, 0x84, 0xa9, 0x6a, 0xda, 0x88, 0xa9, 0x9b, 0x89, 0x97, 0xbc, 0x8b, 0x9b, 0x87,
+    0xd8, 0x7c, 0x76, 0xa9, 0x9a, 0x98, 0xc9, 0xe9, 0x99, 0x49, 0x48, 0x38, 0xbc, 0xbb, 0x87, 0x67,
+    0xdc, 0x9c, 0x78, 0x74, 0x96, 0xa8, 0x95, 0xc5, 0x77, 0x87, 0x88, 0xb7, 0x99, 0x93, 0x96, 0x9a,
+    0x6c, 0x57, 0x87, 0x65, 0xb8, 0xba, 0x97, 0x48, 0xbc, 0x89, 0xb9, 0xd8, 0x44, 0xb8, 0x68, 0x74,
+    0x58, 0x96, 0xe9, 0x78, 0xa5, 0x8c, 0x51, 0xb8, 0xc9, 0x9a, 0xc8, 0x72, 0x76, 0x69, 0xea, 0xab,
+    0x87, 0xa9, 0xa8, 0x8b, 0x84, 0xa9, 0x9a, 0x99, 0xfd, 0x9a, 0x98, 0x79, 0xcd, 0x78, 0x94, 0xc7,
+    0x89, 0xab, 0x59, 0x69, 0x97, 0x42, 0xa9, 0x86, 0x79, 0x78, 0x67, 0xb8, 0x9b, 0x99, 0x76, 0xc9,
+    0xda, 0x9b, 0xd9, 0x7d, 0xca, 0x99, 0xa0, 0xa7, 0xd9, 0x6c, 0x89, 0x79, 0x98, 0x77, 0x8b, 0x9b,
+    0x98, 0xaa, 0xee, 0xc9, 0xaa, 0xc6, 0x7f, 0xb8, 0x78, 0xbb, 0x68, 0x8d, 0x47, 0x38, 0x75, 0x9b,
+    0x66, 0x58, 0xc9, 0x88, 0x87, 0x99, 0xa9, 0xba, 0xbd, 0x34, 0xaa, 0xba, 0x59, 0xa6, 0x87, 0x98,
+    0x68, 0x77, 0x68, 0xba, 0x89, 0x74, 0x58, 0x89, 0x8b, 0x97, 0x77, 0x76, 0x68, 0x78, 0x49, 0xb7,
+    0x8c, 0x78, 0x9b, 0xde, 0x8a, 0x89, 0x57, 0x8d, 0x7a, 0x78, 0xdb, 0x97, 0x76, 0x69, 0xa6, 0x89,
+    0x97, 0x98, 0xcc, 0xca, 0x55, 0x55, 0x88, 0x98, 0xba, 0x99, 0x58, 0xab, 0xbc, 0xba, 0xbb, 0xf8,
+    0xa8, 0x9c, 0xc7, 0xac, 0xea, 0xdb, 0x8a, 0x68, 0xc9, 0x53, 0xb5, 0x76, 0x9c, 0x89, 0x88, 0x98,
+    0x89, 0x98, 0x88, 0x98, 0x99, 0x99, 0x98, 0x88, 0xa9, 0x88, 0x98, 0xa9, 0x98, 0x88, 0x88, 0x99,
+    0x88, 0x99, 0x98, 0x99, 0x99, 0x98, 0x88, 0x89, 0x88, 0xaa, 0xa9, 0x38, 0xaa, 0xcd, 0x8a, 0x98,
+    0x79, 0x95, 0x77, 0x79, 0x78, 0xaa, 0x9a, 0x7a, 0x97, 0xa6, 0xbc, 0x67, 0x98, 0x68, 0x37, 0xc0,
+    0x99, 0xba, 0xaa, 0xc5, 0xc8, 0x78, 0xbb, 0x2b, 0x77, 0x58, 0x4a, 0x68, 0xb6, 0x76, 0x5a, 0x8b,
+    0x68, 0x5a, 0x3c, 0x99, 0xbc, 0x58, 0x59, 0x87, 0x66, 0x53, 0x78, 0x94, 0xcb, 0x79, 0xa8, 0x9b,
+    0xc8, 0x75, 0x97, 0xd7, 0xbd, 0x88, 0xc8, 0x4c, 0xb8, 0x8a, 0xc8, 0xca, 0xdb, 0xa5, 0x8a, 0x68,
+    0x88, 0x89, 0x98, 0x88, 0xab, 0x88, 0xc8, 0xec, 0x8c, 0x99, 0xa9, 0x89, 0x87, 0x79, 0xe7, 0xad,
+    0xb8, 0x97, 0x9b, 0x88, 0x87, 0xb4, 0x89, 0x89, 0x67, 0x68, 0x88, 0x34, 0xdc, 0x69, 0x78, 0xb8,
+    0x89, 0xb8, 0x97, 0x7b, 0xa9, 0x97, 0x99, 0xbb, 0xa6, 0x7a, 0x79, 0x5d, 0x9d, 0xa9, 0xea, 0x69,
+    0x34, 0x77, 0x88, 0xba, 0x8c, 0x56, 0xb7, 0x68, 0xb8, 0x76, 0x76, 0x54, 0x8a, 0x4b, 0x86, 0xc6,
+    0x69, 0x8d, 0x8a, 0x69, 0x47, 0x99, 0xaa, 0x78, 0x87, 0xa8, 0x97, 0xa3, 0x99, 0x94, 0xd9, 0x49,
+    0x98, 0xa8, 0xb9, 0xd9, 0x4b, 0x9a, 0xb6, 0x9d, 0xda, 0xd6, 0xac, 0x58, 0x79, 0xb1, 0x99, 0x8a,
+    0x99, 0x89, 0x66, 0x62, 0x79, 0x69, 0x98, 0x6a, 0x89, 0xb7, 0x8a, 0xbc, 0x5b, 0x98, 0xd7, 0x98,
+    0x77, 0x68, 0x93, 0x99, 0x59, 0x73, 0xcc, 0x79, 0x95, 0x78, 0x97, 0x89, 0x74, 0xaa, 0x89, 0xaa,
+    0x8c, 0xa9, 0xc8, 0xba, 0xa5, 0x57, 0x78, 0xc7, 0xbb, 0xe6, 0xc6, 0x9c, 0x86, 0xa4, 0xa8, 0x88,
+    0x7f, 0x96, 0x98, 0x99, 0x99, 0xdd, 0xdd, 0x89, 0x97, 0x8a, 0xbb, 0x85, 0x9a, 0x68, 0x8a, 0x9a,
+    0x86, 0x8a, 0x98, 0x78, 0x56, 0x95, 0x8b, 0x76, 0x78, 0xb7, 0x99, 0x55, 0xd7, 0xba, 0x79, 0x89,
+    0xc8, 0x48, 0xc9, 0x79, 0xb7, 0xc8, 0x96, 0xaa, 0x96, 0x89, 0xc7, 0x77, 0x78, 0x78, 0x85, 0x9b,
+    0x9a, 0xab, 0x9d, 0x6c, 0x74, 0x9c, 0xbb, 0x9b, 0x88, 0xa8, 0x87, 0xa9, 0x49, 0x77, 0x6a, 0x79,
+    0x77, 0x9a, 0x66, 0x86, 0x68, 0x78, 0x6a, 0x99, 0x99, 0xda, 0x69, 0x88, 0x88, 0x89, 0x87, 0xd5,
+    0x7b, 0xbd, 0x99, 0xeb, 0xb8, 0xac, 0xab, 0x8a, 0xb6, 0x9b, 0x68, 0xb9, 0x98, 0x67, 0x96, 0x69,
+    0xab, 0x86, 0x88, 0x8a, 0x88, 0x53, 0x8a, 0x98, 0x49, 0x9b, 0x55, 0xa6, 0xbb, 0x8b, 0x9b, 0x8a,
+    0xb8, 0xd9, 0xa8, 0xb8, 0xac, 0xb6, 0x69, 0xa8, 0x97, 0xa9, 0x98, 0x89, 0x79, 0x7b, 0x67, 0x88,
+    0x78, 0x49, 0x8e, 0xa6, 0xac, 0xa4, 0xa7, 0xeb, 0xcb, 0xa8, 0xcc, 0x3d, 0xaa, 0x88, 0x88, 0x85,
+    0x97, 0x88, 0x97, 0x89, 0x69, 0x79, 0x99, 0x27, 0xaa, 0x8b, 0x9a, 0x88, 0xa8, 0x48, 0x58, 0x48,
+    0x79, 0x8b, 0x87, 0xca, 0x96, 0xaa, 0x58, 0xc0, 0xb9, 0xd7, 0xc7, 0xbd, 0xcb, 0xb8, 0x85, 0x94,
+    0x98, 0x97, 0x24, 0xd7, 0x79, 0xb8, 0xe9, 0x9b, 0x58, 0x9b, 0xbb, 0x7b, 0xd6, 0xaa, 0xaa, 0x96,
+    0x7c, 0x7b, 0x77, 0xba, 0x8d, 0x6b, 0x25, 0x68, 0x97, 0xcc, 0x9b, 0x48, 0xb2, 0xab, 0x87, 0xb8,
+    0x89, 0x47, 0x8b, 0x53, 0x86, 0xb8, 0xc9, 0x9d, 0x78, 0x67, 0x44, 0x99, 0xd8, 0x9b, 0x59, 0x87,
+    0x97, 0x91, 0x77, 0x87, 0x98, 0x75, 0x65, 0x7c, 0xc8, 0xac, 0x87, 0xba, 0xbe, 0xa7, 0xa7, 0x59,
+    0xbb, 0x79, 0x94, 0x96, 0xcc, 0x9b, 0x79, 0x77, 0x67, 0x87, 0xb8, 0x49, 0xc4, 0x9a, 0xa4, 0xb9,
+    0xa8, 0xa5, 0xcd, 0x98, 0xba, 0xff, 0xac, 0x7b, 0x79, 0xce, 0x78, 0x96, 0xc6, 0x98, 0xa7, 0xa6,
+    0x57, 0x54, 0xb9, 0xac, 0xab, 0x79, 0x9b, 0xbb, 0xbb, 0x98, 0x96, 0xa6, 0x67, 0x8b, 0x86, 0xeb,
+    0xb9, 0x69, 0xb8, 0x87, 0xfc, 0xa7, 0xc7, 0x69, 0x7b, 0x2b, 0x87, 0x89, 0x9a, 0x96, 0x7c, 0xc7,
+    0x9a, 0x97, 0x68, 0x77, 0x6a, 0x37, 0x68, 0x86, 0xa9, 0x98, 0x87, 0x7a, 0x96, 0xa5, 0xc9, 0x8b,
+    0x97, 0xaa, 0xb9, 0x6c, 0x77, 0x97, 0x6a, 0x9a, 0x77, 0xa7, 0xb9, 0x9b, 0x6b, 0x64, 0xb7, 0x9b,
+    0x96, 0x66, 0xb9, 0x59, 0x77, 0x58, 0x5b, 0x49, 0x88, 0x8b, 0x88, 0x96, 0xa9, 0x59, 0x99, 0x89,
+    0x8c, 0x98, 0xba, 0x78, 0x9b, 0x9a, 0x8c, 0x77, 0x9a, 0xc8, 0x98, 0xa9, 0x88, 0x99, 0x58, 0xb4,
+    0x88, 0xc8, 0xa7, 0x68, 0x68, 0x56, 0x98, 0x99, 0xba, 0xc9, 0xc8, 0xa9, 0xcd, 0x8b, 0x79, 0xa7,
+    0x99, 0xaa, 0x6b, 0x9a, 0x9b, 0xa7, 0xd8, 0xb7, 0x96, 0x8e, 0x67, 0xcb, 0x67, 0x68, 0x5b, 0x86,
+    0x9a, 0x9a, 0x76, 0xb9, 0x79, 0x87, 0x98, 0x9b, 0x77, 0x76, 0x77, 0x59, 0x88, 0xba, 0x8a, 0xa9,
+    0xb8, 0x88, 0x99, 0xaa, 0x88, 0x6a, 0xa9, 0x8a, 0xa8, 0xca, 0x6a, 0x87, 0x98, 0x94, 0xb8, 0x4c,
+    0xc9, 0xbe, 0x2b, 0x82, 0x9b, 0xaa, 0x73, 0x79, 0x58, 0x37, 0x97, 0xc8, 0xaa, 0x9a, 0x86, 0x89,
+    0xa9, 0xa9, 0xb7, 0x6a, 0x9a, 0x87, 0x56, 0x96, 0xa9, 0x27, 0x74, 0x78, 0x65, 0x68, 0xa6, 0xab,
+    0x9b, 0x88, 0x88, 0x68, 0x82, 0x84, 0x88, 0x79, 0x98, 0xcb, 0x97, 0x9b, 0xaa, 0xb8, 0x9b, 0x98,
+    0xbb, 0x78, 0xa7, 0xb9, 0x89, 0x9a, 0x87, 0x97, 0x78, 0x88, 0xba, 0x9c, 0xb9, 0x99, 0xa7, 0x77,
+    0x98, 0xba, 0xba, 0x73, 0x77, 0x8a, 0x97, 0x99, 0x97, 0x98, 0x38, 0xb4, 0x8d, 0x79, 0x6b, 0xcb,
+    0x88, 0x9a, 0x53, 0xa9, 0x98, 0xbb, 0xa7, 0xbc, 0x8a, 0x99, 0x9b, 0xb9, 0x76, 0xc5, 0xdc, 0x55,
+    0x87, 0xa5, 0x98, 0xa8, 0x47, 0xb3, 0x69, 0xa7, 0x45, 0x97, 0x54, 0x65, 0x98, 0x98, 0x98, 0x99,
+    0x99, 0x89, 0xa9, 0x89, 0x99, 0x98, 0x98, 0x99, 0x98, 0xa8, 0x88, 0x99, 0x89, 0x79, 0x88, 0x98,
+    0x9a, 0x99, 0x99, 0x99, 0x99, 0x58, 0x58, 0xc8, 0x78, 0xab, 0x79, 0x9c, 0x99, 0x77, 0xb9, 0xd7,
+    0x98, 0xb8, 0xba, 0x78, 0x84, 0x7a, 0xa9, 0x9a, 0x98, 0x8a, 0x68, 0xb9, 0xb7, 0xba, 0x95, 0xdd,
+    0x89, 0x86, 0x77, 0xdb, 0x8c, 0xbb, 0x7b, 0x67, 0xbd, 0xcc, 0xba, 0x87, 0x7a, 0xab, 0x9a, 0x8a,
+    0x78, 0x55, 0x58, 0xa9, 0x99, 0x8a, 0x99, 0x88, 0x79, 0x99, 0x9a, 0x8a, 0xb8, 0xbb, 0x49, 0xbb,
+    0x94, 0xa9, 0xab, 0xb9, 0xe7, 0x8c, 0x7a, 0x85, 0x68, 0x87, 0x6a, 0x24, 0x87, 0x66, 0x88, 0x99,
+    0x9a, 0xaa, 0xa8, 0x8b, 0x7a, 0xa7, 0x79, 0x25, 0x84, 0xa8, 0x76, 0x66, 0x88, 0x77, 0x69, 0x97,
+    0x68, 0x46, 0xb2, 0x98, 0x8a, 0x67, 0x98, 0x98, 0x7a, 0x69, 0x87, 0x5b, 0x74, 0x95, 0xba, 0xaa,
+    0x8a, 0x9c, 0xe9, 0xbb, 0xaa, 0xa6, 0xde, 0x67, 0xb8, 0x94, 0x78, 0x96, 0x96, 0x85, 0xa7, 0x87,
+    0x89, 0x5c, 0x9a, 0x76, 0x79, 0xcb, 0x99, 0xba, 0x69, 0xa8, 0x9a, 0xaa, 0xaa, 0x97, 0x67, 0x78,
+    0xa5, 0xa7, 0xa9, 0x88, 0x89, 0xa9, 0xaa, 0xa7, 0xb7, 0x8a, 0x89, 0x9b, 0xba, 0x99, 0xca, 0x9c,
+    0x56, 0xa8, 0xd7, 0x69, 0xd5, 0xab, 0x78, 0x8b, 0x97, 0xb7, 0x36, 0xc5, 0x87, 0xb6, 0xa9, 0xa9,
+    0x97, 0xa8, 0xf9, 0x46, 0xd8, 0x8a, 0x78, 0x78, 0xbb, 0xb8, 0x9a, 0x57, 0xad, 0x8c, 0x4a, 0x9d,
+    0xb5, 0xba, 0x66, 0x75, 0xca, 0xb9, 0x76, 0xcc, 0x85, 0xb8, 0x9a, 0xa9, 0x89, 0x99, 0x89, 0x9a,
+    0x69, 0xa8, 0x68, 0x96, 0xab, 0xc9, 0xab, 0xd7, 0x77, 0x67, 0xb6, 0x4c, 0x77, 0x74, 0x98, 0xa5,
+    0x87, 0x88, 0x89, 0x88, 0x98, 0x62, 0x78, 0xb5, 0xbb, 0x69, 0x86, 0x97, 0x8a, 0x5a, 0x7a, 0x9a,
+    0x58, 0xa6, 0x59, 0x99, 0x9a, 0x6a, 0x87, 0xa9, 0xaa, 0xbb, 0x88, 0x85, 0xb9, 0x8b, 0x69, 0x88,
+    0x99, 0xb9, 0xa8, 0xc6, 0x87, 0x8a, 0x97, 0x5a, 0x77, 0x8a, 0x57, 0x68, 0xdb, 0xb9, 0x6a, 0xc8,
+    0xa8, 0x5d, 0x7a, 0x66, 0xcd, 0x97, 0xa6, 0x87, 0xca, 0x9b, 0x9a, 0x8c, 0x67, 0xa8, 0xab, 0x86,
+    0xa8, 0xaa, 0x87, 0x7a, 0xa6, 0xa9, 0x67, 0x77, 0xc9, 0x99, 0x8a, 0x99, 0x88, 0x69, 0x99, 0x55,
+    0x86, 0xab, 0x89, 0x73, 0xa9, 0x97, 0x66, 0xa8, 0x99, 0x87, 0xb8, 0x75, 0x6a, 0x7a, 0x98, 0x89,
+    0xaa, 0xaa, 0xaa, 0x99, 0x4a, 0x95, 0x87, 0xa8, 0xca, 0x99, 0x87, 0xb6, 0x87, 0x76, 0x98, 0x7c,
+    0xaa, 0x5d, 0xcc, 0x98, 0x74, 0x97, 0x66, 0xb7, 0xb8, 0x67, 0x59, 0x8c, 0xaa, 0xb9, 0x98, 0xa8,
+    0x49, 0x97, 0xba, 0x6c, 0x65, 0x68, 0xa8, 0x04, 0x87, 0x99, 0x5b, 0x94, 0x58, 0x7a, 0x67, 0x9a,
+    0x99, 0xa9, 0x9a, 0x9a, 0x9b, 0x88, 0x88, 0xa6, 0x77, 0x99, 0xb9, 0x8a, 0xcd, 0x8a, 0xba, 0xde,
+    0xbb, 0xdb, 0x69, 0x8a, 0xa8, 0x7a, 0x68, 0x9b, 0x97, 0x97, 0x99, 0x76, 0x98, 0x98, 0x8a, 0x8b,
+    0x7c, 0x99, 0xc7, 0xaa, 0xa8, 0x57, 0x8b, 0x88, 0x89, 0x75, 0x78, 0x98, 0x5d, 0x97, 0x89, 0xc9,
+    0x76, 0x7b, 0x79, 0x59, 0xab, 0x96, 0xc4, 0x8b, 0x8c, 0x96, 0x77, 0x8a, 0xa5, 0x7b, 0xb8, 0xac,
+    0xac, 0x8b, 0xcd, 0x6b, 0x77, 0xab, 0xc6, 0x9b, 0xa9, 0x97, 0x66, 0x67, 0xaa, 0x77, 0x69, 0xba,
+    0x7b, 0x95, 0xc9, 0xa8, 0x99, 0x88, 0x6a, 0xba, 0x98, 0xa7, 0x9a, 0xc7, 0x96, 0x7a, 0x77, 0x56,
+    0xa7, 0xa8, 0x8c, 0x88, 0x89, 0x3d, 0x88, 0x68, 0xa9, 0x99, 0x98, 0x5c, 0x89, 0x89, 0x56, 0x97,
+    0x89, 0x48, 0xd8, 0xbb, 0x99, 0xa8, 0x68, 0x88, 0x48, 0x76, 0x99, 0x8a, 0x9c, 0x9a, 0xa9, 0xa9,
+    0x8c, 0x75, 0x69, 0x96, 0x79, 0x9a, 0xab, 0x88, 0x97, 0x8d, 0x89, 0x9b, 0x9a, 0x99, 0xba, 0x49,
+    0x79, 0x88, 0x87, 0x88, 0x58, 0xb6, 0x99, 0x98, 0x8c, 0x8b, 0xc9, 0x86, 0x79, 0x9a, 0xd7, 0x89,
+    0x79, 0xb8, 0xd6, 0xcb, 0x48, 0x7b, 0x89, 0x68, 0xb8, 0xb6, 0xa8, 0xb7, 0x87, 0x7a, 0xdb, 0x6d,
+    0x59, 0x89, 0x59, 0x5a, 0x9a, 0x78, 0x73, 0xb9, 0x6a, 0x47, 0xa8, 0x99, 0x67, 0x77, 0x68, 0x88,
+    0x8a, 0x98, 0xb8, 0xbb, 0x8d, 0x99, 0xaa, 0x6a, 0x88, 0x75, 0x77, 0x66, 0x68, 0x42, 0xaa, 0x78,
+    0x77, 0xab, 0x79, 0x87, 0xa9, 0xb8, 0x78, 0xbb, 0xa7, 0x7a, 0x78, 0xa7, 0x98, 0x89, 0xda, 0x9d,
+    0x5d, 0x59, 0x9c, 0x7b, 0x68, 0x9d, 0x89, 0xca, 0x78, 0xcb, 0x9b, 0x46, 0xb7, 0x78, 0xa8, 0xa6,
+    0x59, 0x97, 0xb5, 0xbc, 0x77, 0xda, 0x7f, 0x94, 0xdb, 0x97, 0x58, 0xa7, 0x39, 0x79, 0x20, 0x88,
+    0x97, 0x67, 0x97, 0x89, 0xa9, 0xac, 0xab, 0x97, 0xbc, 0x9c, 0x8b, 0xc8, 0xcc, 0x99, 0x98, 0xdb,
+    0xaa, 0x39, 0x88, 0xb6, 0x96, 0x67, 0xaa, 0x9b, 0x49, 0xa9, 0xab, 0x3a, 0xa6, 0x3a, 0xca, 0xc6,
+    0x29, 0x96, 0x7a, 0x7f, 0xa8, 0x79, 0xde, 0xbc, 0x59, 0x45, 0x89, 0x88, 0x88, 0x79, 0x95, 0xaa,
+    0x9a, 0x49, 0x54, 0x88, 0xa6, 0x6d, 0xb7, 0x87, 0x83, 0xa8, 0x3b, 0xb7, 0xba, 0xdc, 0x67, 0xab,
+    0x5d, 0x7e, 0xb7, 0x88, 0x88, 0x98, 0x49, 0xb4, 0xaa, 0x7c, 0x87, 0xab, 0x86, 0x98, 0x99, 0x6a,
+    0x78, 0xa6, 0xbb, 0x68, 0x73, 0x97, 0x69, 0xa9, 0x89, 0x88, 0x79, 0x98, 0x97, 0x9a, 0x49, 0x77,
+    0x93, 0xab, 0x69, 0x55, 0x94, 0xb9, 0x8d, 0x65, 0x97, 0xa9, 0x99, 0x66, 0xa6, 0xab, 0x6a, 0x88,
+    0xaa, 0xbb, 0xbd, 0x8c, 0x8a, 0x7a, 0x86, 0x89, 0x7c, 0xba, 0xa7, 0x5b, 0x96, 0x68, 0x85, 0xa5,
+    0xa7, 0x94, 0xa7, 0x77, 0xba, 0x7e, 0xc9, 0xab, 0x78, 0x8d, 0x8c, 0xac, 0x9b, 0x98, 0x89, 0x99,
+    0x89, 0x88, 0x89, 0x88, 0x89, 0x99, 0x88, 0x89, 0x88, 0x89, 0x98, 0x88, 0x87, 0x87, 0x99, 0x88,
+    0x88, 0x98, 0x88, 0x99, 0x99, 0x99, 0x87, 0x98, 0x4a, 0xa7, 0x9a, 0x79, 0x77, 0x76, 0xb9, 0x9c,
+    0x87, 0x7d, 0x7a, 0xa5, 0xbc, 0xa6, 0x82, 0xa9, 0x76, 0xc6, 0xab, 0x5a, 0xb8, 0x88, 0x96, 0x72,
+    0x98, 0x57, 0x62, 0x9a, 0x98, 0xa9, 0x88, 0xb6, 0xac, 0xac, 0x77, 0x78, 0xb9, 0x88, 0x85, 0x99,
+    0x8a, 0xb9, 0xd8, 0x6b, 0x89, 0xcb, 0x78, 0x89, 0x95, 0x73, 0xbb, 0x9a, 0x65, 0xa8, 0x98, 0x66,
+    0xad, 0x5c, 0x78, 0x57, 0x44, 0xa7, 0x99, 0x7c, 0xca, 0x9b, 0x99, 0xbb, 0x89, 0x3b, 0x97, 0x89,
+    0xa8, 0x98, 0x98, 0x77, 0x86, 0x99, 0x57, 0x96, 0x96, 0xb9, 0x59, 0x9d, 0x99, 0x9b, 0x96, 0x98,
+    0xb9, 0xab, 0x7c, 0xa8, 0xa9, 0x99, 0x99, 0x88, 0x77, 0x76, 0x87, 0xc6, 0x6b, 0x6a, 0xa7, 0x6a,
+    0xb8, 0x79, 0x8d, 0x97, 0x79, 0x85, 0x95, 0x89, 0x37, 0x9a, 0xb9, 0x68, 0x79, 0x9b, 0xaa, 0x99,
+    0xb7, 0x77, 0x87, 0x85, 0x76, 0x67, 0xa7, 0xca, 0xbd, 0x8c, 0xca, 0x8b, 0x57, 0x59, 0x9a, 0x64,
+    0x8a, 0x8b, 0x78, 0x97, 0xd9, 0x9a, 0x88, 0x9c, 0x58, 0x9a, 0x79, 0x83, 0xbb, 0x6b, 0xa6, 0x8b,
+    0x8a, 0x6a, 0x5c, 0x46, 0x69, 0x89, 0x98, 0x8b, 0x6d, 0xbb, 0x99, 0x8b, 0x88, 0xbe, 0x6a, 0x77,
+    0x9a, 0x79, 0xa5, 0x83, 0x68, 0x8b, 0x97, 0x89, 0x99, 0xb7, 0x77, 0xb9, 0xaa, 0xa7, 0x52, 0x58,
+    0x8a, 0x8d, 0x76, 0xa9, 0x6a, 0xa3, 0xaa, 0xa8, 0x9e, 0x58, 0x8a, 0x87, 0x77, 0xa9, 0xbb, 0x68,
+    0xb9, 0x9b, 0x86, 0x6a, 0x67, 0xba, 0x58, 0x36, 0x6a, 0x4b, 0xad, 0xcc, 0x8b, 0xa6, 0x9c, 0x5c,
+    0x75, 0x99, 0x99, 0x98, 0x99, 0x29, 0x76, 0x3c, 0x87, 0xa6, 0x8a, 0x97, 0xa8, 0xdc, 0x57, 0xab,
+    0xdb, 0x6b, 0x82, 0xa5, 0x79, 0x97, 0x97, 0x77, 0x88, 0xc9, 0x8a, 0x6a, 0x72, 0x8a, 0x86, 0x97,
+    0x78, 0xab, 0xb8, 0xa7, 0xab, 0xaa, 0x77, 0xa4, 0xa6, 0xb6, 0x57, 0x67, 0xa7, 0x9a, 0xeb, 0xca,
+    0xab, 0xd9, 0x97, 0x44, 0x36, 0x94, 0x98, 0x63, 0x76, 0x78, 0xca, 0x7a, 0xdb, 0x9d, 0x99, 0x5c,
+    0x3a, 0xb7, 0xa9, 0x9a, 0x97, 0xa7, 0xb9, 0xdc, 0x79, 0xaa, 0xcb, 0x99, 0x99, 0x9a, 0x9a, 0xd9,
+    0x67, 0x63, 0x6a, 0x47, 0x58, 0xb7, 0x93, 0xda, 0x9c, 0xb8, 0xc9, 0x7a, 0x77, 0xa9, 0xaa, 0xa7,
+    0x87, 0x98, 0x79, 0x99, 0x39, 0x49, 0x76, 0xa8, 0x9c, 0x57, 0x7a, 0x9c, 0x88, 0x7a, 0x9b, 0x57,
+    0x8d, 0x48, 0x58, 0xa9, 0x88, 0x73, 0x78, 0x78, 0x78, 0xc7, 0x5a, 0xa6, 0x99, 0x79, 0xa8, 0x89,
+    0xe7, 0x9e, 0x96, 0x68, 0x74, 0x9b, 0x9a, 0x46, 0x78, 0xba, 0x99, 0xd7, 0x79, 0x77, 0xab, 0x79,
+    0xa9, 0x97, 0x89, 0x99, 0x88, 0xa7, 0x98, 0x4b, 0x83, 0xc8, 0xaa, 0x78, 0x67, 0xb8, 0x89, 0xa8,
+    0x6a, 0x55, 0x97, 0xc6, 0x76, 0x99, 0xc5, 0xa9, 0x9a, 0x7c, 0xa7, 0xba, 0x8b, 0x7a, 0x86, 0x72,
+    0x6a, 0x9a, 0x59, 0x76, 0xaa, 0x6c, 0x65, 0xab, 0x98, 0x67, 0xaa, 0xa9, 0x94, 0x87, 0x68, 0x69,
+    0x9a, 0x79, 0x9a, 0xda, 0x88, 0x99, 0x28, 0xc6, 0x97, 0x96, 0xaa, 0xcc, 0x8c, 0xb7, 0x9c, 0x56,
+    0x88, 0xa9, 0xc5, 0x76, 0xc9, 0x38, 0x75, 0x98, 0x88, 0x6a, 0xd9, 0x7a, 0x99, 0x5c, 0x89, 0xc2,
+    0x45, 0x7c, 0xa8, 0x8a, 0x59, 0x8a, 0xa8, 0x48, 0x74, 0x7a, 0x9a, 0x2d, 0x6a, 0x97, 0xc9, 0x9a,
+    0x9a, 0x88, 0x97, 0x8b, 0xab, 0xd9, 0xa5, 0xaa, 0x78, 0xaa, 0x89, 0x62, 0x66, 0x96, 0x88, 0x86,
+    0xba, 0x88, 0x75, 0x9c, 0x89, 0x22, 0x96, 0x89, 0x89, 0x8b, 0xba, 0x9b, 0x9b, 0x99, 0x58, 0x79,
+    0xcb, 0x6c, 0x38, 0x9b, 0xab, 0x84, 0xa8, 0x9a, 0x99, 0x87, 0x8a, 0xaa, 0x86, 0xc6, 0x56, 0x78,
+    0xa8, 0x89, 0x87, 0x9c, 0x79, 0x9c, 0x7c, 0x99, 0xb4, 0xa5, 0x85, 0xb7, 0x88, 0x67, 0xa8, 0x99,
+    0x89, 0xb9, 0xa8, 0xca, 0xca, 0x48, 0x89, 0xb6, 0x99, 0x87, 0x78, 0x9a, 0xab, 0xab, 0x7c, 0x8b,
+};
+
+static const float mnist_cnn_layer4_codebook[16] = {
+    -0.737806439f, -0.61060828f, -0.482402086f, -0.379832536f,
+    -0.29049322f, -0.219118789f, -0.154257283f, -0.0916610733f,
+    -0.0357903168f, 0.011529847f, 0.0633122846f, 0.116359025f,
+    0.175842628f, 0.245922238f, 0.332888275f, 0.45571056f,
+};
+
+// One entry per layer; pooling layers have none
+static const SNNCodebookWeights mnist_cnn_codebook[5] = {
+    { mnist_cnn_layer0_indices, mnist_cnn_layer0_codebook },
+    { NULL, NULL },
+    { mnist_cnn_layer2_indices, mnist_cnn_layer2_codebook },
+    { NULL, NULL },
+    { mnist_cnn_layer4_indices, mnist_cnn_layer4_codebook },
+};
+
+#endif // MNIST_CNN_CODEBOOK_H
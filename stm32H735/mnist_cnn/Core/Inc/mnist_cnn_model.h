@@ -0,0 +1,9 @@
+#ifndef MNIST_CNN_MODEL_H
+#define MNIST_CNN_MODEL_H
+
+#include "snn_network.h"
+
+// conv1 -> ReLU -> pool -> conv2 -> ReLU -> pool -> fc1 -> ReLU
+extern const SNNNetwork mnist_cnn_network;
+
+#endif // MNIST_CNN_MODEL_H
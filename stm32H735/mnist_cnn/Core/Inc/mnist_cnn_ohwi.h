@@ -0,0 +1,1172 @@
+// Generated by snn_core/Tools/snn_ohwi from the mnist_cnn weights.
+// Regenerate with the snn_ohwi_headers target after retraining the model.
+#ifndef MNIST_CNN_OHWI_H
+#define MNIST_CNN_OHWI_H
+
+#include <stddef.h>
+
+static const float mnist_cnn_layer2_ohwi[4608] = {
+    -0.0497324876f, -0.264075726f, -0.15827322f, 0.180366218f,
+    -0.0289900247f, 0.126112878f, -0.294056028f, -0.269568235f,
+    -0.0467866659f, -0.330099463f, -0.251484245f, -0.015950121f,
+    -0.157200918f, -0.12913762f, 0.0426653475f, -0.404817253f,
+    -0.120332144f, -0.242980644f, -0.148971438f, 0.105892353f,
+    -0.0370962285f, 0.220971346f, -0.0530452542f, -0.309053928f,
+    -0.0569706559f, 0.0374720916f, -0.0366488323f, 0.265992612f,
+    0.195884809f, 0.0115316892f, -0.179348111f, -0.13285704f,
+    0.127040729f, 0.145848647f, 0.0729477182f, 0.575733125f,
+    -0.179562524f, -0.0311916843f, 0.23382014f, -0.559721291f,
+    -0.0315615237f, 0.0300194807f, 0.207276061f, -0.0139627056f,
+    0.0974993482f, 0.088333264f, -0.158033982f, 0.240795627f,
+    -0.467228413f, -0.0458482541f, -0.335463643f, -0.0224958304f,
+    -0.129832685f, -0.0539746433f, -0.24967818f, -0.279795438f,
+    0.0320439637f, -0.327764422f, -0.506738245f, -0.0387440398f,
+    -0.200178608f, -0.218071327f, 0.222311288f, -0.368650109f,
+    -0.12729609f, -0.354157358f, -0.126633748f, 0.138825223f,
+    0.207461044f, 0.0884400159f, 0.138629004f, -0.738668025f,
+    0.0694340691f, 0.173335463f, 0.0129514188f, 0.290076762f,
+    0.157016113f, 0.0437487923f, -0.134412885f, -0.235086456f,
+    0.188357353f, 0.309316605f, -0.0154694552f, 0.520971f,
+    -0.109353945f, -0.240746066f, 0.112907976f, -0.500322521f,
+    -0.0264849178f, 0.165226251f, 0.174615085f, -0.0243529733f,
+    0.0989492759f, 0.124344677f, -0.0478909947f, 0.305659562f,
+    -0.241732985f, 0.181574494f, -0.168295175f, -0.211827591f,
+    -0.0476377867f, -0.0157575756f, -0.0799234137f, -0.404885799f,
+    -0.0541873202f, 0.00201168144f, -0.118621968f, 0.0321649797f,
+    -0.0803020373f, 0.0198429544f, 0.1326074f, -0.0771598369f,
+    0.0019830626f, -0.139860019f, -0.11652112f, 0.157086864f,
+    -0.11282137f, -0.111647218f, -0.0480186678f, -0.78445071f,
+    -0.0496127605f, 0.129950568f, -0.0619051345f, 0.0497152694f,
+    0.000380722428f, 0.120433941f, -0.176763847f, -0.0278673433f,
+    0.034130916f, 0.285768062f, -0.0403201394f, 0.356391728f,
+    -0.306730986f, -0.319629639f, 0.150676936f, -0.395241767f,
+    -0.00841799378f, 0.0612178557f, 0.0451073945f, -0.0537600107f,
+    0.0431862175f, 0.0617735349f, 0.232354149f, 0.102822751f,
+    -0.133224607f, -0.398358673f, -0.21847178f, 0.146595463f,
+    0.148891419f, -0.0726558268f, -0.031167727f, -0.784155428f,
+    -0.0268963985f, 0.0103736306f, -0.095625639f, 0.11832194f,
+    0.10261368f, 0.0514241681f, -0.177080691f, -0.214189649f,
+    0.178166524f, 0.067723088f, 0.116189934f, 0.185503602f,
+    -0.267356187f, -0.255103886f, 0.145022139f, -0.206842244f,
+    -0.0466462001f, 0.142697051f, 0.173043951f, 0.00235622376f,
+    0.109635465f, 0.117086127f, -0.0230698194f, -0.0755224824f,
+    -0.0572692752f, 0.191945955f, 0.0988743827f, 0.210108221f,
+    -0.0990549177f, -0.202293307f, 0.0606071018f, -0.21364744f,
+    0.0346930921f, -0.130960226f, -0.087018244f, -0.103014931f,
+    -0.194776714f, -0.135418057f, 0.0617383942f, 0.012847309f,
+    -0.0301723927f, -0.246010244f, -0.0465032123f, 0.178342f,
+    0.330203742f, 0.0732829869f, 0.173438489f, -0.568066716f,
+    0.0826857388f, 0.0244476683f, -0.070860602f, 0.286095768f,
+    0.0606827661f, -0.00046682902f, 0.0182515774f, -0.00197397242f,
+    0.222692028f, 0.307301104f, 0.0407435112f, 0.154775992f,
+    -0.337648869f, -0.502499282f, 0.223259002f, -0.609384358f,
+    -0.0302412622f, 0.0565404408f, 0.0710345134f, -0.0908885971f,
+    0.134440929f, 0.0263242144f, 0.168654561f, 0.221245721f,
+    -0.0258464105f, 0.133809268f, -0.202891827f, 0.220472127f,
+    -0.311692923f, -0.320325583f, -0.0242994018f, -0.452418208f,
+    -0.0510158949f, -0.22096546f, -0.0336705334f, -0.109978229f,
+    -0.293893754f, -0.207574621f, 0.0797255412f, -0.0905464366f,
+    -0.247903705f, -0.132539511f, 0.0546540543f, -0.353623837f,
+    0.128463447f, 0.0659677684f, 0.00511684502f, -0.479123473f,
+    0.0698022246f, 0.0974490494f, -0.0263669621f, 0.186419189f,
+    0.0248075165f, 0.0420240201f, 0.134227306f, -0.193552986f,
+    0.0510352477f, 0.237856328f, 0.0185065567f, 0.045500163f,
+    0.170948461f, 0.076812245f, 0.0815615132f, -0.0146520184f,
+    0.0172213912f, 0.12423379f, -0.00426622946f, 0.00442772731f,
+    0.0940069556f, -0.0720994323f, -0.20978041f, 0.137167886f,
+    -0.02092731f, 0.00635633944f, -0.0638284609f, 0.0223839656f,
+    -0.145383701f, -0.0469381809f, -0.0465317219f, 0.196550891f,
+    -0.0621240735f, -0.062846683f, -0.10065183f, -0.282308877f,
+    -0.0292522833f, -0.104242615f, -0.235632509f, 0.00198534946f,
+    0.0605563633f, 0.227624968f, -0.15464443f, 0.325352639f,
+    0.288277626f, 0.0598094799f, 0.188793138f, -0.590812385f,
+    -0.0741995797f, 0.0938610882f, 0.00181318272f, -0.0435036831f,
+    0.0605351292f, -0.0420497991f, -0.0164493658f, 0.113204569f,
+    0.216584668f, 0.354318261f, -0.0249153264f, 0.267630249f,
+    -0.0941981599f, -0.0772592798f, -0.0574069507f, -0.380493879f,
+    -0.00458336901f, -0.140362978f, 0.0187506825f, -0.0721621588f,
+    -0.215253428f, -0.0243900567f, 0.0105211297f, 0.19961679f,
+    -0.0895928517f, -0.139503658f, -0.145192474f, -0.0156647135f,
+    0.397479922f, 0.0365383886f, -0.185564205f, 0.0438855849f,
+    0.0353992209f, -0.0764798447f, -0.140204147f, -0.0930819362f,
+    -0.292134911f, -0.300578684f, 0.0581145212f, -0.115554467f,
+    -0.366567314f, 0.0519019663f, 0.0629733652f, -0.484089047f,
+    0.610689044f, 0.156402513f, 0.14725481f, 0.0705914274f,
+    -0.0746095181f, -0.153919548f, -0.117477849f, 0.173097163f,
+    0.00517684128f, -0.0806042552f, 0.0818857402f, 0.0687011331f,
+    -0.0455750264f, 0.450891942f, -0.118736625f, -0.0196491387f,
+    0.170738906f, -0.0685307831f, 0.170066819f, 0.102664515f,
+    -0.0465438664f, 0.114589259f, -0.0885972902f, 0.057027299f,
+    0.0661030263f, -0.0658194125f, 0.340921342f, 0.292919606f,
+    -0.035604313f, 0.230907351f, -0.0928557441f, -0.000655064883f,
+    0.0526484884f, -0.298297942f, -0.0662047267f, 0.116386309f,
+    -0.0442924909f, 0.140493751f, -0.0877095982f, 0.0936113521f,
+    -0.0488673225f, 0.0246619582f, -0.603505194f, 0.248078898f,
+    -0.0685553178f, -0.434660852f, -0.184181318f, -0.44168672f,
+    -0.116216317f, -0.247747421f, -0.186877474f, 0.0145836528f,
+    0.0581594035f, 0.00768921757f, -0.0775673836f, -0.121977232f,
+    0.0183578357f, 0.0528376475f, -0.0265612323f, -0.263141215f,
+    0.012884194f, 0.18103753f, 0.0852344185f, -0.276341081f,
+    0.251839429f, 0.0811208859f, 0.0876872241f, 0.265908301f,
+    -0.0420239493f, 0.0491132401f, 0.165180564f, -0.0581463687f,
+    -0.021205008f, -0.121264406f, -0.180944458f, 0.232736066f,
+    0.0960733294f, -0.00732423691f, 0.212052107f, -0.0348741747f,
+    0.186063185f, 0.0993135944f, 0.0194039699f, 0.469991505f,
+    0.0733354315f, 0.0240100119f, 0.12338236f, -0.0413466431f,
+    -0.0531360283f, 0.0328054838f, -0.171742097f, 0.0517227575f,
+    -0.0291508976f, -0.444288462f, -0.0683185682f, 0.127175197f,
+    -0.0953290984f, -0.15445213f, 0.0989400372f, -0.552915633f,
+    0.0202456228f, 0.258942544f, 0.150445729f, 0.166549817f,
+    0.197455615f, 0.172849476f, -0.262812406f, -0.171890363f,
+    0.197380513f, 0.17128031f, 0.0965259299f, 0.41121611f,
+    -0.455668539f, -0.170126215f, 0.18355f, -0.0596202277f,
+    0.0509523377f, 0.116752863f, 0.278144807f, -0.0124828275f,
+    0.154567644f, 0.15657036f, -0.00931568164f, 0.104379095f,
+    0.104028471f, 0.167074397f, 0.0259008538f, 0.254468739f,
+    -0.263190389f, -0.239502743f, -0.0227052122f, -0.281571627f,
+    -0.0154868765f, -0.382242113f, -0.0685205981f, -0.44631508f,
+    -0.438604474f, -0.18422097f, 0.112259485f, -0.0193572585f,
+    0.225330681f, -0.304154932f, -0.0357577503f, 0.318251252f,
+    -0.373785466f, -0.325156748f, 0.117201217f, -0.517679691f,
+    -0.00145939994f, 0.252916455f, 0.105820261f, 0.100027852f,
+    0.108248398f, 0.200168326f, -0.349422067f, -0.149689913f,
+    0.162158638f, 0.158072785f, 0.122924037f, 0.499233872f,
+    -0.650377274f, -0.462256521f, 0.128846779f, -0.393883049f,
+    0.0322639756f, 0.129884198f, 0.146573722f, -0.176124632f,
+    0.03931861f, 0.0139511963f, -0.100132614f, 0.102041021f,
+    -0.372681141f, -0.194467321f, -0.302429885f, -0.0488098823f,
+    -0.573975146f, -0.105804235f, -0.288168162f, -0.372698456f,
+    -0.0320715718f, -0.232741982f, -0.294728369f, -0.307780504f,
+    -0.417345703f, -0.207950607f, 0.0020695189f, -0.292452842f,
+    -0.0368152708f, 0.117290862f, 0.0432613343f, 0.330773622f,
+    -0.355126679f, -0.388317823f, 0.0867514983f, -0.284661591f,
+    -0.00766775012f, 0.163409382f, 0.104992196f, -0.0729172677f,
+    0.155942917f, 0.0787386447f, -0.0645200163f, 0.0301120691f,
+    0.0346810035f, 0.0944069549f, -0.0936294794f, 0.290323734f,
+    -0.507704854f, -0.20054996f, 0.0827822983f, 0.0610797629f,
+    -0.0617057383f, -0.0283324979f, 0.0343538597f, -0.19299753f,
+    0.0761091635f, -0.081119746f, -0.348071963f, 0.0675887465f,
+    -0.204460829f, 0.0428718366f, -0.136001006f, -0.362486333f,
+    0.0704078153f, 0.254133791f, -0.0961816236f, 0.230211496f,
+    0.010311137f, 0.143524647f, -0.121203445f, -0.182482734f,
+    0.0270939358f, -0.0785682872f, -0.226360142f, 0.127604634f,
+    -0.356657118f, -0.278133929f, -0.188363761f, -0.655180097f,
+    -0.225392431f, -0.131945983f, -0.36543262f, 0.209312841f,
+    0.00326929498f, -0.203339681f, -0.258394212f, -0.478900313f,
+    -0.422628969f, -0.197002262f, 0.0399727225f, -0.196103856f,
+    -0.415580571f, -0.0359025672f, -0.16493243f, -0.391235232f,
+    -0.0380208269f, -0.330712229f, -0.0598598048f, 0.372845918f,
+    -0.0424300246f, -0.161447302f, -0.494649887f, -0.366074324f,
+    -0.195364058f, -0.0707562938f, 0.052095782f, 0.015838176f,
+    -0.221775115f, -0.307728946f, -0.0951369479f, -0.570717514f,
+    -0.596078217f, -0.110534362f, -0.099920854f, -0.122456498f,
+    0.0528588891f, 0.057316374f, -0.258008152f, 0.232528493f,
+    0.0904685482f, 0.0210244078f, -0.35438177f, -0.0554586761f,
+    -0.317556053f, -0.266484171f, -0.0726827979f, -0.802427351f,
+    -0.20081003f, 0.0676122457f, -0.081779331f, -0.131412104f,
+    0.0383740664f, -0.165158078f, -0.332624346f, 0.167231053f,
+    0.013272292f, -0.122968316f, 0.0150127085f, -0.130709738f,
+    0.331691265f, -0.182879537f, -0.104153499f, -0.414835185f,
+    -0.217822313f, 0.0500057079f, 0.153845876f, -0.243374243f,
+    -0.0106152296f, 0.274919838f, 0.228394076f, -0.0987283736f,
+    0.146798491f, 0.261799961f, -0.122404553f, 0.168708101f,
+    0.35530591f, -0.399963975f, 0.269279003f, -0.109872982f,
+    -0.218005717f, 0.255369246f, -0.0798207223f, 0.593328953f,
+    0.0460762084f, 0.302860081f, 0.366806477f, 0.198725164f,
+    0.135283858f, 0.275255561f, -0.378199548f, -0.26056096f,
+    0.47337231f, -0.09135627f, 0.136533678f, 0.0781840757f,
+    -0.742289662f, -0.169799313f, 0.0823702961f, 0.111350186f,
+    -0.0791187733f, 0.328516662f, 0.296824396f, -0.00661364757f,
+    0.131556824f, 0.262841284f, -0.286653191f, 0.176632851f,
+    0.0821858123f, -0.2079923f, 0.171867475f, 0.098330155f,
+    -0.192075506f, -0.153793409f, 0.0764537975f, 0.130080417f,
+    -0.0342972279f, 0.110088579f, 0.225413799f, 0.154887408f,
+    0.0669928864f, 0.115053385f, -0.0158275235f, -0.0566748902f,
+    0.0825176239f, -0.312829852f, 0.020183865f, 0.194471538f,
+    -0.624663532f, -0.336975724f, 0.0153307142f, 0.102492712f,
+    0.0660141632f, -0.111542709f, 0.147690296f, -0.2235277f,
+    -0.255680889f, 0.0291841049f, -0.00699894456f, -0.169794336f,
+    -0.357620239f, -0.480362415f, -0.0179840736f, -0.692615032f,
+    -0.109937765f, 0.128762066f, -0.404378414f, 0.344088078f,
+    -0.0718252808f, -0.177660048f, -0.374755353f, -0.122708268f,
+    -0.361366302f, -0.312476128f, -0.0928309783f, -0.355134517f,
+    -0.252709597f, -0.100522734f, -0.0111853909f, -0.514059842f,
+    0.163743943f, 0.161434576f, -0.210577011f, 0.157332495f,
+    -0.00357150054f, -0.315453976f, -0.16755636f, -0.259148359f,
+    -0.330153614f, -0.211410761f, -0.0688550547f, -0.205833852f,
+    -0.170201302f, -0.441842616f, 0.278255194f, -0.543197632f,
+    0.165993735f, 0.442601204f, -0.343967706f, 0.454274774f,
+    -0.0576385856f, -0.289639264f, 0.0386451147f, 0.0929263979f,
+    -0.195440635f, -0.129611045f, 0.0509071164f, -0.55316335f,
+    0.137056857f, 0.224393457f, -0.0733290911f, -0.194102913f,
+    -0.268644661f, -0.274321586f, 0.143479362f, -0.223920107f,
+    0.0146797504f, 0.191540942f, 0.128210217f, -0.0797716826f,
+    0.0710893571f, 0.117048711f, -0.0814993903f, 0.209168449f,
+    -0.0727224275f, 0.104450069f, -0.202324867f, -0.229329109f,
+    0.261532038f, 0.132837221f, -0.00785445701f, -0.152914196f,
+    -0.0685103983f, -0.0542308018f, -0.0298188888f, -0.166637585f,
+    0.028775584f, -0.0889678448f, -0.0600928441f, 0.173756033f,
+    -0.381814033f, 0.437856406f, -0.56385988f, -0.71404022f,
+    -0.213114068f, -0.0742697641f, -0.248137563f, -0.0924613103f,
+    0.069989413f, -0.111463852f, -0.404922485f, -0.17607066f,
+    -0.248180017f, -0.243011102f, 0.160816729f, 0.155211627f,
+    0.265923947f, 0.253409743f, 0.0716865137f, 0.173341677f,
+    0.126121193f, -0.0534802042f, 0.0830535144f, 0.0240074899f,
+    0.0717512891f, 0.151616588f, 0.243805245f, 0.201783344f,
+    0.086594902f, 0.0577758849f, -0.116537474f, 0.140779585f,
+    0.10383407f, 0.398786098f, 0.108224109f, -0.216690615f,
+    0.347592771f, 0.0832216516f, 0.0970394313f, 0.0318432376f,
+    -0.0106748743f, 0.0760905072f, 0.0299829766f, 0.00372017943f,
+    0.052350644f, -0.0399590731f, -0.00507553201f, 0.309179872f,
+    -0.0516252518f, 0.646667123f, 0.149384141f, -0.514225364f,
+    0.370310247f, 0.0308919474f, 0.19712095f, 0.0457085669f,
+    0.0183434486f, -0.059084557f, 0.0823242515f, -0.0447760411f,
+    0.16198504f, -0.0668938011f, 0.131115004f, 0.446400762f,
+    0.201772735f, 0.182785511f, 0.137371331f, -0.230299115f,
+    -0.0770459846f, -0.166622758f, 0.187246189f, 0.0615301915f,
+    -0.0722282678f, 0.135838494f, 0.0870585218f, -0.12836197f,
+    0.0105131529f, 0.139388382f, -0.368685991f, 0.232763767f,
+    0.0319298357f, 0.0870885104f, -0.0359392166f, -0.396589041f,
+    -0.255395204f, -0.0930327848f, -0.00821119547f, -0.04943005f,
+    -0.0713592619f, -0.0290359072f, -0.045094084f, 0.126272574f,
+    0.0390956365f, 0.0400732644f, 0.126749754f, 0.169465244f,
+    0.137787014f, 0.0497425348f, 0.0104252119f, -0.150743142f,
+    -0.0214069672f, -0.00256507052f, 0.0396847799f, 0.109671846f,
+    0.0398752689f, -0.00767418183f, -0.0590035766f, 0.0973747671f,
+    -0.00445522321f, 0.00682018697f, -0.206177756f, 0.0408432856f,
+    -0.011679152f, -0.193421587f, 0.296285123f, -0.158866093f,
+    0.277446121f, 0.163798824f, 0.0609083213f, 0.419542998f,
+    0.0354119651f, -0.123682864f, 0.137251392f, 0.0454841815f,
+    -0.00324256229f, -0.106209941f, -0.286470085f, 0.0137165673f,
+    0.0986688286f, -0.0729805455f, 0.254988045f, -0.297933757f,
+    0.360017329f, 0.197726116f, -0.0728620514f, 0.348580569f,
+    0.0384411439f, -0.148356378f, 0.104796804f, 0.137155831f,
+    -0.147752091f, -0.129645228f, 0.090117611f, 0.0971108824f,
+    -0.0320628993f, 0.110614382f, -0.00638239365f, -0.183745682f,
+    0.292837381f, 0.100494191f, -0.0461032763f, 0.151741192f,
+    -0.0806092471f, -0.145378634f, -0.0798503235f, 0.0840464085f,
+    0.0511396043f, -0.018561773f, -0.141448915f, 0.164667025f,
+    -0.0330048688f, 0.199420169f, -0.0801674053f, -0.139114693f,
+    -0.0339423195f, -0.00602296554f, 0.0315972492f, 0.0944426134f,
+    -0.0242831912f, -0.0623241775f, -0.0602265485f, -0.150983527f,
+    -0.0751488805f, -0.0186633896f, -0.162630305f, 0.112712346f,
+    -0.183482811f, -0.00848752633f, -0.165716365f, -0.162416637f,
+    0.220429122f, -0.0688678995f, -0.0505750813f, 0.154831707f,
+    -0.0184075348f, 0.0381215103f, -0.0473437235f, -0.120874785f,
+    -0.146114826f, 0.0190217402f, -0.180480793f, 0.0822810754f,
+    0.000871099881f, 0.0275573004f, -0.0578556843f, 0.184135959f,
+    0.0351187214f, 0.144677714f, -0.067043975f, 0.361697018f,
+    0.064063631f, -0.0641534701f, 0.0910371691f, 0.0734032765f,
+    0.0321536623f, 0.0341473222f, -0.173192337f, -0.0842913687f,
+    0.125964135f, 0.549254f, -0.205989569f, 0.16650942f,
+    -0.289263457f, -0.302925438f, 0.0828856602f, -0.0985804424f,
+    0.0619463623f, 0.143759236f, 0.0202542655f, -0.450151145f,
+    -0.0326880738f, 0.00404460542f, 0.153971374f, 0.359334797f,
+    -0.259880781f, 0.061070174f, -0.327683121f, -0.28650558f,
+    0.245855063f, 0.0763784498f, -0.17648457f, -0.132525355f,
+    -0.00635835528f, -0.259003609f, -0.20250456f, -0.246036619f,
+    -0.35758552f, -0.197297648f, 0.152119622f, -0.0424446166f,
+    0.0113365175f, -0.403124809f, -0.0663624778f, -0.378783107f,
+    0.0458462201f, 0.256187737f, -0.167972505f, 0.071747303f,
+    -0.000328183174f, 0.0297713857f, 0.0179272778f, 0.235346973f,
+    -0.0506785028f, -0.0459939949f, 0.0437830687f, -0.405786753f,
+    0.249537945f, 0.30017361f, 0.153691992f, 0.089926675f,
+    0.0497365259f, -0.243779942f, 0.299775332f, -0.506662905f,
+    -0.0682715476f, 0.144378826f, 0.123600423f, 0.102940269f,
+    0.181076169f, 0.0583768003f, 0.126840547f, 0.417446941f,
+    0.0800173432f, 0.346459955f, -0.327003866f, -0.0779261142f,
+    -0.105959527f, -0.00633670622f, -0.0999444276f, -0.429560155f,
+    -0.0702514946f, -0.107793063f, 0.0602690354f, 0.134221584f,
+    -0.0500895977f, -0.153265417f, 0.0285015032f, 0.119178355f,
+    -0.0817671046f, -0.0129153393f, -0.440420836f, 0.120966867f,
+    -0.0321755633f, -0.0314295962f, -0.0318343267f, -0.732020617f,
+    -0.0431512818f, -0.117904283f, -0.0921279415f, -0.00418497296f,
+    -0.110876568f, -0.0697262138f, -0.0883208811f, -0.097383447f,
+    -0.00283230585f, -0.0122831054f, -0.0659291372f, -0.026861053f,
+    0.0970758498f, -0.253597885f, 0.222120434f, -0.354250908f,
+    0.0759482011f, -0.0175749548f, 7.83921714e-05f, 0.150886893f,
+    0.05185619f, -0.0535343289f, -0.181315929f, 0.0806035772f,
+    0.157878995f, 0.361431062f, -0.18901895f, 0.18470484f,
+    0.338787854f, -0.118449025f, 0.00794789847f, -0.634901941f,
+    -0.00313611841f, 0.0263200197f, -0.0758619234f, 0.0484711491f,
+    0.165667057f, 0.0104913004f, 0.206835553f, 0.273030996f,
+    -0.053248059f, 0.334704131f, -0.138791069f, 0.07860367f,
+    -0.399726897f, -0.298924536f, 0.0555282682f, -0.856082797f,
+    -0.0190692954f, 0.081305407f, -0.068675749f, -0.147229463f,
+    -0.0219528135f, -0.0744809359f, 0.178417146f, 0.177986741f,
+    -0.259496599f, -0.282660365f, -0.0447377712f, -0.553309858f,
+    -0.355392694f, -0.103807986f, -0.181998372f, 0.422118664f,
+    0.080443792f, -0.0970882252f, -0.362161934f, -0.0285724513f,
+    -0.135542467f, -0.187591717f, -0.0682691708f, -0.247826263f,
+    -0.218501464f, -0.0806304812f, -0.497236878f, -1.0189687f,
+    -0.921395302f, -0.501698375f, -0.160761625f, -0.446234584f,
+    -0.0386368446f, -0.0447589383f, -0.388040364f, -0.311281919f,
+    -0.0956476778f, -0.0879062191f, 0.00277304114f, -0.0961380973f,
+    -0.324143052f, 0.146593541f, -0.34205693f, -0.585702717f,
+    -0.776147366f, -0.424842566f, -0.183495402f, -0.362644225f,
+    0.0235628393f, -0.00382673764f, -0.387406111f, -0.0719740912f,
+    -0.00968726445f, -0.0532998703f, 0.278640866f, -0.00788095687f,
+    0.325341672f, 0.127112851f, 0.196388215f, -0.245436698f,
+    -0.211515933f, 0.0665908977f, 0.0702468827f, -0.14555341f,
+    -0.0826761723f, 0.233448192f, 0.364723504f, 0.0374823362f,
+    0.147858128f, 0.164994091f, -0.184202522f, 0.128221363f,
+    0.0180896316f, 0.0235686768f, 0.118558407f, -0.206235617f,
+    -0.137294963f, 0.0285792146f, 0.108008817f, 0.0365457088f,
+    -0.00842614006f, 0.145668745f, 0.223708168f, 0.0488438942f,
+    0.165580869f, 0.131001607f, -0.0256596673f, 0.204726234f,
+    0.0898563936f, 0.0883623213f, -0.0695292801f, -0.33764568f,
+    -0.14835903f, -0.13078025f, 0.0352196805f, -0.0313525498f,
+    -0.00798789691f, 0.0637758598f, 0.046647992f, -0.015463517f,
+    0.0525572374f, -0.00845955033f, 0.0154887056f, 0.201396152f,
+    -0.0501596965f, -0.264315099f, 0.289736629f, 0.0428550281f,
+    0.151976213f, 0.229434252f, 0.0241659842f, 0.647409916f,
+    0.070527643f, -0.237287089f, 0.0482222326f, 0.15063417f,
+    -0.0613518283f, 0.0705742836f, 0.021370424f, -0.11508996f,
+    -0.0805286542f, -0.502821088f, 0.252963483f, -0.546670735f,
+    -0.0452769287f, 0.172060207f, -0.0865270197f, 0.367759943f,
+    -0.0738109276f, -0.173084602f, 0.0612105206f, 0.144741505f,
+    -0.024175195f, -0.150337487f, 0.032520514f, -0.229186833f,
+    0.00302543747f, -0.0666768551f, 0.257786185f, -0.0778439939f,
+    0.321953684f, 0.227018729f, 0.0969811976f, 0.361570805f,
+    -0.0519391596f, -0.0951916799f, 0.139673352f, 0.0623502582f,
+    0.0121536395f, 0.00139658083f, 0.0328286961f, -0.0879825056f,
+    0.00865521096f, -0.033845339f, -0.0463594534f, -0.00108856941f,
+    -0.0394707806f, -0.0480686426f, 0.040657077f, 0.0536593571f,
+    0.00503503298f, -0.0474601351f, -0.0344388746f, -0.0844865739f,
+    -0.0416082591f, -0.0916746333f, 0.0234854948f, 0.00524613494f,
+    0.022948524f, 0.040719822f, 0.00745312078f, 0.00362781645f,
+    -0.00350876548f, -0.106593415f, -0.00189960178f, -0.0522465929f,
+    -0.043302238f, -0.0403485894f, -0.0737130642f, -0.0941573903f,
+    -0.0463522039f, -0.0554616526f, -0.0795430765f, -0.0473847315f,
+    0.0557661988f, 0.0171734355f, -0.00632591452f, -0.0737504661f,
+    0.0160411168f, -0.00643778685f, -0.0401677825f, -0.00637794333f,
+    0.0830120668f, -0.054153908f, 0.0344474353f, -0.00883101858f,
+    -0.0229587052f, -0.00448074238f, -0.107351571f, 0.0721920878f,
+    0.0207826272f, 0.0690302104f, 0.0625448301f, -0.00786118396f,
+    0.00619718758f, -0.0085631134f, -0.0707297027f, 0.0548214465f,
+    -0.0676741824f, -0.0525648557f, -0.012429487f, -0.0910583138f,
+    -0.0126177855f, 0.0279349331f, -0.0597978719f, 0.0364880264f,
+    0.00932362862f, -0.0253534373f, -0.0296887327f, -0.0864555761f,
+    -0.0417552888f, 0.00566073973f, -0.0175816528f, -0.0670718178f,
+    0.0308868196f, 0.0219579302f, -0.082771197f, -0.012712758f,
+    -0.0608521327f, -0.0428975374f, -0.118436627f, -0.0569549352f,
+    -0.0768077895f, -0.0775726363f, -0.0649743453f, -0.0221165828f,
+    0.039830979f, -0.00269314717f, -0.0822725073f, 0.0643493608f,
+    -0.001475672f, 0.0210076477f, 0.0268537588f, 0.0192679558f,
+    0.0523783118f, 0.0133466087f, -0.106649384f, 0.0249192622f,
+    0.0133074261f, 0.0985044315f, -0.0591190979f, 0.0266988389f,
+    -0.0124693234f, -0.0585893877f, -0.00821987912f, -0.05006155f,
+    0.0639947876f, 0.0352174416f, 0.0702307969f, -0.0182615481f,
+    -0.0227558035f, -0.028697364f, -0.0538052469f, -0.0531811714f,
+    -0.0468738116f, -0.0461107492f, -0.0179029871f, -0.0379005186f,
+    -0.0388775468f, 0.0258028582f, -0.035884887f, 0.0667167827f,
+    -0.054628849f, 0.0326401964f, -0.10040053f, -0.0602082871f,
+    0.0511800013f, -0.0831977427f, -0.0750451684f, -0.0649080873f,
+    0.00449965615f, 0.0129522597f, -0.106402449f, -0.0755481422f,
+    -0.0305723362f, -0.0685307235f, -0.0479480289f, 0.0156075004f,
+    0.0099028945f, 0.0307526179f, 0.0489629582f, 0.0365202576f,
+    -0.031387303f, -0.0861143023f, -0.0603877939f, -0.00562942307f,
+    -0.0735872835f, 0.166714355f, -0.0757135674f, -0.0481709875f,
+    -0.45723784f, -0.294935524f, 0.195971996f, -0.304653734f,
+    -0.0417815559f, 0.168889001f, 0.0265433639f, -0.0792883635f,
+    0.17143625f, 0.156576484f, -0.253610104f, 0.0980070606f,
+    -0.0807448849f, 0.223724768f, -0.217514291f, -0.133814037f,
+    -0.668325007f, -0.428093165f, 0.050755199f, -0.752116919f,
+    0.0502635762f, 0.101127543f, -0.0536895767f, 0.0365494601f,
+    0.0105404202f, -0.0335363932f, -0.250798702f, 0.0497685894f,
+    -0.036815539f, -0.107809983f, -0.15793018f, -0.4186019f,
+    -0.905004919f, -0.4835774f, -0.0353044979f, -0.512677789f,
+    -0.0321098678f, 0.0651506335f, -0.0227619391f, -0.0301195215f,
+    0.021302307f, 0.114614151f, -0.121714063f, -0.0614796802f,
+    0.0269993376f, 0.15635103f, 0.150491104f, -0.534234583f,
+    -0.0794144645f, 0.177425891f, 0.18974857f, 0.236888215f,
+    0.0211957209f, 0.0183717795f, 0.12985225f, 0.233399838f,
+    0.0371135809f, -0.0150191849f, -0.142335057f, 0.186602727f,
+    0.156500772f, -0.0295513254f, 0.208249241f, -0.287621319f,
+    0.162927419f, 0.166595414f, 0.0911306441f, 0.429874271f,
+    -0.0259290449f, 0.168821663f, 0.280617774f, 0.117436126f,
+    0.149227098f, 0.0565670691f, -0.125689954f, 0.108031832f,
+    0.0704058632f, -0.222163022f, 0.275269806f, -0.309064299f,
+    0.11957173f, 0.130210876f, 0.152065337f, 0.451919615f,
+    -0.0536090732f, 0.0664487481f, 0.147518292f, 0.0722150952f,
+    0.1638304f, 0.113036327f, -0.251226038f, 0.0512031689f,
+    -0.0357905775f, -0.121311635f, 0.0774169937f, -0.0768518299f,
+    0.0129084885f, 0.253229618f, -0.308090627f, 0.352911472f,
+    -0.00573524833f, -0.354647338f, 0.00830179173f, -0.052033715f,
+    -0.213127017f, -0.0708038509f, 0.0708838999f, -0.0955208018f,
+    -0.123083234f, -0.225560218f, 0.133616924f, -0.137430489f,
+    0.315032482f, 0.317538679f, -0.133276567f, 0.538847148f,
+    -0.0608642399f, -0.263995707f, 0.100746356f, -0.0650025904f,
+    -0.308795094f, -0.0756728128f, 0.00351499161f, -0.20805788f,
+    0.0828798711f, -0.273808986f, 0.0463665016f, 0.0174428765f,
+    0.359253198f, 0.214457542f, -0.188162446f, 0.516475677f,
+    0.0653475076f, -0.272935152f, -0.0159090031f, -0.0194101967f,
+    -0.236169249f, -0.101622768f, -0.0418600142f, -0.334001094f,
+    0.147751644f, -0.105297953f, 0.106119886f, -0.267445296f,
+    0.208153024f, 0.159474298f, -0.0079108784f, 0.249789089f,
+    0.0695193112f, 0.0254318919f, 0.0242830645f, 0.0697037429f,
+    0.0469566807f, 0.057659369f, -0.0597573407f, 0.091381833f,
+    -0.123768672f, 0.217489675f, -0.0146222012f, -0.319695979f,
+    0.479196846f, -0.0192590598f, 0.239924937f, -0.0947552696f,
+    0.0010291338f, 0.0993043184f, 0.0168147609f, 0.031334918f,
+    0.0475570858f, -0.0112376353f, -0.166162699f, 0.322086871f,
+    0.062894918f, 0.426935315f, -0.0952763632f, 0.189449206f,
+    -0.0494912863f, -0.265481979f, 0.0953898057f, 0.106804155f,
+    0.0765347332f, -0.0737707987f, 0.0203750022f, -0.219267964f,
+    -0.0672874153f, -0.0466306284f, -0.0522218458f, 0.263375968f,
+    0.0849276632f, -0.744188488f, -0.287713766f, 0.0157880485f,
+    -0.32432121f, -0.320985049f, -0.12052086f, -0.255238801f,
+    0.0674726591f, -0.000586038863f, 0.0157924443f, -0.205313399f,
+    -0.0171984546f, -0.0362445898f, -0.120527051f, -0.343087316f,
+    -0.0633849576f, -0.376549929f, 0.123334482f, -0.314351499f,
+    0.627812207f, 0.107801348f, 0.0369552486f, 0.155463114f,
+    -0.0820755884f, -0.0396309495f, 0.0628036857f, 0.0156325102f,
+    -0.00517739588f, -0.0592864938f, -0.0775749087f, -0.180649146f,
+    -0.143947065f, 0.549496233f, -0.103724204f, -0.165906623f,
+    0.514582396f, -0.0955974311f, 0.13118276f, -0.271927863f,
+    0.0378838405f, -0.118697338f, -0.221994355f, -0.0245131068f,
+    -0.003689253f, 0.0238975156f, 0.16847299f, 0.351078808f,
+    0.112822145f, -0.314802259f, 0.0968403071f, 0.365635097f,
+    0.173139811f, -0.117989063f, -0.130328134f, 0.124427058f,
+    -0.0561681017f, -0.111562379f, 0.0536700077f, -0.0985027626f,
+    -0.191577777f, 0.00468423078f, -0.29558745f, -0.283845067f,
+    -0.107284978f, -0.72334224f, -0.0831483454f, -0.126544058f,
+    0.198402703f, -0.0256822724f, -0.0849644244f, 0.112917177f,
+    0.0771418959f, -0.0585993975f, -0.025159955f, 0.0477556661f,
+    -0.0651789829f, -0.170066297f, -0.043043606f, -0.47625643f,
+    -0.134306014f, 0.165923163f, 0.148776352f, -0.177766249f,
+    0.606527567f, 0.290687889f, -0.0389925428f, 0.16722405f,
+    -0.00296162581f, -0.0417191572f, 0.0377379283f, 0.248834491f,
+    0.0519970842f, 0.0348974057f, 0.204296276f, -0.115658708f,
+    0.210413799f, -0.22670728f, 0.142545953f, -0.248976782f,
+    0.297767311f, 0.278498828f, -0.334608376f, 0.419693679f,
+    -0.0354987197f, -0.15344061f, 0.0914665312f, -0.237880871f,
+    -0.207939029f, -0.183125496f, -0.208545029f, -0.1115091f,
+    -0.100962803f, -0.00860302895f, 0.133764476f, -0.0146217272f,
+    0.574024856f, 0.108921051f, 0.0538113974f, 0.333523273f,
+    -0.0552296154f, -0.227365151f, -0.176797032f, -0.0528589636f,
+    -0.137258172f, -0.106531963f, 0.0394120365f, -0.0121093104f,
+    0.130128175f, -0.260770023f, -0.226747662f, 0.158278242f,
+    0.0449718013f, -0.0649399534f, -0.0844099075f, -0.306522727f,
+    0.068328023f, -0.0349115282f, -0.106213599f, 0.168654203f,
+    0.112496749f, -0.00538275903f, -0.319298863f, -0.0610241033f,
+    -0.279343009f, -0.0496639945f, -0.0319325849f, 0.114794001f,
+    0.237943143f, 0.0396194309f, -0.225119084f, 0.102906778f,
+    -0.0373279974f, -0.331532955f, -0.262635946f, 8.38209598e-05f,
+    -0.370564938f, -0.33432439f, -0.124126896f, -0.126761004f,
+    0.136388659f, -0.330418348f, -0.120004199f, 0.145326555f,
+    -0.146945417f, -0.0773925856f, -0.15170987f, -0.446680754f,
+    -0.0693757832f, 0.132997841f, 0.0754004717f, 0.25664559f,
+    0.0954960212f, -0.0519010536f, -0.409554094f, -0.0758892521f,
+    0.420345336f, -0.332442462f, 0.222668469f, 0.412813395f,
+    -0.398382515f, -0.2451635f, -0.10733889f, 0.0557025224f,
+    -0.0358244479f, 0.224612772f, 0.355311453f, -0.220148325f,
+    0.0460860468f, 0.134066254f, -0.302500874f, -0.130338579f,
+    0.240668178f, -0.0332906805f, -0.321598262f, 0.0689036772f,
+    -0.318822503f, -0.208411455f, 0.0872972384f, -0.308997512f,
+    0.0189011004f, 0.0976785198f, -0.0200488139f, 0.101577707f,
+    0.22655189f, 0.186013654f, -0.210022658f, 0.0281500407f,
+    0.363266289f, -0.0234081559f, 0.149598703f, 0.559752524f,
+    -0.293925494f, -0.0019095582f, 0.0307169817f, 0.191831157f,
+    0.0634524152f, 0.145905435f, 0.200685441f, 0.0203143358f,
+    0.118772186f, 0.151005968f, -0.20152697f, 0.102704875f,
+    -0.0180855859f, -0.026168678f, 0.231605038f, 0.330705702f,
+    -0.30871582f, -0.258084357f, 0.00630004099f, 0.17178826f,
+    0.0785794184f, -0.119987123f, 0.106993616f, -0.0859175548f,
+    -0.207569689f, -0.163802668f, -0.066144675f, 0.0202148762f,
+    -0.123523898f, -0.0593024008f, -0.0916487724f, -0.442379266f,
+    -0.0271784887f, 0.1300513f, -0.0981959403f, 0.097138077f,
+    0.0352486074f, -0.215087026f, -0.149965316f, -0.065963991f,
+    -0.184149325f, -0.0520728156f, 0.00560541265f, -0.0657268465f,
+    -0.0563462153f, -0.114727736f, -0.0389362387f, -0.621973634f,
+    -0.146058843f, 0.136167422f, -0.0485787801f, 0.232184798f,
+    -0.053705316f, -0.127941146f, -0.0815307498f, -0.124899648f,
+    0.0407418571f, 0.0162734501f, 0.126188099f, -0.00300253648f,
+    -0.0523115806f, -0.240282223f, -0.079078868f, -0.426638931f,
+    -0.119856171f, 0.00653202273f, 0.0419412926f, -0.0724206492f,
+    0.0646754652f, -0.0565655045f, -0.0936348662f, -0.148746863f,
+    -0.0503534973f, 0.108492099f, 0.0256067067f, -0.0844960511f,
+    -0.088516295f, -0.166307569f, -0.109510504f, -0.459156394f,
+    -0.250611663f, 0.0406950861f, -0.0273874328f, -0.48931995f,
+    0.0653320849f, 0.107999094f, -0.137605786f, 0.0164017677f,
+    0.159960449f, 0.0618773922f, -0.154191464f, 0.0304620266f,
+    0.00913585071f, 0.162690222f, -0.0277503841f, -0.498091698f,
+    -0.332719475f, -0.0764761642f, 0.165581122f, -0.600927234f,
+    0.0112897754f, 0.145698875f, -0.018658381f, -0.0374372639f,
+    0.0558602102f, 0.134207904f, 0.133766413f, 0.265610248f,
+    -0.0615600459f, 0.171927914f, -0.104443476f, -0.0414348096f,
+    -0.525889218f, -0.113469876f, 0.0535403416f, -0.447646499f,
+    0.00895010494f, 0.0875435546f, -0.0503653958f, 0.010123522f,
+    0.0257412288f, 0.0968894064f, 0.223412246f, 0.123458378f,
+    -0.0473965891f, -0.160553932f, -0.0140120378f, -0.211708263f,
+    -0.190987557f, 0.0997595936f, 0.00400408637f, -0.245216072f,
+    0.0192931406f, -0.0364729278f, -0.0349838771f, 0.175757915f,
+    0.0487457514f, 0.00494638411f, -0.0131796459f, -0.0958682597f,
+    0.00505771441f, -0.00533913774f, 0.0974472463f, -0.399690002f,
+    -0.261076748f, -0.136724442f, 0.0964144468f, -0.517506301f,
+    0.0366887152f, 0.0170361493f, -0.00135183509f, 0.194467232f,
+    0.166854978f, 0.0674313605f, 0.0576765314f, 0.113818787f,
+    0.173559994f, 0.204736173f, -0.0142859789f, 0.20978938f,
+    -0.452685177f, -0.145421565f, 0.153622895f, -0.582192421f,
+    -0.0101195872f, 0.214010462f, 0.0128657082f, -0.0287701432f,
+    0.206297815f, 0.0668314323f, 0.233374715f, 0.0949248224f,
+    0.109541319f, -0.21258986f, -0.165594965f, -0.0473710857f,
+    -0.157301784f, -0.286468863f, 0.064748399f, -0.248865262f,
+    -0.0649095476f, 0.0464974791f, -0.0907767043f, 0.0630336627f,
+    0.0052043763f, -0.0846816897f, -0.470128655f, -0.0114470497f,
+    0.183833987f, -0.084462136f, 0.108541854f, 0.0149452472f,
+    -0.0810431466f, -0.0715502426f, 0.0109606255f, 0.145733461f,
+    0.02730022f, 0.144975081f, 0.118560024f, -0.0334388316f,
+    0.134166732f, -0.0362827331f, -0.665447116f, -0.0284201894f,
+    0.0710242614f, 0.0458761752f, 0.251419991f, -0.223649293f,
+    0.20809631f, 0.322660238f, 0.0736915618f, 0.306094646f,
+    -0.0714811683f, -0.0313512944f, 0.166757762f, 0.127720654f,
+    0.0667197406f, -0.065425247f, -0.535652697f, -0.0271339938f,
+    0.149659589f, -0.0989915878f, -0.0356057622f, 0.416881084f,
+    -0.0138178468f, -0.103458188f, 0.124307983f, -0.548245788f,
+    0.0497793779f, 0.0740444958f, 0.0464311242f, 0.190679729f,
+    0.0777745843f, 0.0444212072f, -0.447203428f, -0.180914715f,
+    0.134081066f, 0.182450578f, 0.137547597f, 0.36223501f,
+    -0.248767972f, -0.223632753f, 0.109808743f, -0.0509793088f,
+    -0.0223012976f, 0.0234337207f, 0.156122267f, 0.0272439159f,
+    0.0293982551f, 0.0424776375f, -0.434935629f, 0.00412907358f,
+    -0.0385676026f, -0.0542111583f, -0.045180548f, -0.162747189f,
+    0.397143006f, 0.153410062f, -0.111259915f, 0.0421475247f,
+    0.0800688118f, -0.131511033f, -0.0714515224f, 0.232469514f,
+    -0.106570601f, -0.160295799f, -0.417327583f, -0.0144923124f,
+    0.0225823298f, 0.254568905f, 0.0985267609f, 0.247270852f,
+    0.352567881f, -0.0279020835f, 0.192163274f, -0.567114711f,
+    -0.0556933209f, 0.00246821414f, 0.0425448939f, 0.284984916f,
+    -0.0473269634f, -0.0165852606f, -0.0245159604f, 0.107344225f,
+    0.0272282306f, 0.239823654f, -0.142757565f, 0.242974013f,
+    0.0863906816f, -0.237090021f, 0.126176253f, -0.528287232f,
+    -0.0416149423f, 0.0363609828f, -0.0293916315f, -0.185149983f,
+    -0.0107963262f, -0.208771989f, 0.0653572604f, 0.121768691f,
+    -0.0167127587f, -0.06162256f, -0.125628784f, 0.138024628f,
+    0.385106534f, 0.270376354f, -0.209874585f, 0.191035926f,
+    0.0216003172f, -0.155687079f, -0.0167618562f, -0.221836865f,
+    -0.372224659f, -0.198990822f, -0.234137967f, -0.118493356f,
+    0.111620247f, 0.0988125652f, 0.0145923644f, -0.211163059f,
+    0.29063037f, -0.0225578919f, 0.0969443992f, -0.0297452025f,
+    -0.0195200946f, 0.0716738701f, 0.123503514f, 0.142651811f,
+    0.121368773f, 0.00775131164f, -0.217007294f, 0.283666164f,
+    0.134925991f, -0.013691145f, -0.0610592067f, -0.200986788f,
+    0.0581841767f, -0.256699651f, 0.0739289448f, -0.154460073f,
+    -0.0272270553f, 0.123023644f, 0.252112478f, 0.0579392351f,
+    0.117380343f, 0.135631651f, -0.276032686f, 0.102594219f,
+    0.165121838f, -0.150552019f, 0.153704211f, 0.0992242023f,
+    -0.279602051f, -0.131852686f, 0.119897902f, -0.0495597534f,
+    0.0618994348f, 0.149308965f, 0.146059364f, -0.0827096105f,
+    -0.0932494476f, 0.00638828287f, -0.485355824f, -0.013746772f,
+    -0.245656714f, -0.272771776f, -0.0531671904f, -0.0592713356f,
+    -0.151422456f, -0.176598206f, -0.0440844074f, -0.255616099f,
+    -0.0176263154f, -0.0274434313f, -0.126048535f, 0.0851327777f,
+    0.0831382275f, 0.05288684f, -0.351712525f, -0.110990152f,
+    -0.207553729f, 0.179279104f, 0.0111191878f, -0.233651832f,
+    0.0843574703f, -0.105749764f, 0.151187718f, -0.334604084f,
+    -0.0805635899f, 0.015011481f, -0.1186013f, -0.118508935f,
+    -0.055121325f, -0.0466538817f, 0.0164650679f, 0.0972649083f,
+    -0.0764448941f, 0.426424384f, -0.0711558983f, -0.345731169f,
+    0.137909099f, -0.0676874593f, 0.266954213f, -0.327050805f,
+    0.00425144052f, 0.0823196545f, -0.0503632203f, -0.0383187719f,
+    0.0953658074f, 0.00908675697f, 0.0973240137f, 0.288021833f,
+    -0.142512038f, -0.505368769f, -0.0167855415f, -0.111256048f,
+    0.474265277f, 0.149139106f, 0.0866514519f, 0.0896109268f,
+    0.0208656397f, -0.0841115564f, -0.184453458f, 0.128395304f,
+    -0.0496787839f, 0.0476073921f, -0.209749073f, -0.358577728f,
+    -0.117441297f, -0.126160279f, 0.0864928812f, -0.607756972f,
+    0.114202492f, -0.157843873f, 0.0264944118f, 0.218234912f,
+    -0.00195058191f, -0.0394737981f, 0.00659775594f, -0.171100125f,
+    0.041592665f, -0.0382847674f, -0.074833855f, 0.121881075f,
+    -0.202771604f, 0.104006618f, 0.11379341f, -0.667631686f,
+    0.142136231f, 0.050001651f, 0.180317f, 0.262986869f,
+    -0.068730548f, 0.0575220287f, 0.00392150646f, 0.126975566f,
+    0.130180642f, 0.00306149921f, 0.109062217f, 0.0760916397f,
+    0.36104849f, 0.0496036559f, 0.304610193f, 0.416544229f,
+    0.157755882f, 0.138096362f, 0.230322972f, 0.30990684f,
+    -0.067050539f, 0.152623534f, 0.183318302f, 0.162631869f,
+    0.123888507f, 0.184384063f, 0.253170162f, 0.113254726f,
+    0.166318506f, -0.139936134f, 0.129293695f, 0.156172991f,
+    -0.00966417138f, 0.129227594f, 0.0451071039f, 0.231351793f,
+    -0.0391233675f, -0.0883279815f, 0.217680216f, -0.0846952647f,
+    -0.193373248f, 0.0372401625f, -0.190896749f, -0.154547021f,
+    -0.167144626f, -0.185480967f, -0.0184366237f, -0.179670155f,
+    0.132900581f, -0.0561499298f, -0.253070056f, 0.146073073f,
+    -0.0583504252f, -0.197339445f, -0.115760177f, -0.126724631f,
+    -0.132137075f, -0.086781472f, 0.0821012929f, -0.228718057f,
+    -0.206454456f, -0.665267527f, 0.183071837f, -0.0559404939f,
+    -0.0983572155f, 0.00513478974f, -0.199749663f, 0.240259632f,
+    -0.00346313929f, -0.366185874f, -0.158324972f, 0.00263871788f,
+    -0.369526565f, -0.218137547f, -0.124675818f, -0.433474243f,
+    -0.197280601f, -0.639775932f, -0.270320207f, -0.64563036f,
+    -0.403650761f, -0.262549728f, -0.203379825f, -0.283479065f,
+    0.00678167772f, -0.0411639735f, -0.27208373f, 0.00495101977f,
+    -0.141696244f, -0.00379619794f, -0.318378955f, 0.0335707255f,
+    -0.0809354559f, -0.263296813f, -0.0682868958f, -0.354654342f,
+    -0.264454782f, -0.338535398f, 0.00472974638f, -0.0740749389f,
+    -0.0597758517f, 0.170534372f, -0.122568965f, 0.00776250707f,
+    0.149145514f, 0.139631554f, -0.229653358f, 0.0962051079f,
+    0.068855986f, -0.15049766f, -0.29725343f, -0.232479587f,
+    -0.606647193f, -0.256617457f, 0.0223161057f, -0.730755031f,
+    0.0579051673f, 0.208004817f, -0.0248732455f, 0.0709857419f,
+    0.224413633f, 0.114811651f, -0.0254361052f, -0.0763295293f,
+    0.315694124f, 0.110100374f, 0.146952659f, -0.0969265327f,
+    -0.149936199f, 0.198067233f, 0.193341821f, -0.110593095f,
+    -0.0478453748f, 0.353353053f, 0.212398335f, 0.0638453886f,
+    0.229942843f, 0.178013757f, 0.0734269544f, 0.327889115f,
+    0.225912541f, -0.0809627101f, 0.137563914f, -0.257829934f,
+    -0.0590858124f, 0.121715821f, -0.0126731386f, 0.313107997f,
+    0.0771166235f, 0.0806010589f, 0.223185107f, -0.145702153f,
+    0.0278406944f, 0.097500369f, 0.13812685f, 0.0384880491f,
+    0.053875491f, 0.224200606f, 0.00897344388f, -0.0876948461f,
+    0.838204205f, 0.228762776f, 0.00516909733f, 0.268904507f,
+    -0.0527354591f, -0.300120324f, -0.161573127f, 0.0514208823f,
+    -0.266926914f, -0.198746666f, 0.0995323285f, 0.117265813f,
+    0.0942109525f, -0.343555659f, -0.117367491f, -0.126525208f,
+    0.596575081f, -0.0740127414f, -0.0458224602f, -0.0569987483f,
+    -0.0406601354f, 0.130751505f, -0.159032956f, 0.228414267f,
+    0.0542604253f, -0.103996038f, 0.0751715973f, -0.252408952f,
+    0.121883549f, -0.232111573f, -0.0422342718f, 0.0808287039f,
+    -0.247387052f, -0.182539865f, 0.0146510182f, 0.0123066902f,
+    -0.00883724354f, 0.0354622379f, 0.113005057f, 0.228010282f,
+    0.0913591534f, 0.0469775386f, -0.36297214f, -0.0298901834f,
+    0.185523912f, 0.0861300603f, -0.0906181261f, 0.121832199f,
+    0.363440573f, 0.0594681278f, -0.0273994654f, -0.127886072f,
+    -0.00479000807f, -0.0927157998f, -0.166965052f, 0.196138605f,
+    -0.00886881258f, -0.0285328627f, -0.424472809f, -0.0543304347f,
+    0.293545127f, -0.136641473f, 0.0178105962f, 0.309272856f,
+    0.187217921f, -0.0705439001f, 0.0438723937f, 0.0313378274f,
+    0.0257023871f, 0.239217952f, 0.0660449937f, -0.025012875f,
+    0.123234153f, 0.152203709f, -0.165975273f, -0.0964424312f,
+    0.0520418324f, -0.568412066f, -0.0218863226f, 0.35218215f,
+    0.017952539f, -0.237771764f, 0.0787407234f, -0.100342855f,
+    0.0486800894f, 0.0135796545f, -0.0381631181f, -0.185647607f,
+    -0.0353357866f, -0.0860756785f, -0.202820733f, -0.345762193f,
+    0.163733393f, -0.0712269172f, -0.017575115f, 0.336739689f,
+    -0.171522379f, -0.189978927f, -0.00268609566f, 0.140544891f,
+    0.0491285436f, 0.110226661f, 0.178135991f, -0.112074226f,
+    0.0514382534f, 0.0060224575f, -0.540653467f, 0.0625756904f,
+    0.0671544224f, 0.0701811314f, 0.318525702f, 0.053970553f,
+    -0.0101531157f, -0.0230397508f, 0.0166183263f, 0.411013335f,
+    0.0828217715f, -0.0710078105f, 0.0679480955f, -0.0983202085f,
+    -0.180918708f, 0.0583145581f, 0.158232689f, -0.00607633032f,
+    -0.271464944f, -0.171226218f, 0.0572986081f, -0.0771239102f,
+    0.360198915f, 0.0151815088f, -0.0358298495f, 0.320401669f,
+    -0.0314381532f, -0.329714209f, -0.228584856f, -0.0925166532f,
+    -0.235764772f, -0.278933316f, 0.263097167f, -0.17599465f,
+    -0.0159115884f, -0.0853940323f, 0.421786368f, 0.252566457f,
+    0.464288265f, 0.290825427f, 0.15040262f, 0.44122985f,
+    -0.0610437989f, -0.282667726f, 0.150794908f, -0.0050043771f,
+    -0.200781062f, 0.000795209722f, 0.0669644773f, -0.0255549476f,
+    -0.16291225f, 0.0511813685f, -0.243549436f, -0.116261974f,
+    -0.322535038f, -0.0943332165f, -0.281944454f, -0.0925620422f,
+    -0.0717792213f, -0.316240996f, -0.218344763f, -0.275123566f,
+    -0.320049554f, -0.0479759276f, 0.0363066867f, -0.31477505f,
+    -0.358439922f, -0.085235171f, -0.216331661f, -0.628165603f,
+    -0.141284779f, -0.180620447f, -0.0864892453f, 0.205075145f,
+    0.0438863859f, -0.0465851016f, -0.369347662f, -0.0771182254f,
+    -0.0647913143f, -0.0545450896f, -0.0355160758f, 0.136530921f,
+    -0.200738281f, -0.159472927f, -0.733117998f, -0.545975864f,
+    -0.379800856f, -0.316414684f, -0.188730225f, -0.431957394f,
+    0.0489212573f, -0.131076291f, -0.350897789f, -0.250350296f,
+    -0.184920028f, -0.148509786f, 0.161083028f, 0.0317623764f,
+    -0.0304891076f, -0.329521537f, -0.396268129f, -0.54636389f,
+    -0.227357432f, -0.408282101f, 0.00459838286f, -0.296948463f,
+    0.0167903118f, 0.122545652f, -0.276948601f, 0.0992325842f,
+    0.133551568f, -0.00920190569f, -0.180477113f, 0.0381938554f,
+    0.276417762f, -0.132986456f, 0.21039772f, -0.509275973f,
+    -0.497652262f, -0.155460417f, 0.0564341359f, -0.0302948523f,
+    -0.0472079329f, 0.102811366f, 0.177563503f, -0.00131096155f,
+    0.136022076f, 0.0494229086f, -0.157659218f, 0.0859705582f,
+    0.257506639f, 0.0943896472f, 0.095922783f, 0.223596349f,
+    0.140833452f, 0.0728622377f, 0.101687342f, 0.245772988f,
+    -0.0259323716f, 0.197494999f, 0.246978849f, 0.244079143f,
+    0.142945573f, 0.139351159f, -0.139194831f, 0.0966881365f,
+    0.314469606f, -0.128131703f, 0.104698338f, -0.0823674425f,
+    -0.305305243f, -0.231793195f, -0.00417875359f, -0.0512803867f,
+    -0.0809936151f, 0.153112799f, 0.251379251f, 0.016585933f,
+    0.103043303f, 0.0748488083f, -0.10608495f, 0.0549360551f,
+    0.0719052404f, -0.31501326f, 0.0374470353f, -0.090938516f,
+    -0.221771553f, -0.217765838f, -0.0536201783f, 0.31159696f,
+    -0.0590232424f, 0.00559205981f, 0.00378520973f, -0.0360622481f,
+    0.0584445968f, 0.0782695562f, -0.162238911f, 0.0500917323f,
+    -0.0847765207f, 0.30392617f, 0.0500391573f, -0.330625921f,
+    0.394347936f, 0.31064713f, 0.0100715812f, 0.18313919f,
+    0.0146417823f, 0.134292379f, -0.0783576593f, 0.215239018f,
+    -0.0224800035f, -0.0441974849f, 0.114750132f, 0.175220937f,
+    0.123926692f, 0.275128514f, -0.0201423615f, -0.507590115f,
+    -0.139807701f, -0.0264176205f, 0.091658093f, 0.130225584f,
+    0.0074480474f, 0.133640632f, -0.0209396333f, -0.0352907404f,
+    0.151349753f, 0.00972616579f, -0.0821791738f, 0.267037749f,
+    0.101702407f, 0.183690503f, 0.0217268411f, -0.629392266f,
+    -0.137772202f, -0.0477679372f, 0.0432456769f, 0.188434973f,
+    -0.0669007227f, 0.174205497f, 0.150577292f, 0.0691347197f,
+    0.165739685f, 0.0034073866f, -0.408916265f, 0.152957499f,
+    -0.0607841685f, -0.00324779027f, 0.130522519f, -0.385418832f,
+    0.229916766f, 0.246431515f, -0.0620470494f, 0.197814241f,
+    0.0056768558f, -0.271193802f, 0.139841929f, 0.230053306f,
+    -0.0259607937f, -0.198722899f, 0.117642961f, -0.122883037f,
+    0.106678173f, -0.497317314f, 0.306191176f, -0.367112637f,
+    0.325430721f, 0.21623145f, 0.138380408f, 0.401512444f,
+    -0.040071547f, -0.171287134f, 0.183979049f, 0.0427438766f,
+    -0.0171651505f, -0.0264254231f, -0.284252554f, 0.0907011926f,
+    0.0600605682f, -0.389092714f, 0.323423445f, -0.25504449f,
+    0.22836408f, 0.138904899f, -0.078162536f, 0.706322253f,
+    0.0739979967f, -0.153181061f, 0.0786921233f, 0.0471176282f,
+    -0.0165344179f, -0.00103121588f, -0.0173158422f, -0.11796996f,
+    -0.157832533f, 0.0496599935f, -0.25691545f, -0.22970143f,
+    -0.35319826f, -0.141817003f, -0.156501397f, 0.159778163f,
+    -0.000747313141f, -0.332204014f, -0.251248747f, -0.19968462f,
+    -0.12945722f, -0.224076614f, -0.0923136994f, -0.00180506322f,
+    -0.267492443f, -0.282880068f, -0.338410079f, -0.393214881f,
+    -0.547868311f, -0.38545239f, -0.122671008f, 0.0692545772f,
+    -0.0344910435f, -0.0242984872f, -0.335655242f, -0.212833017f,
+    -0.140605107f, -0.197264493f, 0.0404583067f, -0.115616441f,
+    -0.0773933902f, -0.2476248f, -0.269579649f, 0.0134437056f,
+    -0.669751823f, -0.374839872f, -0.229324132f, -0.279580593f,
+    0.0460164249f, 0.072334893f, -0.211236939f, 0.0374521241f,
+    -0.0176582672f, 0.0577401668f, -0.0296181124f, -0.200429246f,
+    0.0439345911f, -0.0630653054f, -0.11649324f, 0.116681322f,
+    0.103523247f, -0.00544437347f, -0.2533198f, 0.0390389673f,
+    -0.0138157904f, -0.235318333f, -0.0650466233f, -0.128875375f,
+    -0.303450048f, -0.183959752f, 0.103118077f, -0.265147716f,
+    -0.103059292f, -0.00558249839f, -0.0956547409f, 0.148534924f,
+    -0.135615855f, 0.142221287f, -0.0147360684f, -0.0410495363f,
+    0.0086825788f, -0.154647559f, -0.176432937f, -0.0469493195f,
+    -0.0614655241f, -0.14010182f, -0.0346954912f, 0.0741919503f,
+    -0.0419995822f, 0.0784302056f, -0.16845414f, 0.157311112f,
+    -0.19048053f, -0.207622111f, -0.287731588f, -0.244204909f,
+    0.0712839365f, -0.0826124921f, -0.0439721569f, -0.0727139562f,
+    -0.153772146f, -0.194333211f, 0.0605057664f, -0.0129044605f,
+    0.206547931f, 0.312202245f, 0.316341072f, 0.11663004f,
+    0.543991625f, 0.463933617f, 0.122910894f, 0.408465654f,
+    -0.0159479287f, -0.0582740456f, 0.157103598f, 0.200381383f,
+    0.0893314034f, -0.12790443f, 0.0908820704f, 0.380365431f,
+    0.0760484338f, 0.285760671f, -0.0302559286f, 0.133777842f,
+    0.436823636f, 0.232730284f, 0.0512841456f, -0.0927175879f,
+    -0.0500088036f, 0.241595775f, -0.0666960701f, 0.14600271f,
+    0.132884204f, 0.0915512815f, 0.1013356f, 0.241413772f,
+    0.165780425f, 0.219897613f, -0.174811676f, 0.465725362f,
+    -0.334320664f, -0.266957015f, -0.0368114561f, -0.236910746f,
+    -0.0287912302f, -0.0680772141f, 0.136415645f, -0.180795178f,
+    -0.147734642f, 0.0107483035f, 0.0620549843f, 0.0240936093f,
+    -0.279068857f, -0.0125918016f, -0.0343369022f, -0.278235435f,
+    -0.30323115f, -0.0232279114f, -0.275147766f, 0.17833133f,
+    -0.024742078f, -0.293533266f, -0.203993484f, 0.0686256588f,
+    -0.264652342f, -0.274263561f, 0.137882993f, -0.353407115f,
+    -0.174179122f, 0.0141531322f, 0.233416587f, -0.0515472852f,
+    0.0384975523f, 0.177502841f, 0.0202393923f, 0.313369274f,
+    -0.0670646727f, 0.0666893274f, 0.0398855992f, 0.136039108f,
+    0.0526009686f, -0.00191405753f, -0.0179767478f, -0.0439438149f,
+    0.0552963503f, 0.181865707f, -0.0485086292f, 0.0643215328f,
+    -0.294260204f, -0.0773214698f, -0.0225952826f, -0.0949320793f,
+    0.0318500325f, -0.188206822f, 0.12206611f, -0.187481076f,
+    -0.100487582f, -0.174684495f, 0.0720139071f, 0.0742132738f,
+    -0.0912636593f, -0.515051067f, 0.0805465132f, -0.198191032f,
+    0.310720295f, 0.0262902789f, -0.0169686507f, 0.162534714f,
+    -0.0769520551f, -0.102544509f, -0.0509089828f, 0.152969584f,
+    0.00056300353f, 0.0430579931f, -0.262562335f, -0.049916137f,
+    0.0894611329f, 0.280798554f, 0.0301329698f, 0.258079916f,
+    0.181051612f, -0.20452325f, 0.0674979463f, -0.132909656f,
+    -0.0812325105f, 0.192613542f, 0.0215771068f, 0.0316524357f,
+    0.0879554227f, 0.102532558f, -0.25827226f, 0.289014339f,
+    0.189202577f, 0.207102135f, -0.0718041584f, 0.556217849f,
+    -0.180753216f, -0.291356385f, -0.149481535f, 0.107994497f,
+    -0.0593069792f, 0.0055154711f, 0.0959050506f, -0.245689526f,
+    -0.270114481f, -0.13828516f, -0.0133934962f, -0.0548240207f,
+    -0.208874255f, -0.848159611f, 0.0272433627f, -0.165254965f,
+    0.19367002f, -0.0140704326f, -0.0193084273f, 0.103274934f,
+    0.0152377989f, -0.212520435f, -0.0217334777f, 0.062981084f,
+    -0.0223832726f, -0.116373993f, -0.110008202f, -0.636039257f,
+    -0.228718087f, 0.0924200788f, -0.071651347f, -0.307713777f,
+    0.478355736f, 0.197733864f, 0.185564339f, -0.171059266f,
+    0.0755375028f, -0.0437232479f, -0.116868831f, 0.146545306f,
+    0.119770743f, 0.0222365931f, -0.125324935f, 0.15197444f,
+    -0.0828822777f, 0.738340378f, -0.0484282784f, 0.168083131f,
+    0.134045795f, -0.169939771f, 0.20712553f, -0.442590624f,
+    -0.0554873757f, -0.0194009487f, 0.0342242122f, -0.068614766f,
+    -0.149533466f, -0.0832210779f, 0.227312446f, 0.309833527f,
+    -0.28018111f, -0.595037162f, -0.394590557f, -0.5426476f,
+    0.0519852266f, -0.256913751f, -0.393318027f, -0.0195144303f,
+    -0.0655046254f, -0.1889088f, -0.368097842f, -0.202126577f,
+    -0.230564222f, -0.187136695f, -0.136894509f, -0.584306836f,
+    -0.150989339f, -0.0804574266f, -0.0120504349f, -0.521481276f,
+    0.539263487f, 0.109415114f, -0.0630055144f, 0.17216593f,
+    -0.0488173477f, -0.0817188025f, -0.0541240424f, 0.0561826006f,
+    0.0666248649f, -0.0289611146f, 0.0402171984f, -0.0875279531f,
+    -0.0419241823f, 0.447152108f, 0.0668770373f, 0.0691121668f,
+    0.403794885f, 0.122923262f, 0.103117555f, 0.105216302f,
+    -0.0531130657f, -0.181932569f, -0.0978125334f, 0.0257734209f,
+    0.0211182944f, 0.0075232666f, 0.415262997f, 0.238050491f,
+    0.153550848f, 0.244451627f, 0.150024787f, 0.114765003f,
+    -0.21161446f, -0.160173222f, 0.189410701f, 0.095238246f,
+    -0.0436167419f, 0.104420841f, 0.233521581f, -0.0413777865f,
+    0.0614155978f, 0.132978827f, -0.167934507f, 0.385867357f,
+    0.0755857155f, 0.129647955f, 0.0662320852f, 0.0302623827f,
+    -0.215895012f, -0.0278386027f, 0.0479497127f, 0.00832184125f,
+    0.0502149872f, 0.0538829155f, 0.145044625f, 0.12662673f,
+    0.140018761f, -0.022421468f, -0.194215924f, 0.111237422f,
+    0.180670291f, -0.288281679f, -0.0184375774f, -0.0170544665f,
+    -0.494966f, 0.0922488719f, -0.0633336753f, 0.0776632279f,
+    -0.0101230647f, 0.0714806095f, 0.105895154f, 0.135715351f,
+    0.159279525f, 0.137922704f, -0.122433193f, -0.0751764923f,
+    -0.0957918838f, 0.171120837f, 0.0866022706f, 0.136197925f,
+    -0.172410101f, -0.130760014f, 0.187754527f, -0.103003018f,
+    0.0765282437f, -0.141615033f, 0.111439221f, 0.0573175699f,
+    0.0670374259f, 0.0681392401f, 0.189901158f, 0.164297551f,
+    0.0116916923f, -0.404582381f, 0.0824492425f, -0.0542783998f,
+    -0.241585746f, 0.0341053158f, -0.0240501277f, 0.158812836f,
+    -0.016808223f, -0.00473950198f, 0.111932442f, -0.0179016925f,
+    0.012612598f, -0.0777311549f, -0.162807882f, -0.361305594f,
+    0.0057954425f, -0.653303027f, -0.054054372f, 0.23716931f,
+    -0.352062732f, -0.0873170346f, -0.148326233f, 0.0313854739f,
+    -0.0135849714f, -0.0592457019f, 0.0270242281f, -0.00617585145f,
+    -0.000534193183f, -0.00652372139f, -0.366591245f, -0.342417359f,
+    -0.0457566902f, -0.0468232483f, 0.102010913f, -0.0585299283f,
+    -0.0800580904f, 0.258291751f, -0.0578997657f, 0.128415599f,
+    -0.0125336451f, -0.363562703f, -0.10420645f, 0.206280023f,
+    -0.152120307f, -0.129601046f, -0.140356287f, -0.173235521f,
+    -0.168048739f, 0.0549286604f, 0.0760984421f, 0.0373537354f,
+    -0.375244439f, 0.0515287146f, -0.145953804f, -0.0286341105f,
+    -0.0554631278f, -0.192933962f, -0.12337067f, -0.0701174363f,
+    -0.0843414366f, -0.0618575625f, 0.0394046046f, -0.0409459174f,
+    -0.188202456f, -0.284853458f, -0.197843239f, 0.0955797285f,
+    -0.145093635f, -0.0230660532f, -0.049420964f, -0.360909402f,
+    0.0565801561f, 0.0668277442f, 0.00341851264f, 0.086977087f,
+    0.0101546291f, -0.0611675642f, -0.137029663f, -0.154773846f,
+    0.063443847f, -0.227937579f, -0.216312051f, -0.899273932f,
+    -0.414769739f, -0.540088475f, -0.112969965f, -0.0713480338f,
+    0.0526275933f, 0.0884883627f, -0.171283126f, -0.133753225f,
+    0.0192447565f, 0.0884481892f, -0.249874815f, 0.011027283f,
+    -0.0191175435f, -0.542939723f, 0.0104136411f, -0.503874362f,
+    -0.61822629f, -0.384422958f, 0.0706357732f, -0.124996416f,
+    0.057561487f, 0.242859855f, -0.0540242754f, -0.100944959f,
+    0.1898911f, 0.069830142f, -0.534006774f, 0.0141311865f,
+    0.209408998f, -0.0736632794f, 0.264799714f, -0.157898784f,
+    -0.373515725f, 0.0669636354f, -0.006051003f, 0.285684824f,
+    -0.0315379128f, 0.0963471159f, 0.247433886f, 0.0607794598f,
+    0.140882477f, 0.156179816f, -0.655965567f, 0.0314552523f,
+    0.0039842613f, -0.196061239f, 0.251805067f, -0.155852392f,
+    -0.48394078f, 0.0610877164f, 0.244127586f, -0.356762946f,
+    0.0268644504f, 0.0436009653f, 0.131728992f, 0.135545641f,
+    0.130183682f, -0.0343146324f, -0.0889727399f, -0.0416782461f,
+    0.229825512f, -0.207312226f, -0.0193446577f, 0.134863183f,
+    -0.330226272f, -0.154389188f, 0.0961951986f, 0.043454662f,
+    -0.000277092069f, 0.0617014728f, 0.239312589f, -0.0203137305f,
+    0.0251115616f, 0.234029323f, -0.00631180126f, -0.0877712518f,
+    -0.0127569046f, -0.0315656215f, 0.254852414f, 0.115739301f,
+    -0.038851276f, -0.0370198749f, 0.161255419f, 0.353415132f,
+    0.0326427333f, -0.0739664286f, 0.0766849071f, -0.0208500456f,
+    -0.185519144f, 0.0155718373f, -0.257888198f, 0.0231397338f,
+    -0.0567054451f, -0.317325741f, -0.0615733266f, -0.100088321f,
+    0.0216725748f, 0.00137202197f, -0.0424391888f, -0.0386637747f,
+    -0.0542301051f, -0.0594133921f, -0.135278583f, 0.239801303f,
+    0.0466607735f, -0.089016825f, -0.0266835559f, -0.309192389f,
+    0.0359176323f, 0.306177676f, 0.160721913f, 0.031242352f,
+    0.216291577f, 0.221695274f, 0.132855475f, -0.127108276f,
+    -0.00182120013f, 0.0375669785f, 0.0353787132f, -0.0998265445f,
+    0.0145204887f, -0.0728316158f, 0.0505476296f, 0.188210294f,
+    -0.132179976f, 0.165301397f, 0.147713304f, 0.242553547f,
+    0.248436332f, 0.164356768f, -0.0430014096f, 0.0563129522f,
+    0.0647611171f, -0.256696522f, -0.0604570359f, -0.0282446314f,
+    -0.307011485f, -0.228251189f, 0.0247263238f, 0.00857959036f,
+    -0.071850054f, 0.458270788f, -0.0259832311f, -0.106225386f,
+    -0.187150598f, 0.14491193f, 0.0135794664f, -0.290515065f,
+    -0.070297353f, -0.0729285553f, -0.0073095453f, 0.0271365121f,
+    0.0675173029f, -0.0268459059f, -0.0180216543f, 0.175195009f,
+    0.162432164f, 0.00408635847f, 0.0741255879f, 0.281986892f,
+    -0.182824835f, 0.0226660836f, 0.0274914484f, -0.0170404948f,
+    -0.00444807624f, 0.277893454f, 0.160624832f, 0.179886088f,
+    0.171972781f, 0.167273164f, 0.0650873482f, -0.00698343199f,
+    0.214788198f, -0.387135386f, 0.138814107f, 0.68248862f,
+    -0.432724833f, -0.00656933617f, 0.0320214182f, 0.101623215f,
+    0.0633386001f, 0.0259339511f, 0.249054134f, -0.216103882f,
+    -0.0557913184f, -0.0128378058f, 0.0524144508f, -0.127763286f,
+    -0.0642313361f, 0.0523371212f, 0.0624010712f, -0.152319968f,
+    0.203104317f, 0.262443036f, 0.0425915942f, 0.201173261f,
+    0.010815273f, -0.265099049f, 0.0761353448f, 0.170167133f,
+    -0.0297680963f, -0.162849098f, 0.106062785f, 0.166160241f,
+    0.110139452f, -0.131671965f, 0.136445031f, 0.254757881f,
+    0.168685138f, 0.146095395f, 0.163610086f, 0.452485859f,
+    0.0351193361f, 0.0443629473f, 0.125554904f, -0.0701959953f,
+    -0.116493642f, 0.0335011818f, -0.0668802634f, -0.083333306f,
+    -0.120193042f, -0.285741836f, -0.0918687508f, 0.613083184f,
+    -0.390114844f, -0.335232943f, -0.165997058f, -0.149135545f,
+    0.0217632167f, -0.367805004f, -0.224217147f, -0.19877246f,
+    -0.235302672f, -0.115131848f, -0.120320007f, -0.435851127f,
+    -0.201416835f, -0.0444730446f, -0.269272029f, -0.531715095f,
+    -0.113270342f, 0.121971384f, -0.284446478f, 0.261825681f,
+    -0.0162143409f, -0.313540071f, -0.304952323f, -0.347902775f,
+    -0.218422383f, -0.0650756583f, 0.0571960174f, -0.0603872053f,
+    -0.257604361f, -0.493531525f, -0.0232825335f, -0.288614988f,
+    -0.574020445f, -0.156794876f, -0.157078698f, 0.16302f,
+    0.00713795424f, -0.321265817f, -0.394472301f, -0.0921206698f,
+    -0.2037016f, -0.094739072f, -0.059872333f, -0.350609332f,
+    -0.206825361f, -0.398551434f, -0.24804385f, -0.172289357f,
+    -0.44282648f, 0.0378953516f, -0.0520317666f, -0.447358906f,
+    -0.0657301471f, 0.171105668f, -0.124826021f, 0.0348935537f,
+    0.173309445f, 0.165217072f, -0.0992138535f, -0.0130396914f,
+    0.0853723884f, 0.00705381902f, -0.0396116786f, 0.298764914f,
+    -0.383788258f, -0.295779794f, -0.0574612245f, -0.0315169804f,
+    -0.0572641492f, 0.0783993006f, 0.0880478993f, -0.0887519643f,
+    -0.0652309433f, -0.0633785874f, -0.38337481f, -0.0462317914f,
+    -0.106894821f, -0.0341713354f, 0.187688217f, -0.0811937228f,
+    0.132537469f, 0.147068396f, -0.107682027f, 0.247541636f,
+    0.0353172831f, -0.155660331f, -0.0616995245f, 0.299221903f,
+    -0.152170181f, -0.203742102f, -0.184604764f, -0.00330138626f,
+    0.0750457942f, 0.0758222416f, 0.184423894f, 0.377164632f,
+    0.433442324f, 0.201946601f, 0.109807819f, 0.0203717854f,
+    -0.0361873135f, 0.0407058336f, 0.0529356226f, 0.098688595f,
+    0.0868429765f, -0.0219149906f, 0.0271709338f, 0.00320885633f,
+    0.00701355841f, 0.415687501f, 0.135040164f, 0.160413727f,
+    0.171213776f, -0.166779265f, 0.0874485672f, -0.318651736f,
+    0.0233349316f, -0.0354961008f, -0.0288443957f, -0.0364057235f,
+    -0.0375223495f, -0.0249140505f, -0.0214277804f, 0.191208392f,
+    -0.0235774517f, 0.181926146f, -0.139207825f, 0.104575515f,
+    -0.155951113f, -0.212007895f, -0.167668909f, 0.0427117534f,
+    -0.0819257498f, -0.204159454f, -0.00534290448f, -0.240489468f,
+    -0.255949199f, -0.221608892f, -0.0293697044f, 0.0766009688f,
+    -0.0924272984f, -0.255505085f, -0.0443987474f, -0.217051655f,
+    0.187345952f, 0.157116055f, -0.343365699f, 0.32733807f,
+    -0.0260362737f, -0.149667218f, -0.133579493f, -0.052396372f,
+    -0.237477586f, -0.0526714884f, -0.0970478058f, -0.182446107f,
+    -0.072472617f, 0.277174234f, 0.0788282752f, -0.386105925f,
+    0.704723954f, 0.149489224f, 0.281269193f, 0.219218999f,
+    -0.0788144767f, -0.0118845543f, -0.00982467923f, 0.0721118227f,
+    0.00262713712f, 0.0559903979f, 0.143677607f, 0.271824002f,
+    0.0400835834f, 0.355343252f, -0.0327467546f, -0.354034424f,
+    0.334982455f, -0.178479403f, 0.115489349f, -0.175738931f,
+    -0.000910669565f, 0.15049085f, 0.0965466499f, 0.167328253f,
+    0.191324577f, 0.00952116121f, 0.0599216558f, 0.361776471f,
+    0.0471961126f, 0.226595566f, -0.226482585f, -0.0160735846f,
+    -0.0525912121f, -0.322096139f, 0.0957100764f, -0.322738022f,
+    -0.00619812822f, 0.151612476f, 0.0518928729f, -0.152381629f,
+    0.0947824717f, 0.0643377453f, -0.10858807f, 0.273003817f,
+    0.0767668709f, 0.384680837f, 0.116432346f, 0.37147209f,
+    -0.124889031f, -0.0935222283f, 0.253475487f, 0.0703645349f,
+    0.0550290048f, -0.157760978f, 0.188312754f, 0.0121755451f,
+    0.0148742758f, -0.0593928657f, -0.182642892f, 0.312832415f,
+    -0.147216737f, -0.41673097f, -0.0997151583f, -0.152065024f,
+    -0.377787501f, -0.03097721f, -0.0591435805f, -0.228671491f,
+    -0.0563318655f, -0.0599545576f, -0.251935512f, 0.0519943312f,
+    -0.166335911f, -0.0970849991f, -0.002150557f, -0.289206296f,
+    -0.135204807f, -0.408769935f, 0.0642625764f, -0.142156258f,
+    0.0594987832f, 0.134469464f, 0.0955527946f, -0.582565188f,
+    -0.0284812562f, 0.296162665f, 0.0765528455f, 0.397027701f,
+    0.339166373f, 0.156526893f, -0.39508149f, -0.0890492722f,
+    0.0645375624f, -0.327239603f, 0.0290314518f, 0.083092615f,
+    -0.0519668609f, 0.00465573044f, -0.229904518f, 0.0683100373f,
+    0.0782198161f, -0.314699382f, -0.0437262505f, 0.00798056833f,
+    -0.240818679f, -0.166396007f, -0.0702384785f, -0.246258199f,
+    -0.443521619f, -0.400863767f, -0.048420243f, -0.239796788f,
+    -0.110785797f, 0.0325833298f, -0.100385487f, -0.613703847f,
+    -0.0290191676f, -0.0837593675f, -0.177424952f, 0.202910259f,
+    0.0712342411f, -0.0420622267f, 0.0820105672f, -0.470022976f,
+    0.138060287f, -0.650543034f, 0.00260444684f, 0.0568996929f,
+    -0.152249262f, 0.0325726047f, 0.0620326027f, -0.640532613f,
+    0.077931121f, 0.346406221f, 0.187541693f, 0.293882877f,
+    0.316522807f, 0.268378913f, -0.32722351f, 0.00246809586f,
+    -0.407900453f, -0.424197257f, -0.25352186f, -0.117467374f,
+    -0.238001168f, 0.0365279317f, -0.41664809f, -0.330919325f,
+    -0.0108363535f, -0.303944349f, -0.576735795f, -0.000724816637f,
+    -0.0577054992f, -0.165739566f, 0.0412490331f, -0.424898207f,
+    0.0676277652f, -0.310048521f, -0.11432334f, -0.0352622829f,
+    -0.285867512f, 0.116318889f, -0.206758842f, -0.539586961f,
+    -0.0669373497f, 0.0688169003f, -0.0223714672f, 0.313611239f,
+    0.0241227634f, -0.0305971038f, -0.0153803071f, -0.248476833f,
+    0.191772282f, -0.035742715f, 0.00351684028f, 0.251029015f,
+    -0.113098182f, -0.13262178f, 0.263296992f, -0.746741354f,
+    0.0630902573f, 0.134820133f, 0.211888388f, 0.0509083904f,
+    0.123632409f, 0.179090902f, 0.112753704f, 0.119462781f,
+    0.242742896f, -0.063870199f, -0.0383190587f, 0.204098225f,
+    0.074134253f, -0.0587219521f, 0.0432010293f, -0.217505693f,
+    0.0334609076f, 0.148710966f, 0.13231425f, -0.00920328498f,
+    -0.0678510368f, -0.0812892765f, -0.265838891f, -0.0682419166f,
+    0.060625907f, 0.251089245f, 0.0539423823f, 0.264149457f,
+    0.194283277f, -0.0339603387f, 0.10855528f, -0.247959986f,
+    0.0674521253f, -0.129765585f, 0.0740417913f, 0.00963784102f,
+    -0.225602761f, -0.0774280056f, -0.280486286f, 0.0346719474f,
+    -0.135236159f, 0.190606236f, -0.00174366799f, 0.0643664375f,
+    0.123777777f, -0.157619745f, -0.0207770225f, -0.347106844f,
+    -0.00932912063f, 0.0177870318f, -0.131766155f, -0.0800838694f,
+    -0.179306582f, -0.153023869f, -0.0946374834f, 0.1689329f,
+    0.0167856161f, 0.189777732f, -0.115217261f, -0.135872245f,
+    0.103248365f, -0.115020685f, 0.11892274f, -0.190069318f,
+    0.072942704f, -0.0338309184f, -0.00323243439f, 0.0307718571f,
+    -0.116811797f, -0.0532104634f, 0.104981102f, 0.0895964503f,
+    -0.00771056395f, 0.168270767f, -0.0520131923f, -0.267447591f,
+    0.122660063f, -0.0110915853f, -0.0200587101f, -0.124724753f,
+    0.0692173466f, -0.0114290388f, 0.0854750574f, -0.151910156f,
+    0.0295043085f, 0.0689924359f, -0.0221931655f, 0.121110663f,
+    -0.069365561f, 0.182896465f, 0.0031229821f, -0.171410277f,
+    0.369106799f, -0.102832168f, 0.176572308f, 0.0183262378f,
+    -0.0208952334f, 0.0333788618f, 0.0193482582f, 0.0920557901f,
+    0.0686328709f, -0.0787804499f, -0.051027596f, 0.216712147f,
+    0.231419325f, -0.480591506f, 0.138527408f, 0.126615614f,
+    0.0173947122f, 0.0574715398f, -0.0980419889f, 0.253669411f,
+    -0.0219740979f, -0.0286119319f, 0.155019104f, -0.0212106295f,
+    -0.0108072786f, 0.0940586776f, -0.486942887f, -0.249496669f,
+    0.095176056f, -0.421323895f, 0.265091151f, 0.0108344322f,
+    0.487672299f, 0.116581485f, 0.0211247001f, 0.557637334f,
+    0.072196871f, -0.199147642f, 0.109744832f, -0.0457362644f,
+    -0.25199312f, -0.139193594f, -0.242305353f, -0.0253386255f,
+    0.0200755335f, 0.00860446785f, 0.121533632f, -0.112077489f,
+    0.646210849f, 0.201387882f, 0.00440194644f, 0.359876782f,
+    -0.0512337498f, -0.185148433f, 0.0143584935f, 0.150959715f,
+    -0.0903016552f, -0.04167898f, 0.0662314668f, -0.00687167747f,
+    -0.112383842f, -0.204540029f, 0.144959688f, -0.146276429f,
+    0.284658879f, 0.176780134f, -0.192534164f, 0.218036294f,
+    0.0636476502f, -0.122819498f, -0.0900160745f, -0.106152847f,
+    -0.25678131f, -0.104421996f, -0.176359788f, -0.255713433f,
+    -0.348414391f, -0.27053535f, -0.0961265936f, 0.217199013f,
+    0.186399773f, 0.0300688799f, 0.149368733f, -0.156133011f,
+    0.0547292456f, -0.0160701945f, -0.198108375f, 0.287997365f,
+    0.0577512681f, -0.0927809849f, 0.15470688f, -0.174999893f,
+    0.0977509767f, 0.10358721f, -0.177978396f, 0.493487448f,
+    -0.149458289f, -0.0869429111f, 0.0850561112f, -0.453259319f,
+    0.0277806818f, 0.0631697923f, 0.0131771034f, 0.0743941814f,
+    0.118713185f, -0.03032385f, 0.0236642472f, 0.0836903155f,
+    -0.203729272f, -0.297659516f, -0.0433525816f, -0.380052537f,
+    0.051074896f, 0.231487468f, 0.0182184856f, -0.0212200917f,
+    -0.0108660366f, 0.0375467911f, -0.24369131f, 0.195798755f,
+    -0.0105895344f, -0.041016832f, -0.28778249f, -0.168026134f,
+    0.353672087f, -0.283372134f, -0.00619009789f, 0.336917162f,
+    -0.171641156f, -0.259330958f, 0.00280209724f, -0.240328461f,
+    0.0309484005f, 0.14254728f, 0.232450873f, -0.000241553862f,
+    0.183352977f, 0.108537391f, -0.18318519f, -0.140840352f,
+    0.0850485861f, -0.233814865f, 0.0654648468f, 0.52176851f,
+    0.0568571687f, -0.112208493f, -0.0196371432f, -0.153618455f,
+    -0.0138051314f, -0.0120815532f, 0.0612113364f, -0.1344928f,
+    -0.0547696799f, 0.0213187411f, 0.0280534979f, -0.136581674f,
+    0.427130103f, -0.141331747f, 0.222991273f, 0.30946961f,
+    -0.241467848f, -0.13255538f, -0.109527931f, 0.384108573f,
+    -0.03677411f, 0.0784809366f, 0.253040731f, 0.0403277911f,
+    0.131052569f, 0.162784919f, -0.118461974f, -0.0843009576f,
+    0.113063544f, -0.0327394679f, 0.271251261f, 0.315313816f,
+    0.0332126431f, -0.0649587736f, 0.0752095804f, 0.135064751f,
+    0.0356452875f, 0.023577176f, 0.124343738f, 0.0162499622f,
+    0.0841937214f, 0.0547386967f, 0.0241963137f, 0.0817987546f,
+    -0.250963956f, -0.326368511f, -0.0274095964f, 0.0403204374f,
+    -0.511161327f, -0.0983000472f, 0.041419372f, -0.289555222f,
+    -0.046652399f, -0.0204802621f, -0.1300392f, -0.0449057855f,
+    -0.122077823f, -0.0774072558f, 0.183029473f, -0.239470273f,
+    0.0632463992f, -0.514396906f, 0.0536458306f, 0.306268096f,
+    -0.048682142f, -0.158501923f, 0.11870344f, -0.290657073f,
+    -0.0193839371f, 0.13938497f, 0.0518814512f, -0.0557665862f,
+    0.128948629f, 0.142311066f, -0.344575912f, -0.109539568f,
+    0.138601869f, -0.000342536165f, 0.148526445f, 0.264395148f,
+    -0.0436207242f, 0.0355540924f, 0.00350900367f, 0.0466267727f,
+    -0.0796391591f, -0.0600649603f, 0.157838047f, 0.101083547f,
+    0.0255314447f, -0.0686100423f, 0.0518592447f, 0.0212076958f,
+    -0.030435212f, 0.122209065f, 0.0350950249f, -0.0635610968f,
+    -0.0207914691f, -0.0319644846f, -0.0310948268f, -0.14317058f,
+    -0.0299057476f, -0.165726632f, -0.122722194f, -0.0278105047f,
+    0.0229011662f, -0.172246754f, -0.0612303279f, -0.0697902068f,
+    0.322339892f, -0.0110723441f, 0.195199937f, 0.387088835f,
+    0.357048988f, 0.0320800543f, 0.162200078f, 0.0538299643f,
+    -0.0254649129f, 0.244961649f, 0.0927962884f, 0.0150613803f,
+    0.140075564f, 0.123089731f, -0.0837523639f, 0.213797718f,
+    -0.141778111f, 0.139126033f, 0.037514735f, -0.0694024414f,
+    -0.0256884806f, -0.166387469f, 0.0166992135f, -0.0189067367f,
+    0.0436475389f, 0.00225594128f, -0.121061958f, -0.0202734116f,
+    -0.0443364345f, 0.0573630184f, 0.159201264f, -0.159815535f,
+    -0.115999661f, -0.349570572f, -0.0659699365f, -0.47098434f,
+    -0.0410435721f, 0.115261704f, -0.261108041f, -0.169691205f,
+    -0.0294083953f, -0.313837141f, -0.168319538f, -0.0237740334f,
+    0.0192780495f, -0.147097751f, -0.0705443919f, -0.54207623f,
+    -0.158004299f, 0.0963977128f, 0.177528679f, -0.0926735848f,
+    0.377668083f, 0.180810332f, -0.013378338f, 0.139349297f,
+    0.0185581651f, -0.106784828f, -0.00599296717f, 0.086274147f,
+    -0.0361903496f, -0.180386692f, 0.252320021f, 0.00554296095f,
+    -0.200514928f, -0.112979144f, -0.0325463228f, -0.216982037f,
+    0.479321361f, 0.0768931583f, 0.133059353f, 0.0363681056f,
+    0.0305103566f, -0.081507735f, -0.2385405f, -0.210224524f,
+    -0.165213063f, -0.0357429944f, 0.019886069f, -0.00857497007f,
+    -0.262805879f, -0.0398471653f, -0.279316217f, 0.116205081f,
+    -0.317933917f, -0.147507071f, -0.46112904f, -0.134298846f,
+    0.0715472698f, -0.474196315f, -0.358549029f, -0.278085262f,
+    -0.485250294f, -0.353302687f, 0.15170598f, -0.454653233f,
+    -0.245812237f, -0.189207479f, -0.262065083f, -0.410117835f,
+    0.326577067f, 0.113543898f, -0.00893641915f, -0.355742574f,
+    -0.00763085485f, 0.0794240609f, -0.327811897f, 0.12506038f,
+    0.0284923874f, -0.160098881f, -0.308859527f, -0.0204869527f,
+    0.0697916299f, 0.0950375646f, -0.305773288f, 0.0273625795f,
+    -0.417375356f, -0.562161386f, 0.0412913896f, -0.286197007f,
+    0.0606615469f, 0.0397956893f, 0.0370550677f, -0.101585776f,
+    0.118668154f, -0.0934690163f, -0.153771088f, 0.0700056329f,
+    0.0450177714f, 0.17235525f, 0.016902931f, 0.120553002f,
+    -0.221280098f, -0.496671379f, -0.0302098319f, 0.042689316f,
+    0.0548443906f, 0.257247716f, 0.0797750801f, 0.0671577305f,
+    0.185356259f, 0.218432233f, -0.60012418f, 0.0080755651f,
+    -0.0501305945f, 0.00842665229f, -0.201551199f, -0.565093756f,
+    -0.133644938f, -0.208310008f, -0.0182163157f, -0.218256012f,
+    -0.0809152871f, 0.230050951f, 0.0370143875f, -0.0145914257f,
+    0.230016112f, 0.108216189f, -0.173483327f, 0.0509265251f,
+    0.147831514f, -0.151108548f, 0.0327337272f, -0.540854514f,
+    -0.241226196f, -0.365537822f, 0.125204295f, -0.553783059f,
+    0.0782298371f, -0.0169419423f, 0.0695581585f, -0.00122877513f,
+    -0.0104238261f, 0.0446749777f, -0.052250579f, 0.0825370997f,
+    0.130842462f, -0.0778290704f, 0.165714264f, -0.187794968f,
+    -0.327184081f, -0.411287367f, 0.134979025f, -0.295188069f,
+    -0.00236779451f, 0.208481535f, 0.22777018f, -0.153889999f,
+    0.198103383f, 0.130222008f, -0.330093473f, -0.0448445119f,
+    -0.0345316753f, -0.163139924f, 0.0273502078f, -0.15667592f,
+    -0.253686845f, -0.213234991f, 0.150945827f, 0.107495792f,
+    -0.0817497f, -0.0490342639f, 0.0826628879f, 0.229909852f,
+    0.0307352692f, 0.0256604515f, -0.260973841f, 0.196419656f,
+    -0.070632115f, -0.126989096f, -0.0137281688f, -0.309494197f,
+    -0.272003353f, -0.248672664f, 0.0584697351f, -0.185357809f,
+    0.0217950158f, -0.0502841733f, -0.0536417626f, 0.264694035f,
+    0.0680931881f, 0.0163390357f, -0.324369848f, 0.0473773964f,
+    -0.0879191235f, 0.296811581f, 0.12823604f, -0.190681443f,
+    0.259787291f, 0.105138376f, 0.254440188f, -0.13578245f,
+    -0.0824597999f, 0.0610143505f, 0.0977935344f, 0.206465572f,
+    0.172114879f, 0.0134180952f, -0.0930614024f, 0.345744431f,
+    -0.450479835f, -0.328469425f, -0.189254895f, -0.480420023f,
+    0.51111567f, 0.209713534f, 0.13609536f, -0.412743777f,
+    0.0490663759f, 0.172548652f, -0.236501962f, 0.375696778f,
+    0.220921591f, 0.121838495f, -0.391858846f, -0.23438099f,
+    0.0890332013f, 0.171432659f, -0.0868731067f, 0.479613274f,
+    -0.405511796f, -0.398916006f, 0.242624849f, -1.00107872f,
+    -0.0773288906f, 0.186846972f, 0.0675877854f, 0.000965013634f,
+    0.162503973f, 0.0940314531f, -0.32239753f, 0.0790496767f,
+    0.189190775f, -0.0170443505f, -0.0463424399f, 0.380522281f,
+    -0.0555028766f, -0.0676398873f, -0.0677193105f, -0.146905571f,
+    -0.0368743651f, -0.115971006f, 0.153818935f, -0.112686314f,
+    -0.143810898f, -0.150326312f, -0.24943386f, -0.189522728f,
+    -0.270678163f, -0.218637139f, -0.19138056f, -0.301707238f,
+    0.470829427f, 0.0959967449f, 0.0563674718f, -0.208313286f,
+    -0.00170993805f, 0.143158808f, -0.140470266f, 0.0648756027f,
+    -0.0373543985f, 0.0709975511f, -0.0928135663f, -0.215803862f,
+    -0.168253481f, 0.243172869f, -0.0157520641f, 0.0346940048f,
+    0.301063329f, -0.0613654591f, 0.170388713f, -0.544110179f,
+    0.0163891613f, -0.00875292998f, -0.183284447f, 0.0530247167f,
+    0.100052305f, 0.0366683938f, 0.0866620019f, 0.0530212633f,
+    -0.0581373759f, 0.313179642f, -0.352443755f, 0.00393183623f,
+    -0.130037054f, -0.313985676f, -0.0774816498f, -0.638037264f,
+    0.0441204719f, -0.0481350236f, -0.106246725f, -0.170513004f,
+    -0.0200655386f, -0.0798986554f, -0.23140119f, 0.0273279063f,
+    -0.306895077f, -0.397928208f, -0.000158520677f, -0.446487427f,
+    0.159153819f, 0.0185056813f, -0.139022753f, -0.0338323042f,
+    0.0650424585f, -0.103138089f, -0.135556027f, 0.0777383447f,
+    0.0347023495f, -0.0896312371f, -0.03338857f, -0.439936429f,
+    -0.172596633f, 0.137696013f, 0.0283299163f, -0.318015724f,
+    0.133624479f, -0.0998676792f, 0.105626725f, 0.0657676533f,
+    0.0651385188f, -0.107169643f, -0.102766067f, 0.176309302f,
+    0.148746252f, 0.0446125902f, -0.0435154028f, 0.152258724f,
+    0.184208885f, 0.299364209f, 0.114244714f, 0.152232379f,
+    -0.0717543438f, -0.124083154f, 0.164342776f, 0.434672028f,
+    0.0636454448f, 0.0806957036f, 0.0465691574f, -0.0835268125f,
+    -0.00326044299f, -0.0420196131f, 0.0880348235f, 0.212215021f,
+};
+
+// One entry per layer; only convolutions of 4 or more input channels have one
+static const float* const mnist_cnn_ohwi[5] = {
+    NULL,
+    NULL,
+    mnist_cnn_layer2_ohwi,
+    NULL,
+    NULL,
+};
+
+#endif // MNIST_CNN_OHWI_H
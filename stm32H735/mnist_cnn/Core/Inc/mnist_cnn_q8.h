@@ -0,0 +1,1328 @@
+// Generated by snn_core/Tools/snn_quantize from the mnist_cnn weights.
+// Regenerate with the snn_q8_headers target after retraining the model.
+#ifndef MNIST_CNN_Q8_H
+#define MNIST_CNN_Q8_H
+
+#include <stddef.h>
+#include "snn_quant.h"
+
+static const int8_t mnist_cnn_layer0_weights[144] = {
+    14, -41, 93, 87, 104, -6, 127, -89, -110, 60, -123, -97, 127, -5, -66, 91,
+    44, 49, 98, 127, 17, 37, -12, 101, -74, -109, -96, 97, 50, -47, 127, -39,
+    -97, 73, -59, -97, 37, 68, -17, -24, 77, 25, -127, -53, 48, 18, 32, 60,
+    -15, 64, 102, -127, -125, -34, 88, 127, -119, 54, 63, 27, -14, 28, 82, 61,
+    120, 105, -2, -33, -32, -95, -127, -57, -41, -14, 69, -127, -58, -71, -94, 6,
+    -79, -127, 75, 23, 85, 94, 40, 88, 111, -7, 21, 63, 30, 127, -17, 68,
+    57, -49, -81, 90, 4, 107, -79, -54, 127, -69, -22, 93, 94, -14, 75, 7,
+    127, 93, 78, 89, 75, -48, 48, 83, 127, 20, -3, 18, 57, 16, -48, -121,
+    24, 52, -127, -117, 62, 15, -64, 77, -111, -127, 114, 127, 4, 46, 0, 54,
+};
+
+static const float mnist_cnn_layer0_scales[16] = {
+    0.00496799545f, 0.00618982315f, 0.0040125791f, 0.00640029972f,
+    0.00691348827f, 0.00656797644f, 0.00406946475f, 0.00642390968f,
+    0.00239609741f, 0.0041106469f, 0.0062477421f, 0.0048008766f,
+    0.00418826798f, 0.00377338519f, 0.00998330768f, 0.00599344354f,
+};
+
+static const int8_t mnist_cnn_layer2_weights[4608] = {
+    -8, -19, 21, -76, -21, 30, -39, 0, 6, -43, -39, 24, -7, -57, 50, 29,
+    -23, 46, -26, -24, 12, -54, -21, -3, -27, -19, -7, 29, 17, 93, -4, 22,
+    84, -34, 25, 58, -5, -6, -29, -21, 34, -18, -8, -18, -50, 20, 36, -5,
+    -9, 14, -39, -3, -18, -52, -48, -9, 38, -40, 22, 18, -13, -8, 24, -44,
+    -50, -91, -45, -120, -81, -66, -127, -64, -8, -9, -5, 5, 11, -4, -9, -8,
+    -1, -53, 6, 5, -53, 28, 27, 0, 21, 10, -41, -6, 34, -82, 2, 28,
+    -19, -10, 7, -3, 43, -2, -6, 47, -4, 5, 8, -9, -25, 32, 16, -32,
+    25, 16, -13, 0, 7, -21, 2, 14, -35, 7, 20, 3, 19, 10, 7, -29,
+    -26, 36, -22, -8, 21, -29, 38, -66, -22, 39, -60, -38, 49, -12, -5, 17,
+    -22, 29, -9, -5, 36, -4, -40, 8, -3, -65, 11, 31, -40, 50, 22, -21,
+    39, 1, -35, 19, 16, -8, 7, -33, 9, 3, -10, 24, 30, 34, 29, 25,
+    36, -57, 7, 4, 24, -43, -16, 53, -55, -50, 21, 28, -24, -12, -41, -33,
+    12, -81, -52, 11, 12, -8, -5, 23, 10, 28, 36, -4, 1, 13, -8, -127,
+    -33, -35, -92, -99, -73, -78, -2, 32, -4, -8, 6, 13, -5, -8, 11, 3,
+    -10, 2, 23, -21, 4, 9, -36, 16, 20, -10, -15, 28, -14, -11, 12, -5,
+    -4, -1, -16, 19, 0, -17, 46, -15, -18, 30, 1, -46, 17, 18, -32, 10,
+    22, -48, 4, 15, -5, 8, 19, -22, 0, 4, -34, 7, -12, -17, -29, -4,
+    10, 3, 27, 13, 22, -34, -38, -35, -12, 2, 0, 36, -15, -31, 22, 0,
+    13, 45, -19, -76, -9, -7, -14, 3, 20, 47, 74, -29, 11, 94, 48, -90,
+    38, -2, -32, -5, -30, 13, -25, -19, -38, 18, 44, 68, 56, -3, -101, -4,
+    0, -92, -57, -7, 60, -20, 83, 127, 36, 11, -24, 52, 39, 12, -16, 8,
+    33, -14, -62, -52, 17, 21, 39, -12, -39, 31, 35, -14, -39, 18, 4, -123,
+    -79, 9, 15, 21, 24, 3, 55, 98, -15, -1, 7, -16, -10, -9, 12, -9,
+    15, 20, -29, -16, -32, 24, 29, 2, 10, 5, 0, 4, -29, -24, -18, -18,
+    -16, 34, 26, -9, -15, -19, 36, 12, 19, -25, -12, -9, 13, -45, -61, 1,
+    14, -10, 4, -4, -11, -9, -5, -63, -17, -14, 5, 11, -25, 7, -3, 2,
+    12, 17, 71, -126, -6, -38, -36, 24, 42, -24, 14, 61, 52, -55, 48, 11,
+    -6, 39, 20, 44, 32, -73, -7, 7, -40, -87, 33, 33, -59, 31, -38, 23,
+    18, 8, -13, 19, 5, -7, 24, -59, 8, -18, -27, 25, 80, 50, 62, 97,
+    -10, 65, 57, -71, -19, -89, -51, -73, -127, -112, -69, -99, 14, -30, -33, -47,
+    -63, -90, -21, -76, -39, 50, 19, 36, -4, 23, 25, -56, 17, 16, -19, -108,
+    -12, -55, -101, -77, -73, -56, 12, 45, 4, 10, -3, 0, 6, -6, -1, -12,
+    2, 51, 23, -75, 49, 25, -45, 32, -6, 28, 29, 54, -13, 21, 29, -58,
+    21, 7, -24, 33, -2, -87, 20, -34, -60, -14, -38, -36, 39, 30, -86, 21,
+    8, -81, 30, 15, 5, 34, 31, -36, 39, 3, -41, 15, -16, -15, -51, -2,
+    22, -68, -20, 0, -13, -68, -44, -34, 20, -4, -29, 20, -57, 6, 13, 25,
+    -56, -66, -35, -50, 52, 56, 75, 13, 13, -44, -6, -49, -42, -29, -63, -14,
+    -33, -50, -30, -26, -15, -12, -16, 43, 22, 27, 3, -104, -62, -90, -127, -66,
+    -17, 12, 16, 31, -36, -6, -94, -32, -34, -35, -117, -30, -99, -21, -52, -17,
+    11, 8, 40, -27, -24, -53, -58, -9, -16, -13, 24, -13, 13, 12, 2, 33,
+    59, -19, -21, -39, 94, 18, 21, 16, 1, -7, 8, 6, -2, 7, -13, -5,
+    10, -32, -26, 9, -26, 44, 48, 52, 17, -18, -41, -78, -41, -53, 36, 58,
+    47, 36, 23, -76, -58, 37, 26, -16, 31, -1, 25, -35, -67, -31, 14, 2,
+    23, 21, 21, 11, -40, -31, -11, 3, -19, 41, 44, 42, 18, 5, 6, 8,
+    -56, 2, -19, -60, -45, -3, -1, -31, 3, -9, -21, 27, -41, 28, -9, -27,
+    -64, -45, -30, 24, -13, -68, 47, 18, -9, -85, -18, -79, 40, 19, 78, 45,
+    71, 115, -3, -2, 49, -13, -36, -100, 13, 19, 27, -123, -91, -97, -35, -41,
+    -127, 31, -39, -91, -20, 29, 30, -48, 47, -38, 22, 62, 66, 23, 29, 79,
+    -49, 24, -13, -10, 15, 5, -72, -37, -61, 26, -1, -44, 15, 17, 35, 61,
+    28, 81, -40, -27, -16, 4, 6, 8, -13, -1, -10, 3, -12, 12, 13, -2,
+    3, -32, -56, -52, 34, -10, -20, 27, 14, -11, -67, -30, 7, 23, -5, -72,
+    43, 5, 15, -22, -46, 17, -14, -30, -31, 36, 1, -8, -64, -59, -35, 13,
+    5, -44, 15, 9, 29, -56, -38, -23, 21, -16, -43, 10, -7, -12, -17, -12,
+    9, -14, -11, 29, -21, -1, 23, -63, -37, -98, 37, 31, 28, 25, 55, 79,
+    61, 10, 42, -4, 30, -10, -10, -56, 0, 55, 26, 15, -59, -22, 33, 60,
+    -3, 8, 42, -11, 3, 90, 77, -2, -24, -50, -18, -70, -120, -46, -48, -90,
+    -56, -42, -49, 56, -23, -77, -6, 84, 109, 89, -10, 67, 11, -50, -28, -1,
+    50, 60, 30, -2, -21, 44, 57, -2, 12, 18, -22, -14, 10, -15, -20, 19,
+    -15, 33, 127, 106, 46, 29, 47, 109, -22, -22, 12, 11, 12, -24, -7, -6,
+    19, 41, -9, -2, -37, -45, -44, -19, 12, -19, 26, -14, -18, 42, 32, -24,
+    -18, -14, 28, -39, 38, 29, 14, 42, 25, -46, -37, 22, 3, 12, -1, -1,
+    -45, 15, -23, -44, 10, 42, 12, 2, -32, -39, -6, -6, 6, 10, -112, 38,
+    -62, -87, 27, -43, -49, -55, -52, 70, 51, 12, 4, 29, 50, 34, 25, -26,
+    19, -39, 2, 37, 12, -12, 0, 23, -8, 81, 9, -60, 45, 51, -2, -2,
+    54, 50, -31, -49, -10, 23, -49, -65, -10, -28, -21, 25, -43, -56, 13, -12,
+    18, -4, 27, 12, -43, 36, 7, 7, -16, -5, 14, 50, -59, -45, 11, 38,
+    -36, -1, -5, -38, -18, -44, 12, -26, -25, 44, -15, -5, 33, 1, 8, -15,
+    -20, 11, -75, -64, -109, -53, -94, -127, 9, -1, 0, -10, -10, -6, 11, 0,
+    -3, 21, -38, 4, 21, -16, -17, -3, 4, 12, 3, -30, 3, 18, 9, -14,
+    0, -11, -10, -67, -36, 35, 15, 20, -1, 22, 7, -22, -5, -53, -8, 27,
+    -7, -16, 8, 25, -3, 1, -29, -7, 9, -23, -10, -8, 2, -11, 23, 23,
+    6, 19, 4, -13, -27, 31, 26, 53, -6, -60, 62, 18, -14, 12, 41, 26,
+    -32, -27, -40, 41, 2, 11, -6, -10, 0, -35, -10, 18, 16, 3, 11, -33,
+    -63, -8, -6, -62, -43, 24, 15, -9, 36, 32, 32, -69, -127, -73, -31, -26,
+    -42, 5, -68, -10, -44, -115, -97, -26, -17, -18, 19, -6, 40, -13, -63, -53,
+    8, 4, -16, 29, 21, 28, -23, -20, -23, 9, 13, 4, 3, -11, 12, 53,
+    -56, -45, -18, 5, -4, 81, 46, 45, 10, -5, 3, -10, -1, -1, 9, -9,
+    -6, -12, -6, 0, 29, 18, 8, -30, -22, -12, -45, -48, -48, 45, 28, 6,
+    6, 8, 17, -4, -39, -9, 5, 6, -2, 19, 18, 8, -17, -12, -1, 18,
+    21, 7, -8, -3, 2, -23, -11, -7, 21, 16, -1, 9, -19, 0, -9, 0,
+    35, -23, -3, 2, 3, 4, 4, -31, -12, -1, 16, 26, 25, -14, -29, -11,
+    9, 25, 60, 22, 10, -82, 14, -50, 5, -36, 44, 18, 74, -27, -83, 106,
+    -49, 14, -50, 8, -7, 67, -32, -70, -63, -19, -114, -1, 4, -79, -8, -93,
+    -24, 29, -41, -81, -42, -4, 17, 7, -45, 43, -13, -42, -33, -52, -114, -7,
+    -9, 6, -3, -63, 28, -73, 44, -2, -43, -76, -19, -88, -9, -38, -51, 58,
+    -56, -7, 59, -72, 69, -54, 72, 17, 5, -46, 89, -73, 33, -2, 69, -59,
+    11, -51, -43, -58, -56, 24, 23, 38, 35, 33, -37, -79, 37, -13, -89, 29,
+    75, -108, 53, -91, -101, -9, -98, -14, 21, -20, -65, 39, -45, -50, -25, -14,
+    -65, 56, -24, 55, -34, -98, -59, -5, 30, -46, 14, -31, -89, -92, 25, -85,
+    -115, -64, -127, -114, -58, -80, -65, 6, -51, 77, 39, -61, 27, -57, -70, -6,
+    -10, -11, -5, 4, 22, 10, -5, -17, 12, 23, 31, -15, 22, -4, -31, -17,
+    -32, -38, -11, -31, -22, 21, 29, 39, 11, 19, 7, -7, -19, -59, -75, -40,
+    -43, -11, -19, 2, -64, -94, -127, -11, 23, 17, 2, 44, 50, -41, -60, -68,
+    25, 23, 18, 36, 45, 30, 28, 7, -5, 27, 13, 21, -43, -19, -26, -43,
+    -106, -72, 33, 60, 63, 50, 76, 72, -6, 7, -5, 3, -4, -8, -1, -9,
+    9, 24, 14, 9, 3, 24, 9, -50, -37, -38, 4, -8, -3, 18, 39, 21,
+    1, 14, -2, -11, 5, -4, 33, 16, 10, -7, -9, -3, 24, 1, 3, 5,
+    21, 23, -30, -43, -33, 22, -5, 16, -2, 8, 16, -10, -11, -14, -36, -35,
+    -17, -20, -18, -35, 10, 0, -6, 14, 7, -9, 26, 15, 7, -13, -29, -47,
+    25, -21, 11, 14, -11, -25, 19, -18, -23, -18, 37, 73, -127, -64, 94, -54,
+    -123, 28, 18, -2, -16, -49, 21, -18, 17, -14, 25, -46, -55, 32, 3, -54,
+    -28, 62, -22, -30, 36, 82, -8, -55, 107, 88, 30, 34, 104, 27, -3, -45,
+    -55, 18, -16, -20, -4, 50, -1, 41, 16, -21, 6, 22, -22, -14, -7, 43,
+    -16, 18, -44, 27, -46, 21, 19, 29, 12, 0, 13, 12, -14, 6, -10, 13,
+    -1, 4, 17, -13, 0, -7, -20, -19, -10, -7, 4, 3, 3, 3, 11, -38,
+    9, -4, 6, 12, 5, -37, -35, 3, -4, -17, 8, 42, 8, 8, -11, -3,
+    -1, -1, -33, -11, 9, 10, -2, -8, -6, -10, 4, 1, -29, 6, -10, -28,
+    -9, -21, -13, 29, -50, -7, 35, 16, 55, 45, -59, -31, 60, -48, -81, -20,
+    47, -22, 29, -62, 30, 93, 53, 80, -4, -50, -2, -58, -11, -73, -74, -7,
+    -5, -6, 32, 30, -50, -7, -27, 49, -71, 33, 51, -55, -3, 35, 25, 32,
+    91, 15, 124, 73, 66, 127, 10, 53, -33, -88, -71, -65, -68, 62, 24, -14,
+    9, -17, -54, -46, 0, -57, -74, 12, -19, -50, -34, -24, 19, 7, 1, 93,
+    74, -68, 23, -99, 12, -68, 42, 38, -8, -12, 15, -8, -15, -8, 4, 14,
+    17, -34, -50, -8, -73, 29, 50, 22, 32, -27, 20, -39, -23, -58, 17, 79,
+    -4, 44, 24, -53, -12, 37, 0, 57, -49, 22, 4, -19, -46, -30, 25, -82,
+    21, 10, 50, 26, -46, -41, -24, -1, -74, -11, 30, 41, 33, -36, -46, 9,
+    -71, -27, -91, -67, -46, -45, -15, -25, -3, -14, -28, -17, -29, 6, 23, 4,
+    -25, -12, -11, -18, 2, -13, -10, 1, 35, -12, -23, -49, -34, 33, 35, -33,
+    -1, 42, -19, -8, -16, -22, -6, -21, -3, 20, -3, -90, -127, -87, -94, -102,
+    -8, -43, -82, 43, -6, -30, -24, -51, -68, -107, -39, -53, -92, 27, 28, 1,
+    8, -16, -23, 20, -28, -30, -20, -10, 9, -6, 34, 11, 1, 20, 31, 20,
+    47, -15, -100, -123, -91, -50, -106, -119, 7, -11, 13, 13, 2, 2, 4, 7,
+    -2, -44, -26, -12, 22, 30, 18, -7, 3, 44, -31, -17, -19, -28, -4, -10,
+    -7, 0, 3, -13, -26, -30, 3, -8, 2, 36, 40, -6, -38, 8, -10, 33,
+    11, 5, 10, 34, 42, -11, 3, 22, 13, 27, 20, 1, 14, 14, 1, 26,
+    5, -31, 27, 46, -3, 12, 48, -13, -1, -17, 6, 54, 25, -20, 23, 19,
+    21, 35, 14, 29, 26, -7, 4, 5, -3, -41, -16, 9, -19, 35, -10, 49,
+    46, -12, -32, 21, 48, -7, 26, -9, 19, -27, -24, -9, 3, -43, 80, 69,
+    -31, 47, 46, 26, -30, -15, 40, -3, -47, 76, 67, 16, 73, -55, -14, 62,
+    -20, -43, 29, -5, -45, 52, 12, 2, 14, 24, 21, -21, 37, 24, -40, -47,
+    28, 58, -105, -10, 8, -108, -101, 36, -12, 5, -14, 10, -4, 15, -11, -8,
+    4, 9, 28, -6, 14, 4, -25, 0, 7, -30, -17, 23, 32, 9, 30, -14,
+    8, -6, -3, 12, -6, 24, 36, 5, 44, 54, -35, -42, 1, 26, 13, 15,
+    6, -20, -9, -2, -71, -16, -7, -12, 8, 8, -31, -3, -40, -38, -90, -127,
+    -102, -85, -83, -80, -5, 12, -45, -2, -5, -5, -35, 1, -3, 20, 23, -23,
+    21, 26, 31, -47, -39, -15, -27, -22, -39, 19, -3, -29, -52, 34, 81, -96,
+    -24, 20, 3, -12, 29, -10, 2, -14, -3, 16, 22, -40, -38, 19, -11, -44,
+    -66, -21, -116, -127, 55, 11, -53, -29, 16, 26, 90, 22, 27, -4, -49, -25,
+    -34, -20, -13, 28, -30, 10, 18, 14, 23, -8, 29, 51, 16, 5, 34, -6,
+    -29, -9, -49, -64, -62, 17, 42, 50, -4, -5, 12, -3, -15, 1, 4, 0,
+    -13, 14, 23, 28, -5, 3, 16, -16, -8, 11, 23, 48, 28, -24, -23, -10,
+    -35, 1, 1, 27, 11, -16, 16, -23, -7, 24, -33, 24, 23, 22, -18, 16,
+    -10, 18, -9, 8, 25, 1, 26, 1, 10, -9, 2, 9, -7, 1, -41, -53,
+    -92, -67, 3, 19, -40, -14, 21, 54, 20, -3, -21, 19, 55, -68, 23, 14,
+    63, 29, -29, -36, -34, -14, 12, 55, 39, 9, -24, -32, -116, -111, -46, -26,
+    19, -14, 53, 22, -3, 32, -47, -12, -52, 26, 24, 72, 27, -31, -10, -112,
+    -62, -40, -17, -45, 27, -2, 23, -17, -70, -46, -105, -26, -10, 24, 22, -10,
+    1, -46, -59, -45, 34, 21, 40, 8, -44, -35, -35, 1, 4, 34, -2, 54,
+    40, 25, 42, -49, -13, -127, -19, 54, -12, -7, -10, -1, 1, -10, 10, -8,
+    13, 27, -15, -34, -64, -7, 30, 36, 61, 14, 32, 38, -20, -28, -47, -21,
+    -4, 37, 39, 28, -15, -22, 0, 1, 1, 12, 11, -25, 22, -34, -23, -64,
+    -25, 26, 39, 40, 5, 32, 6, -15, -38, -1, 24, 20, 31, 17, 44, -33,
+    14, -22, -55, -40, -4, 13, 24, 20, -27, -40, -75, 6, 17, -13, 57, 7,
+    8, 14, 18, 28, 44, 8, 25, 10, -41, 34, -52, -35, 13, -21, -86, -11,
+    11, -26, 1, -18, -6, -14, 3, -3, -3, 48, 9, -13, -19, 12, 18, 47,
+    53, 51, 8, -12, 127, 90, -37, 55, 28, 3, -26, -2, 55, 35, -11, -28,
+    9, -11, -36, -29, -3, 2, 1, -7, 2, -4, 7, 12, 0, 3, -5, 41,
+    -9, 2, -19, 5, -15, 21, 62, 49, -8, -6, -1, -1, 4, 7, 7, 13,
+    -5, -45, 20, 5, -14, 36, 2, 17, -11, -50, -24, -24, 17, -25, 10, -6,
+    27, 10, -35, 8, 35, 35, 30, -4, -28, -17, -15, -14, -40, 8, 14, -1,
+    19, -5, 8, -27, -36, -30, -16, 7, -4, 23, -13, 1, 9, -42, 15, 11,
+    -55, -64, -25, -31, -82, 24, 40, 18, -38, -5, -8, -15, -52, 9, -1, -27,
+    -3, -28, -62, -35, -5, 48, 45, 54, 12, -15, 9, -15, -28, -57, -23, 16,
+    -22, -55, 73, -42, -37, -127, -69, 36, 17, 18, 6, 44, -20, -109, -95, -95,
+    -88, 39, -14, -16, 80, -56, -24, -66, -39, -86, 24, -53, -38, 50, -16, -31,
+    -55, -71, -27, 13, -40, -38, 26, -49, -15, -33, 1, 10, 18, -1, -9, 76,
+    -16, 36, -75, -51, -5, 43, -9, 54, -11, -12, 8, 8, 3, -8, -4, -14,
+    -10, -49, -55, -8, -23, 21, 18, 34, 27, 1, 26, -38, -64, -61, -48, 31,
+    43, 44, 1, -1, -48, -13, -43, 17, 0, 42, 3, -6, -35, -55, -11, -32,
+    23, 24, 25, 18, 10, 0, -8, -9, -26, -2, 9, 24, 13, 14, 12, 6,
+    -6, 28, -31, -27, -24, -18, -28, -4, -55, 24, 6, 7, 15, 17, 10, 9,
+    -15, 22, 18, -11, 19, 11, -28, -48, -14, 55, 49, 33, -1, -89, -70, 9,
+    -51, -45, 9, -4, 4, 23, 55, 58, -46, -61, -48, -59, -91, -113, -69, -66,
+    -46, -41, -71, 2, 71, -25, -25, 41, 59, 41, -64, -99, -120, 56, -5, -9,
+    44, 39, 25, -25, -69, -67, 2, 16, 8, -11, 25, -14, -28, -22, -41, 33,
+    23, 34, 36, 72, 127, 29, 12, -50, 3, 1, -12, 1, -7, 13, 0, -6,
+    8, 24, 24, 31, -49, -31, -28, -60, -4, 13, -14, -4, 27, 25, 33, 14,
+    -45, -60, -38, 39, -6, 12, 41, 8, 8, -36, -38, 7, -4, 27, 30, -5,
+    -3, -3, -23, -25, -3, -8, 2, 1, -36, -5, 0, -40, -35, 10, 21, -15,
+    -74, 21, -51, -3, -17, 7, -5, 32, 48, 28, -22, 16, -21, 0, -21, -36,
+    10, -24, -10, 48, 18, 39, -65, -41, 13, -15, -1, 18, 73, 67, 51, -3,
+    3, 42, -27, -22, -39, 74, -7, -41, -8, 54, -11, 27, 35, 37, 27, 31,
+    109, -65, -12, 15, 24, -32, -44, 127, 102, -78, -71, 9, -69, -1, 33, -48,
+    108, 54, -62, -5, 41, -18, -59, -3, -67, 29, 12, -9, -64, 5, -5, 9,
+    -10, -57, 95, -22, -55, 42, 73, -22, -3, 2, 17, -4, -12, -7, -6, -16,
+    7, -55, -36, -19, -14, 56, -16, -69, 16, -44, -15, -41, -10, 37, -16, 32,
+    -48, 9, 28, -30, -11, -17, 47, 34, -42, 16, 32, -44, -71, -14, -36, 21,
+    31, -34, -62, 12, -23, -43, -33, -45, -30, 21, 3, -64, 0, -41, 24, -8,
+    14, 21, 24, 14, 32, -4, 17, -62, 17, -3, 89, 56, 6, -83, -10, 17,
+    -14, 13, 28, -31, -34, -12, -42, -23, -6, -77, 42, 31, -127, 14, 111, -89,
+    -12, 67, 12, 5, -11, 4, -11, -7, -59, -2, 10, -30, 39, 83, -25, -46,
+    25, -81, -78, 10, 47, 27, -27, 29, 72, 20, 8, 81, 60, 4, -31, -44,
+    -2, 30, -25, -38, 16, 18, -3, 10, -22, -3, 28, 31, -59, -9, 15, 24,
+    -20, 16, 15, -26, -66, -3, 26, 16, -12, -12, -9, 2, 11, -8, -10, -7,
+    -8, -15, 29, 1, -32, -7, -3, -28, -12, -27, -8, 3, 14, -3, -17, 5,
+    -55, -8, -15, 23, 5, -37, 9, 22, -10, -30, 8, 4, 0, 13, -40, -3,
+    18, -22, -35, 10, 3, 6, 15, -21, -17, 3, -12, -28, -4, 1, -39, -39,
+    -2, -16, -19, 34, -20, 6, 62, -7, 43, -8, -95, 23, 46, -87, -13, 36,
+    30, 15, 35, -19, 2, 1, -9, -33, -37, 48, 25, -56, 33, -79, -127, -9,
+    11, -55, 29, 13, -4, 17, 16, -11, 20, 15, -38, 22, 6, -3, 26, -11,
+    46, -11, 7, 19, -41, -42, -96, -34, -47, -68, -16, -73, -28, -31, -5, 18,
+    -25, 7, -17, 50, 10, -4, 37, 9, -12, 36, -5, -29, -11, -28, -10, 19,
+    2, 15, -20, 31, 6, 25, -6, -70, -8, 10, -2, 15, -3, -3, -2, -11,
+    11, 20, 10, 14, -28, -1, -12, -71, -38, 13, 45, 28, 21, 22, 22, 5,
+    -20, -24, 1, -8, 25, 26, 11, -3, -1, 40, -14, 17, 12, 27, 31, 13,
+    2, 0, -30, -16, 2, 26, -4, 27, 13, -15, -1, -25, -12, -12, -33, -38,
+    -24, 37, -32, -71, -27, 8, -27, 75, 22, -15, 32, -70, -67, -34, -8, -30,
+    9, -3, 30, 1, 32, -2, -8, 5, -19, -32, -77, -10, -28, -29, -4, -45,
+    43, 23, -31, 1, 37, 36, -3, 36, -9, 23, 21, -127, -71, -22, -22, 19,
+    16, -14, 4, 34, -59, -87, -53, -68, -47, -5, 3, 31, 35, -76, -54, 9,
+    9, -22, -5, 0, 31, 23, -16, 10, -1, 34, 14, 23, -6, 19, -6, -10,
+    -18, 40, -50, 6, 50, -5, -18, 8, 7, 8, -4, 4, 0, 5, -8, 0,
+    9, 12, 34, 14, 6, 9, -10, -8, 5, -36, -24, -8, 35, 19, 34, 11,
+    -19, 5, -9, -19, -14, 9, 19, -3, -3, 34, -14, -4, 3, 27, 20, 18,
+    4, -26, 7, 2, -43, 12, 10, 22, -5, 33, 2, -13, -10, -32, -35, -75,
+    -93, -13, -1, -36, -4, 7, 3, 2, 2, 4, -6, -12, 3, -44, 27, 1,
+    -13, 30, 40, -12, 20, -22, -37, -48, -38, 85, 1, -72, 10, -25, -53, -8,
+    -92, -74, -5, 14, 26, 12, 25, -17, -50, -4, -46, -20, 52, 127, -28, 47,
+    114, -99, -54, -32, -35, -34, -81, 38, 31, -73, -21, -107, -82, 27, 4, -1,
+    49, 27, -62, 23, -29, 7, 3, 5, 6, 8, 30, -31, -53, -29, -10, -54,
+    -3, 19, 37, 84, -28, 49, 30, -83, -13, -1, 12, 2, 7, 4, -3, 1,
+    -12, -14, 52, 5, -49, 8, -68, -58, -60, 32, -1, 30, 46, 14, 23, -42,
+    -57, -73, -23, 5, 33, -40, 32, -13, -37, -65, -17, 6, 13, 32, -10, -6,
+    -22, -44, -41, -38, 32, -5, 31, -2, -30, 6, -21, -12, -18, 31, -3, 12,
+    10, 20, -12, -22, 11, -11, -18, 33, -1, -24, 31, -16, -81, -11, -65, -2,
+    15, -19, 14, 1, -4, -17, -13, 7, 9, 1, -6, 14, 75, 33, -46, 50,
+    64, 41, -7, 34, 33, 24, -25, -8, 14, -6, -41, 54, -15, 68, 29, 19,
+    -39, -70, -64, -3, -69, 24, 78, 31, -28, 34, 127, 60, -9, -53, 27, 36,
+    -30, -38, 28, 27, -32, -58, -10, -19, 20, 16, -30, -62, 51, 21, 17, -6,
+    45, 4, -57, 8, 59, 40, -32, -58, -10, 6, -7, 4, -15, -5, -14, 0,
+    -1, 14, -28, 7, -6, -37, -27, -2, 27, 27, 16, -11, 10, -5, -1, -24,
+    -2, 17, 9, -16, 54, 18, -7, -43, -9, 13, 30, -27, -12, -27, 16, -7,
+    -46, -43, 0, 34, 17, -11, -37, -4, -4, -40, -9, 10, 2, 12, -69, -33,
+    5, -4, -5, -17, 26, 11, -20, -8, -1, 1, 34, 14, -33, 49, 65, 49,
+    13, -25, -23, 11, -75, 23, -69, 12, 33, 65, -71, -70, -56, -68, -111, -72,
+    -53, -6, 20, -17, 11, 5, -8, 0, -43, -19, 1, 63, -26, -24, 14, -41,
+    10, -20, -6, 43, -21, -64, 10, -9, -19, -26, -40, -49, -19, -16, -5, 23,
+    1, 6, 6, 6, 20, -23, 43, -10, 16, -39, -17, 11, -71, -35, 45, 12,
+    -39, -99, 12, -104, -109, -56, -92, -127, 9, -10, -5, 13, -5, 13, -2, -11,
+    11, -27, -10, 50, -54, -14, 59, -52, 12, 23, 32, -43, 13, -7, -30, 32,
+    -98, -4, 36, 2, 9, 68, 1, 35, 50, 0, 53, 9, 3, -28, 58, -41,
+    12, 54, -10, 4, 21, -10, -17, 27, -28, -7, 46, -28, -5, 30, -31, 0,
+    -67, -12, 14, -56, 7, -3, 19, 53, -49, -15, -42, -80, 0, -72, -42, 20,
+    48, 12, -27, 3, -2, -14, 45, 19, 4, -13, 49, 37, 37, 33, 36, -94,
+    -83, 2, -8, 11, 0, -23, -10, 1, 27, 52, 24, 40, 52, 13, -27, -53,
+    -34, 25, 2, -22, 15, 38, 24, 20, 24, 73, 3, 96, 127, -12, -7, -31,
+    -23, -2, -20, 11, 23, 40, 8, 21, -4, 23, -4, 35, -19, 4, 1, -43,
+    -49, -68, -37, -25, 4, 50, 110, 71, 7, 13, -2, 14, 14, -4, -4, 14,
+    -10, 29, -26, 3, -7, -2, 7, -6, -39, -36, 26, 15, -26, -1, 17, 4,
+    30, 22, 3, -2, 2, -16, 6, -30, 18, -4, -9, 30, -13, -44, -35, -23,
+    6, 13, -2, -50, -18, -16, -15, -30, -10, 14, -15, 18, -27, -8, -52, -55,
+    -19, 21, -4, -10, -96, -48, 13, -13, 7, 33, 18, 24, 43, -49, -5, -1,
+    -27, -85, 24, -50, 86, 21, 104, 28, -61, -50, -66, 25, -72, -69, -57, -34,
+    -8, -79, 35, -23, -43, -11, -2, 16, 54, 66, -7, -36, 53, 120, -93, 82,
+    127, 75, 77, 10, 69, 45, -36, 12, -42, 14, -59, 8, -124, 43, 7, -21,
+    56, -63, -27, -32, -16, -24, -47, 36, 21, 4, 1, -5, -27, 18, 10, 53,
+    -38, -110, -5, -58, -37, 93, 33, -70, 15, 13, 7, -3, 8, -3, -9, 9,
+    -11, -30, -4, 15, 9, 35, -3, 19, 6, -5, -22, -48, 3, -59, 57, 15,
+    62, 30, -32, -26, 70, 18, 48, 0, -33, 10, 4, -11, -63, 14, 29, -3,
+    45, -13, 32, 20, -30, -25, -23, -7, -10, 26, 5, 40, 13, -19, -43, 38,
+    6, -70, -45, 7, -29, 6, 45, -62, -43, 20, -41, -34, -33, -21, 20, -58,
+    15, 32, -7, 76, -33, -27, -37, -47, -62, -121, 0, 29, -3, 33, -82, 23,
+    -26, -9, 13, 35, 8, 46, 9, -15, 42, -8, -65, 72, 62, -15, 91, -16,
+    -110, -22, -51, 27, -11, -10, -5, 84, -6, -10, 88, 112, -74, -37, 8, -7,
+    8, -39, 27, 42, 18, -35, 28, 1, -7, 38, 4, -61, -3, 31, -108, -68,
+    11, -34, 13, -4, -40, 33, 9, -31, -5, -19, -7, -6, 10, -7, 4, 7,
+    17, 33, -14, -39, 57, 1, -74, -25, -19, -111, 12, 37, -29, 22, -28, -39,
+    -1, -56, -84, -13, 24, -7, 4, -5, -6, 20, -49, -65, 30, 6, 5, 33,
+    -10, 5, -8, -39, -114, 33, -16, -40, 29, 13, -34, -42, -8, -83, -81, 12,
+    -14, -20, 37, -17, 59, 5, 36, -26, 5, -16, 50, -37, -127, 1, -2, -107,
+    -52, 15, 10, -11, 31, 28, -7, -15, -19, -40, 20, 36, 2, -32, -16, -35,
+    -27, 63, -55, -65, 4, -43, 7, 35, 6, -3, 27, -87, 6, 26, -120, -114,
+    -40, -33, -65, -40, 69, -88, -47, -28, -51, -69, -54, -58, 55, 24, -119, -105,
+    -44, -77, -87, -45, -53, 22, -2, 9, -6, -4, 26, 29, 32, 12, 54, -75,
+    -61, 9, -46, -117, -62, 23, -39, -29, -2, 13, 12, -17, 17, -1, -17, 5,
+    -17, 17, 8, 54, 49, -4, 44, -10, -11, 13, -69, 8, 17, 8, 15, 48,
+    17, -11, 21, 26, -21, 14, -3, 0, -33, 49, 56, 44, 6, 25, 39, 49,
+    -2, 42, 7, 14, 36, -34, -20, 46, 23, 9, 28, 5, 3, 3, -65, -33,
+    -127, -37, -11, -70, -55, -69, -20, -4, 15, 2, 11, 17, -9, 42, 10, 73,
+    -57, 11, 24, -34, -21, -7, -39, -22, 23, -42, 22, -2, -28, 31, 40, -50,
+    17, 38, -24, -11, -6, -24, -2, -45, 0, 4, 14, -61, 61, 48, -38, 4,
+    0, -57, -40, 19, 65, -51, -7, 60, 38, -16, 20, 17, -9, 27, -51, -9,
+    12, -8, -40, 2, -13, -16, 17, 31, -9, 7, 22, -10, -18, 13, 21, -52,
+    -127, -19, -26, -69, -81, -4, 8, 55, 6, -10, -5, 0, 2, 6, 8, 8,
+    8, 22, 24, -15, 18, -1, -6, -13, -14, 10, -30, 9, 20, -18, -23, -13,
+    -17, -13, 6, 48, 0, -14, 8, 7, -22, 10, 22, -11, 28, 21, -18, -5,
+    13, -3, 4, 19, 0, 15, 12, -19, 9, 5, -10, -11, 6, -5, -50, -41,
+    -32, -12, 11, -29, -4, -6, 11, -30, 10, -24, -27, 7, 3, -56, 19, 27,
+};
+
+static const float mnist_cnn_layer2_scales[32] = {
+    0.00617677718f, 0.00617445214f, 0.00480857538f, 0.00512108067f,
+    0.00631832564f, 0.00562236411f, 0.00330348825f, 0.00674080942f,
+    0.00802337565f, 0.000932571886f, 0.00712602306f, 0.00585975172f,
+    0.00451988075f, 0.00489743007f, 0.00523974095f, 0.00525694247f,
+    0.00575397676f, 0.00660003303f, 0.00577258272f, 0.00556159252f,
+    0.00428339886f, 0.00667842198f, 0.00514411833f, 0.00708089722f,
+    0.00537392637f, 0.00554900756f, 0.00587985339f, 0.00508827437f,
+    0.00410841359f, 0.00426831655f, 0.00472538732f, 0.00788250938f,
+};
+
+static const int8_t mnist_cnn_layer4_weights[15680] = {
+    -24, 2, -24, -2, -2, 19, -32, -30, 6, -1, -6, -18, -8, -14, -14, -5,
+    7, -32, 8, -4, -45, -5, 13, 24, -31, 13, 19, -39, 12, 26, 6, -6,
+    3, 12, -6, 42, 15, 25, 1, 19, -18, -2, 3, 27, -15, -127, -85, -66,
+    -2, 3, 20, 18, -24, -18, -17, -16, -3, -20, -7, -16, -25, -8, 25, 4,
+    -11, -3, -13, 14, 16, -1, -13, 14, 7, 40, 29, 11, 9, -21, 2, 28,
+    13, -9, -4, 12, 1, 36, 28, -40, -7, -6, -25, -4, 8, -43, -76, -26,
+    -52, -15, -11, 6, -2, 7, 3, -4, -10, -23, 4, -18, -1, 17, 1, 44,
+    -23, 6, -20, 3, 23, 17, 26, 11, -3, -27, -21, -5, 11, 23, 34, -10,
+    6, 19, -14, -5, 1, -70, -11, -11, 21, -7, -11, -36, 0, -9, 55, -70,
+    -65, -74, -43, -6, -14, -52, -4, -40, 18, 24, -1, -27, -9, 10, -15, -19,
+    4, 1, -3, 3, -8, -13, 13, 14, -7, -9, 23, 15, 23, 26, 24, -7,
+    0, 1, 0, 3, -6, 13, -6, 22, -12, -53, 0, -12, -18, 0, 5, -63,
+    -58, 3, -30, 2, 0, -6, 17, -8, 0, 1, 6, 20, -15, 12, -13, 9,
+    6, -18, 9, 2, 17, 20, -40, -68, -74, 22, 24, 24, -25, 4, 30, -20,
+    18, 3, -13, -1, 14, 7, -80, -19, -45, -40, -12, 20, 24, 30, 35, -81,
+    -100, -87, -40, -5, 11, 13, -14, 1, -9, 4, 2, 10, -19, 20, -5, 12,
+    1, 4, 18, 12, 18, 5, -3, 0, -5, -8, 25, -42, -60, -29, -76, -45,
+    -26, -13, -57, -28, -6, 46, -54, -47, 11, -43, -21, -13, 12, 20, 19, 43,
+    -60, -8, 1, -27, -25, -2, 5, -2, 34, -22, -5, 2, -3, 21, 7, -29,
+    4, -19, 5, 12, -5, -9, 22, 14, 8, -17, 17, 3, -32, -8, -4, -14,
+    -15, -17, 4, 8, -14, -49, -17, 16, 24, 4, 2, -2, 6, 15, 8, 9,
+    -9, 11, 10, 21, 16, 14, -8, 4, -7, 2, -7, -8, 6, 11, -2, 9,
+    -22, -1, 11, 10, 29, 12, -28, 3, 20, 30, 12, 14, -22, -50, -11, 27,
+    -17, -6, 3, -36, -19, 0, 12, 6, -2, -7, 10, 0, 43, 32, -49, -36,
+    -20, 26, -39, -5, -47, -112, -28, -31, 19, 18, 0, 9, -9, -21, -18, 13,
+    -2, 0, -17, -15, 2, 39, -1, 3, 0, -12, -22, -15, -19, 7, -42, -31,
+    -121, -51, -27, -22, 37, -19, -4, -3, 37, 14, -102, -58, -8, -12, -5, 35,
+    31, 5, 18, -34, -41, 21, 6, 9, 0, -1, 2, -3, -9, 2, 0, -2,
+    0, -3, 2, 0, 2, 5, 5, -3, -2, -8, -4, 0, 11, 12, 2, -1,
+    -4, 0, -4, 1, 0, 0, 0, 2, -4, -1, 4, 1, -3, 2, 0, -3,
+    -1, 0, -2, -2, -1, 2, 1, 1, -1, 2, 8, 5, -3, -14, -6, -25,
+    14, 4, -26, -13, 9, 1, -10, 40, -25, 6, -17, -17, -28, -30, 38, 7,
+    -6, -25, -46, -14, 19, -17, -3, 11, -8, -22, -7, 14, 30, 5, -8, -4,
+    17, 16, -2, -18, 28, 3, -11, 0, 29, 18, -3, -6, -14, -24, -32, -29,
+    -20, 1, -3, 9, 10, -3, 35, 34, -27, 8, -6, -27, 12, 30, 32, 5,
+    -2, -1, -23, 15, 4, 30, 13, 22, 5, -17, -31, -12, -7, -61, 12, -5,
+    24, 8, -40, -19, 2, -19, 21, 13, -9, -3, -36, -37, -5, -10, -1, 14,
+    -13, 0, -20, -17, -8, 5, 7, 6, -26, -54, -6, 5, 20, 21, -21, 4,
+    -77, 5, 19, 20, -12, -6, 25, -67, 42, 12, -4, 25, -6, 18, -16, -39,
+    -12, -61, -27, -24, 9, 17, 26, -41, -35, -65, -23, -9, -8, 12, 18, -2,
+    -17, -9, 24, 7, 14, 18, 8, 6, -5, 3, 13, 9, 21, 3, 27, 27,
+    -7, -4, 7, -6, 17, -69, -49, -26, -6, 5, -40, -30, -18, 16, 23, 18,
+    9, -14, -51, 3, 42, 19, 12, 11, 8, 9, 24, 26, 25, 12, -2, -7,
+    -11, -30, -19, -31, -1, -4, 1, 10, 26, -20, 13, 4, -31, 9, -4, 26,
+    -12, 6, 22, -26, 19, 11, 14, -12, 13, -14, -6, 14, -23, -30, 5, -4,
+    -2, -2, 17, -4, -33, -22, 22, 36, -51, 3, -5, 18, -6, -17, -5, -6,
+    16, 0, -16, 14, -5, -3, -32, 16, -11, 1, 6, 21, 1, -11, 9, -24,
+    -3, 4, 26, -11, -8, 4, -22, -64, -15, 19, -7, 18, 10, -1, 2, -12,
+    -4, -17, -27, 13, 12, 10, -3, -19, 0, -5, 7, 11, -7, 31, 22, 4,
+    -3, 36, -10, 16, -14, -31, -30, 20, 16, -25, 5, -12, -12, -22, -4, 21,
+    -5, 9, -55, -64, -24, 9, 1, -15, -33, -2, 12, -37, 33, -10, -10, 4,
+    -5, 21, -14, -54, -34, -40, 47, 23, 8, 10, -32, -3, -18, -1, -6, -9,
+    -13, 0, -12, -15, 7, -28, 14, 9, 0, -26, -19, 18, 1, -2, -9, -19,
+    -1, -3, 5, -29, 5, 38, -28, 9, -7, -3, 2, -13, 18, 1, -5, 4,
+    22, 24, 15, 1, -24, -5, -13, 18, -16, -35, -13, -3, 21, 27, 11, 25,
+    -3, -21, -3, 25, -5, 0, 13, 10, 21, -12, 14, -9, 10, -3, -5, -1,
+    -11, 8, 5, 13, -30, -49, -11, 14, -11, 29, -38, -9, 13, -8, 26, -13,
+    6, 11, -6, -19, -60, -63, -82, -39, 5, -16, 45, 28, -8, -25, -31, 43,
+    -22, 24, 23, 0, 2, -10, 8, -6, -3, 1, 35, -20, -69, -28, -35, -20,
+    -46, 11, -27, -14, -18, -23, 3, -7, 7, -41, -37, -19, 2, 0, -54, 0,
+    13, 6, -16, -16, -20, -49, 11, 7, -1, 1, 17, 15, 18, -3, 16, 11,
+    19, 15, -11, -33, 19, -16, -27, 13, -31, -37, 12, 4, -28, -29, 7, 5,
+    7, 18, 16, 17, -1, 26, 25, 2, 42, 10, 3, 23, 2, 6, -12, -35,
+    4, 27, 17, 11, 33, -7, -23, 23, 0, -3, -10, -36, -35, -44, 16, 12,
+    -41, -74, -75, -5, 20, 2, -14, -10, -2, -13, 32, -5, -44, -31, -32, -30,
+    0, -18, -21, -21, 0, -27, 17, 14, 10, -35, 10, 22, 3, 50, -10, 20,
+    -16, 47, 11, -4, 9, -12, 13, -32, 21, 5, 28, 21, -40, -40, 16, -9,
+    3, 32, -41, -44, -38, -48, 8, 3, 10, 4, -22, -36, 12, 5, -29, -49,
+    1, -50, -44, -20, -5, -44, -13, -7, -22, -41, 1, -8, -22, -6, -11, -49,
+    0, -3, -9, -28, 5, -13, 25, 20, 12, 15, -8, 16, 12, 10, 5, -10,
+    -3, -9, 0, 23, -8, -1, -1, -5, -15, 5, -31, -41, -13, -6, -4, -2,
+    6, -3, 3, -7, -6, -4, 11, -10, 7, -22, -16, 10, -9, 3, 5, 24,
+    -43, 33, -18, 26, 15, -8, -30, 11, 18, -6, -4, -1, 6, 12, 11, 1,
+    -8, -41, -18, -34, -11, 19, 23, -1, 19, 4, 12, 4, 24, 6, 17, 12,
+    -20, -35, 16, -5, -16, 0, 1, -32, 10, -13, -37, -76, -7, -21, -14, -11,
+    2, -31, -13, -45, -16, -60, -60, 24, 14, 19, 1, -2, -8, 10, 11, 2,
+    3, -2, 17, -15, -5, 0, -3, -14, -12, -18, 8, -3, -16, -4, -5, 4,
+    -9, 2, -17, -3, 15, 10, 41, -4, -8, -3, -8, -6, 5, 20, -51, -46,
+    -3, 40, -16, 14, 12, 40, -37, -24, 15, -18, -11, 3, 27, -28, 30, 12,
+    -22, -15, -31, 4, 4, -9, -6, -92, -32, 0, 6, 26, -11, -15, -15, 52,
+    3, 16, 0, -13, -5, -40, -17, -28, -3, -2, 0, 0, -18, 27, 22, 7,
+    14, 18, -22, 38, -4, -30, 17, 6, 33, 6, 3, 8, -28, 9, 16, -10,
+    -127, 18, -6, 14, 14, 8, -4, -67, -82, -22, -24, -4, -7, -8, -25, 1,
+    -41, 4, -28, -5, 1, 9, 8, 38, 29, -25, -4, -3, -19, -23, -4, 41,
+    17, -17, -57, -43, -15, 3, 11, 23, 15, -16, -19, -16, 5, 9, 5, 0,
+    15, -3, 7, 12, 10, -22, -27, 20, -3, -8, -5, 8, -4, -16, 16, 26,
+    3, 29, 23, -7, -6, -2, -4, -4, -44, -41, -8, 10, 2, -1, -21, -2,
+    -32, -3, 10, 4, 13, 7, -4, -20, 12, 10, 19, 18, 28, 0, -10, -18,
+    5, -1, 1, 3, -28, -37, 7, 15, -38, -120, -88, -73, 2, 21, 17, 6,
+    -27, -8, -37, -22, -3, -11, -34, -2, -20, -20, 3, -2, -17, -9, -2, -34,
+    -33, 14, -5, 18, 15, -24, -26, 17, 13, -5, 6, 10, -46, 32, 20, 8,
+    0, -43, -17, 7, 14, -13, -17, -2, -14, 17, -1, -13, 5, 3, -5, 27,
+    -8, -26, 13, 49, -4, -35, 12, 17, -3, 9, -6, 6, -34, -18, 11, 6,
+    -5, 21, 2, -20, 5, 8, -26, -40, 2, 0, 1, 2, 0, -20, -7, 5,
+    1, -48, 1, 21, 34, 38, 9, -4, -2, -31, -11, -9, -8, -5, -6, -12,
+    -2, -14, 2, 3, -3, -1, -28, -1, -29, -13, -12, 11, 0, -11, -3, -10,
+    -12, 10, 4, 7, -19, 23, 8, -16, 10, 0, 24, -20, 4, 22, 25, -23,
+    -24, 5, 11, 11, 16, 35, -27, -47, -42, -1, 4, -42, -39, -58, -35, -4,
+    -13, -28, 9, 34, 22, -23, -17, 8, -42, -29, 31, 20, -10, -33, 25, -50,
+    -40, 25, 41, 38, 7, 23, -66, -5, 23, 37, 1, -10, -21, -30, -1, 33,
+    12, -4, 13, -4, -22, -12, 25, 45, 55, 47, 7, -11, -10, 14, 21, 4,
+    16, 19, 54, -5, 24, -2, 42, -30, -13, 51, 32, 36, -10, 38, 9, -8,
+    -26, -30, 3, 9, -27, -14, -7, 16, -53, -3, 11, -30, -39, 5, -36, -28,
+    9, 13, -20, 15, 5, -28, 46, 36, -14, 13, -13, 6, 15, 79, -16, -36,
+    30, -13, -1, -62, -28, 5, -8, 17, -12, 26, 12, 19, 24, 12, -10, -41,
+    -22, 26, -1, -32, 11, -14, 16, 0, 41, -91, -53, -14, -34, 11, 0, 9,
+    -33, -28, 12, -6, 25, -3, -2, -33, -19, -4, 31, 1, -6, 6, 80, 26,
+    15, 10, -13, 7, -7, 64, 47, -10, 27, -10, 7, 29, 55, 58, 24, 4,
+    18, 2, 42, -118, 25, 28, -1, 31, 1, 38, -27, 17, 14, -27, -55, 5,
+    -34, 41, 22, 4, -10, -3, 2, -8, 35, 15, -23, -16, 13, 4, 42, 66,
+    -20, -27, 13, -35, 24, 4, -36, -23, -6, 19, 25, 46, -85, -27, 8, 16,
+    0, 0, -54, -36, -18, 31, 22, 15, 27, -18, -3, 33, 46, -12, -8, 9,
+    -39, 11, -14, -29, -26, 55, -15, 61, 18, 17, -2, -38, -9, -25, -31, 8,
+    18, 28, 101, 15, 5, 40, 16, 6, 3, -21, -24, -15, -2, 32, -14, -31,
+    -11, -26, 1, -27, -39, -3, -18, 20, -54, -22, -37, 17, -41, -26, -10, -15,
+    9, 26, 12, 64, 82, 7, 19, 7, 27, 76, 40, -33, 38, 9, 26, -20,
+    13, -8, -43, -31, 2, 3, 6, -62, 47, -84, -26, 2, 7, 9, 7, 10,
+    -40, -63, -71, -48, -66, -24, -12, -44, -6, 1, -28, -27, -34, -17, -32, -71,
+    -53, 31, 8, -15, -31, -29, -26, 9, -10, -27, 27, 6, 5, 4, 20, -5,
+    -29, 0, 5, -22, 2, -3, -24, -21, 23, 20, 3, -7, -4, -19, -23, 51,
+    33, -1, -6, -18, -12, -20, -54, 9, 35, 10, -42, 12, -22, -7, -41, 47,
+    28, 11, -11, 13, 6, 48, 4, 12, 20, 10, 21, -18, 12, 61, 1, 8,
+    -17, -27, -9, -22, 50, 10, 1, 10, 13, 0, -10, -1, -33, 6, -31, 23,
+    -20, -24, -4, -31, -14, -7, 0, 6, 20, 13, 38, -62, 4, -22, 49, -9,
+    -2, -55, -21, 32, 5, 29, 38, 8, 11, 18, 21, -3, -4, 41, 51, 2,
+    11, 18, 9, 50, -59, -9, -46, 8, 1, -1, -4, -7, -2, -7, -6, -8,
+    4, 0, 5, 0, -2, -4, 6, -6, -1, -2, 3, -9, -7, -1, -3, 0,
+    -2, -2, -13, -13, -6, 1, -2, 1, 1, -7, -6, -11, -4, 1, 0, 2,
+    4, 1, -4, -5, 1, 1, -4, -4, 1, -4, 15, -57, -16, -56, 0, -22,
+    44, -16, -29, -24, -20, -11, -5, -19, -66, -11, -2, -47, -37, -31, -24, -2,
+    18, -9, -39, -84, -31, 40, 33, 23, -9, -48, -25, 10, -1, -17, 21, 8,
+    -12, 14, 27, 23, -62, -6, 38, -26, -73, -24, -1, 11, -23, 32, -52, 32,
+    -17, 8, 8, 30, 43, 14, -70, -47, -8, -18, 1, 17, -11, -29, -50, -26,
+    -29, -19, -7, -7, -62, 17, 15, -42, -4, -28, -7, -17, -20, 37, 4, -60,
+    -25, -11, -14, 5, 32, -18, -14, 6, 17, -18, 35, -34, 27, 40, -46, -18,
+    34, 20, 27, -15, -71, -54, -6, -8, 1, 4, 30, 6, -33, 35, -13, -20,
+    40, 25, -64, 21, -25, 37, -25, -20, -21, 2, -28, -57, -83, 41, 53, -17,
+    12, -9, -31, -30, -19, -35, -15, 20, 5, -22, -6, 66, 15, 18, 2, 30,
+    18, 9, 0, 18, 14, -3, 16, 35, 29, 28, 11, 19, 7, -6, 31, 127,
+    14, 11, 7, -3, 12, 68, 68, 31, 12, 19, 3, 5, 43, 19, -25, 11,
+    16, 18, -5, 7, 21, 20, 2, 18, 11, 25, 35, 9, 10, 18, 8, -5,
+    4, 15, 1, 40, -25, -10, -14, -58, 3, 31, -10, 11, -57, 2, -22, -9,
+    36, 3, -10, -43, -42, 20, 3, -9, -31, -19, -4, 46, 20, -37, -4, -21,
+    1, -37, 33, 10, -19, 4, -19, -28, 10, 7, 5, -63, -57, -35, -5, 5,
+    -50, -17, -23, -7, -2, 5, 5, -12, 0, 40, 10, -23, -5, -54, -11, 25,
+    11, -3, -12, -19, -9, 24, -26, -6, -37, 11, -4, -62, -21, -4, 16, 19,
+    1, 10, 20, -20, -25, 2, 12, 5, -9, -2, -48, -21, -44, -17, -16, -11,
+    -5, -28, -3, 9, -1, 6, 43, 25, 4, -35, -7, 15, 25, -41, -9, -16,
+    -25, 40, -32, 21, -3, -40, -15, 18, 3, -80, -16, -15, 2, 48, 35, -4,
+    -29, -40, 33, 1, 48, 58, -19, -45, 6, 6, -32, -37, 23, -31, 1, -9,
+    -8, 10, -6, 46, 44, -42, 49, 0, -8, -72, -15, 66, -13, 18, 20, -10,
+    -3, 0, 0, -20, -23, -8, 27, 19, -23, 13, -31, -9, -65, -14, -33, 39,
+    -32, -88, 16, 3, -18, -16, 27, -25, -71, 36, -16, -10, -26, -4, 37, -30,
+    -75, -1, 9, -14, -1, -1, 13, -12, -11, 1, -24, -30, 19, -18, -5, -14,
+    -42, -10, -39, 22, 61, -29, 25, -10, -20, 2, 34, -67, -21, 29, -10, 34,
+    11, -19, 13, 16, -2, -24, -31, 20, 24, -47, -45, 19, -6, 4, -38, 12,
+    -44, -2, -16, 8, 2, -8, -47, 10, 6, 8, 67, 13, -10, -13, -15, -69,
+    -66, -30, 17, -27, -2, -41, -38, -14, -59, -23, -33, -80, -18, -9, 18, -60,
+    -38, -5, 14, 37, 8, -17, 18, 22, -12, 12, 12, -4, 10, -18, 3, -7,
+    -8, 18, 19, -14, 9, 2, -7, 4, -35, -3, -8, 10, 27, 10, 19, -12,
+    -36, -40, 1, 7, -19, -10, -21, 12, -3, 12, -2, -34, 50, -60, 18, 60,
+    2, -68, -13, 17, -55, -10, 33, 33, -5, 33, 27, 37, 24, -2, -1, -61,
+    -15, 7, -60, -17, 3, 10, 33, 40, 26, 33, -5, 3, 20, -2, 3, 22,
+    23, -21, -16, 7, 13, -3, -9, 27, -57, -15, 36, 9, -52, 18, 15, 58,
+    6, -13, -78, -25, 26, 29, -30, 61, 42, -55, -39, -7, -22, 27, 40, -1,
+    -22, -20, 4, -6, 29, -33, 6, 1, 3, 17, -50, 21, 1, 5, -56, -1,
+    65, 18, -21, -1, 13, 29, 8, 11, -31, -9, -3, -4, 10, 26, -38, -3,
+    3, -4, 10, 9, 54, 69, 7, -12, 10, 25, 27, -30, 10, 8, 21, -1,
+    -26, -7, -9, -3, 6, -3, -7, 7, -8, 22, -3, 14, 74, -28, 1, -70,
+    -72, -22, 6, 15, 5, -32, -4, 11, -23, 31, 25, -20, -45, -39, -37, -2,
+    35, 5, 9, 34, -53, -38, -3, 29, -29, -36, -52, 0, -5, 10, -22, -16,
+    -35, 63, 1, 39, -16, 10, 8, -2, 0, -22, -8, 33, 41, 5, 10, -8,
+    -39, -24, 69, 81, -3, -14, -6, 14, 24, -5, 0, -26, 2, -3, 21, 52,
+    -51, -15, -39, 20, 19, 16, 55, 6, 10, 24, 4, 19, 21, -21, -6, 6,
+    21, 14, -10, -7, -16, -17, -3, 12, 2, -11, 12, 16, 12, 4, -9, -26,
+    9, 34, -29, -3, -9, 4, -36, 7, 1, -27, -40, -17, -2, 30, -59, 4,
+    -35, -71, -4, 6, -9, 33, 33, 16, -48, 9, 27, -13, -42, -18, -24, -17,
+    -48, 35, -51, 2, -1, 45, -12, 10, 47, -33, 19, -36, 31, 2, 37, -7,
+    -5, 19, -59, -3, 16, 79, 47, -6, -6, -41, -39, 13, 59, -2, 37, -39,
+    -21, 8, 47, 57, 11, -35, -64, -17, 18, 54, 41, -41, 26, 17, 17, 18,
+    44, -15, -63, -24, -8, 3, -32, -2, 1, 8, -3, -4, -68, -34, -17, -46,
+    -9, 4, -5, -6, 0, -33, -70, 2, -37, -65, 18, 11, -33, 4, -18, 18,
+    -41, 21, -6, -34, -69, -41, 6, -27, 35, -4, -18, 14, 17, 27, -42, -14,
+    -8, -5, 28, 29, 5, -27, 25, 47, 24, -69, 16, -20, 42, -30, 17, 24,
+    5, 24, 14, -7, -52, 19, 18, -26, 6, 8, 16, 12, 9, 10, -43, 20,
+    -23, 32, 15, 3, 5, -2, 25, 0, -12, -19, -13, 10, -34, 41, 0, -8,
+    -20, -7, -20, -35, -60, -5, -1, -26, -20, 42, 15, -16, 1, -9, -1, -16,
+    -17, -16, 58, -30, 8, -10, -11, 83, -23, -4, 1, 6, 21, 53, 87, -17,
+    3, 12, 3, 47, 21, 48, -1, -9, 21, 7, 46, 62, 107, -19, -16, -17,
+    6, 44, 10, 3, -27, -16, -19, -1, 33, 2, 35, 8, -28, -15, 20, -20,
+    -49, 24, -43, -9, 8, -32, -85, -10, 20, 26, 24, -9, -12, -85, -43, 41,
+    41, 19, -16, -1, -60, -38, -20, -6, -41, -3, -40, -4, -24, 0, 17, -28,
+    -14, -16, -15, -11, 16, 14, -33, 0, 4, -41, -80, -41, -5, 2, 8, -8,
+    15, 21, 27, 23, -2, 0, 0, 31, 19, -9, 20, -4, -10, -6, 22, 13,
+    6, 7, 3, -15, 3, -48, -53, -14, 9, 48, -3, 31, -42, -60, 43, 56,
+    -43, 45, 12, -23, 3, 35, 18, 6, 32, 1, 3, 66, 1, -9, 4, 2,
+    14, -17, 1, -31, -2, 9, -26, 13, -13, 3, -9, 1, 8, 8, -33, -15,
+    -29, -15, 15, 7, 37, -3, -3, 11, 2, 18, 62, 84, 19, 6, 31, 3,
+    18, 7, 24, 4, 17, 13, -5, -25, -7, -35, -19, -5, -8, -70, -27, -13,
+    -2, 13, 42, 8, -7, 17, -36, 21, 7, -7, -28, 4, 19, -19, -45, -23,
+    -59, -2, -19, -5, 20, -1, -3, -73, -76, -37, 1, 8, -40, -7, 12, 8,
+    4, 12, -4, -11, -1, 20, -13, -38, 17, -10, 13, -3, -77, -91, -44, 11,
+    -44, -19, -32, 14, 16, -15, 38, -39, 2, 20, -17, 1, 11, 21, -18, -36,
+    -34, -20, -36, 4, -12, 1, -30, 8, -5, -18, -27, -20, 15, -23, 18, -14,
+    -12, 21, -9, 0, -39, -21, -20, -9, 12, 34, 25, -6, -29, -50, -54, -22,
+    70, 6, -9, -4, 27, -15, 11, 9, 5, 13, -4, 8, -34, -48, 1, -2,
+    3, 4, -81, -42, -12, -10, -10, 10, -14, -43, -127, -25, 12, 1, -18, 0,
+    -29, -41, 0, 1, -6, -14, -7, 3, -58, -54, -22, -8, -8, 1, -94, -108,
+    -55, -18, -34, -21, 3, -1, -21, -6, -11, -3, -8, 30, 15, 6, 25, 7,
+    -37, 19, 24, -28, -28, -5, -33, 2, 9, -6, -7, 35, 2, -15, 16, 58,
+    25, 1, 12, 24, 14, 21, 40, 3, -22, -44, 23, 10, 46, -1, -41, -15,
+    -2, -82, -68, -52, -2, -20, -2, -4, -5, 7, 24, -24, -30, 8, -6, 14,
+    -9, -13, -11, -3, 32, 50, 29, 4, -15, -28, -2, 40, 24, 31, 14, -22,
+    35, 17, 11, -10, -24, -12, 8, 29, -70, -71, -45, 16, 56, 50, 7, -8,
+    -21, -8, -43, 36, 32, -16, -10, 85, 12, 106, 0, -36, -10, -3, 22, 6,
+    10, 8, -10, -87, 17, 14, 8, 10, -10, -25, 11, -25, -16, 8, -6, -19,
+    -13, 35, 14, 6, -20, -10, 10, 33, 28, 13, 3, -1, -12, 22, 10, 5,
+    -38, 17, 29, 21, 5, -14, -22, 14, -3, -7, -3, 0, 8, -34, 9, -25,
+    10, 27, 24, -7, 3, -13, 71, 20, 33, 30, 0, -1, 30, -6, -3, 18,
+    -11, -16, -11, 15, -54, -43, 23, -6, 1, -6, -40, -47, -34, -54, 2, 20,
+    6, 14, -2, -63, -86, -7, 21, 8, 2, 19, 3, -15, 8, -3, 4, 20,
+    -6, 15, 1, -4, 20, -6, -2, 7, 21, -16, -55, -52, -17, -4, 43, 11,
+    13, -1, 19, 37, 4, -16, -26, -21, -22, 1, 7, 18, -20, -31, 10, 17,
+    62, 39, 0, -7, -27, 46, 74, 53, -35, -2, 3, 1, 1, -1, 1, -6,
+    -2, 4, -1, 4, 2, -2, -9, 1, 0, 1, -2, 3, 9, -16, -9, -2,
+    0, -2, 8, -13, -10, 2, 7, -2, -4, 2, -10, -10, 1, -7, 1, -5,
+    -10, -12, 2, -3, 0, 0, 3, -1, 1, 1, -18, 38, 32, 46, 11, -27,
+    -7, 13, 25, 13, 10, -8, -56, -68, 22, 2, 27, 17, -9, -34, -36, -30,
+    3, 14, -35, -32, 3, 21, -15, -13, -7, 3, -8, 37, 26, 5, -18, -7,
+    -1, -2, 11, -5, -94, -22, -27, 25, 24, -15, -19, 15, 52, -7, 10, -58,
+    1, -5, 4, -22, 6, 34, 17, -12, -22, -2, -49, -6, 15, -1, 8, -78,
+    -25, -28, -43, -1, -16, -49, -47, 5, 9, -19, 7, 11, 36, 38, -10, 12,
+    30, 17, 38, 34, -41, -40, 8, 5, 0, 11, -10, -15, -6, 10, -5, -25,
+    -12, -20, -20, 33, 8, 43, 18, 3, 5, 15, -5, -17, -21, -22, -2, 20,
+    35, 18, 5, 20, 14, 34, 10, -3, 12, -19, 21, 22, 26, -28, 23, 43,
+    -12, -24, 4, -12, -75, -47, -78, -54, -31, -26, -100, -48, -20, 10, -6, -12,
+    -26, 3, -5, 5, 5, -9, 1, -8, -39, -10, 13, 5, 18, 36, 6, -91,
+    31, 7, 6, 23, 6, -6, -23, -3, 30, 10, 3, 27, 14, 37, 6, -15,
+    -9, -14, 21, 88, -29, -30, 10, 9, -3, -13, 15, -6, 8, 12, 3, 9,
+    8, 27, 19, -1, 18, -22, -9, 5, -1, -27, -23, -23, 52, 16, -5, 0,
+    -4, -24, 0, -16, 39, -35, -17, -4, 13, -28, 28, 15, 44, 3, -1, -12,
+    9, 42, 7, 25, 5, 22, -43, 13, 35, -23, -10, 3, -4, -27, -12, -34,
+    41, 39, -10, -12, -6, -3, 17, -9, 17, -4, -10, -28, 0, 12, 1, -20,
+    -47, 2, 20, -18, 0, -45, -64, -5, -17, 17, 7, 30, 8, 28, 46, 16,
+    30, 41, -10, 3, 2, -21, 19, 13, 1, -4, 18, -27, 19, -28, -50, -17,
+    0, -4, -12, -17, 3, 19, -54, 9, -9, 13, 4, -42, -66, -31, -35, 54,
+    -17, 1, -8, -37, 26, 4, 38, 36, 20, 17, 0, 38, 20, -21, -42, 10,
+    6, -1, 58, -29, -50, 3, -17, -27, -2, 5, 73, -22, -13, -22, -4, 34,
+    -12, -2, 18, -15, -81, -2, -61, 0, -8, -5, -10, 18, 8, -22, -9, -16,
+    4, 15, 17, -23, 49, 35, 1, -35, -46, -13, 13, 11, 0, 31, 4, 4,
+    25, 3, -10, -29, 73, 27, 3, -15, -11, -24, -24, -46, -23, -19, -27, -33,
+    -12, 12, -15, -12, -4, -22, -7, 15, -16, 55, -16, 8, 9, 8, -37, -3,
+    -56, 4, -21, 12, -2, -36, -29, 16, 33, 33, 38, 5, 16, 46, 24, 4,
+    31, 13, 18, 27, 41, 23, -28, 6, 16, 40, 41, -14, -35, -69, 14, -37,
+    1, 35, -39, -6, 9, 53, 53, -22, -23, -3, -30, 0, 19, 19, 58, 1,
+    -58, 16, 13, 4, 9, -10, -75, -47, -17, -26, -6, -7, -21, 3, -12, 24,
+    -19, -50, 10, 17, 51, 37, 28, -11, -13, 3, 25, 38, 4, -7, 26, 25,
+    -4, 7, -10, 0, -6, 6, 13, -3, 60, -40, -9, 12, -18, 14, -9, -10,
+    -23, -46, 5, -18, 1, 11, 4, -18, -43, 23, -37, 8, 2, -22, 6, -25,
+    54, -19, 12, -25, 33, 32, 22, -19, 32, -18, -19, 32, 42, 44, -23, -64,
+    -75, 2, 15, -3, 29, -1, 19, 11, 2, -50, -27, -1, 9, -47, -11, 19,
+    37, 34, -24, -1, -35, -51, -6, 32, -3, -70, -30, -20, -37, -24, -37, -38,
+    -32, 28, 19, 4, -24, -26, -16, 5, -12, -2, 35, -8, 30, 44, -27, -12,
+    4, -5, 23, 4, -13, 0, -1, -4, 7, -11, -2, -33, 10, -10, 35, 5,
+    10, -24, -10, 0, 1, 16, 5, 13, 17, -32, -8, -18, 24, 13, -25, -3,
+    5, 9, -55, 12, 41, -33, 11, 5, 15, 22, -7, 22, 13, -19, 1, 11,
+    13, 6, 17, -20, -10, 9, -14, -4, 37, 14, 3, -14, -82, 25, -9, -7,
+    7, 20, -26, -5, 10, 15, 25, -4, 14, 9, 0, 6, -15, 10, 4, -29,
+    -20, -14, -40, 18, 25, 29, 26, -28, -28, 20, 55, -5, 10, 13, -29, -34,
+    18, -18, 13, -23, 24, -34, -11, 0, -11, -12, 0, 4, 8, 0, 2, 13,
+    10, 38, -23, -42, -82, -33, 33, 26, 17, 18, 16, -60, 14, -2, 7, 56,
+    -11, 26, 8, 7, -20, -56, 18, -4, -31, -4, 14, 30, 19, 11, 11, -1,
+    12, 5, 20, -1, 15, 2, 2, -28, -11, 12, -12, -7, 6, 0, 31, -25,
+    -20, -20, -24, 20, -5, -8, -4, 70, 59, 42, -7, -28, -5, -9, -9, 3,
+    -5, -2, -7, -7, -19, -25, -48, -26, 18, 9, 0, -10, -36, -52, 11, -13,
+    21, 11, 12, 2, 14, -31, -32, -2, -7, 0, 7, -14, -12, -27, -18, -13,
+    4, -1, 14, 6, -1, -33, 13, -44, 2, -3, -5, 15, 20, 3, 15, -4,
+    -17, -15, 18, 37, 9, -11, 24, 22, 34, -2, -18, -51, -21, 11, 19, 3,
+    -21, -3, -63, -4, -10, 24, -11, -31, -29, 46, -2, -29, 93, 39, 17, 24,
+    -39, -11, 1, -8, 1, 11, 4, -42, -59, 2, -11, 10, -5, -8, -6, -13,
+    -36, -4, 2, -10, -5, 20, 31, 9, -17, -19, 23, 23, 8, -29, -13, -1,
+    -16, 1, 19, -2, -15, -58, 6, 2, 6, -12, -12, -7, -7, 31, -18, -61,
+    -14, 3, 12, 7, -16, 2, 1, -19, -38, -6, -62, -2, -2, -8, 4, 31,
+    52, 20, -10, -14, -19, 18, 17, 30, -8, -6, 18, 10, 14, -29, 1, 84,
+    12, -17, -1, -37, -46, 22, -36, -30, -56, -57, -91, -21, -23, 1, 6, 7,
+    50, -52, -15, 4, 0, 14, -17, 15, -23, -13, -1, 2, 33, 17, 14, 6,
+    -16, 14, 8, 26, -5, 0, 30, -10, 12, -2, -44, 15, 16, 3, -16, 34,
+    8, 19, 7, -22, -38, 8, 4, 10, -50, -26, -18, 6, 0, -6, 2, -27,
+    2, 0, 0, -23, 1, 21, 7, 18, -8, -12, 19, -6, -5, 27, -6, -31,
+    -45, -43, -32, 2, 6, -15, -38, -31, -3, 19, 15, 13, 35, 51, -5, 20,
+    19, 48, 39, 29, 33, -19, 19, 5, -10, -11, -12, -18, -7, -4, -3, 15,
+    -26, 8, -19, 34, -34, 1, 16, -18, -3, 30, 49, -29, -19, -11, -11, -16,
+    -2, 39, 7, -29, 15, -67, -47, -47, 0, 18, 5, 45, 16, 31, -7, -39,
+    8, -15, -30, 10, -2, -6, -5, 20, 0, 0, -76, -23, 40, -51, -15, -11,
+    17, 27, 0, 1, -15, -43, 28, 7, 16, -24, -83, -46, -98, -59, -8, -10,
+    -35, -22, -11, 9, 28, -19, -35, -36, -31, -3, -119, 8, -8, -5, -43, -26,
+    5, 6, -7, 12, 12, -45, -31, 3, -25, 2, 31, -7, -12, -19, -4, 9,
+    10, -11, -14, 2, 2, 7, 58, -13, -37, -5, -17, 5, 14, 2, 32, -38,
+    2, -21, -37, -13, -4, 11, 18, -7, -9, -11, -9, -13, 25, -16, -17, -30,
+    -18, -14, 24, 10, 14, -11, 2, -15, 7, 10, -28, 7, -26, -82, 25, -13,
+    -7, 8, 51, -8, -4, 11, 24, 43, -6, -14, -3, 21, 6, 1, -5, 35,
+    11, -26, -4, -30, 0, 3, 11, 13, -36, -16, 16, 0, -18, 27, 10, 15,
+    0, 10, 2, 6, 4, 26, 8, 13, 18, -17, -22, 22, -9, 48, 69, -99,
+    -77, 16, -8, -2, -5, -5, -12, 7, -36, -4, -4, 12, -25, 47, 25, 0,
+    11, -2, 12, 9, 25, 36, 8, 6, -26, 19, 31, -49, -18, 15, 14, 1,
+    20, -4, -61, -7, 13, 20, 2, 9, 5, -14, -3, 0, 9, 0, -12, -78,
+    23, 6, 19, 12, -5, 19, -10, 1, 23, -6, 41, 26, 4, 9, 1, -38,
+    -53, -62, -13, 6, -24, -27, -1, -13, -15, -15, -16, 3, 31, 0, -63, -51,
+    -50, -42, -52, 6, -11, -30, -52, 1, -6, 26, 10, 5, 29, 10, 26, 27,
+    69, 42, 53, 55, 5, 8, -11, -3, 2, 1, 6, 21, 8, 7, -4, 18,
+    14, 9, -7, 15, 37, -1, 12, -25, -11, -10, 8, 32, 9, -23, 16, 8,
+    10, -3, 23, 20, 12, -13, -33, -18, 51, 24, -1, 21, 16, -18, -51, -41,
+    4, 10, -32, -37, -5, 0, 6, -26, 40, 27, 41, -9, 0, 2, -15, 15,
+    0, -9, -14, -50, 9, 9, 3, 14, -3, -43, -5, -19, -1, -8, 3, 26,
+    22, 13, -1, -32, 8, 22, 2, -46, -38, -9, 3, -4, 6, -6, -10, 16,
+    10, 3, 2, -3, -1, 11, 10, -9, 14, -3, -9, 4, 4, 11, 6, -10,
+    9, 12, -12, -1, -4, 1, 23, -49, -5, -25, -6, -8, 3, 42, 7, -32,
+    3, 12, -12, 0, 34, 38, 39, 4, 11, 11, -3, 3, -3, 4, 17, -1,
+    2, -29, -1, -45, -127, -35, -1, -8, 15, -9, 12, 21, 26, -7, -14, -35,
+    -11, 2, 4, 1, -11, -64, -2, 24, 44, 17, 6, -22, -55, -5, 39, 27,
+    39, 7, 18, -42, -22, 1, 11, 1, 12, -113, -26, -10, 1, 2, -1, 3,
+    -58, -49, -27, 51, 70, -23, -50, -16, -6, -5, -4, -4, -6, 0, -2, -4,
+    0, -2, -6, -2, 2, 3, 8, 2, -4, -5, -6, -5, -1, -10, -2, -8,
+    1, -7, -9, 5, 9, -2, -5, -3, 0, 1, 8, -2, -4, -5, -4, 7,
+    -7, -1, -3, 2, -3, -3, 1, -2, -3, -4, 7, 41, 33, 48, 7, -37,
+    -21, 12, 3, 6, -3, 6, -53, -11, 1, 17, 20, 11, 25, -14, -30, -15,
+    -13, -3, 23, 18, -37, -66, 16, 4, 7, 20, 24, -28, -15, -14, 14, 3,
+    2, -7, -21, -16, 28, 17, -4, 0, -4, 0, 25, 14, -18, 43, 55, 18,
+    -18, 1, 11, -12, 7, 16, 0, -26, -3, -22, -2, 22, -4, 6, 32, -65,
+    -32, -18, -12, 15, 7, -15, -20, -15, -6, -4, 26, -11, -14, 1, 0, 9,
+    -23, -7, 2, -1, -18, 49, -9, -7, -7, -12, -21, 12, 1, 9, -29, 16,
+    -6, -3, 63, -22, 3, -14, 8, -39, -55, -102, 12, -11, -4, 11, 40, 12,
+    19, -25, -35, -22, 39, 16, -4, -40, -30, -19, -30, -17, 9, -13, -113, 14,
+    -34, 5, 10, 10, 6, -42, 36, -49, 7, 24, 67, -11, 6, -6, -1, -7,
+    -11, -2, 8, -11, -7, -2, -14, 2, -12, 7, -4, -11, -15, -43, -22, -39,
+    17, -4, -3, -12, 11, 22, -12, 41, -4, -8, 1, 31, 16, -42, 15, -12,
+    3, -4, 1, -8, -25, -5, -7, -10, -7, -15, -12, 6, -6, -5, 8, 2,
+    12, -43, -4, -11, -9, 38, 45, -17, -83, 1, 15, 16, 4, -36, 5, -10,
+    -10, 7, 5, 28, -47, -10, 5, 14, 8, 7, -13, -109, -73, -9, 5, 8,
+    29, 18, -28, -29, 11, -8, 22, -28, 8, 47, 14, 22, 5, -8, 8, 53,
+    -4, 6, 15, 39, -3, -3, 10, -8, -18, 27, 5, 6, -6, -18, -23, -10,
+    18, -6, -6, -10, -32, -41, 7, 33, 14, -9, 7, -6, -19, -2, 15, -9,
+    2, -15, 14, 9, -17, -2, -4, -16, 6, 4, 19, -7, 17, -2, 34, -12,
+    27, -11, -17, -9, 17, 5, 25, -20, -12, 3, 29, -18, -56, -68, -3, 11,
+    59, 64, 9, -21, -41, 13, -12, 32, 27, 32, 32, 14, -24, 0, -20, -3,
+    12, -19, -34, -2, 16, 18, 37, 49, 5, 15, -70, 3, -2, 19, 7, 5,
+    3, 2, -25, -9, -66, -4, -23, 9, 16, 9, 0, -2, -10, 7, -6, 39,
+    -11, 7, 12, 51, 6, 19, 28, -14, 16, 29, 8, 7, 14, -54, -29, -15,
+    36, -3, -9, 42, -30, -22, -11, 15, 12, 22, 30, 50, -33, -48, 15, -5,
+    36, -23, 15, 8, -16, 25, 10, -1, 29, -11, 6, 15, -3, -7, -19, -23,
+    16, 2, -9, -4, 15, -3, -24, 3, -44, -40, -42, -22, -9, -10, -9, 2,
+    -30, -2, -28, -26, 6, 4, 29, 1, 8, 3, -9, 29, -6, 25, -4, -9,
+    -11, -35, 45, -7, -11, -34, -1, -6, -3, -4, 17, 28, 39, 23, 23, -33,
+    -47, 10, 7, 22, 12, 10, -25, -77, 2, 3, 0, 14, 14, 11, -30, -33,
+    -31, 20, 8, -14, -41, -60, -12, -4, 20, 1, -15, -9, -12, 6, 11, 8,
+    0, -12, 0, -28, 3, 37, 15, 13, 10, 19, -5, -30, 28, 37, 0, 2,
+    21, -15, -35, -20, -13, -19, -15, -41, -16, -40, -10, -9, 17, 13, 0, -33,
+    -12, 36, -52, -11, 10, -2, -19, 28, 0, -8, 12, -15, -57, -41, 13, 17,
+    18, -35, 31, 35, -17, 13, -29, 1, -22, -8, -43, -1, -12, 3, 16, 21,
+    -11, -23, -14, -29, -38, -29, 5, -12, -38, -63, -19, -53, -17, 17, 7, 34,
+    18, -1, -21, -17, 52, 6, 1, -28, 32, 26, -15, 12, -6, -12, -38, 8,
+    13, -18, -20, -8, -13, 0, -1, 1, -10, -4, -3, 3, -17, 7, 67, 5,
+    -29, 20, 15, -3, -22, 14, 24, -11, -11, 28, 6, 23, 18, -10, -9, 11,
+    1, -1, -24, -17, -16, -29, 12, -12, -14, -19, -7, 22, -4, -8, 8, 20,
+    -8, 10, 18, 7, 7, 11, 3, 4, -25, 17, -66, -19, 13, -19, 21, -26,
+    -22, -31, -5, 2, 0, 19, 2, -5, -14, -9, -16, -9, 4, -14, 31, 82,
+    2, 21, 2, -26, -58, -45, 8, 5, 19, 3, 4, 5, 10, 7, 25, 12,
+    -6, 26, 24, 13, 7, 35, 38, -5, -3, -13, -31, -31, 3, -2, -2, -14,
+    69, 12, -4, -50, -5, -16, -21, 32, 16, -47, -22, -36, 2, 13, 38, 19,
+    20, -13, 12, -17, -31, 38, 24, 41, -12, -19, -17, -24, -36, 21, 12, 7,
+    -7, 6, -14, 3, 3, 16, -10, -6, -3, 1, 2, 1, 6, 11, 25, 55,
+    10, 0, -1, -6, 1, -13, 13, 4, -42, -57, -45, 9, -7, -7, 20, 13,
+    -18, -10, 11, -1, 3, 1, 30, 9, 27, 13, -8, 20, 18, 63, 16, -21,
+    7, 0, -8, -14, 8, -20, -4, -7, -21, -7, 7, -13, -26, 0, -14, -59,
+    17, 26, 6, -8, -32, -36, -90, 27, -26, -18, -7, -39, -61, 2, 3, -1,
+    -3, 14, -12, -99, -27, -4, -29, -36, -29, -37, 17, 44, 34, -30, 6, -25,
+    -35, 6, 12, 25, 21, -4, 13, -50, -6, 5, 1, 57, 4, 25, 21, 22,
+    -64, -1, 1, -16, 12, 11, -8, -33, 11, -3, -4, -13, 3, 14, 1, -1,
+    -18, -28, -19, 30, 15, -30, -5, 4, -6, 19, 1, -24, 8, -12, -1, 10,
+    2, 2, 4, -4, 10, 18, 20, 18, -15, 6, 18, -4, 7, 8, 1, -27,
+    -17, -40, 34, 6, 15, 22, -13, -17, 14, -25, 32, -14, 2, 17, 51, 33,
+    44, -22, -22, 21, 24, -9, -29, 1, -26, -5, -42, -8, -9, -4, -5, -28,
+    -31, -42, 12, 6, 32, -46, 46, -56, 9, 12, 38, 22, -10, -7, -1, 18,
+    -83, 12, -34, -4, 0, 4, -36, -33, 13, -11, -26, -2, 26, -29, 5, 28,
+    2, -5, -17, 30, 0, -12, 18, -4, -1, 1, -14, -10, -16, -6, 8, 4,
+    1, -6, -43, -3, 13, 4, 6, -3, 3, -40, -16, -2, 21, 13, 20, 3,
+    -10, 5, 39, 22, -6, 8, 10, -14, 1, 8, 9, -5, -16, 1, -21, 13,
+    6, 12, -8, 6, -21, -13, 33, 40, 18, -2, -6, -23, -24, -8, 4, -8,
+    -2, -20, -9, -1, -18, 10, -24, -3, 0, 25, 58, 6, 1, -2, -5, 7,
+    -8, -4, -10, 8, -16, -3, -5, 30, 10, 8, -13, 20, -1, 31, -37, -32,
+    -21, 7, -11, -5, 2, -46, -35, 2, -16, -4, -21, 16, 2, -17, 11, 28,
+    -17, -11, 71, 6, 17, -13, -30, -12, -16, -1, 3, -46, -22, 19, -46, -2,
+    -50, -2, -1, -2, -6, -7, -21, 4, -2, 3, 23, 33, 21, 28, 3, 7,
+    16, 35, 33, 41, 6, 14, -3, -13, -9, 26, 48, -24, 6, -15, -3, 8,
+    -3, 16, -8, 1, -3, 15, 12, 21, 12, 2, -29, 16, 10, 46, 36, 24,
+    -5, 2, -46, -38, -16, -31, 0, 23, 14, -24, 39, 27, 11, -2, 1, 38,
+    16, 24, 4, 17, -9, -39, 42, 28, 11, -22, 17, -11, -32, 0, 2, -6,
+    5, 6, 4, -17, 1, -75, 23, -2, 13, 5, 6, -1, 53, 27, 19, -8,
+    -49, 40, -20, -26, -7, 14, -13, 21, 24, 25, -25, -5, -3, -8, 24, 30,
+    -9, 20, -1, -21, -26, -36, -16, 16, 34, 18, 8, 16, -4, -32, -20, -18,
+    10, -11, 3, -11, 11, -44, -17, -24, -65, 3, 7, -17, 62, 34, -6, 26,
+    24, -31, 17, 0, -11, -30, -30, -19, -40, 20, 3, -17, 55, 35, 15, 9,
+    -11, 13, 23, 39, 29, 16, 5, -32, 52, 6, 31, -20, -5, -13, -29, -3,
+    -21, 25, -3, 0, 2, 0, 0, -42, -19, -6, -8, -1, -3, -1, 40, -11,
+    26, -20, -21, 45, -4, -43, -2, -4, 3, -17, 15, -7, -26, -23, -24, -8,
+    14, 19, -33, 20, 4, 8, 8, 53, 25, -22, 25, -4, -46, 1, 25, 3,
+    -10, 18, -9, -11, -34, 17, -6, 15, 12, -14, -14, -37, -11, -40, 25, 17,
+    -7, 31, 15, 41, -1, -5, -2, 2, 3, 13, -1, -2, 89, -1, 3, -19,
+    -19, 4, 7, 25, -2, -49, -41, -64, -13, -18, -44, -63, -19, -16, -57, -23,
+    4, 14, -48, -28, 17, -8, 8, 15, 13, 3, -33, -23, -37, 5, 6, -9,
+    -10, 21, 15, 80, -7, -30, -5, -14, -30, -76, -23, -38, -8, 2, 12, -20,
+    -63, -78, -69, 2, 2, -9, -31, -36, -40, -29, 14, 6, 20, 22, 4, -34,
+    11, -17, 14, 10, 6, 13, 18, 5, -1, -11, 21, 5, -8, 3, -9, -34,
+    30, 9, -16, -9, -10, -8, 3, -3, -9, -13, 3, 5, -10, -5, 43, 5,
+    34, -1, -6, -8, -21, -3, 0, 18, -4, 16, 4, -18, -66, -43, 7, -18,
+    -34, 11, 18, -6, -7, 11, -25, -32, -14, -4, 5, 10, -56, 53, 1, 4,
+    17, -16, -12, 27, 56, 23, -17, 11, -22, -10, 6, 8, 39, -24, -11, 29,
+    -16, -5, -7, -15, 4, 39, -17, 14, -6, -33, -13, -3, 24, 11, 25, -37,
+    21, -6, 39, 18, -7, -3, 5, 14, 1, 36, 23, -18, 16, -16, 14, -21,
+    -5, -9, 44, 4, -127, -9, -2, -36, -21, 1, 2, 3, -3, 1, -5, 5,
+    -3, 0, -1, -5, -3, 1, -4, -4, 1, 4, -8, 0, 2, -10, 2, 2,
+    -4, 0, 9, 7, 4, -1, 1, 2, -3, 2, -1, 1, 0, -5, 0, -3,
+    6, 6, 7, -3, -1, -1, 4, -1, -1, 0, 3, -11, -46, -63, -15, -25,
+    0, 11, -30, -64, -97, -81, -27, 12, 1, -16, -34, -21, 4, -11, 21, 18,
+    11, 23, 10, 15, 30, 7, 9, 7, 3, 11, 17, 8, 2, 24, 6, 11,
+    -12, 10, 8, -27, 35, -8, -17, 7, 5, -10, 21, -43, -21, 16, -50, -31,
+    3, -4, 21, 29, 25, -32, -55, -45, -36, 8, 25, 5, -26, -8, 4, 34,
+    21, 8, 4, -8, -18, -13, 18, 14, 6, -1, 0, -6, -11, -13, 0, 22,
+    -16, -6, 16, 36, 3, 64, 11, -9, -20, 13, -3, 11, -2, -29, -16, -1,
+    -3, -1, 31, -17, -27, 0, -16, 14, 21, -14, -39, -13, 14, 3, 6, 12,
+    33, -27, 8, 13, -28, -12, 21, 18, 6, 17, 11, 15, -20, -3, -39, 6,
+    30, -2, -1, 13, 4, 34, 21, 0, -9, -33, 25, -45, 1, -8, -5, 2,
+    14, 1, 9, -14, -7, 5, 12, 20, 34, 4, -1, 1, 25, -6, -42, -10,
+    -10, -2, -9, -33, -31, -36, -61, -41, -23, -9, 18, 2, 17, -34, -12, -2,
+    -7, -8, 8, -31, -13, -5, -1, -12, -4, -2, -26, -31, -1, -10, 1, 1,
+    -44, 0, -36, -9, -1, 1, -15, -1, 7, 3, 31, 28, -19, 11, -13, 0,
+    0, 8, -38, -24, -26, -6, -19, -8, -6, -18, 55, 13, -17, -14, -2, 18,
+    6, -18, 4, 25, 23, 25, 9, 10, -46, -11, -1, -18, -42, -26, 4, -25,
+    -4, -21, 5, -16, -2, 1, 36, 0, -27, 5, 52, 6, 10, -6, 0, -3,
+    -30, -26, -25, 20, 62, 5, 15, 9, -1, 11, -20, 13, 11, -2, 16, 1,
+    -18, -17, -6, -30, -21, -4, 15, 28, -8, 47, -17, -7, -16, -36, -8, -2,
+    -47, 10, -7, 6, 1, 17, 23, 28, -27, -1, -11, 44, 24, 17, 13, 22,
+    -8, -29, -4, 8, -5, 4, 1, -36, -4, -6, -8, 2, 1, 14, -33, -1,
+    8, 28, -29, -24, 12, -8, -10, -30, -3, -12, 60, -29, -14, 13, -8, 21,
+    31, -2, -6, -39, 26, -13, -29, 6, -4, -14, -22, 13, 7, 13, 9, 42,
+    -47, 1, 23, -27, -25, -40, -45, -29, 1, -14, -1, -9, -16, 37, 22, 12,
+    7, -6, -39, -20, 13, 23, 3, -1, -3, -47, 5, -28, 13, 8, -36, -38,
+    -21, -17, -10, -14, -10, 11, 15, 5, 10, 9, -8, -15, -32, -14, 0, 16,
+    -15, 16, 10, -31, 4, 8, -14, 1, 45, -9, 13, -2, 11, -4, -8, 7,
+    -10, 6, 20, 52, -12, 3, -25, -9, -54, -62, 35, -24, 20, -13, -21, 2,
+    13, 16, 16, -3, -6, 0, -10, -5, -19, -2, -41, 27, 14, -12, -22, -8,
+    -13, -7, 1, 25, 14, -2, 17, 35, 17, 44, 21, 28, -63, 0, 37, 2,
+    15, 12, 17, -21, 27, -1, 2, 4, -10, -7, -23, 19, -2, 25, -7, -28,
+    -12, 4, -7, -14, -16, -17, -35, 8, -3, -12, -36, -25, 21, 16, 36, -3,
+    17, 19, 6, 19, 20, -26, 18, -3, -4, -2, 0, -31, 14, 5, 18, 30,
+    -6, -13, 2, 2, 18, 32, -4, -25, -5, -36, -8, 7, 40, -24, -24, 25,
+    31, -12, -41, -36, 0, -16, -5, 31, -31, 20, -18, 4, 19, 27, 40, 25,
+    3, 9, -16, 1, 38, 40, 10, 5, 30, 25, 10, -5, 7, -1, -19, -3,
+    13, 10, -10, -8, -14, 1, -10, -16, -18, -10, -28, -1, 13, 47, -10, -7,
+    25, 6, -12, -7, -4, -4, 0, -5, -4, -31, 23, -18, -23, -4, -17, -31,
+    -32, 11, 24, 9, 12, 11, 12, 10, 6, 24, 2, -48, 3, 2, 12, -2,
+    -10, -13, 29, 2, 5, 4, 15, -7, 3, 9, 10, -3, -16, -15, 10, 6,
+    -32, -29, -20, -17, -5, -9, 14, -1, -48, -38, 3, -5, -42, -15, -4, -6,
+    -4, -8, 11, 27, 16, 21, -19, -11, -23, -3, 13, -10, -24, 20, 2, -8,
+    -1, -6, -11, 11, 8, 20, -14, -16, 25, 17, -1, 24, 16, 19, 11, -12,
+    -12, -59, 18, -36, -10, 3, -15, 1, 13, 12, -4, -9, -5, -7, -7, -1,
+    25, -25, -103, -4, -20, -20, 10, -9, -20, 24, -64, 31, -3, -35, -29, -53,
+    -24, 14, 33, 16, -3, -7, -8, -21, 0, 13, 15, 28, 9, -14, -23, -17,
+    -7, -24, -1, 5, -15, -5, -3, 4, 7, -27, -11, -16, 7, -6, 11, -2,
+    66, 7, 19, -22, -8, -9, -7, -25, -11, -5, -14, 6, 6, 5, 0, -37,
+    6, 11, -17, 16, 6, 14, -3, -20, 12, -3, -28, -10, 17, -26, -24, -41,
+    17, -8, 18, -37, 8, -6, 31, 16, -28, 13, -43, -22, 5, 8, 11, -5,
+    -35, -2, -27, 3, 18, 41, 31, -16, 11, -1, 7, -8, 40, 34, -84, -3,
+    -3, -5, -27, 34, -50, -7, -15, -4, -3, 7, 11, 11, -16, -6, -2, 12,
+    27, 28, 24, -2, 19, 24, 15, 23, 5, 5, 35, -26, -54, -11, -63, -25,
+    -10, -26, 28, 27, -16, -9, -52, -21, 51, 2, -18, -19, -10, -30, 16, -27,
+    41, 12, 14, 23, 10, 3, -19, 3, 8, 15, 3, 19, 9, -2, -34, 1,
+    -9, -3, -3, 10, -27, 57, -6, -22, -22, -38, -53, 14, 2, -57, -2, -17,
+    -12, -32, 4, -14, 5, -19, 7, 19, 7, 22, 37, -1, 19, 24, -6, 21,
+    -29, -21, -33, -2, -5, 13, 7, -18, -4, 11, 7, -2, -8, 6, 21, -24,
+    16, 9, 11, 0, -1, -58, -35, 40, -6, -6, -11, -28, -17, 8, 9, -7,
+    -27, 17, -41, -16, 2, -39, 51, 2, 33, 20, 3, -3, 33, 3, 5, -4,
+    19, -17, 35, -56, -11, -33, -18, -12, -30, -12, -23, -25, -13, 21, -11, -3,
+    -2, -13, -2, -12, 1, -5, -12, 3, 33, 9, 11, 5, 3, 13, -9, -1,
+    -15, -36, -32, -29, 0, 39, -37, -54, -44, -29, -2, -8, 8, 11, -6, -23,
+    2, -32, -12, 63, 28, 23, 12, 16, 20, -7, -4, 15, 20, -17, 6, -4,
+    -4, -35, -31, 10, -11, -45, -17, 1, -17, -56, -55, -14, -40, -9, -1, -10,
+    27, -14, 14, 11, 25, -26, 18, -18, 5, 18, 14, 34, 5, -14, 21, 20,
+    12, -6, 50, -7, 23, 4, -1, -6, 14, 11, -11, 2, 3, 4, -9, 5,
+    3, -10, -16, -45, -26, -12, 1, 26, 1, -4, 49, -8, 2, -1, -18, 23,
+    -8, -44, -8, 15, 21, 1, 24, 11, 4, 25, 49, 39, 81, 30, 14, -5,
+    46, 20, -79, -11, -95, -22, -2, 20, 5, -30, -4, -41, -16, -34, -26, -10,
+    9, -36, -39, -25, -6, -45, 0, -51, 3, -6, -15, -11, -64, -64, -22, -7,
+    2, 0, -58, 28, 28, 30, -18, -37, -7, 6, 11, -21, -10, -10, -9, -10,
+    -38, -7, 1, -37, -46, 27, -35, -11, 38, 12, -6, -10, 9, 39, 38, -21,
+    8, 15, -10, 5, -11, 7, -49, -27, -15, -12, 43, -5, -3, -16, -19, 8,
+    -5, 26, -1, -50, -3, -14, -24, 17, -13, -32, 6, 8, -16, -20, -5, -22,
+    -6, -14, -1, 13, -22, -42, -4, -37, 11, -3, 6, 16, 15, 7, 9, 2,
+    8, 17, 23, -5, 16, -3, 9, 9, -4, -6, -7, -26, -28, -45, 28, 12,
+    -53, -71, -18, 3, -21, -60, -37, 45, 39, -36, -4, -5, -29, -26, -23, 17,
+    -26, -4, -37, 17, -32, -71, -27, -15, 2, -53, -45, 12, 2, -12, -4, 3,
+    -49, -55, 2, -6, -7, 8, -4, 55, 11, 41, 5, 10, 22, 3, 1, 9,
+    52, 18, 34, 34, 2, -12, 8, 25, 18, -8, -12, -33, 13, -28, -8, 21,
+    43, 31, 30, -35, -7, -27, 7, -5, 20, 7, -14, -25, 9, -66, -80, -38,
+    22, -2, -63, -8, 1, 30, -34, -16, 16, 0, 4, 16, 20, -17, -37, -47,
+    -51, 20, 24, 82, 4, -20, -1, -6, -9, -6, -5, 0, -44, -16, 3, -9,
+    3, 8, -10, -69, -78, -40, 3, 46, 18, 15, 29, 32, 7, 60, 38, 17,
+    23, -19, 26, 41, 14, 33, -7, 10, 3, 26, 32, 0, -2, 42, -33, -3,
+    11, 76, 15, -33, 24, 1, 3, -4, -65, -68, -22, 3, 3, -9, -27, -35,
+    13, 24, -8, 33, 9, -19, -6, 2, 51, 45, 31, -22, 5, -1, 14, 35,
+    2, -14, -8, 5, 23, -19, 1, -43, -4, 1, -6, -11, -5, -6, -13, -28,
+    17, 10, 21, 15, -8, -1, -3, 16, -22, 7, -10, 16, 5, -1, -27, -6,
+    -21, -56, -30, -27, -18, -2, -38, 14, 10, -48, -28, -47, 41, 85, 39, 49,
+    19, 13, -3, -1, 23, 2, 8, 20, 19, 4, -11, 57, -1, 13, 2, -17,
+    12, 20, 11, 2, 12, -22, -55, -45, -9, -21, -59, 3, 8, 11, 4, -29,
+    -20, 9, -4, 21, 10, 7, -66, -43, -63, 13, 54, 33, 17, -73, -25, -4,
+    7, -2, -14, -54, 16, 19, -5, 12, -17, -38, -19, -16, 8, 21, 18, -51,
+    -18, 52, -11, -35, 7, 60, 5, 20, -2, 5, -1, -3, 0, -2, 3, -6,
+    3, -2, -4, -5, -6, -5, 5, 1, -6, 2, -1, -7, -8, 13, 0, 9,
+    -1, 2, 1, 11, 12, -3, 2, -7, -5, -6, 8, 8, 5, 3, 8, -10,
+    3, 4, 2, 1, -2, -3, 4, -5, 5, -3, -7, -29, -65, -5, -3, -3,
+    0, -27, -30, -15, 20, 52, 22, 7, 8, 5, -31, 15, 41, 42, 35, -49,
+    44, 24, 20, 16, 18, 8, 13, 6, 26, 4, -25, -72, -79, 0, -10, 25,
+    9, -20, -18, 3, -56, 7, 28, 28, -1, -6, 8, -33, -3, -104, 26, -57,
+    -7, 5, -41, 21, 6, -46, -23, -37, 17, -42, 6, -23, -24, -36, -19, 75,
+    -51, 5, 15, 3, 19, 21, 53, 35, -8, -25, -4, 16, -2, 12, -19, -6,
+    2, 8, -11, -14, -26, -37, -26, 17, 5, 9, -12, 32, -2, -26, 29, 29,
+    20, -27, -29, 33, -12, -31, -35, -1, 51, 62, 20, -1, 2, -35, -127, -48,
+    -15, -10, -19, -3, 2, -25, -39, -25, -58, -62, 5, -3, 5, 19, -30, -27,
+    42, 25, -8, 15, 30, 31, -20, -5, 28, 19, 48, 80, 3, -9, -9, 0,
+    -4, -4, -27, -2, -9, -11, 2, -15, -13, -36, 18, -20, -24, 20, 24, 45,
+    -23, 3, -1, 5, 15, 31, -5, 8, 19, -8, 24, 6, -40, -5, 22, -3,
+    11, -20, 29, 20, 37, -9, 0, -2, -6, -18, 24, 8, -11, -11, -4, -5,
+    -32, -37, 46, 27, -3, -1, -61, 54, 12, -13, 20, 20, -88, -16, -5, 16,
+    -16, 6, -4, -1, -72, -58, -47, -3, -20, 13, 26, 33, -54, 16, -11, 7,
+    14, -68, 33, -46, -18, -12, -1, 41, -31, -10, 66, 3, 43, -7, 24, -7,
+    -12, -62, -21, 49, 14, 2, -57, 13, 20, -15, -7, 11, -9, -44, 1, -5,
+    2, 27, 18, 1, -28, 1, 14, 18, 23, 22, 22, 17, -6, -4, -26, 8,
+    -4, -39, -19, -5, 15, -9, -16, 1, 6, -11, -56, 23, 13, 15, 13, 25,
+    -9, -23, 19, 6, -12, -22, 21, -7, 2, -20, 1, 30, 66, 22, -57, -48,
+    -39, -16, 16, 46, 0, -46, -11, -27, 1, 25, -44, -24, 16, 26, -4, 29,
+    -5, -38, 2, -6, 8, 81, 0, 6, 9, -2, -40, -8, 2, 7, 11, -9,
+    26, 3, 3, -21, -11, 28, 18, 30, -6, -41, 7, -32, 3, -1, 7, -26,
+    -12, -18, -28, -89, -30, -28, -21, 34, 30, 15, -43, -22, 35, -46, -34, 4,
+    3, -23, -24, -22, -35, 36, 39, 11, 30, 22, 64, -12, 5, 31, 10, 33,
+    38, 37, -7, -16, 33, 5, -4, -23, 2, -43, 2, -16, -14, 25, 41, 6,
+    31, -26, 14, -11, 27, 23, 27, -44, -25, -36, -15, -2, -57, 11, -4, -43,
+    -47, 18, 9, -12, -27, -19, 1, 8, 18, 23, 31, -90, -1, -5, 40, 22,
+    22, 26, -18, -3, -2, -1, -3, 3, -2, 2, -63, -80, -42, 0, -7, 39,
+    44, -47, -11, 11, 10, 34, 59, 49, -36, 11, 14, 20, 6, 47, 9, 11,
+    9, 1, -29, 35, 16, 22, -18, -2, 7, 23, -12, -26, 0, 31, 2, 7,
+    6, -11, -16, -9, -7, -47, 15, -2, -26, 8, -26, 9, -11, 6, -16, 42,
+    -4, 26, -7, 0, 6, -41, 21, 8, 26, -11, -5, -16, -14, 17, -3, 33,
+    11, -22, 6, 19, 9, 14, -2, 26, -18, -6, -9, -24, -62, -2, -11, -68,
+    -41, 51, -27, -32, -51, -1, -11, -4, -13, -17, 44, 8, -33, -15, 66, -35,
+    -29, -42, 13, 27, -2, 9, -12, -2, -4, 65, -13, 13, 14, 6, 3, 5,
+    46, -28, -13, -3, -4, -5, -14, 7, -21, -15, 5, -23, 20, -56, -11, -33,
+    -65, -13, -11, 1, -17, 35, -3, -6, 4, 1, -13, -12, -14, 1, -76, 9,
+    68, 5, 34, -2, 21, -9, -38, 21, -7, 12, -9, 25, 65, 20, 46, -38,
+    -23, -9, -1, 31, -8, -14, -52, -5, -10, -20, -3, -1, 7, -4, -6, 3,
+    14, -11, 3, -6, 0, 5, 2, -3, -8, -6, 8, -8, 43, -39, -14, 22,
+    -16, 25, 26, -14, 14, 47, 16, -26, 9, 23, 9, 60, -22, -53, -19, -18,
+    -59, -47, 1, 5, -18, -23, 32, -19, 23, -4, -5, -39, 17, 24, 16, 7,
+    9, 23, -15, 2, 37, 54, -22, 6, -11, 10, -13, -1, -8, -4, -14, 1,
+    -56, -30, 81, 21, 28, 22, -13, -82, -68, 38, 44, 48, 18, 33, 44, 55,
+    30, 5, 8, -2, -19, 46, 44, 0, -29, -7, 23, -39, 5, 9, -6, -2,
+    -17, -19, 14, -11, -10, -13, 2, 3, 1, 16, -18, 17, -3, -3, -6, 11,
+    -94, 5, 35, -17, -21, -34, -22, -37, -6, 5, 44, 13, 6, -40, 2, 89,
+    10, 12, 26, -12, -2, -20, 31, 14, 17, -7, -15, 14, 3, 37, -12, -8,
+    -45, -41, 22, -4, -11, -18, -45, -34, 25, -11, 0, -2, 14, 24, -6, 28,
+    3, -18, 15, -7, 43, 22, -18, 3, -12, -3, -9, 25, -101, -46, -37, -25,
+    -5, 19, 53, 21, 11, 13, 11, -7, -46, -16, 4, 13, 2, 40, -37, -71,
+    -12, 1, 21, 20, -18, -33, -69, -90, -4, -22, -13, -6, -28, -86, -6, -13,
+    27, 51, -47, -3, -16, -1, 8, 23, -5, -24, -14, 18, 17, 20, -1, 51,
+    -51, 26, 39, 1, -31, -50, 6, 17, -1, -7, -11, 7, 0, -46, -6, 2,
+    14, 0, -14, 14, 68, -52, -41, 16, 3, -13, 44, 52, -7, -9, -17, 11,
+    28, 10, 14, -16, -2, -61, -33, 30, 23, 31, -6, 30, -5, -36, -85, -86,
+    40, -38, -2, 11, -3, -38, -92, 5, -63, 11, -5, 8, 6, -10, 7, -32,
+    -1, 38, 15, 25, 26, 91, -9, 12, -45, -6, 14, 52, 55, -2, 6, 1,
+    -12, 24, 29, 16, 4, -4, 10, 24, 30, 42, -12, 3, -24, -23, 20, -38,
+    3, -21, -5, -48, -17, 2, -70, -42, 1, 0, 20, 27, -14, -33, -6, -9,
+    -7, 88, 15, -5, 14, 5, -12, -5, 13, -6, 17, 12, 10, 19, -2, -44,
+    13, 24, 19, -13, 2, -35, 13, 16, -1, 32, 7, 35, -11, -9, 8, -18,
+    14, 63, -4, -50, -27, -4, -10, -20, -19, -3, 1, -6, -11, -30, 1, 45,
+    -2, 15, 2, -22, -1, 2, 3, 4, -3, -8, 0, -9, 39, 4, -1, 2,
+    -56, -6, 6, -10, 8, 0, 4, -28, 21, -13, 14, -38, 5, 12, 24, -13,
+    1, -13, -92, -32, -17, -6, 37, -2, -26, 8, -20, -13, -15, -21, -14, 28,
+    25, 12, -52, -7, -17, -41, -23, -56, 57, -1, -27, 16, -68, 6, -20, 31,
+    34, 39, 35, 7, 0, 3, 27, 35, 26, 17, 6, 1, 11, -62, 20, 18,
+    8, 19, -33, -27, -18, 0, 14, 4, 20, -20, -33, -25, -16, 15, 11, -18,
+    -10, -2, -1, -3, -2, -7, -73, -23, -69, -5, -7, 41, -33, -85, -75, -68,
+    2, -11, 6, 25, 31, 21, 26, 30, -4, 17, 38, 24, -11, 9, 12, -9,
+    21, 7, 13, -24, -6, -1, -11, 30, 9, 6, -40, -4, 1, -7, 18, -4,
+    8, 1, 2, -19, -7, -39, -3, -13, -1, -7, -20, 0, -12, -16, -56, 11,
+    -9, -7, 20, 31, 6, -9, -4, -7, 13, -1, 14, -45, -9, -10, -1, -7,
+    -10, -1, 3, -26, 14, 4, 11, -46, 7, -6, 10, 14, 11, 8, -15, 5,
+    -4, 10, 23, 12, 20, -4, -42, 0, 5, 4, -16, -6, -2, 5, -48, -56,
+    -38, -43, -41, 0, 22, 84, 39, -8, 7, 20, -1, 55, 27, 5, -7, -10,
+    15, 0, 20, -1, 15, -27, -15, -18, -4, 55, 0, 16, -59, -18, -10, -2,
+    25, 26, 1, 20, 6, -11, 3, -25, -4, -16, 32, 3, 4, 2, -3, -7,
+    -24, 23, 10, -8, -13, 42, 23, -4, 5, 15, -7, 1, 8, -9, -11, 1,
+    -2, -24, -66, 9, 5, 9, 28, 8, 13, 22, 18, -6, 30, -18, -11, -52,
+    -11, 23, 10, -9, -8, -5, -4, 9, 5, -62, -12, -9, -44, -31, -8, 24,
+    -115, -99, -70, -10, -2, 25, 32, -5, 3, -10, -10, 3, -25, -13, -23, -30,
+    3, -18, -13, -14, -5, -40, 10, 30, 39, 20, -28, -46, -22, 47, 43, 30,
+    -10, 6, -54, -51, -19, 16, 3, -24, -5, -23, -54, 18, -20, -87, -66, -4,
+    11, -13, 6, -27, -15, 0, -1, 19, -60, 4, 39, 48, 20, 6, -22, -22,
+    -35, 17, 17, 1, -20, -7, -74, -36, 3, 20, -7, -8, -1, -49, -13, 25,
+    -22, -22, 4, 11, -27, -13, -15, -7, -9, 11, -2, 6, 12, 13, 1, -13,
+    -17, -9, 0, 4, -1, 9, -43, 11, 20, 10, 18, -7, 10, 14, 2, -3,
+    -21, -17, -28, -12, -1, -11, 7, -1, 5, 7, 3, 11, -5, -29, -11, 6,
+    22, 1, 11, 0, -52, -11, 13, 6, -9, 7, -9, -17, -36, -9, -41, -14,
+    -21, -5, 23, 39, 10, -23, -19, -44, 14, 11, -1, -12, -10, -12, -8, -3,
+    -11, -22, -19, -16, -9, -30, 0, -20, -32, -11, 45, 16, -32, -10, -2, -19,
+    14, 27, -6, -51, -18, -36, 3, -7, -5, -18, -2, 9, -33, -7, -16, -8,
+    -23, -58, 9, 1, 6, -9, 0, 3, -1, -3, -4, 4, 3, 3, 5, -1,
+    1, -2, 5, 4, 1, -11, -12, 4, -3, 3, 5, -5, -5, -1, 3, 6,
+    2, 5, -5, -2, -7, 6, 2, 2, 2, 2, -5, 4, 0, 1, -4, -2,
+    -6, -2, 3, 3, -2, -3, 4, 4, -4, -4, 0, -3, -53, -33, 4, -8,
+    -9, 3, -5, -18, 0, 8, 15, 23, -64, -35, -29, -17, -9, -12, -43, -13,
+    -31, -41, -1, -2, -52, -3, 5, -26, -19, 7, 16, -26, 2, 4, -9, -18,
+    15, 10, 20, 6, 0, -24, 4, 43, 49, -23, -35, 21, 38, -3, 1, 49,
+    16, -1, -8, 3, -52, 15, 1, 5, -4, -3, 27, -55, -35, 0, -1, -1,
+    -6, 9, -56, -28, 0, 7, -37, -28, 3, 27, -6, 17, -11, 50, -17, -5,
+    12, 29, -6, -7, 15, -6, -23, -1, -6, -17, -4, -42, -10, 24, 28, -3,
+    15, 35, 0, 31, 18, 7, 19, 7, 3, -62, 21, 20, 13, 28, -1, -18,
+    40, -34, 14, -13, 26, 0, -9, 40, 30, 5, -9, 2, -7, -3, 10, -14,
+    -12, -21, -6, -4, 8, -11, -3, -47, -97, 34, -77, 42, 3, -1, 12, 8,
+    -5, -19, -15, -3, -2, -13, -3, -7, -1, 21, -16, -4, -18, 7, 11, 16,
+    28, -2, -5, -12, 1, 24, 48, -5, 15, -1, -28, -42, -8, -23, -27, -2,
+    -4, 15, -45, -29, 26, 1, 2, -3, -6, 9, 8, 19, -8, -4, -2, 12,
+    50, 50, 12, 33, 24, 3, 16, 28, 32, 12, -4, -26, -7, 26, 6, -16,
+    -12, -19, -34, 2, 43, 14, 21, 10, -14, 21, -11, 8, 37, 3, -22, 9,
+    -1, 20, -21, 6, 23, -2, -23, -24, -11, -3, -28, -21, 34, -16, -10, 15,
+    12, 8, 13, -25, -14, 5, -17, -2, -20, -12, -20, -1, 6, 0, -16, 6,
+    -26, -36, -46, 4, -8, -19, -2, -3, -11, -21, -18, -2, 10, 18, 9, 10,
+    6, -8, -18, -4, 14, 35, -3, -8, 20, -3, -21, 33, -10, 15, -2, -33,
+    35, 23, -13, 5, 10, 12, 5, -39, -23, -21, -1, -20, -4, -29, 3, -1,
+    32, -1, 39, 26, 19, -2, 0, -5, -13, 15, -37, -36, -12, -41, -49, -19,
+    -28, -10, 25, -19, -11, -88, -70, 32, 5, 4, -2, -48, 43, -3, 3, -17,
+    -18, -2, 19, 52, 22, -13, 21, -3, -6, 9, 1, 2, 10, 14, -30, -6,
+    41, -6, 10, 11, -10, -34, -12, 29, -31, -23, 4, 12, 12, -7, 1, 15,
+    -25, 38, -8, 6, -5, 3, 10, -3, -13, 37, -3, -8, -41, -26, -12, 1,
+    -30, -17, 12, 21, 17, -6, 0, 7, -11, -15, -15, -12, -19, -2, 0, -2,
+    -10, -2, -4, -7, 17, 43, 27, 14, 10, 10, 22, 21, 2, -43, 12, -10,
+    0, -10, -1, -24, -4, -8, -8, 3, 12, 9, -13, 7, -1, -7, -48, -54,
+    -4, 1, -4, -1, 2, -3, -10, 24, 32, 2, 16, -28, -68, -46, -5, -2,
+    -4, -69, -40, -53, -18, 2, 28, -23, -2, -15, -127, -24, 4, 2, -58, -18,
+    1, -25, -17, 13, -4, 15, 26, -3, -1, 8, 10, -17, -41, -32, -10, -5,
+    1, 4, 19, -37, -1, 19, 39, -1, 18, 0, 13, 17, 7, 6, -16, 8,
+    3, -21, 18, 5, 0, -37, 20, 12, -23, -10, 11, 30, 5, 15, -1, 33,
+    -10, -12, 5, -25, -1, -26, -18, -12, -8, 5, 4, -20, 0, -27, -5, -4,
+    -7, -48, -2, -40, -41, 14, 42, -5, 15, 34, 14, -6, 26, 24, -38, -30,
+    -5, 0, -5, 26, 2, -11, -84, -36, -3, -19, -4, 23, -15, -55, 9, 2,
+    -35, -21, 15, 10, 22, 8, 13, 32, -15, 21, 19, 2, -17, -39, -16, 0,
+    -38, -16, -2, -17, 0, -29, 1, -6, -5, 42, 20, 64, 29, -6, 1, 13,
+    -2, 19, -4, 0, -23, -26, 60, -7, 24, 15, 13, -5, -64, -31, -15, -25,
+    -9, -14, 1, -32, -46, -7, 3, 20, -11, -7, 3, -12, 8, 9, -7, -6,
+    -15, 8, 1, -9, -5, -8, -31, 1, 46, 26, 61, 51, 13, 46, 0, 18,
+    19, 19, -5, -4, 14, -5, 14, 14, 18, -20, -16, -21, -18, 16, 3, 8,
+    -25, -26, 6, -11, -6, -6, 7, 3, -20, -2, 14, -2, 2, 8, -12, 1,
+    -9, -18, -37, -42, 0, 70, -30, -7, 1, 9, 14, 31, -18, 12, -4, -7,
+    -38, 14, -42, 7, 13, -2, -1, -12, 8, 22, 27, 31, -7, -23, -24, -39,
+    -63, -51, -36, -35, 2, -28, -60, -40, 9, 2, -8, 10, -17, 19, 3, 7,
+    0, -5, -4, 13, 3, 4, -8, 17, -18, 30, 21, 0, 11, -1, -3, 7,
+    -27, -46, -51, -42, -24, -20, -28, -37, -24, -1, 38, 33, 7, 14, -33, -60,
+    -24, 13, 4, -5, 15, -44, -60, -13, -5, 5, 14, -24, 32, 1, -1, 14,
+    24, -18, -15, -43, 17, -4, -17, -7, -45, -5, 19, 30, 29, 30, 36, 6,
+    -14, -4, 13, 13, 21, 32, -6, -1, -8, 15, 7, 29, -3, -49, 18, 11,
+    23, 14, -3, -42, 22, 50, -5, 20, -2, -10, -8, -16, 16, -3, 10, -13,
+    -105, -22, -11, -13, -16, -17, -12, -25, 5, -15, -15, 21, 16, -32, -22, 8,
+    -29, -30, -2, 1, -25, -3, -7, -1, 21, -11, 8, -34, -1, 32, 2, -73,
+    -22, -3, -30, 6, 0, -17, 21, -6, 8, -7, -3, 13, 7, 17, -32, -2,
+    3, 11, 0, 12, -25, -7, -14, -14, 6, 10, -7, -5, -28, 68, 12, 10,
+    1, 14, -1, 12, 6, 14, 25, 3, 2, -33, 7, 32, 18, 18, -10, -25,
+    -7, -13, 32, -2, -22, -19, 9, -14, -5, 19, 17, -10, 11, 8, -10, -8,
+    -14, 7, -18, -16, 18, -6, -5, -4, -31, -38, -36, -52, -6, -6, -12, 16,
+    69, 31, 6, 11, -5, 23, 36, 22, 3, -12, 10, -4, 22, 49, 1, 13,
+    0, 9, -5, 36, 2, -4, -41, -15, -24, -1, -31, -32, -26, 15, 13, -10,
+    1, -17, -15, 14, 2, -8, -1, -1, -8, -13, -17, -25, 11, -29, 3, 36,
+    16, -3, 0, 14, 3, 7, -9, -3, -28, -22, -5, -6, -7, -19, 12, 2,
+    -5, -14, -26, -20, 6, 27, 11, -12, 24, 7, 49, -14, 19, 43, -24, -3,
+    -12, -18, -20, -3, 6, -10, -41, 1, 3, -4, -10, -13, -5, -1, -3, 18,
+    29, 15, 9, -22, 8, -10, 13, 26, -2, -8, -49, 24, 1, -2, -1, 17,
+    -24, -64, -5, 5, 1, 6, 20, -1, -3, 1, -20, 9, -1, 24, 15, -37,
+    7, -29, -5, -25, 14, 4, 2, -32, -5, 0, -8, -14, -58, 21, -25, 1,
+    -18, 1, -41, 1, -35, 11, -51, -5, 6, 9, 12, -28, 13, 39, -7, -11,
+    0, 11, 26, 3, -1, -9, -16, -2, 28, 19, 21, -3, 20, 6, -18, -6,
+    -3, 39, 33, -14, -26, -14, -2, 10, 11, 2, -11, 0, -2, 27, -2, 65,
+    -2, 2, -1, -59, -3, -60, -5, -67, 30, 22, 25, 22, -16, -3, -15, -24,
+    27, 44, 28, 4, -5, -14, -55, -13, -25, -2, -6, 8, -39, -1, -41, 37,
+    -19, -14, -20, -8, -4, -3, -13, 18, 3, -2, -67, 1, -24, 4, 12, 7,
+    36, -26, -22, -43, -17, -3, -42, -24, -7, 23, 13, 20, -12, -1, -7, -52,
+    34, 24, -2, -10, 1, 24, -5, 40, -51, -54, -10, 18, -10, -25, -55, -17,
+    -4, -41, -31, -1, 6, 69, -4, -12, -37, 14, 34, -10, -108, -44, -8, 21,
+    -1, 29, 9, 1, -9, 38, -99, -12, -29, -22, 3, -28, 14, 56, 23, 16,
+    -15, -11, 2, 15, -7, 10, 26, -4, -55, -6, 5, 16, 8, 5, 3, 0,
+    43, 81, 15, 4, -8, -1, 0, -20, 47, 31, -7, -19, -54, -1, -18, 28,
+    -1, -8, 18, 15, 1, -37, -1, -27, -17, 1, -79, -47, 0, 14, -25, -6,
+    2, -12, -9, -22, -13, -26, -3, 23, 20, -1, 2, 5, -25, -17, 0, 29,
+    9, 50, 19, -2, 1, 42, 43, -12, 14, 29, 1, 3, -124, 10, -19, 9,
+    5, 42, 35, -27, 6, -11, 2, -19, -7, 2, -19, -16, 24, -7, 23, -2,
+    -3, 6, 8, 14, 56, 54, 6, 37, 11, 7, -28, 31, 76, -12, -4, 18,
+    -11, -20, 25, 17, -6, -23, 47, -4, -19, -49, -5, -63, -35, -13, 16, -2,
+    -26, -31, -9, -46, 6, 27, -6, -4, -19, -4, -1, 6, 0, 12, 16, 19,
+    48, 24, -60, -67, 12, 15, 8, 19, 5, -45, -23, 12, -20, -8, -5, -1,
+    -6, -26, -15, -19, -3, -25, 9, 17, 1, -3, -52, -18, -8, -43, 2, -4,
+    17, -6, -18, -1, -20, -15, -26, -14, -3, -31, -5, -14, 7, -49, -17, 26,
+    30, -3, -3, -15, 17, 2, 64, 46, 14, -11, 6, -7, -12, -43, 49, -8,
+    13, -17, -10, -15, 25, 46, -13, 5, -26, -16, 1, -24, -23, 8, 5, -3,
+    -14, 3, -10, -1, 38, 28, 9, 30, -34, -44, -39, -43, -5, -11, -11, 4,
+    16, 17, 4, 0, -11, -35, 25, 11, 29, 23, 15, 24, 23, 19, -3, 74,
+    -10, 11, 31, 6, -22, 32, 35, 9, 14, 54, 17, 47, 11, -8, -9, -25,
+    0, 33, -64, -34, -39, 22, -28, -15, 31, -2, 0, -6, -3, -6, -3, 1,
+    1, -5, -3, 2, -3, -5, -5, -1, 1, 2, 0, -2, -4, 2, -3, -2,
+    4, 9, -7, -7, -5, -2, 0, 9, -7, 4, -10, -4, -4, -6, 5, -1,
+    -7, -3, 2, 2, -4, -2, 0, 4, 2, -2, -7, -1, -10, -8, -2, -5,
+    -5, -9, 12, 15, 5, 15, -10, -68, 11, 14, 46, 37, 10, -11, -10, 6,
+    1, -12, -39, 3, -19, -13, 0, -22, -5, -14, 10, 15, 14, 1, 7, -13,
+    -16, -2, -25, 12, 29, 20, -17, -29, -3, 6, -11, -33, -19, -70, -123, 36,
+    3, -2, 11, 18, 16, 16, -45, 29, -4, 28, -9, -20, 19, 25, 26, -89,
+    -19, -22, -4, -37, 9, -48, -5, -27, -30, 19, -33, -21, 9, -38, 17, -7,
+    -9, -26, 15, -38, 37, -72, 3, 6, 28, 25, -2, -46, 2, -38, -15, -8,
+    -26, -30, -76, -41, -6, -14, -48, 6, 26, 32, 5, -21, -4, 10, 21, 4,
+    -10, 35, -34, -17, -12, -2, -18, 45, 47, 19, -4, -3, -3, 34, 27, -57,
+    -3, 19, 9, -6, -8, 34, 11, 35, 17, 42, -35, 13, 14, -8, -11, -23,
+    -2, -9, 6, -11, -3, 1, -5, -11, 23, 13, -4, -9, -5, 33, 33, 53,
+    31, -11, 5, 0, 1, 13, 6, -5, -14, -6, 0, -17, -19, 58, 39, 14,
+    -5, 26, -16, 3, 20, 3, -5, -6, -12, -10, -53, 17, 0, -10, -1, -9,
+    -16, -34, -10, -32, -5, -10, -56, -64, 27, 49, 3, -28, -6, -16, -7, 22,
+    4, -6, -3, 26, -19, -1, 17, -13, 0, 15, -12, 2, 7, -1, 20, 21,
+    -28, 8, 13, -17, -2, -15, 48, -35, 49, 0, -1, 15, 14, 55, 1, -25,
+    -51, -64, -13, -17, -10, -4, 15, 24, 37, -10, -26, -41, -15, 22, -3, -30,
+    -9, 19, -28, -13, -34, -16, -47, -35, 9, -6, 23, -59, -32, -10, -23, 32,
+    3, -24, 40, -11, 10, -11, 2, -29, -15, -53, 4, -1, 11, 14, -4, -20,
+    -12, -7, -5, 10, -18, 2, -74, 8, 6, 1, -54, 7, 2, 44, 7, -49,
+    -11, 2, -11, 16, 1, 25, 6, 39, 17, -49, 8, -1, -25, 24, 51, 5,
+    7, 48, -29, 44, 29, 15, -4, -43, 4, -16, -105, 20, 4, 5, 7, -9,
+    5, 1, 1, -9, -32, -34, -81, -29, 5, -19, 6, -34, -6, -2, 13, -30,
+    6, -10, -21, 20, 9, -7, 29, 24, 22, -39, -8, 6, -17, 53, -9, 2,
+    -12, -17, -8, -27, -63, 0, 4, 3, 0, -42, -62, -18, 38, 29, -1, -13,
+    -36, 7, -5, -15, -16, 2, -1, -11, -50, -13, 12, 9, 4, -11, 11, 7,
+    28, -10, 2, 12, -10, 38, 16, 23, -41, 12, -17, -46, -10, -14, -20, 31,
+    22, 26, -25, 55, -29, 31, 33, 6, -33, -5, -55, 13, -11, 10, -6, -6,
+    90, -18, -27, -1, -4, -2, 4, 2, 2, -2, 41, 44, 43, 51, 0, -8,
+    -21, 6, 16, -3, 18, 24, -36, -11, 14, 1, -5, -30, 15, -11, 14, 5,
+    -27, -11, 11, -5, -7, 3, -8, -21, -33, -41, -39, 0, 24, -9, -29, -15,
+    -5, -19, -13, 25, 6, 3, -35, -44, -16, 39, 16, 23, -1, -20, 1, -8,
+    -4, 31, -5, -49, -1, 28, 4, -22, -17, 18, -4, 29, -28, -2, 15, 14,
+    -22, 5, 3, -3, -18, 29, -14, -22, -6, -12, -3, -21, -36, -8, 23, 2,
+    13, 5, 19, 10, 45, 1, 28, -24, -47, -13, 28, 0, 19, 18, 24, 3,
+    -4, -12, -8, 10, -19, -8, 2, 8, -1, -51, -13, -17, 7, -31, 6, -22,
+    -20, -22, 14, 5, -28, -23, -23, -11, -10, -31, -11, -21, 13, -34, 3, -2,
+    4, 7, 12, 39, 3, -31, -3, -4, -4, -2, 5, -3, -13, -3, -45, 51,
+    26, -14, 49, 23, 4, 4, 17, 60, -3, 22, 36, 14, 22, 7, 8, -5,
+    -24, 18, 26, -2, -9, -26, -1, 20, -4, -1, -17, -32, -32, -1, 1, -30,
+    25, 10, -23, -10, -3, -4, 10, -4, -11, -8, -72, -38, 15, -11, -7, -1,
+    4, -53, 17, -1, -44, -37, -29, 8, 25, 18, 24, -10, 24, 1, 8, -10,
+    -4, 22, -2, 49, -3, 12, -4, 24, 35, 11, -31, 17, -1, -24, -3, 9,
+    -22, 2, 6, 11, -10, 4, 2, -4, -2, -16, 18, -12, -12, -25, -7, -6,
+    -6, -18, 1, -60, 59, -11, -24, 7, 35, 8, -48, 13, -13, 16, 19, 54,
+    22, 37, -6, 10, 27, 27, 51, -63, 13, 14, -11, -10, -10, -10, -45, -4,
+    -15, 0, -8, -6, -15, 4, 5, -9, -2, -24, 6, -14, -2, 0, -16, -86,
+    15, 14, 25, -8, 7, -1, -9, -4, -5, 12, -3, -57, -10, -35, -3, -47,
+    3, -17, 23, -2, -21, -5, 14, 28, -32, 0, 13, 14, -6, -41, -127, 27,
+    4, 18, -19, 47, -21, 28, 51, 18, 17, 31, -10, 25, -39, -4, -53, 1,
+    -11, 0, -14, 3, -55, -94, -15, 41, 6, -13, -4, 22, 4, 54, 25, 2,
+    -9, -36, 21, 5, 24, 17, 20, -17, -24, 39, 9, 9, 9, 10, -32, 5,
+    31, -15, 22, -12, -22, -14, 12, 19, 49, -4, 19, -30, -44, -91, -12, -23,
+    -14, 4, 30, 35, 21, 2, -3, -53, -88, 19, 25, 8, -15, -5, -11, 19,
+    6, -3, -19, -47, 22, -8, -63, -44, -26, -10, -8, 21, 3, 29, 53, -1,
+    -10, -17, -17, -32, -47, -47, 5, 1, -11, 43, 25, 1, -1, -38, -17, -3,
+    -16, 3, -107, 1, -15, -15, -19, -9, -7, 1, -36, -22, -35, -24, 32, -13,
+    -5, 28, 34, 9, -12, -11, 10, 21, 53, 18, -18, 8, -19, 14, 1, -39,
+    25, 17, 7, -13, -54, 2, -24, 5, 34, 29, 18, 1, 0, -16, -13, -16,
+    -16, -27, -21, -5, -2, 19, 5, -55, -54, 33, 14, 4, -55, 10, 3, 26,
+    -7, 7, -35, 13, 46, 30, -2, 5, 7, 20, 93, 74, 30, 7, 18, -21,
+    -2, -12, 53, 35, -4, -16, -30, 3, -34, 35, -4, 2, -22, 11, -27, 12,
+    -22, -45, -58, -44, 2, 21, 31, 15, 26, 12, 2, -19, 18, 3, 18, 23,
+    18, 24, -7, 1, -34, -2, -30, 8, -18, -24, 24, -7, -30, -10, 23, 63,
+    -2, 20, 5, -26, -3, 21, -13, -8, 27, 74, -18, 15, -16, 28, 3, -23,
+    18, -21, 19, -80, -20, -4, 1, -6, 11, -1, -27, -2, 33, -21, -13, 28,
+    11, 6, -14, 3, -9, -29, -21, -15, 16, -27, -17, -63, -4, -23, -31, -8,
+    -1, 12, -3, 3, -14, -10, 10, -16, -28, 1, -45, 14, 1, 35, 24, -4,
+    -13, 0, 7, 10, -1, 23, 33, -32, -16, -12, -20, -1, 7, -32, 8, 2,
+    -16, -20, -17, 9, 4, 18, 16, 2, 18, -28, -46, -28, -15, 20, 20, 4,
+    -30, -2, -25, -22, 6, 20, 6, -34, -17, -17, -6, -37, 19, -43, 0, -46,
+    -7, -4, 22, -6, -5, -6, -27, 6, 3, 7, -1, -41, 0, 6, 1, -6,
+    35, -10, -4, -1, 8, 21, -5, -13, 18, 5, 10, -1, 30, -2, -18, -19,
+    14, 1, -9, 26, -8, 6, 2, 10, -5, -3, 3, -1, -11, -34, -56, 16,
+    -8, -5, -4, 33, -16, 8, -8, -23, -5, -24, -30, -34, -5, -1, 2, -1,
+    15, 17, 5, 34, -8, 26, -2, 14, 37, 35, 24, -6, 4, -16, -20, 13,
+    5, 5, 7, 15, 18, -22, 10, 2, 19, -1, -14, 8, -9, 49, -16, 20,
+    -27, 1, 62, -4, -14, -33, 18, 32, -17, -23, -5, -26, 20, -33, -31, -5,
+    8, 1, 8, 2, -22, -18, 5, 22, -1, -19, -18, -11, -4, 2, 23, 2,
+    -15, -19, -26, -13, -14, -14, 0, -36, -10, -7, 12, 20, 12, -4, 5, 8,
+    -5, 23, -3, -8, 1, 6, 14, 11, -2, -6, 7, -22, 6, 15, 9, -5,
+    -7, 11, 15, 28, 8, -22, -17, -5, -5, -1, -45, -1, -5, 18, 31, -47,
+    5, 27, 55, 20, 19, -78, -93, -4, 22, -1, 12, 12, -61, -13, 0, -20,
+    -6, -38, -19, -69, -19, -1, -6, 27, 15, 16, 9, -1, -25, -7, 1, -4,
+    4, 8, -2, 14, -14, 16, 7, -26, 11, 1, -11, -10, -32, -41, -30, 6,
+    0, 15, -21, -84, -45, -16, -5, -20, -34, -24, -11, -23, -28, 13, 25, 15,
+    23, 4, -7, -6, -3, -4, -6, -24, -85, -8, -50, -9, -7, -10, 5, -12,
+    -6, 0, 17, 26, -18, 5, 17, 1, 7, 15, -8, 19, 19, 6, -2, 1,
+    24, 18, -10, -13, -16, 7, 2, 24, 3, -2, 11, 2, -13, -4, -12, 4,
+    -9, -13, -6, -7, 9, 17, 32, 4, 2, 18, 1, 0, -17, 12, -13, -14,
+    -4, -2, 15, 23, 11, 19, -63, -19, -20, -20, 7, -3, -16, 0, 6, 0,
+    -14, 3, -5, -1, -8, -64, -47, 25, 37, -2, -1, -16, 16, -29, 16, 30,
+    -3, -10, 9, 1, -74, -40, 3, 12, -2, 3, 19, 16, -14, 12, 28, 17,
+    13, -6, 3, 0, 19, -2, 5, 24, -25, -12, -40, 27, 31, 49, -43, -33,
+    -21, -11, -37, 8, -4, 0, -10, 11, -21, -56, -62, 22, 3, -25, -20, 9,
+    -33, -56, -15, 1, -54, -43, -41, -32, -4, 4, -2, 0, -4, 0, -2, 5,
+    0, 0, -1, -3, -1, 9, 2, -5, 7, -1, -3, 1, -8, 6, 4, 5,
+    -5, 1, -6, 11, -3, -4, -1, 2, 1, -9, 6, -14, -4, -7, -5, 0,
+    10, -1, 1, 4, 2, 2, 0, 1, 1, 4, -6, -37, -9, -41, -11, 35,
+    -3, -16, 20, 15, 2, -14, 32, 1, 4, 1, -20, -12, 1, 18, -13, 48,
+    -5, 0, -9, 20, 15, 24, -4, -14, -52, -9, 9, -19, 3, 7, 12, -2,
+    -4, 5, 15, -6, -4, -30, 0, 18, -12, 24, 12, 25, -38, 4, 41, 49,
+    1, -3, -31, -4, -15, -11, 20, 45, 28, -8, 22, 25, 17, -14, -14, -29,
+    48, 20, 29, 28, 10, 24, -13, -10, 15, -11, 16, 15, 16, 6, 8, -3,
+    -10, -13, -35, -38, -9, -44, -2, 7, -2, 1, 13, -10, -1, 3, -8, -3,
+    1, -17, 2, -2, 16, 2, 12, -3, -9, 20, 16, 22, 3, -45, 25, 20,
+    -45, -1, 3, 10, 20, 13, -2, 21, -16, 51, 29, -8, 7, -16, -34, -6,
+    -9, -32, -14, -10, 7, -29, -50, -76, -11, -8, -26, -28, -3, -3, 1, 5,
+    9, 4, 7, 9, -3, 8, 16, -11, 9, -13, -20, 7, -2, -12, -37, -84,
+    -51, -6, -3, 14, -28, -21, -26, -29, -9, -2, -12, -16, 5, -32, -18, 1,
+    -9, -25, -26, -52, -76, 17, -8, 0, 9, -3, -18, -30, -7, 0, -4, -1,
+    10, -15, 1, -28, -17, -8, 25, -41, -48, -18, -39, -1, 8, 18, 9, 14,
+    14, -6, 33, 0, 4, 52, 23, 22, 15, 15, -24, 14, 63, 37, -19, -31,
+    -4, 16, -50, 3, -8, -15, -30, 2, -30, 1, -44, -7, -20, 12, -14, -9,
+    -2, -10, 32, -43, 11, 1, -25, -19, 4, -12, 17, 32, 4, 3, 9, 22,
+    4, -30, -7, 9, 9, 3, 15, 14, 15, 10, -17, -2, -14, -29, -6, -17,
+    -35, 7, -17, 9, 5, 8, -6, -6, 6, -6, 4, 10, 7, 11, -12, 14,
+    -20, 20, 15, -7, -1, -5, 16, 0, 7, 17, 6, 1, 8, 30, 32, 2,
+    -24, -40, -5, 7, -20, 39, 3, -23, -36, 37, 23, 12, -5, -15, 18, -8,
+    -19, 5, -12, 21, -27, -63, -39, 32, -20, -10, -32, 24, -2, 15, 4, 10,
+    -20, 0, -3, 8, 1, 76, -26, -48, -3, 40, 11, -10, -6, -21, -9, -11,
+    16, 18, -9, 25, 15, 3, -13, -39, 44, 12, 27, -11, 9, -48, 38, 4,
+    -39, 18, 16, 21, -22, -26, -38, -15, 8, 28, -2, 19, -23, -20, 26, 32,
+    -35, -10, -2, 25, 8, -2, 5, 7, 3, -5, 5, 2, 0, -5, 13, 5,
+    0, -32, -6, 13, -8, -29, -32, 0, 23, 9, 3, 35, 24, 12, -20, 42,
+    -21, -18, -14, -28, -23, 23, 28, -46, -17, -13, -55, -18, -7, 2, -33, 14,
+    -12, -11, -5, -6, 0, -7, -4, -10, -6, 1, -85, -23, -10, -19, -35, 23,
+    25, 19, 3, -23, -25, -3, -12, 3, 9, -4, 8, -37, 12, -18, 8, 0,
+    -4, -37, -30, 8, -2, -38, 2, 1, 12, 1, 9, -27, -19, -9, 0, 10,
+    9, 10, 23, 25, -11, -6, -41, -5, 6, 17, 23, -11, -1, -32, -5, -3,
+    4, 0, -1, 25, -5, 12, -32, 35, -13, -8, 15, -9, -13, 1, 15, -39,
+    -20, -14, 14, -8, -16, -36, -8, -32, 18, 38, 5, 16, 10, -23, -7, 27,
+    -6, 14, 40, -42, 14, -18, -32, -31, 40, 26, -19, 0, -32, 8, -20, -6,
+    11, 31, 19, 6, 15, 6, 29, -10, -12, -26, -7, 10, 21, 14, -28, -8,
+    -10, 10, 15, 9, -16, -5, 9, -11, -22, 11, 0, 13, -19, -23, -12, -14,
+    5, 28, 6, -2, 15, -3, -2, 0, -3, -8, 1, -24, 3, -1, -33, -37,
+    -30, -8, 16, 12, 3, -10, -62, -15, 5, 14, -15, -2, -30, -27, -11, 16,
+    5, 0, -13, -3, -11, 17, -42, -16, 12, -25, 7, -15, -2, 6, 6, -5,
+    7, 12, 10, 15, 12, 10, 2, -1, 10, -52, -38, 0, -16, -11, -10, 11,
+    10, 29, 1, 6, -18, -6, -27, 21, -14, -6, -24, -16, -7, 3, 27, -15,
+    9, 9, 37, -33, 32, 33, -5, 5, -56, -12, -14, 2, -32, -28, -14, 24,
+    -4, 23, -12, -30, -1, -41, 27, -5, 8, 14, 2, 16, -11, 5, -3, 10,
+    6, -56, -20, 1, 13, 23, 31, -24, -36, -31, -11, -23, -10, 7, -52, -127,
+    -15, -7, 1, 6, 25, -34, -58, 3, -7, -33, 8, -13, -18, -28, 13, 5,
+    5, 4, -1, 10, 9, 3, 15, 6, 19, -1, -7, -3, -3, -7, -27, 8,
+    -16, -17, 4, 3, 6, 24, 11, -4, 46, 37, 14, -8, 10, 19, 56, 41,
+    25, 21, 17, 44, 3, -22, 13, -9, -8, 8, 15, -18, -10, -32, 20, 3,
+    -18, 1, -13, 3, -1, -2, -29, -14, -3, 6, -2, 5, 15, -10, 24, -4,
+    30, -16, 4, 4, -17, 29, 11, 15, -7, 12, -13, -35, 19, -10, -8, -6,
+    2, -7, -38, -18, -10, -15, -11, 1, 41, -37, -18, -1, 1, -10, 4, 35,
+    -22, -16, 18, -14, 0, -12, 1, -36, 17, 12, -25, 2, -47, 27, 25, -10,
+    36, -9, -31, 6, -12, -13, 7, -9, -44, 7, 21, -21, -8, 19, 35, 12,
+    31, 10, 21, -4, 44, 30, 24, -22, -14, -12, 17, 13, -32, 27, 22, 5,
+    1, 9, -18, 1, -29, -28, -15, -30, 10, 15, -21, -21, 0, -30, 9, 21,
+    24, -12, -35, 1, 2, 27, -8, 9, 4, -2, -3, -3, 9, -29, 7, 21,
+    -4, -1, -18, 10, 10, 3, -17, 31, -29, -2, 14, -17, -14, -21, -22, -34,
+    -15, 10, -7, 11, 26, -5, -5, -2, -2, -7, 37, -70, -6, -10, -4, -30,
+    0, 13, 0, 1, -5, -2, 29, -33, 1, -4, 3, -6, -22, -38, -20, 2,
+    2, -4, -6, -49, -9, 40, 18, 24, 4, 0, -11, 12, -10, -26, -8, -11,
+    -6, -45, -31, -20, 0, -1, 12, -6, 28, 6, 10, 2, 0, 9, -1, 15,
+    27, -6, -37, -21, 2, -29, -23, 5, 4, -15, 10, 0, 21, 8, -9, -9,
+    -15, 1, 45, -11, 4, -10, 25, 5, 12, 2, -1, 6, 7, 23, 5, -46,
+    3, -20, -2, -5, -21, -7, -3, -4, -10, -34, -24, 22, 3, 3, -5, -2,
+    27, -8, 16, -7, 3, 31, -23, -9, 5, -11, 8, -2, -18, 42, 3, -5,
+    6, -18, -2, 22, -25, 38, 21, 35, -9, -45, 20, -16, -1, -4, -3, -32,
+    -6, 25, -24, 21, -2, 14, -13, 22, -12, -7, 13, -21, 21, 44, 42, -30,
+    6, -36, 6, -11, 1, -36, 12, -42, 12, 1, -9, -17, -64, -18, 5, 24,
+    11, -27, -21, -54, -11, 10, 5, 0, -18, -28, -16, -16, -11, -26, -7, -4,
+    16, -8, -3, 2, -6, 17, 20, 22, 44, -5, 0, 6, 13, 14, 16, -25,
+    -4, -5, -44, -13, -14, -17, -31, -23, -7, -30, -97, -50, 16, 15, -9, -14,
+    -17, -13, 23, 10, 5, -19, -19, -4, 0, 9, -3, 20, -11, -12, 21, 27,
+    -16, 8, 9, -21, -7, -15, -19, 16, -3, 4, 6, -5, 17, 41, 46, 7,
+    52, -39, 0, -36, 36, -2, 20, -22, -5, -28, 42, 2, 3, -3, 12, 35,
+    -9, -21, 23, 38, 20, -1, -24, -60, -13, 22, -9, -23, -9, 15, -30, 11,
+    2, -38, -18, 6, -42, 27, 30, 17, -20, -16, 10, 51, 80, -15, -58, 6,
+    20, 51, -16, 4, -6, -39, -20, 9, 0, -63, 3, -20, -127, -85, -7, -6,
+    -14, 0, -13, -29, -17, 6, 0, -7, 0, 10, 35, 13, 19, 8, -14, 1,
+    28, 26, 30, 0, 20, -7, -4, 31, 39, 33, 6, 5, -3, -1, 17, 41,
+    9, 10, -1, -77, -3, -12, -29, 24, -34, 1, -18, -34, 10, 8, 25, 5,
+    2, -50, 2, 15, 17, 13, 9, -66, -32, 14, 13, -71, 12, 33, -24, 39,
+    3, -86, -32, 2, 15, -20, 87, -16, -3, 17, -2, -19, 58, 54, 32, 21,
+    6, -39, -45, -50, 1, -8, -9, -3, -7, -4, 6, -14, -46, 3, 9, 13,
+    11, 1, 3, -48, -51, -37, -3, -11, -29, 13, 51, -31, -15, 22, -14, -11,
+    -75, -5, -11, 11, 23, -74, -17, 18, 12, 26, 38, 41, -13, -34, 17, 16,
+    52, -35, 69, -22, -15, 18, -4, -4, -7, -4, -12, -1, 4, -59, -48, 22,
+    7, 12, 31, -21, -14, -2, 21, 8, -24, -3, -12, 2, 4, 3, 14, -28,
+    -6, -13, -25, 12, 27, 26, -5, -33, -80, -15, -14, 4, 7, -25, 0, 10,
+    5, -9, -11, -11, 5, -13, -5, 2, -15, 1, 10, 5, -2, -51, -21, -12,
+    -65, 6, 20, 16, 2, -24, -37, -47, -52, 2, 6, 21, 42, -11, -39, -28,
+    -19, -2, 4, 13, 2, 3, -27, -28, -25, 15, 23, 16, 11, -24, -4, -5,
+    14, 15, 17, 22, 41, 22, 28, -3, 9, -10, 13, -20, -24, -4, 6, -10,
+    30, -13, 10, 18, -19, 15, 25, -46, -23, 3, -5, -29, -43, -11, -39, 7,
+    -20, 10, -55, 6, -21, 10, -19, -12, 11, 26, 71, -15, 3, 35, 24, 16,
+    -5, -14, 45, -12, 35, -9, 36, 9, 17, 3, -5, 1, -1, -6, 0, 4,
+    3, -5, -9, -6, 4, -10, -8, -4, 1, -6, 1, 1, -7, -4, 3, -7,
+    -6, -3, 3, -6, -5, -1, -4, -3, -14, -9, -13, -5, -2, 0, -4, -3,
+    -3, -4, -3, 2, -3, -4, 0, 2, 3, -2, -1, 2, -14, -8, -5, 4,
+    8, -56, -13, 14, 16, 5, 5, -23, -19, -14, -29, -15, 4, 18, 34, 0,
+    -16, -6, 43, -19, 15, -15, -37, 16, 37, 19, -32, 9, -87, -8, 1, 10,
+    -31, -15, -25, 32, 24, 11, 9, -41, -5, 18, -4, -11, -33, 5, -93, -20,
+    -3, -1, -14, -41, -88, -31, 12, 5, -9, 5, 0, 12, -6, -9, -35, 24,
+    32, 9, 29, 8, -22, -18, -7, -12, 4, 24, -6, -9, -38, -9, 6, 7,
+    9, -5, 2, 20, -7, 47, 17, -27, 3, -3, 25, 31, -6, -16, 2, -3,
+    -44, 7, -67, -15, 26, 20, 16, 4, -38, -29, -5, 11, -4, 1, -26, -30,
+    49, 12, 31, -37, -5, -19, -15, -45, -52, -48, -19, 10, 6, -1, 38, -15,
+    8, 32, 18, 0, 1, 0, 26, 26, 4, -11, 20, -71, -15, 3, 2, -4,
+    -4, 10, -11, 2, -4, 2, -14, -17, -31, -11, 5, 6, -13, -35, -25, 0,
+    -35, 0, 0, 21, -2, -42, 54, 1, -1, 5, 21, -2, -27, 5, -10, 0,
+    5, 19, 21, 9, 38, -20, -8, 8, 4, 11, 5, 6, 0, 4, -5, -4,
+    -21, -14, -27, -19, -21, -7, -25, 37, 21, -34, 10, -27, -17, 10, 15, -25,
+    -4, 21, 0, -22, 49, -3, -14, 1, -1, -16, -47, -6, -39, 3, 4, -4,
+    -21, -65, 15, 7, 5, 20, -6, -30, 2, -18, 17, -2, 15, 11, -2, 2,
+    -15, 20, -21, -18, -14, -9, -47, -8, -35, -18, -14, -29, -15, 12, 9, 31,
+    51, 24, 33, -4, 12, 35, 23, -2, -20, -47, 0, -45, 12, 1, -52, -30,
+    12, -4, 26, -10, -6, -20, -13, 3, 6, 41, 15, 7, -12, -7, 29, 3,
+    -5, -38, 15, -2, -2, -18, -66, -4, 17, 22, 27, -26, -33, 17, 25, -11,
+    12, -6, 10, -30, 37, -46, -34, -50, -1, -24, 1, -2, -11, 0, 24, -5,
+    41, -34, 20, 26, 0, 6, 27, -10, -12, -8, 69, 23, 10, -24, -19, -15,
+    9, -1, -2, -23, -43, 11, -69, -9, -8, -27, 26, -7, -13, 4, -2, -10,
+    -2, 5, -15, 21, -18, -20, 5, 24, 8, 15, -14, 12, -89, -45, -2, -40,
+    17, -10, 42, -5, -26, -16, -1, 9, 13, -32, -67, 11, 9, 9, -10, 13,
+    57, 0, -3, -42, 12, -8, -19, -3, -14, -16, 7, 15, 20, 20, -3, -23,
+    6, 26, 23, -1, -28, -11, 13, -33, -22, -31, 8, 22, -4, -39, -33, -79,
+    7, -28, 25, -61, 44, 15, 34, 31, 20, -10, -24, 14, 31, 1, 37, -41,
+    -35, -14, 2, 4, 2, -1, -4, 6, 4, 5, -2, -100, -29, -21, 39, -70,
+    -13, -11, -27, 10, 7, -6, -18, -1, -12, 7, 34, 54, -22, -38, 20, 7,
+    23, 40, 18, -30, -84, -9, -44, 12, 7, -15, -22, -2, -12, 6, -16, -17,
+    -11, -6, 4, 35, 7, -6, 15, -25, -88, -16, 13, -7, -30, -4, -18, 6,
+    -9, -16, 20, 15, -5, 20, -13, 8, 19, 16, 10, 7, -20, -14, -53, 10,
+    -35, 9, -27, 21, -17, -47, -18, -25, -12, 9, 8, 3, 25, 62, 9, 30,
+    21, 14, 7, 41, -22, 5, -57, -57, -34, -75, -52, 4, -5, 5, -65, -27,
+    -34, -23, -7, -16, 14, 36, 10, -21, 19, 42, 45, 3, -2, 7, 39, -40,
+    8, -63, -15, 20, 4, 13, 14, -2, -15, 0, -12, 10, -1, 21, 31, 41,
+    3, -17, 16, 7, 18, 29, 5, -1, 6, 5, 7, 2, 9, 5, 0, 40,
+    -14, -24, -79, -32, 14, -30, -16, -51, -4, -43, -17, 19, -63, 0, 10, 46,
+    35, 4, -11, 17, 3, 36, 16, -19, -16, -17, 1, 10, 10, 11, -14, 8,
+    -16, -8, -10, 2, -1, -20, 5, 0, -1, -64, 3, -52, -32, -13, -3, 17,
+    32, 0, -18, -47, 9, -23, 29, 3, -5, -4, 10, -16, 27, 3, -21, -39,
+    41, -8, -6, -61, -6, -36, -2, 9, -6, -8, -63, -18, -3, -14, -10, -17,
+    -5, -14, -15, 35, 8, -45, -28, 11, -1, 5, 4, -22, -8, 13, 6, -11,
+    -19, 60, 59, 4, -27, 4, -4, -28, -53, -21, 22, 3, 17, 7, -29, -60,
+    -6, -15, 12, 23, 2, -2, -15, 40, 7, -18, -22, -16, 20, 9, 1, -17,
+    5, 7, -16, 5, 2, -11, -1, 3, -6, -7, -12, 15, -6, -1, 21, -58,
+    -64, -8, -10, 28, 7, 14, -6, -21, -12, -25, -6, 23, -1, -4, -6, 15,
+    12, -34, -44, -39, -14, 2, -23, 29, -28, -17, 3, -2, -47, 32, 3, 13,
+    9, 0, 34, -16, -22, 11, 16, 24, 26, -9, 16, -22, -30, -7, -89, -18,
+    13, -28, 15, -1, 1, -38, -28, -15, 14, 15, 34, -23, -39, -34, 27, 12,
+    -11, 5, -17, -32, 14, 12, 3, 9, -50, 1, -21, -8, -5, -25, 0, -25,
+    13, 0, 5, -17, 7, 5, 13, 47, -4, -8, 5, 3, -7, -88, -25, 28,
+    -22, -2, -32, -1, 10, 11, 34, 35, 38, -5, -15, 23, 35, -1, -31, -35,
+    -8, -5, 2, 14, -41, 33, -33, -12, 3, 32, -9, -81, -47, -19, -7, 4,
+    -4, -4, 13, -34, 6, 52, 8, -21, 2, 4, 28, -38, -2, -9, -102, 28,
+    -35, -50, 32, -18, -4, 10, 11, -9, 2, -42, 10, -10, -5, 11, -4, -52,
+    -53, -16, 14, -23, 13, 6, 42, -83, 12, -23, -22, 4, 2, 30, 11, 3,
+    13, -1, -4, -3, -14, 1, 25, -7, 17, 14, 2, 47, -36, 15, 9, 8,
+    -3, -22, 15, 9, 3, -4, -93, -27, -24, -34, -27, -2, -7, -3, -31, -4,
+    8, 17, -3, -8, -35, -14, 31, 3, 3, -3, -83, -81, -35, 2, 0, -4,
+    2, -11, 23, -8, 9, 22, 17, 1, 19, 1, -1, -1, -7, -39, 4, -14,
+    21, 37, 35, -35, -7, -66, 21, 2, 26, 12, -53, -7, -5, 11, 9, 5,
+    3, 4, -16, -6, 14, -4, 15, 8, -27, -8, -29, 35, -24, -46, -7, -20,
+    -3, 8, -1, -4, -22, -8, 39, 0, -1, -22, 34, 6, 36, -13, 4, -1,
+    -49, 24, -39, 13, -43, -3, -13, 21, -8, -10, -18, -31, -7, 10, -1, 5,
+    -2, -3, 4, 19, -11, 13, 7, 38, 8, 29, -7, -49, 5, -7, -30, 20,
+    4, 2, -18, -6, -7, -14, 14, 3, 26, 13, 22, 16, 30, -21, 25, -10,
+};
+
+static const float mnist_cnn_layer4_scales[10] = {
+    0.00613265391f, 0.00470232312f, 0.00527272699f, 0.00548717193f,
+    0.00634972751f, 0.00451456709f, 0.00629582535f, 0.00548814936f,
+    0.00572273228f, 0.00533631677f,
+};
+
+// One entry per layer; pooling layers have none
+static const SNNQuantWeights mnist_cnn_quantized[5] = {
+    { mnist_cnn_layer0_weights, mnist_cnn_layer0_scales },
+    { NULL, NULL },
+    { mnist_cnn_layer2_weights, mnist_cnn_layer2_scales },
+    { NULL, NULL },
+    { mnist_cnn_layer4_weights, mnist_cnn_layer4_scales },
+};
+
+#endif // MNIST_CNN_Q8_H
@@ -0,0 +1,2155 @@
+// Generated by snn_core/Tools/snn_sparse from the mnist_cnn weights.
+// Regenerate with the snn_sparse_headers target after retraining the model.
+#ifndef MNIST_CNN_SPARSE_H
+#define MNIST_CNN_SPARSE_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "snn_sparse.h"
+
+// layer 4: 50% of the 1x4 blocks pruned, 1960 kept, 35324 bytes (dense 62720)
+static const float mnist_cnn_layer4_values[7840] = {
+    -0.00966395438f, 0.115245223f, -0.195568323f, -0.186584994f,
+    -0.276091248f, -0.0312941931f, 0.0804268718f, 0.147038832f,
+    -0.191873923f, 0.0802070871f, 0.113650016f, -0.237978384f,
+    0.0153708579f, 0.0732799992f, -0.0337650143f, 0.260233879f,
+    0.0943693966f, 0.156346813f, 0.00324927364f, 0.117914513f,
+    -0.0896213278f, -0.778847039f, -0.520890534f, -0.403335184f,
+    -0.149532035f, -0.112280928f, -0.10719604f, -0.0970002264f,
+    -0.152010158f, -0.0476448536f, 0.154496998f, 0.0221614372f,
+    0.0432520695f, 0.245053723f, 0.178669289f, 0.0674792454f,
+    0.0553975552f, -0.131705657f, 0.0123663386f, 0.170441985f,
+    0.00560484407f, 0.221943334f, 0.170058191f, -0.244932204f,
+    0.0479531847f, -0.262213916f, -0.464068204f, -0.157571822f,
+    -0.318938732f, -0.0916595384f, -0.0689126477f, 0.0389222205f,
+    -0.00749955932f, 0.102936469f, 0.00561626395f, 0.271759629f,
+    0.141659528f, 0.106189445f, 0.15844959f, 0.0698782951f,
+    0.0652396008f, 0.140568569f, 0.206628159f, -0.062862955f,
+    0.00359503832f, -0.43093431f, -0.0653763339f, -0.070020996f,
+    0.131274298f, -0.0408328772f, -0.0698007271f, -0.219856068f,
+    0.000948550995f, -0.055627659f, 0.338389516f, -0.429943889f,
+    -0.396155953f, -0.453331441f, -0.263214141f, -0.0345750116f,
+    -0.0846428201f, -0.317358643f, -0.0266016144f, -0.242735565f,
+    0.111770153f, 0.145264253f, -0.00619653473f, -0.167075023f,
+    0.138240233f, 0.158572167f, 0.146889463f, -0.0402306691f,
+    -0.0761516541f, -0.325966179f, -0.00265226117f, -0.0755727142f,
+    -0.107939996f, -0.00210995926f, 0.0276770517f, -0.384212703f,
+    -0.353106886f, 0.0178295262f, -0.186176136f, 0.0138954055f,
+    0.102378815f, 0.121521458f, -0.242854655f, -0.418367088f,
+    -0.454043537f, 0.132423624f, 0.14573884f, 0.150131449f,
+    -0.152390033f, 0.0250203311f, 0.183471918f, -0.122933447f,
+    0.0860201493f, 0.0408962816f, -0.489348352f, -0.119342141f,
+    -0.275962621f, -0.242581904f, -0.0728605539f, 0.119732715f,
+    0.14493832f, 0.181660548f, 0.213269725f, -0.497549653f,
+    -0.615152776f, -0.535048366f, -0.246173665f, -0.0322824456f,
+    -0.0288621392f, -0.0492835417f, 0.152792066f, -0.255406141f,
+    -0.370210439f, -0.178785458f, -0.468226075f, -0.273440033f,
+    -0.157354251f, -0.0817898586f, -0.346724451f, -0.172966331f,
+    -0.0344444662f, 0.283680856f, -0.329955697f, -0.290236294f,
+    0.0662010014f, -0.261450112f, -0.127974987f, -0.0800773129f,
+    0.073756054f, 0.123887025f, 0.114723325f, 0.264430225f,
+    -0.370216489f, -0.0502332151f, 0.00656054402f, -0.165030614f,
+    0.209394798f, -0.136642322f, -0.0311676376f, 0.0114081502f,
+    -0.0878573656f, -0.30273965f, -0.106227607f, 0.0985438079f,
+    0.176568642f, 0.0718065351f, -0.169374034f, 0.0185706671f,
+    0.1199992f, 0.181019947f, 0.0759955272f, 0.0886239558f,
+    -0.134118229f, -0.305771351f, -0.0669552758f, 0.163058847f,
+    -0.103113033f, -0.0365532264f, 0.019497674f, -0.221913069f,
+    0.266530246f, 0.196154088f, -0.30258134f, -0.22100316f,
+    -0.122099429f, 0.162177831f, -0.237332329f, -0.0294454806f,
+    -0.288896233f, -0.689488888f, -0.172104612f, -0.187176928f,
+    -0.0551668555f, -0.127740622f, -0.108515702f, 0.0809686854f,
+    -0.118555143f, 0.0458358712f, -0.257820487f, -0.188039005f,
+    -0.744160652f, -0.310024977f, -0.164863661f, -0.135094017f,
+    0.227769405f, -0.114482269f, -0.023754118f, -0.0156150237f,
+    0.227811322f, 0.0838784873f, -0.623005629f, -0.355752587f,
+    -0.0465156846f, -0.0766170844f, -0.0334263667f, 0.217311636f,
+    0.188004017f, 0.028431464f, 0.113055348f, -0.209421217f,
+    -0.249837548f, 0.127030164f, 0.0356160216f, 0.052677922f,
+    0.0547256023f, 0.00730322767f, -0.0609515272f, 0.246905372f,
+    -0.154644564f, 0.0393926352f, -0.105399229f, -0.102198698f,
+    -0.173451841f, -0.18576102f, 0.232580885f, 0.0420404226f,
+    -0.0396103263f, -0.155890673f, -0.28403008f, -0.0839113891f,
+    -0.0832264945f, -0.146677867f, -0.198148429f, -0.17827177f,
+    0.0589690097f, -0.0156709608f, 0.214485511f, 0.206858858f,
+    -0.162707746f, 0.0465218797f, -0.0378819518f, -0.166337624f,
+    0.0734794363f, 0.186652511f, 0.198705912f, 0.0324748121f,
+    0.0236151814f, 0.183604404f, 0.0792234316f, 0.133091748f,
+    0.0317120999f, -0.105153255f, -0.19218716f, -0.0735145062f,
+    -0.0446200259f, -0.371902525f, 0.0751821548f, -0.0330572687f,
+    0.147804439f, 0.047029011f, -0.24762173f, -0.119169541f,
+    -0.0540482849f, -0.0203355886f, -0.221303359f, -0.229887709f,
+    -0.158583418f, -0.33008495f, -0.0379777066f, 0.033652816f,
+    0.120118178f, 0.128084287f, -0.13108708f, 0.0240231082f,
+    -0.473043144f, 0.0306409001f, 0.115728982f, 0.125522956f,
+    -0.0706013665f, -0.0374173447f, 0.15381591f, -0.413779199f,
+    0.259671092f, 0.0713456422f, -0.0265869536f, 0.154929861f,
+    -0.0367416665f, 0.109273173f, -0.0953790694f, -0.240684107f,
+    -0.0717183873f, -0.373105228f, -0.166025028f, -0.144563928f,
+    0.053793557f, 0.103803791f, 0.159765542f, -0.248441368f,
+    -0.215799227f, -0.39933449f, -0.140103653f, -0.0578966513f,
+    0.127063632f, 0.0158586968f, 0.163107231f, 0.165509447f,
+    0.105075836f, -0.424597204f, -0.300759256f, -0.1594183f,
+    -0.0343975648f, 0.0311930459f, -0.242578566f, -0.185636878f,
+    -0.108668178f, 0.099797681f, 0.141289309f, 0.11095313f,
+    0.0523249358f, -0.0861681402f, -0.311945707f, 0.0206747372f,
+    0.25978443f, 0.115295283f, 0.0759251788f, 0.0689232051f,
+    0.0463749357f, 0.0570773333f, 0.149948761f, 0.159748644f,
+    -0.0675465539f, -0.184374228f, -0.117728032f, -0.187924981f,
+    0.160610184f, -0.121775545f, 0.0808419809f, 0.0244280975f,
+    -0.187424302f, 0.0528519861f, -0.0223458279f, 0.159602389f,
+    -0.0722123235f, 0.0346081667f, 0.137080595f, -0.15981248f,
+    -0.140299603f, -0.181751937f, 0.027873775f, -0.0235634483f,
+    -0.203063145f, -0.135703996f, 0.136082247f, 0.219202787f,
+    -0.31192264f, 0.0188426282f, -0.0279659666f, 0.111934081f,
+    -0.0497585572f, 0.0226798691f, -0.133405417f, -0.390522957f,
+    -0.0231328439f, -0.103898369f, -0.164658383f, 0.079250589f,
+    -0.0420740619f, 0.19020991f, 0.132244334f, 0.0240516812f,
+    -0.0159037076f, 0.219329908f, -0.0594561733f, 0.0982641205f,
+    -0.0875172541f, -0.191708446f, -0.183299512f, 0.125288814f,
+    -0.0291489158f, 0.0554166436f, -0.334888846f, -0.390227467f,
+    -0.200191349f, -0.0110002253f, 0.0719222948f, -0.224874824f,
+    -0.028609585f, 0.128659874f, -0.0834551379f, -0.329312265f,
+    -0.210045859f, -0.242845982f, 0.287468046f, 0.140985355f,
+    -0.00222738227f, -0.157215625f, -0.11462386f, 0.108651631f,
+    0.0287863817f, 0.234943002f, -0.173608139f, 0.0555551015f,
+    0.132385731f, 0.149396434f, 0.0890566409f, 0.00369914831f,
+    -0.100452185f, -0.215671778f, -0.0823976099f, -0.0198125206f,
+    0.126330227f, 0.167281926f, 0.066323474f, 0.151624188f,
+    -0.18132557f, -0.302748471f, -0.069907859f, 0.0841896757f,
+    -0.0669309199f, 0.180735126f, -0.235717893f, -0.0580025911f,
+    -0.365453064f, -0.383728236f, -0.501721799f, -0.241722032f,
+    0.0324133933f, -0.0984880626f, 0.276018918f, 0.174520895f,
+    -0.0480649248f, -0.154881299f, -0.188734427f, 0.264924794f,
+    -0.137398556f, 0.148215204f, 0.139630243f, -0.00246542133f,
+    -0.420581281f, -0.169368863f, -0.216986269f, -0.125652045f,
+    -0.282160491f, 0.0686451346f, -0.168495089f, -0.0857040286f,
+    0.0401763692f, -0.253816843f, -0.22847791f, -0.118606217f,
+    -0.122759327f, -0.299255222f, 0.0671886206f, 0.0413175561f,
+    0.116265342f, 0.0941333696f, -0.0666585267f, -0.204642698f,
+    0.117368072f, -0.0980427712f, -0.168557882f, 0.0819239467f,
+    -0.188514546f, -0.228520915f, 0.0747762844f, 0.0217449255f,
+    -0.173276648f, -0.178493708f, 0.0403942168f, 0.0291780271f,
+    0.258452088f, 0.0596849211f, 0.0189283527f, 0.142546326f,
+    0.0272123814f, 0.166052118f, 0.106403835f, 0.0687952712f,
+    0.200715512f, -0.0448287763f, -0.137997448f, 0.13857168f,
+    -0.213472813f, -0.269660711f, 0.0988479778f, 0.0751483589f,
+    -0.248807698f, -0.453033447f, -0.460876882f, -0.0327725895f,
+    -0.271305323f, -0.192866579f, -0.193400756f, -0.185344085f,
+    1.4969577e-05f, -0.111762993f, -0.126924336f, -0.12972334f,
+    0.0603871271f, -0.211971492f, 0.0616424084f, 0.134197846f,
+    0.0214581341f, 0.30576539f, -0.0629605949f, 0.123862587f,
+    -0.095349513f, 0.289644748f, 0.0682689473f, -0.0236295518f,
+    0.0570285432f, -0.0754428431f, 0.0773537531f, -0.194523886f,
+    0.126196802f, 0.0302132666f, 0.172593325f, 0.129362106f,
+    -0.244305879f, -0.243177727f, 0.0960796252f, -0.0543545187f,
+    0.0201083049f, 0.195572168f, -0.250499874f, -0.268102944f,
+    -0.231557965f, -0.296945184f, 0.0466405898f, 0.018270269f,
+    0.0619315952f, 0.0273659863f, -0.136692747f, -0.21829313f,
+    0.0746727884f, 0.0328809395f, -0.179518804f, -0.30302465f,
+    0.0049833497f, -0.309043348f, -0.271122664f, -0.12045572f,
+    -0.0293829031f, -0.27252543f, -0.0774948969f, -0.0421641432f,
+    -0.134997785f, -0.254141122f, 0.0086503718f, -0.0467300005f,
+    -0.137625366f, -0.0381858237f, -0.067441754f, -0.300929785f,
+    0.0286053922f, -0.077100642f, 0.153417289f, 0.121244155f,
+    -0.0948760882f, 0.0319424793f, -0.188271984f, -0.250895172f,
+    -0.262284726f, 0.203685671f, -0.108967625f, 0.160876527f,
+    0.0928671286f, -0.0470825881f, -0.185259014f, 0.0666484609f,
+    -0.0503517501f, -0.248436004f, -0.111649849f, -0.205620736f,
+    -0.123141006f, -0.215055093f, 0.100162722f, -0.0295570064f,
+    0.0593656711f, -0.0769046172f, -0.226771325f, -0.465234071f,
+    0.0114992913f, -0.187152803f, -0.0776769668f, -0.273495972f,
+    -0.099608548f, -0.366506964f, -0.367772311f, 0.144869119f,
+    0.0908742696f, 0.0620924123f, 0.249534979f, -0.0232752301f,
+    0.0304242615f, 0.121176273f, -0.312859297f, -0.281490445f,
+    -0.0158428997f, 0.248092785f, -0.095843628f, 0.0848222151f,
+    0.0730918273f, 0.242864415f, -0.225066051f, -0.147042081f,
+    0.164581761f, -0.171396688f, 0.185340941f, 0.0740058124f,
+    -0.134875342f, -0.0925375149f, -0.188180462f, 0.024182735f,
+    0.0257946104f, -0.0581506044f, -0.039583683f, -0.561425328f,
+    -0.193929464f, -0.000111216155f, 0.0368137024f, 0.160095364f,
+    -0.0699071586f, -0.0889670178f, -0.0898963585f, 0.321002722f,
+    -0.0312021486f, -0.246178359f, -0.104001604f, -0.172372103f,
+    -0.112953104f, 0.167690486f, 0.137042448f, 0.0441718176f,
+    0.0860199854f, 0.109845117f, -0.133259326f, 0.231569111f,
+    -0.173797026f, 0.0540401489f, 0.0964779258f, -0.0586440042f,
+    -0.775991142f, 0.109659709f, -0.0340516791f, 0.0855902061f,
+    0.0848484263f, 0.0463864729f, -0.0215211138f, -0.408952802f,
+    -0.503189504f, -0.137729958f, -0.145738736f, -0.0242281519f,
+    -0.249335304f, 0.0222340375f, -0.168702245f, -0.0327026546f,
+    0.178418279f, -0.151237056f, -0.0263793841f, -0.0198538881f,
+    -0.115386069f, -0.14153783f, -0.0255081356f, 0.253255934f,
+    0.10196729f, -0.105245903f, -0.347424626f, -0.266437799f,
+    0.0933887735f, -0.0993266627f, -0.11549072f, -0.0994090289f,
+    0.063921921f, -0.136900753f, -0.164288521f, 0.121272288f,
+    -0.0218380131f, -0.0954130068f, 0.0964146182f, 0.158131316f,
+    0.0191847291f, 0.180051774f, 0.143154755f, -0.0459687747f,
+    -0.269574195f, -0.252004653f, -0.0475362092f, 0.0586362071f,
+    -0.174394295f, -0.229531646f, 0.0404919572f, 0.0915673822f,
+    -0.231690586f, -0.733874202f, -0.540411472f, -0.448986202f,
+    -0.162884474f, -0.0476580895f, -0.225968689f, -0.136559308f,
+    -0.106183857f, -0.0544427335f, -0.0114759216f, -0.210704356f,
+    -0.20182088f, 0.0842530727f, -0.0294635706f, 0.107964955f,
+    0.0920538157f, -0.145717055f, -0.157612249f, 0.104445525f,
+    -0.280198365f, 0.195593163f, 0.123605236f, 0.047693368f,
+    0.00146078807f, -0.262933612f, -0.101429947f, 0.0436989628f,
+    -0.0468965024f, -0.158214733f, 0.0775060877f, 0.30025655f,
+    -0.0226366147f, -0.214587256f, 0.0711077377f, 0.101483434f,
+    -0.208955437f, -0.112387747f, 0.0694236755f, 0.0345887914f,
+    0.0304686502f, 0.0513561852f, -0.157847136f, -0.245015547f,
+    0.00382695626f, -0.296750486f, 0.00719262427f, 0.131297916f,
+    0.208277538f, 0.235045359f, 0.0569525138f, -0.0261686817f,
+    -0.177177846f, -0.0769274235f, -0.0746065751f, 0.0655722991f,
+    -0.11456158f, 0.140266508f, 0.0470711924f, -0.101146877f,
+    0.0246425681f, 0.135274738f, 0.150921404f, -0.141327575f,
+    0.100165911f, 0.217127487f, -0.1631556f, -0.289882571f,
+    -0.25590387f, -0.00831184722f, 0.024446208f, -0.254626304f,
+    -0.237325892f, -0.353613079f, -0.215702131f, -0.0263805389f,
+    -0.063258037f, -0.130345106f, 0.0439073369f, 0.159123927f,
+    -0.197059467f, -0.138166651f, 0.145020396f, 0.0954843163f,
+    -0.0459390841f, -0.157122537f, 0.11725843f, -0.234720334f,
+    -0.188121453f, 0.11887385f, 0.191539094f, 0.179435298f,
+    0.0321279913f, 0.109433413f, -0.311138481f, -0.0247958954f,
+    -0.0999305844f, -0.143376842f, -0.00324890367f, 0.153162956f,
+    -0.102487296f, -0.0576061681f, 0.117664084f, 0.209755763f,
+    0.260657042f, 0.219602481f, 0.0329529643f, -0.0510799699f,
+    0.074264586f, 0.087780863f, 0.25488776f, -0.0249867216f,
+    0.110624291f, -0.00725006405f, 0.199670121f, -0.139433384f,
+    -0.0597729124f, 0.239003405f, 0.148529515f, 0.170747101f,
+    -0.248177126f, -0.0140023297f, 0.0505115092f, -0.140475675f,
+    -0.183702022f, 0.0235515498f, -0.167771503f, -0.132749036f,
+    0.0238893647f, -0.131066069f, 0.214790612f, 0.168477029f,
+    0.0703606308f, 0.371115237f, -0.0762957335f, -0.170705661f,
+    0.139555261f, -0.0598513111f, -0.00527032744f, -0.290422201f,
+    0.114811681f, 0.0557748415f, -0.0465693809f, -0.190606222f,
+    0.190471202f, -0.426675647f, -0.249387324f, -0.067252025f,
+    -0.0299455449f, 0.0299439747f, 0.37687251f, 0.12397404f,
+    -0.0308593232f, 0.300843209f, 0.220919937f, -0.0466695651f,
+    0.260239989f, 0.271465391f, 0.111577325f, 0.0195602048f,
+    0.0841182396f, 0.0101401955f, 0.19915399f, -0.553663969f,
+    0.118445314f, 0.132968605f, -0.00696703885f, 0.143568218f,
+    0.0663492605f, -0.12838389f, -0.260288447f, 0.0217342321f,
+    -0.160702065f, 0.191731855f, 0.105411842f, 0.0172317382f,
+    0.166735873f, 0.0719698146f, -0.108379938f, -0.0755986944f,
+    0.0594993494f, 0.0207967218f, 0.199279711f, 0.309384495f,
+    -0.093233794f, -0.125274926f, 0.063052766f, -0.166253954f,
+    0.114773802f, 0.0167510919f, -0.168594718f, -0.110010497f,
+    -0.0267419703f, 0.0896990076f, 0.119836636f, 0.216209278f,
+    -0.397723973f, -0.127147824f, 0.0381761342f, 0.0739931315f,
+    -0.000675895135f, -7.15684509e-05f, -0.25292635f, -0.167761862f,
+    -0.0833359286f, 0.1470301f, 0.104304135f, 0.0728615746f,
+    -0.184570208f, 0.0524459332f, -0.0665453002f, -0.135612428f,
+    -0.122625701f, 0.260160536f, -0.0696553513f, 0.286657065f,
+    0.0865464807f, 0.130959064f, 0.472741008f, 0.0715481564f,
+    -0.251595736f, -0.102903403f, -0.175552696f, 0.0780101642f,
+    -0.192667902f, -0.1200362f, -0.0483090207f, -0.070645459f,
+    0.0426549874f, 0.121226728f, 0.0576871708f, 0.299190223f,
+    0.383592993f, 0.0316728652f, 0.0900707915f, 0.0348830819f,
+    0.126430377f, 0.358966082f, 0.190157875f, -0.154543757f,
+    0.178624943f, 0.0408508219f, 0.122413881f, -0.0949011743f,
+    0.063426204f, -0.0366488099f, -0.202989221f, -0.147406772f,
+    0.222370118f, -0.39339155f, -0.12281888f, 0.00779646076f,
+    -0.189538419f, -0.295458406f, -0.333234996f, -0.22630778f,
+    -0.312690824f, -0.113994889f, -0.0580996126f, -0.207666695f,
+    -0.159122974f, -0.080778949f, -0.15218997f, -0.333937109f,
+    -0.248368561f, 0.145665213f, 0.0364391059f, -0.0713269711f,
+    -0.147427365f, -0.13448967f, -0.122455917f, 0.0435013883f,
+    -0.0165189002f, -0.0875337571f, -0.107387878f, 0.238267049f,
+    -0.0559078269f, -0.0921000764f, -0.25299567f, 0.0437810458f,
+    0.165838808f, 0.0464981906f, -0.198909327f, 0.0577700362f,
+    -0.104109369f, -0.0307346433f, -0.194160923f, 0.22263214f,
+    -0.154153973f, 0.0303024575f, -0.144041523f, 0.10921026f,
+    0.0942580178f, 0.062933363f, 0.176675782f, -0.292834371f,
+    -0.00846377015f, -0.260350734f, -0.0985640287f, 0.148752108f,
+    -0.0211004689f, 0.19304508f, 0.240364775f, 0.00767040066f,
+    0.0519966185f, 0.0856802315f, 0.0408883356f, 0.233149499f,
+    -0.278461784f, -0.0427173525f, -0.217147097f, 0.0387641825f,
+    -0.0775262192f, -0.2653189f, 0.00109209644f, -0.104579121f,
+    0.204771131f, -0.0766680986f, -0.135871306f, -0.112234727f,
+    -0.312086821f, -0.050465364f, -0.0102593563f, -0.220382333f,
+    -0.172187537f, -0.14523688f, -0.111505903f, -0.00785597879f,
+    0.0843254104f, -0.0417967401f, -0.182350516f, -0.396887898f,
+    -0.148019552f, 0.189330488f, 0.154728711f, 0.106096506f,
+    -0.0445494391f, -0.223792821f, -0.116440646f, 0.0459259264f,
+    -0.289443105f, -0.0269478802f, 0.17723693f, -0.124164939f,
+    -0.341686755f, -0.114226021f, -0.00569319678f, 0.0506456532f,
+    -0.106385924f, 0.150909975f, -0.244265363f, 0.151164129f,
+    0.202034563f, 0.0666473731f, -0.328132361f, -0.218666747f,
+    -0.049560409f, -0.135324076f, -0.235962331f, -0.124067202f,
+    -0.290144324f, 0.0819953606f, 0.0702205673f, -0.197468191f,
+    -0.0961399227f, 0.175910324f, 0.0174273551f, -0.281245649f,
+    0.0798331425f, -0.0862478092f, 0.165289775f, -0.159896955f,
+    0.127638176f, 0.187391296f, -0.215774506f, -0.0869529918f,
+    0.158589914f, 0.0919187889f, 0.1263538f, -0.0725203082f,
+    -0.335936397f, -0.253352761f, -0.0273087062f, -0.0370656475f,
+    -0.155907199f, 0.164750844f, -0.0603806414f, -0.0920179039f,
+    0.190083921f, 0.115228817f, -0.30107832f, 0.0967452005f,
+    -0.119369522f, 0.174347565f, -0.115980513f, -0.0922900289f,
+    -0.0967761353f, 0.00935566612f, -0.131597698f, -0.267158508f,
+    -0.388620198f, 0.193287715f, 0.250817627f, -0.0807705596f,
+    -0.0902775228f, -0.163497522f, -0.068242684f, 0.0943591818f,
+    0.0230775047f, -0.101181448f, -0.027932398f, 0.312176764f,
+    0.135579139f, 0.133060426f, 0.0510379113f, 0.0901995599f,
+    0.0346688479f, -0.0297682174f, 0.145900786f, 0.597195029f,
+    0.0552829057f, 0.321529597f, 0.322070301f, 0.145212159f,
+    0.204164222f, 0.0912472457f, -0.116303645f, 0.05389487f,
+    -0.118505567f, -0.0463899411f, -0.0659979731f, -0.275033325f,
+    -0.268814176f, 0.0106623005f, -0.103111692f, -0.0402817763f,
+    0.169504955f, 0.0129608633f, -0.0462195128f, -0.200574547f,
+    -0.143742725f, -0.0886769742f, -0.0204498563f, 0.217553705f,
+    0.0470041186f, 0.0327934399f, 0.0221022796f, -0.297271609f,
+    -0.2700921f, -0.162961259f, -0.0246237144f, 0.0234081391f,
+    -0.233001649f, -0.0780921876f, -0.107616134f, -0.0339775607f,
+    -0.0212961566f, -0.254346728f, -0.0504736155f, 0.116441846f,
+    -0.172022253f, 0.0531101897f, -0.0195935518f, -0.293119937f,
+    -0.206549749f, -0.0809641257f, -0.0773336142f, -0.0526697785f,
+    0.117883898f, -0.194641903f, -0.0402919389f, -0.0767970532f,
+    -0.116556741f, 0.187358722f, -0.148478612f, 0.100732297f,
+    0.0152484318f, -0.37662518f, -0.0731162131f, -0.0717801973f,
+    0.00961051043f, 0.226974308f, 0.16465719f, -0.0188610386f,
+    -0.135817349f, -0.186166182f, 0.154828712f, 0.00508742407f,
+    0.225801915f, 0.273430318f, -0.0902903676f, -0.2106359f,
+    0.206102461f, -0.199801132f, 0.232014745f, 0.00106604013f,
+    -0.0360739045f, -0.34034878f, -0.0720092207f, 0.309261113f,
+    -0.305849731f, -0.066395022f, -0.15311493f, 0.185158268f,
+    -0.149597794f, -0.414508939f, 0.0761435926f, 0.0148313818f,
+    -0.0846394226f, -0.0740266144f, 0.127482459f, -0.117100127f,
+    -0.336102456f, 0.168058574f, -0.0771454349f, -0.0480172783f,
+    -0.124441132f, -0.0176975299f, 0.172682241f, -0.139700428f,
+    -0.350744188f, -0.00520796282f, 0.0425944701f, -0.0640744716f,
+    -0.196919695f, -0.0486949421f, -0.185105383f, 0.103707671f,
+    0.288249284f, -0.135001823f, 0.117211007f, -0.0455315262f,
+    -0.0951138958f, 0.00866999198f, 0.158424139f, -0.315995902f,
+    -0.0971824527f, 0.134981513f, -0.0469459593f, 0.158869848f,
+    0.11401169f, -0.22065708f, -0.210046768f, 0.0908272639f,
+    0.0264187455f, 0.0358856022f, 0.31477049f, 0.0602283888f,
+    -0.0492609553f, -0.0623247549f, -0.0696832463f, -0.326366723f,
+    -0.312022299f, -0.142689109f, 0.0818037018f, -0.125067145f,
+    -0.00958906393f, -0.19058536f, -0.178315327f, -0.0646581575f,
+    -0.278546065f, -0.106457904f, -0.154542357f, -0.375730246f,
+    -0.0851928219f, -0.0408066027f, 0.0868988335f, -0.284269542f,
+    -0.176580831f, -0.0249164626f, 0.0652817935f, 0.173627123f,
+    0.235620856f, -0.280895054f, 0.0844304636f, 0.280885011f,
+    0.00760797178f, -0.319342583f, -0.0618300885f, 0.0799289718f,
+    -0.256658047f, -0.0456111059f, 0.156238303f, 0.156850278f,
+    -0.0229477305f, 0.157182127f, 0.126629978f, 0.176269412f,
+    0.115050554f, -0.00948478561f, -0.00295603345f, -0.28688547f,
+    -0.0725317597f, 0.0332445055f, -0.283264011f, -0.0786453635f,
+    0.0143658472f, 0.0467209853f, 0.154810861f, 0.188806891f,
+    -0.268248141f, -0.0697726682f, 0.170404494f, 0.0418620482f,
+    -0.244185939f, 0.0847917199f, 0.0690336525f, 0.270726264f,
+    0.0274833962f, -0.0612066276f, -0.368999481f, -0.116411895f,
+    0.124489307f, 0.136317343f, -0.138975158f, 0.284717977f,
+    0.198132053f, -0.258607805f, -0.18244575f, -0.0350049213f,
+    -0.104862094f, 0.128710389f, 0.186404914f, -0.00616822718f,
+    0.0132844849f, 0.0787075162f, -0.233665347f, 0.0984352827f,
+    0.307244658f, 0.0845893025f, -0.0999275818f, -0.00374217913f,
+    0.25352779f, 0.322558403f, 0.0310065709f, -0.0578450188f,
+    0.0489898659f, 0.118498586f, 0.126854077f, -0.14101094f,
+    0.346307158f, -0.13262625f, 0.00427587703f, -0.32957831f,
+    -0.339697659f, -0.101758458f, 0.0267066117f, 0.070098266f,
+    -0.10829901f, 0.146013707f, 0.115883552f, -0.093171984f,
+    -0.209430084f, -0.181963116f, -0.174949735f, -0.00890645385f,
+    -0.250425339f, -0.178955138f, -0.0150906453f, 0.13464494f,
+    -0.134616971f, -0.168316066f, -0.243135765f, 0.000743435638f,
+    -0.16341421f, 0.293992251f, 0.00651017996f, 0.183225498f,
+    -0.185076609f, -0.114745766f, 0.325255394f, 0.379727662f,
+    -0.240490898f, -0.0684285164f, -0.184428453f, 0.0917349309f,
+    0.0886615515f, 0.076530233f, 0.259088337f, 0.0262672715f,
+    0.00586942583f, -0.125347659f, -0.189407155f, -0.0783877075f,
+    -0.00884174369f, 0.140024856f, -0.279714227f, 0.0192882102f,
+    -0.163832471f, -0.334782213f, -0.0182277858f, 0.0285206717f,
+    -0.0409028046f, 0.154402331f, 0.155748472f, 0.0772853866f,
+    -0.227967098f, 0.0416225456f, 0.125269219f, -0.062550202f,
+    -0.199681684f, -0.0835614949f, -0.113136508f, -0.0807113126f,
+    -0.224877253f, 0.163882673f, -0.241972253f, 0.00837842654f,
+    0.221210122f, -0.153866366f, 0.0884640366f, -0.17110759f,
+    -0.0244228095f, 0.087413922f, -0.278707594f, -0.013991599f,
+    0.0740972683f, 0.369637311f, 0.219086245f, -0.0302783698f,
+    -0.0296161082f, -0.19228819f, -0.184714764f, 0.0592796281f,
+    0.278848201f, -0.0108716739f, 0.172736958f, -0.181418121f,
+    -0.0989242345f, 0.0364189371f, 0.222849265f, 0.269021511f,
+    0.0539274663f, -0.162813768f, -0.299864739f, -0.079649806f,
+    0.0862140432f, 0.251904905f, 0.194860697f, -0.190476999f,
+    0.208409503f, -0.0708400011f, -0.297508985f, -0.110902637f,
+    -0.320909202f, -0.162165761f, -0.0806405395f, -0.217293173f,
+    0.000903016014f, -0.157227799f, -0.326881051f, 0.00764300395f,
+    -0.175480545f, -0.305971146f, 0.084424153f, 0.0511353128f,
+    -0.193799138f, 0.0978726149f, -0.0295111407f, -0.161818087f,
+    -0.323810339f, -0.192915261f, 0.0289581604f, -0.128615886f,
+    0.0788394287f, 0.126500845f, -0.199091375f, -0.0644571409f,
+    0.0230234936f, -0.127590835f, 0.119860031f, 0.219838053f,
+    0.111180864f, -0.325343519f, 0.0774825513f, -0.0920087472f,
+    0.199831113f, -0.142831936f, 0.0798155218f, 0.113236725f,
+    -0.244670987f, 0.0877882615f, 0.0869842917f, -0.120648205f,
+    -0.279932141f, -0.021363873f, -0.00642676139f, -0.124559917f,
+    -0.0947150663f, 0.199072301f, 0.0715079904f, -0.073373802f,
+    -0.0778705776f, -0.0736144409f, 0.274469167f, -0.140616342f,
+    0.0359819978f, -0.0455264673f, -0.0494857058f, 0.391205043f,
+    0.100561842f, 0.249385118f, 0.409688503f, -0.0815303102f,
+    0.100813657f, 0.0332954563f, 0.213983133f, 0.289812833f,
+    0.504362762f, -0.0903803483f, -0.0737336278f, -0.0781140625f,
+    -0.231239676f, 0.114452273f, -0.201533824f, -0.0431988947f,
+    0.0379153304f, -0.150422588f, -0.398131847f, -0.0470343418f,
+    -0.058605697f, -0.3974078f, -0.201074153f, 0.193186074f,
+    -0.282210499f, -0.179353803f, -0.0919357911f, -0.0299143903f,
+    -0.193313494f, -0.0139268655f, -0.187808082f, -0.0193037018f,
+    0.0200088471f, -0.193031281f, -0.374933541f, -0.193797722f,
+    0.0694415122f, 0.100076161f, 0.125617281f, 0.106316157f,
+    0.0156082753f, -0.226576641f, -0.247717321f, -0.0655675381f,
+    0.0426901057f, 0.224448964f, -0.0140706087f, 0.145645916f,
+    -0.196464002f, -0.282180399f, 0.203190297f, 0.264794827f,
+    -0.200226679f, 0.209400222f, 0.0586867854f, -0.106837802f,
+    0.150602579f, 0.00664308993f, 0.0142627796f, 0.309992045f,
+    0.0129793715f, 0.0967370272f, 0.328118503f, 0.442290425f,
+    -0.0441457443f, -0.369679868f, -0.144510522f, -0.0664532632f,
+    -0.038613718f, 0.0889478698f, -0.187445208f, 0.111472197f,
+    0.101607047f, -0.101538278f, -0.23581478f, -0.119972661f,
+    -0.310437024f, -0.0107569452f, -0.102567025f, -0.0252614822f,
+    0.107751541f, -0.00407934748f, -0.0141312415f, -0.38434568f,
+    -0.40136081f, -0.197586462f, 0.00499949325f, 0.0412377715f,
+    -0.00304798502f, 0.107005104f, -0.0664419755f, -0.202180952f,
+    -0.403736204f, -0.481780529f, -0.231266692f, 0.0559125766f,
+    -0.233484417f, -0.101345062f, -0.170080855f, 0.0726769343f,
+    0.0861455947f, -0.0774474889f, 0.202862069f, -0.204124153f,
+    0.0600511841f, 0.10913451f, -0.0932739228f, -0.19073303f,
+    -0.181709096f, -0.103441477f, -0.191227421f, 0.0213371776f,
+    -0.206539109f, -0.113180533f, -0.107496239f, -0.049943164f,
+    0.060958419f, 0.17733787f, 0.129940614f, -0.0326638035f,
+    -0.150429696f, -0.264527053f, -0.285355985f, -0.115367651f,
+    0.370023519f, 0.0340277925f, -0.0474166758f, -0.0207872614f,
+    -0.180608943f, -0.250763685f, 0.00565027352f, -0.0114219254f,
+    0.0157605577f, 0.0194471143f, -0.42844519f, -0.221965834f,
+    -0.0721986443f, -0.228879079f, -0.669636309f, -0.129290327f,
+    -0.15070039f, -0.216537908f, -0.0012339307f, 0.00734770205f,
+    -0.304540843f, -0.284342527f, -0.118236229f, -0.0425404795f,
+    -0.0448061936f, 0.0036004493f, -0.494993061f, -0.570998013f,
+    -0.291417331f, -0.0965101346f, -0.181630656f, -0.11043407f,
+    -0.193582252f, 0.10225556f, 0.126085624f, -0.147112906f,
+    0.0106868939f, -0.0814637393f, 0.0822153315f, 0.304650724f,
+    0.0740171149f, 0.109701931f, 0.208434016f, 0.0165244583f,
+    -0.117642321f, -0.230547816f, 0.123202473f, 0.0526531041f,
+    0.241041124f, -0.00689279381f, -0.213648438f, -0.0815268308f,
+    -0.0103460588f, -0.429879636f, -0.360865623f, -0.274337798f,
+    0.169987708f, 0.264164716f, 0.152467877f, 0.0189576782f,
+    -0.0776395351f, -0.146725953f, -0.00986872986f, 0.212514773f,
+    0.124873482f, 0.161652267f, 0.0754568204f, -0.118386775f,
+    0.184575513f, 0.0895106867f, 0.0564403608f, -0.051850047f,
+    -0.127940252f, -0.063058354f, 0.0435354896f, 0.154826492f,
+    -0.369054645f, -0.372134864f, -0.236716837f, 0.0857905f,
+    0.297671109f, 0.261149228f, 0.0350911617f, -0.0419089161f,
+    -0.111948103f, -0.0434394106f, -0.228859127f, 0.191218942f,
+    0.169384599f, -0.0825385973f, -0.0538422167f, 0.447060436f,
+    0.0622123368f, 0.56099081f, 0.00162647397f, -0.187467828f,
+    0.0526993945f, 0.0416584872f, -0.0541746393f, -0.460623175f,
+    -0.0531671382f, -0.129348859f, 0.0596664064f, -0.134089708f,
+    -0.102862515f, -0.0514063053f, 0.0543147996f, 0.173487544f,
+    -0.199463129f, 0.0896998644f, 0.153717071f, 0.113359243f,
+    0.0406471565f, -0.180018619f, 0.0456682742f, -0.133423656f,
+    0.0161179397f, -0.0662102029f, 0.375887632f, 0.103427671f,
+    -0.287143052f, -0.229302078f, 0.123323858f, -0.0329943933f,
+    0.00665850751f, -0.0293442588f, -0.210940316f, -0.250351399f,
+    -0.18165125f, -0.283755064f, 0.0098391166f, 0.107347786f,
+    0.0338295475f, 0.0745752454f, -0.0102682989f, -0.332525402f,
+    -0.45215708f, -0.0366751626f, 0.112188213f, 0.0403119922f,
+    0.111180797f, -0.0823035091f, -0.292472661f, -0.271975785f,
+    -0.0909995437f, -0.0215371139f, 0.228581369f, 0.0584756024f,
+    -0.10427025f, -0.161243051f, 0.05129629f, 0.0903939009f,
+    0.327456087f, 0.207278803f, -0.00138581893f, -0.0352398902f,
+    -0.141164497f, 0.242959574f, 0.39245978f, 0.280959308f,
+    0.166137651f, 0.241849288f, 0.0601016246f, -0.140552536f,
+    0.0515279807f, -0.0410086177f, -0.294635475f, -0.35957104f,
+    -0.0451943204f, -0.17742683f, -0.188517258f, -0.159173876f,
+    0.0164202154f, 0.074820511f, -0.185681269f, -0.169397146f,
+    -0.495831817f, -0.115146488f, -0.141751021f, 0.131776884f,
+    0.128398687f, -0.0801265016f, -0.102040023f, 0.0808078498f,
+    0.27673617f, -0.0392310955f, 0.055296272f, -0.30837369f,
+    -0.114716493f, -0.00922919158f, -0.259088755f, -0.0337957516f,
+    0.0770681202f, -0.00712705962f, 0.0410641469f, -0.412831008f,
+    -0.130852595f, -0.148718894f, -0.225556225f, -0.00449019112f,
+    -0.083190158f, -0.25597176f, -0.247870341f, 0.02591791f,
+    0.191709325f, 0.201977566f, -0.0524582341f, 0.0656579956f,
+    0.155953079f, 0.0877680406f, 0.198424354f, 0.178472549f,
+    -0.218164325f, -0.209095955f, 0.0444959067f, 0.0279685836f,
+    -0.0629683211f, -0.10578499f, -0.105763286f, 0.175568193f,
+    0.03973208f, 0.228025258f, 0.0975411162f, 0.0172088481f,
+    0.184233591f, 0.0961027592f, 0.0278921481f, 0.107692316f,
+    0.0641511157f, -0.0991412476f, 0.113270342f, 0.114635244f,
+    0.138987049f, -0.149276718f, 0.121131301f, 0.224548876f,
+    -0.395260602f, -0.247072875f, -0.410017282f, -0.282739788f,
+    -0.161466897f, -0.134861276f, -0.527515829f, -0.255273193f,
+    0.0945098698f, 0.191651925f, 0.0342297666f, -0.48200658f,
+    0.0718111619f, 0.197571129f, 0.0314638354f, -0.0773478895f,
+    -0.0492380708f, -0.0763938725f, 0.109983921f, 0.463523209f,
+    -0.155178294f, -0.157485351f, 0.0544680767f, 0.0471538901f,
+    -0.00595201459f, -0.1410546f, -0.119762704f, -0.119961187f,
+    0.275351614f, 0.082865797f, -0.0282471608f, 5.30413381e-05f,
+    0.203517675f, -0.185168743f, -0.0890127718f, -0.020481158f,
+    0.0659393147f, -0.146871403f, 0.146703646f, 0.0795088187f,
+    0.0489253141f, 0.22330144f, 0.0377814695f, 0.132603452f,
+    0.0269716475f, 0.116759792f, -0.224132016f, 0.067330882f,
+    0.186855406f, -0.123726316f, -0.0514203794f, 0.0171408746f,
+    -0.0189304128f, -0.142614603f, -0.0646934509f, -0.178517118f,
+    0.214822829f, 0.204074964f, -0.0514270738f, -0.0651086941f,
+    -0.246788099f, 0.00810221117f, 0.107195407f, -0.0951538607f,
+    -0.00262989779f, -0.238271505f, -0.335207134f, -0.0273072012f,
+    0.0436718613f, 0.149373546f, 0.243520379f, 0.0820388123f,
+    0.157654345f, 0.215901092f, -0.0519718602f, 0.0148024885f,
+    0.0995815992f, -0.148516998f, -0.262987077f, -0.0879106522f,
+    0.0181160364f, 0.0975467637f, -0.283817321f, 0.04726642f,
+    -0.346996963f, -0.162178308f, -0.186051905f, 0.286216944f,
+    0.137249082f, 0.0192346442f, 0.201774418f, 0.190326393f,
+    0.103466421f, 0.0916132256f, -0.00123327482f, 0.202741712f,
+    0.104775541f, -0.109975994f, -0.221842691f, 0.0534095019f,
+    0.0298570246f, -0.00395404315f, 0.307907939f, -0.151746511f,
+    -0.264885396f, 0.0181843787f, -0.0885927007f, -0.14202933f,
+    -0.00911452528f, 0.0264396649f, 0.3835693f, -0.116401859f,
+    -0.0698059052f, -0.118524827f, -0.0224375091f, 0.176736161f,
+    -0.425262719f, -0.0117083527f, -0.323989004f, -0.000926294189f,
+    0.257656008f, 0.186797976f, 0.00554496516f, -0.184239581f,
+    -0.244285449f, -0.0694236755f, 0.0710102096f, 0.0586403199f,
+    0.386002451f, 0.144378543f, 0.0178323202f, -0.0770923346f,
+    -0.0600421205f, -0.128281355f, -0.125745684f, -0.243516043f,
+    -0.119309381f, -0.101712085f, -0.140780032f, -0.173652157f,
+    -0.0835953802f, 0.288547873f, -0.0820636079f, 0.0407829322f,
+    -0.29431957f, 0.021756364f, -0.113116309f, 0.062544331f,
+    -0.0128239011f, -0.187447473f, -0.15545541f, 0.0831586719f,
+    0.173242912f, 0.174566358f, 0.200559437f, 0.0275924765f,
+    0.0849347264f, 0.24466674f, 0.124182753f, 0.0217772443f,
+    0.162406176f, 0.0688980296f, 0.0974322706f, 0.141522944f,
+    0.217244402f, 0.12379773f, -0.147301048f, 0.0325496271f,
+    0.0860083327f, 0.211905047f, 0.213741869f, -0.0760154128f,
+    -0.185827658f, -0.362441361f, 0.0761166513f, -0.194417164f,
+    0.00553014595f, 0.182574555f, -0.205301106f, -0.0296856798f,
+    0.0498116799f, 0.279699475f, 0.278764457f, -0.114256315f,
+    0.100504272f, 0.102615036f, 0.30805549f, 0.00705120666f,
+    -0.307830334f, 0.0824753866f, 0.0659576505f, 0.0224547386f,
+    0.0473191813f, -0.053641513f, -0.395071089f, -0.249536872f,
+    -0.101879612f, -0.265220344f, 0.0525057502f, 0.0875688046f,
+    0.26972723f, 0.193045393f, 0.149874315f, -0.0578353927f,
+    -0.0665720627f, 0.0134888124f, 0.130150065f, 0.202370599f,
+    0.318041027f, -0.208947212f, -0.0476869866f, 0.0621149205f,
+    -0.120965205f, -0.243894383f, 0.0244165957f, -0.0958370641f,
+    -0.228364766f, 0.121638954f, -0.196058452f, 0.0395915546f,
+    0.28251946f, -0.0985881239f, 0.065531075f, -0.132819653f,
+    0.17410408f, 0.16927442f, 0.118567087f, -0.0984633937f,
+    0.169185728f, -0.0956987888f, -0.0985950232f, 0.168773606f,
+    0.221156389f, 0.231787607f, -0.122967303f, -0.338475704f,
+    -0.395635575f, 0.00960500631f, 0.0809288323f, -0.0183558259f,
+    0.0123696206f, -0.263830453f, -0.141772792f, -0.00699376687f,
+    0.0449804552f, -0.250153571f, -0.0574516542f, 0.100967333f,
+    0.194617569f, 0.18055068f, -0.127512276f, -0.00581976632f,
+    -0.185361072f, -0.269445539f, -0.0298788901f, 0.169970244f,
+    -0.0139484024f, -0.367177695f, -0.158036679f, -0.104487121f,
+    -0.195287645f, -0.126928329f, -0.196501851f, -0.199892938f,
+    -0.167760938f, 0.147126243f, 0.0999297053f, 0.022531135f,
+    0.155828357f, 0.231506735f, -0.140642017f, -0.0621461421f,
+    0.090672195f, -0.168778718f, -0.0434202626f, -0.0954861119f,
+    0.0289945714f, 0.0481645465f, -0.289461643f, 0.0624288134f,
+    0.216896862f, -0.174085721f, 0.0594760813f, 0.0266713519f,
+    -0.430840433f, 0.129792035f, -0.0458095297f, -0.0395143554f,
+    -0.104838699f, -0.0724877715f, -0.210368901f, 0.0931692198f,
+    0.132730782f, 0.150779262f, 0.138603166f, -0.148814842f,
+    -0.148512945f, 0.104529575f, 0.290624082f, -0.025888104f,
+    0.0518265814f, 0.0691093355f, -0.150624737f, -0.178046584f,
+    0.0967383906f, -0.0929526836f, 0.0671997815f, -0.118843377f,
+    0.0542258546f, 0.198104054f, -0.123721041f, -0.219689041f,
+    -0.432375073f, -0.175407425f, 0.172170788f, 0.134584293f,
+    0.0870487168f, 0.0970778167f, 0.0829479769f, -0.315027624f,
+    0.0759671926f, -0.0116552375f, 0.0388441309f, 0.295451552f,
+    -0.103608668f, -0.293444842f, 0.0968675241f, -0.0219311789f,
+    -0.161955446f, -0.0232443493f, 0.0745247453f, 0.155658409f,
+    -0.107034758f, -0.104902484f, -0.124035306f, 0.104243539f,
+    -0.0274903718f, -0.0397351272f, -0.0192831885f, 0.370515257f,
+    0.31092602f, 0.220574677f, -0.0346928872f, -0.147702068f,
+    -0.101840228f, -0.13279216f, -0.253827453f, -0.139419556f,
+    -0.190812483f, -0.273083895f, 0.0580772609f, -0.0667506307f,
+    0.0729436502f, -0.16128096f, -0.166689932f, -0.00986522436f,
+    -0.00272426638f, -0.171426207f, 0.0684210211f, -0.231053501f,
+    -0.0881529003f, -0.0784823671f, 0.0926935375f, 0.195650205f,
+    0.17798093f, -0.0110821556f, -0.0958181173f, -0.269067973f,
+    -0.112111658f, -0.014337128f, -0.334441751f, -0.0220570061f,
+    -0.0533614419f, 0.128395155f, -0.0600632764f, -0.165619567f,
+    -0.155240431f, 0.242572427f, -0.0105321528f, -0.155280739f,
+    0.489126712f, 0.205704406f, 0.0920932293f, 0.125743419f,
+    -0.310920209f, 0.0123026073f, -0.056665305f, 0.0529632419f,
+    -0.0891911462f, -0.100201912f, 0.120550834f, 0.118917726f,
+    -0.0778857172f, -0.306841403f, 0.0305577312f, 0.0125219105f,
+    -0.0349644721f, 0.166065499f, -0.0937525332f, -0.322644413f,
+    -0.20055826f, -0.0341176577f, -0.325033188f, -0.012628166f,
+    0.27160731f, 0.107545227f, -0.0547091737f, -0.0756373554f,
+    -0.101010837f, 0.0967148244f, 0.0903824642f, 0.158168644f,
+    0.0728083625f, -0.154923081f, 0.00400769943f, 0.441874474f,
+    -0.242122218f, 0.116571501f, -0.190395802f, -0.157447353f,
+    -0.296925157f, -0.301760405f, -0.481527388f, -0.109245785f,
+    0.263893962f, -0.275603682f, -0.0769818202f, 0.0207570307f,
+    0.0654255077f, -0.0115559287f, -0.229957476f, 0.0812438279f,
+    -0.263454825f, -0.134573355f, -0.0928186551f, 0.0313077681f,
+    -0.239734471f, -0.228178367f, -0.168885246f, 0.0109828692f,
+    0.0306960512f, -0.0777544081f, -0.202061966f, -0.161640137f,
+    0.182450309f, 0.269031674f, -0.0238797013f, 0.103255726f,
+    0.0985629782f, 0.254226178f, 0.205296636f, 0.15048407f,
+    0.175271392f, -0.102380805f, 0.0989289433f, 0.0275768526f,
+    -0.135034606f, 0.040456295f, -0.100771002f, 0.180946484f,
+    -0.0154200802f, 0.157099232f, 0.259273291f, -0.151206955f,
+    -0.00864407886f, 0.206359893f, 0.038455788f, -0.154835373f,
+    0.0783910826f, -0.351116359f, -0.249899611f, -0.249605238f,
+    0.0831713676f, 0.161712065f, -0.0386934094f, -0.205332398f,
+    -0.00248978566f, -0.000762341602f, -0.398751974f, -0.121266343f,
+    0.211609304f, -0.267547309f, -0.0793510005f, -0.0557773672f,
+    -0.0829484239f, -0.234417737f, 0.156185046f, 0.0379097015f,
+    0.0881709754f, -0.132067204f, -0.452985644f, -0.252602816f,
+    -0.53843224f, -0.323630512f, -0.0445467569f, -0.0522999056f,
+    -0.194222078f, -0.121372394f, -0.0587525293f, 0.0471856371f,
+    0.151036382f, -0.105799288f, -0.191842392f, -0.200208038f,
+    -0.170401961f, -0.0181985907f, -0.650566697f, 0.0443558507f,
+    -0.0432434529f, -0.0287164338f, -0.235053271f, -0.144983798f,
+    0.0683253407f, -0.247944891f, -0.172817186f, 0.0172398277f,
+    -0.137980834f, 0.0118402531f, 0.170153067f, -0.0406068414f,
+    0.0092228977f, 0.0368328728f, 0.317002684f, -0.0730079487f,
+    0.077405706f, 0.0134882797f, 0.174017861f, -0.207598269f,
+    0.00992693752f, -0.115656957f, -0.204262227f, -0.0721211284f,
+    0.134787187f, -0.0854821131f, -0.095093511f, -0.166808084f,
+    -0.0996352434f, -0.0756179318f, 0.132146686f, 0.0541459173f,
+    -0.141396254f, -0.450645745f, 0.136675969f, -0.0734898821f,
+    -0.0364320762f, 0.0441604815f, 0.28183496f, -0.0424874984f,
+    -0.0201876964f, 0.0606338717f, 0.131849498f, 0.236598194f,
+    0.0576992817f, -0.139987096f, -0.0225536581f, -0.164020434f,
+    -0.198556334f, -0.0873736963f, 0.0895474255f, -9.91002598e-05f,
+    -0.0990521014f, 0.1475126f, 0.0530749969f, 0.0813950747f,
+    0.0962183997f, -0.095296368f, -0.121789254f, 0.122934788f,
+    -0.0471193083f, 0.262020081f, 0.379194379f, -0.541105807f,
+    -0.421749711f, 0.0895027369f, -0.0440843217f, -0.0109579237f,
+    -0.136994377f, 0.260386229f, 0.137305886f, 0.0014320818f,
+    0.136225745f, 0.19872658f, 0.0422063842f, 0.034724623f,
+    -0.143419892f, 0.104598612f, 0.169703692f, -0.267457277f,
+    0.110174619f, -0.0212018769f, -0.336791277f, -0.0387115069f,
+    0.0505439602f, 0.001064123f, -0.0671256781f, -0.428985685f,
+    0.126294643f, -0.0308465697f, 0.22592704f, 0.143617243f,
+    -0.291819781f, -0.338598847f, -0.0716291443f, 0.0314208046f,
+    -0.133531734f, -0.14678286f, -0.00291382615f, -0.0712691322f,
+    0.172070518f, 0.00183582725f, -0.344246894f, -0.282573432f,
+    -0.271856606f, -0.229311526f, -0.28548944f, 0.030356342f,
+    -0.0584146678f, -0.167346746f, -0.286761433f, 0.00319353584f,
+    0.15811187f, 0.0564160049f, 0.143272772f, 0.146749228f,
+    0.378858149f, 0.228858218f, 0.293545753f, 0.303482115f,
+    0.201800227f, -0.00806622207f, 0.0642214119f, -0.137851089f,
+    0.0631392524f, -0.0709009245f, -0.183184758f, -0.0997520611f,
+    0.278359443f, 0.130634934f, -0.00651168264f, 0.114622399f,
+    0.085832037f, -0.0963276252f, -0.280169696f, -0.223512486f,
+    0.0232240874f, 0.0539097376f, -0.173710659f, -0.203373954f,
+    0.220094427f, 0.146222726f, 0.225911334f, -0.0489274785f,
+    -0.000127564956f, -0.0488025472f, -0.079526186f, -0.271632761f,
+    -0.015834393f, -0.234209195f, -0.0291435774f, -0.105991147f,
+    0.122710727f, 0.0737151876f, -0.0037524302f, -0.173385859f,
+    0.0457357094f, 0.118443511f, 0.0125338472f, -0.250537574f,
+    -0.0242378879f, 0.00821895897f, 0.123498902f, -0.266596198f,
+    0.0146312397f, 0.232809022f, 0.0377704501f, -0.17669113f,
+    0.18793495f, 0.206976295f, 0.211418629f, 0.0233450681f,
+    0.00886771176f, -0.159219548f, -0.00822777208f, -0.247240588f,
+    -0.696870863f, -0.191468924f, -0.00616795709f, -0.0440594964f,
+    0.144599035f, -0.039354261f, -0.0791117698f, -0.191566646f,
+    -0.0581338704f, -0.350426942f, -0.0134423245f, 0.133421525f,
+    0.243970111f, 0.0931123048f, 0.0349234156f, -0.118870586f,
+    -0.300391078f, -0.0263759382f, 0.212650672f, 0.149471804f,
+    0.216376364f, 0.0360253565f, 0.100757778f, -0.232047111f,
+    0.0648124963f, -0.621480346f, -0.145326376f, -0.0541455112f,
+    -0.320978731f, -0.270050704f, -0.146279395f, 0.281801283f,
+    0.385554701f, -0.126317278f, -0.272185266f, -0.0874173716f,
+    0.183642685f, 0.262228996f, 0.0372127406f, -0.204862952f,
+    -0.0167796984f, 0.0328207612f, -0.291125834f, -0.0619765744f,
+    0.135113403f, -0.0773212612f, -0.163075835f, -0.080728732f,
+    -0.202858567f, -0.361522019f, 0.0862425193f, 0.0226557739f,
+    0.0363386907f, 0.11233595f, 0.129174039f, -0.151678503f,
+    -0.0962837189f, 0.237811044f, 0.299284339f, 0.0974687785f,
+    -0.0207124949f, 0.0312683173f, 0.173981965f, -0.355318397f,
+    -0.176206827f, -0.100655831f, -0.0657929033f, 0.082281433f,
+    -0.0994393229f, 0.266502619f, -0.0490214154f, -0.0381352194f,
+    -0.0302357357f, -0.016740784f, 0.345046371f, -0.122062735f,
+    0.0180271976f, -0.0783424526f, 0.0415920317f, -0.21272479f,
+    -0.304041862f, -0.56086129f, 0.0679691285f, -0.0629829541f,
+    -0.0204771534f, 0.0591682345f, 0.217226237f, 0.0664481819f,
+    0.105542392f, -0.137795672f, -0.192092955f, -0.121118672f,
+    0.213193476f, 0.0902569667f, -0.0239539035f, -0.219446391f,
+    -0.163691357f, -0.102852046f, -0.164969876f, -0.0941262543f,
+    0.0495189801f, -0.0695070326f, -0.617812753f, 0.0794765651f,
+    0.0328974687f, -0.228093818f, 0.199306712f, -0.268082142f,
+    0.0402073525f, 0.129039466f, 0.367939204f, -0.0596810319f,
+    -0.0820799246f, -0.236371562f, -0.121158987f, -0.214700177f,
+    0.0602996089f, 0.120481215f, -0.0656955391f, 0.226439804f,
+    0.0882479995f, -0.230068401f, 0.0834353492f, -0.0674567968f,
+    0.0673247129f, -0.234150767f, -0.0213311762f, -0.0626349524f,
+    -0.0507771857f, 0.205877796f, 0.247578308f, -0.0934400931f,
+    -0.454039067f, 0.00579757942f, 0.0799930319f, 0.0852686465f,
+    -0.257945269f, -0.0558092669f, 0.0291816518f, 0.0766297579f,
+    0.0427771658f, 0.0381526165f, -0.0728451237f, -0.595657289f,
+    -0.403276771f, -0.0468185917f, 0.0254515763f, 0.0455734208f,
+    0.159274682f, 0.096413739f, -0.154952958f, -0.158800974f,
+    0.0593065955f, -0.0439103842f, 0.120185502f, -0.151636332f,
+    0.0438971892f, 0.257322103f, 0.0784572661f, 0.122781828f,
+    0.0297174752f, -0.0459226556f, 0.0422614701f, 0.288266331f,
+    -0.174986631f, -0.227447927f, 0.0402182527f, 0.179484442f,
+    0.0951579586f, -0.0121908793f, 0.186570272f, -0.0644250512f,
+    0.0922956914f, 0.0260622725f, 0.136708081f, -0.107855976f,
+    -0.306746513f, -0.372124046f, -0.0171751808f, 0.0597986542f,
+    0.323096305f, 0.349171132f, 0.0496663079f, -0.116503604f,
+    -0.225619793f, 0.0723930374f, -0.0666095316f, 0.176617235f,
+    0.148768321f, 0.176343411f, 0.174593285f, 0.0775550306f,
+    0.0631767288f, -0.103404924f, -0.185153872f, -0.0126860207f,
+    0.086842306f, 0.101152755f, 0.202272877f, 0.271369129f,
+    0.0300253555f, 0.0841572285f, -0.382561028f, 0.0141016832f,
+    -0.36360538f, -0.0239738263f, -0.125029147f, 0.0486580841f,
+    -0.0624157786f, 0.0380285755f, 0.0671346858f, 0.279633164f,
+    0.0311473813f, 0.103297338f, 0.155590072f, -0.0766676664f,
+    0.0761196613f, -0.293786108f, -0.159512267f, -0.0848110989f,
+    0.196303919f, -0.0169284474f, -0.0503725447f, 0.229761332f,
+    -0.164290786f, -0.121658154f, -0.0582705364f, 0.0837653428f,
+    0.0673978925f, 0.119774893f, 0.162807643f, 0.273427159f,
+    -0.18042019f, -0.261054546f, 0.0817755535f, -0.0250864085f,
+    0.195600927f, -0.128866777f, 0.0847535059f, 0.0460328162f,
+    -0.242689013f, -0.217246622f, -0.232932866f, -0.122822858f,
+    -0.165772974f, -0.00995901041f, -0.153308466f, -0.142972797f,
+    -0.0613876097f, -0.190487474f, 0.248633221f, -0.0390251763f,
+    0.212801829f, 0.126747146f, 0.12614806f, -0.181064501f,
+    -0.25867787f, 0.0553264581f, 0.0396523997f, 0.119460456f,
+    0.0674811751f, 0.0528043732f, -0.136125952f, -0.423099339f,
+    0.0760521591f, 0.0583342612f, -0.165919811f, -0.182704344f,
+    -0.169818997f, 0.111441694f, 0.0418181494f, -0.0781089887f,
+    -0.223058388f, -0.328447074f, -0.0682592019f, -0.0236792043f,
+    0.01451125f, 0.205628514f, 0.0816577822f, 0.0729245394f,
+    0.0528927743f, 0.1067442f, -0.0278405827f, -0.164076507f,
+    0.155570075f, 0.205189839f, 0.00186994765f, 0.0128478594f,
+    0.113630734f, -0.0813069791f, -0.192736581f, -0.111847803f,
+    -0.072723411f, -0.104407065f, -0.0809384659f, -0.222810298f,
+    -0.0882092267f, -0.216853946f, -0.0562028773f, -0.0485332422f,
+    -0.0655359551f, 0.1976711f, -0.283892393f, -0.0585762374f,
+    -0.314890504f, -0.227208272f, 0.0727394149f, 0.0919205993f,
+    0.0961375087f, -0.193032756f, 0.170305088f, 0.192455903f,
+    -0.121299915f, -0.0460530743f, -0.238466308f, -0.00346556841f,
+    -0.0580120794f, -0.126728147f, -0.0781080276f, -0.161702901f,
+    -0.207340717f, -0.158052027f, 0.0287038535f, -0.0640554428f,
+    -0.209300414f, -0.346259743f, -0.103763334f, -0.29000026f,
+    -0.0949531794f, 0.0953600779f, 0.0370691121f, 0.185494721f,
+    0.284330934f, 0.0352057479f, 0.00798667967f, -0.153759316f,
+    0.173662096f, 0.143812671f, -0.0813766718f, 0.0676828325f,
+    -0.0345125049f, -0.066309534f, -0.20744288f, 0.045105394f,
+    -0.0909787118f, 0.0380760692f, 0.365981221f, 0.0252292417f,
+    -0.159909859f, 0.109453f, 0.0800187662f, -0.0189038124f,
+    -0.121508956f, 0.0787220225f, 0.132773563f, -0.0621042624f,
+    -0.0589745566f, 0.152412847f, 0.0323836543f, 0.127885804f,
+    -0.0873064697f, -0.15961735f, 0.0634103492f, -0.0683148876f,
+    -0.138748676f, 0.0957707092f, -0.359715462f, -0.103459589f,
+    0.0714725852f, -0.104099743f, 0.113402158f, -0.141478926f,
+    0.0214370284f, -0.0764255375f, 0.172740385f, 0.451255858f,
+    -0.31835857f, -0.249460548f, 0.0428003743f, 0.0254898462f,
+    -0.0310537945f, 0.145296112f, 0.131204903f, 0.0698375329f,
+    0.0393717103f, 0.193052605f, 0.208663657f, -0.0291853752f,
+    -0.0170516893f, -0.0705387369f, -0.172187075f, -0.16766803f,
+    0.377957851f, 0.064741917f, -0.0192780811f, -0.276242286f,
+    -0.0286348425f, -0.0873004794f, -0.113916568f, 0.176605701f,
+    0.0902162194f, -0.256399512f, -0.119530074f, -0.199829429f,
+    0.00958884321f, 0.0708696544f, 0.20952028f, 0.105285756f,
+    -0.169469565f, 0.207969591f, 0.132848591f, 0.224039793f,
+    -0.0648230091f, -0.102412477f, -0.0929163024f, -0.133121192f,
+    -0.195570827f, 0.115802102f, 0.0633611754f, 0.0382378697f,
+    0.032094378f, 0.0629063547f, 0.136257187f, 0.300952256f,
+    -0.230312407f, -0.311663091f, -0.245574936f, 0.0486902595f,
+    0.147735938f, 0.0686119869f, -0.0454027802f, 0.110698715f,
+    0.0964795575f, 0.344628632f, 0.0869757384f, -0.115603328f,
+    -0.141759515f, -0.001957417f, -0.0762812346f, -0.325329572f,
+    -0.174454063f, -0.196956664f, -0.492638528f, 0.148517117f,
+    -0.142129987f, -0.10085804f, -0.0407786779f, -0.214281917f,
+    -0.333558202f, 0.0104113864f, 0.0150389392f, -0.00654152315f,
+    -0.0174416862f, 0.0765557364f, -0.0639967993f, -0.542759776f,
+    -0.150497481f, -0.0232547261f, -0.158342615f, -0.195607349f,
+    -0.156803697f, -0.205631152f, 0.0950155556f, 0.243323535f,
+    0.18691285f, -0.16680257f, 0.0338715427f, -0.138890803f,
+    -0.192483202f, 0.0316511393f, 0.0638460666f, 0.139548376f,
+    0.113898754f, -0.0230515376f, 0.0723512545f, -0.275263846f,
+    -0.0321125276f, 0.0279676598f, 0.00402783649f, 0.312985957f,
+    0.0217648353f, 0.135891035f, 0.113463588f, 0.122765124f,
+    -0.352188468f, -0.00730487099f, 0.00588718243f, -0.0893060714f,
+    0.0635161996f, 0.0624037199f, -0.0442034714f, -0.183366925f,
+    -0.100359745f, -0.151605293f, -0.101991639f, 0.164521396f,
+    0.0549161583f, 0.100426696f, 0.108240537f, 0.101256877f,
+    -0.0940352157f, -0.219696015f, 0.185802951f, 0.0324420296f,
+    0.0812190846f, 0.12198244f, -0.0686379671f, -0.0932412669f,
+    0.0771686882f, -0.139177442f, 0.173145846f, -0.0789198056f,
+    0.0104829175f, 0.090909563f, 0.280936182f, 0.180965051f,
+    0.240917534f, -0.121220641f, -0.121180549f, 0.113113806f,
+    -0.141291752f, -0.028712092f, -0.230999351f, -0.0421741456f,
+    -0.172496885f, -0.227964565f, 0.0639211163f, 0.0333498381f,
+    0.174049675f, -0.25157401f, 0.251351595f, -0.305458933f,
+    0.0476418808f, 0.0667717159f, 0.209480166f, 0.119456038f,
+    -0.45326978f, 0.0682216287f, -0.188720897f, -0.0197682176f,
+    0.00161420961f, 0.023929717f, -0.198732212f, -0.183813706f,
+    0.144281238f, -0.159213737f, 0.0268213525f, 0.15611282f,
+    -0.0529317111f, 0.0284556616f, 0.213996336f, 0.121582814f,
+    -0.112857044f, -0.0700962096f, 0.182204232f, 0.217190832f,
+    0.00249641784f, 0.135153919f, 0.320906639f, 0.0354680419f,
+    -0.00391008472f, 0.170741275f, -0.204342961f, -0.175357088f,
+    0.0126193687f, -0.251230389f, -0.190820709f, 0.0118603567f,
+    -0.0933102444f, -0.0576271042f, 0.388639808f, 0.0338347405f,
+    0.0950026885f, -0.071881339f, -0.162254646f, -0.0639120415f,
+    -0.0884446055f, -0.00726951146f, 0.0175857656f, -0.251978636f,
+    -0.121183582f, 0.106846385f, -0.252162606f, -0.00944946334f,
+    0.101664424f, 0.219364598f, 0.210864037f, 0.262064099f,
+    -0.0596564896f, 0.163634852f, 0.304102629f, -0.154300436f,
+    0.0647162795f, 0.29085356f, 0.231710672f, 0.153434336f,
+    -0.0326409601f, 0.0140013946f, -0.288948148f, -0.2415068f,
+    -0.102636524f, -0.194322795f, -0.000816915359f, 0.147651613f,
+    0.0898240432f, -0.149417147f, 0.248863101f, 0.172649845f,
+    -0.0597009398f, -0.245785654f, 0.266699761f, 0.174644575f,
+    0.00410673255f, -0.475077182f, 0.148484409f, -0.0131767169f,
+    0.3359074f, 0.170038402f, 0.122586139f, -0.0526649952f,
+    -0.313887358f, 0.255744934f, -0.128896579f, -0.162708253f,
+    0.149905622f, 0.160754368f, -0.160603717f, -0.0298564304f,
+    -0.0175074376f, -0.0502936877f, 0.149321988f, 0.19254756f,
+    -0.167788982f, -0.226687551f, -0.102167368f, 0.103785649f,
+    0.213458598f, 0.114178322f, 0.0478315502f, 0.100630067f,
+    -0.022403799f, -0.20196411f, -0.129079252f, -0.114543252f,
+    0.0668886304f, -0.27825442f, -0.107845865f, -0.152394637f,
+    -0.411884785f, 0.0207508299f, 0.0455954298f, -0.108077615f,
+    0.396826446f, 0.218144059f, -0.0397416018f, 0.165988624f,
+    0.154959574f, -0.197113007f, 0.107469574f, -0.000574543781f,
+    -0.0694762468f, -0.191064239f, -0.187955007f, -0.123052403f,
+    -0.257019877f, 0.129303515f, 0.0181201082f, -0.106161892f,
+    0.34708035f, 0.222298905f, 0.0983811542f, 0.0540839285f,
+    -0.0697091073f, 0.0856177285f, 0.145720914f, 0.249898046f,
+    0.186147064f, 0.100278176f, 0.0301979762f, -0.201040208f,
+    0.329824626f, 0.0368247628f, 0.194737121f, -0.124738663f,
+    0.165255144f, -0.126923159f, -0.13641718f, 0.288900018f,
+    -0.166939944f, -0.143578157f, -0.154817343f, -0.0527978204f,
+    0.0906122252f, 0.123242907f, -0.207915917f, 0.127893999f,
+    0.022698842f, 0.05066045f, 0.0517948791f, 0.337167293f,
+    0.156783521f, -0.13985531f, 0.158136085f, -0.0234352183f,
+    -0.295232713f, 0.00500818761f, 0.157501101f, 0.0165362936f,
+    -0.213135883f, 0.110151105f, -0.0379377604f, 0.0963883623f,
+    0.0773969665f, -0.0860644653f, -0.0868729725f, -0.237649962f,
+    -0.0711728781f, -0.253430963f, 0.156377256f, 0.109833464f,
+    -0.0466021635f, 0.199574947f, 0.0957062244f, 0.258660764f,
+    0.566896141f, -0.00414421922f, 0.0190304145f, -0.118981682f,
+    -0.0156795122f, -0.310077131f, -0.263319194f, -0.40415445f,
+    -0.0840041712f, -0.112127215f, -0.282553643f, -0.400995046f,
+    -0.121209279f, -0.0984375328f, -0.362056613f, -0.148585618f,
+    0.0261267051f, 0.0889379233f, -0.302764118f, -0.174774304f,
+    0.0798892081f, 0.0219076406f, -0.211822644f, -0.14664273f,
+    -0.0606354102f, 0.135439381f, 0.0976998955f, 0.509827197f,
+    -0.189946949f, -0.483069509f, -0.143986121f, -0.241260901f,
+    -0.396900982f, -0.494799763f, -0.436071992f, 0.00971806794f,
+    0.0138335004f, -0.0560802929f, -0.198589385f, -0.227302879f,
+    -0.255115122f, -0.187097445f, 0.0882067755f, 0.0390987583f,
+    0.124975868f, 0.139704004f, 0.0262548681f, -0.214170411f,
+    0.188023761f, 0.0569913387f, -0.100163072f, -0.0581767075f,
+    -0.0604346991f, -0.031439051f, 0.273027062f, 0.0340667963f,
+    -0.416140974f, -0.272556126f, 0.0436553434f, -0.116932124f,
+    -0.218501583f, 0.0688286349f, 0.111342639f, -0.0380328931f,
+    -0.0456982218f, 0.0718059093f, -0.157661885f, -0.202661127f,
+    -0.354617238f, 0.336884052f, 0.00457362458f, 0.0283114482f,
+    0.110368043f, -0.101756565f, -0.079226844f, 0.169795528f,
+    0.357923388f, 0.148181051f, -0.109017223f, 0.068932198f,
+    0.247814953f, -0.150587112f, -0.0681475103f, 0.185662672f,
+    0.0226384886f, 0.248692155f, -0.109305896f, 0.0917017534f,
+    0.152110294f, 0.0670730397f, 0.159872532f, -0.235729158f,
+    0.136130869f, -0.0376497544f, 0.247556388f, 0.115458444f,
+    0.00516160019f, 0.228568539f, 0.147206083f, -0.113844804f,
+    0.098668091f, -0.102923751f, 0.0865129456f, -0.130562991f,
+    -0.0345961042f, -0.0585243143f, 0.280186176f, 0.0263787117f,
+    -0.806415379f, -0.0568070225f, -0.014926157f, -0.225476265f,
+    -0.292269021f, -0.400633752f, -0.0972326472f, -0.156208977f,
+    -0.00220494834f, 0.0725333318f, -0.190598175f, -0.405848205f,
+    -0.615829527f, -0.513732255f, -0.168727934f, 0.0737090036f,
+    0.00699298503f, -0.104539096f, -0.218933135f, -0.133571163f,
+    0.219661638f, -0.0489998087f, -0.109812461f, 0.0469324104f,
+    0.0316993818f, -0.0619128309f, 0.132043198f, -0.274002165f,
+    -0.131849632f, 0.0999217853f, -0.319488823f, -0.198819116f,
+    0.1561542f, -0.20004566f, -0.349633783f, -0.285881311f,
+    -0.226526082f, 0.0522721671f, 0.155788824f, 0.034604378f,
+    -0.163764909f, -0.0489241965f, 0.022225121f, 0.217535332f,
+    -0.102671236f, -0.0384126194f, 0.0997127891f, 0.22632587f,
+    0.0168292038f, 0.40801549f, 0.0712007955f, -0.0599066988f,
+    0.133383587f, -0.0865094811f, -0.245929033f, -0.0838936046f,
+    0.206609488f, -0.171573773f, 0.0524487272f, 0.0809310153f,
+    -0.175479129f, -0.0779116675f, 0.133614033f, 0.112264246f,
+    -0.125278696f, -0.0217711162f, -0.249219373f, 0.0385905169f,
+    -0.0577392988f, -0.211917207f, 0.157023251f, -0.287713498f,
+    0.159289509f, -0.0352437012f, -0.268955022f, -0.0617380515f,
+    -0.198040545f, -0.227212399f, -0.39016068f, -0.260140955f,
+    0.107252277f, -0.214718565f, -0.0782370195f, -0.0120464833f,
+    -0.0235617589f, -0.0145966718f, -0.163901016f, -0.195147276f,
+    -0.278395325f, -0.0016497015f, -0.22724539f, -0.0580204055f,
+    0.0440989025f, 0.0175637603f, 0.194678798f, 0.177389786f,
+    0.000178085247f, 0.0506257601f, -0.242960155f, -0.154263914f,
+    -0.0377009362f, -0.11356838f, 0.349848837f, 0.0834978074f,
+    0.146374986f, 0.16185239f, 0.0559180342f, 0.06585747f,
+    -0.290565431f, -0.0700722262f, -0.00649035722f, -0.111497782f,
+    -0.267483413f, -0.167112008f, 0.027880311f, -0.160466447f,
+    -0.17229192f, 0.0329488665f, 0.330406249f, 0.0371846296f,
+    -0.19274956f, -0.165350839f, -0.158240199f, 0.123931415f,
+    0.390523136f, 0.032387495f, 0.0959662646f, 0.0542365648f,
+    -0.11373461f, -0.108399741f, -0.0401415564f, -0.191842481f,
+    -0.131066278f, -0.0277278535f, 0.0925534442f, 0.177467152f,
+    -0.0528025478f, 0.298179299f, -0.105125271f, -0.041749388f,
+    -0.301462561f, 0.0664723963f, -0.0446604267f, 0.0357657261f,
+    0.00683194539f, 0.105548464f, 0.144307032f, 0.17588155f,
+    -0.169064969f, -0.008016509f, -0.0685012862f, 0.278507054f,
+    0.152249485f, 0.104888305f, 0.085271284f, 0.138013721f,
+    0.0520704538f, 0.175330475f, -0.18171595f, -0.151817471f,
+    -0.0184786879f, -0.075644426f, 0.378473669f, -0.183588833f,
+    0.198531896f, -0.0157967452f, -0.0407318845f, -0.245950758f,
+    0.16424945f, -0.0846645758f, -0.182840601f, 0.037924245f,
+    0.0455345511f, 0.0826425627f, 0.0576417334f, 0.26885584f,
+    -0.295770049f, 0.00684254244f, 0.149007306f, -0.169475272f,
+    -0.159755439f, -0.254150599f, -0.284200728f, -0.181422055f,
+    -0.100308061f, 0.232579723f, 0.142692849f, 0.0793101788f,
+    0.0440978967f, -0.0394228287f, -0.24957557f, -0.125235245f,
+    -0.0199694186f, -0.299112409f, 0.0348194279f, -0.17988424f,
+    0.0798371434f, 0.0532589667f, -0.229693115f, -0.238630295f,
+    -0.134576559f, -0.110820167f, -0.0629905909f, -0.0857331529f,
+    -0.202529833f, -0.0861713439f, -0.00237743137f, 0.103930697f,
+    -0.0944923684f, 0.10048905f, 0.0628271475f, -0.199542597f,
+    0.287549376f, -0.0580643415f, 0.081755735f, -0.0115817338f,
+    -0.0612922609f, 0.0384388082f, 0.124819823f, 0.329465747f,
+    -0.343431085f, -0.396473885f, 0.219305545f, -0.150890782f,
+    -0.123081528f, -0.0100237168f, -0.258584648f, 0.171614707f,
+    0.0902122781f, -0.0154160028f, 0.109673575f, 0.221787706f,
+    0.110394619f, 0.282279819f, 0.132794306f, 0.180197373f,
+    -0.398653299f, -0.00243551587f, 0.234183192f, 0.0153703503f,
+    0.0930798948f, 0.0754403472f, 0.110459059f, -0.136355922f,
+    -0.0129445381f, 0.160694107f, -0.0464123785f, -0.175403193f,
+    -0.103891052f, -0.106606625f, -0.220684022f, 0.0511308573f,
+    -0.0171523504f, -0.075504981f, -0.231396958f, -0.157113478f,
+    0.13296169f, 0.101122312f, 0.23077181f, -0.0159626827f,
+    0.126967654f, -0.165810049f, 0.115138337f, -0.0197780225f,
+    0.0899718925f, 0.0336362831f, 0.111727059f, 0.189427152f,
+    0.111447245f, 0.203552917f, -0.0242269244f, -0.160212144f,
+    0.254647762f, -0.15066044f, -0.1510396f, 0.161212221f,
+    0.19534725f, -0.0782213882f, -0.25798744f, -0.231368259f,
+    -0.198421657f, 0.12680319f, -0.113799974f, 0.028071072f,
+    0.121698223f, 0.16984649f, 0.256954283f, 0.159940422f,
+    0.243188426f, 0.253415465f, 0.0645369589f, 0.0335274711f,
+    0.188600764f, 0.159676015f, 0.0624622703f, -0.0321381465f,
+    0.0796339214f, 0.295662671f, -0.0638658926f, -0.0413042009f,
+    -0.0275569167f, -0.197562605f, 0.145115763f, -0.1133416f,
+    -0.146276712f, -0.0272925328f, -0.105150677f, -0.196078822f,
+    -0.202090114f, 0.066856198f, 0.153666213f, 0.0539844334f,
+    0.0357353538f, 0.15016003f, 0.0103481831f, -0.304719299f,
+    -0.201695397f, -0.183049411f, -0.126056418f, -0.108009808f,
+    -0.302794039f, -0.239732653f, 0.018093355f, -0.0337819047f,
+    -0.264573455f, -0.0946097746f, -0.0285062883f, -0.0385032408f,
+    0.102011062f, 0.130182087f, -0.120380826f, -0.0680998564f,
+    0.155854493f, 0.107492059f, -0.00438468531f, 0.151634037f,
+    -0.0753100142f, -0.375551909f, 0.114117257f, -0.230690449f,
+    0.160450712f, -0.160203889f, -0.654652059f, -0.0222526379f,
+    -0.126769364f, 0.152190909f, -0.408980161f, 0.194568232f,
+    -0.0184429139f, -0.21958603f, -0.182307154f, -0.33534497f,
+    -0.150274172f, 0.0892235786f, 0.209322229f, 0.10090059f,
+    0.0590757318f, -0.0883574709f, -0.142992139f, -0.108837076f,
+    0.422015607f, 0.0428607166f, 0.118408479f, -0.139974236f,
+    0.108478263f, -0.16541335f, -0.153003663f, -0.263150573f,
+    0.108207777f, -0.0526534356f, 0.113964863f, -0.232254565f,
+    -0.179798454f, 0.0803551748f, -0.271124244f, -0.139704436f,
+    -0.221857294f, -0.0133730182f, -0.172592133f, 0.0198786594f,
+    0.114057079f, 0.25741002f, 0.197406814f, -0.0997084379f,
+    0.252077401f, 0.213358775f, -0.533357978f, -0.0177588221f,
+    -0.020143766f, -0.029743515f, -0.171626106f, 0.215732619f,
+    -0.315725416f, -0.043788366f, -0.0972884297f, -0.0244290791f,
+    0.171161547f, 0.175503865f, 0.154612511f, -0.0140993418f,
+    0.120622806f, 0.152130708f, 0.0981659219f, 0.147413388f,
+    0.0318601467f, 0.033497382f, 0.225125343f, -0.163142189f,
+    -0.342533797f, -0.0707890689f, -0.398112833f, -0.155929014f,
+    -0.0606518909f, -0.165122017f, 0.17756857f, 0.173082307f,
+    -0.0995243043f, -0.0572835803f, -0.32928279f, -0.13081497f,
+    0.322299451f, 0.0126911616f, -0.114993624f, -0.121920429f,
+    -0.0663722456f, -0.189084291f, 0.100875102f, -0.169859082f,
+    0.261730582f, 0.076273106f, 0.0909447074f, 0.147459328f,
+    -0.171663448f, 0.361131847f, -0.0357185937f, -0.141143233f,
+    -0.1405527f, -0.240945533f, -0.337416291f, 0.0898850784f,
+    0.0152131943f, -0.363191336f, -0.0125876702f, -0.109643579f,
+    0.0470194444f, 0.138947651f, 0.236270964f, -0.00945999194f,
+    0.122299634f, 0.149976537f, -0.0357292779f, 0.131139591f,
+    -0.183714241f, -0.130519673f, -0.207912162f, -0.0105395624f,
+    -0.00822807103f, -0.369988114f, -0.224749058f, 0.253359914f,
+    -0.172282711f, 0.10506919f, -0.262019157f, -0.0996664241f,
+    0.0102374433f, -0.249227181f, 0.322205812f, 0.0102942884f,
+    0.122816846f, -0.105916046f, 0.22141102f, -0.35798189f,
+    -0.0693287849f, -0.212002128f, -0.113579728f, -0.0759140775f,
+    -0.187644064f, -0.0766053274f, -0.144594058f, -0.156920552f,
+    -0.0926911235f, -0.231073096f, -0.20573163f, -0.186268076f,
+    -0.00199351157f, 0.245454654f, -0.237723827f, -0.342394829f,
+    -0.280312687f, -0.185261995f, -0.0135699008f, -0.0497409068f,
+    0.0136786057f, -0.202765524f, -0.0759551823f, 0.399017841f,
+    0.179893389f, 0.143924564f, 0.0750221759f, 0.102460638f,
+    -0.0262287837f, -0.221709013f, -0.199891493f, 0.063892521f,
+    -0.0715395361f, -0.283669025f, -0.107266381f, 0.00688504847f,
+    -0.106529064f, -0.355033457f, -0.352098912f, -0.0916048437f,
+    0.168544382f, -0.0880346969f, 0.0916830897f, 0.0710772201f,
+    0.159955218f, -0.162974045f, 0.11420358f, -0.115735702f,
+    0.0328707024f, 0.1132982f, 0.0887573287f, 0.216407418f,
+    0.0758910328f, -0.0359665453f, 0.316428453f, -0.0456914827f,
+    0.0195526797f, -0.0622891709f, -0.101394594f, -0.286533803f,
+    -0.167184472f, -0.0753622875f, 0.00870248675f, 0.162994459f,
+    0.015839994f, 0.111877687f, 0.220069945f, 0.17484808f,
+    0.364812404f, 0.137189671f, 0.0635946095f, -0.0211637188f,
+    0.209924534f, 0.0892862305f, -0.358068019f, -0.0518932119f,
+    -0.43022114f, -0.100464799f, -0.00732864672f, 0.0904386863f,
+    0.0205241479f, -0.133979872f, -0.0168706458f, -0.18548961f,
+    -0.0731289759f, -0.152880579f, -0.118152238f, -0.0446585864f,
+    0.0425454825f, -0.163880184f, -0.174177095f, -0.113565207f,
+    -0.0278374851f, -0.202665716f, 0.000927699613f, -0.229736924f,
+    -0.28872928f, -0.290325016f, -0.0975192115f, -0.0317504294f,
+    0.00766642392f, -0.0014695382f, -0.262098253f, 0.126257643f,
+    0.12530005f, 0.135418534f, -0.0810556933f, -0.168001309f,
+    -0.172615483f, -0.0312035289f, 0.00542616798f, -0.167776763f,
+    -0.209906057f, 0.121333949f, -0.156488046f, -0.0498757735f,
+    0.0420298688f, 0.174391121f, 0.17192097f, -0.0941059813f,
+    -0.0484409817f, 0.0309662353f, -0.220230699f, -0.122188695f,
+    -0.0224881079f, 0.117313311f, -0.00531021133f, -0.224751487f,
+    -0.100829534f, -0.191369951f, -0.0159797128f, -0.165179506f,
+    -0.125630528f, -0.203360274f, 0.128594443f, 0.0526512079f,
+    -0.239220887f, -0.319704086f, -0.082656011f, 0.0113123311f,
+    -0.096096307f, -0.269723803f, -0.166321576f, 0.201367721f,
+    0.174731374f, -0.163030654f, -0.0168898664f, -0.0208304394f,
+    -0.132483244f, -0.115899332f, -0.102813542f, 0.0786683783f,
+    -0.115693003f, -0.0197861549f, -0.164816782f, 0.0789591894f,
+    -0.144053712f, -0.319520205f, -0.119653843f, -0.0669324696f,
+    0.00959236454f, -0.237137869f, -0.202442363f, 0.0542093143f,
+    -0.2196244f, -0.24901855f, 0.00851124898f, -0.0259989761f,
+    0.236162379f, 0.0818470493f, 0.151265636f, 0.153460264f,
+    0.195086211f, 0.139531106f, 0.134865999f, -0.159634084f,
+    0.0399047919f, -0.298343271f, -0.361323386f, -0.17086257f,
+    0.0977395773f, -0.0090010874f, -0.285176963f, -0.0339585878f,
+    0.00557645364f, 0.134207115f, -0.152051181f, -0.0701114535f,
+    0.0884074271f, -0.0756873935f, -0.16650866f, -0.212687105f,
+    -0.231794715f, 0.0909046456f, 0.108952254f, 0.368320972f,
+    0.0128908362f, 0.0368258171f, -0.0432882458f, -0.311817288f,
+    -0.35395664f, -0.182587221f, 0.0112891607f, 0.207556948f,
+    0.081036374f, 0.0668471977f, 0.132687435f, 0.14417237f,
+    0.0306493007f, 0.270525157f, 0.170758978f, 0.0783117488f,
+    0.103987753f, -0.0866988823f, 0.115298919f, 0.186483145f,
+    -0.00952534936f, 0.189919755f, -0.150466248f, -0.0118444972f,
+    0.048551023f, 0.344675213f, 0.0690839291f, -0.15081282f,
+    -0.292962164f, -0.308834881f, -0.100381866f, 0.0124617526f,
+    0.0566625074f, 0.108951434f, -0.0353689976f, 0.147957295f,
+    0.232422426f, 0.203790024f, 0.141081288f, -0.0976556167f,
+    0.105384983f, -0.084979564f, 0.00336768199f, -0.192083225f,
+    -0.0948622152f, -0.252796441f, -0.134614825f, -0.1240514f,
+    0.0430304445f, -0.214944169f, -0.125789091f, -0.213180318f,
+    0.183644399f, 0.382708579f, 0.174846321f, 0.220942453f,
+    0.0874253437f, 0.0193567723f, -0.0495977066f, 0.256324112f,
+    0.0535750687f, -0.101249494f, -0.246063769f, -0.204019547f,
+    -0.0400995128f, -0.094374463f, -0.265672982f, 0.0125416387f,
+    0.0449854061f, 0.0314190313f, -0.295980394f, -0.195108816f,
+    -0.286407471f, 0.0577876866f, 0.243835062f, 0.149350613f,
+    0.07704328f, -0.329933584f, -0.113002054f, -0.0174061451f,
+    0.0318249613f, -0.00909402873f, -0.0644686595f, -0.24417375f,
+    -0.0782631189f, -0.173710108f, -0.0866428167f, -0.0736448467f,
+    0.0370262004f, 0.0926706567f, 0.0831152573f, -0.228449255f,
+    -0.0819232911f, 0.235466346f, -0.0484365039f, -0.157237902f,
+    0.0314460509f, 0.271782488f, 0.0212752223f, 0.0895498767f,
+    0.0902568027f, 0.235615984f, 0.099629648f, 0.0300694983f,
+    0.185227886f, 0.190377861f, 0.159470096f, -0.222521171f,
+    0.19768773f, 0.107653722f, 0.0885635614f, 0.0720849708f,
+    0.118039332f, 0.019270068f, -0.112903431f, -0.325824827f,
+    -0.356164932f, -0.00160906941f, -0.0465312116f, 0.111074485f,
+    -0.253078073f, 0.0306916535f, 0.126280993f, 0.12608777f,
+    -0.0129794516f, -0.470944375f, 0.119343296f, -0.259524941f,
+    0.0268609487f, -0.207119465f, -0.103791557f, -0.165822566f,
+    0.0781714916f, -0.189794049f, 0.025323201f, -0.102474876f,
+    -0.108224623f, -0.162300929f, -0.0867286325f, 0.338584155f,
+    0.0879687592f, 0.0935347378f, 0.240870282f, 0.157352135f,
+    -0.119536743f, -0.166862562f, -0.118804723f, 0.0778735355f,
+    -0.0109859658f, -0.115550943f, 0.130447969f, 0.132117867f,
+    0.0908396244f, -0.123488843f, -0.131661028f, 0.147269368f,
+    -0.0560584031f, -0.139353022f, -0.159316942f, -0.00525246514f,
+    0.230472088f, 0.28179425f, 0.0913773775f, -0.00235051778f,
+    0.00770540349f, -0.158425331f, -0.573350012f, -0.21822837f,
+    0.0103202723f, -0.112939261f, -0.177134275f, -0.11373315f,
+    -0.262900382f, -0.277996629f, 0.0205423869f, -0.013986079f,
+    0.0213418081f, 0.085633941f, -0.137594f, -0.123189099f,
+    0.189628541f, 0.110939741f, -0.0373195186f, 0.0698193088f,
+    0.134117454f, 0.139706701f, -0.0914388821f, -0.0208388008f,
+    0.12596482f, 0.0863836929f, 0.218620136f, 0.359093994f,
+    -0.0584592558f, -0.163072005f, 0.0804262385f, -0.0907278806f,
+    -0.108942971f, 0.0910166577f, 0.108509749f, 0.202872783f,
+    0.0498222746f, -0.0912165791f, 0.130202368f, 0.0888753086f,
+    -0.146601215f, -0.167582452f, 0.20688203f, 0.12110164f,
+    -0.0158005338f, -0.00532380445f, -0.276541799f, 0.244635463f,
+    -0.398101896f, -0.070113346f, -0.0230102744f, 0.0727476627f,
+    -0.32595998f, -0.263668805f, -0.212584719f, -0.0149261868f,
+    -0.0881142989f, 0.0595093369f, 0.116931759f, 0.150667831f,
+    -0.243885323f, 0.0722429454f, -0.0482307151f, 0.0309280846f,
+    0.0653401315f, -0.3049936f, 0.150246173f, -0.207131371f,
+    -0.140624791f, -0.0471206531f, 0.296492428f, 0.014151779f,
+    0.193871379f, -0.0305027273f, 0.106767759f, -0.0309795514f,
+    -0.0546120107f, -0.280178517f, -0.096777305f, 0.222704202f,
+    0.0611319765f, 0.00925947726f, -0.255212367f, 0.0568295158f,
+    0.104347363f, 0.101315588f, 0.0982890353f, 0.0770584196f,
+    0.0291872527f, -0.0512689836f, -0.251236916f, 0.104232863f,
+    0.297402173f, 0.101340078f, -0.257526904f, -0.214822486f,
+    -0.177443564f, -0.0730763823f, 0.0733376071f, 0.207237989f,
+    -0.00104495324f, -0.205428123f, -0.0494896285f, -0.122521147f,
+    0.00585919386f, 0.113494299f, -0.200135157f, -0.109227747f,
+    0.0351672806f, 0.36735329f, 0.00166735938f, 0.0292910486f,
+    -0.0507296696f, 0.124325939f, 0.0825546831f, 0.135921866f,
+    -0.0281621274f, -0.1872067f, 0.0316316858f, -0.144946411f,
+    -0.0545043722f, -0.0806030408f, -0.125273347f, -0.400721163f,
+    -0.135360017f, -0.125056162f, -0.095043987f, 0.153575599f,
+    0.137055263f, 0.0676102564f, -0.196121261f, -0.0971510038f,
+    0.156998172f, -0.207699031f, -0.152704522f, 0.016632352f,
+    -0.156781331f, 0.162168071f, 0.174376652f, 0.0508075617f,
+    0.133572012f, 0.0981586874f, 0.290578097f, -0.0549551994f,
+    0.0241104178f, 0.138416231f, 0.0454374626f, 0.148774058f,
+    0.173321575f, 0.166511208f, -0.0327815339f, -0.0722854808f,
+    -0.0649283454f, 0.113438904f, 0.185335666f, 0.0264612287f,
+    0.139629528f, -0.116449863f, 0.0620345995f, -0.0507964604f,
+    0.119657196f, 0.102988645f, 0.12332397f, -0.197622001f,
+    -0.111899875f, -0.163121f, -0.0673775002f, -0.00958564784f,
+    -0.259075373f, 0.0501786619f, -0.0178585146f, -0.193917021f,
+    -0.214298189f, 0.0818051547f, 0.0397566892f, -0.0550782271f,
+    0.0823798627f, 0.103378125f, 0.139394194f, -0.407586098f,
+    -0.0098785013f, 0.00765728066f, -0.285752326f, -0.35967654f,
+    -0.190415174f, 0.00151588256f, -0.0323972106f, 0.175770506f,
+    0.197182879f, -0.210289329f, -0.0506505072f, 0.0486384481f,
+    0.0433555022f, 0.154348046f, 0.266595215f, 0.219697073f,
+    -0.164642364f, 0.0507509895f, 0.064247258f, 0.0890164375f,
+    0.0273049828f, -0.184724331f, 0.0955012664f, 0.0353211798f,
+    -0.281832784f, -0.00755814742f, -0.0497188717f, -0.306962699f,
+    -0.185401574f, 0.232106924f, -0.12036673f, -0.142652541f,
+    -0.0606317334f, -0.0789223611f, 0.200873867f, 0.0373772718f,
+    -0.14759773f, -0.0664222017f, 0.29739517f, -0.158678576f,
+    -0.132764265f, -0.190215185f, 0.0601113774f, 0.120468557f,
+    -0.0174460504f, 0.291504651f, -0.0597091019f, 0.0591286123f,
+    0.208235219f, -0.124757446f, -0.0579227731f, -0.0138509311f,
+    0.0886464417f, -0.251285821f, -0.0494382307f, -0.149969622f,
+    -0.291490346f, -0.0579907f, -0.050582394f, 0.00327240746f,
+    -0.063145183f, 0.00307322852f, -0.343564898f, 0.040073134f,
+    0.308428317f, 0.0219055079f, 0.151529714f, -0.00833817571f,
+    0.0969468951f, -0.0403674208f, -0.172157183f, 0.0937500969f,
+    0.294230074f, 0.0901374444f, 0.207963064f, -0.169407591f,
+    -0.0351979733f, -0.0652359799f, -0.2348838f, -0.0212993249f,
+    0.19334878f, -0.174336091f, -0.0629092902f, 0.101569727f,
+    -0.0705037862f, 0.111393005f, 0.116516732f, -0.0633685514f,
+    0.0617945455f, 0.212638825f, 0.0701872706f, -0.115685672f,
+    0.0426045656f, 0.102105446f, 0.041508697f, 0.268864065f,
+    -0.0980535895f, -0.239004418f, -0.0877481177f, -0.0813862607f,
+    -0.267532825f, -0.210560948f, 0.00450993748f, 0.0224936325f,
+    -0.0823601112f, -0.102084555f, 0.143696219f, -0.0873380378f,
+    0.167242482f, 0.243999928f, -0.0998712778f, 0.0285749733f,
+    -0.252033114f, -0.13498354f, 0.367875576f, 0.0934241191f,
+    0.124823943f, 0.101194844f, -0.0591906346f, -0.371415764f,
+    -0.309140533f, 0.169665486f, 0.198867813f, 0.216718197f,
+    0.0820787847f, 0.147491395f, 0.200717822f, 0.249377474f,
+    -0.0841373578f, 0.206567734f, 0.199872017f, 0.000519905647f,
+    -0.131796494f, -0.0335899144f, 0.102531992f, -0.176280111f,
+    -0.424541563f, 0.020609498f, 0.156465441f, -0.0770570785f,
+    -0.0954874977f, -0.152910247f, -0.0986728519f, -0.166769087f,
+    0.0272842329f, -0.179815009f, 0.00825968757f, 0.401032865f,
+    -0.204942062f, -0.186270207f, 0.0975220352f, -0.0190539956f,
+    -0.0518681854f, -0.0824043155f, -0.20333086f, -0.151760623f,
+    0.194413871f, 0.100905605f, -0.0794643238f, 0.0142672257f,
+    -0.455596596f, -0.205636039f, -0.164886579f, -0.111243844f,
+    -0.021870587f, 0.0865412876f, 0.240549028f, 0.0955080241f,
+    -0.209579155f, -0.0699981228f, 0.0178348888f, 0.0584938452f,
+    0.010550309f, 0.180988535f, -0.166726321f, -0.322259158f,
+    -0.0801521391f, -0.151088655f, -0.312770039f, -0.408388793f,
+    -0.127843142f, -0.389041454f, -0.027762251f, -0.0608055554f,
+    0.123245955f, 0.231351644f, -0.212118998f, -0.0126376105f,
+    0.0785819963f, 0.0893600881f, -0.00668805139f, 0.230526149f,
+    -0.230085582f, 0.115472831f, 0.175953135f, 0.00390905701f,
+    -0.138887197f, -0.226848766f, 0.0291876271f, 0.0784207508f,
+    0.30507049f, -0.235503972f, -0.18447645f, 0.0720794797f,
+    0.0127975838f, -0.0599711798f, 0.197053656f, 0.234227583f,
+    -0.00707045151f, -0.277069598f, -0.150382981f, 0.133415803f,
+    0.104462698f, 0.141738191f, -0.0253216103f, 0.133737639f,
+    -0.0215377901f, -0.163903803f, -0.38323307f, -0.39000532f,
+    0.181667492f, -0.170296565f, -0.00978392269f, 0.0505273044f,
+    -0.0117064836f, -0.169911459f, -0.413370818f, 0.0207269788f,
+    -0.286393136f, 0.0477455109f, -0.0213432424f, 0.0380509607f,
+    -0.00675019063f, 0.170219421f, 0.0656806007f, 0.11505916f,
+    0.117810413f, 0.411058992f, -0.0405477472f, 0.0543656461f,
+    -0.201434597f, -0.0260686949f, 0.0650976822f, 0.235531524f,
+    -0.0562452562f, 0.108072676f, 0.132266983f, 0.0716893896f,
+    0.136709526f, 0.189225942f, -0.0535600632f, 0.015261136f,
+    -0.109786823f, -0.104437284f, 0.0910740569f, -0.173349291f,
+    0.0155788446f, -0.0929904059f, -0.0203925557f, -0.215164453f,
+    -0.0784687102f, 0.00715358788f, -0.318175852f, -0.187733069f,
+    -0.0297903009f, 0.396431297f, 0.0671678111f, -0.0242030229f,
+    0.0644966885f, 0.28254962f, -0.0183124393f, -0.226062611f,
+    -0.0483827665f, -0.137364551f, 0.00609384058f, 0.201064572f,
+    -0.251341045f, -0.0258946456f, 0.0257130954f, -0.0438671783f,
+    0.0935732275f, -0.0570230074f, 0.0621772036f, -0.172643572f,
+    0.00367673486f, -0.059265852f, -0.417048097f, -0.143065259f,
+    -0.0655528158f, -0.096650809f, -0.0637479126f, 0.124808468f,
+    0.114431448f, 0.052220691f, -0.236334026f, -0.0311058369f,
+    -0.0766039938f, -0.185312241f, -0.102301896f, -0.252734631f,
+    0.257409632f, -0.00279222219f, -0.123609163f, 0.0708158612f,
+    -0.307988614f, 0.029098032f, -0.0900637209f, 0.140353516f,
+    0.21677193f, 0.247305229f, 0.222790137f, 0.0415713824f,
+    -0.00172417413f, 0.0208721422f, 0.169856235f, 0.222192377f,
+    0.071965903f, -0.390379012f, 0.126713961f, 0.114541382f,
+    0.051102858f, 0.116553701f, -0.210271999f, -0.169735298f,
+    0.125892833f, -0.124247663f, -0.2071926f, -0.158897623f,
+    -0.0144312698f, -0.0426074974f, -0.460772812f, -0.143591613f,
+    -0.432648778f, -0.0318465158f, -0.0463893749f, 0.256735742f,
+    -0.20693177f, -0.536976099f, -0.469335079f, -0.425409526f,
+    0.193389103f, 0.130332872f, 0.162230909f, 0.188745975f,
+    -0.0265800543f, 0.106530026f, 0.239328206f, 0.15364866f,
+    0.134837225f, 0.0467174761f, 0.0826822147f, -0.153893977f,
+    -0.0418707691f, -0.246955484f, -0.017603904f, -0.0818747133f,
+    -0.0760698095f, -0.101462014f, -0.352103025f, 0.0684397891f,
+    -0.0564437993f, -0.0419316366f, 0.127580747f, 0.192024797f,
+    0.0807487443f, -0.0056202691f, 0.0851420239f, -0.285759389f,
+    0.0872123912f, 0.025821615f, 0.0716410577f, -0.289679945f,
+    0.123770922f, -0.022436684f, -0.26188454f, -0.00129754562f,
+    -0.0105160195f, 0.0300955251f, -0.299978167f, -0.352632135f,
+    -0.238755539f, -0.26779753f, -0.259431452f, -0.000133078036f,
+    0.13939628f, 0.53042537f, 0.247641966f, -0.0531923696f,
+    0.0465511978f, 0.124857038f, -0.00454386976f, 0.346836627f,
+    0.093700029f, -0.170761257f, -0.0966040716f, -0.111783825f,
+    -0.0237643234f, 0.3474181f, -0.00112568086f, 0.100159697f,
+    -0.37278071f, -0.113061428f, -0.0622606799f, -0.0109209903f,
+    0.160486832f, 0.165638834f, 0.00763265835f, 0.124617748f,
+    -0.153204069f, 0.146449655f, 0.0599925518f, -0.0473114848f,
+    -0.0804097727f, 0.263458997f, 0.144106507f, -0.0249397326f,
+    -0.0143343974f, -0.152822554f, -0.417097658f, 0.0574611314f,
+    0.186475754f, -0.11613486f, -0.0714670196f, -0.329609066f,
+    0.0315618068f, -0.392123491f, -0.0740276501f, -0.0591313131f,
+    -0.278994381f, -0.193312809f, -0.0489195809f, 0.152166054f,
+    -0.721799254f, -0.621443272f, -0.439977437f, -0.0632158667f,
+    -0.0110791288f, 0.157489017f, 0.203313947f, -0.0310458001f,
+    -0.15765819f, -0.0803655908f, -0.147331774f, -0.189571381f,
+    -0.0283424966f, -0.254419208f, 0.0613216013f, 0.187240273f,
+    0.244174287f, 0.125603721f, -0.177539229f, -0.289637685f,
+    -0.13595973f, 0.294093519f, 0.27167663f, 0.191138655f,
+    -0.0632841364f, 0.0357156098f, -0.340712756f, -0.322051167f,
+    -0.118523911f, 0.0982280076f, 0.0205966923f, -0.148457542f,
+    -0.0295436531f, -0.147275448f, -0.340338886f, 0.111268446f,
+    -0.123727396f, -0.54606241f, -0.413360924f, -0.0261563733f,
+    -0.37765348f, 0.0223190729f, 0.247956172f, 0.300855428f,
+    0.126822054f, 0.0369448438f, -0.137647465f, -0.135559753f,
+    -0.221101329f, 0.108980358f, 0.104625829f, 0.0089371996f,
+    -0.127105385f, -0.0452243388f, -0.464068472f, -0.224070355f,
+    -0.00630061934f, -0.307590604f, -0.0844972059f, 0.159076527f,
+    -0.169725671f, -0.080318816f, -0.0960334167f, -0.0417514667f,
+    -0.00590370735f, 0.0536667407f, -0.27354303f, 0.0717500001f,
+    -0.129757062f, -0.10453666f, -0.17501843f, -0.0781021342f,
+    -0.326965332f, -0.0669362321f, 0.0843802541f, 0.0379542299f,
+    -0.224688739f, -0.0546465404f, -0.260027856f, -0.0873566866f,
+    -0.13392897f, -0.0299413931f, 0.146058664f, 0.242992386f,
+    0.0657473281f, -0.14659214f, -0.120494165f, -0.274823576f,
+    -0.0683103129f, -0.136385381f, -0.120445073f, -0.0999800861f,
+    -0.199315265f, -0.0723683015f, 0.283011526f, 0.103544049f,
+    -0.200852647f, -0.0618882105f, -0.0148595171f, -0.117020376f,
+    0.0875040144f, 0.168731973f, -0.0380955227f, -0.317946434f,
+    -0.114960223f, -0.226278439f, 0.0159774367f, -0.0421073101f,
+    -0.210668415f, -0.0452584215f, -0.103183232f, -0.0513022095f,
+    -0.146548659f, -0.362567335f, 0.0584530048f, 0.00893700402f,
+    -0.333044857f, -0.205112547f, 0.023560429f, -0.0496531315f,
+    -0.403349489f, -0.218410522f, -0.182769656f, -0.104129672f,
+    -0.0560225397f, -0.0725544244f, -0.270933956f, -0.0847767368f,
+    -0.196742222f, -0.258923382f, -0.00438672304f, -0.0135482447f,
+    -0.326458454f, -0.0211785659f, 0.0329964198f, -0.165746823f,
+    -0.120314799f, 0.0467022099f, 0.103176102f, -0.161133811f,
+    -0.00308395224f, -0.150775969f, 0.0257641133f, 0.270797461f,
+    0.305482626f, -0.14254345f, -0.222408921f, 0.129187942f,
+    0.239028394f, -0.0206352044f, 0.0081482958f, 0.311390162f,
+    -0.327328771f, 0.0937522501f, 0.00462481473f, 0.0340575427f,
+    -0.0278243665f, -0.0190009773f, 0.16938591f, -0.346109241f,
+    -0.0406798199f, 0.0553454943f, -0.352787465f, -0.176876321f,
+    0.00195195759f, 0.0430293642f, -0.233969629f, -0.178243637f,
+    -0.0719540864f, 0.317263305f, -0.104951702f, -0.0316163413f,
+    -0.0370970517f, -0.10660848f, -0.0245599169f, -0.264509648f,
+    -0.0598134734f, 0.150598601f, 0.174855649f, -0.0199327376f,
+    0.0972073078f, 0.218032196f, 5.44771538e-05f, 0.194088355f,
+    0.0185109191f, -0.389225155f, 0.133356899f, 0.126951024f,
+    0.251789361f, -0.216881588f, 0.08785896f, -0.0829003751f,
+    0.165576309f, 0.000899663777f, -0.0560752563f, 0.254862845f,
+    0.0490442589f, -0.0706219599f, -0.016026862f, -0.294703513f,
+    -0.610686958f, 0.211769447f, -0.486940861f, 0.263420135f,
+    0.00490932027f, 0.149320453f, 0.305252671f, -0.0289925691f,
+    0.0941397026f, -0.00776019879f, -0.177184507f, -0.266599178f,
+    -0.0222185776f, 0.0919484198f, -0.281753808f, -0.185243905f,
+    0.316996276f, 0.315539956f, 0.077140063f, 0.209829092f,
+    0.153812081f, 0.0171055403f, 0.101521738f, 0.174785957f,
+    0.198575348f, 0.0752234608f, -0.025663862f, -0.162736237f,
+    -0.0773004517f, -0.119144373f, -0.214741781f, 0.0141220205f,
+    0.271345913f, 0.088283591f, 0.13422586f, 0.0635315254f,
+    0.235146016f, 0.0193379149f, -0.138510168f, 0.0566815101f,
+    0.143166855f, -0.0119346995f, -0.143229738f, -0.153624624f,
+    -0.070918709f, -0.0196823683f, -0.175539762f, -0.133343428f,
+    0.212360218f, -0.103546701f, -0.0617464148f, 0.0948139206f,
+    -0.160723716f, -0.228890315f, -0.286768436f, 0.0229630377f,
+    0.0908624753f, 0.221865982f, -0.0190582257f, -0.0524117835f,
+    0.12477681f, -0.0174427591f, -0.135123357f, 0.205711991f,
+    0.217440411f, 0.142657235f, -0.0824003369f, 0.0335177556f,
+    0.0621895678f, 0.076381214f, 0.0329218283f, -0.244646057f,
+    -0.145950928f, -0.131668776f, -0.00442474522f, -0.125403807f,
+    0.202286795f, -0.00461692689f, 0.244488999f, 0.163438469f,
+    -0.0832928121f, 0.0936012641f, -0.230356663f, -0.226249725f,
+    -0.0735202804f, -0.258013278f, -0.310727268f, -0.122207649f,
+    -0.175478116f, -0.0608021468f, 0.159462959f, -0.119891688f,
+    -0.0708721951f, -0.554445028f, -0.441867232f, 0.201524019f,
+    0.269189209f, -0.0170561224f, 0.0196351912f, -0.108114153f,
+    -0.113690719f, -0.0150655005f, 0.118632369f, 0.326329648f,
+    0.0639526993f, 0.0893569589f, -0.19185932f, -0.0403280668f,
+    0.255803406f, -0.0404174402f, 0.0650758147f, 0.0707501099f,
+    -0.0655657873f, -0.215209112f, -0.0770718306f, 0.179961771f,
+    -0.194987491f, -0.142142832f, 0.025577724f, 0.0726385042f,
+    -0.156852692f, 0.238925561f, -0.0512438975f, 0.036473684f,
+    -0.0810890198f, 0.234080851f, -0.0200473145f, -0.0479655713f,
+    -0.25776723f, -0.162250489f, -0.0740220174f, 0.00725299912f,
+    -0.187930986f, -0.109137364f, 0.07626874f, 0.134282857f,
+    0.109189928f, 0.270008624f, 0.169136867f, 0.0886116922f,
+    0.0634536371f, 0.0639407858f, 0.140195489f, 0.134091094f,
+    0.0121754007f, -0.2737903f, 0.0736334547f, -0.0629090592f,
+    -0.00846115686f, -0.0441204906f, -0.299951434f, -0.340389132f,
+    0.19986999f, 0.0113929994f, 0.100561664f, -0.173146471f,
+    -0.427182913f, -0.290418535f, -0.0290949456f, -0.0135987336f,
+    -0.0232650563f, -0.431738883f, -0.251542211f, -0.335159361f,
+    -0.113341153f, 0.0133883329f, 0.175945923f, -0.147641331f,
+    -0.0135574434f, -0.0974116474f, -0.799569845f, -0.148967817f,
+    0.0271077119f, 0.0114252055f, -0.365497977f, -0.113240033f,
+    -0.258322805f, -0.199436158f, -0.0656389147f, -0.0333021767f,
+    0.00791521277f, 0.0268797074f, 0.121248148f, -0.234662533f,
+    -0.00768275326f, 0.120637082f, 0.245066226f, -0.00936462823f,
+    0.00180401001f, -0.230367735f, 0.124665923f, 0.0766334459f,
+    -0.146872029f, -0.0620719641f, 0.0698768273f, 0.187525779f,
+    -0.0469424427f, -0.300315976f, -0.0101534827f, -0.253325075f,
+    -0.255819768f, 0.0902178213f, 0.265660375f, -0.0345149785f,
+    0.0954461619f, 0.214212582f, 0.0898248851f, -0.0348445028f,
+    0.164395452f, 0.15403223f, -0.242165849f, -0.187779412f,
+    0.0129889445f, -0.0683637261f, -0.529276848f, -0.223924652f,
+    -0.0934525579f, -0.348608792f, 0.0542347357f, 0.0146051496f,
+    -0.22047399f, -0.129145101f, 0.0924645439f, 0.0602345057f,
+    0.13943477f, 0.0507573299f, 0.0812972337f, 0.199819371f,
+    -0.107078828f, -0.243281201f, -0.0982699767f, -0.00255365064f,
+    -0.238948673f, -0.100649856f, -0.0104759149f, -0.106533453f,
+    -0.0316990241f, 0.261376739f, 0.128606215f, 0.40301159f,
+    -0.146448672f, -0.162592962f, 0.375953078f, -0.0459517762f,
+    -0.400016636f, -0.195864931f, -0.0925556347f, -0.154623494f,
+    -0.292410731f, -0.0421967432f, 0.0213189311f, 0.127407417f,
+    0.290677547f, 0.162693053f, 0.384031504f, 0.324193209f,
+    0.0838222727f, 0.289965928f, -0.00113771902f, 0.114537776f,
+    0.111278363f, -0.125442579f, -0.101030871f, -0.134259671f,
+    -0.154761836f, -0.166117534f, 0.0361454077f, -0.0706857443f,
+    -0.0568940528f, -0.112873204f, -0.23312436f, -0.264355749f,
+    -0.00016131952f, 0.439176708f, -0.188670501f, -0.0418489315f,
+    -0.240427881f, 0.0904816911f, -0.264655173f, 0.0418945551f,
+    0.0472378209f, 0.140952319f, 0.172917068f, 0.196593255f,
+    -0.0415782966f, -0.147685155f, -0.152745128f, -0.243497267f,
+    -0.398772985f, -0.323411107f, -0.228714377f, -0.218117326f,
+    0.013255178f, -0.176337004f, -0.38072148f, -0.251693934f,
+    -0.112038121f, 0.187831819f, 0.131035507f, -0.00148488954f,
+    -0.170589969f, -0.286769599f, -0.322912186f, -0.261642426f,
+    -0.150006488f, -0.127156034f, -0.177741364f, -0.23056522f,
+    -0.150720954f, -0.00497392891f, 0.238811627f, 0.205163091f,
+    0.0410631038f, 0.0870366171f, -0.208745077f, -0.377093822f,
+    0.0966981277f, -0.274908453f, -0.37799865f, -0.0804465264f,
+    0.150276199f, -0.114210889f, -0.0975786f, -0.272480637f,
+    -0.285468727f, -0.0294682011f, 0.116494104f, 0.190986037f,
+    0.179593995f, 0.190460935f, 0.226776958f, 0.0376631096f,
+    -0.0202486683f, -0.305599362f, 0.115998283f, 0.070509322f,
+    0.146482915f, 0.0873381793f, -0.0220237933f, -0.262881905f,
+    0.139795855f, 0.316520363f, -0.029681718f, 0.126818895f,
+    -0.663237393f, -0.139394999f, -0.0670218244f, -0.0807545036f,
+    -0.10072235f, -0.106428787f, -0.0752042681f, -0.156081066f,
+    0.0982579291f, -0.202209651f, -0.140398026f, 0.049646955f,
+    -0.182595968f, -0.187462196f, -0.00959065836f, 0.00727337087f,
+    0.133197621f, -0.0692309439f, 0.0521508045f, -0.210910901f,
+    -0.00916032214f, 0.204150707f, 0.0137105817f, -0.460503995f,
+    -0.13548632f, -0.0218368005f, -0.186614886f, 0.0399819575f,
+    -0.175133571f, 0.427653968f, 0.0772136003f, 0.0649266168f,
+    0.0138626816f, -0.210151106f, 0.0470805205f, 0.202492043f,
+    0.115220629f, 0.110322513f, -0.0641122535f, -0.155991331f,
+    -0.136307582f, -0.121355876f, 0.0584405735f, -0.09116932f,
+    -0.198059469f, -0.241458267f, -0.224013656f, -0.324617624f,
+    0.434998661f, 0.197051257f, 0.0408754423f, 0.0663664937f,
+    -0.0316418856f, 0.147595763f, 0.225709438f, 0.138741687f,
+    0.137462109f, 0.308090508f, 0.00478823483f, 0.0806505904f,
+    0.0102638537f, -0.027970504f, -0.258302182f, -0.0960216001f,
+    -0.148873717f, -0.00572490739f, -0.192458898f, -0.202712774f,
+    -0.163878605f, 0.0958181471f, 0.081821993f, -0.059959054f,
+    -0.0524934307f, -0.0836725682f, -0.104436144f, -0.158506393f,
+    0.0688658357f, -0.185308695f, 0.0179459043f, 0.224941418f,
+    -0.0294234511f, -0.0887813494f, -0.16308789f, -0.128315747f,
+    0.150778756f, 0.0452242196f, 0.306206465f, -0.0868012086f,
+    0.120591216f, 0.27371794f, -0.148807451f, -0.019670289f,
+    0.181633145f, 0.095900394f, 0.0582019389f, -0.136324301f,
+    -0.0119832885f, -0.0500909388f, -0.308197111f, 0.152989924f,
+    -0.150690511f, -0.400522232f, -0.0308256838f, 0.0317592062f,
+    -0.00898238178f, 0.152366847f, 0.0920128599f, -0.233025879f,
+    0.0452235378f, -0.180238277f, -0.032752987f, -0.157596797f,
+    -0.366525859f, 0.12923111f, -0.154363632f, 0.00851790886f,
+    -0.194379643f, 0.0629579201f, -0.278712332f, -0.0280309916f,
+    0.074059844f, 0.216330811f, -0.0403567776f, -0.0629509315f,
+    0.15482834f, 0.10373228f, 0.116772033f, -0.0151631199f,
+    -0.0138303125f, 0.212680951f, 0.180104434f, -0.077038385f,
+    -0.0112574324f, 0.146861091f, -0.00834804866f, 0.359000355f,
+    -0.0182542708f, -0.327731282f, -0.0250586011f, -0.365684539f,
+    0.166320473f, 0.122284569f, 0.13646777f, 0.121884614f,
+    0.146273836f, 0.241509974f, 0.151248485f, 0.0211125556f,
+    -0.0263455454f, -0.0781446025f, -0.300815791f, -0.0713808015f,
+    -0.214400426f, -0.00505145267f, -0.227078244f, 0.202802762f,
+    0.0164395012f, -0.0107932994f, -0.3668181f, 0.00470294617f,
+    0.199549675f, -0.144418538f, -0.121014327f, -0.234723717f,
+    -0.0915856883f, -0.0158297196f, -0.232680008f, -0.131176755f,
+    -0.0646004975f, -0.00693026744f, -0.0405721366f, -0.282696098f,
+    0.00797428563f, 0.131633386f, -0.0256630369f, 0.222178146f,
+    -0.28196004f, -0.297092378f, -0.0522986576f, 0.100331701f,
+    -0.0541272573f, -0.137858436f, -0.301438719f, -0.0954536349f,
+    -0.0216016639f, -0.225594372f, -0.167951331f, -0.00643246667f,
+    0.0310061108f, 0.379272252f, -0.0235071629f, -0.0676063746f,
+    -0.205084741f, 0.0741200298f, 0.185257822f, -0.0562587306f,
+    -0.593675554f, -0.24200885f, -0.0458691455f, 0.114798769f,
+    -0.0518646017f, 0.209095106f, -0.543718755f, -0.0658653378f,
+    -0.156727538f, -0.12210577f, 0.0163119007f, -0.153533578f,
+    0.0791954845f, 0.309242964f, 0.127590343f, 0.0862686262f,
+    -0.304579258f, -0.0326346122f, 0.0256217495f, 0.0897907615f,
+    0.235922411f, 0.444468677f, 0.0817189589f, 0.0242792089f,
+    0.260571808f, 0.170074373f, -0.0407056212f, -0.106788598f,
+    -0.295374811f, -0.00515493751f, -0.0967004001f, 0.156282112f,
+    -0.0937064812f, 0.00738553889f, -0.434790671f, -0.260389656f,
+    -0.135618299f, -0.090743266f, 2.60894049e-05f, 0.160981923f,
+    0.0490614325f, 0.276489288f, 0.102245621f, -0.0109865572f,
+    0.0032078817f, 0.232255921f, 0.233606622f, -0.0654026121f,
+    -0.682878196f, 0.0568002388f, -0.104984589f, 0.0466785319f,
+    0.0301142763f, 0.22831212f, 0.192105576f, -0.150405213f,
+    0.305152476f, 0.296254784f, 0.0339772366f, 0.203421146f,
+    0.059705548f, 0.0396249257f, -0.153269678f, 0.168713301f,
+    0.417069554f, -0.0666376352f, -0.0233183205f, 0.100574337f,
+    -0.0621120892f, -0.109808676f, 0.136091426f, 0.0931668803f,
+    -0.0355275944f, -0.124592088f, 0.2580764f, -0.0195893887f,
+    -0.105817184f, -0.269244015f, -0.029687237f, -0.347072452f,
+    -0.143599629f, -0.169902146f, -0.0515294224f, -0.250461966f,
+    0.265994996f, 0.131554142f, -0.331084281f, -0.365120828f,
+    0.0295165665f, -0.245476067f, -0.124456584f, 0.0660240874f,
+    0.00325006619f, -0.0149014527f, -0.286757648f, -0.0961615592f,
+    -0.111681312f, -0.0807759166f, -0.143817395f, -0.0749589428f,
+    0.0367134251f, -0.2673783f, -0.0934577137f, 0.141435221f,
+    0.0952235609f, 0.00860053487f, 0.353652745f, 0.251096457f,
+    -0.0656390637f, -0.235320255f, 0.268551081f, -0.0423786752f,
+    0.138295442f, 0.250548929f, -0.0721881911f, 0.0301252287f,
+    0.208924204f, 0.151198179f, 0.0489896536f, 0.164217576f,
+    -0.187343538f, -0.238971546f, -0.213854328f, -0.233948037f,
+    -0.0595312826f, -0.190263763f, 0.139393404f, 0.0590655319f,
+    0.159637332f, 0.125001609f, 0.0810678974f, 0.131388366f,
+    0.126232818f, 0.104009174f, -0.0160081405f, 0.404243857f,
+    -0.119089738f, 0.175369248f, 0.191584066f, 0.0474515408f,
+    0.0775329992f, 0.299042583f, 0.0941548645f, 0.255535513f,
+    -0.0011982565f, 0.183511227f, -0.350385964f, -0.188246369f,
+    -0.212368608f, 0.122465357f, -0.153129369f, -0.0800248608f,
+    0.0290562399f, 0.0834424645f, -0.0536915585f, -0.375816703f,
+    0.0598915033f, 0.0771420524f, 0.253665f, 0.203250065f,
+    0.157110438f, 0.111598812f, -0.095346272f, -0.159267142f,
+    -0.101786084f, -0.381443441f, -0.677658737f, 0.19609569f,
+    0.0860020667f, 0.0856446624f, -0.245517239f, 0.161148787f,
+    0.105713725f, 0.136825517f, 0.143066689f, -0.490064949f,
+    -0.104271986f, -0.122572526f, -0.0198966172f, -0.203124136f,
+    0.0517765805f, -0.264956951f, -0.026550252f, -0.14610289f,
+    -0.164680228f, 0.106286973f, -0.182278901f, -0.115069151f,
+    -0.0516770557f, -0.141433895f, 0.0832166374f, -0.211191237f,
+    0.200636655f, -0.396115541f, 0.0187818054f, 0.031838268f,
+    0.156281531f, 0.138453171f, -0.0126586072f, -0.253394067f,
+    -0.140244916f, -0.166523427f, -0.416272044f, -0.227632031f,
+    -0.0331465304f, -0.078307122f, -0.261566669f, 0.0337194614f,
+    0.145284489f, 0.174006879f, 0.0248354524f, -0.114403747f,
+    -0.0547353476f, 0.194075227f, -0.18853946f, -0.0923340246f,
+    -0.0674566999f, -0.00836955477f, -0.0962866545f, 0.244605124f,
+    0.255254447f, 0.101929933f, -0.0206308458f, -0.0168271977f,
+    -0.0186951682f, 0.18459174f, 0.149763599f, -0.314635515f,
+    -0.0454187915f, 0.186826184f, 0.0588567033f, 0.194660842f,
+    0.0915147737f, 0.232103124f, -0.192475602f, 0.0700729415f,
+    -0.0269408654f, 0.182745486f, 0.179776862f, 0.290415496f,
+    -0.102295563f, 0.318827957f, 0.213779747f, 0.0780150294f,
+    -0.0654914901f, -0.0545441769f, -0.291630805f, 0.0906934962f,
+    -0.0879834071f, -0.184485242f, -0.0536344424f, -0.176082924f,
+    -0.0282773282f, -0.0564310551f, -0.310005456f, -0.349212646f,
+    0.147265181f, 0.27153486f, 0.0150099481f, -0.155425549f,
+    -0.00952816196f, -0.0822501853f, 0.262850165f, -0.194131985f,
+    0.0752007887f, 0.303799659f, 0.0036975469f, -0.137932479f,
+    -0.27874878f, -0.350543529f, -0.0695600584f, -0.0941696167f,
+    0.205042258f, -0.052827917f, -0.142940551f, -0.227278471f,
+    -0.0831614062f, 0.121737607f, -0.0180388521f, -0.164837986f,
+    -0.186173648f, -0.0872884467f, -0.257486343f, -0.189514026f,
+    0.0469094329f, -0.0303383395f, 0.124489717f, -0.325363338f,
+    -0.17663303f, -0.0570943169f, -0.125846297f, 0.174064949f,
+    0.0175069738f, -0.133889362f, 0.217743635f, -0.0629538074f,
+    -0.0839166641f, -0.292872488f, 0.0192648768f, -0.00581127591f,
+    -0.0964940339f, 0.0135002425f, -0.407471389f, 0.0462441295f,
+    0.0103614619f, 0.240334094f, 0.0358270966f, -0.266748756f,
+    0.0910360441f, -0.266238153f, 0.0415818579f, -0.00607595732f,
+    -0.13711527f, 0.132379591f, 0.278704286f, 0.0298467875f,
+    0.0376078673f, 0.260728329f, -0.156539008f, 0.242006958f,
+    0.160333887f, 0.0819211304f, -0.0214384049f, -0.238538653f,
+    0.0221059173f, -0.0863400996f, -0.575358927f, 0.109653562f,
+    -0.174695954f, -0.186144859f, -0.443247348f, -0.158841267f,
+    0.118700594f, -0.21198073f, -0.0441878177f, 0.0334787257f,
+    -0.092475377f, 0.288264364f, -0.050698217f, 0.00904421974f,
+    0.00109046535f, -0.233185545f, -0.340011269f, -0.0996747985f,
+    0.210236654f, 0.15852797f, -0.00588933006f, -0.0726763383f,
+    -0.274923831f, -0.0700718313f, 0.0671702102f, 0.0490370505f,
+    -0.0565484278f, 0.207468271f, 0.0895547271f, 0.128575817f,
+    -0.22733666f, 0.0665380359f, -0.0921982303f, -0.250946105f,
+    -0.0544759817f, -0.0750167295f, -0.108955741f, 0.171893477f,
+    0.119372919f, 0.14351736f, -0.135202378f, 0.299872369f,
+    -0.161476284f, 0.172593206f, 0.182895526f, 0.0348522477f,
+    -0.180791184f, -0.0295432322f, -0.299140841f, 0.0737280995f,
+    0.495905757f, -0.099612467f, -0.147164166f, -0.00568297831f,
+    0.0136920977f, -0.00834907219f, 0.226817578f, 0.244162127f,
+    0.236170188f, 0.281253934f, 0.00210743281f, -0.0413787365f,
+    0.0975223929f, 0.134145603f, -0.199341476f, -0.0624648184f,
+    -0.180666134f, -0.225693211f, -0.211650148f, -0.00200914335f,
+    0.129578575f, -0.0474416837f, -0.157113314f, -0.0812519863f,
+    0.032024648f, 0.018424375f, -0.192333862f, -0.241391286f,
+    -0.0883853436f, 0.214981958f, 0.0852929726f, 0.127319604f,
+    -0.0203419793f, 0.170407265f, -0.0265352633f, -0.26701197f,
+    -0.0973081142f, 0.156863675f, -0.0747003257f, -0.119520053f,
+    0.244925708f, 0.00454082666f, 0.151428178f, -0.130699694f,
+    -0.25956437f, -0.072169885f, 0.151452735f, -0.0019181259f,
+    -0.00280899066f, -0.278954297f, -0.0690362155f, -0.0952801704f,
+    -0.155501172f, -0.125908956f, -0.1284284f, -0.0598848499f,
+    -0.0549663752f, -0.169435263f, -0.061330311f, -0.116130657f,
+    -0.073936522f, -0.0181537978f, -0.244301125f, 0.278274745f,
+    0.142566517f, -0.0784954578f, 0.266718239f, 0.126476765f,
+    0.0246133804f, 0.0203373041f, 0.0912580937f, 0.32902202f,
+    -0.0154469972f, 0.119054347f, 0.1960354f, 0.0772702545f,
+    -0.0598471612f, -0.044864554f, -0.396436423f, -0.207251549f,
+    0.0197122861f, -0.292543828f, 0.0943453908f, -0.00804306287f,
+    -0.242320642f, -0.205377698f, -0.159476653f, 0.0463947728f,
+    0.135534331f, 0.0960631892f, 0.134193674f, -0.0563186295f,
+    -0.0240565073f, 0.121077649f, -0.00954941567f, 0.270140886f,
+    0.190613315f, 0.0598388463f, -0.172858462f, 0.092566587f,
+    -0.035183467f, -0.097821869f, 0.00408535358f, -0.327954203f,
+    0.324450731f, -0.0580652356f, -0.129282877f, 0.0410536081f,
+    0.190163016f, 0.0447798148f, -0.26240176f, 0.0689139068f,
+    -0.0719137117f, 0.0884213001f, 0.106082618f, 0.296832651f,
+    0.118225083f, 0.204140827f, -0.0338583812f, 0.0562800355f,
+    0.149913043f, 0.149482876f, 0.279946566f, -0.344296843f,
+    -0.0098521281f, 0.00203201151f, -0.0892823637f, -0.471886635f,
+    -0.0291103013f, 0.0657353997f, -0.0140190497f, -0.311261386f,
+    -0.0522335581f, -0.190719888f, -0.0182889681f, -0.259934098f,
+    -0.0349175893f, -0.227592692f, -0.69699496f, 0.14796707f,
+    0.0233553182f, 0.0962504223f, -0.10248585f, 0.257130563f,
+    -0.11461629f, 0.155456483f, 0.280637354f, 0.096532546f,
+    0.0908406898f, 0.171894729f, -0.0562742092f, 0.139653265f,
+    -0.213579893f, -0.0194957312f, -0.291857213f, 0.00647014519f,
+    -0.302256316f, -0.518519878f, -0.0796101019f, 0.226533636f,
+    0.0227518659f, 0.298032254f, 0.13923721f, 0.00864273775f,
+    -0.0469103344f, -0.198631272f, 0.117502905f, 0.0273067467f,
+    0.131278649f, 0.0956861675f, 0.108058371f, -0.093735449f,
+    -0.133685872f, 0.212510005f, 0.0472367965f, 0.0516914576f,
+    0.169763178f, -0.0847980902f, 0.121850058f, -0.0685370639f,
+    0.270831376f, -0.0200841501f, 0.103495404f, -0.162751675f,
+    -0.241296172f, -0.497110188f, -0.0636092424f, -0.124452591f,
+    -0.0742449909f, 0.0245921835f, 0.165186107f, 0.191398144f,
+    0.115813695f, 0.00923180021f, -0.0187037382f, -0.290521175f,
+    -0.480436772f, 0.103192061f, 0.138604611f, 0.0440414809f,
+    0.0310870036f, -0.0143162729f, -0.103803404f, -0.256103605f,
+    0.122021072f, -0.0426109657f, -0.345711589f, -0.241350412f,
+    0.0185272433f, 0.161075547f, 0.288756043f, -0.00593981333f,
+    -0.0557305925f, -0.09564583f, -0.0919111222f, -0.1774441f,
+    -0.25849086f, -0.256999582f, 0.0291645732f, 0.00610945327f,
+    -0.0590146109f, 0.23353757f, 0.137337059f, 0.00495504215f,
+    -0.0895036981f, 0.0172037594f, -0.585680008f, 0.00634704251f,
+    -0.193108648f, -0.130964354f, 0.175629228f, -0.0732770711f,
+    -0.0300983861f, 0.154074326f, 0.184381619f, 0.0495095626f,
+    0.292215377f, 0.101260893f, -0.0969696641f, 0.0412606969f,
+    -0.101806104f, 0.0783363655f, 0.00644575199f, -0.213747993f,
+    -0.29712823f, 0.00981396344f, -0.131095678f, 0.0290397424f,
+    0.188807949f, 0.158838078f, 0.097327657f, 0.00417415425f,
+    -0.013599731f, 0.103013232f, 0.0262219459f, -0.29939729f,
+    -0.296329886f, 0.182884321f, 0.0764533654f, 0.0218490642f,
+    -0.303388506f, 0.0542841591f, 0.0139422715f, 0.144857287f,
+    0.250739157f, 0.167039722f, -0.0125469686f, 0.0278412793f,
+    0.0389674716f, 0.110918403f, 0.507659614f, 0.408009589f,
+    0.165189698f, 0.0386753306f, 0.0961380079f, -0.116879545f,
+    -0.00843706541f, -0.0659274161f, 0.292313129f, 0.190895364f,
+    -0.185923129f, 0.190684199f, -0.020521326f, 0.0114087686f,
+    -0.120196611f, 0.0628057495f, -0.148944855f, 0.0646294951f,
+    -0.122051798f, -0.248357028f, -0.315966189f, -0.242970049f,
+    -0.184734106f, -0.010786348f, -0.165642053f, 0.0411958881f,
+    -0.0978352502f, -0.130504489f, 0.134169891f, -0.036012657f,
+    -0.165439919f, -0.0568248294f, 0.126762822f, 0.344656408f,
+    0.146476567f, 0.404980332f, -0.0997666046f, 0.080154188f,
+    0.0989281833f, -0.115547813f, 0.105003826f, -0.441364169f,
+    0.179343686f, -0.1173499f, -0.0738465264f, 0.153796941f,
+    -0.0515714251f, -0.158766046f, -0.115442291f, -0.0842311084f,
+    0.0861568078f, -0.149412826f, -0.092260316f, -0.34315902f,
+    -0.152862027f, 0.00809261762f, -0.246844187f, 0.0772105604f,
+    -0.00416821335f, 0.134020969f, 0.190786406f, -0.180544391f,
+    -0.0896980464f, -0.1122711f, -0.0957779586f, 0.051777076f,
+    0.104129441f, -0.160805643f, -0.263317823f, -0.160483897f,
+    -0.0832180306f, 0.112404481f, 0.113600969f, 0.0216318462f,
+    -0.169762373f, -0.00910506584f, -0.140568569f, -0.126426637f,
+    0.0331511535f, 0.11396569f, 0.0370195657f, -0.193978459f,
+    -0.0976836532f, -0.0982611105f, -0.0346919149f, -0.21059452f,
+    0.110989437f, -0.243344188f, 0.00192703551f, -0.260818213f,
+    0.172144115f, -0.0122053782f, -0.101746313f, -0.106527455f,
+    -0.0619688109f, -0.19637993f, -0.320141852f, 0.0910976455f,
+    -0.0285978485f, -0.136940897f, -0.169530049f, -0.195887819f,
+    0.0841922462f, 0.0993081033f, 0.0293056406f, 0.192470908f,
+    0.213583753f, 0.200380132f, 0.136684999f, -0.0315151811f,
+    -0.0538166612f, 0.282880068f, -0.0913293362f, 0.11400868f,
+    -0.157362625f, 0.00333405309f, 0.351957768f, -0.0236642305f,
+    -0.077536799f, -0.186422512f, 0.103337154f, 0.183629155f,
+    -0.0972625017f, -0.131401256f, -0.0278322473f, -0.150096118f,
+    0.113533244f, -0.188185826f, -0.176418319f, -0.0291231982f,
+    -0.124270894f, -0.104026072f, 0.0262408927f, 0.127725139f,
+    -0.085596472f, -0.106863253f, -0.151278138f, -0.0742545351f,
+    -0.0783438459f, -0.0805264711f, -0.00158059795f, -0.203264162f,
+    -0.0387039855f, 0.0629525408f, 0.085827969f, 0.158126697f,
+    -0.0308185611f, 0.105617322f, 0.175236806f, -0.266243398f,
+    0.0269592963f, 0.153870225f, 0.313884854f, 0.113887087f,
+    0.105976455f, -0.44623965f, -0.533202827f, -0.0225442257f,
+    -0.351866454f, -0.0756773278f, 0.00253653852f, -0.112252422f,
+    -0.0316761918f, -0.215985298f, -0.110001758f, -0.397342443f,
+    -0.0776157528f, 0.0940580294f, 0.0407023914f, -0.149310008f,
+    -0.18411155f, -0.234836042f, -0.171151951f, 0.0355023555f,
+    -0.00270262104f, 0.083820045f, -0.118813731f, -0.480546564f,
+    -0.256468862f, -0.0943700075f, -0.0261459686f, -0.114502735f,
+    -0.19380258f, -0.138030097f, -0.0609044768f, -0.130717263f,
+    -0.162071869f, 0.072466515f, 0.14444603f, 0.0843661949f,
+    -0.488476187f, -0.0443907566f, -0.284352809f, -0.0493352748f,
+    0.139795855f, 0.104212858f, -0.0550313815f, -0.0754163936f,
+    0.0513522848f, 0.0995157361f, 0.18422465f, 0.0251768939f,
+    0.060419634f, 0.105929151f, -0.3612369f, -0.110794246f,
+    -0.0448091552f, -0.366227835f, -0.267609835f, 0.144263804f,
+    0.214264244f, -0.0129462183f, -0.00667021796f, -0.0919284672f,
+    0.090827167f, -0.168751657f, 0.0925058499f, 0.172620073f,
+    -0.423518509f, -0.231007755f, 0.0168807711f, 0.0713043585f,
+    -0.080074057f, 0.0689417571f, 0.157710493f, 0.100078724f,
+    -0.140962705f, -0.0700892657f, -0.226966009f, 0.151790217f,
+    0.179069668f, 0.283218652f, -0.244419098f, -0.187636152f,
+    -0.120036125f, -0.0604946241f, -0.214286759f, 0.0464058816f,
+    -0.121621005f, -0.317884177f, -0.352075368f, 0.127904519f,
+    0.0162588619f, -0.144117594f, -0.117295668f, 0.0518494807f,
+    -0.189033583f, -0.321957052f, -0.0884775519f, 0.00493237888f,
+    -0.310792625f, -0.246914297f, -0.236063421f, -0.185806572f,
+    -0.0520233922f, -0.233987957f, -0.0630758628f, 0.201604247f,
+    0.00832555443f, 0.10185051f, -0.073727496f, 0.272605568f,
+    0.0882501453f, 0.138733208f, -0.0253915228f, -0.0777120516f,
+    -0.299750865f, -0.0515333973f, 0.0498334989f, -0.109052174f,
+    -0.0659176782f, 0.135710284f, 0.0679780245f, 0.144217238f,
+    -0.218314886f, 0.0225894917f, 0.237311646f, 0.279033422f,
+    -0.0830446556f, -0.065213874f, 0.113007158f, 0.257896453f,
+    0.161810681f, -0.0481367446f, 0.128394991f, 0.145601213f,
+    0.0964214653f, -0.0783528537f, -0.0790663287f, -0.164890364f,
+    0.272572249f, 0.112653106f, 0.16599904f, 0.161787346f,
+    0.0587411337f, 0.138611764f, -0.076140359f, -0.0593089387f,
+    0.0870478302f, -0.0638729185f, 0.0911454782f, 0.0854724944f,
+    -0.0565782115f, -0.0718800277f, -0.200602487f, -0.218752071f,
+    -0.0507875718f, -0.254297048f, -0.00872663595f, 0.0417775512f,
+    -0.0521414503f, 0.111955896f, 0.0905020759f, 0.127549633f,
+    0.0197445657f, -0.256475002f, 0.142086029f, 0.116298109f,
+    -0.256641865f, -0.00495153666f, 0.0191585664f, 0.0549274944f,
+    -0.0892172456f, 0.289722383f, 0.166976169f, -0.0463977493f,
+    0.0420212448f, -0.0891529769f, -0.194909126f, -0.0361573547f,
+    -0.0494444892f, -0.181878909f, -0.0795442984f, -0.0571596362f,
+    0.0390051939f, -0.164933637f, -0.284886807f, -0.432383895f,
+    -0.0643055588f, -0.0453378931f, -0.149443179f, -0.16236797f,
+    -0.00922463648f, -0.0658989698f, -0.2100517f, -0.48025322f,
+    -0.292929739f, -0.035302408f, -0.0185215306f, 0.0809693113f,
+    -0.157966971f, -0.122553237f, -0.148982435f, -0.165259138f,
+    -0.0537934937f, -0.144143835f, -0.149044037f, -0.296670794f,
+    -0.432100356f, 0.0978951231f, -0.0477450155f, 0.0026128164f,
+    0.0488731004f, -0.0196290929f, -0.104100086f, -0.173991501f,
+    -0.0999452621f, -0.0478928238f, 0.142635927f, -0.235787287f,
+    -0.273033053f, -0.102945819f, -0.223390892f, -0.00375112984f,
+    0.0255903713f, 0.299247354f, 0.129587054f, 0.126345962f,
+    0.0868707597f, 0.0867508501f, -0.138166353f, 0.080196932f,
+    0.358429134f, 0.21353583f, -0.106696427f, -0.177212879f,
+    -0.0230480358f, 0.0911386162f, -0.283697605f, 0.0166235752f,
+    -0.173722059f, 0.00831790362f, -0.249887437f, -0.0377492979f,
+    -0.010268583f, -0.0544561446f, 0.1835545f, -0.245834634f,
+    0.0223063659f, -0.069594495f, 0.0955043361f, 0.184293523f,
+    -0.0824834481f, -0.16828692f, -0.0339305475f, -0.100030765f,
+    -0.198950991f, 0.0376570746f, -0.0965291709f, 0.051246617f,
+    -0.114468016f, 0.113079503f, 0.08806777f, -0.0417370163f,
+    0.04366377f, 0.170885682f, 0.180470422f, 0.0122105712f,
+    -0.138214722f, -0.228528872f, -0.0311540142f, 0.0429204814f,
+    -0.115292914f, 0.224115431f, 0.0165874958f, -0.131150573f,
+    -0.2044366f, 0.213858321f, 0.132378548f, 0.0702206567f,
+    -0.153477609f, -0.361679912f, -0.225088388f, 0.184355512f,
+    -0.115002237f, -0.0580507554f, -0.185753658f, 0.135717645f,
+    0.00466482993f, 0.435824871f, -0.147329867f, -0.2731888f,
+    -0.0191209726f, 0.227838308f, 0.0649259984f, -0.0545202605f,
+    0.0917610377f, 0.101210654f, -0.0491937362f, 0.144397348f,
+    0.0855880976f, 0.0153201725f, -0.0726005435f, -0.220771447f,
+    0.249421731f, 0.0662853718f, 0.155889109f, -0.0633383319f,
+    0.0530301146f, -0.273399532f, 0.21656464f, 0.0239944309f,
+    -0.224038661f, 0.102071859f, 0.0896447301f, 0.119987823f,
+    -0.127032936f, -0.151482731f, -0.21561721f, -0.0841879323f,
+    -0.129252493f, -0.11729978f, 0.15033485f, 0.180868521f,
+    -0.200668439f, -0.058818005f, -0.012302896f, 0.142289713f,
+    -0.0479426943f, -0.168652296f, -0.184080541f, -0.00222350913f,
+    0.132708833f, 0.0512000211f, 0.018722441f, 0.202466786f,
+    0.138935298f, 0.0672842637f, -0.115508683f, 0.241958231f,
+    -0.120427765f, -0.102403969f, -0.0775346681f, -0.161056519f,
+    -0.129793361f, 0.12940754f, 0.160176039f, -0.265897542f,
+    -0.0986080766f, -0.0721144825f, -0.313717306f, -0.10447447f,
+    -0.0352226682f, 0.00597468717f, -0.487429351f, -0.133615881f,
+    -0.0566230416f, -0.106100984f, -0.201116115f, 0.13016212f,
+    0.140660331f, 0.107591636f, 0.0195429455f, -0.132323951f,
+    0.051707074f, -0.0221885834f, 0.0476203375f, -0.211372286f,
+    -0.0250670556f, -0.210965261f, -0.169492483f, 0.0444478281f,
+    0.0518568829f, 0.0589668304f, 0.132403612f, 0.14301914f,
+    -0.061137598f, -0.0314825736f, -0.236636847f, -0.0295992214f,
+    0.0354333408f, 0.0971245393f, 0.134277299f, -0.0633316413f,
+    -0.0307469144f, 0.068710953f, -0.18528986f, 0.200498372f,
+    -0.0747884214f, 0.00685921405f, 0.0880826935f, -0.223445028f,
+    -0.0916642621f, -0.20757328f, -0.0469492227f, -0.182235375f,
+    0.100774348f, 0.218947947f, 0.0309656858f, 0.0938539058f,
+    0.0557543933f, -0.130082875f, -0.0387799963f, 0.156703532f,
+    -0.0356020741f, 0.0829658061f, 0.226893008f, -0.240617722f,
+    0.0812837854f, -0.10306102f, -0.18554531f, -0.177388504f,
+    0.229588717f, 0.149865717f, -0.106300257f, -0.000945743639f,
+    -0.181226462f, 0.0451467782f, -0.114296131f, -0.034025114f,
+    0.0653800443f, 0.175578356f, 0.111338943f, 0.0366557911f,
+    0.0842873454f, 0.0357812867f, 0.167893633f, -0.0556932651f,
+    0.12296629f, 0.080639638f, -0.158520713f, -0.0445255116f,
+    -0.106424868f, -0.134359941f, -0.0660455003f, -0.0777952373f,
+    0.014341143f, -0.00560417026f, -0.189169452f, -0.209959105f,
+    -0.172354743f, -0.045160871f, 0.0937925652f, 0.0662902743f,
+    0.0162327681f, -0.0580844507f, -0.355807215f, -0.0879309922f,
+    -0.170375302f, -0.153833047f, -0.0632228404f, 0.0892646611f,
+    -0.061220184f, 0.0947678983f, -0.23895961f, -0.0915883332f,
+    0.0676218644f, -0.144158438f, 0.0390828103f, -0.0881798044f,
+    0.0574570894f, -0.298848361f, -0.215609759f, 0.00129548297f,
+    -0.100930296f, -0.0344826765f, -0.156760737f, 0.122983471f,
+    -0.0780634359f, -0.0340541042f, -0.138300881f, -0.0888437182f,
+    0.0509846993f, 0.0506077856f, 0.213258624f, -0.189218551f,
+    0.180780604f, 0.188052401f, -0.0262221023f, 0.0298435818f,
+    -0.322063416f, -0.0690937415f, -0.0795416385f, 0.0112179285f,
+    -0.185773417f, -0.158553883f, -0.0774909332f, 0.135057777f,
+    -0.0241282284f, 0.131440327f, -0.0679337755f, -0.173652738f,
+    -0.00701121008f, -0.236891329f, 0.155430898f, -0.0285105724f,
+    0.0332096182f, -0.320944548f, -0.116425551f, 0.00326023391f,
+    0.0766229555f, 0.128845483f, 0.176973686f, -0.137408808f,
+    -0.206699446f, -0.17703554f, -0.0628716201f, -0.132787645f,
+    -0.0568169914f, 0.0426835008f, -0.300235868f, -0.726786971f,
+    0.143645227f, -0.192043737f, -0.332076699f, 0.0182211455f,
+    -0.0408386327f, -0.188280731f, 0.0447841845f, -0.0722765848f,
+    -0.103781767f, -0.160531968f, 0.073411718f, 0.0269479193f,
+    0.263752937f, 0.209363922f, 0.0784421861f, -0.0432842113f,
+    0.0577274449f, 0.106252559f, 0.320150435f, 0.235043004f,
+    0.144244984f, 0.121456504f, 0.0953458622f, 0.249071658f,
+    -0.0557772629f, -0.181772754f, 0.112291574f, 0.0166237485f,
+    -0.099306725f, 0.167661205f, 0.0606231764f, 0.0884005874f,
+    -0.0425093621f, 0.0690918937f, -0.0750452876f, -0.199492291f,
+    0.0102778412f, -0.0405540057f, -0.21983251f, -0.101592474f,
+    0.236358494f, -0.210583314f, -0.102228694f, -0.00444471231f,
+    -0.124895252f, -0.0898947865f, 0.104689479f, -0.0796684474f,
+    -0.271671712f, 0.153313816f, 0.145248041f, -0.0600486808f,
+    0.205450922f, -0.0520659089f, -0.179069191f, 0.0326909088f,
+    -0.252352297f, 0.0375101641f, 0.122398637f, -0.118299894f,
+    -0.0460262336f, 0.107561313f, 0.199560538f, 0.0664058849f,
+    0.179082215f, 0.0600770451f, 0.122828089f, -0.0243658088f,
+    0.249266073f, 0.169986024f, 0.137189925f, -0.128168285f,
+    -0.185015962f, 0.157048985f, 0.124717087f, 0.0301468708f,
+    -0.164183736f, -0.159548476f, -0.0857852623f, -0.169740692f,
+    0.0596945137f, 0.0854301602f, -0.119095393f, -0.118059166f,
+    -0.000400493183f, -0.169881836f, 0.0542179085f, 0.120107636f,
+    0.139489874f, -0.0686726496f, -0.19953993f, 0.00330986269f,
+    0.0501785688f, -0.163969576f, 0.0395620167f, 0.119044706f,
+    0.0594885647f, 0.0169405024f, -0.0946944654f, 0.175119549f,
+    -0.163827017f, -0.010776124f, 0.0782613754f, -0.0970583707f,
+    -0.0810539052f, -0.121861398f, -0.12809974f, -0.191824555f,
+    -0.00998342875f, -0.0400138721f, 0.210943744f, -0.400382102f,
+    -0.0309553072f, -0.011888572f, 0.166152239f, -0.1880344f,
+    -0.126511574f, -0.215546086f, -0.111936308f, 0.0137408013f,
+    0.0112676974f, -0.0202817675f, -0.0351455137f, -0.281823218f,
+    -0.0500410832f, 0.226089314f, 0.101869583f, 0.138844788f,
+    -0.0321486555f, -0.259742767f, -0.175398245f, -0.111995317f,
+    0.154708251f, -0.0366554074f, -0.213923976f, -0.117928773f,
+    0.0120304395f, -0.163390085f, -0.133774191f, 0.0301815588f,
+    -0.0830232874f, 0.00508689648f, 0.259715438f, -0.0636523664f,
+    0.040351145f, 0.128869385f, 0.0268463939f, -0.260549754f,
+    -0.0567593761f, -0.193851173f, -0.135836452f, 0.125305474f,
+    0.156579673f, -0.0482938364f, 0.0938932002f, -0.0421987846f,
+    0.0172661617f, 0.179739535f, -0.13026464f, -0.0487474427f,
+    -0.102340519f, 0.241430804f, 0.0185637698f, -0.0263966899f,
+    -0.144990072f, 0.219403714f, 0.120817564f, 0.197903737f,
+    -0.0505428202f, -0.257694721f, 0.113175564f, -0.0888179988f,
+    -0.0333860554f, 0.14454709f, -0.137812823f, 0.12272007f,
+    0.121847853f, 0.254406124f, 0.238759026f, -0.172348395f,
+    0.00582243828f, -0.191070288f, 0.0647655278f, -0.222046524f,
+    -0.342238724f, -0.0985066816f, 0.0244727191f, 0.127999246f,
+    0.059281718f, -0.143319339f, -0.114711478f, -0.289126486f,
+    -0.093439728f, -0.150464967f, -0.0877243802f, -0.0860113725f,
+    0.0712504312f, 0.0757627338f, 0.0841698498f, -0.135940179f,
+    -0.0772568062f, -0.0905834511f, -0.166471019f, -0.124227785f,
+    -0.0377171859f, -0.161720663f, -0.515220106f, -0.26513195f,
+    -0.0566474348f, -0.0660726428f, 0.109859027f, 0.142484874f,
+    0.0886794627f, 0.217304647f, 0.243780449f, 0.036904458f,
+    0.276343435f, -0.207413107f, -0.0017041252f, -0.192423195f,
+    0.193561912f, -0.0104630394f, 0.106806844f, -0.119257458f,
+    -0.0252698008f, -0.149897769f, 0.222131759f, 0.00996456202f,
+    -0.0474197492f, -0.110187002f, 0.12110614f, 0.20273529f,
+    0.105873756f, -0.00302322395f, -0.127787516f, -0.321653396f,
+    -0.223324284f, 0.142394438f, 0.159347534f, 0.0909750015f,
+    -0.10918466f, -0.0871992111f, 0.0539289638f, 0.273647219f,
+    0.424312055f, -0.0804493204f, -0.310690045f, 0.0301163197f,
+    0.104103453f, 0.273083091f, -0.0836705342f, 0.0210258029f,
+    -0.029653918f, -0.20808658f, -0.104175001f, 0.0461884588f,
+    -0.00173872418f, -0.337120354f, 0.016130276f, -0.104447342f,
+    -0.677712202f, -0.454140395f, -0.0386917889f, -0.0301032737f,
+    0.149506629f, 0.138627887f, 0.161139801f, 0.000308096292f,
+    0.206576452f, 0.175787166f, 0.0323722288f, 0.0260145031f,
+    0.0492443927f, 0.0512757003f, -0.0074904887f, -0.412621886f,
+    -0.179786071f, 0.00750060845f, -0.0953840166f, -0.180115208f,
+    0.0110377725f, -0.269221693f, 0.0100346096f, 0.0778254867f,
+    0.0899198651f, 0.0709097981f, 0.0506715663f, -0.350542307f,
+    -0.170913979f, 0.0758912042f, 0.0673841164f, -0.381157577f,
+    0.0631150603f, 0.178723916f, -0.129267484f, 0.206052855f,
+    0.0186209809f, -0.457417786f, -0.170159474f, 0.00918183569f,
+    0.0808875784f, -0.10872291f, 0.462734044f, -0.0828592181f,
+    0.311159492f, 0.289286673f, 0.173247486f, 0.111794412f,
+    0.0336767174f, -0.210255712f, -0.237477422f, -0.268054307f,
+    -0.246553272f, 0.0173982438f, 0.049448505f, 0.068465516f,
+    -0.269803882f, -0.197388634f, -0.0137716057f, -0.0601513982f,
+    -0.152747646f, 0.0706103444f, 0.270475447f, -0.163718298f,
+    -0.398119897f, -0.0251681134f, -0.0609693453f, 0.0568389706f,
+    0.121062405f, -0.393619925f, -0.0900168046f, 0.0972287655f,
+    0.0639314279f, 0.138627827f, 0.204752669f, 0.218953773f,
+    -0.0710806921f, -0.181552425f, 0.0917508975f, 0.0868004933f,
+    0.275846541f, -0.187806174f, 0.368645102f, -0.117395893f,
+    0.0193100628f, -0.317195624f, -0.257848501f, 0.115591094f,
+    0.0397572257f, 0.0663258284f, 0.164344251f, -0.110217996f,
+    0.143350884f, 0.137167498f, -0.0272892267f, -0.175774962f,
+    -0.424993277f, -0.0822833925f, -0.0738037825f, 0.023998376f,
+    -0.0109092444f, -0.269738436f, -0.110883273f, -0.0665798783f,
+    -0.345906407f, 0.0307204239f, 0.105711497f, 0.0833447874f,
+    0.00970082916f, -0.129644483f, -0.19837746f, -0.248482808f,
+    -0.278343171f, 0.00990319438f, 0.0315317921f, 0.11105182f,
+    0.225109339f, -0.0607026853f, -0.208482474f, -0.15110828f,
+    -0.132052436f, 0.0821986869f, 0.124913566f, 0.0836977959f,
+    0.0752016529f, 0.0824816823f, 0.0911091119f, 0.117689416f,
+    0.21951285f, 0.115896866f, 0.148026109f, -0.0135399578f,
+    0.161095887f, -0.0704383999f, 0.0546762347f, 0.0970248803f,
+    -0.103456691f, 0.0803807303f, 0.135525063f, -0.247757792f,
+    -0.230775893f, -0.0570229962f, -0.207764253f, 0.0377025679f,
+    -0.106180809f, 0.0541947447f, -0.29584983f, 0.0306722764f,
+    0.057970088f, 0.138222307f, 0.380459368f, -0.0786792412f,
+    0.0154520264f, 0.189238116f, 0.126346484f, 0.0880216211f,
+    -0.0277882665f, -0.0754135102f, 0.242791817f, -0.0616588108f,
+    0.184996873f, -0.0474396572f, 0.189767465f, 0.0454131626f,
+    0.0450809374f, -0.299968302f, -0.0712882355f, 0.0768040717f,
+    -0.0991304666f, -0.0737408325f, -0.152568579f, -0.0808211491f,
+    -0.0849895775f, -0.0301845893f, 0.228661925f, -0.100504689f,
+    0.0820778385f, -0.0787421316f, -0.200103387f, 0.0837799311f,
+    0.199880406f, 0.104037277f, -0.168287814f, 0.050644666f,
+    -0.465896726f, -0.0442305841f, 0.00339087751f, 0.0515814982f,
+    -0.165005565f, -0.0818092227f, -0.133033007f, 0.168521374f,
+    0.127724007f, 0.05888623f, 0.0488465689f, -0.218164593f,
+    -0.176653877f, 0.0244579893f, -0.495573401f, -0.106587395f,
+    -0.468528628f, -0.165967628f, 0.0652920529f, 0.0242608003f,
+    -0.0338701569f, -0.0490514003f, -0.184938014f, 0.126170516f,
+    0.168552458f, 0.0482797362f, 0.15480049f, 0.0412636474f,
+    -0.039683491f, 0.248649165f, 0.090384692f, -0.142807543f,
+    -0.233983263f, 0.0373021141f, -0.359139293f, -0.0802398026f,
+    -0.201391846f, -0.155928984f, -0.024233913f, 0.057242997f,
+    0.263670295f, 0.0636541545f, 0.163566202f, -0.196291521f,
+    -0.0290699638f, -0.0999671891f, -0.079173103f, -0.237889975f,
+    -0.27490744f, -0.25649637f, -0.101137549f, 0.0548448898f,
+    0.0234724581f, -0.0576072f, 0.109281786f, -0.377206713f,
+    -0.0676622465f, -0.187334523f, -0.133763134f, 0.000719259901f,
+    -0.00997242983f, -0.222443342f, 0.288918376f, 0.00736631546f,
+    0.201530799f, -0.107386373f, -0.0408333726f, 0.0430167243f,
+    -0.110095203f, -0.0770849213f, -0.141949385f, -0.103022404f,
+    -0.113946773f, -0.0349524282f, -0.133606732f, 0.198402032f,
+    0.110023618f, -0.180985034f, 0.0556890406f, -0.14200303f,
+    -0.00520371879f, -0.0873931274f, -0.250259459f, -0.031516578f,
+    -0.110362165f, -0.346843898f, 0.0786285922f, 0.0369578265f,
+    -0.0790916309f, 0.106042407f, -0.112768613f, -0.0940790847f,
+    -0.0722400397f, -0.0454472378f, -0.253047198f, -0.0426441692f,
+    -0.186034799f, -0.0945612639f, -0.0740425736f, -0.15654248f,
+    -0.0816729814f, 0.0660631657f, 0.0505957939f, 0.166192949f,
+    0.274557263f, 0.130362034f, 0.178311229f, -0.0215716753f,
+    0.0663504452f, 0.189312175f, 0.125302404f, -0.0126517024f,
+    -0.106626891f, -0.252290726f, 0.000688285392f, -0.237779483f,
+    0.0656242296f, 0.00451873383f, -0.277394384f, -0.161867395f,
+    0.0298849326f, 0.216300949f, 0.0804170221f, 0.0363206305f,
+    -0.0105420994f, -0.0945266634f, -0.354426563f, -0.0224481486f,
+    0.0903383493f, 0.117225997f, 0.143303409f, -0.140008271f,
+    -0.178070456f, 0.0886482596f, 0.135938421f, -0.0571142435f,
+    0.198302671f, -0.244985953f, -0.179114819f, -0.269035816f,
+    0.220377132f, -0.182125419f, 0.106824785f, 0.136594161f,
+    -0.0626271963f, -0.0449958742f, 0.366281182f, 0.121465303f,
+    -0.230810747f, 0.0583303906f, -0.366789252f, -0.047491312f,
+    -0.474633664f, -0.238092512f, -0.0124013973f, -0.212082803f,
+    0.0887730196f, -0.0544972531f, 0.226555929f, -0.0264965501f,
+    0.0700572655f, -0.172789514f, -0.355256289f, 0.0582832173f,
+    0.306460798f, 0.000354236545f, -0.0177729316f, -0.225941017f,
+    -0.151887819f, -0.0589049943f, 0.0701990873f, -0.175326854f,
+    -0.117402546f, -0.163579836f, 0.045207642f, 0.118792109f,
+    -0.0216620527f, -0.209331125f, -0.177731112f, -0.420159638f,
+    0.0374498181f, -0.148648351f, 0.133828819f, -0.32615158f,
+    0.232174069f, 0.0818019584f, 0.181112111f, 0.166659743f,
+    0.107662648f, -0.0524451025f, -0.12816751f, 0.0764867216f,
+    0.163063139f, 0.00468684779f, 0.197956041f, -0.21926403f,
+    0.0188912135f, 0.0244681407f, -0.0108739594f, -0.5335235f,
+    -0.156791195f, -0.110504195f, 0.205712199f, -0.373417526f,
+    -0.0624255687f, 0.0391065292f, 0.179054692f, 0.286588967f,
+    -0.115432806f, -0.202411979f, 0.105571285f, 0.0390059948f,
+    0.121644199f, 0.212592095f, 0.0953359753f, -0.161829367f,
+    -0.448670417f, -0.0476805158f, -0.23289898f, 0.0662827939f,
+    -0.472100496f, -0.0869993269f, 0.0691764653f, -0.0365454033f,
+    -0.107332081f, -0.0734198764f, -0.284783512f, 0.0554399528f,
+    -0.18526122f, 0.0471684858f, -0.142232105f, 0.114484876f,
+    -0.0904647186f, -0.25235486f, -0.0939229727f, -0.135490313f,
+    0.135648236f, 0.329668015f, 0.0489014201f, 0.159566641f,
+    0.114493094f, 0.0734767094f, 0.0373992287f, 0.216825649f,
+    -0.114841901f, 0.0290289354f, -0.304681122f, -0.301528007f,
+    -0.182389334f, -0.399330914f, -0.276405722f, 0.0215699989f,
+    -0.0279734246f, 0.0259180889f, -0.346516997f, -0.142385677f,
+    -0.183482677f, -0.12238206f, -0.0368722938f, -0.0838163123f,
+    0.0740494132f, 0.191181034f, 0.0541878901f, -0.113182604f,
+    0.102885976f, 0.223846868f, 0.238147184f, 0.01478865f,
+    -0.0115975002f, 0.0355492011f, 0.206707761f, -0.213171184f,
+    0.0432179347f, -0.338687122f, -0.0788242817f, 0.105882965f,
+    -0.00758912088f, 0.113504618f, 0.166464701f, 0.21924451f,
+    -0.0727360621f, -0.130128235f, -0.420181334f, -0.17258364f,
+    0.0738779306f, -0.161909357f, -0.085677512f, -0.271689951f,
+    -0.018954549f, -0.229812935f, -0.0897519439f, 0.103389248f,
+    -0.337604105f, 0.00143487076f, 0.0545960069f, 0.245281532f,
+    0.0133563858f, 0.190225855f, 0.083987698f, -0.10134387f,
+    -0.00476623932f, -0.339728147f, 0.0149677843f, -0.275891304f,
+    0.17131564f, -0.00123377098f, -0.0966568664f, -0.250317276f,
+    0.142216608f, 0.0178434085f, -0.114663787f, -0.209884107f,
+    0.217219591f, -0.0406964123f, -0.0335005149f, -0.32457158f,
+    -0.0311520919f, -0.0442560837f, -0.336202294f, -0.0954089835f,
+    -0.0280138459f, -0.0765879303f, -0.0793842673f, 0.188585669f,
+    0.0430130213f, -0.240528345f, -0.150575817f, 0.0595493875f,
+    -0.0999380499f, 0.317995846f, 0.313562065f, 0.019715324f,
+    -0.280423343f, -0.114314288f, 0.115674019f, 0.0143469041f,
+    0.0887515992f, 0.0352509394f, -0.153203979f, -0.318739593f,
+    -0.0308849663f, -0.00574818486f, 0.112059005f, -0.309485018f,
+    -0.342357427f, -0.0433660038f, -0.0523859672f, 0.150829688f,
+    0.0620468408f, -0.183940798f, -0.233144715f, -0.208651185f,
+    -0.0770740807f, 0.0114505915f, -0.123141125f, 0.152590185f,
+    -0.249617323f, 0.168891743f, 0.0153600732f, 0.0693854392f,
+    -0.117143132f, 0.0574199371f, 0.0838398188f, 0.129485667f,
+    0.138741881f, -0.0468684882f, 0.0843595564f, -0.119065806f,
+    -0.161854014f, -0.0382459313f, -0.476270825f, -0.094662413f,
+    0.00635341974f, -0.20362708f, -0.146774009f, -0.0775635242f,
+    0.0720729381f, 0.0799312443f, 0.179558352f, -0.124177068f,
+    -0.207156181f, -0.182380453f, 0.145273894f, 0.0651160106f,
+    -0.266194701f, 0.00456757331f, -0.114019535f, -0.0420107134f,
+    0.0376181006f, 0.0284349136f, 0.0708269179f, 0.252690792f,
+    -0.0385623276f, -0.468996555f, -0.136013821f, 0.149243295f,
+    0.0509620234f, 0.0605607629f, 0.180270493f, 0.185908496f,
+    0.202731758f, -0.0289275832f, -0.0819237679f, 0.125302255f,
+    0.186407745f, -0.00673110783f, -0.163869366f, -0.186859936f,
+    -0.216748938f, 0.175409257f, -0.173739165f, -0.065884307f,
+    0.017430611f, 0.17321527f, -0.0488554649f, -0.429780185f,
+    -0.249694481f, -0.101024792f, -0.0391317829f, 0.0200104825f,
+    0.0303175077f, 0.279170066f, 0.040556699f, -0.112849221f,
+    0.0121474732f, 0.02340132f, 0.147192106f, -0.201022148f,
+    -0.0112970434f, -0.0487057753f, -0.546023071f, 0.150447249f,
+    -0.188424438f, -0.268868983f, 0.171717659f, -0.0954175517f,
+    -0.0252363067f, 0.0609752797f, -0.0214721374f, -0.275037616f,
+    -0.284023166f, -0.0862651393f, 0.0739689469f, -0.121911161f,
+    0.0717335343f, 0.0317174755f, 0.224089563f, -0.441298336f,
+    0.0918250903f, 0.0750812888f, 0.0120768985f, 0.251907647f,
+    -0.194360271f, 0.0803437158f, 0.045769278f, 0.0444453731f,
+    0.0134297255f, -0.0230775308f, -0.497482032f, -0.142235711f,
+    -0.125528276f, -0.181370527f, -0.144963682f, -0.0116010308f,
+    -0.188004285f, -0.0741536766f, 0.164764598f, 0.0159692466f,
+    0.0170394611f, -0.013621266f, -0.441514492f, -0.432502896f,
+    0.113474332f, 0.196339592f, 0.186739206f, -0.185294017f,
+    -0.0371800736f, -0.349682212f, 0.109569438f, 0.0123847099f,
+    0.138918102f, 0.0639575794f, -0.284573823f, -0.0366433859f,
+    -0.143547073f, -0.0443086959f, -0.155758262f, 0.18698898f,
+    -0.127263397f, -0.244792268f, -0.0362485088f, -0.105231419f,
+    -0.118968725f, -0.040509522f, 0.206873626f, 0.00018384718f,
+    -0.263899535f, 0.12931639f, -0.210347876f, 0.071693562f,
+    -0.230523005f, -0.0158791002f, -0.0718222558f, 0.111771643f,
+    -0.0597457923f, 0.0706786215f, 0.0380452387f, 0.201004952f,
+    0.0448620953f, 0.154549882f, -0.0348854735f, -0.260957807f,
+    0.138290539f, 0.0713692531f, 0.119068898f, 0.0851082057f,
+    0.162513509f, -0.113725752f, 0.132347614f, -0.0529055931f,
+};
+
+static const uint16_t mnist_cnn_layer4_columns[1960] = {
+    4, 20, 24, 32, 36, 44, 52, 60, 72, 76, 84, 92,
+    96, 108, 116, 124, 132, 136, 140, 144, 148, 152, 172, 184,
+    188, 192, 212, 216, 220, 228, 232, 236, 240, 264, 268, 272,
+    276, 280, 284, 288, 296, 324, 356, 360, 364, 368, 380, 384,
+    388, 396, 412, 416, 420, 424, 428, 432, 436, 500, 504, 508,
+    512, 540, 548, 552, 556, 564, 568, 572, 576, 584, 600, 604,
+    608, 612, 616, 620, 624, 628, 632, 652, 660, 664, 668, 672,
+    676, 680, 688, 696, 700, 704, 716, 724, 728, 756, 768, 780,
+    784, 788, 800, 808, 816, 820, 840, 852, 864, 872, 876, 900,
+    904, 916, 920, 924, 928, 940, 944, 952, 964, 976, 980, 984,
+    988, 1000, 1008, 1012, 1020, 1024, 1036, 1040, 1048, 1052, 1056, 1060,
+    1064, 1068, 1072, 1076, 1080, 1084, 1088, 1092, 1096, 1100, 1108, 1128,
+    1152, 1156, 1168, 1184, 1192, 1200, 1204, 1236, 1244, 1248, 1252, 1260,
+    1264, 1268, 1272, 1276, 1284, 1292, 1296, 1308, 1312, 1316, 1320, 1328,
+    1336, 1340, 1344, 1352, 1364, 1372, 1376, 1384, 1412, 1416, 1424, 1436,
+    1440, 1444, 1452, 1456, 1472, 1476, 1484, 1492, 1504, 1508, 1528, 1540,
+    1548, 1556, 1560, 1564, 0, 8, 12, 16, 20, 28, 36, 40,
+    48, 52, 56, 72, 76, 84, 92, 96, 108, 120, 140, 148,
+    156, 160, 164, 172, 176, 184, 188, 192, 196, 200, 204, 208,
+    212, 224, 228, 240, 264, 268, 272, 276, 280, 284, 288, 296,
+    304, 308, 316, 320, 324, 348, 356, 360, 364, 396, 408, 416,
+    428, 432, 436, 492, 496, 504, 508, 512, 516, 520, 532, 536,
+    540, 548, 556, 564, 572, 584, 588, 592, 596, 604, 608, 612,
+    616, 620, 628, 632, 648, 652, 660, 668, 692, 700, 704, 712,
+    728, 732, 736, 748, 760, 780, 796, 800, 808, 812, 816, 820,
+    836, 840, 860, 864, 868, 872, 876, 880, 896, 900, 904, 908,
+    920, 936, 940, 944, 948, 952, 956, 960, 1004, 1008, 1012, 1016,
+    1020, 1024, 1028, 1048, 1052, 1056, 1060, 1064, 1068, 1080, 1088, 1108,
+    1112, 1132, 1136, 1144, 1148, 1156, 1160, 1168, 1184, 1200, 1204, 1240,
+    1244, 1248, 1252, 1256, 1260, 1264, 1272, 1280, 1284, 1288, 1292, 1296,
+    1300, 1304, 1312, 1324, 1332, 1336, 1344, 1348, 1356, 1364, 1368, 1372,
+    1380, 1412, 1416, 1424, 1428, 1436, 1448, 1452, 1472, 1476, 1484, 1492,
+    1496, 1512, 1520, 1540, 1544, 1548, 1552, 1560, 24, 44, 52, 60,
+    64, 68, 72, 84, 92, 96, 100, 108, 112, 132, 136, 140,
+    144, 156, 160, 168, 176, 184, 188, 192, 208, 220, 228, 232,
+    236, 240, 260, 264, 268, 272, 276, 280, 284, 288, 292, 296,
+    304, 312, 324, 336, 348, 356, 372, 376, 380, 384, 388, 408,
+    412, 428, 432, 436, 492, 500, 508, 512, 532, 536, 540, 552,
+    556, 560, 564, 572, 576, 580, 592, 596, 608, 616, 620, 628,
+    632, 652, 668, 672, 676, 696, 700, 708, 712, 720, 724, 728,
+    732, 736, 752, 756, 764, 768, 780, 788, 796, 804, 808, 812,
+    816, 820, 824, 828, 836, 852, 856, 868, 872, 876, 888, 896,
+    900, 904, 908, 912, 916, 920, 924, 928, 932, 940, 944, 948,
+    960, 964, 968, 984, 992, 1000, 1008, 1012, 1016, 1020, 1024, 1032,
+    1036, 1040, 1044, 1048, 1052, 1056, 1068, 1096, 1104, 1108, 1132, 1152,
+    1156, 1160, 1164, 1168, 1184, 1188, 1192, 1196, 1204, 1208, 1232, 1236,
+    1240, 1252, 1260, 1268, 1284, 1296, 1304, 1312, 1316, 1320, 1324, 1336,
+    1352, 1364, 1372, 1384, 1392, 1396, 1404, 1412, 1416, 1424, 1448, 1464,
+    1488, 1492, 1500, 1504, 1508, 1520, 1528, 1536, 1540, 1548, 1560, 1564,
+    4, 8, 12, 16, 20, 24, 28, 36, 40, 52, 60, 64,
+    76, 80, 92, 96, 100, 112, 120, 124, 136, 140, 144, 156,
+    164, 168, 176, 188, 200, 208, 212, 220, 224, 228, 236, 240,
+    260, 276, 280, 284, 288, 296, 304, 312, 320, 324, 356, 364,
+    372, 384, 388, 396, 404, 408, 412, 416, 424, 432, 436, 492,
+    500, 508, 516, 520, 540, 556, 560, 580, 592, 596, 600, 604,
+    608, 612, 616, 620, 628, 632, 652, 660, 668, 688, 692, 696,
+    708, 712, 716, 720, 724, 728, 732, 756, 780, 788, 796, 800,
+    804, 808, 816, 820, 824, 836, 848, 852, 860, 864, 868, 872,
+    876, 880, 904, 912, 928, 940, 944, 948, 956, 960, 964, 980,
+    984, 988, 992, 996, 1000, 1008, 1020, 1024, 1032, 1040, 1044, 1048,
+    1052, 1060, 1064, 1068, 1084, 1088, 1092, 1096, 1108, 1128, 1132, 1148,
+    1156, 1168, 1172, 1176, 1184, 1188, 1192, 1196, 1204, 1208, 1212, 1228,
+    1240, 1256, 1260, 1276, 1284, 1288, 1292, 1296, 1300, 1304, 1308, 1312,
+    1316, 1320, 1324, 1328, 1332, 1344, 1364, 1376, 1380, 1384, 1388, 1392,
+    1400, 1408, 1412, 1416, 1424, 1428, 1436, 1472, 1492, 1512, 1532, 1540,
+    1552, 1556, 1560, 1564, 16, 24, 44, 48, 52, 56, 68, 84,
+    92, 96, 104, 108, 116, 120, 124, 132, 136, 140, 144, 148,
+    152, 156, 160, 164, 168, 192, 204, 208, 212, 216, 220, 228,
+    232, 236, 240, 252, 260, 264, 268, 272, 280, 288, 296, 304,
+    308, 312, 316, 336, 348, 364, 368, 372, 380, 384, 388, 396,
+    404, 412, 416, 424, 428, 432, 436, 492, 496, 500, 504, 532,
+    536, 540, 548, 552, 556, 576, 580, 600, 608, 612, 620, 632,
+    652, 660, 668, 680, 688, 696, 704, 712, 724, 728, 732, 744,
+    752, 756, 768, 772, 776, 784, 788, 792, 796, 816, 824, 832,
+    836, 844, 848, 852, 860, 864, 872, 876, 880, 892, 896, 904,
+    912, 920, 936, 948, 952, 956, 960, 972, 980, 984, 988, 996,
+    1004, 1012, 1020, 1024, 1032, 1036, 1044, 1048, 1068, 1080, 1084, 1088,
+    1096, 1120, 1128, 1132, 1140, 1160, 1168, 1184, 1192, 1196, 1200, 1212,
+    1232, 1260, 1264, 1272, 1280, 1284, 1292, 1296, 1300, 1312, 1316, 1320,
+    1324, 1328, 1332, 1336, 1340, 1344, 1364, 1368, 1372, 1384, 1388, 1392,
+    1412, 1424, 1428, 1440, 1444, 1448, 1472, 1476, 1480, 1488, 1492, 1504,
+    1508, 1512, 1520, 1524, 1528, 1536, 1552, 1556, 8, 12, 16, 20,
+    24, 28, 32, 36, 44, 48, 52, 64, 68, 76, 84, 96,
+    116, 140, 144, 148, 152, 156, 160, 164, 168, 176, 192, 208,
+    220, 224, 228, 236, 240, 256, 260, 264, 268, 272, 284, 288,
+    296, 304, 312, 324, 352, 360, 364, 376, 388, 392, 404, 408,
+    412, 416, 424, 428, 432, 436, 500, 508, 512, 520, 524, 532,
+    540, 548, 552, 556, 564, 580, 588, 592, 596, 600, 604, 612,
+    616, 620, 624, 628, 632, 648, 652, 672, 688, 692, 700, 708,
+    712, 716, 720, 728, 732, 736, 740, 760, 776, 796, 800, 804,
+    808, 820, 836, 840, 848, 852, 856, 860, 868, 872, 876, 880,
+    892, 896, 900, 904, 908, 912, 920, 936, 940, 944, 948, 952,
+    996, 1020, 1024, 1032, 1036, 1040, 1048, 1056, 1068, 1072, 1084, 1088,
+    1092, 1100, 1108, 1132, 1136, 1140, 1144, 1148, 1152, 1156, 1172, 1184,
+    1188, 1192, 1196, 1204, 1208, 1232, 1236, 1244, 1264, 1268, 1284, 1292,
+    1296, 1304, 1308, 1316, 1324, 1328, 1340, 1344, 1348, 1364, 1368, 1380,
+    1384, 1388, 1392, 1396, 1400, 1408, 1412, 1416, 1424, 1432, 1436, 1440,
+    1444, 1456, 1488, 1500, 1520, 1528, 1536, 1548, 1552, 1556, 1560, 1564,
+    0, 4, 12, 16, 24, 36, 40, 44, 52, 56, 64, 84,
+    92, 96, 104, 116, 132, 140, 144, 148, 152, 164, 168, 172,
+    176, 192, 196, 208, 220, 232, 236, 240, 244, 252, 260, 264,
+    268, 272, 276, 280, 284, 296, 300, 304, 308, 316, 324, 340,
+    352, 372, 380, 384, 388, 400, 408, 412, 416, 420, 428, 432,
+    492, 504, 508, 512, 516, 520, 532, 536, 540, 548, 552, 560,
+    564, 572, 584, 588, 592, 600, 608, 612, 628, 632, 660, 664,
+    672, 688, 692, 696, 704, 708, 716, 724, 728, 732, 752, 772,
+    776, 784, 788, 792, 800, 808, 812, 816, 820, 828, 832, 844,
+    848, 852, 856, 864, 872, 876, 880, 900, 904, 908, 924, 936,
+    940, 944, 948, 952, 956, 972, 976, 980, 996, 1000, 1024, 1028,
+    1032, 1036, 1044, 1052, 1056, 1060, 1068, 1072, 1080, 1092, 1100, 1108,
+    1128, 1132, 1144, 1152, 1168, 1172, 1184, 1192, 1196, 1200, 1204, 1224,
+    1232, 1236, 1240, 1244, 1252, 1264, 1272, 1276, 1292, 1296, 1300, 1312,
+    1316, 1324, 1328, 1336, 1340, 1344, 1372, 1384, 1388, 1396, 1416, 1424,
+    1428, 1436, 1444, 1448, 1452, 1464, 1468, 1488, 1496, 1500, 1520, 1528,
+    1536, 1548, 1552, 1564, 4, 12, 24, 32, 44, 52, 56, 64,
+    68, 76, 88, 96, 100, 108, 116, 120, 124, 128, 132, 136,
+    140, 148, 152, 156, 168, 176, 184, 188, 200, 220, 224, 228,
+    236, 240, 260, 264, 268, 272, 276, 280, 288, 304, 312, 328,
+    340, 348, 356, 364, 372, 388, 392, 404, 408, 412, 420, 424,
+    432, 436, 500, 504, 532, 540, 548, 556, 560, 564, 568, 576,
+    580, 584, 592, 596, 600, 608, 612, 616, 620, 628, 632, 652,
+    668, 680, 688, 692, 696, 724, 732, 736, 744, 748, 756, 760,
+    764, 768, 776, 788, 796, 808, 812, 816, 820, 824, 836, 856,
+    860, 872, 876, 888, 900, 904, 908, 912, 916, 920, 928, 936,
+    940, 948, 968, 972, 980, 984, 992, 1012, 1028, 1032, 1048, 1060,
+    1064, 1084, 1088, 1092, 1096, 1128, 1136, 1140, 1144, 1152, 1160, 1184,
+    1188, 1192, 1196, 1200, 1204, 1228, 1240, 1244, 1260, 1264, 1268, 1272,
+    1276, 1284, 1292, 1296, 1300, 1304, 1312, 1320, 1324, 1328, 1332, 1336,
+    1344, 1348, 1356, 1360, 1364, 1368, 1376, 1388, 1392, 1400, 1404, 1412,
+    1416, 1428, 1432, 1436, 1444, 1448, 1452, 1456, 1464, 1468, 1472, 1492,
+    1496, 1500, 1512, 1520, 1532, 1540, 1544, 1560, 4, 16, 24, 28,
+    32, 36, 40, 44, 76, 92, 104, 112, 120, 140, 144, 148,
+    152, 156, 164, 176, 180, 208, 220, 224, 228, 236, 240, 260,
+    268, 272, 276, 280, 284, 296, 320, 340, 356, 372, 376, 380,
+    388, 396, 408, 412, 416, 424, 428, 432, 436, 492, 508, 516,
+    520, 536, 540, 548, 552, 556, 560, 564, 568, 576, 580, 600,
+    604, 608, 616, 620, 624, 628, 632, 652, 656, 660, 672, 676,
+    680, 692, 696, 708, 712, 716, 720, 728, 736, 744, 764, 768,
+    784, 796, 800, 804, 808, 820, 824, 836, 840, 848, 852, 856,
+    860, 864, 868, 876, 880, 900, 904, 908, 912, 916, 920, 936,
+    940, 944, 952, 960, 976, 980, 984, 996, 1004, 1012, 1016, 1020,
+    1024, 1028, 1032, 1036, 1040, 1044, 1052, 1068, 1084, 1088, 1092, 1100,
+    1108, 1112, 1128, 1140, 1144, 1152, 1156, 1160, 1164, 1168, 1172, 1184,
+    1188, 1192, 1196, 1204, 1208, 1212, 1240, 1244, 1248, 1260, 1284, 1288,
+    1296, 1304, 1312, 1324, 1328, 1336, 1340, 1344, 1348, 1356, 1364, 1368,
+    1372, 1376, 1388, 1396, 1400, 1404, 1416, 1428, 1436, 1440, 1444, 1456,
+    1472, 1476, 1488, 1500, 1512, 1520, 1524, 1532, 1540, 1544, 1552, 1564,
+    4, 12, 16, 24, 44, 52, 56, 76, 92, 96, 100, 104,
+    112, 116, 132, 136, 140, 144, 148, 152, 156, 176, 184, 192,
+    200, 208, 212, 216, 220, 224, 228, 236, 240, 252, 260, 264,
+    272, 276, 280, 284, 288, 300, 304, 324, 328, 348, 352, 356,
+    360, 364, 376, 384, 388, 400, 404, 412, 416, 424, 428, 432,
+    436, 496, 504, 512, 516, 520, 524, 528, 532, 540, 548, 556,
+    560, 580, 592, 600, 608, 612, 616, 632, 652, 660, 676, 688,
+    692, 696, 712, 720, 736, 740, 744, 748, 752, 756, 760, 764,
+    776, 788, 792, 796, 804, 816, 824, 836, 860, 864, 872, 880,
+    900, 904, 908, 912, 916, 920, 924, 936, 940, 952, 956, 960,
+    964, 984, 1004, 1008, 1012, 1020, 1024, 1028, 1032, 1036, 1040, 1044,
+    1048, 1052, 1056, 1068, 1088, 1092, 1096, 1100, 1108, 1128, 1136, 1148,
+    1152, 1160, 1168, 1172, 1184, 1192, 1196, 1228, 1232, 1248, 1252, 1260,
+    1268, 1272, 1276, 1284, 1288, 1292, 1304, 1316, 1324, 1332, 1336, 1340,
+    1348, 1352, 1356, 1364, 1368, 1372, 1376, 1388, 1392, 1396, 1416, 1420,
+    1428, 1432, 1444, 1448, 1472, 1476, 1480, 1496, 1500, 1508, 1520, 1524,
+    1540, 1544, 1560, 1564,
+};
+
+static const uint32_t mnist_cnn_layer4_row_starts[11] = {
+    0, 196, 392, 588, 784, 980, 1176, 1372,
+    1568, 1764, 1960,
+};
+
+// One entry per layer; dense layers have none
+static const SNNSparseWeights mnist_cnn_sparse[5] = {
+    { NULL, NULL, NULL },
+    { NULL, NULL, NULL },
+    { NULL, NULL, NULL },
+    { NULL, NULL, NULL },
+    { mnist_cnn_layer4_values, mnist_cnn_layer4_columns, mnist_cnn_layer4_row_starts },
+};
+
+#endif // MNIST_CNN_SPARSE_H
@@ -0,0 +1,2135 @@
+// Generated by snn_core/Tools/snn_winograd from the mnist_cnn weights.
+// Regenerate with the snn_winograd_headers target after retraining the model.
+#ifndef MNIST_CNN_WINOGRAD_H
+#define MNIST_CNN_WINOGRAD_H
+
+#include <stddef.h>
+
+static const float mnist_cnn_layer0_winograd[256] = {
+    0.0714537352f, 0.164858162f, 0.368791342f, 0.462195784f,
+    0.568301558f, 0.224929392f, 0.287699401f, -0.0556727648f,
+    0.134087592f, -0.237582535f, 0.343814492f, -0.0278556645f,
+    0.630935431f, -0.17751129f, 0.262722522f, -0.545724213f,
+    0.369917423f, -0.494602323f, 0.267047167f, -0.597472548f,
+    0.860299826f, 0.124769732f, 0.384878576f, -0.350651532f,
+    0.0741923004f, -0.0498232394f, 0.182023078f, 0.0580075532f,
+    0.564574718f, 0.569548845f, 0.299854487f, 0.304828584f,
+    0.393761426f, 0.486534715f, -0.0230627991f, 0.0697105154f,
+    0.123092458f, 0.0911148563f, 0.0775519535f, 0.0455743521f,
+    -0.0262483954f, -0.163586766f, -0.224225014f, -0.361563385f,
+    -0.296917349f, -0.559006631f, -0.123610258f, -0.38569954f,
+    0.617784202f, 0.316311717f, -0.00119680166f, -0.302669287f,
+    0.947505355f, 0.0104553103f, 0.163467824f, -0.77358222f,
+    0.134667233f, 0.0393174663f, -0.0560594127f, -0.151409179f,
+    0.464388341f, -0.266538918f, 0.108605206f, -0.622322083f,
+    0.25317958f, 0.302888513f, -0.168306559f, -0.118597619f,
+    -0.397023767f, 0.0574209392f, -0.261767924f, 0.192676783f,
+    -0.227809668f, -0.211164638f, 0.00455375761f, 0.0211987793f,
+    -0.878013015f, -0.456632197f, -0.0889076144f, 0.332473189f,
+    0.119988605f, 0.363154709f, 0.150525898f, 0.393692017f,
+    -0.405282289f, -0.039365381f, 0.0537649989f, 0.419681907f,
+    -0.30886212f, -0.536023676f, -0.0215220377f, -0.248683587f,
+    -0.834133029f, -0.938543797f, -0.118282959f, -0.222693712f,
+    0.356650531f, 0.194213629f, -0.322608411f, -0.485045314f,
+    0.260109395f, 0.340944856f, -0.102669783f, -0.0218343288f,
+    0.0410756208f, 0.0490942672f, -0.138297796f, -0.130279154f,
+    -0.0554655269f, 0.195825487f, 0.0816408023f, 0.332931817f,
+    0.393736631f, 0.919154525f, 0.147631481f, 0.67304939f,
+    -0.11299926f, -0.0962015912f, 0.0335223153f, 0.0503199846f,
+    -0.102057785f, 0.119262025f, 0.0338516086f, 0.255171418f,
+    -0.608793676f, -0.896094084f, -0.0802575499f, -0.367557973f,
+    -0.0971144438f, 0.0166098103f, 0.0504773334f, 0.164201587f,
+    -0.313212276f, -0.244974062f, -0.16569078f, -0.0974525586f,
+    -0.00890791416f, 0.0618847609f, 0.00182994083f, 0.0726226196f,
+    -0.225005746f, -0.199699104f, -0.214338169f, -0.189031526f,
+    -0.522052169f, -0.059919361f, -0.3691535f, 0.0929793045f,
+    0.0932893604f, 0.392845094f, -0.183526322f, 0.116029412f,
+    -0.254424155f, -0.0574203394f, -0.247341305f, -0.0503375009f,
+    0.36091736f, 0.395344138f, -0.0617141537f, -0.0272873882f,
+    0.132804245f, 0.357947588f, -0.0369254649f, 0.188217878f,
+    0.640312791f, 0.341830581f, 0.350210935f, 0.0517287254f,
+    -0.153150469f, -0.21211496f, -0.31115061f, -0.370115101f,
+    0.354358017f, -0.228231981f, 0.0759857595f, -0.506604254f,
+    0.432586908f, 0.483004034f, 0.464517236f, 0.514934361f,
+    -0.139034316f, 0.236095577f, 0.409798682f, 0.78492856f,
+    0.241888255f, 0.251883954f, 0.165221483f, 0.175217181f,
+    -0.329732955f, 0.00497551262f, 0.110502884f, 0.445211351f,
+    0.39208582f, 0.323471785f, 0.382550657f, 0.313936621f,
+    0.37508902f, 0.654029965f, 0.230357304f, 0.509298265f,
+    0.343813747f, 0.177125901f, 0.285363257f, 0.118675411f,
+    0.326816946f, 0.507684112f, 0.133169904f, 0.314037055f,
+    -0.182196245f, 0.156589791f, -0.0261182785f, 0.312667757f,
+    0.182236701f, 0.300668418f, 0.0632918626f, 0.181723565f,
+    -0.296983212f, 0.0281231105f, -0.132191956f, 0.192914367f,
+    0.0674497336f, 0.172201723f, -0.0427818075f, 0.0619701892f,
+    -0.480327964f, -0.721676171f, 0.485501349f, 0.244153112f,
+    0.33142817f, -0.807101011f, 0.357504964f, -0.781024218f,
+    -0.188810617f, 0.150344834f, 0.0470707566f, 0.386226207f,
+    0.622945487f, 0.0649199784f, -0.0809256136f, -0.638951123f,
+    0.459951341f, -0.483043015f, 0.181827039f, -0.761167347f,
+    0.709138751f, 0.27437833f, 0.227257162f, -0.207503244f,
+    0.027892381f, -0.458849043f, 0.25495854f, -0.231782839f,
+    0.277079821f, 0.298572361f, 0.300388753f, 0.321881264f,
+};
+
+static const float mnist_cnn_layer2_winograd[8192] = {
+    -0.0497324876f, -0.0215119496f, 0.0988201946f, 0.127040729f,
+    -0.379346967f, -0.163702518f, -0.040879935f, 0.174764514f,
+    0.0878814757f, 0.0393810645f, 0.0349075571f, -0.0135928541f,
+    -0.241732985f, -0.102809504f, -0.104792565f, 0.034130916f,
+    -0.264075726f, -0.180603862f, 0.0623767823f, 0.145848647f,
+    -0.0641747415f, -0.0311035514f, 0.337395459f, 0.37046665f,
+    -0.0183264911f, 0.0142409541f, 0.0285826065f, 0.0611500517f,
+    0.181574494f, 0.163741261f, 0.303601265f, 0.285768062f,
+    -0.15827322f, -0.117148474f, 0.0318229683f, 0.0729477182f,
+    -0.331016004f, -0.259250045f, -0.0631868914f, 0.0085790623f,
+    0.00444762409f, -0.0204666331f, 0.0489627719f, 0.0240485165f,
+    -0.168295175f, -0.162568212f, -0.0460470989f, -0.0403201394f,
+    0.180366218f, 0.430995852f, 0.325103492f, 0.575733125f,
+    -0.0269786045f, 0.450235784f, 0.24933356f, 0.726547956f,
+    -0.00448276848f, 0.131585583f, 0.0695085824f, 0.205576926f,
+    -0.211827591f, 0.1508255f, -0.00626136363f, 0.356391728f,
+    -0.0289900247f, -0.122824386f, -0.085728161f, -0.179562524f,
+    -0.103230253f, -0.186141133f, -0.214912847f, -0.297823727f,
+    0.0266024377f, -0.170278341f, 0.00841099024f, -0.188469782f,
+    -0.0476377867f, -0.233595073f, -0.120773703f, -0.306730986f,
+    0.126112878f, 0.157946274f, -0.0630250722f, -0.0311916843f,
+    0.0281903297f, -0.0843556523f, -0.183237717f, -0.295783699f,
+    0.082164973f, 0.0187846981f, 0.00834264234f, -0.0550376326f,
+    -0.0157575756f, -0.223517209f, -0.111869998f, -0.319629639f,
+    -0.294056028f, -0.0566405654f, -0.00359531492f, 0.23382014f,
+    -0.311828792f, -0.0221718699f, -0.0409543961f, 0.248702526f,
+    -0.0621506311f, -0.0231012702f, 0.096745193f, 0.13579455f,
+    -0.0799234137f, 0.0113674253f, 0.0593860969f, 0.150676936f,
+    -0.269568235f, -0.569171727f, -0.260117799f, -0.559721291f,
+    -0.477124751f, -1.06042695f, -0.144340605f, -0.727642775f,
+    -0.197329298f, -0.301033944f, -0.12361563f, -0.227320269f,
+    -0.404885799f, -0.792289138f, -0.00783842802f, -0.395241767f,
+    -0.0467866659f, -0.0676594228f, -0.0106887668f, -0.0315615237f,
+    -0.0344650112f, -0.0431359522f, -0.0245612785f, -0.0332322195f,
+    -0.0665089786f, -0.0806325153f, 0.00737623405f, -0.00674729981f,
+    -0.0541873202f, -0.0561090373f, -0.00649627671f, -0.00841799378f,
+    -0.330099463f, -0.131303936f, -0.168776035f, 0.0300194807f,
+    -0.327926099f, -0.0146576166f, -0.185036689f, 0.128231794f,
+    -0.00016168016f, -0.0200562682f, -0.0170998704f, -0.0369944572f,
+    0.00201168144f, 0.096590057f, -0.0333605111f, 0.0612178557f,
+    -0.251484245f, -0.0404285118f, -0.00377967209f, 0.207276061f,
+    -0.438422203f, -0.133862108f, -0.0910608396f, 0.213499263f,
+    0.0683160126f, 0.0257237516f, 0.08147645f, 0.0388841853f,
+    -0.118621968f, -0.0677098557f, -0.0058047194f, 0.0451073945f,
+    -0.015950121f, 0.118039899f, -0.147952721f, -0.0139627056f,
+    -0.0112645905f, 0.122794941f, -0.180097386f, -0.0460378453f,
+    0.0274794493f, 0.00930506829f, -0.00351049099f, -0.021684872f,
+    0.0321649797f, 0.0140601192f, -0.0356551483f, -0.0537600107f,
+    -0.157200918f, 0.068091616f, -0.127793193f, 0.0974993482f,
+    -0.218840778f, 0.0388087332f, -0.137832075f, 0.119817421f,
+    -0.0186621733f, 0.0109153399f, -0.00870936736f, 0.0208681449f,
+    -0.0803020373f, -0.0183675475f, -0.0187482722f, 0.0431862175f,
+    -0.12913762f, -0.014636334f, -0.026168026f, 0.088333264f,
+    -0.163682997f, 0.0306999721f, -0.0571572408f, 0.137225732f,
+    0.0543883294f, 0.0556889065f, 0.0115804849f, 0.0128810611f,
+    0.0198429544f, 0.101025216f, -0.0194087271f, 0.0617735349f,
+    0.0426653475f, -0.147358373f, 0.0319897383f, -0.158033982f,
+    0.198792011f, -0.0166279078f, 0.228634506f, 0.0132145882f,
+    -0.0235192701f, -0.036631614f, 0.074217923f, 0.0611055791f,
+    0.1326074f, 0.0940988511f, 0.270862699f, 0.232354149f,
+    -0.404817253f, -0.148439348f, -0.0155822858f, 0.240795627f,
+    -0.425313592f, -0.149290025f, 0.048615396f, 0.324638963f,
+    -0.0566634908f, -0.00025152415f, -0.0374325588f, 0.0189794078f,
+    -0.0771598369f, -0.00110221654f, 0.0267651286f, 0.102822751f,
+    -0.133224607f, -0.00616367906f, -0.184330195f, -0.0572692752f,
+    -0.205650359f, -0.0158624761f, -0.241809383f, -0.052021496f,
+    -0.175477952f, -0.099199079f, -0.102453955f, -0.0261750873f,
+    -0.247903705f, -0.10889788f, -0.159933135f, -0.02092731f,
+    -0.398358673f, -0.0693448111f, -0.137067914f, 0.191945955f,
+    -0.388454199f, 0.0420209244f, -0.264419317f, 0.166055784f,
+    -0.14244397f, -0.0555291474f, -0.0546683073f, 0.0322465114f,
+    -0.132539511f, 0.055836577f, -0.182019755f, 0.00635633944f,
+    -0.21847178f, -0.00170373172f, -0.117893666f, 0.0988743827f,
+    -0.10516046f, -0.0506817065f, -0.138401702f, -0.0839229524f,
+    -0.058657255f, 0.0536440536f, 0.00666756183f, 0.118968874f,
+    0.0546540543f, 0.00466607511f, -0.0138404816f, -0.0638284609f,
+    0.146595463f, 0.27110365f, 0.0856000409f, 0.210108221f,
+    -0.0143431872f, 0.20251441f, 0.00962454826f, 0.226482153f,
+    -0.192685187f, -0.0742806345f, -0.112394527f, 0.00601002946f,
+    -0.353623837f, -0.14286986f, -0.188370019f, 0.0223839656f,
+    0.148891419f, -0.108759843f, 0.158596337f, -0.0990549177f,
+    0.303779304f, -0.0956573784f, 0.121370926f, -0.278065771f,
+    -0.0264244378f, 0.0639116466f, -0.0567089319f, 0.0336271524f,
+    0.128463447f, 0.0770140961f, -0.0939343572f, -0.145383701f,
+    -0.0726558268f, -0.26502651f, -0.00992262363f, -0.202293307f,
+    0.0332974643f, -0.295938253f, 0.0444571972f, -0.284778535f,
+    -0.0399855226f, 0.078832671f, -0.0832711458f, 0.0355470479f,
+    0.0659677684f, 0.0479209125f, -0.0288913287f, -0.0469381809f,
+    -0.031167727f, 0.0872307569f, -0.0577913821f, 0.0606071018f,
+    0.0736938044f, 0.146751553f, -0.0781697556f, -0.00511201099f,
+    -0.099744685f, -0.0394474864f, -0.0411098078f, 0.0191873908f,
+    0.00511684502f, 0.020073317f, -0.0614881963f, -0.0465317219f,
+    -0.784155428f, -0.602322578f, -0.395480305f, -0.21364744f,
+    -0.915672839f, -0.782934785f, -0.367495447f, -0.234757364f,
+    -0.347606093f, 0.0319998935f, -0.161945134f, 0.217660829f,
+    -0.479123473f, -0.148612291f, -0.133960277f, 0.196550891f,
+    -0.0268963985f, -0.0194247514f, 0.0272214469f, 0.0346930921f,
+    0.0627957806f, -0.00313034654f, 0.0267026871f, -0.03922344f,
+    -0.0198899582f, -0.00384463649f, -0.00425286312f, 0.0117924586f,
+    0.0698022246f, 0.0124497712f, -0.00477162004f, -0.0621240735f,
+    0.0103736306f, 0.0110552311f, -0.13164182f, -0.130960226f,
+    0.0661351755f, 0.0102423206f, -0.151493326f, -0.207386181f,
+    0.0416875072f, 0.0802309886f, -0.0249642078f, 0.0135792755f,
+    0.0974490494f, 0.0794180781f, -0.0448157117f, -0.062846683f,
+    -0.095625639f, -0.00479996577f, -0.177843928f, -0.087018244f,
+    -0.0964265987f, -0.043595396f, -0.163501501f, -0.110670306f,
+    -0.0255660005f, -0.0268470831f, -0.075718686f, -0.0769997686f,
+    -0.0263669621f, -0.0656425133f, -0.0613762811f, -0.10065183f,
+    0.11832194f, 0.00883161649f, 0.00647539273f, -0.103014931f,
+    0.295418441f, 0.00285755098f, 0.0449098796f, -0.247651011f,
+    0.00932268053f, -0.0397569127f, -0.0885931849f, -0.137672782f,
+    0.186419189f, -0.0457309783f, -0.0501587093f, -0.282308877f,
+    0.10261368f, 0.00873621553f, -0.100899249f, -0.194776714f,
+    0.0940519795f, 0.00206613541f, -0.166975543f, -0.25896138f,
+    0.0333692133f, 0.051451169f, 0.0168504231f, 0.0349323787f,
+    0.0248075165f, 0.0447810926f, -0.0492258631f, -0.0292522833f,
+    0.0514241681f, 0.0165461153f, -0.100540012f, -0.135418057f,
+    0.0464906804f, -0.0707357526f, -0.106391206f, -0.223617643f,
+    0.0469575077f, 0.0201228615f, 0.0107916202f, -0.016043026f,
+    0.0420240201f, -0.067159012f, 0.00494041666f, -0.104242615f,
+    -0.177080691f, -0.069206059f, -0.0461362414f, 0.0617383942f,
+    -0.0123009011f, -0.0457415096f, -0.0136436783f, -0.0470842868f,
+    -0.0305524841f, -0.17905736f, 0.0216950327f, -0.126809835f,
+    0.134227306f, -0.155592799f, 0.0541876107f, -0.235632509f,
+    -0.214189649f, -0.138432413f, -0.0629099309f, 0.012847309f,
+    -0.204858303f, -0.0506348163f, -0.192080379f, -0.037856888f,
+    -0.202884331f, -0.114997461f, -0.0351973176f, 0.0526895486f,
+    -0.193552986f, -0.0271998756f, -0.164367765f, 0.00198534946f,
+    0.0605563633f, 0.0937740952f, -0.122810572f, -0.0895928517f,
+    -0.187283143f, -0.0549490713f, -0.14689599f, -0.0145619214f,
+    0.17928417f, 0.168924272f, 0.0314023048f, 0.0210423954f,
+    -0.0685553178f, 0.0202011019f, 0.00731690973f, 0.0960733294f,
+    0.227624968f, 0.221219778f, -0.133098483f, -0.139503658f,
+    -0.0775669515f, 0.22879833f, -0.264325559f, 0.0420397297f,
+    -0.129468918f, -0.138052315f, -0.180284232f, -0.188867629f,
+    -0.434660852f, -0.130473778f, -0.311511308f, -0.00732423691f,
+    -0.15464443f, -0.162376106f, -0.137460798f, -0.145192474f,
+    -0.137926191f, -0.0900665075f, -0.060857743f, -0.0129980594f,
+    -0.200899556f, -0.0157570019f, -0.105284862f, 0.0798576921f,
+    -0.184181318f, 0.0565526038f, -0.0286818147f, 0.212052107f,
+    0.325352639f, 0.288659096f, 0.0210288391f, -0.0156647135f,
+    -0.300211549f, -0.16999425f, -0.155814275f, -0.0255969763f,
+    0.183877483f, 0.0822023675f, 0.0767332092f, -0.0249419119f,
+    -0.44168672f, -0.376451015f, -0.100109905f, -0.0348741747f,
+    0.288277626f, 0.295779705f, 0.389977872f, 0.397479922f,
+    0.391375184f, 0.436830521f, 0.272640467f, 0.318095803f,
+    -0.21931386f, 0.0197923183f, 0.0263411403f, 0.265447319f,
+    -0.116216317f, 0.160843149f, -0.0909962878f, 0.186063185f,
+    0.0598094799f, 0.00954429433f, 0.0868035778f, 0.0365383886f,
+    -0.0157677159f, -0.0646626428f, -0.0323280543f, -0.0812229812f,
+    -0.172170222f, 0.0405504704f, 0.00435426831f, 0.21707496f,
+    -0.247747421f, -0.0336564742f, -0.114777356f, 0.0993135944f,
+    0.188793138f, -0.0270890072f, 0.0303179398f, -0.185564205f,
+    0.0745852366f, 0.0292881504f, -0.0708854049f, -0.116182491f,
+    -0.0726695731f, -0.096270293f, -0.0263770279f, -0.0499777533f,
+    -0.186877474f, -0.0398931392f, -0.12758036f, 0.0194039699f,
+    -0.590812385f, -0.463710338f, -0.0832164586f, 0.0438855849f,
+    -0.252818644f, 0.028176263f, 0.0341367871f, 0.315131694f,
+    -0.323410094f, -0.116644874f, -0.00801981986f, 0.1987454f,
+    0.0145836528f, 0.375241727f, 0.109333426f, 0.469991505f,
+    -0.0741995797f, -0.0216918625f, -0.0171084963f, 0.0353992209f,
+    -0.0453248508f, -0.0298396796f, 0.0167359095f, 0.0322210789f,
+    0.0292846709f, 0.05288326f, 0.0529149845f, 0.0765135735f,
+    0.0581594035f, 0.0447354428f, 0.0867593884f, 0.0733354315f,
+    0.0938610882f, -0.0614908673f, 0.0788721144f, -0.0764798447f,
+    -0.0261846203f, 0.0147485491f, 0.00307878852f, 0.0440119579f,
+    0.127734929f, -0.0358331837f, 0.0670863241f, -0.0964817926f,
+    0.00768921757f, 0.0404062346f, -0.0087070046f, 0.0240100119f,
+    0.00181318272f, -0.0598201416f, -0.0785708204f, -0.140204147f,
+    -0.0966160297f, -0.0506073684f, -0.0982743502f, -0.0522656888f,
+    0.0208618231f, 0.096284993f, -0.0399792716f, 0.0354439057f,
+    -0.0775673836f, 0.10549777f, -0.0596827939f, 0.12338236f,
+    -0.0435036831f, -0.104373887f, -0.0322117284f, -0.0930819362f,
+    0.00380812213f, -0.0266205519f, 0.0100200614f, -0.0204086136f,
+    -0.169289038f, -0.188488454f, -0.0948205441f, -0.11401996f,
+    -0.121977232f, -0.110735118f, -0.0525887534f, -0.0413466431f,
+    0.0605351292f, -0.22342661f, -0.00817318261f, -0.292134911f,
+    0.0420349017f, -0.120105967f, -0.0349282548f, -0.197069123f,
+    0.0368580595f, -0.131312236f, 0.0199684873f, -0.148201808f,
+    0.0183578357f, -0.0279916003f, -0.0067865923f, -0.0531360283f,
+    -0.0420497991f, -0.18350926f, -0.159119219f, -0.300578684f,
+    -0.0349082015f, -0.131100386f, -0.0253634416f, -0.121555619f,
+    0.0456960499f, -0.0702195317f, -0.030302003f, -0.146217585f,
+    0.0528376475f, -0.0178106371f, 0.10345377f, 0.0328054838f,
+    -0.0164493658f, 0.0260931421f, 0.0155720133f, 0.0581145212f,
+    0.0194375739f, -0.126939893f, -0.2121889f, -0.358566374f,
+    -0.0624481663f, -0.0365908444f, 0.219081491f, 0.244938821f,
+    -0.0265612323f, -0.189623892f, -0.00867943466f, -0.171742097f,
+    0.113204569f, 0.0986334458f, -0.100983344f, -0.115554467f,
+    -0.0406177565f, 0.207071036f, -0.155565202f, 0.0921235979f,
+    -0.10931889f, -0.0977787822f, -0.1674954f, -0.1559553f,
+    -0.263141215f, 0.0106588043f, -0.22207725f, 0.0517227575f,
+    -0.0291508976f, 0.136129037f, -0.0612514727f, 0.104028471f,
+    0.0796822533f, 0.0201177821f, -0.176992282f, -0.236556754f,
+    -0.14564842f, 0.0127137043f, -0.0222377405f, 0.136124387f,
+    -0.0368152708f, -0.103297547f, -0.137978554f, -0.204460829f,
+    -0.444288462f, -0.0529668853f, -0.224247187f, 0.167074397f,
+    -0.315576255f, -0.0479783863f, -0.2598584f, 0.00773945637f,
+    -0.011421334f, 0.122296341f, 0.0684891045f, 0.202206776f,
+    0.117290862f, 0.127284825f, 0.0328778699f, 0.0428718366f,
+    -0.0683185682f, 0.0270541087f, -0.0694718212f, 0.0259008538f,
+    -0.0304074921f, -0.0868811384f, -0.14979139f, -0.206265032f,
+    0.0053502582f, 0.0207506623f, 0.0807644576f, 0.0961648598f,
+    0.0432613343f, -0.0931845754f, 0.00044490397f, -0.136001006f,
+    0.127175197f, 0.396430016f, -0.0147860944f, 0.254468739f,
+    0.388100028f, 0.455036581f, -0.145350277f, -0.0784137398f,
+    0.0698487833f, 0.0706989542f, -0.0304540284f, -0.0296038538f,
+    0.330773622f, 0.129305497f, -0.161018223f, -0.362486333f,
+    -0.0953290984f, -0.407094002f, 0.0485745221f, -0.263190389f,
+    -0.41212064f, -0.801187456f, 0.00568792224f, -0.383378863f,
+    -0.0383351594f, -0.00211846828f, 0.154379591f, 0.190596282f,
+    -0.355126679f, -0.396211863f, 0.111492991f, 0.0704078153f,
+    -0.15445213f, -0.282040536f, -0.111914329f, -0.239502743f,
+    -0.433963358f, -0.44800815f, -0.031541802f, -0.0455866009f,
+    -0.108806603f, -0.00139939785f, -0.0471895672f, 0.0602176413f,
+    -0.388317823f, -0.167366996f, 0.0331829637f, 0.254133791f,
+    0.0989400372f, 0.129892409f, -0.0536575876f, -0.0227052122f,
+    0.151446372f, 0.0727542043f, -0.124835335f, -0.20352751f,
+    0.0342451595f, 0.0938142836f, 0.0250715259f, 0.0846406519f,
+    0.0867514983f, 0.0366760828f, -0.0461062118f, -0.0961816236f,
+    -0.552915633f, -0.44705373f, -0.387433529f, -0.281571627f,
+    -0.677628398f, -0.542934716f, -0.34672296f, -0.212029278f,
+    -0.159948766f, 0.0991958454f, -0.0984754488f, 0.160669163f,
+    -0.284661591f, 0.00331483781f, -0.0577649325f, 0.230211496f,
+    0.0202456228f, 0.0278555397f, -0.0230967961f, -0.0154868765f,
+    0.00555923674f, -0.00115456712f, -0.0119098518f, -0.0186236557f,
+    0.00701863598f, -0.000521067996f, 0.0209876187f, 0.0134479161f,
+    -0.00766775012f, -0.0295311753f, 0.0321745612f, 0.010311137f,
+    0.258942544f, -0.00327335298f, -0.120026216f, -0.382242113f,
+    0.337634206f, 0.105528384f, -0.0036239028f, -0.235729724f,
+    0.0847177356f, 0.0304990374f, 0.0512309559f, -0.00298774242f,
+    0.163409382f, 0.139300764f, 0.167633265f, 0.143524647f,
+    0.150445729f, 0.180034965f, -0.0981098413f, -0.0685205981f,
+    0.180629104f, 0.0839695483f, -0.145566642f, -0.242226213f,
+    0.074808836f, 0.10513673f, 0.0221742634f, 0.052502159f,
+    0.104992196f, 0.00907130912f, -0.0252825543f, -0.121203445f,
+    0.166549817f, -0.146124035f, -0.133641213f, -0.44631508f,
+    0.0968301967f, -0.281130701f, -0.0903282315f, -0.468289137f,
+    -0.00319765136f, -0.089192085f, -0.0745142251f, -0.160508662f,
+    -0.0729172677f, -0.224198759f, -0.0312012359f, -0.182482734f,
+    0.197455615f, -0.0432906151f, -0.197858244f, -0.438604474f,
+    0.230823457f, -0.0243034661f, -0.159301192f, -0.414428115f,
+    0.122575067f, 0.110585883f, 0.0149067724f, 0.00291758217f,
+    0.155942917f, 0.129573017f, 0.0534638464f, 0.0270939358f,
+    0.172849476f, 0.0725994408f, -0.0839709267f, -0.18422097f,
+    0.225878209f, 0.0176045895f, -0.0270963088f, -0.235369921f,
+    0.0257098973f, 0.0145201404f, -0.016229568f, -0.027419325f,
+    0.0787386447f, -0.0404746942f, 0.0406450517f, -0.0785682872f,
+    -0.262812406f, -0.079934299f, -0.0706186295f, 0.112259485f,
+    -0.338377237f, -0.311576456f, -0.08281634f, -0.0560155697f,
+    0.0110448226f, -0.0878338888f, 0.0407936275f, -0.0580850877f,
+    -0.0645200163f, -0.319476068f, 0.0285958946f, -0.226360142f,
+    -0.171890363f, -0.0434342623f, -0.147813365f, -0.0193572585f,
+    -0.145734116f, -0.0504162088f, -0.187420651f, -0.0921027362f,
+    0.0039558094f, 0.119634658f, 0.0846712515f, 0.200350106f,
+    0.0301120691f, 0.112652726f, 0.0450639799f, 0.127604634f,
+    -0.356657118f, -0.497006387f, -0.0814258307f, -0.221775115f,
+    -0.10042043f, 0.00337601453f, 0.0042277649f, 0.10802421f,
+    0.217135623f, -0.181344539f, 0.151198462f, -0.2472817f,
+    0.47337231f, 0.319037884f, 0.236852065f, 0.0825176239f,
+    -0.278133929f, -0.310882717f, -0.274980158f, -0.307728946f,
+    -0.317987204f, -0.520817876f, -0.307430714f, -0.510261416f,
+    -0.0515030138f, -0.0961540416f, -0.0656463802f, -0.110297412f,
+    -0.09135627f, -0.306089222f, -0.0980969071f, -0.312829852f,
+    -0.188363761f, -0.224216565f, -0.0592841394f, -0.0951369479f,
+    -0.0622564405f, -0.00685135648f, 0.0417578779f, 0.097162962f,
+    0.0104263574f, -0.0530727059f, -0.108616978f, -0.172116041f,
+    0.136533678f, 0.164292514f, -0.00757496618f, 0.020183865f,
+    -0.655180097f, -0.808566451f, -0.417331189f, -0.570717514f,
+    -0.68971169f, -0.64332068f, -0.289450526f, -0.243059486f,
+    0.112715662f, 0.0202471167f, -0.0407179408f, -0.133186489f,
+    0.0781840757f, 0.185492888f, 0.0871627331f, 0.194471538f,
+    -0.225392431f, -0.429745734f, -0.391724914f, -0.596078217f,
+    -0.584246039f, -0.763789535f, -0.539830208f, -0.719373703f,
+    -0.383436024f, -0.445470542f, -0.439333528f, -0.501368046f,
+    -0.742289662f, -0.779514313f, -0.587438822f, -0.624663532f,
+    -0.131945983f, -0.286596298f, 0.044115942f, -0.110534362f,
+    -0.117066525f, -0.21519345f, 0.00205650553f, -0.0960704237f,
+    -0.184678763f, -0.401687026f, -0.134431377f, -0.351439655f,
+    -0.169799313f, -0.330284238f, -0.176490813f, -0.336975724f,
+    -0.36543262f, -0.262606651f, -0.202746838f, -0.099920854f,
+    -0.18242082f, -0.0897031575f, -0.174923092f, -0.0822054297f,
+    -0.100641496f, -0.0858260766f, -0.017200131f, -0.00238470873f,
+    0.0823702961f, 0.0870774016f, 0.0106236059f, 0.0153307142f,
+    0.209312841f, 0.229851127f, -0.142994791f, -0.122456498f,
+    0.0946254581f, 0.25554204f, 0.125765994f, 0.286682576f,
+    0.226037562f, 0.146270737f, -0.226879552f, -0.306646377f,
+    0.111350186f, 0.171961665f, 0.0418812409f, 0.102492712f,
+    0.00326929498f, 0.00684908032f, 0.0492791049f, 0.0528588891f,
+    -0.0187377054f, 0.0100328438f, 0.0537040867f, 0.0824746341f,
+    -0.0571117699f, -0.0268846806f, 0.00617133267f, 0.036398422f,
+    -0.0791187733f, -0.023700919f, 0.0105963089f, 0.0660141632f,
+    -0.203339681f, -0.15373531f, 0.00771199726f, 0.057316374f,
+    -0.0199905485f, 0.108053438f, -0.00372711569f, 0.124316871f,
+    0.14516753f, -0.0982574821f, 0.0648818016f, -0.17854321f,
+    0.328516662f, 0.163531274f, 0.0534426831f, -0.111542709f,
+    -0.258394212f, -0.505526125f, -0.0108762383f, -0.258008152f,
+    -0.147097081f, -0.0196368843f, 0.000784114003f, 0.128244311f,
+    0.185527265f, -0.150924996f, 0.0978900939f, -0.238562167f,
+    0.296824396f, 0.334964246f, 0.109550446f, 0.147690296f,
+    -0.478900313f, -0.306223065f, 0.0598512515f, 0.232528493f,
+    -0.159141451f, -0.105118044f, 0.049839586f, 0.103862986f,
+    -0.326372534f, -0.238731995f, -0.182502732f, -0.0948621854f,
+    -0.00661364757f, -0.0376269668f, -0.192514375f, -0.2235277f,
+    -0.422628969f, -0.263762236f, -0.0683981776f, 0.0904685482f,
+    -0.138899922f, -0.072325252f, -0.0815389082f, -0.0149642378f,
+    -0.152172208f, -0.220002562f, -0.082417734f, -0.150248095f,
+    0.131556824f, -0.0285655856f, -0.0955584794f, -0.255680889f,
+    -0.197002262f, -0.123367071f, -0.0526107848f, 0.0210244078f,
+    -0.0285646468f, 0.143607959f, -0.00944057107f, 0.162732035f,
+    0.0944036692f, -0.0634356439f, 0.0453157872f, -0.112523526f,
+    0.262841284f, 0.203539386f, 0.0884860009f, 0.0291841049f,
+    0.0399727225f, -0.131156623f, -0.183252409f, -0.35438177f,
+    -0.115833879f, -0.264346063f, -0.221277937f, -0.369790137f,
+    -0.13084659f, -0.0215503834f, -0.100886792f, 0.0084094163f,
+    -0.286653191f, -0.154739842f, -0.138912305f, -0.00699894456f,
+    -0.196103856f, -0.11786218f, -0.133700356f, -0.0554586761f,
+    -0.0750903636f, -0.12703082f, -0.190966517f, -0.242906988f,
+    0.0556193665f, -0.0157495327f, 0.0890228748f, 0.0176539719f,
+    0.176632851f, -0.0249181874f, 0.0317567065f, -0.169794336f,
+    -0.357620239f, -0.390265584f, -0.137555972f, -0.170201302f,
+    0.0226802826f, -0.19496949f, -0.0841705054f, -0.301820278f,
+    -0.114376575f, -0.0362296924f, 0.00184685737f, 0.0799937397f,
+    0.265923947f, 0.159066379f, 0.0552323163f, -0.0516252518f,
+    -0.480362415f, -0.511363864f, -0.410841167f, -0.441842616f,
+    -0.00127960742f, 0.260708779f, 0.0593520626f, 0.321340442f,
+    -0.225673079f, -0.122641183f, -0.219547838f, -0.116515934f,
+    0.253409743f, 0.649431467f, 0.250645399f, 0.646667123f,
+    -0.0179840736f, 0.124542862f, 0.135728255f, 0.278255194f,
+    -0.00981332734f, -0.0652833357f, -0.012640262f, -0.0681102723f,
+    0.0635157675f, 0.354473591f, 0.204791784f, 0.495749593f,
+    0.0716865137f, 0.164647385f, 0.0564232729f, 0.149384141f,
+    -0.692615032f, -0.874936223f, -0.360876411f, -0.543197632f,
+    -0.356688112f, -0.861229777f, -0.381190002f, -0.885731637f,
+    -0.162585229f, -0.292493641f, -0.0417829752f, -0.171691388f,
+    0.173341677f, -0.278787136f, -0.0620965362f, -0.514225364f,
+    -0.109937765f, 0.109899953f, -0.0538439825f, 0.165993735f,
+    -0.126230612f, 0.210899368f, -0.175535008f, 0.161594957f,
+    0.142414048f, 0.321012706f, 0.196110368f, 0.37470901f,
+    0.126121193f, 0.422012091f, 0.0744193345f, 0.370310247f,
+    0.128762066f, 0.366398931f, 0.20496434f, 0.442601204f,
+    -0.0995198637f, 0.144419283f, -0.0443274528f, 0.199611694f,
+    0.174801722f, 0.252296329f, 0.196386844f, 0.273881465f,
+    -0.0534802042f, 0.0303166974f, -0.0529049523f, 0.0308919474f,
+    -0.404378414f, -0.479461551f, -0.26888454f, -0.343967706f,
+    -0.0889227763f, -0.173555478f, -0.112859458f, -0.197492152f,
+    -0.232402116f, -0.117299139f, -0.0644575804f, 0.0506454036f,
+    0.0830535144f, 0.188606948f, 0.0915675163f, 0.19712095f,
+    0.344088078f, 0.477847666f, 0.320515186f, 0.454274774f,
+    0.0720877275f, 0.146989763f, 0.128858984f, 0.203761011f,
+    0.296007842f, 0.381637573f, 0.210592598f, 0.296222329f,
+    0.0240074899f, 0.0507796481f, 0.0189364105f, 0.0457085669f,
+    -0.0718252808f, -0.0665176809f, -0.0629461855f, -0.0576385856f,
+    0.00730288029f, -0.00936418399f, 0.0320142023f, 0.015347138f,
+    -0.007376872f, -0.0174435675f, -0.0445755795f, -0.054642275f,
+    0.0717512891f, 0.0397099331f, 0.0503848046f, 0.0183434486f,
+    -0.177660048f, -0.391376644f, -0.075922668f, -0.289639264f,
+    0.0827487409f, -0.147071123f, -0.0002739802f, -0.230093837f,
+    -0.108792208f, -0.159994259f, -0.0674279332f, -0.118629992f,
+    0.151616588f, 0.0843112618f, 0.00822076201f, -0.059084557f,
+    -0.374755353f, -0.25183332f, -0.0842769369f, 0.0386451147f,
+    -0.0013699457f, -0.113521323f, -0.0298251845f, -0.141976565f,
+    -0.12958017f, 0.0397442505f, 0.0936214998f, 0.26294592f,
+    0.243805245f, 0.17805624f, 0.148073256f, 0.0823242515f,
+    -0.122708268f, -0.144465119f, 0.114683248f, 0.0929263979f,
+    -0.000348307192f, -0.137670666f, 0.0733622089f, -0.0639601499f,
+    0.0794233829f, 0.0735692978f, 0.117964596f, 0.112110518f,
+    0.201783344f, 0.080363743f, 0.0766435638f, -0.0447760411f,
+    -0.361366302f, -0.443480283f, -0.113326661f, -0.195440635f,
+    -0.101841018f, -0.18358627f, -0.0590725616f, -0.140817806f,
+    -0.172930375f, -0.109428719f, 0.0438605547f, 0.107362211f,
+    0.086594902f, 0.150465295f, 0.098114647f, 0.16198504f,
+    -0.312476128f, -0.326748967f, -0.115338206f, -0.129611045f,
+    -0.0688257664f, -0.229376286f, -0.0592074469f, -0.219757974f,
+    -0.185874477f, -0.121911176f, -0.0407101773f, 0.0232531279f,
+    0.0577758849f, -0.0245384946f, 0.0154205784f, -0.0668938011f,
+    -0.0928309783f, -0.0553894565f, 0.0134655964f, 0.0509071164f,
+    -0.145433918f, -0.0205131024f, 0.0464986116f, 0.171419427f,
+    -0.0639345348f, -0.0301253535f, -0.0232064836f, 0.0106026977f,
+    -0.116537474f, 0.00475100055f, 0.00982652977f, 0.131115004f,
+    -0.355134517f, -0.557065845f, -0.351231992f, -0.55316335f,
+    -0.00259324163f, 0.0800911486f, -0.058459878f, 0.0242245197f,
+    -0.211761698f, -0.188976914f, -0.153771907f, -0.130987108f,
+    0.140779585f, 0.448180109f, 0.139000237f, 0.446400762f,
+    0.201772735f, 0.185744792f, 0.153814957f, 0.137787014f,
+    0.0785443559f, 0.0526999459f, 0.0791420192f, 0.0532976054f,
+    0.0902235135f, 0.0252365656f, 0.150347471f, 0.0853605121f,
+    -0.0330048688f, -0.107808284f, 0.0756745264f, 0.000871099881f,
+    0.182785511f, 0.159808278f, 0.0727197677f, 0.0497425348f,
+    0.0943920463f, 0.0955796838f, 0.0927694663f, 0.0939571038f,
+    0.287813634f, 0.173473567f, 0.0976827964f, -0.0166572742f,
+    0.199420169f, 0.109244972f, 0.117732495f, 0.0275573004f,
+    0.137371331f, 0.0559286624f, 0.091867879f, 0.0104252119f,
+    0.176744521f, 0.088252157f, 0.061585933f, -0.0269064326f,
+    -0.119540602f, -0.184193224f, 0.0441285893f, -0.0205240399f,
+    -0.0801674053f, -0.151869729f, 0.0138466377f, -0.0578556843f,
+    -0.230299115f, -0.388815641f, 0.0077733919f, -0.150743142f,
+    -0.26413995f, -0.383893043f, 0.044576671f, -0.0751764253f,
+    -0.105273858f, -0.0636202842f, 0.066915676f, 0.10856925f,
+    -0.139114693f, -0.0586976781f, 0.103718951f, 0.184135959f,
+    -0.0770459846f, -0.17692408f, 0.0784711316f, -0.0214069672f,
+    0.0832289159f, 0.199514553f, 0.0369889289f, 0.153274566f,
+    -0.194217205f, -0.265635848f, -0.0681441575f, -0.139562815f,
+    -0.0339423195f, 0.11080277f, -0.109626353f, 0.0351187214f,
+    -0.166622758f, -0.131110296f, -0.0380775221f, -0.00256507052f,
+    -0.00442344975f, 0.0673963428f, 0.0494836271f, 0.121303417f,
+    -0.168222263f, -0.163613215f, 0.0162001811f, 0.0208092257f,
+    -0.00602296554f, 0.0348934233f, 0.103761323f, 0.144677714f,
+    0.187246189f, 0.10935989f, 0.117571086f, 0.0396847799f,
+    0.139875874f, 0.0186602362f, 0.0844843984f, -0.0367312357f,
+    0.0789675564f, 0.0476887412f, 0.0406508557f, 0.00937204063f,
+    0.0315972492f, -0.0430109054f, 0.0075641796f, -0.067043975f,
+    0.0615301915f, 0.0608859956f, 0.110316046f, 0.109671846f,
+    0.287757903f, 0.413152039f, 0.186160907f, 0.311555028f,
+    -0.131785095f, -0.0467803553f, 0.0748090968f, 0.159813836f,
+    0.0944426134f, 0.305485666f, 0.150653958f, 0.361697018f,
+    -0.0722282678f, -0.0518561304f, 0.0195031315f, 0.0398752689f,
+    -0.030549746f, -0.0222738739f, 0.0033889534f, 0.0116648264f,
+    -0.0659617111f, -0.0188958049f, 0.0452081636f, 0.0922740698f,
+    -0.0242831912f, 0.0106864534f, 0.0290939882f, 0.064063631f,
+    0.135838494f, 0.0495642014f, 0.0786001086f, -0.00767418183f,
+    -0.0250842739f, -0.101661406f, -0.0320260152f, -0.10860315f,
+    0.098598592f, 0.107047535f, 0.0283265468f, 0.0367754884f,
+    -0.0623241775f, -0.0441780686f, -0.0822995752f, -0.0641534701f,
+    0.0870585218f, -0.00851956941f, 0.0365745127f, -0.0590035766f,
+    0.0820416883f, 0.0321564078f, 0.0259769112f, -0.0239083692f,
+    -0.0552097112f, -0.0489425287f, 0.0496747717f, 0.055941958f,
+    -0.0602265485f, -0.00826655328f, 0.0390771702f, 0.0910371691f,
+    -0.12836197f, 0.0476426855f, -0.078629896f, 0.0973747671f,
+    -0.116930656f, 0.0408791862f, -0.0303976089f, 0.12741223f,
+    -0.162414849f, -0.0924640223f, -0.0265850071f, 0.0433658175f,
+    -0.150983527f, -0.0992275178f, 0.021647267f, 0.0734032765f,
+    0.0105131529f, 0.0225767829f, -0.0165188536f, -0.00445522321f,
+    -0.0339391455f, -0.0609528869f, 0.0664327592f, 0.0394190215f,
+    -0.030696582f, -0.0110253561f, -0.0313918069f, -0.0117205828f,
+    -0.0751488805f, -0.0945550203f, 0.0515598059f, 0.0321536623f,
+    0.139388382f, 0.093140915f, 0.0530676544f, 0.00682018697f,
+    0.00725752581f, -0.00840735994f, 0.0268677529f, 0.0112028681f,
+    0.113467462f, 0.118801109f, 0.0244309958f, 0.0297646411f,
+    -0.0186633896f, 0.0172528364f, -0.00176890381f, 0.0341473222f,
+    -0.368685991f, -0.224056989f, -0.350806743f, -0.206177756f,
+    -0.408893198f, -0.325554729f, -0.343747973f, -0.260409504f,
+    -0.122423105f, -0.156654015f, -0.0847296864f, -0.118960589f,
+    -0.162630305f, -0.25815171f, -0.0776709244f, -0.173192337f,
+    0.232763767f, 0.221536145f, 0.0520709045f, 0.0408432856f,
+    0.179596335f, 0.207317203f, 0.0328886062f, 0.0606094748f,
+    0.165879771f, 0.0695699677f, -0.007747747f, -0.10405755f,
+    0.112712346f, 0.0553510264f, -0.0269300491f, -0.0842913687f,
+    0.125964135f, -0.061290063f, 0.198590711f, 0.0113365175f,
+    0.186334893f, 0.0567516796f, 0.0677438974f, -0.0618393198f,
+    -0.0632030591f, -0.0671424195f, 0.0238671415f, 0.0199277829f,
+    -0.00283230585f, 0.0508993119f, -0.106979683f, -0.053248059f,
+    0.549254f, 0.103599668f, 0.0425295085f, -0.403124809f,
+    0.418572247f, 0.381192416f, -0.00328817964f, -0.0406680107f,
+    0.118398644f, 0.0643333048f, 0.0263126679f, -0.0277526677f,
+    -0.0122831054f, 0.341926038f, -0.019505024f, 0.334704131f,
+    -0.205989569f, -0.300017595f, 0.0276655369f, -0.0663624778f,
+    -0.0591133572f, -0.401876748f, 0.0199762136f, -0.322787195f,
+    -0.212805346f, -0.0950103998f, -0.000161297619f, 0.117633648f,
+    -0.0659291372f, -0.196869582f, -0.00785062835f, -0.138791069f,
+    0.16650942f, -0.249389634f, 0.0371159464f, -0.378783107f,
+    0.114787526f, -0.0323410928f, 0.057522323f, -0.0896062925f,
+    0.0248608459f, -0.0988247991f, -0.0868874937f, -0.210573137f,
+    -0.026861053f, 0.118223727f, -0.0664811134f, 0.07860367f,
+    -0.289263457f, 0.00121891312f, -0.244636148f, 0.0458462201f,
+    -0.0712255388f, -0.012455985f, -0.251797676f, -0.193028122f,
+    -0.120962068f, 0.0317432955f, -0.313557923f, -0.160852551f,
+    0.0970758498f, 0.018068403f, -0.320719451f, -0.399726897f,
+    -0.302925438f, 0.0148203745f, -0.0615580678f, 0.256187737f,
+    -0.40015161f, -0.230719209f, -0.20651558f, -0.0370831937f,
+    -0.156371683f, -0.0899461135f, -0.0720791742f, -0.00565360487f,
+    -0.253597885f, -0.335485727f, -0.217036694f, -0.298924536f,
+    0.0828856602f, -0.130785704f, 0.0456988662f, -0.167972505f,
+    0.302390695f, 0.0480054282f, 0.182245985f, -0.0721392855f,
+    0.00261537731f, -0.0359928459f, -0.00169672631f, -0.0403049514f,
+    0.222120434f, 0.142798305f, 0.134850413f, 0.0555282682f,
+    -0.0985804424f, -0.0796792507f, 0.0528461076f, 0.071747303f,
+    -0.479747117f, -0.918209434f, -0.319715738f, -0.758178055f,
+    0.0269157737f, -0.0840876177f, 0.0848459527f, -0.0261574388f,
+    -0.354250908f, -0.922617793f, -0.287715882f, -0.856082797f,
+    0.0619463623f, 0.0276299119f, 0.0339882672f, -0.000328183174f,
+    0.0348115079f, -0.0181679279f, 0.0217050575f, -0.0312743783f,
+    0.103083059f, 0.0726692304f, 0.0422907248f, 0.0118769016f,
+    0.0759482011f, 0.0268713925f, 0.0300075132f, -0.0190692954f,
+    0.143759236f, -0.0427364931f, 0.216267109f, 0.0297713857f,
+    0.135281548f, -0.0191852637f, 0.151053071f, -0.00341374427f,
+    -0.00909727253f, 0.0214740001f, 0.0839192644f, 0.114490539f,
+    -0.0175749548f, 0.0450252369f, 0.0187052153f, 0.081305407f,
+    0.0202542655f, -0.0821615085f, 0.120343052f, 0.0179272778f,
+    0.0719665438f, -0.0542601943f, 0.0547885299f, -0.0714382082f,
+    -0.0516338795f, -0.100130953f, 0.0691868141f, 0.0206897371f,
+    7.83921714e-05f, -0.0722296387f, 0.0036322847f, -0.068675749f,
+    -0.450151145f, -0.230420381f, 0.0156162232f, 0.235346973f,
+    -0.0981619954f, -0.0439338349f, -0.0122618936f, 0.0419662669f,
+    -0.201102257f, -0.160422266f, 0.00547125563f, 0.0461512432f,
+    0.150886893f, 0.0260642916f, -0.0224068612f, -0.147229463f,
+    -0.0326880738f, -0.220476046f, 0.137109473f, -0.0506785028f,
+    0.100122139f, -0.0563179143f, 0.0646861196f, -0.0917539373f,
+    -0.0809540302f, -0.0663729161f, 0.00454151444f, 0.0191226266f,
+    0.05185619f, 0.0977852196f, -0.0678818375f, -0.0219528135f,
+    0.00404460542f, -0.119623519f, 0.0776741281f, -0.0459939949f,
+    0.00444353744f, -0.130346447f, 0.0396894179f, -0.0951005742f,
+    -0.0539332628f, -0.0480390452f, -0.031268578f, -0.0253743585f,
+    -0.0535343289f, -0.0587619841f, -0.0692532808f, -0.0744809359f,
+    0.153971374f, 0.17493704f, 0.0228174105f, 0.0437830687f,
+    0.0497479886f, 0.155207992f, -0.0385203362f, 0.0669396669f,
+    -0.0770925507f, 0.121697411f, -0.0435294136f, 0.155260548f,
+    -0.181315929f, 0.101968385f, -0.10486716f, 0.178417146f,
+    0.359334797f, -0.0444482863f, -0.00200366974f, -0.405786753f,
+    0.428692669f, 0.220491663f, 0.0456092805f, -0.162591726f,
+    0.0112457164f, 0.000870719552f, -0.054833293f, -0.065208286f,
+    0.0806035772f, 0.265810668f, -0.00722034276f, 0.177986741f,
+    -0.259496599f, -0.401070565f, -0.182569087f, -0.324143052f,
+    0.00784268789f, -0.124129079f, 0.0163411573f, -0.115630612f,
+    -0.317498982f, -0.340772927f, -0.182213053f, -0.205486998f,
+    -0.0501596965f, -0.063831456f, 0.0166971982f, 0.00302543747f,
+    -0.282660365f, -0.108348653f, -0.0277181715f, 0.146593541f,
+    -0.209931314f, -0.202866629f, 0.0770748109f, 0.0841395035f,
+    -0.337044179f, -0.32238856f, -0.0188784339f, -0.00422281772f,
+    -0.264315099f, -0.416906536f, 0.0859145671f, -0.0666768551f,
+    -0.0447377712f, -0.442015797f, 0.0552210808f, -0.34205693f,
+    0.220693529f, 0.0404680073f, 0.103325509f, -0.0769000202f,
+    0.0243053213f, -0.0822406486f, 0.0991752371f, -0.00737072527f,
+    0.289736629f, 0.400243163f, 0.147279665f, 0.257786185f,
+    -0.553309858f, -1.07899058f, -0.0600219369f, -0.585702717f,
+    -0.377945781f, -0.882239819f, 0.00369778275f, -0.500596225f,
+    -0.132509068f, -0.487580746f, 0.192121178f, -0.162950516f,
+    0.0428550281f, -0.290829837f, 0.255840898f, -0.0778439939f,
+    -0.355392694f, -1.02646768f, -0.105072379f, -0.776147366f,
+    -0.207466185f, -0.530363083f, 0.021620512f, -0.301276386f,
+    0.00404972583f, -0.281778127f, 0.13291052f, -0.152917311f,
+    0.151976213f, 0.214326486f, 0.259603411f, 0.321953684f,
+    -0.103807986f, -0.515174448f, -0.0134760886f, -0.424842566f,
+    0.0961085856f, -0.10936147f, 0.0411680043f, -0.164302051f,
+    0.0295176804f, -0.091556415f, 0.0875522941f, -0.0335217938f,
+    0.229434252f, 0.314256579f, 0.142196387f, 0.227018729f,
+    -0.181998372f, -0.263127685f, -0.102366075f, -0.183495402f,
+    -0.0437927544f, -0.0695399642f, 9.99495387e-05f, -0.0256472602f,
+    -0.11403963f, -0.176277667f, 0.00137108192f, -0.0608669445f,
+    0.0241659842f, 0.017310081f, 0.103837103f, 0.0969811976f,
+    0.422118664f, -0.193380073f, 0.252854526f, -0.362644225f,
+    0.461987585f, 0.212405056f, 0.233369529f, -0.0162129849f,
+    0.607540965f, 0.282585204f, 0.340095341f, 0.0151395649f,
+    0.647409916f, 0.688370347f, 0.320610404f, 0.361570805f,
+    0.080443792f, 0.0326848924f, 0.0713217333f, 0.0235628393f,
+    0.0341476314f, -0.0222357176f, 0.038201239f, -0.0181821082f,
+    0.116823807f, 0.0273093879f, 0.0793202072f, -0.0101942122f,
+    0.070527643f, -0.0276112221f, 0.0461997092f, -0.0519391596f,
+    -0.0970882252f, -0.0728369504f, -0.0280780122f, -0.00382673764f,
+    -0.0504635647f, -0.0520861223f, -0.015998723f, -0.0176212788f,
+    -0.283911765f, -0.27353251f, -0.0917763859f, -0.0813971385f,
+    -0.237287089f, -0.252781689f, -0.0796970874f, -0.0951916799f,
+    -0.362161934f, -0.568804204f, -0.180763841f, -0.387406111f,
+    0.0253919009f, -0.0633556619f, -0.0117948204f, -0.100542381f,
+    -0.339331597f, -0.380895495f, -0.105626486f, -0.147190377f,
+    0.0482222326f, 0.124553055f, 0.063342534f, 0.139673352f,
+    -0.0285724513f, -0.205914229f, 0.10536769f, -0.0719740912f,
+    0.0797720253f, 0.00419004448f, 0.0630383044f, -0.0125436746f,
+    0.0422896892f, -0.0312413108f, 0.0764508396f, 0.00291984156f,
+    0.15063417f, 0.178862959f, 0.0341214612f, 0.0623502582f,
+    -0.135542467f, -0.120438702f, -0.0247910265f, -0.00968726445f,
+    -0.0245180838f, 0.0129363602f, -0.00994263683f, 0.0275118072f,
+    -0.172376215f, -0.170061752f, -0.0273598842f, -0.0250454303f,
+    -0.0613518283f, -0.0366866924f, -0.0125114955f, 0.0121536395f,
+    -0.187591717f, -0.164398909f, -0.0764926821f, -0.0532998703f,
+    0.0239883289f, -0.0299070701f, 0.023713978f, -0.0301814191f,
+    -0.141005754f, -0.173675135f, 0.0109475181f, -0.0217218697f,
+    0.0705742836f, -0.0391833112f, 0.111154176f, 0.00139658083f,
+    -0.0682691708f, 0.106572367f, 0.103799328f, 0.278640866f,
+    -0.11555063f, 0.0263727233f, 0.0215557814f, 0.163479134f,
+    0.0686518848f, 0.12355946f, 0.0930828452f, 0.14799042f,
+    0.021370424f, 0.0433598161f, 0.010839303f, 0.0328286961f,
+    -0.247826263f, -0.175922662f, -0.0797845572f, -0.00788095687f,
+    -0.117347434f, -0.0624402203f, -0.00214087032f, 0.0527663454f,
+    -0.245568782f, -0.329612076f, -0.0645865053f, -0.148629814f,
+    -0.11508996f, -0.216129646f, 0.0130571835f, -0.0879825056f,
+    0.00865521096f, 0.0436849669f, 0.0207364429f, 0.0557661988f,
+    0.0213726312f, 0.00290041696f, 0.0102012465f, -0.00827096775f,
+    0.000590004958f, 0.0262511857f, 0.0428756438f, 0.0685368255f,
+    0.0133074261f, -0.0145333651f, 0.0323404483f, 0.00449965615f,
+    -0.033845339f, 0.0120239593f, -0.0286958609f, 0.0171734355f,
+    0.0668446496f, 0.0138744982f, 0.0292466804f, -0.02372347f,
+    -0.00218555704f, 0.0308224317f, 0.0208411757f, 0.0538491644f,
+    0.0985044315f, 0.0326729715f, 0.0787837133f, 0.0129522597f,
+    -0.0463594534f, -0.0226161238f, -0.030069245f, -0.00632591452f,
+    -0.0214668605f, -0.0651937574f, -0.0451244563f, -0.088851355f,
+    -0.0840116888f, -0.0491346344f, -0.0587540641f, -0.0238770097f,
+    -0.0591190979f, -0.0917122662f, -0.073809281f, -0.106402449f,
+    -0.00108856941f, -0.0356056094f, -0.0392334275f, -0.0737504661f,
+    0.00887454301f, -0.0685985982f, -0.00823445618f, -0.0857075974f,
+    0.016735727f, -0.010381924f, -0.0364733599f, -0.0635910109f,
+    0.0266988389f, -0.043374911f, -0.00547439232f, -0.0755481422f,
+    -0.0394707806f, -0.0134692146f, -0.0099604493f, 0.0160411168f,
+    -0.022871457f, -0.0261461884f, 0.0159246102f, 0.0126498807f,
+    -0.0290686451f, -0.0282826275f, -0.0279671177f, -0.0271811001f,
+    -0.0124693234f, -0.0409596041f, -0.00208205637f, -0.0305723362f,
+    -0.0480686426f, -0.0805499256f, 0.0260434933f, -0.00643778685f,
+    -0.0576105714f, -0.0670031533f, -0.029438246f, -0.0388308279f,
+    -0.0490474589f, -0.0642053932f, -0.0209797453f, -0.0361376815f,
+    -0.0585893877f, -0.0506586283f, -0.0764614865f, -0.0685307235f,
+    0.040657077f, -0.00070515275f, 0.00119444728f, -0.0401677825f,
+    -0.0191462524f, -0.0660117418f, -0.03832867f, -0.085194163f,
+    0.0515834466f, 0.0192801878f, 0.0293816067f, -0.00292165205f,
+    -0.00821987912f, -0.0460263975f, -0.0101415105f, -0.0479480289f,
+    0.0536593571f, -0.00248258957f, 0.0497640036f, -0.00637794333f,
+    0.0292096268f, 0.0198491365f, 0.0461499467f, 0.0367894582f,
+    -0.0256118197f, -0.0062003592f, -0.0469713658f, -0.0275599025f,
+    -0.05006155f, 0.0161313675f, -0.0505854152f, 0.0156075004f,
+    0.00503503298f, 0.0223724302f, 0.06567467f, 0.0830120668f,
+    0.000677820295f, 0.00643766671f, 0.0399597995f, 0.0457196459f,
+    0.0683519989f, 0.0255691782f, 0.0899781361f, 0.0471953154f,
+    0.0639947876f, 0.00963441655f, 0.0642632693f, 0.0099028945f,
+    -0.0474601351f, -0.0709813163f, -0.0306327268f, -0.054153908f,
+    -0.0324037746f, -0.0132379141f, -0.0203626826f, -0.00119682215f,
+    0.0201610811f, -0.00843827426f, 0.00639488827f, -0.022204468f,
+    0.0352174416f, 0.0493051261f, 0.0166649316f, 0.0307526179f,
+    -0.0344388746f, -0.0368522555f, 0.0368608125f, 0.0344474353f,
+    0.0116812177f, -0.0308145508f, 0.0976278409f, 0.0551320761f,
+    0.0241107047f, 0.00335891172f, 0.0490301102f, 0.0282783173f,
+    0.0702307969f, 0.00939661264f, 0.109797135f, 0.0489629582f,
+    -0.0844865739f, -0.0937374979f, 0.00041989889f, -0.00883101858f,
+    -0.0969032198f, -0.0784819201f, 0.00505729765f, 0.0234785974f,
+    -0.00584490411f, -0.036230363f, 0.0345961004f, 0.00421064161f,
+    -0.0182615481f, -0.0209747888f, 0.0392334983f, 0.0365202576f,
+    -0.0416082591f, -0.055459585f, -0.00910738017f, -0.0229587052f,
+    -0.038490925f, -0.0337434709f, -0.00573130371f, -0.000983848237f,
+    -0.0258731395f, -0.0231976677f, -0.0560376346f, -0.0533621609f,
+    -0.0227558035f, -0.00148155261f, -0.052661553f, -0.031387303f,
+    -0.0916746333f, -0.0758085176f, -0.0203468613f, -0.00448074238f,
+    -0.0462185331f, -0.0878106058f, 0.00296785869f, -0.0386242196f,
+    -0.074153468f, -0.0870026127f, -0.03912168f, -0.0519708246f,
+    -0.028697364f, -0.0990047008f, -0.0158069618f, -0.0861143023f,
+    0.0234854948f, -0.0817045718f, -0.00216149911f, -0.107351571f,
+    -0.0450588129f, -0.15938282f, -0.0228703842f, -0.13719438f,
+    0.0147390589f, -0.0169408694f, 0.00113493856f, -0.0305449907f,
+    -0.0538052469f, -0.0946191028f, -0.0195739362f, -0.0603877939f,
+    0.00524613494f, 0.0150267463f, 0.0624114797f, 0.0721920878f,
+    -0.00572350435f, -0.0223032068f, 0.0623206645f, 0.0457409658f,
+    -0.0422115326f, -0.0245293863f, 0.00313955452f, 0.0208216999f,
+    -0.0531811714f, -0.0618593395f, 0.00304874638f, -0.00562942307f,
+    -0.0735872835f, -0.09557385f, -0.0148289688f, -0.036815539f,
+    -0.0411892608f, -0.00330892019f, 0.0203547552f, 0.0582350977f,
+    -0.0681886002f, -0.130261898f, 0.049902536f, -0.0121707655f,
+    -0.0357905775f, -0.0379969701f, 0.0850862637f, 0.0828798711f,
+    0.166714355f, 0.141314566f, -0.0824102014f, -0.107809983f,
+    0.100876883f, -0.108353749f, -0.0926603675f, -0.301890999f,
+    -0.0554741547f, -0.0606721006f, -0.0745300353f, -0.0797279775f,
+    -0.121311635f, -0.310340405f, -0.0847802013f, -0.273808986f,
+    -0.0757135674f, -0.225579023f, -0.0080647245f, -0.15793018f,
+    0.0760972649f, 0.110063136f, 0.0478871949f, 0.0818530619f,
+    -0.0743938386f, -0.206941947f, -0.0608686358f, -0.193416744f,
+    0.0774169937f, 0.128700212f, -0.0049167145f, 0.0463665016f,
+    -0.0481709875f, -0.300293446f, -0.166479424f, -0.4186019f,
+    -0.329628706f, -0.482086629f, -0.202653721f, -0.355111659f,
+    0.204605877f, 0.0833734572f, 0.0751850605f, -0.0460473634f,
+    -0.0768518299f, -0.0984197184f, 0.0390107669f, 0.0174428765f,
+    -0.45723784f, -1.01528394f, -0.346958876f, -0.905004919f,
+    -0.261871934f, -0.285072237f, -0.189889699f, -0.213089988f,
+    -0.182457447f, -0.386614591f, -0.128504604f, -0.332661748f,
+    0.0129084885f, 0.343597084f, 0.0285646021f, 0.359253198f,
+    -0.294935524f, -0.603303015f, -0.17520988f, -0.4835774f,
+    0.0678599924f, 0.0132129863f, -0.014807485f, -0.0694544911f,
+    -0.109565899f, -0.223903105f, -0.0853281468f, -0.199665353f,
+    0.253229618f, 0.392612934f, 0.0750742406f, 0.214457542f,
+    0.195971996f, 0.105711348f, 0.0549561456f, -0.0353044979f,
+    0.0388149619f, 0.00370939821f, -0.000595241785f, -0.0357008055f,
+    -0.150933594f, -0.212762862f, -0.125936866f, -0.187766135f,
+    -0.308090627f, -0.314764827f, -0.181488246f, -0.188162446f,
+    -0.304653734f, -0.784724236f, -0.0326073021f, -0.512677789f,
+    0.142572969f, 0.239366993f, 0.131064743f, 0.227858752f,
+    -0.0943152308f, -0.319974065f, 0.00159797072f, -0.224060863f,
+    0.352911472f, 0.704117179f, 0.165270001f, 0.516475677f,
+    -0.0417815559f, -0.0118139237f, -0.0620774999f, -0.0321098678f,
+    -0.0131605417f, -0.0208055563f, -0.00254070293f, -0.0101857185f,
+    -0.0343562625f, 0.00836564042f, 0.000701451674f, 0.0434233546f,
+    -0.00573524833f, -0.000625990331f, 0.0602382496f, 0.0653475076f,
+    0.168889001f, 0.167583585f, 0.0664560497f, 0.0651506335f,
+    -0.0836932808f, -0.0756922066f, -0.078668952f, -0.0706678852f,
+    -0.102065057f, -0.202513307f, -0.03666839f, -0.137116641f,
+    -0.354647338f, -0.445789099f, -0.181793392f, -0.272935152f,
+    0.0265433639f, -0.0249540769f, 0.0287354998f, -0.0227619391f,
+    0.0823487043f, 0.150304824f, -0.0135324523f, 0.0544236749f,
+    -0.0475035459f, -0.128689319f, -0.0119088367f, -0.0930946171f,
+    0.00830179173f, 0.0465695746f, -0.0541767813f, -0.0159090031f,
+    -0.0792883635f, -0.0364292115f, -0.0729786754f, -0.0301195215f,
+    0.0510388799f, 0.0534365326f, 0.00894503389f, 0.0113426875f,
+    -0.182360962f, -0.158088997f, -0.0851443708f, -0.0608724058f,
+    -0.052033715f, -0.0682232529f, -0.00322066061f, -0.0194101967f,
+    0.17143625f, 0.101639494f, 0.0910990685f, 0.021302307f,
+    -0.00228859484f, -0.0511603244f, 0.0233534612f, -0.0255182683f,
+    -0.039402172f, -0.226245865f, -0.00250498205f, -0.189348668f,
+    -0.213127017f, -0.379045665f, -0.0702505857f, -0.236169249f,
+    0.156576484f, 0.118827119f, 0.152363509f, 0.114614151f,
+    0.0353767276f, 0.0360347554f, 0.0623558238f, 0.0630138516f,
+    0.050395906f, -0.0412573516f, 0.0416307896f, -0.0500224717f,
+    -0.0708038509f, -0.124049708f, -0.0483769029f, -0.101622768f,
+    -0.253610104f, -0.313061446f, -0.0622627325f, -0.121714063f,
+    -0.162530631f, -0.278208733f, -0.0917219296f, -0.207400054f,
+    -0.0201955736f, -0.0185832344f, 0.0422136448f, 0.043825984f,
+    0.0708838999f, 0.016269438f, 0.0127544478f, -0.0418600142f,
+    0.0980070606f, 0.0431479849f, -0.00662060454f, -0.0614796802f,
+    0.0945445001f, -0.0513615198f, -0.0262327902f, -0.17213881f,
+    -0.0920582339f, -0.224280387f, -0.0911198258f, -0.223341972f,
+    -0.0955208018f, -0.318789899f, -0.110732004f, -0.334001094f,
+    0.147751644f, 0.043438945f, 0.167207614f, 0.062894918f,
+    0.172750726f, -0.0410738289f, 0.106145464f, -0.107679084f,
+    0.0878230631f, 0.020128347f, 0.103962697f, 0.0362679809f,
+    0.112822145f, -0.0643844232f, 0.0429005548f, -0.134306014f,
+    -0.105297953f, 0.269563526f, 0.0520738363f, 0.426935315f,
+    -0.58214438f, -0.226084113f, 0.215117112f, 0.571177363f,
+    0.162044123f, 0.0595369674f, 0.124188274f, 0.0216811225f,
+    -0.314802259f, -0.436110646f, 0.287231565f, 0.165923163f,
+    0.106119886f, -0.00188934058f, 0.0127328634f, -0.0952763632f,
+    -0.0423767865f, -0.0273534637f, -0.0401354283f, -0.0251121074f,
+    0.24533698f, 0.106698275f, 0.217250794f, 0.0786120966f,
+    0.0968403071f, 0.0812341571f, 0.164382502f, 0.148776352f,
+    -0.267445296f, -0.198846042f, 0.120849945f, 0.189449206f,
+    0.0569889247f, -0.200209349f, 0.180086434f, -0.0771118328f,
+    0.0412008762f, 0.0320256986f, 0.0979699641f, 0.0887947902f,
+    0.365635097f, 0.0306623951f, 0.157206446f, -0.177766249f,
+    0.208153024f, 0.318929285f, -0.160267562f, -0.0494912863f,
+    0.0284858122f, 0.60850054f, -0.0442053676f, 0.535809338f,
+    0.352807015f, 0.199463814f, 0.174570143f, 0.0212269425f,
+    0.173139811f, 0.48903504f, 0.290632337f, 0.606527567f,
+    0.159474298f, -0.0626333728f, -0.0433743075f, -0.265481979f,
+    -0.139749914f, -0.0717578307f, -0.103187837f, -0.035195753f,
+    0.181235135f, 0.0826327354f, 0.159004077f, 0.0604016706f,
+    -0.117989063f, 0.0735082775f, 0.0991905481f, 0.290687889f,
+    -0.0079108784f, 0.163701937f, -0.0762230009f, 0.0953898057f,
+    -0.129379928f, 0.0301839821f, -0.0657738894f, 0.0937900171f,
+    -0.00885907561f, 0.00637540221f, -0.0526272282f, -0.0373927504f,
+    -0.130328134f, -0.127142549f, -0.0421781242f, -0.0389925428f,
+    0.249789089f, 0.130918995f, 0.225674257f, 0.106804155f,
+    0.0594886728f, 0.0736756772f, -0.013136832f, 0.00105017424f,
+    0.314727485f, 0.259527445f, 0.328178048f, 0.272978038f,
+    0.124427058f, 0.202284142f, 0.089366965f, 0.16722405f,
+    0.0695193112f, 0.0735415891f, 0.0725124553f, 0.0765347332f,
+    0.040411938f, 0.0470940657f, 0.0490463451f, 0.0557284728f,
+    -0.0270607248f, 0.0354536064f, -0.0446696989f, 0.0178446341f,
+    -0.0561681017f, 0.00900608394f, -0.0681358054f, -0.00296162581f,
+    0.0254318919f, 0.0254827067f, -0.0738216117f, -0.0737707987f,
+    -0.0433582626f, -0.0799574628f, -0.0804944485f, -0.117093645f,
+    -0.042772226f, -0.000500299968f, -0.0406682342f, 0.00160369091f,
+    -0.111562379f, -0.105940469f, -0.0473410711f, -0.0417191572f,
+    0.0242830645f, 0.0307364147f, 0.0139216529f, 0.0203750022f,
+    0.0468727574f, -0.00391935557f, -0.0311485995f, -0.0819407105f,
+    0.031080313f, 0.0677797571f, 0.103354201f, 0.140053645f,
+    0.0536700077f, 0.0331239924f, 0.0582839437f, 0.0377379283f,
+    0.0697037429f, -0.0591146499f, -0.0904495716f, -0.219267964f,
+    -0.117056206f, -0.0335839763f, -0.0809455216f, 0.00252670795f,
+    0.0882571936f, 0.0735130236f, 0.0417839885f, 0.0270398185f,
+    -0.0985027626f, 0.0990436971f, 0.051288031f, 0.248834491f,
+    0.0469566807f, 0.0136131756f, -0.0339439102f, -0.0672874153f,
+    -0.0809097737f, -0.0508996062f, -0.0394999571f, -0.00948979147f,
+    -0.0637113228f, -0.0378670543f, -0.0316448063f, -0.00580053963f,
+    -0.191577777f, -0.102379836f, -0.0372008607f, 0.0519970842f,
+    0.057659369f, -0.000104447827f, 0.0111331865f, -0.0466306284f,
+    0.0130495047f, -0.0505817793f, 0.0697134286f, 0.00608214643f,
+    0.0492940955f, -0.0147649972f, 0.0462437272f, -0.0178153683f,
+    0.00468423078f, -0.0652423352f, 0.104823962f, 0.0348974057f,
+    -0.0597573407f, -0.139070943f, 0.0270917583f, -0.0522218458f,
+    -0.23793593f, -0.110526428f, 0.0328641906f, 0.160273701f,
+    -0.117408872f, -0.0957119316f, -0.0298962258f, -0.00819928199f,
+    -0.29558745f, -0.0671673939f, -0.0241237804f, 0.204296276f,
+    0.091381833f, 0.338422358f, 0.016335465f, 0.263375968f,
+    -0.267775267f, -0.0928933024f, 0.074516058f, 0.249398023f,
+    0.0753120482f, -0.00656446069f, -0.0198042616f, -0.101680771f,
+    -0.283845067f, -0.437880099f, 0.0383763276f, -0.115658708f,
+    0.210413799f, 0.119789585f, 0.220752388f, 0.130128175f,
+    0.0858694836f, 0.275704741f, 0.0763586909f, 0.266193956f,
+    0.3652125f, 0.137009263f, 0.074051857f, -0.15415138f,
+    0.240668178f, 0.292924434f, -0.0703418478f, -0.0180855859f,
+    -0.22670728f, -0.248040169f, -0.239437133f, -0.260770023f,
+    -0.154830977f, -0.322868168f, -0.141653404f, -0.309690595f,
+    -0.105166987f, 0.0333942398f, -0.115809344f, 0.0227518808f,
+    -0.0332906805f, -0.041433759f, -0.0180256013f, -0.026168678f,
+    0.142545953f, 0.024781391f, -0.108983092f, -0.226747662f,
+    -0.105492443f, 0.0449749865f, -0.0367045067f, 0.113762923f,
+    -0.0735598654f, 0.00960914418f, -0.192074567f, -0.108905546f,
+    -0.321598262f, 0.0298027396f, -0.119795956f, 0.231605038f,
+    -0.248976782f, -0.05266013f, -0.0380384102f, 0.158278242f,
+    -0.0326395519f, 0.381743908f, 0.036515221f, 0.450898677f,
+    -0.147433549f, 0.045276925f, -0.154625192f, 0.0380852818f,
+    0.0689036772f, 0.479680955f, -0.0800715685f, 0.330705702f,
+    0.297767311f, 0.45838201f, -0.115642875f, 0.0449718013f,
+    0.108443975f, -0.0780211613f, -0.144598126f, -0.331063271f,
+    -0.129499167f, 0.0756712332f, -0.137851164f, 0.0673192441f,
+    -0.318822503f, -0.460731924f, -0.166806415f, -0.30871582f,
+    0.278498828f, 0.161239967f, 0.052318912f, -0.0649399534f,
+    0.0548534095f, -0.107215524f, -0.122024983f, -0.284093916f,
+    0.0152339712f, 0.0342528038f, -0.0579492338f, -0.0389304012f,
+    -0.208411455f, -0.234202683f, -0.232293129f, -0.258084357f,
+    -0.334608376f, -0.182603449f, -0.23641485f, -0.0844099075f,
+    -0.2362151f, -0.181265116f, -0.147674367f, -0.0927243754f,
+    -0.0110960267f, 0.06081881f, -0.057300318f, 0.0146145122f,
+    0.0872972384f, 0.062157128f, 0.03144015f, 0.00630004099f,
+    0.419693679f, 0.223347127f, -0.110176161f, -0.306522727f,
+    0.10680148f, 0.0533111654f, 0.0139743313f, -0.0395159796f,
+    0.0038946867f, 0.197346911f, -0.288670719f, -0.0952184871f,
+    -0.308997512f, 0.0273109525f, -0.164520204f, 0.17178826f,
+    -0.0354987197f, -0.0112001561f, 0.0440294594f, 0.068328023f,
+    -0.0269628055f, -0.000998901203f, 0.0295775924f, 0.0555414967f,
+    0.0103651891f, 0.0702652186f, 0.0314659216f, 0.0913659483f,
+    0.0189011004f, 0.0804664642f, 0.0170140527f, 0.0785794184f,
+    -0.15344061f, -0.207858652f, 0.0195065066f, -0.0349115282f,
+    -0.193647519f, -0.0665106922f, -0.092279762f, 0.0348570608f,
+    0.137885436f, -0.0795495287f, 0.0276792571f, -0.189755708f,
+    0.0976785198f, 0.0617984124f, -0.084107019f, -0.119987123f,
+    0.0914665312f, -0.0957720503f, 0.0810249895f, -0.106213599f,
+    -0.0956091136f, 0.0660405308f, 0.0163960904f, 0.178045735f,
+    0.167026833f, -0.0179974586f, 0.0077585727f, -0.177265719f,
+    -0.0200488139f, 0.14381513f, -0.0568703189f, 0.106993616f,
+    -0.237880871f, -0.0610428154f, -0.00818385184f, 0.168654203f,
+    -0.0681096762f, -0.0123825185f, -0.124433003f, -0.0687058419f,
+    -0.0681934953f, -0.0306730643f, 0.113922052f, 0.151442483f,
+    0.101577707f, 0.0179872438f, -0.00232709199f, -0.0859175548f,
+    -0.207939029f, -0.116350226f, 0.0209079459f, 0.112496749f,
+    -0.175976038f, -0.0809822381f, -0.119487256f, -0.0244934484f,
+    0.1945889f, 0.0335091986f, 0.0905002058f, -0.0705794916f,
+    0.22655189f, 0.0688771904f, -0.0498949923f, -0.207569689f,
+    -0.183125496f, -0.14752011f, -0.0409881473f, -0.00538275903f,
+    -0.165718108f, -0.0934956074f, -0.089782089f, -0.017559588f,
+    0.168606281f, 0.0325839818f, -0.0156035461f, -0.151625842f,
+    0.186013654f, 0.0866084769f, -0.0643974915f, -0.163802668f,
+    -0.208545029f, -0.244215935f, -0.283627957f, -0.319298863f,
+    -0.271347284f, -0.450576991f, -0.1647425f, -0.343972206f,
+    -0.147220403f, -0.0324860737f, -0.156205669f, -0.0414713323f,
+    -0.210022658f, -0.238847151f, -0.0373201817f, -0.066144675f,
+    -0.1115091f, -0.0923212543f, -0.0802119449f, -0.0610241033f,
+    -0.105060034f, -0.0916403905f, -0.0989935473f, -0.0855739042f,
+    0.0217009727f, 0.0748540312f, -0.00838837959f, 0.0447646789f,
+    0.0281500407f, 0.0755348951f, -0.0271699764f, 0.0202148762f,
+    -0.123523898f, -0.116090849f, -0.0597446337f, -0.0523115806f,
+    -0.129718393f, -0.0604752675f, -0.0393989459f, 0.0298441835f,
+    -0.0412020981f, 0.00999497622f, 0.040207155f, 0.0914042294f,
+    -0.0473965891f, 0.0656105578f, 0.0605528429f, 0.173559994f,
+    -0.0593024008f, -0.207156181f, -0.0924284458f, -0.240282223f,
+    -0.193081945f, -0.0517896712f, -0.0731013417f, 0.0681909323f,
+    -0.0267743841f, -0.135944963f, 0.00543359295f, -0.103736982f,
+    -0.160553932f, 0.0194215551f, 0.0247606859f, 0.204736173f,
+    -0.0916487724f, -0.104831941f, -0.065895699f, -0.079078868f,
+    -0.107585654f, -0.0955547541f, -0.110935062f, -0.0989041626f,
+    0.00192484679f, 0.0252974275f, -0.0178332683f, 0.00553931436f,
+    -0.0140120378f, 0.034574613f, -0.0628726333f, -0.0142859789f,
+    -0.442379266f, -0.745495915f, -0.123522282f, -0.426638931f,
+    -0.556621969f, -0.722820938f, 0.0370567739f, -0.129142165f,
+    -0.0974655673f, -0.223479465f, 0.0383065157f, -0.087707378f,
+    -0.211708263f, -0.200804442f, 0.19888556f, 0.20978938f,
+    -0.0271784887f, -0.146546751f, -0.000487908721f, -0.119856171f,
+    -0.234388858f, -0.576765835f, -0.206838325f, -0.549215317f,
+    0.0162228048f, -0.0221556611f, 0.0150523968f, -0.0233260691f,
+    -0.190987557f, -0.452374756f, -0.191297993f, -0.452685177f,
+    0.1300513f, 0.136375368f, 0.000207950361f, 0.00653202273f,
+    0.135252982f, -0.0147216618f, 0.0237949342f, -0.12617971f,
+    0.0945579037f, 0.0599038266f, 0.0219442472f, -0.0127098337f,
+    0.0997595936f, -0.0911932066f, 0.0455312356f, -0.145421565f,
+    -0.0981959403f, -0.0524167158f, -0.00383793376f, 0.0419412926f,
+    -0.0607896484f, 0.0852355063f, -0.0214728862f, 0.124552265f,
+    -0.033402212f, -0.0106315091f, 0.0482412204f, 0.0710119233f,
+    0.00400408637f, 0.127020717f, 0.0306062661f, 0.153622895f,
+    0.097138077f, 0.128451109f, -0.103733689f, -0.0724206492f,
+    -0.318698972f, -0.656476557f, -0.213352218f, -0.551129818f,
+    0.170620978f, 0.112470269f, -0.0453325808f, -0.103483289f,
+    -0.245216072f, -0.672457397f, -0.154951096f, -0.582192421f,
+    0.0352486074f, 0.0231093783f, 0.0768146962f, 0.0646754652f,
+    0.0599369183f, 0.0444132462f, 0.0472766608f, 0.0317529924f,
+    -0.00539516844f, 0.00162726361f, 0.0157804526f, 0.0228028856f,
+    0.0192931406f, 0.0229311343f, -0.0137575809f, -0.0101195872f,
+    -0.215087026f, -0.199796841f, -0.0718556941f, -0.0565655045f,
+    -0.0717804283f, 0.034055382f, 0.016658444f, 0.122494258f,
+    -0.179779515f, -0.136565372f, -0.00826343149f, 0.0349507034f,
+    -0.0364729278f, 0.0972868428f, 0.0802506953f, 0.214010462f,
+    -0.149965316f, -0.16256547f, -0.0810347199f, -0.0936348662f,
+    -0.161277488f, -0.138807625f, -0.0880371407f, -0.0655672774f,
+    -0.0236717034f, -0.0354928412f, -0.00338074286f, -0.0152018815f,
+    -0.0349838771f, -0.0117350016f, -0.0103831682f, 0.0128657082f,
+    -0.065963991f, -0.169805259f, -0.0449056029f, -0.148746863f,
+    0.0630978495f, -0.00226686895f, -0.0183320269f, -0.0836967453f,
+    0.046696078f, 0.00318912044f, -0.0503133088f, -0.0938202664f,
+    0.175757915f, 0.170727491f, -0.0237397291f, -0.0287701432f,
+    -0.184149325f, -0.0968804806f, -0.137622342f, -0.0503534973f,
+    0.0122784376f, 0.117424875f, -0.0143036582f, 0.090842776f,
+    -0.147682011f, -0.00335607678f, -0.0792243853f, 0.065101549f,
+    0.0487457514f, 0.210949272f, 0.0440942943f, 0.206297815f,
+    -0.0520728156f, 0.0363463685f, 0.0200729184f, 0.108492099f,
+    0.00737548061f, 0.126219153f, 0.0172627978f, 0.136106476f,
+    -0.0545019135f, -0.0202681981f, 0.00498334691f, 0.0392170623f,
+    0.00494638411f, 0.0696045905f, 0.00217322819f, 0.0668314323f,
+    0.00560541265f, 0.0787001103f, -0.0474879891f, 0.0256067067f,
+    -0.0808828473f, 0.159564763f, 0.000749237835f, 0.241196841f,
+    0.0733086169f, 0.0580711551f, 0.0330220461f, 0.017784588f,
+    -0.0131796459f, 0.138935804f, 0.0812592655f, 0.233374715f,
+    -0.0657268465f, -0.0766127184f, -0.0736101791f, -0.0844960511f,
+    -0.0655665398f, 0.0947951451f, -0.0934181139f, 0.066943571f,
+    -0.0960285664f, -0.114970177f, -0.0375731923f, -0.056514807f,
+    -0.0958682597f, 0.0564376749f, -0.0573811159f, 0.0949248224f,
+    0.109541319f, 0.182199791f, -0.0016342029f, 0.0710242614f,
+    0.140891612f, 0.160667613f, -0.0119040413f, 0.00787195005f,
+    -0.00876796991f, 0.0380810797f, -0.000409496948f, 0.0464395508f,
+    0.0225823298f, 0.0165488999f, -0.0106793297f, -0.0167127587f,
+    -0.21258986f, -0.12558791f, -0.0411257744f, 0.0458761752f,
+    -0.0285062641f, 0.0527105071f, -0.116195545f, -0.0349787697f,
+    0.0704853162f, 0.0380865894f, 0.0516311117f, 0.0192323849f,
+    0.254568905f, 0.216385007f, -0.0234386548f, -0.06162256f,
+    -0.165594965f, 0.0971834362f, -0.0113584101f, 0.251419991f,
+    -0.0513369814f, 0.0203171484f, -0.0313487984f, 0.0403053313f,
+    -0.0157312229f, -0.00806349516f, 0.0778181553f, 0.0854858831f,
+    0.0985267609f, -0.0849297941f, 0.0578277707f, -0.125628784f,
+    -0.0473710857f, -0.128037572f, -0.142982811f, -0.223649293f,
+    0.308390439f, 0.247140825f, -0.062936306f, -0.12418592f,
+    -0.108490661f, -0.0610436387f, -0.00888575986f, 0.0385612622f,
+    0.247270852f, 0.314134747f, 0.0711607337f, 0.138024628f,
+    -0.157301784f, -0.0151243135f, 0.065918833f, 0.20809631f,
+    0.0907241255f, 0.232093409f, 0.353803635f, 0.495172918f,
+    0.104541972f, 0.164814815f, 0.0377570726f, 0.098029919f,
+    0.352567881f, 0.412032545f, 0.32564187f, 0.385106534f,
+    -0.286468863f, -0.017679438f, 0.0538708121f, 0.322660238f,
+    -0.208914578f, -0.0509139001f, 0.215222627f, 0.373223305f,
+    -0.105456375f, 0.0359265655f, 0.0784303248f, 0.219813257f,
+    -0.0279020835f, 0.00269211829f, 0.239782155f, 0.270376354f,
+    0.064748399f, 0.0747002959f, 0.0637396723f, 0.0736915618f,
+    0.190609828f, 0.0951805785f, -0.0282922238f, -0.123721465f,
+    0.066301845f, 0.0337521806f, 0.0200881138f, -0.0124615505f,
+    0.192163274f, 0.0542324707f, -0.0719437823f, -0.209874585f,
+    -0.248865262f, 0.101481423f, -0.044252038f, 0.306094646f,
+    -0.682112873f, -0.314620197f, -0.0978536457f, 0.269639045f,
+    -0.133867085f, -0.0360813886f, 0.129705846f, 0.227491528f,
+    -0.567114711f, -0.452183038f, 0.0761042237f, 0.191035926f,
+    -0.0649095476f, -0.0545452461f, -0.0818454698f, -0.0714811683f,
+    -0.0354117453f, -0.0193128884f, -0.0010048775f, 0.0150939804f,
+    -0.0851911232f, -0.0730863363f, -0.0770796239f, -0.0649748296f,
+    -0.0556933209f, -0.0378539711f, 0.00376096927f, 0.0216003172f,
+    0.0464974791f, 0.080060631f, -0.06491445f, -0.0313512944f,
+    0.0615050942f, 0.00230763853f, -0.100077242f, -0.159274697f,
+    -0.0125394017f, 0.0193240494f, -0.0596271232f, -0.0277636722f,
+    0.00246821414f, -0.0584289432f, -0.0947899222f, -0.155687079f,
+    -0.0907767043f, 0.0972705409f, -0.0212894827f, 0.166757762f,
+    -0.00090034306f, 0.0805085897f, -0.0421367362f, 0.0392721929f,
+    -0.047331471f, 0.0149576515f, 0.0484345891f, 0.110723712f,
+    0.0425448939f, -0.00180429686f, 0.0275873356f, -0.0167618562f,
+    0.0630336627f, 0.0786577463f, 0.112096578f, 0.127720654f,
+    0.269349158f, 0.121426672f, 0.21709913f, 0.0691766441f,
+    0.0786694288f, -0.103769898f, 0.0191464722f, -0.163292855f,
+    0.284984916f, -0.0610009655f, 0.124149024f, -0.221836865f,
+    0.0052043763f, 0.103045426f, -0.0311213061f, 0.0667197406f,
+    0.0178260002f, -0.0559137166f, -0.132298052f, -0.20603776f,
+    -0.0599485859f, -0.0562148318f, -0.103200912f, -0.0994671583f,
+    -0.0473269634f, -0.215173975f, -0.204377651f, -0.372224659f,
+    -0.0846816897f, -0.0931948349f, -0.0569121018f, -0.065425247f,
+    -0.0284228716f, -0.17103368f, -0.0697451383f, -0.212355942f,
+    -0.0728440806f, -0.13433519f, 0.00943098217f, -0.0520601347f,
+    -0.0165852606f, -0.212174028f, -0.00340204686f, -0.198990822f,
+    -0.470128655f, -0.835614204f, -0.170167118f, -0.535652697f,
+    -0.47092402f, -0.790997982f, -0.273485184f, -0.593559146f,
+    -0.0237205941f, -0.141264617f, -0.0586875081f, -0.176231533f,
+    -0.0245159604f, -0.0966483355f, -0.162005603f, -0.234137967f,
+    -0.0114470497f, -0.0335006155f, -0.00508042704f, -0.0271339938f,
+    -0.0425087735f, -0.0369149074f, -0.0856536925f, -0.0800598264f,
+    0.138405949f, 0.0587240718f, 0.0141143613f, -0.0655675158f,
+    0.107344225f, 0.0553097837f, -0.0664589107f, -0.118493356f,
+    0.111620247f, 0.205834031f, 0.0709080473f, 0.165121838f,
+    -0.138274252f, -0.14517805f, -0.0501435325f, -0.0570473298f,
+    0.107382469f, 0.119649619f, 0.00713041425f, 0.0193975642f,
+    -0.142512038f, -0.231362462f, -0.113921173f, -0.202771604f,
+    0.0988125652f, -0.0327152982f, -0.019024156f, -0.150552019f,
+    -0.339663982f, -0.0650053248f, -0.0847191736f, 0.189939484f,
+    -0.0668922067f, -0.231471181f, -0.0719059184f, -0.2364849f,
+    -0.505368769f, -0.263761222f, -0.137600943f, 0.104006618f,
+    0.0145923644f, 0.0536186844f, 0.114677891f, 0.153704211f,
+    -0.0276801847f, 0.0443835557f, 0.0261071231f, 0.0981708616f,
+    0.0254870094f, 0.100985505f, 0.0938282609f, 0.169326752f,
+    -0.0167855415f, 0.0917503759f, 0.00525749475f, 0.11379341f,
+    -0.211163059f, -0.156462818f, 0.0445239656f, 0.0992242023f,
+    -0.190845221f, -0.584556222f, -0.0633583814f, -0.457069337f,
+    -0.131573886f, -0.265229017f, 0.0223169699f, -0.111338153f,
+    -0.111256048f, -0.693322361f, -0.0855653882f, -0.667631686f,
+    0.29063037f, 0.0346062481f, -0.0235779285f, -0.279602051f,
+    0.306736588f, 0.217665151f, 0.0892930776f, 0.000221639872f,
+    0.458159059f, 0.182243094f, 0.138228491f, -0.137687474f,
+    0.474265277f, 0.365301996f, 0.251099497f, 0.142136231f,
+    -0.0225578919f, -0.205555111f, 0.0511445403f, -0.131852686f,
+    -0.0250084996f, -0.179962188f, 0.0801844522f, -0.0747692436f,
+    0.151589707f, -0.00494448654f, 0.149452403f, -0.00708178803f,
+    0.149139106f, 0.0206484422f, 0.178492323f, 0.050001651f,
+    0.0969443992f, 0.145385623f, 0.0714566782f, 0.119897902f,
+    0.0697557181f, 0.239572912f, 0.113767371f, 0.283584565f,
+    0.113840133f, 0.0525441505f, 0.0779263228f, 0.0166303441f,
+    0.0866514519f, 0.146731436f, 0.120237023f, 0.180317f,
+    -0.0297452025f, -0.116882518f, 0.0375775546f, -0.0495597534f,
+    -0.0978751779f, -0.145050824f, -0.00963619351f, -0.0568118393f,
+    0.157740906f, 0.313584685f, 0.114395209f, 0.270238966f,
+    0.0896109268f, 0.285416365f, 0.0671814382f, 0.262986869f,
+    -0.0195200946f, 0.00757614337f, 0.0348031968f, 0.0618994348f,
+    -0.00814038608f, -0.0321504213f, 0.0227201972f, -0.00128983706f,
+    0.0094859302f, 0.0148188155f, -0.0108741615f, -0.00554127619f,
+    0.0208656397f, -0.0249077454f, -0.0229571629f, -0.068730548f,
+    0.0716738701f, 0.172003239f, 0.0489795953f, 0.149308965f,
+    -0.0199405588f, 0.0869577155f, 0.0376770571f, 0.144575328f,
+    0.0075028725f, 0.0520138629f, 0.017744679f, 0.0622556694f,
+    -0.0841115564f, -0.0330316648f, 0.0064421352f, 0.0575220287f,
+    0.123503514f, 0.260837674f, 0.00872519612f, 0.146059364f,
+    -0.0934992433f, 0.0131820273f, -0.0568724424f, 0.0498088263f,
+    0.0325492918f, 0.160688549f, -0.0279672146f, 0.100172043f,
+    -0.184453458f, -0.0869670957f, -0.0935648531f, 0.00392150646f,
+    0.142651811f, 0.0589407161f, 0.00100148469f, -0.0827096105f,
+    0.178089947f, 0.0326143131f, 0.148449227f, 0.00297359377f,
+    0.0929571688f, 0.0684617758f, 0.065787755f, 0.0412923619f,
+    0.128395304f, 0.0421353728f, 0.213235497f, 0.126975566f,
+    0.121368773f, 0.0727498382f, -0.0446305089f, -0.0932494476f,
+    0.0774141029f, 0.0977442265f, 0.045818381f, 0.0661485046f,
+    -0.00572411902f, 0.0360528715f, -0.0709943026f, -0.0292173102f,
+    -0.0496787839f, 0.0610472634f, 0.0194545984f, 0.130180642f,
+    0.00775131164f, 0.0748856217f, -0.0607460253f, 0.00638828287f,
+    0.0541227721f, 0.04436877f, 0.019022271f, 0.00926826987f,
+    0.00123593211f, 0.0367089137f, -0.0352914706f, 0.000181512558f,
+    0.0476073921f, 0.00619206205f, 0.0444768257f, 0.00306149921f,
+    -0.217007294f, -0.48919791f, -0.213165224f, -0.485355824f,
+    -0.389234424f, -0.347959995f, -0.180759236f, -0.139484793f,
+    -0.0375219211f, -0.228998274f, -0.045332469f, -0.236808822f,
+    -0.209749073f, -0.0877603441f, -0.0129265003f, 0.109062217f,
+    0.283666164f, 0.186256811f, 0.0836625844f, -0.013746772f,
+    -0.0929508582f, 0.121551305f, -0.0393188f, 0.175183356f,
+    0.0180392861f, -0.0155970007f, -0.07920219f, -0.112838477f,
+    -0.358577728f, -0.0803025067f, -0.202183574f, 0.0760916397f,
+    0.36104849f, 0.180111185f, 0.0137926787f, -0.167144626f,
+    0.11172501f, 0.121503629f, -0.0208623894f, -0.0110837668f,
+    0.318179488f, 0.363838911f, 0.0241922662f, 0.0698516816f,
+    0.068855986f, 0.305231333f, -0.0104627982f, 0.225912541f,
+    0.0496036559f, -0.13790673f, 0.00202941149f, -0.185480967f,
+    -0.383080781f, -0.491378427f, -0.156572595f, -0.264870256f,
+    0.282186747f, 0.292791694f, -0.0121783856f, -0.00157343224f,
+    -0.15049766f, -0.0606799982f, -0.170780376f, -0.0809627101f,
+    0.304610193f, 0.207733631f, 0.078439936f, -0.0184366237f,
+    0.0952143073f, 0.0617987886f, 0.0588357151f, 0.0254201964f,
+    -0.087857537f, 0.139566422f, -0.133716881f, 0.0937070921f,
+    -0.29725343f, -0.00636842847f, -0.153321087f, 0.137563914f,
+    0.416544229f, 0.196523517f, 0.0403505415f, -0.179670155f,
+    0.0640620813f, -0.312603533f, -0.0194115937f, -0.396077216f,
+    0.12000256f, 0.215509057f, -0.136929363f, -0.0414228737f,
+    -0.232479587f, -0.293618023f, -0.196691498f, -0.257829934f,
+    0.157755882f, 0.140496135f, 0.150160313f, 0.132900581f,
+    -0.273624271f, -0.325284898f, -0.0436593555f, -0.0953200087f,
+    -0.175267041f, 0.0579464659f, -0.0640787259f, 0.169134781f,
+    -0.606647193f, -0.407834589f, -0.25789839f, -0.0590858124f,
+    0.138096362f, 0.105587021f, -0.0236405805f, -0.0561499298f,
+    -0.0566931516f, -0.0804026797f, -0.112775229f, -0.136484757f,
+    -0.0618279427f, 0.217572495f, -0.0773498043f, 0.202050641f,
+    -0.256617457f, 0.0315827988f, -0.16648443f, 0.121715821f,
+    0.230322972f, 0.0111800134f, -0.0339270979f, -0.253070056f,
+    0.0264447071f, -0.0432637334f, -0.0607982874f, -0.130506724f,
+    0.226194367f, 0.155936137f, -0.0649782419f, -0.135236472f,
+    0.0223161057f, 0.10149239f, -0.0918494314f, -0.0126731386f,
+    0.30990684f, 0.343665838f, 0.11231406f, 0.146073073f,
+    -0.0902942717f, 0.0104493052f, 0.0918094963f, 0.192553073f,
+    -0.330553919f, 0.0690964758f, -0.133022383f, 0.266627997f,
+    -0.730755031f, -0.264120042f, -0.153526977f, 0.313107997f,
+    -0.067050539f, -0.0822621658f, -0.0431387983f, -0.0583504252f,
+    -0.00630425662f, -0.0334513076f, 0.00664222613f, -0.0205048248f,
+    -0.002841115f, -0.00522264838f, 0.0416525602f, 0.0392710268f,
+    0.0579051673f, 0.0435882062f, 0.0914335847f, 0.0771166235f,
+    0.152623534f, -0.0665219426f, 0.0218060315f, -0.197339445f,
+    -0.00277876109f, 0.0680248886f, -0.0439056605f, 0.0268979929f,
+    0.363407135f, 0.186432645f, 0.0333381146f, -0.143636376f,
+    0.208004817f, 0.320979446f, -0.0323735885f, 0.0806010589f,
+    0.183318302f, 0.142619178f, -0.0750610456f, -0.115760177f,
+    6.00423664e-05f, 0.0357427187f, -0.0432546921f, -0.00757201761f,
+    0.158385009f, 0.31223157f, -0.0388495885f, 0.114996947f,
+    -0.0248732455f, 0.205355108f, -0.007043235f, 0.223185107f,
+    0.162631869f, -0.024394013f, 0.0603012517f, -0.126724631f,
+    0.118128166f, -0.0110767037f, -0.0031272769f, -0.132332146f,
+    0.115489453f, -0.0187528171f, -0.00585237145f, -0.140094638f,
+    0.0709857419f, -0.00543551147f, -0.0692809001f, -0.145702153f,
+    0.123888507f, -0.100810908f, 0.0925623402f, -0.132137075f,
+    -0.0106122121f, -0.0203754809f, 0.0321878344f, 0.0224245675f,
+    0.358914346f, 0.160663158f, 0.0715302303f, -0.12672095f,
+    0.224413633f, 0.241098598f, 0.0111557422f, 0.0278406944f,
+    0.184384063f, 0.0674213767f, 0.0301812142f, -0.086781472f,
+    0.0405290835f, 0.110716589f, 0.00498772413f, 0.0751752257f,
+    0.258666635f, 0.151867688f, 0.0423426256f, -0.0644563287f,
+    0.114811651f, 0.195162892f, 0.0171491317f, 0.097500369f,
+    0.253170162f, 0.0721873492f, 0.263084114f, 0.0821012929f,
+    0.0515291244f, -0.0855539218f, 0.132370427f, -0.00471261144f,
+    0.176204935f, 0.250800133f, 0.150345549f, 0.224940747f,
+    -0.0254361052f, 0.0930588543f, 0.0196318962f, 0.13812685f,
+    0.113254726f, -0.135005176f, 0.0195418522f, -0.228718057f,
+    -0.198274523f, -0.0709152818f, -0.17437169f, -0.0470124558f,
+    0.23519972f, 0.0809339359f, 0.0110482424f, -0.143217549f,
+    -0.0763295293f, 0.145023823f, -0.182865292f, 0.0384880491f,
+    0.053875491f, 0.134985f, 0.0407740436f, 0.121883549f,
+    0.201566398f, 0.190125942f, -0.0373293199f, -0.0487697795f,
+    0.0160424858f, -0.0754294991f, -0.00933962688f, -0.100811616f,
+    0.163733393f, -0.0202885643f, -0.0874429867f, -0.271464944f,
+    0.224200606f, -0.175733313f, 0.167822361f, -0.232111573f,
+    0.119551867f, -0.285665512f, -0.0806575269f, -0.485874921f,
+    0.0334218182f, 0.0237962138f, 0.0921627432f, 0.082537137f,
+    -0.0712269172f, -0.0861359984f, -0.156317145f, -0.171226218f,
+    0.00897344388f, -0.0753141642f, 0.0420533344f, -0.0422342718f,
+    -0.0496098995f, 0.0282317568f, -0.0812526494f, -0.00341099128f,
+    0.0410082266f, 0.0755786747f, -0.0160951242f, 0.0184753295f,
+    -0.017575115f, 0.179124594f, -0.139401108f, 0.0572986081f,
+    -0.0876948461f, -0.0666956753f, 0.0598295331f, 0.0808287039f,
+    0.185438514f, 0.240870535f, 0.122511439f, 0.177943468f,
+    0.0636063218f, -0.150773048f, 0.0401406884f, -0.174238682f,
+    0.336739689f, 0.156793162f, 0.102822617f, -0.0771239102f,
+    0.838204205f, 0.593696117f, -0.00287896395f, -0.247387052f,
+    0.5150612f, 0.483631641f, 0.0968117341f, 0.0653821975f,
+    0.151620626f, 0.199326158f, -0.000275865197f, 0.0474296659f,
+    -0.171522379f, 0.0892617106f, 0.0994148254f, 0.360198915f,
+    0.228762776f, -0.0138949156f, 0.0601178184f, -0.182539865f,
+    0.0491259843f, -0.118618637f, -0.0348204374f, -0.202565059f,
+    -0.010342136f, 0.00580513664f, 0.0190594327f, 0.0352067053f,
+    -0.189978927f, -0.098918587f, -0.0758788288f, 0.0151815088f,
+    0.00516909733f, -0.0130011719f, 0.0328212865f, 0.0146510182f,
+    -0.0124582322f, 0.0118284207f, 0.0044942908f, 0.0287809446f,
+    0.0149412332f, -0.0357784033f, 0.000759860501f, -0.0499597788f,
+    -0.00268609566f, -0.0109488089f, -0.027567137f, -0.0358298495f,
+    0.268904507f, 0.112106226f, 0.169104978f, 0.0123066902f,
+    0.140781671f, 0.224820316f, 0.0321441106f, 0.116182752f,
+    0.268667728f, 0.323265851f, 0.161927477f, 0.216525614f,
+    0.140544891f, 0.435979962f, 0.0249666125f, 0.320401669f,
+    -0.0527354591f, -0.0511164181f, -0.0104562836f, -0.00883724354f,
+    -0.00419846177f, 0.0169679485f, -0.016964063f, 0.00420234539f,
+    0.000591546297f, -0.0178282876f, -0.026057912f, -0.0444777459f,
+    0.0491285436f, 0.0502560809f, -0.0325656906f, -0.0314381532f,
+    -0.300120324f, -0.0669532865f, -0.197704807f, 0.0354622379f,
+    -0.141304731f, -0.0660800338f, -0.215560853f, -0.140336156f,
+    -0.0485889316f, -0.146120936f, -0.0563838035f, -0.153915808f,
+    0.110226661f, -0.145247683f, -0.0742398649f, -0.329714209f,
+    -0.161573127f, -0.103800513f, 0.0552324429f, 0.113005057f,
+    -0.0752010942f, -0.0822962373f, -0.0697763115f, -0.0768714547f,
+    0.0917639583f, -0.0127546564f, 0.0658102706f, -0.0387083441f,
+    0.178135991f, 0.00874961913f, -0.0591984801f, -0.228584856f,
+    0.0514208823f, 0.253922731f, 0.0255084485f, 0.228010282f,
+    0.0677426308f, 0.0476031154f, -0.00493747368f, -0.0250769891f,
+    -0.128395975f, 0.0548640564f, -0.0226894096f, 0.160570621f,
+    -0.112074226f, -0.151455551f, -0.0531353354f, -0.0925166532f,
+    -0.266926914f, -0.0606536642f, -0.114914097f, 0.0913591534f,
+    -0.112178735f, -0.101880752f, -0.10016869f, -0.0898707062f,
+    -0.103309922f, -0.141395524f, -0.0164493062f, -0.0545349121f,
+    0.0514382534f, -0.182622612f, -0.00170390308f, -0.235764772f,
+    -0.198746666f, -0.127882585f, -0.0238865446f, 0.0469775386f,
+    -0.110628538f, -0.10819158f, -0.161452681f, -0.15901573f,
+    -0.0820956752f, -0.126989156f, -0.028046567f, -0.0729400516f,
+    0.0060224575f, -0.107298151f, -0.165612713f, -0.278933316f,
+    0.0995323285f, -0.0941341072f, -0.169305712f, -0.36297214f,
+    -0.432796955f, -0.275215149f, -0.308929652f, -0.151347846f,
+    -0.00832417607f, 0.121419236f, -0.0782705396f, 0.0514728799f,
+    -0.540653467f, -0.0596618056f, -0.217894495f, 0.263097167f,
+    0.117265813f, -0.0825166553f, 0.169892296f, -0.0298901834f,
+    0.06275554f, -0.195265919f, -0.0178020522f, -0.275823504f,
+    0.117085963f, 0.0530016087f, 0.134023041f, 0.069938682f,
+    0.0625756904f, -0.0597476438f, -0.0536713153f, -0.17599465f,
+    -0.0159115884f, -0.268631876f, -0.105719633f, -0.358439922f,
+    0.0204283819f, 0.0379520245f, -0.0225821026f, -0.00505845994f,
+    0.22116667f, 0.0153568536f, -0.0756663829f, -0.2814762f,
+    0.257506639f, 0.32194075f, 0.00747113675f, 0.0719052404f,
+    -0.0853940323f, -0.0597239174f, -0.11090529f, -0.085235171f,
+    -0.07523866f, -0.272545993f, -0.0693100914f, -0.266617447f,
+    0.0842342675f, 0.0384444445f, -0.087841168f, -0.133630991f,
+    0.0943896472f, -0.17437765f, -0.0462459549f, -0.31501326f,
+    0.421786368f, -0.0190473646f, 0.224502057f, -0.216331661f,
+    -0.107704423f, -0.179753751f, 0.0878058672f, 0.0157565475f,
+    0.625413597f, 0.279740483f, 0.151031956f, -0.194641173f,
+    0.095922783f, 0.119034082f, 0.0143357404f, 0.0374470353f,
+    0.252566457f, -0.245930552f, -0.129668593f, -0.628165603f,
+    -0.0349065289f, -0.510796666f, -0.138300002f, -0.614190102f,
+    0.511069357f, 0.290011257f, 0.116144031f, -0.104914069f,
+    0.223596349f, 0.0251451991f, 0.107512638f, -0.090938516f,
+    0.464288265f, 0.000234223902f, 0.322769254f, -0.141284779f,
+    0.11266043f, -0.372646362f, 0.0549525023f, -0.430354297f,
+    0.492461294f, 0.179758921f, 0.380000323f, 0.0672979578f,
+    0.140833452f, -0.193121672f, 0.112183563f, -0.221771553f,
+    0.290825427f, 0.00793588161f, 0.102269106f, -0.180620447f,
+    0.0236364901f, -0.310245574f, 0.0569586903f, -0.276923358f,
+    0.340051174f, 0.129833043f, 0.0887551904f, -0.121462934f,
+    0.0728622377f, -0.188348398f, 0.0434447974f, -0.217765838f,
+    0.15040262f, -0.109015539f, 0.1729289f, -0.0864892453f,
+    0.0316798687f, -0.0754600987f, 0.0653023198f, -0.0418376438f,
+    0.220410094f, -0.0116112418f, 0.133749545f, -0.0982717797f,
+    0.101687342f, 0.0219442043f, 0.0261229593f, -0.0536201783f,
+    0.44122985f, 0.276871473f, 0.369433522f, 0.205075145f,
+    0.127522722f, 0.0751579478f, 0.295553386f, 0.24318862f,
+    0.559480131f, 0.454758346f, 0.378205299f, 0.273483485f,
+    0.245772988f, 0.253044784f, 0.304325163f, 0.31159696f,
+    -0.0610437989f, -0.0444683172f, 0.0273109041f, 0.0438863859f,
+    -0.0190274566f, -0.0590955578f, 0.00889570639f, -0.0311723948f,
+    -0.0679487139f, -0.0683473721f, 0.0164341964f, 0.0160355363f,
+    -0.0259323716f, -0.0829746127f, -0.00198099948f, -0.0590232424f,
+    -0.282667726f, -0.322746903f, -0.0065059159f, -0.0465851016f,
+    -0.108124517f, -0.0487533137f, -0.028462043f, 0.030909162f,
+    0.0229517817f, -0.0958936736f, 0.0469432548f, -0.0719022006f,
+    0.197494999f, 0.17809993f, 0.0249871295f, 0.00559205981f,
+    0.150794908f, -0.218448758f, -0.000103995204f, -0.369347662f,
+    0.0234379843f, -0.096259281f, 0.0256977826f, -0.0939994752f,
+    0.374335766f, 0.12888214f, -0.0261093825f, -0.271562994f,
+    0.246978849f, 0.251071662f, -0.000307596289f, 0.00378520973f,
+    -0.0050043771f, -0.17862308f, 0.0965004861f, -0.0771182254f,
+    -0.00563776493f, -0.0712680072f, 0.00838452205f, -0.0572457165f,
+    0.244712532f, 0.00494633615f, 0.183831438f, -0.055934757f,
+    0.244079143f, 0.112301424f, 0.0957154781f, -0.0360622481f,
+    -0.200781062f, -0.292810977f, 0.0272385888f, -0.0647913143f,
+    -0.121377759f, -0.0491337106f, -0.00740636885f, 0.0648376793f,
+    0.0635422692f, -0.0914605111f, 0.083818391f, -0.0711843967f,
+    0.142945573f, 0.152216733f, 0.0491734333f, 0.0584445968f,
+    0.000795209722f, -0.0508629046f, -0.00288697705f, -0.0545450896f,
+    -0.00418170542f, 0.0206137337f, 0.0117782466f, 0.0365736857f,
+    0.144328088f, 0.0747581273f, 0.0567207374f, -0.0128492191f,
+    0.139351159f, 0.146234751f, 0.0713859499f, 0.0782695562f,
+    0.0669644773f, 0.0338775441f, -0.00242914259f, -0.0355160758f,
+    0.0444263369f, -0.129204229f, -0.00407654047f, -0.177707106f,
+    -0.116656691f, -0.0406775773f, -0.0960270017f, -0.0200478844f,
+    -0.139194831f, -0.203759342f, -0.0976743996f, -0.162238911f,
+    -0.0255549476f, -0.101899542f, 0.212875515f, 0.136530921f,
+    0.0514477827f, 0.0384609103f, 0.149283484f, 0.136296615f,
+    0.0196854062f, -0.0395024866f, 0.109513938f, 0.0503260493f,
+    0.0966881365f, 0.100857958f, 0.0459219068f, 0.0500917323f,
+    -0.0847765207f, 0.0704262853f, -0.0535004064f, 0.101702407f,
+    -0.151696607f, -0.0639778003f, -0.0455340073f, 0.0421847962f,
+    -0.0909124464f, -0.116955094f, 0.00816687196f, -0.0178757757f,
+    -0.157832533f, -0.251359195f, 0.01613326f, -0.0773933902f,
+    0.30392617f, 0.381372601f, 0.10624408f, 0.183690503f,
+    0.175169185f, -0.151939392f, 0.100595057f, -0.226513505f,
+    0.178416982f, 0.292889535f, 0.0481066629f, 0.162579209f,
+    0.0496599935f, -0.240422428f, 0.0424576327f, -0.2476248f,
+    0.0500391573f, 0.0258118175f, 0.045954179f, 0.0217268411f,
+    -0.0381768867f, -0.0132860951f, 0.0128945298f, 0.0377853215f,
+    -0.168699414f, -0.393354654f, -0.0609828681f, -0.285638124f,
+    -0.25691545f, -0.432452589f, -0.0940425098f, -0.269579649f,
+    -0.330625921f, -0.733804166f, -0.226214036f, -0.629392266f,
+    -0.472873092f, -0.771164179f, -0.137205392f, -0.435496509f,
+    -0.0874542594f, -0.267376244f, -0.000530056655f, -0.180452034f,
+    -0.22970143f, -0.304736316f, 0.0884785801f, 0.0134437056f,
+    0.394347936f, 0.0583840162f, 0.198191702f, -0.137772202f,
+    0.135533229f, -0.167584702f, 0.0135379434f, -0.289579988f,
+    -0.0943835452f, -0.559440494f, -0.0528871119f, -0.517944038f,
+    -0.35319826f, -0.785409212f, -0.237540886f, -0.669751823f,
+    0.31064713f, 0.11823079f, 0.144648403f, -0.0477679372f,
+    0.207630828f, -0.0160199553f, 0.0817993283f, -0.141851455f,
+    -0.038800694f, -0.316803873f, -0.00275315344f, -0.280756354f,
+    -0.141817003f, -0.451054633f, -0.0656022429f, -0.374839872f,
+    0.0100715812f, 0.0724876747f, -0.0191704165f, 0.0432456769f,
+    -0.104238436f, -0.0913375914f, -0.145021334f, -0.13212049f,
+    -0.0421913825f, -0.0904230028f, -0.0057263393f, -0.0539579615f,
+    -0.156501397f, -0.254248261f, -0.131577253f, -0.229324132f,
+    0.18313919f, 0.250899881f, 0.12067429f, 0.188434973f,
+    0.270365804f, 0.439225197f, 0.138728902f, 0.307588309f,
+    0.0725515559f, -0.213599265f, -0.112583131f, -0.398733944f,
+    0.159778163f, -0.0252739266f, -0.0945285037f, -0.279580593f,
+    0.0146417823f, -0.0224054456f, -0.029853493f, -0.0669007227f,
+    0.00978566241f, 0.00139261968f, 0.0349498913f, 0.0265568495f,
+    0.00410880661f, -0.0184090324f, -0.0249233078f, -0.0474411473f,
+    -0.000747313141f, 0.00538903475f, 0.0398800783f, 0.0460164249f,
+    0.134292379f, 0.221069247f, 0.0874286219f, 0.174205497f,
+    -0.234552711f, -0.109422781f, -0.0784502774f, 0.0466796644f,
+    0.0366410762f, 0.188408226f, 0.0480935797f, 0.199860722f,
+    -0.332204014f, -0.142083809f, -0.11778532f, 0.072334893f,
+    -0.0783576593f, 0.0256399997f, 0.0465796329f, 0.150577292f,
+    -0.0948822349f, -0.0860869586f, 0.000220958143f, 0.00901623815f,
+    -0.234724164f, -0.287343502f, -0.0170565359f, -0.0696758851f,
+    -0.251248747f, -0.399070472f, -0.0634152219f, -0.211236939f,
+    0.215239018f, 0.124541491f, 0.159832239f, 0.0691347197f,
+    0.122803852f, 0.0484830737f, 0.15117301f, 0.0768522322f,
+    -0.107249454f, -0.111474335f, 0.0339594856f, 0.0297346078f,
+    -0.19968462f, -0.187532753f, 0.0253002606f, 0.0374521241f,
+    -0.0224800035f, 0.147304714f, -0.00404503942f, 0.165739685f,
+    -0.0889490098f, -0.0131928809f, -0.00998262689f, 0.065773502f,
+    -0.0629882142f, 0.0166373029f, 0.00268240273f, 0.0823079199f,
+    -0.12945722f, -0.143860295f, -0.00325519033f, -0.0176582672f,
+    -0.0441974849f, -0.0155319655f, -0.0252581332f, 0.0034073866f,
+    -0.233498499f, -0.155211106f, -0.0482292287f, 0.0300581679f,
+    -0.0347755998f, -0.0421213359f, 0.0384351164f, 0.0310893841f,
+    -0.224076614f, -0.181800485f, 0.0154640228f, 0.0577401668f,
+    0.114750132f, -0.188172653f, -0.105993479f, -0.408916265f,
+    0.0700396895f, -0.160436064f, 0.00255063921f, -0.227925107f,
+    -0.0476032645f, -0.0684733465f, -0.189739197f, -0.210609272f,
+    -0.0923136994f, -0.0407367535f, -0.0811950564f, -0.0296181124f,
+    0.175220937f, 0.297608078f, 0.0305703431f, 0.152957499f,
+    0.0252664182f, 0.0318034105f, -0.0892578438f, -0.0827208534f,
+    0.148149461f, 0.106879309f, 0.0765192509f, 0.0352491066f,
+    -0.00180506322f, -0.158925369f, -0.0433089323f, -0.200429246f,
+    0.0439345911f, -0.0505621433f, 0.0524971485f, -0.0419995822f,
+    -0.014293164f, -0.0126747787f, 0.0879202113f, 0.0895385966f,
+    -0.220841095f, -0.236863181f, -0.0602197461f, -0.0762418285f,
+    -0.279068857f, -0.198975801f, -0.0247966927f, 0.0552963503f,
+    -0.0630653054f, 0.00489120185f, 0.0104736984f, 0.0784302056f,
+    0.118272573f, 0.252767473f, 0.10560184f, 0.240096748f,
+    -0.193929687f, -0.156162784f, -0.0175677538f, 0.0201991498f,
+    -0.0125918016f, 0.0917135179f, 0.0775603876f, 0.181865707f,
+    -0.11649324f, -0.190301061f, -0.0946463197f, -0.16845414f,
+    0.0827554613f, -0.0296894088f, -0.0834423676f, -0.195887238f,
+    -0.233585611f, -0.0853261352f, -0.169335023f, -0.0210755467f,
+    -0.0343369022f, 0.0752855316f, -0.158131063f, -0.0485086292f,
+    0.116681322f, 0.211263672f, 0.0627287552f, 0.157311112f,
+    -0.0224620402f, 0.218299851f, 0.10291712f, 0.343679011f,
+    -0.139092073f, -0.139766768f, -0.121371664f, -0.122046359f,
+    -0.278235435f, -0.132730603f, -0.0811833069f, 0.0643215328f,
+    0.103523247f, -0.111286566f, 0.0243292898f, -0.19048053f,
+    0.172141865f, -0.0337680876f, -0.203620762f, -0.409530699f,
+    -0.371849775f, -0.357015401f, -0.0900444239f, -0.0752100348f,
+    -0.30323115f, -0.279496908f, -0.317994446f, -0.294260204f,
+    -0.00544437347f, -0.0354226008f, -0.177643895f, -0.207622111f,
+    0.217630669f, 0.108953774f, -0.167273432f, -0.275950313f,
+    -0.246302947f, -0.105899654f, -0.149396569f, -0.00899328291f,
+    -0.0232279114f, 0.0384767279f, -0.139026105f, -0.0773214698f,
+    -0.2533198f, -0.277893722f, -0.263157666f, -0.287731588f,
+    -0.202778339f, -0.173976898f, -0.202370614f, -0.173569173f,
+    -0.325689226f, -0.242668673f, -0.219778255f, -0.136757702f,
+    -0.275147766f, -0.138751835f, -0.158991218f, -0.0225952826f,
+    0.0390389673f, -0.123107739f, -0.0820582062f, -0.244204909f,
+    0.312917978f, 0.0573475957f, -0.0324534774f, -0.288023859f,
+    -0.0955476835f, 0.0179289281f, -0.164589733f, -0.0511131212f,
+    0.17833133f, 0.198384255f, -0.114985012f, -0.0949320793f,
+    -0.0138157904f, 0.0330753624f, 0.0243927836f, 0.0712839365f,
+    -0.0272528976f, -0.0221384875f, 0.0320569612f, 0.0371713713f,
+    -0.0113049699f, 0.0252354909f, 0.029422136f, 0.0659625977f,
+    -0.024742078f, -0.029978361f, 0.0370863155f, 0.0318500325f,
+    -0.235318333f, -0.236289188f, -0.0816416293f, -0.0826124921f,
+    -0.293562829f, -0.193096161f, -0.269914925f, -0.169448256f,
+    -0.235288769f, -0.250718415f, -0.0859414041f, -0.10137105f,
+    -0.293533266f, -0.207525373f, -0.274214685f, -0.188206822f,
+    -0.0650466233f, -0.142725855f, 0.0337070785f, -0.0439721569f,
+    -0.0559682548f, -0.0251675844f, 0.0764541328f, 0.107254803f,
+    -0.213071853f, -0.13857916f, -0.103653528f, -0.0291608423f,
+    -0.203993484f, -0.0210208893f, -0.0609064847f, 0.12206611f,
+    -0.128875375f, -0.124269329f, -0.0773200095f, -0.0727139562f,
+    0.0700658336f, -0.0164415091f, -0.133987755f, -0.220495105f,
+    -0.130315557f, -0.0992359743f, -0.0707795098f, -0.039699927f,
+    0.0686256588f, 0.00859184563f, -0.127447262f, -0.187481076f,
+    -0.303450048f, -0.259343863f, -0.197878331f, -0.153772146f,
+    -0.239385486f, -0.189186424f, -0.251196235f, -0.200997189f,
+    -0.328716874f, -0.226426899f, -0.155552506f, -0.0532625429f,
+    -0.264652342f, -0.156269476f, -0.208870456f, -0.100487582f,
+    -0.183959752f, -0.259197384f, -0.119095571f, -0.194333211f,
+    -0.293063879f, -0.24871543f, -0.223483145f, -0.179134697f,
+    -0.165159434f, -0.235913008f, -0.119129427f, -0.189882994f,
+    -0.274263561f, -0.225431055f, -0.223517001f, -0.174684495f,
+    0.103118077f, 0.0644641742f, 0.0991596654f, 0.0605057664f,
+    0.165941566f, 0.143780291f, 0.119448602f, 0.0972873271f,
+    0.0750595033f, 0.0166439638f, 0.0936478823f, 0.0352323428f,
+    0.137882993f, 0.0959600806f, 0.113936827f, 0.0720139071f,
+    -0.265147716f, -0.101930112f, -0.176122069f, -0.0129044605f,
+    -0.1190947f, 0.0297187325f, -0.106112227f, 0.0427012108f,
+    -0.499460161f, -0.293217689f, -0.187634856f, 0.0186076015f,
+    -0.353407115f, -0.161568835f, -0.117625013f, 0.0742132738f,
+    -0.0912636593f, 0.0937000215f, 0.00423888862f, 0.189202577f,
+    -0.290159523f, -0.201542318f, -0.0564191565f, 0.0321980566f,
+    -0.0812852532f, 0.0586950146f, -0.0248999223f, 0.115080342f,
+    -0.28018111f, -0.236547321f, -0.0855579749f, -0.0419241823f,
+    -0.515051067f, -0.0135751888f, -0.294373751f, 0.207102135f,
+    -0.97912395f, -0.0682230294f, -0.214603603f, 0.696297288f,
+    -0.130964309f, -0.059523426f, -0.113483958f, -0.042043075f,
+    -0.595037162f, -0.114171252f, -0.0337138027f, 0.447152108f,
+    0.0805465132f, 0.0194376633f, -0.0106953084f, -0.0718041584f,
+    -0.143400341f, -0.0984312221f, -0.071646817f, -0.0266776979f,
+    -0.170643702f, -0.0520130955f, -0.0968800262f, 0.0217505787f,
+    -0.394590557f, -0.169881985f, -0.157831535f, 0.0668770373f,
+    -0.198191032f, 0.308053374f, 0.0499734581f, 0.556217849f,
+    -0.453046799f, -0.170948893f, 0.114608675f, 0.396706581f,
+    -0.287791848f, -0.0185060948f, -0.0406623036f, 0.22862345f,
+    -0.5426476f, -0.497508347f, 0.0239729211f, 0.0691121668f,
+    0.310720295f, 0.155509353f, -0.0255422667f, -0.180753216f,
+    0.278187752f, 0.528033435f, -0.0713019744f, 0.178543732f,
+    0.0845177472f, 0.124997683f, 0.00401800126f, 0.044497937f,
+    0.0519852266f, 0.497521788f, -0.0417416841f, 0.403794885f,
+    0.0262902789f, -0.234794676f, -0.0302714258f, -0.291356385f,
+    -0.122346953f, -0.120110266f, -0.171423137f, -0.169186443f,
+    -0.108276516f, -0.126972094f, 0.0194489043f, 0.000753324479f,
+    -0.256913751f, -0.0122876875f, -0.121702805f, 0.122923262f,
+    -0.0169686507f, -0.0494761206f, -0.116974071f, -0.149481535f,
+    -0.214797556f, -0.0196941979f, -0.114722595f, 0.080380775f,
+    -0.195489123f, -0.206384927f, -0.115848966f, -0.126744762f,
+    -0.393318027f, -0.176602989f, -0.113597482f, 0.103117555f,
+    0.162534714f, 0.0688097775f, 0.201719433f, 0.107994497f,
+    0.123147614f, -0.0287218951f, 0.0371795893f, -0.114689916f,
+    0.0198726747f, 0.226465583f, 0.12130782f, 0.327900738f,
+    -0.0195144303f, 0.128933907f, -0.0432320274f, 0.105216302f,
+    -0.0769520551f, -0.108745769f, -0.0275132619f, -0.0593069792f,
+    -0.0636094362f, -0.0874096602f, -0.0601534843f, -0.0839537084f,
+    -0.0788472444f, -0.105053626f, -0.00225994643f, -0.0284663346f,
+    -0.0655046254f, -0.083717525f, -0.0349001735f, -0.0531130657f,
+    -0.102544509f, 0.0477922522f, -0.144821286f, 0.0055154711f,
+    -0.251986861f, -0.158155069f, -0.191740811f, -0.0979090258f,
+    -0.039466437f, -0.0203327555f, -0.0976417512f, -0.0785080716f,
+    -0.1889088f, -0.226280093f, -0.144561291f, -0.181932569f,
+    -0.0509089828f, 0.0332865864f, 0.0117094815f, 0.0959050506f,
+    -0.220370144f, -0.139459834f, -0.0647519529f, 0.0161583647f,
+    -0.198636681f, -0.0872707814f, -0.129431739f, -0.0180658475f,
+    -0.368097842f, -0.260017216f, -0.205893159f, -0.0978125334f,
+    0.152969584f, -0.0305337533f, -0.062186189f, -0.245689526f,
+    0.00691204518f, -0.0100816153f, -0.127271786f, -0.144265443f,
+    -0.0560690388f, -0.0805374235f, -0.051182285f, -0.0756506696f,
+    -0.202126577f, -0.0600852743f, -0.116267882f, 0.0257734209f,
+    0.00056300353f, -0.0907980278f, -0.178753451f, -0.270114481f,
+    -0.126192242f, -0.0941407755f, -0.231316298f, -0.199264824f,
+    -0.103808969f, -0.0680677742f, -0.085472554f, -0.0497313589f,
+    -0.230564222f, -0.0714105293f, -0.138035402f, 0.0211182944f,
+    0.0430579931f, 0.00365269184f, -0.0988798589f, -0.13828516f,
+    -0.130226344f, -0.094656907f, -0.142560929f, -0.106991485f,
+    -0.0138523504f, -0.00597766601f, -0.0316450894f, -0.0237704068f,
+    -0.187136695f, -0.104287267f, -0.0753261596f, 0.0075232666f,
+    -0.262562335f, -0.267114043f, -0.00884178467f, -0.0133934962f,
+    -0.254732519f, -0.0559157729f, 0.115774237f, 0.314590991f,
+    -0.144724309f, -0.0519054234f, -0.00554035604f, 0.08727853f,
+    -0.136894509f, 0.159292847f, 0.119075641f, 0.415262997f,
+    -0.049916137f, 0.0921370909f, -0.196877256f, -0.0548240207f,
+    -0.635131121f, -0.105935365f, -0.282665759f, 0.246529996f,
+    0.000908136368f, -0.0188197102f, -0.0435756817f, -0.0633035302f,
+    -0.584306836f, -0.216892138f, -0.129364192f, 0.238050491f,
+    0.153550848f, 0.204903424f, 0.129317716f, 0.180670291f,
+    0.0060011372f, -0.0176264439f, 0.0227592234f, -0.000868357718f,
+    0.101793021f, 0.0215259288f, 0.0736032873f, -0.00666380674f,
+    -0.0457566902f, -0.201003939f, -0.0329552032f, -0.188202456f,
+    0.244451627f, 0.0429089516f, -0.0867390037f, -0.288281679f,
+    0.184374601f, -0.269423664f, -0.159420803f, -0.613219082f,
+    0.0132537708f, 0.173958614f, -0.120620891f, 0.0400839448f,
+    -0.0468232483f, -0.138374031f, -0.193302691f, -0.284853458f,
+    0.150024787f, 0.0989096463f, 0.032677561f, -0.0184375774f,
+    0.169318989f, 0.0732706338f, -0.0391192473f, -0.135167599f,
+    0.0827167183f, 0.0157720707f, -0.0141685717f, -0.0811132193f,
+    0.102010913f, -0.00986694545f, -0.0859653801f, -0.197843239f,
+    0.114765003f, 0.0639864579f, 0.033724077f, -0.0170544665f,
+    0.0962164924f, 0.130366325f, 0.12369746f, 0.157847285f,
+    -0.0399814248f, -0.0291780904f, -0.0901253521f, -0.0793220177f,
+    -0.0585299283f, 0.0372017696f, -0.000151969492f, 0.0955797285f,
+    -0.21161446f, -0.461237729f, -0.245342731f, -0.494966f,
+    -0.232041329f, -0.572232544f, -0.155869961f, -0.496061176f,
+    -0.0596312247f, -0.189203262f, -0.0144264102f, -0.143998444f,
+    -0.0800580904f, -0.300198078f, 0.075046353f, -0.145093635f,
+    -0.160173222f, -0.0478814766f, -0.0200428739f, 0.0922488719f,
+    -0.0163207501f, 0.00175492791f, -0.0271427855f, -0.00906710792f,
+    0.114439271f, 0.0937407911f, 0.0989484042f, 0.0782499239f,
+    0.258291751f, 0.143377215f, 0.0918484852f, -0.0230660532f,
+    0.189410701f, 0.0870133713f, 0.0390636548f, -0.0633336753f,
+    0.159632728f, -0.0159674063f, 0.0450597033f, -0.130540431f,
+    -0.0281217955f, -0.0236564912f, 0.0133204916f, 0.0177857969f,
+    -0.0578997657f, -0.126637265f, 0.0193165373f, -0.049420964f,
+    0.095238246f, 0.090611659f, 0.0822898149f, 0.0776632279f,
+    0.0603254139f, 0.00182267278f, -0.0674276054f, -0.125930354f,
+    0.163328439f, -0.0417749695f, 0.0477875918f, -0.15731582f,
+    0.128415599f, -0.130563959f, -0.101929843f, -0.360909402f,
+    -0.0436167419f, -0.00176240969f, -0.0519773997f, -0.0101230647f,
+    0.0101889279f, 0.00779840257f, 0.0188265853f, 0.016436059f,
+    -0.066339314f, -0.0152691212f, -0.0210491624f, 0.0300210305f,
+    -0.0125336451f, -0.00570830703f, 0.0497548208f, 0.0565801561f,
+    0.104420841f, 0.114892185f, 0.0610092655f, 0.0714806095f,
+    -0.200378448f, -0.116371199f, -0.0444759242f, 0.0395313278f,
+    -0.0587634146f, -0.0135710835f, 0.0535846911f, 0.0987770259f,
+    -0.363562703f, -0.244834468f, -0.0519004986f, 0.0668277442f,
+    0.233521581f, 0.242230684f, 0.0971860588f, 0.105895154f,
+    0.120377183f, 0.127674669f, 0.060871467f, 0.0681689531f,
+    0.0089379549f, 0.00247671455f, 0.0476059578f, 0.0411447175f,
+    -0.10420645f, -0.112079307f, 0.0112913661f, 0.00341851264f,
+    -0.0413777865f, 0.110482149f, -0.0161445811f, 0.135715351f,
+    0.111109905f, 0.119336002f, 0.100032195f, 0.108258292f,
+    0.0537923351f, 0.102715984f, 0.065510489f, 0.114434138f,
+    0.206280023f, 0.111569837f, 0.181687281f, 0.086977087f,
+    0.0614155978f, 0.18035695f, 0.040338181f, 0.159279525f,
+    -0.0118336454f, 0.0533806495f, 0.0192356892f, 0.0844499841f,
+    -0.0788710713f, 0.0138227344f, -0.00770962983f, 0.0849841759f,
+    -0.152120307f, -0.113153554f, -0.0288121216f, 0.0101546291f,
+    0.132978827f, 0.124240033f, 0.14666149f, 0.137922704f,
+    0.0357585102f, -0.00506544113f, 0.0759396553f, 0.0351157039f,
+    -0.0323807299f, 0.00299238227f, 0.00626632012f, 0.0416394323f,
+    -0.129601046f, -0.12631309f, -0.0644555241f, -0.0611675642f,
+    -0.167934507f, -0.242291808f, -0.0480758883f, -0.122433193f,
+    -0.0591948181f, -0.265515745f, -0.106706135f, -0.313027054f,
+    -0.249095976f, -0.095766753f, -0.0997650325f, 0.0535641983f,
+    -0.140356287f, -0.118990675f, -0.158395275f, -0.137029663f,
+    0.385867357f, 0.210964143f, 0.0997267291f, -0.0751764923f,
+    0.188464701f, -0.121613093f, 0.0238939524f, -0.286183834f,
+    0.0241671428f, 0.148099601f, -0.0676989406f, 0.0562335178f,
+    -0.173235521f, -0.184477642f, -0.143531725f, -0.154773846f,
+    0.063443847f, 0.126867652f, 0.145985186f, 0.209408998f,
+    0.00536133349f, 0.0804550946f, -0.0428577028f, 0.032236062f,
+    0.00137707032f, -0.0300713405f, 0.07644137f, 0.044992961f,
+    -0.0567054451f, -0.0764838904f, -0.11240153f, -0.132179976f,
+    -0.227937579f, -0.422270298f, 0.120669432f, -0.0736632794f,
+    -0.370662272f, -0.281331569f, -0.0592944436f, 0.0300362483f,
+    -0.174601048f, -0.0638620406f, -0.0491371341f, 0.0616018698f,
+    -0.317325741f, 0.0770766661f, -0.229101032f, 0.165301397f,
+    -0.216312051f, 0.029450655f, 0.0190370083f, 0.264799714f,
+    -0.0130401552f, 0.19826901f, 0.122373551f, 0.333682716f,
+    -0.264845222f, -0.0453874022f, -0.140627518f, 0.0788303018f,
+    -0.0615733266f, 0.123430945f, -0.037290968f, 0.147713304f,
+    -0.899273932f, -0.780523539f, -0.276649177f, -0.157898784f,
+    -0.577607334f, -0.323147357f, -0.15426296f, 0.100197032f,
+    -0.421754926f, -0.37052238f, -0.0667748004f, -0.0155422613f,
+    -0.100088321f, 0.0868537873f, 0.055611439f, 0.242553547f,
+    -0.414769739f, -0.703255892f, -0.0850295871f, -0.373515725f,
+    -0.438518971f, -0.443282425f, -0.077201888f, -0.0819653273f,
+    0.045421809f, -0.0167732388f, 0.0190809816f, -0.0431140661f,
+    0.0216725748f, 0.243200243f, 0.0269086659f, 0.248436332f,
+    -0.540088475f, -0.42877391f, -0.0443509407f, 0.0669636354f,
+    -0.238814369f, -0.150111273f, 0.00844717026f, 0.0971502662f,
+    -0.299902081f, -0.0849505961f, -0.0807813406f, 0.134170145f,
+    0.00137202197f, 0.193712026f, -0.0279832408f, 0.164356768f,
+    -0.112969965f, -0.0241925977f, -0.0948283672f, -0.006051003f,
+    0.0443592146f, 0.125151962f, -0.0246912502f, 0.056101501f,
+    -0.199768379f, -0.125637144f, -0.179285169f, -0.105153918f,
+    -0.0424391888f, 0.0237074364f, -0.10914804f, -0.0430014096f,
+    -0.0713480338f, 0.0446701869f, 0.169666603f, 0.285684824f,
+    -0.233387381f, 0.0049970299f, 0.109322049f, 0.347706467f,
+    0.123375565f, -0.0150563931f, 0.132723287f, -0.00570867769f,
+    -0.0386637747f, -0.0547295511f, 0.0723787248f, 0.0563129522f,
+    0.0526275933f, 0.0393255837f, -0.0182359032f, -0.0315379128f,
+    0.0126309711f, 0.0366477668f, 0.00891617034f, 0.0329329669f,
+    -0.0142334811f, 0.00703272223f, -0.020975966f, 0.000290237367f,
+    -0.0542301051f, 0.00435490534f, 0.00617610663f, 0.0647611171f,
+    0.0884883627f, 0.213847667f, -0.029012192f, 0.0963471159f,
+    0.0363379717f, 0.0451221019f, -0.125942051f, -0.117157921f,
+    -0.00726299733f, 0.0294540934f, -0.0799085796f, -0.0431914926f,
+    -0.0594133921f, -0.139271468f, -0.176838443f, -0.256696522f,
+    -0.171283126f, 0.0110632405f, 0.0650875196f, 0.247433886f,
+    -0.0874163583f, 0.0773740113f, -0.0329594985f, 0.131830871f,
+    -0.219145358f, -0.146489233f, -0.0175101571f, 0.0551459715f,
+    -0.135278583f, -0.0801784545f, -0.115557164f, -0.0604570359f,
+    -0.133753225f, -0.086959362f, 0.0139855966f, 0.0607794598f,
+    0.120796859f, 0.00804831646f, 0.118590936f, 0.00584239047f,
+    -0.0147487745f, -0.0391426086f, 0.0510862768f, 0.0266924389f,
+    0.239801303f, 0.0558650643f, 0.155691609f, -0.0282446314f,
+    0.0192447565f, 0.175009161f, -0.0148819312f, 0.140882477f,
+    0.0980446041f, 0.0184910521f, -0.096270524f, -0.175824076f,
+    -0.0321390741f, 0.0336030051f, -0.0560470149f, 0.009695068f,
+    0.0466607735f, -0.122915111f, -0.1374356f, -0.307011485f,
+    0.0884481892f, 0.157229066f, 0.0873989314f, 0.156179816f,
+    -0.0174416341f, 0.03491126f, -0.0806026682f, -0.0282497704f,
+    0.0168729983f, -0.0727320015f, 0.0457833931f, -0.0438216031f,
+    -0.089016825f, -0.195049822f, -0.122218199f, -0.228251189f,
+    -0.249874815f, -0.719923615f, -0.185916811f, -0.655965567f,
+    -0.182765558f, -0.436107367f, -0.191221908f, -0.444563717f,
+    -0.0937928185f, -0.259521008f, -0.0209473222f, -0.186675519f,
+    -0.0266835559f, 0.0242951997f, -0.0262524299f, 0.0247263238f,
+    0.011027283f, 0.0283068605f, 0.0141756739f, 0.0314552523f,
+    -0.169921681f, -0.0405246392f, -0.0978097543f, 0.0315872878f,
+    -0.128243431f, 0.0126302447f, -0.132426128f, 0.00844755396f,
+    -0.309192389f, -0.0562012531f, -0.244411543f, 0.00857959036f,
+    -0.071850054f, 0.152685151f, -0.00974701345f, 0.214788198f,
+    -0.168749124f, -0.108690299f, -0.11617393f, -0.056115102f,
+    -0.104517773f, -0.0715478361f, 0.0311079957f, 0.0640779361f,
+    -0.201416835f, -0.332923293f, -0.0753189176f, -0.206825361f,
+    0.458270788f, 0.0376108736f, 0.0335245281f, -0.387135386f,
+    0.233067423f, -0.306602716f, 0.00395581126f, -0.535714328f,
+    0.180730313f, -0.124064386f, 0.0548222065f, -0.249972492f,
+    -0.0444730446f, -0.468277991f, 0.0252535194f, -0.398551434f,
+    -0.0259832311f, 0.0934782326f, 0.0193526447f, 0.138814107f,
+    -0.116427094f, -0.0616661496f, -0.155310199f, -0.100549251f,
+    -0.178828165f, -0.115154833f, -0.0723538399f, -0.00868050009f,
+    -0.269272029f, -0.270299196f, -0.247016668f, -0.24804385f,
+    -0.106225386f, 0.429125071f, 0.147138178f, 0.68248862f,
+    -0.395130217f, 0.145287946f, 0.0212230682f, 0.561641216f,
+    -0.242810249f, -0.212472603f, -0.0817796141f, -0.05144196f,
+    -0.531715095f, -0.496309727f, -0.207694739f, -0.172289357f,
+    -0.187150598f, -0.401350141f, -0.21852529f, -0.432724833f,
+    -0.0486583114f, -0.487785727f, -0.193705648f, -0.632833064f,
+    -0.251762629f, -0.478623033f, -0.0158578232f, -0.242718235f,
+    -0.113270342f, -0.565058649f, 0.00896181166f, -0.44282648f,
+    0.14491193f, 0.0805043355f, 0.0578382574f, -0.00656933617f,
+    0.26466316f, 0.0593464971f, 0.053363204f, -0.151953459f,
+    0.00222013891f, 0.0226937607f, 0.162805855f, 0.183279485f,
+    0.121971384f, 0.00153592974f, 0.158330813f, 0.0378953516f,
+    0.0135794664f, 0.036546167f, 0.00905471854f, 0.0320214182f,
+    -0.114137709f, -0.0950649977f, -0.112076417f, -0.0930037051f,
+    -0.156729311f, -0.115167312f, 0.0314313546f, 0.072993353f,
+    -0.284446478f, -0.246778458f, -0.089699775f, -0.0520317666f,
+    -0.290515065f, -0.102966174f, -0.0859256834f, 0.101623215f,
+    0.0862419382f, 0.0690195039f, -0.230213195f, -0.247435614f,
+    -0.114931315f, -0.183242276f, -0.0299891084f, -0.0983000696f,
+    0.261825681f, -0.0112566054f, -0.17427662f, -0.447358906f,
+    -0.070297353f, -0.00570341572f, -0.00125533715f, 0.0633386001f,
+    -0.0378482118f, -0.00462888554f, -0.0235334933f, 0.00968583301f,
+    -0.0486634821f, -0.0384777971f, -0.0222630687f, -0.0120773818f,
+    -0.0162143409f, -0.0374032669f, -0.0445412211f, -0.0657301471f,
+    -0.0729285553f, 0.115449429f, -0.162444025f, 0.0259339511f,
+    -0.325783849f, -0.205335632f, -0.205830917f, -0.0853826925f,
+    -0.0606847852f, 0.0889349282f, 0.132802591f, 0.282422304f,
+    -0.313540071f, -0.231850117f, 0.0894157067f, 0.171105668f,
+    -0.0073095453f, 0.20118472f, 0.0405598804f, 0.249054134f,
+    -0.118063264f, -0.111102037f, -0.0569557473f, -0.0499945171f,
+    -0.194198608f, -0.0998385772f, 0.0798626021f, 0.174222633f,
+    -0.304952323f, -0.412125319f, -0.017653022f, -0.124826021f,
+    0.0271365121f, -0.00454063714f, -0.184426725f, -0.216103882f,
+    -0.075299561f, -0.128253132f, -0.137037843f, -0.1899914f,
+    -0.245466694f, -0.0788524672f, -0.157833159f, 0.00878106616f,
+    -0.347902775f, -0.202564955f, -0.11044427f, 0.0348935537f,
+    0.0675173029f, 0.0918493867f, -0.0801233947f, -0.0557913184f,
+    -0.090336591f, -0.111670047f, -0.0375588201f, -0.0588922799f,
+    -0.0605684929f, 0.0791121647f, 0.036729753f, 0.176410407f,
+    -0.218422383f, -0.124407262f, 0.0792943314f, 0.173309445f,
+    -0.0268459059f, 0.0637947246f, -0.103478439f, -0.0128378058f,
+    -0.127385333f, -0.0278719962f, -0.0808896273f, 0.0186237097f,
+    0.035463769f, 0.0943678916f, 0.0748514384f, 0.133755565f,
+    -0.0650756583f, 0.00270117074f, 0.0974402428f, 0.165217072f,
+    -0.0180216543f, 0.0497400723f, -0.0153472777f, 0.0524144508f,
+    0.0726185739f, -0.0208868794f, 0.00994574651f, -0.0835597068f,
+    -0.0334442109f, 0.0196818635f, -0.016365774f, 0.0367603004f,
+    0.0571960174f, -0.0509450845f, 0.00892724842f, -0.0992138535f,
+    0.175195009f, 0.0202241465f, 0.0272075757f, -0.127763286f,
+    0.140484035f, -0.184153035f, 0.0363100022f, -0.288327068f,
+    -0.0256762188f, -0.00764093548f, 0.129488796f, 0.147524074f,
+    -0.0603872053f, -0.212018102f, 0.13859123f, -0.0130396914f,
+    0.0853723884f, 0.0267616808f, 0.133656502f, 0.0750457942f,
+    0.00995666534f, -0.0101651866f, 0.035029158f, 0.0149073042f,
+    0.002943106f, 0.0443304069f, 0.0659473017f, 0.107334599f,
+    -0.072472617f, 0.00740353949f, -0.0326800458f, 0.0471961126f,
+    0.00705381902f, 0.0243523624f, 0.0585236996f, 0.0758222416f,
+    0.349957764f, 0.312481582f, 0.0609325431f, 0.0234563574f,
+    -0.0657297224f, 0.141427308f, 0.0718044192f, 0.27896145f,
+    0.277174234f, 0.429556519f, 0.0742132738f, 0.226595566f,
+    -0.0396116786f, 0.166250214f, -0.0214380026f, 0.184423894f,
+    0.0871283785f, 0.0258832388f, 0.0180164166f, -0.0432287231f,
+    -0.0479117855f, 0.050166443f, -0.0969081968f, 0.00117003173f,
+    0.0788282752f, -0.0902005285f, -0.0574537776f, -0.226482585f,
+    0.298764914f, 0.29736793f, 0.378561616f, 0.377164632f,
+    0.0365363508f, -0.0283851326f, 0.13694118f, 0.0720196962f,
+    -0.123877369f, -0.0523539186f, 0.217547894f, 0.289071351f,
+    -0.386105925f, -0.378106952f, -0.0240725428f, -0.0160735846f,
+    -0.383788258f, 0.0910957605f, -0.0414416939f, 0.433442324f,
+    0.246074736f, 0.342978835f, 0.187194437f, 0.284098536f,
+    0.0748609602f, 0.241674528f, -0.0700609833f, 0.096752584f,
+    0.704723954f, 0.493557632f, 0.158575147f, -0.0525912121f,
+    -0.295779794f, 0.0266176015f, -0.120450802f, 0.201946601f,
+    -0.15653491f, -0.129880548f, -0.00817109644f, 0.0184832662f,
+    0.0102443472f, -0.0190450065f, -0.109343454f, -0.138632804f,
+    0.149489224f, -0.175543159f, 0.00293624401f, -0.322096139f,
+    -0.0574612245f, -0.0276677161f, 0.0800143108f, 0.109807819f,
+    0.155628264f, 0.00338678434f, 0.0833175704f, -0.0689239055f,
+    0.0681796968f, 0.215179801f, 0.127441704f, 0.274441808f,
+    0.281269193f, 0.246234313f, 0.130744964f, 0.0957100764f,
+    -0.0315169804f, 0.118198216f, -0.129343405f, 0.0203717854f,
+    -0.0654748529f, 0.00213415176f, -0.0551230833f, 0.0124859214f,
+    0.253176868f, -0.0235649049f, -0.0381103754f, -0.314852148f,
+    0.219218999f, -0.139628977f, 0.0361099541f, -0.322738022f,
+    -0.0572641492f, -0.0290670898f, -0.064384371f, -0.0361873135f,
+    -0.0563718453f, -0.0571711361f, -0.0334115699f, -0.034210857f,
+    -0.0797067806f, -0.0148575902f, -0.0730237737f, -0.00817458425f,
+    -0.0788144767f, -0.0429616384f, -0.0420509689f, -0.00619812822f,
+    0.0783993006f, -0.0182775985f, 0.137382731f, 0.0407058336f,
+    0.0155093223f, -0.033914797f, 0.0707496628f, 0.0213255435f,
+    0.0510054231f, 0.160746589f, 0.0612515993f, 0.170992762f,
+    -0.0118845543f, 0.145109385f, -0.00538146496f, 0.151612476f,
+    0.0880478993f, 0.0396419987f, 0.101341531f, 0.0529356226f,
+    0.0246894136f, 0.0125330137f, -0.00221909862f, -0.0143754985f,
+    0.0535338074f, 0.0964164138f, 0.0763213933f, 0.119204f,
+    -0.00982467923f, 0.0693074241f, -0.0272392277f, 0.0518928729f,
+    -0.0887519643f, 0.154579267f, -0.144642636f, 0.098688595f,
+    -0.0265229307f, 0.0167313535f, -0.0962989926f, -0.0530447029f,
+    0.00988279097f, 0.181377113f, -0.172142684f, -0.000648334622f,
+    0.0721118227f, 0.0435292274f, -0.123799026f, -0.152381629f,
+    -0.0652309433f, -0.0652790666f, 0.0868911073f, 0.0868429765f,
+    -0.0500630811f, -0.0931932777f, 0.0152041242f, -0.0279260725f,
+    -0.0125407279f, 0.172281295f, 0.0247294903f, 0.209551513f,
+    0.00262713712f, 0.144367099f, -0.0469574854f, 0.0947824717f,
+    -0.0633785874f, -0.144517839f, 0.0592242628f, -0.0219149906f,
+    -0.016151119f, -0.114595205f, 0.0933197141f, -0.00512436777f,
+    0.00876292959f, 0.0350020118f, 0.0213080384f, 0.0475471206f,
+    0.0559903979f, 0.0649246573f, 0.0554034933f, 0.0643377453f,
+    -0.38337481f, -0.270404309f, -0.08579956f, 0.0271709338f,
+    -0.130562484f, -0.148410678f, -0.0713842735f, -0.0892324746f,
+    -0.109134711f, -0.0744880438f, -0.0268313382f, 0.00781533495f,
+    0.143677607f, 0.0475055948f, -0.0124160573f, -0.10858807f,
+    -0.0462317914f, -0.0231621601f, -0.0198607743f, 0.00320885633f,
+    0.208400309f, 0.236410812f, 0.0188727826f, 0.046883285f,
+    0.0171919093f, 0.193729192f, 0.0527921207f, 0.229329392f,
+    0.271824002f, 0.453302145f, 0.0915256739f, 0.273003817f,
+    0.0767668709f, -0.10282734f, 0.0443894044f, -0.135204807f,
+    -0.13329801f, -0.148769706f, 0.112785578f, 0.0973138809f,
+    -0.197835565f, -0.0283078253f, -0.21027413f, -0.0407464057f,
+    -0.407900453f, -0.0742502064f, -0.141877964f, 0.191772282f,
+    0.384680837f, -0.220410034f, 0.196320936f, -0.408769935f,
+    -0.183378011f, -0.647363782f, -0.0835420936f, -0.54752785f,
+    0.143861592f, 0.0419594608f, 0.204917312f, 0.103015192f,
+    -0.424197257f, -0.384994239f, -0.0749457255f, -0.035742715f,
+    0.116432346f, 0.0404898822f, 0.140205041f, 0.0642625764f,
+    -0.0540290326f, -0.0750332326f, 0.0561961345f, 0.0351919308f,
+    -0.0830604807f, -0.0666410625f, 0.0161680654f, 0.0325874835f,
+    -0.25352186f, -0.182164177f, -0.0678408369f, 0.00351684028f,
+    0.37147209f, 0.0386254042f, 0.190690428f, -0.142156258f,
+    0.168548658f, 0.0189364217f, 0.232498467f, 0.0828862265f,
+    0.0854560584f, 0.0688386634f, 0.0426039249f, 0.0259865299f,
+    -0.117467374f, 0.0491496772f, 0.0844119638f, 0.251029015f,
+    -0.124889031f, -0.22158888f, 0.156198621f, 0.0594987832f,
+    -0.20742853f, -0.348786652f, 0.0384337753f, -0.102924332f,
+    -0.155461669f, -0.19128567f, 0.0851489305f, 0.0493249334f,
+    -0.238001168f, -0.318483442f, -0.0326159187f, -0.113098182f,
+    -0.0935222283f, 0.00498501211f, 0.035962224f, 0.134469464f,
+    -0.0261692815f, 0.0250016861f, -0.0339608192f, 0.0172101483f,
+    -0.0308250152f, -0.00990414992f, -0.0362833254f, -0.0153624602f,
+    0.0365279317f, 0.0101125166f, -0.106206372f, -0.13262178f,
+    0.253475487f, 0.144942358f, 0.204085931f, 0.0955527946f,
+    -0.196538568f, -0.0846206546f, 0.098523289f, 0.210441202f,
+    0.0333659649f, 0.0495080426f, 0.132266521f, 0.148408592f,
+    -0.41664809f, -0.180054978f, 0.0267038718f, 0.263296992f,
+    0.0703645349f, -0.370436072f, -0.141764581f, -0.582565188f,
+    -0.0961223766f, -0.886011541f, -0.195030391f, -0.984919548f,
+    -0.164432406f, -0.293048322f, -0.215771034f, -0.344386965f,
+    -0.330919325f, -0.808623791f, -0.269036859f, -0.746741354f,
+    0.0550290048f, -0.0148920584f, 0.0414398089f, -0.0284812562f,
+    0.0612062328f, 0.0206660535f, 0.096810244f, 0.0562700629f,
+    -0.0170135833f, -0.0428998321f, 0.00422518887f, -0.0216610618f,
+    -0.0108363535f, -0.00734172389f, 0.0595956258f, 0.0630902573f,
+    -0.157760978f, 0.0392235667f, 0.0991781205f, 0.296162665f,
+    -0.388202369f, -0.0184781849f, 0.0189703405f, 0.388694525f,
+    -0.0735029727f, 0.00754808635f, -0.0387627706f, 0.0422882885f,
+    -0.303944349f, -0.0501536578f, -0.118970558f, 0.134820133f,
+    0.188312754f, 0.00646504387f, 0.258400559f, 0.0765528455f,
+    -0.216074646f, -0.101974577f, 0.123891383f, 0.237991452f,
+    -0.172348395f, -0.0851698145f, -0.0367288068f, 0.0504497699f,
+    -0.576735795f, -0.193609446f, -0.171237975f, 0.211888388f,
+    0.0121755451f, 0.230598792f, 0.178604454f, 0.397027701f,
+    0.00971564837f, 0.332441509f, 0.0481836051f, 0.370909482f,
+    0.00173508003f, 0.0800546706f, -0.00129298866f, 0.0770266056f,
+    -0.000724816637f, 0.181897402f, -0.131713837f, 0.0509083904f,
+    0.0148742758f, 0.093852371f, 0.260188282f, 0.339166373f,
+    -0.141824946f, 0.106173202f, 0.141662657f, 0.389660805f,
+    0.0989937335f, 0.0327040106f, 0.139427707f, 0.0731379837f,
+    -0.0577054992f, 0.0450248346f, 0.0209020711f, 0.123632409f,
+    -0.0593928657f, 2.45124102e-05f, 0.0971095115f, 0.156526893f,
+    -0.195764214f, 0.0106809884f, 0.0955531448f, 0.301998347f,
+    -0.0293682143f, -0.019279357f, 0.023530582f, 0.0336194411f,
+    -0.165739566f, -0.00862288475f, 0.0219742209f, 0.179090902f,
+    -0.182642892f, -0.289937466f, -0.287786901f, -0.39508149f,
+    -0.105816171f, -0.189175993f, -0.221415848f, -0.304775655f,
+    -0.0355776921f, -0.0314502753f, 0.0183204431f, 0.0224478617f,
+    0.0412490331f, 0.0693112165f, 0.0846915245f, 0.112753704f,
+    0.312832415f, -0.0327115767f, 0.256494731f, -0.0890492722f,
+    -0.179161996f, -0.33328715f, 0.170565948f, 0.0164408013f,
+    0.0670962036f, 0.0236194171f, 0.0574494936f, 0.0139727071f,
+    -0.424898207f, -0.276956111f, -0.0284792967f, 0.119462781f,
+    0.242742896f, 0.0840663239f, 0.0234404132f, -0.135236159f,
+    0.245473921f, 0.113628268f, 0.0395825617f, -0.0922630951f,
+    0.2286883f, 0.143773511f, 0.0620172508f, -0.0228975322f,
+    0.231419325f, 0.173335448f, 0.0781593993f, 0.0200755335f,
+    -0.063870199f, 0.188912645f, -0.0621766001f, 0.190606236f,
+    -0.177341983f, 0.00636482984f, 0.00734677166f, 0.191053584f,
+    -0.36711973f, -0.264107645f, -0.0948549509f, 0.00815711915f,
+    -0.480591506f, -0.446655482f, -0.0253315717f, 0.00860446785f,
+    -0.0383190587f, 0.00693982793f, -0.0470025539f, -0.00174366799f,
+    -0.00750445575f, 0.0937310904f, -0.0397790819f, 0.0614564717f,
+    0.107712805f, 0.175784826f, -0.00973853283f, 0.05833349f,
+    0.138527408f, 0.262576103f, -0.00251505524f, 0.121533632f,
+    0.204098225f, 0.266307056f, 0.00215760246f, 0.0643664375f,
+    0.0974207968f, -0.00418586284f, -0.00795400888f, -0.109560668f,
+    0.233293042f, 0.283179194f, 0.0119634606f, 0.0618496165f,
+    0.126615614f, 0.0126862749f, 0.00185184553f, -0.112077489f,
+    0.074134253f, 0.196097657f, 0.00181437656f, 0.123777777f,
+    0.0973886624f, 0.534622073f, 0.13231428f, 0.569547713f,
+    -0.00585970003f, 0.237114489f, -0.0425332785f, 0.200440913f,
+    0.0173947122f, 0.57563889f, 0.0879666358f, 0.646210849f,
+    -0.0587219521f, -0.125151008f, -0.0911906809f, -0.157619745f,
+    -0.0581355467f, -0.0259513911f, -0.0617161691f, -0.0295320153f,
+    0.0568851382f, 0.0885208249f, 0.0416644625f, 0.073300153f,
+    0.0574715398f, 0.187720448f, 0.0711389706f, 0.201387882f,
+    0.0432010293f, 0.0654896498f, -0.0430656374f, -0.0207770225f,
+    0.0320408903f, 0.0834750682f, 0.0286644399f, 0.0800986215f,
+    -0.0868818462f, -0.0542430915f, -0.129112437f, -0.0964736864f,
+    -0.0980419889f, -0.0362576731f, -0.0573823713f, 0.00440194644f,
+    -0.217505693f, -0.40628624f, -0.158326268f, -0.347106844f,
+    -0.0769528002f, 0.0155357942f, -0.0769404992f, 0.0155480951f,
+    0.113116518f, 0.163769692f, -0.053431347f, -0.00277815759f,
+    0.253669411f, 0.585591733f, 0.0279544294f, 0.359876782f,
+    0.0334609076f, 0.0457919575f, -0.0216601696f, -0.00932912063f,
+    0.0422147587f, 0.0529594384f, -0.051473733f, -0.0407290533f,
+    -0.0307279471f, -0.00767297018f, -0.0428887941f, -0.0198338181f,
+    -0.0219740979f, -0.000505488366f, -0.0727023631f, -0.0512337498f,
+    0.148710966f, 0.0183662064f, 0.148131788f, 0.0177870318f,
+    0.043134056f, -0.0970141739f, 0.0731569678f, -0.0669912696f,
+    0.0769649744f, -0.0910736322f, 0.0676684678f, -0.100370131f,
+    -0.0286119319f, -0.206454009f, -0.00730635971f, -0.185148433f,
+    0.13231425f, 0.0372949466f, -0.0367468484f, -0.131766155f,
+    0.14205046f, 0.113825798f, -0.0208050366f, -0.0490297042f,
+    0.145282894f, 0.0630303621f, 0.0138745718f, -0.0683779642f,
+    0.155019104f, 0.139561221f, 0.0298163835f, 0.0143584935f,
+    -0.00920328498f, -0.0398246571f, -0.0494624972f, -0.0800838694f,
+    0.000178971328f, -0.00617974997f, 0.0878245384f, 0.081465818f,
+    -0.0305928867f, 0.00836150441f, -0.0495443642f, -0.0105899721f,
+    -0.0212106295f, 0.0420064107f, 0.0877426714f, 0.150959715f,
+    -0.0678510368f, -0.23638019f, -0.0107774287f, -0.179306582f,
+    -0.0977350548f, -0.211134255f, 0.0129115283f, -0.100487679f,
+    0.0190767404f, -0.201796964f, 0.0517531484f, -0.16912055f,
+    -0.0108072786f, -0.176551029f, 0.0754420906f, -0.0903016552f,
+    -0.0812892765f, -0.155870572f, -0.0784425735f, -0.153023869f,
+    -0.020220533f, -0.115388379f, -0.0415737927f, -0.136741638f,
+    0.0329899341f, -0.0838891417f, 0.0589178801f, -0.0579611994f,
+    0.0940586776f, -0.0434069484f, 0.095786646f, -0.04167898f,
+    -0.265838891f, -0.32048136f, -0.0399950445f, -0.0946374834f,
+    -0.323900342f, -0.318054765f, -0.0455623716f, -0.0397168063f,
+    -0.428881437f, -0.333934933f, -0.0836357027f, 0.0113107897f,
+    -0.486942887f, -0.331508368f, -0.0892030299f, 0.0662314668f,
+    -0.0682419166f, 0.0676814616f, 0.0330095179f, 0.1689329f,
+    -0.114071071f, 0.0702688023f, 0.00504680723f, 0.189386681f,
+    -0.203667521f, -0.143440828f, -0.08755216f, -0.0273254625f,
+    -0.249496669f, -0.14085348f, -0.11551486f, -0.00687167747f,
+    -0.112383842f, -0.181523621f, 0.16689077f, 0.0977509767f,
+    0.0555084944f, 0.0402934588f, -0.0188671611f, -0.0340821967f,
+    0.259237766f, -0.0772022307f, 0.217309207f, -0.119130783f,
+    0.427130103f, 0.14461486f, 0.0315513015f, -0.250963956f,
+    -0.204540029f, -0.185744077f, 0.0847912654f, 0.10358721f,
+    -0.321765631f, -0.421693593f, -0.128370106f, -0.228298083f,
+    -0.02410613f, -0.0142703447f, -0.00431900285f, 0.0055167824f,
+    -0.141331747f, -0.250219882f, -0.217480391f, -0.326368511f,
+    0.144959688f, -0.0645726472f, 0.031553939f, -0.177978396f,
+    0.162299186f, 0.0884024501f, 0.0039351657f, -0.0699615702f,
+    0.20565176f, 0.0804413632f, -0.01021602f, -0.135426417f,
+    0.222991273f, 0.233416483f, -0.0378347933f, -0.0274095964f,
+    -0.146276429f, 0.282205015f, 0.0650060028f, 0.493487448f,
+    -0.108429685f, 0.427036732f, -0.00767827034f, 0.527788162f,
+    0.271622866f, 0.187720194f, 0.0899223536f, 0.00601968728f,
+    0.30946961f, 0.332551926f, 0.0172381159f, 0.0403204374f,
+    0.284658879f, 0.160800189f, -0.0255995914f, -0.149458289f,
+    0.0471329615f, -0.115381315f, -0.13936694f, -0.301881224f,
+    -0.00394193083f, -0.0835267752f, -0.279153556f, -0.358738393f,
+    -0.241467848f, -0.35970825f, -0.392920911f, -0.511161327f,
+    0.176780134f, 0.0599530488f, 0.0298841745f, -0.0869429111f,
+    0.137856126f, -0.0789900124f, 0.06812042f, -0.148725718f,
+    -0.093631357f, -0.00896403193f, -0.121184558f, -0.0365172327f,
+    -0.13255538f, -0.147907093f, -0.0829483271f, -0.0983000472f,
+    -0.192534164f, 0.0209453404f, -0.128423393f, 0.0850561112f,
+    -0.141921803f, 0.012593789f, -0.101096421f, 0.053419169f,
+    -0.160140291f, 0.0119020641f, -0.0989860445f, 0.0730563104f,
+    -0.109527931f, 0.00355051085f, -0.0716590658f, 0.041419372f,
+    0.218036294f, -0.195678025f, -0.0395450145f, -0.453259319f,
+    0.290462375f, -0.144226253f, -0.0135278702f, -0.448216498f,
+    0.311682463f, 0.0633572638f, -0.0462728441f, -0.294598043f,
+    0.384108573f, 0.114809051f, -0.0202556998f, -0.289555222f,
+    0.0636476502f, 0.0730787888f, 0.0183495432f, 0.0277806818f,
+    0.00800375082f, 0.0261633955f, -0.0344980694f, -0.0163384248f,
+    0.0188697893f, 0.0230247825f, -0.00668828469f, -0.0025332924f,
+    -0.03677411f, -0.0238906108f, -0.0595358983f, -0.046652399f,
+    -0.122819498f, -0.0378599539f, -0.0217897557f, 0.0631697923f,
+    -0.00339588523f, 0.0434676223f, -0.0315595157f, 0.0153039889f,
+    -0.0409426801f, -0.0405386388f, 0.0269815028f, 0.027385544f,
+    0.0784809366f, 0.0407889262f, 0.0172117501f, -0.0204802621f,
+    -0.0900160745f, -0.137473673f, 0.0606347024f, 0.0131771034f,
+    -0.0403333306f, 0.00559220277f, -0.0737509131f, -0.0278253816f,
+    0.20335798f, -0.0193932503f, 0.133714527f, -0.089036718f,
+    0.253040731f, 0.123672642f, -0.000671103597f, -0.1300392f,
+    -0.106152847f, 0.128119349f, -0.159878016f, 0.0743941814f,
+    0.0649868473f, 0.0822437629f, -0.0697591156f, -0.0525022f,
+    -0.1308119f, 0.0517115667f, -0.10053286f, 0.0819905996f,
+    0.0403277911f, 0.0058359839f, -0.0104139782f, -0.0449057855f,
+    -0.25678131f, -0.0401584283f, -0.0979096964f, 0.118713185f,
+    -0.0681591406f, 0.0327113383f, -0.129937634f, -0.0290671587f,
+    -0.0575696006f, -0.0262855366f, -0.00558154285f, 0.0257025212f,
+    0.131052569f, 0.0465842336f, -0.0376094878f, -0.122077823f,
+    -0.104421996f, -0.113763414f, -0.0209824294f, -0.03032385f,
+    0.00867304951f, 0.000357208773f, -0.0348903388f, -0.0432061814f,
+    0.0496898778f, -0.0440624431f, 0.0292273983f, -0.0645249188f,
+    0.162784919f, 0.0700581819f, 0.0153194815f, -0.0774072558f,
+    -0.176359788f, 0.00100567006f, -0.153701216f, 0.0236642472f,
+    -0.291302115f, -0.088034749f, -0.0858937502f, 0.117373608f,
+    -0.00351963565f, 0.13342233f, -0.0476218611f, 0.0893201083f,
+    -0.118461974f, 0.0443819053f, 0.0201855898f, 0.183029473f,
+    -0.255713433f, -0.173511505f, 0.00148838758f, 0.0836903155f,
+    -0.254020244f, -0.258610904f, -0.141590148f, -0.146180809f,
+    -0.0859941244f, -0.0358868316f, -0.0597064383f, -0.00959914178f,
+    -0.0843009576f, -0.120986238f, -0.202784985f, -0.239470273f,
+    0.0632463992f, 0.085706532f, -0.0528953411f, -0.030435212f,
+    0.113790996f, -0.0963374823f, 0.00550810248f, -0.204620376f,
+    -0.208548903f, -0.128618553f, -0.168551072f, -0.0886207148f,
+    -0.158004299f, -0.310662568f, -0.110147625f, -0.262805879f,
+    -0.514396906f, -0.196265191f, -0.195922643f, 0.122209065f,
+    -0.214535773f, -0.16761896f, -0.180521131f, -0.133604333f,
+    -0.203463435f, -0.0568605289f, 0.0693633333f, 0.21596624f,
+    0.0963977128f, -0.0282142982f, 0.0847648457f, -0.0398471653f,
+    0.0536458306f, 0.11863365f, -0.0298927929f, 0.0350950249f,
+    0.213187218f, 0.0674195364f, -0.00932788104f, -0.155095562f,
+    0.0179872885f, -0.0159528218f, -0.0551855154f, -0.0891256258f,
+    0.177528679f, -0.0671669319f, -0.0346206054f, -0.279316217f,
+    0.306268096f, 0.253551066f, -0.0108440742f, -0.0635610968f,
+    0.300341666f, 0.0400884151f, 0.0510830879f, -0.209170163f,
+    -0.086747162f, 0.116737396f, 0.0583296269f, 0.261814177f,
+    -0.0926735848f, -0.0967252627f, 0.120256767f, 0.116205081f,
+    -0.048682142f, -0.0565471686f, -0.0129264435f, -0.0207914691f,
+    0.343017459f, 0.179069519f, -0.0259365514f, -0.189884484f,
+    -0.0140315294f, 0.0339110643f, -0.196783498f, -0.148840904f,
+    0.377668083f, 0.269527763f, -0.209793597f, -0.317933917f,
+    -0.158501923f, -0.0774561539f, -0.11301025f, -0.0319644846f,
+    0.0271942317f, -0.0159403998f, 0.0110297073f, -0.0321049243f,
+    -0.00488582253f, -0.0064175427f, -0.145834908f, -0.147366628f,
+    0.180810332f, 0.0550982058f, -0.0217949487f, -0.147507071f,
+    0.11870344f, 0.0455588065f, 0.0420498066f, -0.0310948268f,
+    0.133762583f, -0.0831347927f, -0.159768581f, -0.37666595f,
+    -0.0284374878f, -0.0420304127f, -0.10196498f, -0.115557909f,
+    -0.013378338f, -0.170724005f, -0.303783357f, -0.46112904f,
+    -0.290657073f, -0.193600446f, -0.240227222f, -0.14317058f,
+    -0.0487389043f, -0.12013758f, -0.152181655f, -0.223580331f,
+    -0.102568872f, -0.0527535863f, -0.1037044f, -0.0538891107f,
+    0.139349297f, 0.0207092762f, -0.0156588256f, -0.134298846f,
+    -0.0193839371f, -0.0644644201f, 0.0151747372f, -0.0299057476f,
+    -0.0131453434f, -0.00488470588f, -0.00214407407f, 0.00611656345f,
+    0.0123195704f, 0.000728178769f, 0.0471163467f, 0.0355249569f,
+    0.0185581651f, 0.0603078976f, 0.0297975391f, 0.0715472698f,
+    0.13938497f, -0.0432033092f, 0.0168616474f, -0.165726632f,
+    0.138780892f, -0.20387876f, -0.134220392f, -0.476880044f,
+    -0.106180757f, -0.170568988f, -0.0986546725f, -0.163042903f,
+    -0.106784828f, -0.331244439f, -0.249736696f, -0.474196315f,
+    0.0518814512f, 0.0434986502f, -0.114339396f, -0.122722194f,
+    0.0693423897f, -0.178167582f, -0.0772853866f, -0.324795365f,
+    -0.0234539025f, -0.0798749998f, -0.100054748f, -0.156475842f,
+    -0.00599296717f, -0.301541239f, -0.0630007461f, -0.358549029f,
+    -0.0557665862f, 0.008753228f, -0.0923303142f, -0.0278105047f,
+    0.0227844715f, -0.10337881f, -0.0386716202f, -0.164834902f,
+    0.00772308931f, -0.0888857767f, -0.044451993f, -0.141060859f,
+    0.086274147f, -0.201017827f, 0.00920669734f, -0.278085262f,
+    0.128948629f, 0.0886906162f, 0.0631591752f, 0.0229011662f,
+    0.116416924f, -0.0985638201f, -0.00655479729f, -0.221535534f,
+    -0.0236586425f, -0.156072408f, -0.108399816f, -0.240813583f,
+    -0.0361903496f, -0.343326867f, -0.178113788f, -0.485250294f,
+    0.142311066f, -0.0492728651f, 0.0193371773f, -0.172246754f,
+    0.0425070524f, -0.158655792f, -0.135160774f, -0.336323619f,
+    -0.0805826783f, -0.175333276f, -0.0944752544f, -0.189225852f,
+    -0.180386692f, -0.284716189f, -0.248973191f, -0.353302687f,
+    -0.344575912f, -0.176973507f, -0.228832737f, -0.0612303279f,
+    -0.0880041271f, 0.0187173933f, -0.096755892f, 0.00996562839f,
+    -0.00425176322f, 0.0162651408f, 0.059993118f, 0.0805100203f,
+    0.252320021f, 0.211956039f, 0.192069963f, 0.15170598f,
+    -0.109539568f, -0.0790610388f, -0.100268736f, -0.0697902068f,
+    0.0549005568f, -0.275975347f, -0.202383921f, -0.533259809f,
+    -0.158897161f, -0.0319283232f, -0.118152447f, 0.00881639123f,
+    0.00554296095f, -0.228842616f, -0.220267653f, -0.454653233f,
+    -0.245812237f, -0.0655014217f, -0.135293037f, 0.0450177714f,
+    -0.165237263f, -0.0238855984f, -0.097381115f, 0.0439705513f,
+    -0.115106657f, -0.138157278f, -0.063821286f, -0.0868719071f,
+    -0.0345316753f, -0.0965414569f, -0.0259093419f, -0.0879191235f,
+    -0.189207479f, 0.0390926674f, -0.0559448972f, 0.17235525f,
+    -0.171960384f, -0.0339107811f, 0.0576192662f, 0.195668876f,
+    -0.18038702f, 0.0763447136f, 0.0167662054f, 0.273497939f,
+    -0.163139924f, 0.00334128737f, 0.130330384f, 0.296811581f,
+    -0.262065083f, -0.275467724f, 0.0303055681f, 0.016902931f,
+    -0.218133032f, -0.103045136f, 0.0403387249f, 0.155426621f,
+    -0.0165818371f, -0.101493537f, 0.0746240616f, -0.0102876499f,
+    0.0273502078f, 0.070929043f, 0.0846572071f, 0.12823604f,
+    -0.410117835f, -0.131101131f, -0.158463717f, 0.120553002f,
+    -0.565943778f, -0.553199291f, -0.141706213f, -0.128961712f,
+    -0.000849999487f, 0.093672365f, -0.0356890894f, 0.0588332638f,
+    -0.15667592f, -0.328425795f, -0.0189315826f, -0.190681443f,
+    0.326577067f, -0.156039193f, 0.261336148f, -0.221280098f,
+    -0.0303773582f, -0.320009112f, 0.145293325f, -0.144338444f,
+    0.10326758f, 0.0310184807f, 0.255094737f, 0.182845637f,
+    -0.253686845f, -0.132951453f, 0.139051899f, 0.259787291f,
+    0.113543898f, -0.472644448f, 0.0895169675f, -0.496671379f,
+    -0.154000551f, -0.571798325f, 0.0163875818f, -0.401410192f,
+    0.0543094575f, -0.0792307407f, 0.143417373f, 0.00987718254f,
+    -0.213234991f, -0.178384632f, 0.0702880248f, 0.105138376f,
+    -0.00893641915f, 0.00107256882f, -0.0402188227f, -0.0302098319f,
+    0.0618965477f, 0.176991969f, 0.0645092651f, 0.179604694f,
+    0.0801128596f, 0.056008473f, 0.0687300563f, 0.0446256697f,
+    0.150945827f, 0.231927872f, 0.173458144f, 0.254440188f,
+    -0.355742574f, -0.299625129f, -0.0134281255f, 0.042689316f,
+    -0.233251393f, -0.470030487f, 0.0426384881f, -0.194140598f,
+    -0.014995385f, 0.0635831058f, 0.0224689823f, 0.101047471f,
+    0.107495792f, -0.106822237f, 0.0785355717f, -0.13578245f,
+    -0.00763085485f, 0.0539375395f, -0.00672400557f, 0.0548443906f,
+    -0.0851479173f, -0.00989815872f, -0.0902413577f, -0.0149916019f,
+    -0.00423263386f, -0.00737153925f, -0.00948490202f, -0.0126238074f,
+    -0.0817497f, -0.0712072402f, -0.0930022597f, -0.0824597999f,
+    0.0794240609f, 0.188233733f, 0.148438036f, 0.257247716f,
+    0.130220369f, 0.189938471f, 0.203653693f, 0.263371795f,
+    -0.0998305827f, -0.020856794f, -0.0240835212f, 0.0548902676f,
+    -0.0490342639f, -0.0191520434f, 0.03113213f, 0.0610143505f,
+    -0.327811897f, -0.105490871f, -0.142545938f, 0.0797750801f,
+    -0.104067311f, 0.0625438988f, 0.0360581726f, 0.202669382f,
+    -0.141081706f, -0.104627453f, -0.0615550317f, -0.0251007825f,
+    0.0826628879f, 0.0634073317f, 0.117049091f, 0.0977935344f,
+    0.12506038f, 0.0453161672f, 0.146901935f, 0.0671577305f,
+    0.17018941f, 0.155497909f, 0.0745581612f, 0.0598666519f,
+    0.184780836f, 0.240353003f, 0.158184484f, 0.213756651f,
+    0.229909852f, 0.350534737f, 0.0858406946f, 0.206465572f,
+    0.0284923874f, 0.166258395f, 0.0475902483f, 0.185356259f,
+    0.144621879f, 0.255288959f, 0.167120188f, 0.277787268f,
+    -0.085394226f, 0.0464411154f, -0.0521514677f, 0.0796838775f,
+    0.0307352692f, 0.135471672f, 0.0673784763f, 0.172114879f,
+    -0.160098881f, -0.0175678357f, 0.0759011805f, 0.218432233f,
+    -0.0131111201f, 0.0758487731f, 0.0920762792f, 0.181036174f,
+    -0.121327311f, -0.0657078177f, -0.00480533764f, 0.0508141592f,
+    0.0256604515f, 0.0277087912f, 0.0113697555f, 0.0134180952f,
+    -0.308859527f, -0.531377435f, -0.377606302f, -0.60012418f,
+    -0.371658325f, -0.574246764f, -0.309051037f, -0.511639535f,
+    -0.198175013f, -0.296333134f, -0.0833879486f, -0.181546062f,
+    -0.260973841f, -0.339202553f, -0.0148326978f, -0.0930614024f,
+    -0.0204869527f, 0.0287971236f, -0.0412085094f, 0.0080755651f,
+    0.113429613f, 0.183938712f, 0.0839786455f, 0.154487744f,
+    0.0625030845f, 0.139629155f, 0.122206181f, 0.199332252f,
+    0.196419656f, 0.294770747f, 0.24739334f, 0.345744431f,
+    -0.450479835f, -0.0861279219f, -0.175161138f, 0.189190775f,
+    -0.514026523f, -0.241151929f, -0.115243457f, 0.157631144f,
+    -0.243348375f, 0.00738257915f, -0.0349624455f, 0.215768516f,
+    -0.306895077f, -0.14764142f, 0.0249552205f, 0.184208885f,
+    -0.328469425f, -0.0870405585f, -0.258473217f, -0.0170443505f,
+    -0.472517371f, 0.0506915748f, -0.225459188f, 0.297749758f,
+    -0.253880262f, -0.118166119f, -0.151144028f, -0.0154298842f,
+    -0.397928208f, 0.0195659995f, -0.118129998f, 0.299364209f,
+    -0.189254895f, -0.161235213f, -0.0743621141f, -0.0463424399f,
+    -0.190396979f, -0.184907675f, -0.147760049f, -0.142270744f,
+    0.000983572449f, 0.0948805064f, 0.11627607f, 0.210173011f,
+    -0.000158520677f, 0.0712080523f, 0.0428781398f, 0.114244714f,
+    -0.480420023f, 0.189857766f, -0.289755523f, 0.380522281f,
+    -0.614307344f, -0.123909146f, -0.222054929f, 0.26834327f,
+    -0.312600106f, 0.0076315254f, -0.0558202416f, 0.26441139f,
+    -0.446487427f, -0.306135356f, 0.0118803382f, 0.152232379f,
+    0.51111567f, 0.0250504985f, 0.430562288f, -0.0555028766f,
+    0.570549488f, 0.228245169f, 0.213657171f, -0.128647134f,
+    0.099720031f, -0.0926826894f, 0.193792641f, 0.00138991699f,
+    0.159153819f, 0.110511988f, -0.0231125019f, -0.0717543438f,
+    0.209713534f, -0.128421187f, 0.270494819f, -0.0676398873f,
+    0.162107989f, -0.18541047f, 0.0946640968f, -0.252854347f,
+    0.0661112368f, -0.0457332805f, 0.172975838f, 0.0611313172f,
+    0.0185056813f, -0.10272257f, -0.00285489485f, -0.124083154f,
+    0.13609536f, 0.155500457f, -0.0871243998f, -0.0677193105f,
+    0.0267200395f, 0.147805542f, -0.111514598f, 0.00957090408f,
+    -0.0296474323f, 0.0731682777f, -0.0157631524f, 0.0870525539f,
+    -0.139022753f, 0.0654733777f, -0.040153347f, 0.164342776f,
+    -0.412743777f, -0.780364037f, 0.220714673f, -0.146905571f,
+    -0.327444673f, -0.621145368f, 0.118565269f, -0.175135419f,
+    -0.119131401f, 0.0740850121f, 0.269685447f, 0.46290186f,
+    -0.0338323042f, 0.233303696f, 0.167536035f, 0.434672028f,
+    0.0490663759f, -0.0325684398f, 0.0447604507f, -0.0368743651f,
+    0.0561994463f, 0.0468723103f, 0.0447729155f, 0.0354457758f,
+    0.0579093844f, 0.0174724609f, 0.0317622274f, -0.00867469609f,
+    0.0650424585f, 0.0969132185f, 0.0317746922f, 0.0636454448f,
+    0.172548652f, 0.121712312f, -0.0651346594f, -0.115971006f,
+    0.106284678f, 0.0500208586f, 0.014558658f, -0.0417051613f,
+    -0.0368741229f, 0.00688543171f, -0.0373296961f, 0.00642985851f,
+    -0.103138089f, -0.0648060143f, 0.0423636287f, 0.0806957036f,
+    -0.236501962f, -0.00754761696f, -0.0751354098f, 0.153818935f,
+    -0.25626412f, -0.15921241f, -0.0499810353f, 0.047070682f,
+    -0.115793861f, 0.0557883196f, -0.0182647556f, 0.153317422f,
+    -0.135556027f, -0.0958764702f, 0.00688959844f, 0.0465691574f,
+    0.375696778f, 0.131987736f, 0.131022736f, -0.112686314f,
+    0.259155363f, 0.0954709128f, -0.0196786076f, -0.183363065f,
+    0.19427976f, 0.121777244f, 0.0596524477f, -0.0128500611f,
+    0.0777383447f, 0.0852604061f, -0.0910488814f, -0.0835268125f,
+    0.220921591f, 0.119807333f, -0.0426966399f, -0.143810898f,
+    0.109134771f, 0.115608796f, -0.0900424719f, -0.0835684463f,
+    0.146489173f, 0.0942926109f, -0.0113063417f, -0.0635029003f,
+    0.0347023495f, 0.0900940746f, -0.0586521737f, -0.00326044299f,
+    0.121838495f, 0.0327718183f, -0.0612596348f, -0.150326312f,
+    0.0516024046f, 0.0015681684f, -0.0860880464f, -0.136122286f,
+    -0.0193951465f, -0.0123154782f, -0.0633032992f, -0.0562236346f,
+    -0.0896312371f, -0.0435191318f, -0.0881317258f, -0.0420196131f,
+    -0.391858846f, -0.48184514f, -0.159447581f, -0.24943386f,
+    -0.259030491f, -0.297528028f, -0.157902569f, -0.196400106f,
+    -0.16621691f, -0.178751662f, 0.0475358181f, 0.0350010768f,
+    -0.03338857f, 0.00556542724f, 0.0490808263f, 0.0880348235f,
+    -0.23438099f, -0.172427028f, -0.251476705f, -0.189522728f,
+    -0.445060641f, -0.138942853f, -0.281107664f, 0.0250101015f,
+    -0.229256779f, -0.0712155104f, -0.160359085f, -0.00231780857f,
+    -0.439936429f, -0.037731342f, -0.189990073f, 0.212215021f,
+};
+
+// One entry per layer; only 3x3 stride-1 convolutions have one
+static const float* const mnist_cnn_winograd[5] = {
+    mnist_cnn_layer0_winograd,
+    NULL,
+    mnist_cnn_layer2_winograd,
+    NULL,
+    NULL,
+};
+
+#endif // MNIST_CNN_WINOGRAD_H
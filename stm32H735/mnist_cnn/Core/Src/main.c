@@ -23,8 +23,12 @@
 /* Private includes ----------------------------------------------------------*/
 /* USER CODE BEGIN Includes */
 #include <stdio.h>
-#include "model_parameters.h"
 #include "mnist_test_images.h"
+#include "mnist_cnn_model.h"
+#include "mnist_cnn_arena.h"
+#include "snn_placement.h"
+#include "snn_cache.h"
+#include "snn_mdma.h"
 /* USER CODE END Includes */
 
 /* Private typedef -----------------------------------------------------------*/
@@ -36,134 +40,35 @@
 /* USER CODE BEGIN PD */
 #define INPUT_SIZE 28
 
-#define UNROLL_FACTOR 4
-
-void relu(float* input, int size) {
-    int i;
-    int unrolled_size = size / UNROLL_FACTOR * UNROLL_FACTOR;
-    for (i = 0; i < unrolled_size; i += UNROLL_FACTOR) {
-        if (input[i] < 0) input[i] = 0;
-        if (input[i + 1] < 0) input[i + 1] = 0;
-        if (input[i + 2] < 0) input[i + 2] = 0;
-        if (input[i + 3] < 0) input[i + 3] = 0;
-    }
-    for (; i < size; ++i) {
-        if (input[i] < 0) input[i] = 0;
-    }
-}
-
-void conv2d(const float* input, float* output, const float* weights, const float* biases, int in_channels, int out_channels, int input_size, int kernel_size, int stride, int padding) {
-    int output_size = (input_size - kernel_size + 2 * padding) / stride + 1;
-
-    memset(output, 0, sizeof(float) * out_channels * output_size * output_size);
-
-    for (int oc = 0; oc < out_channels; ++oc) {
-        for (int oh = 0; oh < output_size; ++oh) {
-            for (int ow = 0; ow < output_size; ++ow) {
-                float sum = biases[oc];
-                for (int ic = 0; ic < in_channels; ++ic) {
-                    for (int kh = 0; kh < kernel_size; ++kh) {
-                        for (int kw = 0; kw < kernel_size; ++kw) {
-                            int ih = oh * stride + kh - padding;
-                            int iw = ow * stride + kw - padding;
-                            if (ih >= 0 && ih < input_size && iw >= 0 && iw < input_size) {
-                                sum += input[ic * input_size * input_size + ih * input_size + iw] * weights[oc * in_channels * kernel_size * kernel_size + ic * kernel_size * kernel_size + kh * kernel_size + kw];
-                            }
-                        }
-                    }
-                }
-                output[oc * output_size * output_size + oh * output_size + ow] = sum;
-            }
-        }
-    }
-}
+// Layer outputs, placed by snn_plan so dead buffers are reused, and by
+// snn_place in DTCM when it fits there
+static uint8_t snn_arena[MNIST_CNN_ARENA_SIZE] SNN_PLACE_ARENA __attribute__((aligned(SNN_ARENA_ALIGNMENT)));
+
+// The network inference runs; SNN_MDMA_PREFETCH builds point it at a copy
+// of mnist_cnn_network that reads its weights through snn_weight_source
+static const SNNNetwork* snn_network = &mnist_cnn_network;
+
+#ifdef SNN_MDMA_PREFETCH
+// MDMA copies the next chunk of weights out of flash into one half of the
+// staging while the layer computes on the other. Each half must hold the
+// weights of one output channel of fc1 (6272 bytes). snn_weight_source.stats
+// keeps the copy and stall cycles of each layer for the debugger.
+#ifndef SNN_PREFETCH_STAGING
+#define SNN_PREFETCH_STAGING (2 * 8192)
+#endif
 
-void maxpool2d(float* input, float* output, int in_channels, int input_size, int kernel_size, int stride) {
-    int output_size = (input_size - kernel_size) / stride + 1;
-
-    for (int ic = 0; ic < in_channels; ++ic) {
-        for (int oh = 0; oh < output_size; ++oh) {
-            for (int ow = 0; ow < output_size; ++ow) {
-                int ih = oh * stride;
-                int iw = ow * stride;
-                float max_value = input[ic * input_size * input_size + ih * input_size + iw];
-                for (int kh = 0; kh < kernel_size; ++kh) {
-                    for (int kw = 0; kw < kernel_size; ++kw) {
-                        int nih = ih + kh;
-                        int niw = iw + kw;
-                        if (nih < input_size && niw < input_size) {
-                            float value = input[ic * input_size * input_size + nih * input_size + niw];
-                            if (value > max_value) {
-                                max_value = value;
-                            }
-                        }
-                    }
-                }
-                output[ic * output_size * output_size + oh * output_size + ow] = max_value;
-            }
-        }
-    }
-}
+static SNNNetwork snn_prefetch_network;
+static SNNWeightSource snn_weight_source;
+static SNNAsyncCopy snn_weight_copy;
+static uint8_t snn_weight_staging[SNN_PREFETCH_STAGING] SNN_DTCM __attribute__((aligned(SNN_CACHE_LINE_BYTES)));
 
-void linear(float* input, float* output, const float* weights, const float* biases, int in_features, int out_features) {
-    for (int of = 0; of < out_features; ++of) {
-        float sum = biases[of];
-        int inf;
-        for (inf = 0; inf <= in_features - UNROLL_FACTOR; inf += UNROLL_FACTOR) {
-            sum += input[inf] * weights[of * in_features + inf];
-            sum += input[inf + 1] * weights[of * in_features + inf + 1];
-            sum += input[inf + 2] * weights[of * in_features + inf + 2];
-            sum += input[inf + 3] * weights[of * in_features + inf + 3];
-        }
-        for (; inf < in_features; ++inf) {
-            sum += input[inf] * weights[of * in_features + inf];
-        }
-        output[of] = sum;
-    }
+static uint32_t snn_cycles(void) {
+    return DWT->CYCCNT;
 }
+#endif
 
 int inference(const float input_image[1][INPUT_SIZE][INPUT_SIZE]) {
-    float conv1_output[CONV1_OUT_CHANNELS][INPUT_SIZE][INPUT_SIZE] = {0};
-    conv2d(&input_image[0][0][0], &conv1_output[0][0][0], &conv1_weights[0][0][0][0], conv1_biases, CONV1_IN_CHANNELS, CONV1_OUT_CHANNELS, INPUT_SIZE, CONV1_KERNEL_SIZE, CONV1_STRIDE, CONV1_PADDING);
-
-    relu(&conv1_output[0][0][0], CONV1_OUT_CHANNELS * INPUT_SIZE * INPUT_SIZE);
-
-    float pool1_output[CONV1_OUT_CHANNELS][INPUT_SIZE/2][INPUT_SIZE/2] = {0};
-    maxpool2d(&conv1_output[0][0][0], &pool1_output[0][0][0], CONV1_OUT_CHANNELS, INPUT_SIZE, 2, 2);
-
-    float conv2_output[CONV2_OUT_CHANNELS][INPUT_SIZE/2][INPUT_SIZE/2] = {0};
-    conv2d(&pool1_output[0][0][0], &conv2_output[0][0][0], &conv2_weights[0][0][0][0], conv2_biases, CONV2_IN_CHANNELS, CONV2_OUT_CHANNELS, INPUT_SIZE/2, CONV2_KERNEL_SIZE, CONV2_STRIDE, CONV2_PADDING);
-
-    relu(&conv2_output[0][0][0], CONV2_OUT_CHANNELS * INPUT_SIZE/2 * INPUT_SIZE/2);
-
-    float pool2_output[CONV2_OUT_CHANNELS][INPUT_SIZE/4][INPUT_SIZE/4] = {0};
-    maxpool2d(&conv2_output[0][0][0], &pool2_output[0][0][0], CONV2_OUT_CHANNELS, INPUT_SIZE/2, 2, 2);
-
-    float flattened_output[CONV2_OUT_CHANNELS * 7 * 7] = {0};
-    int index = 0;
-    for (int c = 0; c < CONV2_OUT_CHANNELS; ++c) {
-        for (int h = 0; h < 7; ++h) {
-            for (int w = 0; w < 7; ++w) {
-                flattened_output[index++] = pool2_output[c][h][w];
-            }
-        }
-    }
-
-    float fc_output[FC1_OUT_FEATURES] = {0};
-    linear(flattened_output, fc_output, &fc1_weights[0][0], fc1_biases, FC1_IN_FEATURES, FC1_OUT_FEATURES);
-
-    relu(fc_output, FC1_OUT_FEATURES);
-
-    int predicted_label = 0;
-    float max_val = fc_output[0];
-    for (int i = 1; i < FC1_OUT_FEATURES; ++i) {
-        if (fc_output[i] > max_val) {
-            max_val = fc_output[i];
-            predicted_label = i;
-        }
-    }
-
-    return predicted_label;
+    return snn_network_inference(snn_network, &input_image[0][0][0], snn_arena);
 }
 
 /* USER CODE END PD */
@@ -263,7 +168,12 @@ int main(void)
   HAL_Init();
 
   /* USER CODE BEGIN Init */
-
+  // D2 SRAM is unclocked after reset; then move the tagged kernels and
+  // buffers into place before anything runs from them
+  __HAL_RCC_D2SRAM1_CLK_ENABLE();
+  __HAL_RCC_D2SRAM2_CLK_ENABLE();
+  snn_placement_init();
+  snn_cache_init();
   /* USER CODE END Init */
 
   /* Configure the system clock */
@@ -282,6 +192,18 @@ int main(void)
   MX_USART1_UART_Init();
   /* USER CODE BEGIN 2 */
   HAL_TIM_Base_Start(&htim1);
+#ifdef SNN_MDMA_PREFETCH
+  CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+  DWT->LAR = 0xC5ACCE55;
+  DWT->CYCCNT = 0;
+  DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+  snn_mdma_init(&snn_weight_copy, snn_cycles);
+  snn_prefetch_network = mnist_cnn_network;
+  snn_prefetch_network.weight_source = &snn_weight_source;
+  snn_weights_prefetch(&snn_weight_source, snn_weight_staging, sizeof(snn_weight_staging), &snn_weight_copy,
+                       &snn_prefetch_network);
+  snn_network = &snn_prefetch_network;
+#endif
   /* USER CODE END 2 */
 
   /* Infinite loop */
@@ -0,0 +1,104 @@
+#include "mnist_cnn_model.h"
+#include "model_parameters.h"
+
+// SNN_INT8_WEIGHTS builds run on the int8 weights of mnist_cnn_q8.h and
+// SNN_CODEBOOK_WEIGHTS builds on the 4-bit codebook weights of
+// mnist_cnn_codebook.h; both leave the float weights out of flash
+#if defined(SNN_INT8_WEIGHTS)
+#include "mnist_cnn_q8.h"
+#define WEIGHTS(name) NULL
+#define QUANTIZED mnist_cnn_quantized
+#define CODEBOOK NULL
+#elif defined(SNN_CODEBOOK_WEIGHTS)
+#include "mnist_cnn_codebook.h"
+#define WEIGHTS(name) NULL
+#define QUANTIZED NULL
+#define CODEBOOK mnist_cnn_codebook
+#else
+#define WEIGHTS(name) name
+#define QUANTIZED NULL
+#define CODEBOOK NULL
+#endif
+
+// The 3x3 convolutions run as Winograd F(2x2,3x3) on the kernels of
+// mnist_cnn_winograd.h. SNN_DIRECT_CONV builds run them direct, to save arena
+// and flash or to compare the layer_ticks of both on target; SNN_GEMM_CONV
+// builds run conv2 as a GEMM, which cannot fuse the pool after it.
+// SNN_MDMA_PREFETCH builds run them direct too, as the transformed kernels
+// would bypass the prefetched weights.
+#if defined(SNN_DIRECT_CONV) || defined(SNN_INT8_WEIGHTS) || defined(SNN_CODEBOOK_WEIGHTS) || \
+    defined(SNN_CHANNELS_LAST) || defined(SNN_MDMA_PREFETCH)
+#define WINOGRAD NULL
+#else
+#include "mnist_cnn_winograd.h"
+#define WINOGRAD mnist_cnn_winograd
+#endif
+
+// SNN_CHANNELS_LAST builds run conv2 on the OHWI weights of mnist_cnn_ohwi.h
+// over a channels-last (HWC) copy of its input, in place of Winograd
+#if defined(SNN_CHANNELS_LAST) && !defined(SNN_INT8_WEIGHTS) && !defined(SNN_CODEBOOK_WEIGHTS)
+#include "mnist_cnn_ohwi.h"
+#define OHWI mnist_cnn_ohwi
+#else
+#define OHWI NULL
+#endif
+
+// SNN_SPARSE_FC builds run fc1 on the block-sparse weights of
+// mnist_cnn_sparse.h, pruned by the snn_sparse_headers target, and leave its
+// dense weights out of flash
+#if defined(SNN_SPARSE_FC) && !defined(SNN_INT8_WEIGHTS) && !defined(SNN_CODEBOOK_WEIGHTS)
+#include "mnist_cnn_sparse.h"
+#define SPARSE mnist_cnn_sparse
+#define FC_WEIGHTS(name) NULL
+#else
+#define SPARSE NULL
+#define FC_WEIGHTS(name) WEIGHTS(name)
+#endif
+
+// SNN_CACHE_ENABLE builds run with the caches on (snn_cache_init()) and
+// compute the float conv layers in tiles sized to the L1 D-cache
+#ifdef SNN_CACHE_ENABLE
+#define CONV_LAYER SNN_TILED_CONV2D
+#else
+#define CONV_LAYER SNN_CONV2D
+#endif
+
+#ifdef SNN_GEMM_CONV
+#define CONV2_LAYER SNN_GEMM_CONV2D
+#else
+#define CONV2_LAYER CONV_LAYER
+#endif
+
+#define INPUT_SIZE 28
+#define TIMESTEPS 1
+
+// snn_conv2d() specialised for the two conv shapes, for the builds (and
+// layers) that run them direct
+SNN_SPECIALIZE_CONV2D(mnist_cnn_conv1, CONV1_IN_CHANNELS, INPUT_SIZE, CONV1_KERNEL_SIZE, CONV1_STRIDE, CONV1_PADDING);
+SNN_SPECIALIZE_CONV2D(mnist_cnn_conv2, CONV2_IN_CHANNELS, INPUT_SIZE/2, CONV2_KERNEL_SIZE, CONV2_STRIDE, CONV2_PADDING);
+
+static const SNNConvKernel* const mnist_cnn_kernels[] = { &mnist_cnn_conv1, NULL, &mnist_cnn_conv2, NULL, NULL };
+
+static const SNNLayer mnist_cnn_layers[] = {
+    CONV_LAYER(CONV1_IN_CHANNELS, CONV1_OUT_CHANNELS, INPUT_SIZE, CONV1_KERNEL_SIZE, CONV1_STRIDE, CONV1_PADDING,
+               WEIGHTS(conv1_weights), conv1_biases, SNN_ACT_RELU, 0, 0),
+    SNN_MAXPOOL2D(CONV1_OUT_CHANNELS, INPUT_SIZE, 2, 2),
+    CONV2_LAYER(CONV2_IN_CHANNELS, CONV2_OUT_CHANNELS, INPUT_SIZE/2, CONV2_KERNEL_SIZE, CONV2_STRIDE, CONV2_PADDING,
+                WEIGHTS(conv2_weights), conv2_biases, SNN_ACT_RELU, 0, 0),
+    SNN_MAXPOOL2D(CONV2_OUT_CHANNELS, INPUT_SIZE/2, 2, 2),
+    SNN_LINEAR(FC1_IN_FEATURES, FC1_OUT_FEATURES, FC_WEIGHTS(fc1_weights), fc1_biases, SNN_ACT_RELU, 0, 0),
+};
+
+const SNNNetwork mnist_cnn_network = {
+    "mnist_cnn",
+    mnist_cnn_layers,
+    sizeof(mnist_cnn_layers) / sizeof(mnist_cnn_layers[0]),
+    TIMESTEPS,
+    QUANTIZED,
+    0,
+    WINOGRAD,
+    mnist_cnn_kernels,
+    OHWI,
+    SPARSE,
+    CODEBOOK,
+};
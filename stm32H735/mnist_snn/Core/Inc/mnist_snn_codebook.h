@@ -0,0 +1,688 @@
+// Generated by snn_core/Tools/snn_codebook from the mnist_snn weights.
+// Regenerate with the snn_codebook_headers target after retraining the model.
+#ifndef MNIST_SNN_CODEBOOK_H
+#define MNIST_SNN_CODEBOOK_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "snn_codebook.h"
+
+static const uint8_t mnist_snn_layer0_indices[72] = {
+    0x78, 0x86, 0x97, 0x8a, 0xf9, 0xfc, 0xd9, 0x8a, 0x9c, 0x76, 0x63, 0x37, 0x96, 0x99, 0x37, 0xa6,
+    0x84, 0xb5, 0x5b, 0x9a, 0x96, 0x9d, 0x6b, 0x67, 0xa5, 0xa8, 0x87, 0xab, 0xa7, 0x6b, 0xad, 0x45,
+    0xb4, 0x55, 0x8a, 0xbe, 0x30, 0x78, 0xcb, 0x9f, 0x9c, 0xd9, 0xd8, 0xb5, 0x9a, 0xab, 0xa2, 0xc7,
+    0x9a, 0xcc, 0xfa, 0x5b, 0x4b, 0xb5, 0x8b, 0x9d, 0xd5, 0xdb, 0xaa, 0xa7, 0x4d, 0xb6, 0xbd, 0x97,
+    0x9e, 0xb5, 0x66, 0xa8, 0x35, 0xcc, 0xb8, 0xb9,
+};
+
+static const float mnist_snn_layer0_codebook[16] = {
+    -0.848082423f, -0.752893806f, -0.675121844f, -0.517015219f,
+    -0.439032614f, -0.335251182f, -0.230642304f, -0.15687944f,
+    -0.0881237462f, -0.01061738f, 0.113305807f, 0.210140228f,
+    0.284125924f, 0.379438996f, 0.490066648f, 0.55423826f,
+};
+
+static const uint8_t mnist_snn_layer2_indices[2304] = {
+    0x86, 0x77, 0x99, 0x67, 0xc8, 0x96, 0x77, 0x77, 0x87, 0x87, 0x8a, 0x76, 0x79, 0x7a, 0x79, 0xa9,
+    0x78, 0xa8, 0x97, 0x99, 0x7b, 0xa9, 0x89, 0x68, 0x67, 0x79, 0x89, 0x88, 0x89, 0x99, 0x75, 0xb6,
+    0xac, 0xa9, 0x7a, 0x47, 0xa7, 0x39, 0xa9, 0xb5, 0xdb, 0x99, 0x8a, 0x7a, 0xa8, 0x89, 0xb8, 0x8c,
+    0x9b, 0x49, 0x98, 0x86, 0xb6, 0xaa, 0x99, 0x97, 0x79, 0x77, 0x7a, 0x96, 0xdc, 0xe8, 0x9b, 0x97,
+    0x78, 0xba, 0x68, 0x3b, 0x87, 0xb7, 0xb5, 0x97, 0x78, 0x97, 0x96, 0x77, 0xa8, 0x66, 0xaa, 0xc7,
+    0xbe, 0x77, 0x78, 0x66, 0x88, 0x96, 0x98, 0x86, 0x8a, 0x67, 0x86, 0x9b, 0x84, 0x76, 0xaa, 0x88,
+    0xa8, 0x88, 0x6a, 0x86, 0x78, 0xc6, 0x34, 0xa7, 0x4b, 0x67, 0x77, 0x79, 0x94, 0xa8, 0x88, 0x43,
+    0x91, 0x39, 0x58, 0x15, 0xb3, 0xc5, 0x9c, 0x35, 0x24, 0x44, 0x45, 0xac, 0xd8, 0xbd, 0xa7, 0xc8,
+    0xa9, 0x65, 0x89, 0x96, 0xb6, 0x75, 0x37, 0x68, 0x89, 0xa7, 0x98, 0x88, 0xa5, 0x77, 0x78, 0x96,
+    0x78, 0xa7, 0x69, 0x96, 0x7a, 0x24, 0x58, 0xb4, 0x99, 0x97, 0xa7, 0x79, 0x77, 0xa7, 0x97, 0x79,
+    0x88, 0x69, 0x89, 0x99, 0x7b, 0xaa, 0x78, 0x68, 0x79, 0x9a, 0x76, 0x98, 0x84, 0x57, 0x87, 0xbb,
+    0x96, 0x88, 0x97, 0xa8, 0x7a, 0x9a, 0x79, 0x59, 0xb9, 0x58, 0x57, 0x53, 0x28, 0x66, 0xd8, 0x87,
+    0xac, 0x3d, 0x33, 0x54, 0xc5, 0x89, 0x16, 0x83, 0x37, 0x79, 0x9a, 0x58, 0xde, 0x89, 0xa9, 0x89,
+    0x77, 0x5a, 0x9c, 0x6a, 0xb4, 0xda, 0x97, 0x77, 0x89, 0x87, 0x97, 0x77, 0xb8, 0x8c, 0x94, 0xa8,
+    0x8a, 0x88, 0x88, 0x68, 0x76, 0x99, 0x88, 0x88, 0x98, 0x68, 0x45, 0xa8, 0x96, 0x77, 0x69, 0x78,
+    0x77, 0x69, 0x87, 0x67, 0x46, 0xa5, 0x76, 0x88, 0x83, 0x92, 0x9a, 0x45, 0x77, 0x56, 0x46, 0xa8,
+    0xb7, 0x79, 0x76, 0x67, 0xaa, 0xb8, 0xbc, 0xb8, 0x78, 0xbc, 0x6a, 0x89, 0x65, 0xcb, 0x9b, 0x78,
+    0x9a, 0xb6, 0xc7, 0xed, 0xbe, 0x9d, 0x65, 0xa9, 0x75, 0x9a, 0x87, 0xa8, 0x97, 0x88, 0x36, 0x84,
+    0x76, 0x76, 0x79, 0x78, 0x7a, 0xbc, 0x66, 0x29, 0x86, 0x76, 0x8a, 0x9a, 0x9a, 0x79, 0xa6, 0x96,
+    0x97, 0xa8, 0x97, 0x55, 0x79, 0x56, 0xa8, 0x78, 0x79, 0x96, 0x7a, 0x68, 0x47, 0x66, 0x26, 0x59,
+    0x66, 0x85, 0x7a, 0x8b, 0xb6, 0xa5, 0x8b, 0xb8, 0x8c, 0x4c, 0x85, 0x76, 0xa8, 0x95, 0x5b, 0x98,
+    0x86, 0xa8, 0x9a, 0x96, 0x4c, 0x42, 0x9b, 0x6a, 0x98, 0xa7, 0xab, 0xa5, 0x38, 0x34, 0x45, 0xa9,
+    0xb7, 0xa9, 0x85, 0xa8, 0x88, 0x89, 0x88, 0x46, 0x8a, 0x79, 0x98, 0x69, 0x37, 0xe4, 0x35, 0xcc,
+    0x68, 0x67, 0x87, 0x97, 0x69, 0x67, 0x97, 0x87, 0x97, 0xa9, 0x8a, 0x78, 0x98, 0xba, 0x87, 0x68,
+    0x98, 0x66, 0x76, 0x51, 0x53, 0x56, 0x76, 0x98, 0x98, 0x56, 0x74, 0x88, 0x5b, 0xba, 0x24, 0x78,
+    0x56, 0x94, 0x59, 0x42, 0x34, 0x47, 0x74, 0x83, 0xcc, 0x99, 0xb9, 0x75, 0xbd, 0x69, 0x64, 0x4c,
+    0xb7, 0x89, 0x71, 0x45, 0xd8, 0xca, 0xee, 0x8a, 0x9c, 0x97, 0x97, 0x65, 0x59, 0xbb, 0x77, 0xcd,
+    0x96, 0x99, 0xa8, 0x69, 0x86, 0x38, 0xab, 0x78, 0xeb, 0x8a, 0x78, 0x87, 0x87, 0x77, 0x77, 0x99,
+    0x69, 0x69, 0xb6, 0xa8, 0x87, 0x7a, 0xa8, 0x79, 0x68, 0x97, 0x77, 0x87, 0x64, 0x46, 0x77, 0x68,
+    0x75, 0x77, 0x63, 0x29, 0x76, 0xa6, 0x79, 0x56, 0x96, 0x7b, 0x86, 0x86, 0x55, 0x66, 0xb5, 0x9d,
+    0xaa, 0x6b, 0x84, 0xb8, 0x96, 0x8b, 0x69, 0xb2, 0x56, 0x85, 0x9a, 0x8b, 0xc9, 0x4e, 0xaa, 0x85,
+    0x86, 0x68, 0x88, 0x79, 0x9b, 0xa8, 0x7c, 0x8b, 0x77, 0x96, 0x69, 0x69, 0x59, 0xa5, 0x85, 0xba,
+    0x5a, 0x79, 0x68, 0x67, 0x76, 0xa7, 0x99, 0xa7, 0x78, 0x98, 0xb6, 0x96, 0x99, 0x79, 0x86, 0x76,
+    0x76, 0x9a, 0x76, 0x76, 0x77, 0x95, 0x69, 0x46, 0xb6, 0x98, 0x57, 0x99, 0xb6, 0xbc, 0x7d, 0x48,
+    0x9a, 0x66, 0xc5, 0xcc, 0xa8, 0xdc, 0xd8, 0x16, 0x57, 0xb9, 0x68, 0x56, 0xa9, 0x9c, 0xb5, 0xcb,
+    0x9b, 0x67, 0x94, 0x54, 0x38, 0x96, 0xac, 0xac, 0x98, 0xaa, 0x8b, 0x96, 0x7a, 0x48, 0x64, 0x56,
+    0x77, 0x66, 0x96, 0x89, 0x36, 0x51, 0x89, 0xd3, 0xbe, 0x76, 0xaa, 0x97, 0x79, 0x98, 0x77, 0x86,
+    0x78, 0x67, 0x99, 0x88, 0x7b, 0x89, 0x6b, 0x88, 0x99, 0xa9, 0x69, 0x44, 0x64, 0x7a, 0x78, 0x45,
+    0x46, 0x86, 0x68, 0x64, 0xab, 0xe5, 0x96, 0x7a, 0x3b, 0x12, 0x76, 0xa2, 0x37, 0x75, 0x73, 0x98,
+    0x65, 0x4d, 0xc9, 0x95, 0x84, 0xca, 0x13, 0x63, 0x17, 0x9c, 0x1b, 0x88, 0x61, 0x8b, 0x87, 0x77,
+    0x9a, 0xa8, 0x7b, 0x69, 0x7b, 0x93, 0x6b, 0xa5, 0x99, 0x98, 0x89, 0x98, 0xa9, 0x55, 0x35, 0x51,
+    0x79, 0x98, 0x9a, 0x78, 0x98, 0x78, 0x87, 0x68, 0x9a, 0x99, 0x99, 0x58, 0x86, 0x9c, 0x79, 0x98,
+    0x99, 0x87, 0xa9, 0x88, 0x57, 0x34, 0x53, 0xc7, 0x94, 0x78, 0x86, 0x87, 0x58, 0xc8, 0xcb, 0xce,
+    0xb9, 0xaa, 0x6b, 0x95, 0x5a, 0x48, 0x52, 0x79, 0xbc, 0xba, 0x37, 0x65, 0xb8, 0xab, 0x67, 0x33,
+    0x42, 0x67, 0x66, 0x23, 0x4a, 0x76, 0xaa, 0x97, 0xa8, 0x86, 0x9b, 0x79, 0x76, 0x77, 0xb7, 0xb9,
+    0x7a, 0x66, 0x9a, 0x98, 0x96, 0xb9, 0x8a, 0x78, 0x37, 0x88, 0x7a, 0x6a, 0x88, 0x88, 0x98, 0x79,
+    0x89, 0x79, 0x98, 0x78, 0x98, 0x96, 0x69, 0x98, 0x98, 0x79, 0x76, 0x89, 0x87, 0x3a, 0xab, 0x85,
+    0x9c, 0x9a, 0x56, 0x58, 0x89, 0x6d, 0xc6, 0x74, 0xb8, 0xab, 0xbc, 0x96, 0x44, 0xc6, 0x65, 0x37,
+    0xcc, 0x48, 0xb5, 0x95, 0x79, 0x68, 0x8a, 0xb9, 0x37, 0x7a, 0x94, 0x77, 0x67, 0xc7, 0x8d, 0x66,
+    0x89, 0x88, 0x98, 0x45, 0x79, 0x64, 0x66, 0xbb, 0x89, 0xa8, 0x69, 0x97, 0x59, 0xbb, 0x9a, 0xa8,
+    0x77, 0x79, 0x96, 0x79, 0x99, 0x87, 0x86, 0x76, 0x66, 0x89, 0x68, 0x85, 0x68, 0x65, 0x8a, 0x87,
+    0x99, 0x66, 0x87, 0x75, 0xba, 0x94, 0x97, 0x86, 0xba, 0xa9, 0x66, 0x95, 0xbb, 0xa9, 0x47, 0x55,
+    0xb6, 0xab, 0xcd, 0x9c, 0x49, 0x77, 0x79, 0x75, 0x96, 0xab, 0x75, 0x63, 0x78, 0xbc, 0xc4, 0x9b,
+    0x7a, 0xab, 0x69, 0x68, 0x64, 0xca, 0xdb, 0x68, 0x69, 0xa6, 0x79, 0x79, 0x77, 0x43, 0x45, 0x89,
+    0x88, 0x79, 0x69, 0xa9, 0xda, 0xad, 0xee, 0xa8, 0x89, 0x68, 0x67, 0x79, 0x88, 0x89, 0x9a, 0x78,
+    0x6a, 0x97, 0x8a, 0x5a, 0x89, 0x76, 0x88, 0x87, 0x7a, 0x79, 0x67, 0xa4, 0x8b, 0x75, 0x44, 0xba,
+    0x98, 0x44, 0x7a, 0x69, 0xdb, 0xb5, 0x87, 0x36, 0x89, 0x9c, 0x6c, 0x75, 0x6a, 0xc8, 0x6a, 0x94,
+    0x68, 0xb9, 0xa8, 0xcf, 0x77, 0x6a, 0xc9, 0xc6, 0x66, 0x56, 0x45, 0x74, 0x58, 0x49, 0xb6, 0x85,
+    0x98, 0x88, 0x69, 0x57, 0xb5, 0x58, 0x5a, 0x97, 0x78, 0x8a, 0xa6, 0x9a, 0xb9, 0x65, 0x39, 0xb8,
+    0x84, 0x99, 0x77, 0x99, 0x97, 0x99, 0x67, 0x67, 0x78, 0x79, 0x79, 0xa7, 0x86, 0x89, 0x79, 0x86,
+    0x86, 0x98, 0x66, 0x7c, 0x9b, 0xb9, 0xab, 0x6c, 0x79, 0x4a, 0x9a, 0xdc, 0x59, 0x94, 0x44, 0x7a,
+    0x68, 0xc7, 0x8a, 0xc7, 0x85, 0x49, 0x73, 0x14, 0x69, 0x85, 0xc5, 0x39, 0x6d, 0xdb, 0x58, 0xb8,
+    0xd3, 0x56, 0x6d, 0x38, 0xb9, 0x73, 0x5a, 0x65, 0xba, 0x88, 0xb7, 0xb8, 0x27, 0x99, 0x83, 0x6c,
+    0x68, 0x8a, 0x79, 0x77, 0x3a, 0xb8, 0xb2, 0x3c, 0xdb, 0x69, 0x89, 0x99, 0x77, 0x7a, 0x67, 0x79,
+    0x98, 0xa6, 0x8a, 0x78, 0x87, 0x8a, 0x79, 0x77, 0xa6, 0x67, 0x88, 0x56, 0x4a, 0xbb, 0xbd, 0xcb,
+    0x7b, 0xba, 0xeb, 0x88, 0x52, 0x38, 0x52, 0x96, 0x71, 0xa9, 0x88, 0x54, 0x48, 0x43, 0x55, 0x74,
+    0x34, 0xa7, 0x3a, 0xa9, 0x93, 0x5a, 0x85, 0x88, 0x6b, 0xe7, 0x5b, 0x89, 0x67, 0x68, 0x64, 0xba,
+    0x86, 0x5b, 0x98, 0x88, 0xa7, 0x96, 0x9a, 0xbb, 0xa9, 0x78, 0x67, 0x87, 0x69, 0xd7, 0xde, 0x6b,
+    0x69, 0x99, 0x87, 0x9a, 0x88, 0xa9, 0x96, 0x69, 0x99, 0x69, 0x98, 0x9a, 0x97, 0x88, 0x98, 0x67,
+    0xa9, 0x78, 0x77, 0x66, 0x68, 0x69, 0x44, 0xa5, 0x96, 0x76, 0x75, 0x94, 0x6a, 0x4c, 0xcb, 0x48,
+    0x4d, 0x95, 0x72, 0x0b, 0x54, 0x68, 0x79, 0x29, 0x15, 0x52, 0x56, 0xbf, 0x8c, 0x69, 0x98, 0x8a,
+    0x9b, 0x01, 0xc3, 0x35, 0x3a, 0xb2, 0x35, 0xa7, 0xa6, 0x89, 0x79, 0x97, 0x49, 0x87, 0xd7, 0x38,
+    0x9a, 0x86, 0x88, 0x79, 0xd9, 0xdc, 0x78, 0x59, 0x95, 0x69, 0x76, 0x78, 0x6a, 0x68, 0xa9, 0x86,
+    0x96, 0x79, 0x97, 0x8b, 0x67, 0x5a, 0x88, 0x88, 0x66, 0x97, 0x87, 0x54, 0x93, 0x45, 0x89, 0x77,
+    0x74, 0x58, 0x4b, 0xaa, 0xba, 0x1a, 0x84, 0x52, 0x7a, 0x66, 0x56, 0x75, 0x95, 0xbd, 0x4a, 0x76,
+    0x66, 0x83, 0xb9, 0xba, 0x8a, 0x8b, 0x9b, 0x98, 0x97, 0x42, 0x86, 0xcc, 0x88, 0xd7, 0x4a, 0x9a,
+    0xa6, 0x8a, 0x79, 0x68, 0x99, 0xa3, 0xb8, 0x47, 0x68, 0x66, 0x6a, 0x78, 0xb8, 0x5c, 0xd7, 0x4d,
+    0xba, 0x76, 0x98, 0x77, 0x8a, 0x97, 0x66, 0x79, 0x99, 0x89, 0x8a, 0x7b, 0x77, 0x89, 0x68, 0x88,
+    0x66, 0x89, 0x97, 0x67, 0x46, 0x5a, 0xa3, 0x69, 0x57, 0x56, 0xb5, 0x79, 0xcb, 0x59, 0x96, 0xb8,
+    0x75, 0x56, 0x54, 0x25, 0x77, 0xad, 0x7a, 0x8c, 0x46, 0xa4, 0x67, 0xdb, 0x6d, 0x89, 0x56, 0x76,
+    0x98, 0x54, 0xd5, 0xad, 0xd8, 0x69, 0x76, 0x6b, 0x79, 0x78, 0xa6, 0xb8, 0x6a, 0xa7, 0xa8, 0x94,
+    0x87, 0x97, 0x79, 0x88, 0x29, 0x92, 0x8c, 0xb7, 0x9a, 0x8a, 0x77, 0x97, 0x98, 0x87, 0x97, 0x7a,
+    0x76, 0x78, 0x66, 0x69, 0x6a, 0x56, 0xa6, 0x89, 0x98, 0x87, 0x88, 0x67, 0x49, 0xa8, 0x53, 0x9b,
+    0xcb, 0x9b, 0x68, 0xa7, 0xb9, 0xe9, 0xb9, 0x64, 0x66, 0x54, 0x35, 0x55, 0xb6, 0x89, 0xc5, 0x9d,
+    0x74, 0x54, 0x54, 0x57, 0xd3, 0x8b, 0x37, 0x78, 0x77, 0x99, 0x78, 0x9b, 0x8a, 0xa7, 0x66, 0x78,
+    0x89, 0x98, 0xb9, 0x88, 0x79, 0xaa, 0x86, 0x88, 0xa7, 0x98, 0x87, 0x88, 0x6a, 0x97, 0x57, 0x6a,
+    0xb3, 0x78, 0x99, 0x8a, 0x87, 0xa8, 0x88, 0x89, 0x98, 0x88, 0x97, 0x7a, 0x99, 0x88, 0x99, 0x79,
+    0x79, 0x79, 0x97, 0x69, 0xcb, 0xcb, 0x7b, 0x97, 0x68, 0xa7, 0x89, 0x98, 0x56, 0x75, 0x32, 0x76,
+    0x93, 0x97, 0x68, 0x36, 0x51, 0x58, 0x15, 0xb7, 0x5a, 0xaa, 0x9b, 0xb8, 0x4b, 0xd9, 0x97, 0x49,
+    0xb9, 0x63, 0x6b, 0x99, 0x46, 0x8c, 0x79, 0x9a, 0x9a, 0x99, 0x89, 0xa7, 0x69, 0x79, 0xa8, 0x66,
+    0x68, 0x86, 0x79, 0x79, 0x58, 0xa9, 0x83, 0x6a, 0xc8, 0x86, 0x99, 0x66, 0x89, 0x88, 0x8a, 0x97,
+    0x67, 0x69, 0x77, 0xa5, 0x88, 0x98, 0x87, 0x78, 0x69, 0x79, 0xa7, 0xb9, 0x8a, 0xbc, 0x75, 0x8a,
+    0x93, 0x8a, 0x89, 0x7c, 0x68, 0x77, 0x36, 0x8a, 0x75, 0x6a, 0x95, 0x23, 0x74, 0x78, 0x97, 0xb7,
+    0x88, 0xc6, 0x3b, 0xab, 0x47, 0x89, 0xa7, 0x66, 0x79, 0x99, 0x9a, 0xe9, 0x5b, 0x6a, 0xa6, 0x88,
+    0xb7, 0x99, 0x66, 0x9b, 0x9c, 0x5b, 0x9b, 0x96, 0x76, 0x87, 0x89, 0x68, 0x66, 0x6c, 0xc6, 0xa6,
+    0x6b, 0xa8, 0x8a, 0x69, 0x77, 0x7a, 0x99, 0x88, 0x86, 0x99, 0x87, 0x69, 0x68, 0x68, 0xa8, 0x88,
+    0x77, 0x97, 0x68, 0xab, 0x8c, 0x9c, 0xc9, 0x9b, 0xba, 0x49, 0xa6, 0xba, 0x44, 0x84, 0x53, 0x2d,
+    0x86, 0x59, 0x88, 0xb4, 0xbc, 0x77, 0x48, 0xa8, 0xa6, 0xc8, 0x46, 0xa8, 0x62, 0x77, 0xb9, 0xb6,
+    0x9a, 0xcb, 0x78, 0xc9, 0xc4, 0x6d, 0x96, 0x9c, 0x99, 0xaa, 0xb8, 0x5c, 0xa9, 0x62, 0x5a, 0x55,
+    0x78, 0x9a, 0x97, 0xa9, 0x77, 0x8b, 0x97, 0xa7, 0x49, 0x77, 0x87, 0x98, 0x78, 0x79, 0x78, 0x69,
+    0x98, 0x89, 0x96, 0x87, 0x79, 0x7a, 0x96, 0xa7, 0xa8, 0x87, 0x79, 0xa6, 0x7c, 0xb8, 0x69, 0xca,
+    0x8b, 0xab, 0x79, 0x6c, 0x58, 0xa5, 0x2c, 0x9b, 0x84, 0xbb, 0xd7, 0x9d, 0xca, 0x86, 0x81, 0x42,
+    0x34, 0xa4, 0x84, 0x87, 0xa3, 0x36, 0xcb, 0xca, 0x7c, 0x7a, 0x84, 0x73, 0x52, 0x6a, 0x82, 0x7a,
+    0x8a, 0xa9, 0x99, 0x78, 0x77, 0x76, 0x48, 0x76, 0x78, 0x87, 0xaa, 0x76, 0x57, 0xa7, 0xdc, 0xbd,
+    0xba, 0x99, 0x79, 0x79, 0x78, 0x99, 0x77, 0x66, 0x96, 0x68, 0xa6, 0x96, 0x78, 0x59, 0x9a, 0x68,
+    0xa9, 0x68, 0x6a, 0x6a, 0x87, 0x79, 0xa4, 0x93, 0x86, 0x64, 0x69, 0x65, 0xc9, 0xcc, 0x7d, 0x64,
+    0x51, 0x67, 0x7b, 0x7a, 0x49, 0x97, 0x66, 0x99, 0x28, 0x2d, 0x54, 0xca, 0x7a, 0xa9, 0x79, 0x88,
+    0x9d, 0x58, 0x84, 0x5d, 0x36, 0x79, 0x99, 0x78, 0x55, 0x97, 0x77, 0x44, 0x37, 0x5a, 0x66, 0xc7,
+    0x88, 0x88, 0x98, 0x87, 0x56, 0xd8, 0xa4, 0x8c, 0x9d, 0x76, 0x98, 0x86, 0x78, 0x66, 0x97, 0x79,
+    0x98, 0x89, 0x9a, 0xb6, 0x78, 0x7a, 0x98, 0x97, 0x99, 0x87, 0x69, 0x85, 0x68, 0x6b, 0x8b, 0x6a,
+    0xaa, 0xa6, 0x88, 0x3a, 0x64, 0x5c, 0x97, 0xc9, 0x95, 0xa8, 0x82, 0x9c, 0xbd, 0x47, 0x77, 0x55,
+    0x58, 0xa4, 0x77, 0x77, 0x55, 0x65, 0x55, 0x5b, 0xbb, 0xdb, 0x65, 0x44, 0x2a, 0x63, 0x43, 0xb8,
+    0x86, 0x66, 0x67, 0x96, 0x87, 0xa9, 0x75, 0x42, 0x97, 0x88, 0x8a, 0x76, 0x48, 0xaa, 0x63, 0x37,
+    0xc5, 0x99, 0x98, 0x89, 0x97, 0x88, 0x78, 0x77, 0x88, 0x97, 0x88, 0x69, 0xa7, 0x89, 0x77, 0x79,
+    0x8a, 0x87, 0x99, 0x87, 0x5d, 0xc5, 0x57, 0x8c, 0x79, 0x58, 0x57, 0xab, 0x46, 0x26, 0x85, 0x38,
+    0x58, 0x5b, 0x28, 0x44, 0x53, 0x60, 0x7b, 0x83, 0x56, 0x53, 0xb9, 0x94, 0x7b, 0xe6, 0x94, 0x5a,
+    0x96, 0x67, 0xab, 0x83, 0x86, 0x7b, 0x9a, 0xba, 0x7a, 0x95, 0xa6, 0xb6, 0x99, 0x49, 0x86, 0x38,
+    0x66, 0x67, 0x76, 0x86, 0x78, 0xb7, 0x67, 0x88, 0x88, 0x76, 0xaa, 0x89, 0x97, 0x78, 0x67, 0xa9,
+    0x89, 0x66, 0x99, 0x87, 0x99, 0x79, 0x69, 0x86, 0x96, 0x78, 0x88, 0x68, 0xa5, 0x89, 0x9b, 0x69,
+    0x4a, 0x77, 0x67, 0x56, 0xb8, 0x3a, 0x66, 0x74, 0xba, 0x7b, 0x8e, 0x57, 0xb7, 0x78, 0xa8, 0xab,
+    0x88, 0x67, 0xdb, 0x68, 0x89, 0x57, 0x9a, 0xa9, 0x77, 0x7b, 0x66, 0x83, 0xcb, 0xdb, 0xbb, 0x77,
+    0x85, 0x77, 0x89, 0x76, 0x98, 0x84, 0x95, 0x88, 0x79, 0x76, 0x87, 0x9a, 0x3a, 0x41, 0x75, 0x3c,
+    0xc9, 0x99, 0x86, 0x97, 0x68, 0x77, 0x99, 0x77, 0x77, 0x77, 0x89, 0xa8, 0x99, 0x9a, 0x77, 0x89,
+    0x77, 0x7a, 0x68, 0x38, 0xc7, 0x67, 0x78, 0xab, 0xab, 0xbc, 0xa9, 0x98, 0x56, 0x69, 0x76, 0x86,
+    0x48, 0x21, 0x99, 0x4a, 0xd8, 0x58, 0x26, 0x73, 0x33, 0x48, 0x55, 0x63, 0x26, 0x4b, 0x63, 0x5b,
+    0xdb, 0xc6, 0x8c, 0x35, 0x33, 0x37, 0xb8, 0x78, 0x8a, 0x98, 0x77, 0x79, 0x44, 0x97, 0xa8, 0x66,
+    0x77, 0x79, 0x99, 0x89, 0xc7, 0x7a, 0xba, 0x2b, 0x63, 0x76, 0x96, 0x77, 0x89, 0x88, 0x87, 0x88,
+    0x86, 0xa9, 0x88, 0x9a, 0x77, 0x75, 0x97, 0x68, 0x98, 0x86, 0x87, 0x57, 0x57, 0x78, 0x87, 0xa7,
+    0x74, 0x93, 0x7a, 0xc8, 0x95, 0x6b, 0x5a, 0x5b, 0x48, 0x83, 0x31, 0x5a, 0x82, 0xcc, 0x89, 0x47,
+    0x26, 0xe2, 0x99, 0xba, 0x4b, 0x32, 0x66, 0x76, 0x45, 0x33, 0xb7, 0x69, 0x95, 0xc6, 0x5c, 0x67,
+    0xaa, 0x98, 0xcb, 0x98, 0x47, 0x77, 0xd4, 0x59, 0x67, 0x67, 0x88, 0x99, 0x1a, 0xb7, 0xb3, 0x8b,
+    0x9a, 0x68, 0xa7, 0x96, 0x98, 0x77, 0x69, 0x86, 0x87, 0x76, 0x67, 0x85, 0x78, 0x99, 0x98, 0x66,
+    0x98, 0x77, 0x7a, 0xb8, 0x78, 0xbd, 0x89, 0xdc, 0xba, 0x8c, 0xea, 0x49, 0x81, 0x56, 0x67, 0x99,
+    0x55, 0xb9, 0xb8, 0x86, 0x78, 0x47, 0x33, 0x33, 0x43, 0x85, 0x49, 0xaa, 0x63, 0x26, 0x74, 0x7a,
+    0xab, 0xca, 0x8b, 0x61, 0x22, 0x75, 0x56, 0x85, 0x87, 0x6c, 0x98, 0x5b, 0x9a, 0xa7, 0x68, 0x68,
+    0x86, 0x69, 0x89, 0x6a, 0x78, 0x7b, 0x79, 0x88, 0xb9, 0x99, 0x97, 0x87, 0x7a, 0x88, 0x89, 0x69,
+    0x77, 0x89, 0xaa, 0x56, 0x7a, 0xa9, 0x87, 0x98, 0x99, 0x86, 0x76, 0x9a, 0x56, 0x98, 0x57, 0x65,
+    0x96, 0xa8, 0x79, 0x56, 0x8a, 0x86, 0x95, 0x55, 0x97, 0xbc, 0x9a, 0xb7, 0x93, 0x98, 0x79, 0xcd,
+    0xbb, 0x8b, 0x87, 0x98, 0x66, 0x98, 0x9a, 0x79, 0x7a, 0x76, 0x69, 0xbc, 0xf8, 0xee, 0xea, 0x6a,
+    0x96, 0x86, 0xa8, 0x87, 0x69, 0x88, 0xc8, 0xb6, 0x86, 0xa9, 0x97, 0xa9, 0x39, 0x85, 0xbb, 0x99,
+    0x78, 0x78, 0x97, 0x97, 0x7a, 0x87, 0x8a, 0x76, 0x7a, 0x98, 0x9a, 0x7a, 0x76, 0x7a, 0x68, 0x98,
+    0x88, 0x99, 0x99, 0x4a, 0x45, 0x47, 0x79, 0x95, 0x97, 0x38, 0x99, 0xb9, 0xbd, 0xdb, 0x87, 0x96,
+    0xac, 0x94, 0x7a, 0xb9, 0x69, 0x9b, 0x7d, 0xb9, 0x65, 0x17, 0x42, 0xeb, 0xdc, 0x9a, 0x9a, 0x98,
+    0x79, 0x65, 0xa8, 0x76, 0x3a, 0xa9, 0x57, 0x87, 0x96, 0xa8, 0x86, 0xaa, 0xba, 0xab, 0x8d, 0x4c,
+};
+
+static const float mnist_snn_layer2_codebook[16] = {
+    -0.548740506f, -0.411780566f, -0.326340675f, -0.259134382f,
+    -0.195488036f, -0.136457741f, -0.0789293572f, -0.0379607119f,
+    0.00465529272f, 0.0474284105f, 0.0876403749f, 0.1400989f,
+    0.200737089f, 0.262213081f, 0.339831173f, 0.506328464f,
+};
+
+static const uint8_t mnist_snn_layer4_indices[7840] = {
+    0xcc, 0xbb, 0xdc, 0xcc, 0xcb, 0xdd, 0xdd, 0xcc, 0xaa, 0xcb, 0xce, 0xcc, 0xcb, 0xdb, 0xec, 0xdd,
+    0xba, 0xcc, 0xed, 0xbd, 0xdb, 0xcc, 0x8a, 0xba, 0xcc, 0xaa, 0xcb, 0xcc, 0xcc, 0xbb, 0xcb, 0x8d,
+    0xcd, 0xed, 0xbc, 0xcb, 0xbc, 0xcc, 0x9d, 0xcc, 0xcc, 0xdc, 0xda, 0xbc, 0xcc, 0xcc, 0xcb, 0x9a,
+    0xb9, 0x8c, 0xbb, 0xbc, 0xbb, 0xdb, 0xdd, 0xdc, 0xcb, 0xca, 0xcb, 0xcd, 0xca, 0x9b, 0xeb, 0xab,
+    0xdc, 0x9b, 0xca, 0xbd, 0xbd, 0x9a, 0xcc, 0xac, 0xa9, 0xcc, 0xbb, 0xbb, 0xcb, 0xcc, 0xdd, 0xdd,
+    0x9c, 0xcc, 0xed, 0xcd, 0xdb, 0xbc, 0xde, 0xbc, 0xdd, 0xbb, 0xcc, 0xdb, 0xbd, 0xbc, 0xcc, 0xcd,
+    0xcd, 0xbb, 0xcc, 0xab, 0xcb, 0xcc, 0xac, 0xbb, 0xcc, 0xba, 0xba, 0xed, 0xdc, 0xab, 0xed, 0xcd,
+    0xdc, 0xab, 0xcc, 0xcc, 0xcc, 0xcb, 0xca, 0xc9, 0xdd, 0xbc, 0xcc, 0xba, 0xcd, 0xcb, 0x98, 0xdb,
+    0xde, 0x9b, 0xaa, 0xca, 0xbc, 0x9b, 0xcb, 0xcb, 0xdd, 0xab, 0xdd, 0x8b, 0xbc, 0xcd, 0xcb, 0xbb,
+    0xcb, 0xa9, 0xcb, 0xac, 0xbb, 0xcc, 0xab, 0xec, 0xed, 0xcc, 0xca, 0xcb, 0xcd, 0xcb, 0xac, 0xab,
+    0xdc, 0xc9, 0xcd, 0xab, 0xcb, 0xcc, 0xbc, 0x9a, 0xac, 0x7a, 0x97, 0xcc, 0xac, 0xac, 0xca, 0xbc,
+    0xbc, 0xdc, 0xaa, 0xbd, 0xcc, 0x9b, 0xcb, 0xac, 0xcb, 0xba, 0xbb, 0xdc, 0xae, 0xbb, 0xdd, 0xde,
+    0xcb, 0xb6, 0xca, 0xcc, 0xbb, 0xcc, 0xbc, 0x9a, 0xbb, 0xdd, 0xbc, 0xc9, 0xcd, 0xab, 0xaa, 0x9b,
+    0x9a, 0x99, 0x98, 0xca, 0x9d, 0x7b, 0xaa, 0xbb, 0x8b, 0xcc, 0xcb, 0xcc, 0xcc, 0xbc, 0xbb, 0xbc,
+    0xab, 0xcc, 0xcb, 0xbb, 0xbb, 0xbb, 0xaa, 0xbc, 0xba, 0xaa, 0xa8, 0xcb, 0xbd, 0x89, 0xdc, 0xcc,
+    0xdd, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xdd, 0xcc, 0xba, 0xba, 0xcc, 0xdc, 0xbc, 0xaa, 0xbc,
+    0xed, 0xab, 0xdb, 0xdc, 0xbd, 0xbc, 0xcd, 0xdb, 0xbd, 0xdd, 0xdc, 0xdd, 0xbc, 0xcc, 0xac, 0x9a,
+    0xc7, 0xbc, 0xbc, 0xbc, 0xaa, 0xcd, 0xcd, 0xcc, 0xda, 0xce, 0xda, 0xdd, 0xcd, 0xdb, 0xcd, 0xcd,
+    0xdb, 0xcc, 0xcd, 0xab, 0xa9, 0xca, 0xbc, 0xbb, 0xaa, 0xcb, 0xbc, 0xcc, 0xbc, 0xca, 0xdc, 0xdd,
+    0xad, 0xee, 0xcc, 0xdd, 0xdc, 0xbe, 0xdc, 0xad, 0xdd, 0xdd, 0xdd, 0xc9, 0xcc, 0xbc, 0xbb, 0x9a,
+    0xa9, 0xca, 0xcc, 0xbb, 0xbb, 0xdc, 0xbd, 0xee, 0xed, 0xde, 0xec, 0xce, 0xce, 0xcc, 0xde, 0xdb,
+    0xde, 0x9a, 0xca, 0xbc, 0x79, 0xb9, 0xcc, 0x9c, 0xaa, 0xac, 0xac, 0xbb, 0xab, 0xcc, 0xcc, 0xac,
+    0xee, 0xcc, 0xdd, 0xea, 0xce, 0xcc, 0xad, 0xdd, 0xcb, 0xdd, 0x99, 0xca, 0x9d, 0x98, 0xa9, 0xcc,
+    0xcc, 0xbe, 0xca, 0x99, 0xb9, 0xaa, 0xaa, 0xbb, 0xcc, 0xba, 0xba, 0xba, 0x9b, 0xaa, 0xab, 0xcb,
+    0xad, 0xdc, 0xec, 0xcc, 0x9a, 0xbc, 0xcc, 0x9c, 0xcc, 0xcc, 0xcc, 0xcc, 0xac, 0xbb, 0xac, 0xb7,
+    0xeb, 0xcd, 0xca, 0xbc, 0xcc, 0xac, 0xdb, 0xab, 0xcb, 0xcb, 0xdc, 0xcd, 0xcd, 0xdb, 0xdc, 0xcd,
+    0xca, 0x9b, 0xba, 0xcc, 0xbc, 0xcb, 0xcc, 0xcb, 0xbb, 0xec, 0xad, 0xcc, 0xbb, 0xcc, 0xbd, 0xcc,
+    0xbb, 0xcd, 0xcb, 0xcd, 0xcb, 0x9b, 0xcc, 0xcc, 0x9b, 0xac, 0xaa, 0xbb, 0xab, 0xbd, 0xbb, 0xac,
+    0xdb, 0xdc, 0xbd, 0xcb, 0xcc, 0xaa, 0xab, 0xbc, 0xcb, 0xdd, 0xb7, 0xca, 0xcd, 0x8d, 0x9c, 0xb9,
+    0xb9, 0xcc, 0x99, 0xc9, 0xcc, 0xab, 0xba, 0xdd, 0xcc, 0xbc, 0xec, 0xce, 0xdd, 0xec, 0xdd, 0xcc,
+    0xed, 0xbb, 0xcc, 0xcd, 0x9d, 0xa9, 0xbc, 0xac, 0xa9, 0xca, 0xac, 0xba, 0xcb, 0xac, 0xcb, 0xcc,
+    0xcc, 0xda, 0xcc, 0xed, 0xbc, 0xdd, 0xec, 0xbe, 0xdc, 0xbd, 0xec, 0xdb, 0xdd, 0xab, 0xcb, 0xcb,
+    0xac, 0xaa, 0xcc, 0xbb, 0xab, 0xca, 0xbc, 0xcc, 0xcd, 0xbc, 0xdc, 0xec, 0xdd, 0xdb, 0xcd, 0xed,
+    0xad, 0xed, 0xcc, 0xec, 0xca, 0xbd, 0xcb, 0xcd, 0x9d, 0xaa, 0xba, 0xcc, 0x8b, 0xba, 0xcc, 0xaa,
+    0xa9, 0xbb, 0xdc, 0xdd, 0xcc, 0xbb, 0xed, 0xcd, 0xcd, 0xdc, 0xcd, 0xce, 0xdc, 0xcb, 0xcd, 0xbd,
+    0x8c, 0xaa, 0xaa, 0xcc, 0xba, 0xaa, 0xba, 0xba, 0xcb, 0xcc, 0xdb, 0xcd, 0xdd, 0xbc, 0xdc, 0xbd,
+    0xdc, 0xcc, 0xdc, 0xdb, 0xcd, 0xcc, 0xdc, 0xdc, 0x9c, 0xbc, 0xbb, 0xcc, 0xbc, 0xab, 0xaa, 0xac,
+    0xcb, 0xdc, 0xac, 0xcb, 0xdd, 0xdb, 0xca, 0xcd, 0xeb, 0xbe, 0xcd, 0xcc, 0xdd, 0xbb, 0xbc, 0xcc,
+    0xcc, 0x9b, 0x9a, 0xba, 0xcc, 0xcc, 0xcc, 0xcc, 0xbb, 0xbb, 0xdc, 0xdc, 0xbd, 0xdb, 0xcf, 0xdd,
+    0xbd, 0xee, 0xec, 0xdc, 0xcc, 0xcd, 0xbc, 0x9d, 0xb8, 0xcc, 0xcc, 0x8b, 0xcc, 0xcc, 0xcc, 0xcc,
+    0xcc, 0xcc, 0xcc, 0xdd, 0xec, 0xcd, 0xcb, 0xcd, 0xcd, 0xbe, 0xcb, 0xcd, 0xcc, 0xba, 0xdd, 0xac,
+    0xbb, 0xcb, 0xcc, 0xab, 0xca, 0xbc, 0xaa, 0xaa, 0xca, 0xcb, 0xcb, 0xab, 0xbc, 0xcc, 0x9b, 0xbb,
+    0xcc, 0xbd, 0xcb, 0xcc, 0xac, 0xcb, 0xce, 0xbb, 0x99, 0xcb, 0xbc, 0x46, 0xca, 0xcc, 0xcc, 0xcc,
+    0xcc, 0xcc, 0x99, 0xbb, 0x8b, 0x9a, 0xba, 0xab, 0xab, 0xba, 0xcc, 0xbc, 0xac, 0xaa, 0xbc, 0xa9,
+    0xcd, 0xdb, 0xab, 0xdc, 0xcc, 0xbb, 0xc9, 0xab, 0x9a, 0xcb, 0xca, 0xcb, 0xab, 0xbb, 0xcd, 0xbd,
+    0xbd, 0xdd, 0xae, 0xde, 0xdb, 0xde, 0xed, 0xcc, 0xcd, 0xa9, 0xcb, 0xcc, 0xaa, 0xa9, 0xcc, 0xac,
+    0xac, 0xdc, 0xbc, 0xdc, 0xdd, 0xde, 0xca, 0xbb, 0xee, 0xdc, 0xcc, 0xcb, 0xcd, 0xdd, 0xcd, 0xcb,
+    0xcd, 0xdc, 0xbd, 0xbb, 0xac, 0xac, 0xab, 0xcc, 0x9c, 0xba, 0xca, 0xbc, 0xcb, 0xbc, 0xbb, 0xdc,
+    0xcc, 0xcb, 0xcb, 0xbb, 0xca, 0xbc, 0xcc, 0xcc, 0xbc, 0xdc, 0xdc, 0xdc, 0xc9, 0xcb, 0xdc, 0xcc,
+    0xcc, 0xbb, 0xba, 0xcc, 0xeb, 0xbd, 0xda, 0xbc, 0xa9, 0xd9, 0xcc, 0x1a, 0x99, 0xcb, 0x7c, 0x9a,
+    0xac, 0xcc, 0xab, 0xea, 0xcd, 0xcc, 0x9c, 0xca, 0xcc, 0xac, 0xcc, 0xab, 0x8c, 0xbd, 0xbb, 0xbc,
+    0xc7, 0xcd, 0xcd, 0x7c, 0xec, 0xbc, 0xb9, 0xcc, 0xdd, 0xcd, 0xdc, 0xde, 0xce, 0xcb, 0xc9, 0xab,
+    0xc9, 0xbc, 0xaa, 0xaa, 0xcb, 0xc7, 0xba, 0xcb, 0xbc, 0xdb, 0x9b, 0xc7, 0x99, 0xba, 0x95, 0xac,
+    0xad, 0xbd, 0xca, 0xa9, 0xcc, 0xad, 0xcc, 0xbc, 0xca, 0xcc, 0xac, 0xbb, 0xcc, 0xac, 0xee, 0xbb,
+    0xbc, 0xdb, 0xad, 0xbc, 0x4b, 0xcb, 0xab, 0x9a, 0xa9, 0xbc, 0xa9, 0xc8, 0xdb, 0xce, 0xcb, 0xcb,
+    0xbb, 0xcb, 0xcc, 0xbc, 0xcb, 0xcc, 0xbb, 0xba, 0xcb, 0xaa, 0xab, 0x89, 0xac, 0xc9, 0x8a, 0xc7,
+    0xaa, 0xcb, 0x84, 0x7c, 0xad, 0xbc, 0xcc, 0xba, 0xdc, 0x9c, 0xcc, 0xdc, 0xcb, 0xdc, 0xbb, 0xba,
+    0xaa, 0x7c, 0xac, 0xbb, 0x9b, 0xc8, 0xbb, 0x49, 0x7a, 0xdc, 0xbe, 0xcb, 0xbc, 0xdc, 0xbb, 0xdc,
+    0xdd, 0xcc, 0xcc, 0xbc, 0xba, 0xbb, 0xbc, 0xc9, 0xbb, 0xac, 0xaa, 0xdb, 0xcb, 0xc9, 0x9a, 0xcb,
+    0xa9, 0xa8, 0xcb, 0xce, 0xab, 0xbc, 0xec, 0x9c, 0xbc, 0xbb, 0xca, 0xcc, 0xbc, 0xcd, 0xba, 0x7c,
+    0xbc, 0xcb, 0xc8, 0xd8, 0xcb, 0x9b, 0x8c, 0xce, 0x69, 0xbb, 0xcd, 0xda, 0x8b, 0xdb, 0xac, 0xac,
+    0xcb, 0x89, 0xaa, 0xcc, 0xbc, 0xcb, 0xdb, 0x9c, 0xca, 0xca, 0xcc, 0xba, 0xab, 0x99, 0xb6, 0x9c,
+    0x99, 0x99, 0xd8, 0xcd, 0xdc, 0x98, 0xdb, 0xbb, 0xab, 0xcc, 0xcc, 0xcc, 0xcc, 0xbb, 0xab, 0xbc,
+    0x7c, 0xab, 0xca, 0xc9, 0xca, 0x9b, 0xc9, 0xbc, 0xa9, 0x9a, 0xca, 0xcb, 0xca, 0xad, 0xac, 0x98,
+    0xbb, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xbb, 0xbc, 0xcd, 0x9c, 0xad, 0xec, 0xca,
+    0xb9, 0xba, 0xbc, 0x7c, 0xdd, 0xac, 0xcb, 0xce, 0xcc, 0xcb, 0xcc, 0xab, 0xca, 0xcc, 0xbc, 0xab,
+    0xc9, 0x9c, 0xcb, 0xdc, 0xcc, 0xd5, 0xcc, 0xae, 0x5c, 0xcc, 0xab, 0xba, 0xcc, 0xbc, 0x98, 0xdc,
+    0xcd, 0x9b, 0xcb, 0xbb, 0x8b, 0xcc, 0xcc, 0xcb, 0xab, 0xcb, 0xcb, 0xdd, 0xdd, 0xb9, 0xdc, 0xcd,
+    0xbc, 0xcb, 0xde, 0xbc, 0xca, 0xec, 0xdc, 0x9b, 0xed, 0xce, 0xcd, 0xca, 0xcd, 0xcd, 0xc9, 0xeb,
+    0xbb, 0xcb, 0xeb, 0xee, 0xdb, 0xbd, 0xdb, 0xbb, 0xbc, 0xa6, 0xde, 0xbc, 0x9a, 0xeb, 0xbb, 0xbe,
+    0xdd, 0xbe, 0xbd, 0xcc, 0x9c, 0xba, 0xcc, 0xac, 0xcb, 0xbb, 0xdc, 0xe7, 0xde, 0xcb, 0x7d, 0xcc,
+    0xaa, 0xac, 0xc8, 0x8e, 0xca, 0xb6, 0xec, 0xd8, 0xae, 0xdc, 0xed, 0xce, 0xcc, 0xba, 0xc9, 0xcc,
+    0xcc, 0xcc, 0xcc, 0xbc, 0xaa, 0xaa, 0x8a, 0xc9, 0xbb, 0xab, 0x9a, 0xac, 0xbc, 0x9c, 0xdc, 0xba,
+    0x8c, 0xeb, 0xde, 0xde, 0xba, 0xbc, 0xcb, 0xba, 0xcc, 0xcc, 0xcc, 0xcc, 0xac, 0x99, 0xbb, 0xb9,
+    0xad, 0xca, 0xab, 0xd9, 0xbc, 0x9b, 0xaa, 0xbb, 0x7c, 0x78, 0xbd, 0xed, 0x9e, 0xca, 0xdd, 0xbd,
+    0xcb, 0xbc, 0xbb, 0xcc, 0xbb, 0xbc, 0xaa, 0x8a, 0xdc, 0xac, 0xbc, 0xba, 0xcb, 0xca, 0x98, 0xbc,
+    0xbb, 0x8b, 0xd9, 0xdd, 0xde, 0xab, 0xcc, 0xcc, 0xbb, 0xbc, 0xaa, 0xab, 0xcb, 0xc5, 0xbb, 0xac,
+    0x5a, 0xcb, 0xbd, 0xc8, 0xe9, 0x9a, 0xa4, 0xca, 0xad, 0xed, 0xb8, 0xdd, 0xbc, 0xac, 0xbc, 0xa9,
+    0xcb, 0xcc, 0xcc, 0xcb, 0xcc, 0xdc, 0xce, 0xca, 0xac, 0xd9, 0x9b, 0xcb, 0x89, 0xed, 0xb9, 0x8c,
+    0xca, 0x9e, 0xce, 0xdc, 0xdc, 0xcd, 0xbc, 0xbd, 0xab, 0xcc, 0xcc, 0xbb, 0xcb, 0xcc, 0xea, 0xde,
+    0xcb, 0xcc, 0xdc, 0x9b, 0xbc, 0xb5, 0xce, 0xc8, 0xb9, 0xeb, 0xdc, 0x8d, 0xbb, 0xde, 0xcc, 0xcb,
+    0xbb, 0xbb, 0xcc, 0xbc, 0xac, 0xca, 0xbc, 0xee, 0xde, 0xcb, 0xcb, 0xdd, 0xbc, 0x7c, 0xea, 0xbd,
+    0xc8, 0xb8, 0xce, 0xd8, 0xbc, 0xed, 0xbc, 0xcd, 0xcd, 0xcb, 0xcb, 0xcc, 0xcc, 0xba, 0xcc, 0xcb,
+    0xcd, 0xac, 0x9c, 0xdc, 0xdc, 0xca, 0xe7, 0xce, 0xa8, 0xbc, 0xde, 0x9a, 0xc9, 0xee, 0xab, 0xda,
+    0xbc, 0xcb, 0xbb, 0xcc, 0xaa, 0xab, 0xcb, 0xc9, 0xcc, 0xdd, 0x8a, 0xcc, 0xdd, 0xad, 0xc9, 0xed,
+    0xcc, 0x69, 0xdd, 0xce, 0xbc, 0xeb, 0xce, 0xbe, 0xbb, 0xbc, 0xcb, 0xca, 0xac, 0xba, 0xba, 0xbb,
+    0xda, 0xde, 0xad, 0xcb, 0xdc, 0xdd, 0x9b, 0xdb, 0xce, 0xb7, 0xd7, 0xdc, 0xab, 0xbc, 0xdd, 0xbd,
+    0xcb, 0xab, 0xca, 0xc8, 0xcc, 0xcc, 0xcc, 0xcc, 0xec, 0xcd, 0xcd, 0xbc, 0xd9, 0x6b, 0xcb, 0xaa,
+    0xdd, 0xba, 0x9c, 0xcb, 0x7e, 0xcd, 0xdc, 0xeb, 0xcc, 0xcc, 0xcc, 0xdd, 0xcc, 0xcc, 0xbc, 0xcc,
+    0xcc, 0xac, 0xaa, 0xcb, 0x9c, 0xa9, 0xda, 0xcc, 0x89, 0xba, 0xcd, 0x7c, 0xa9, 0x7a, 0xcc, 0xab,
+    0xdb, 0xcb, 0xbc, 0xaa, 0xca, 0xcc, 0xcb, 0xbc, 0xcd, 0xac, 0xec, 0xde, 0xbc, 0xa9, 0xce, 0xcb,
+    0xb9, 0xbb, 0xb7, 0x7c, 0xbb, 0xcb, 0xed, 0xbc, 0xcc, 0xce, 0xbc, 0x88, 0xca, 0xcc, 0xcc, 0xcc,
+    0xcc, 0xcc, 0xb9, 0xbb, 0xaa, 0x6c, 0xab, 0xa9, 0xcb, 0xaa, 0xaa, 0xae, 0x9c, 0x99, 0x8b, 0xc9,
+    0xcc, 0xdc, 0x9d, 0xcc, 0xdb, 0xde, 0xcb, 0xac, 0xab, 0xcb, 0x8c, 0xec, 0xce, 0xdc, 0xc3, 0xee,
+    0xca, 0xba, 0xee, 0x6b, 0x8c, 0xde, 0x5e, 0xcb, 0xea, 0xcd, 0xb7, 0xcc, 0xab, 0xab, 0xcc, 0xcc,
+    0xca, 0xba, 0xcc, 0xda, 0xbd, 0xcc, 0xab, 0xcd, 0xdb, 0xcb, 0x95, 0xab, 0xc8, 0x9a, 0xca, 0x9e,
+    0xac, 0xa9, 0xec, 0xcb, 0xbc, 0xab, 0xca, 0xcc, 0xbc, 0xbc, 0xcb, 0x9c, 0xbb, 0xcb, 0xbc, 0xba,
+    0xba, 0xac, 0xbc, 0xbc, 0xdb, 0xcb, 0xcc, 0xca, 0x9c, 0xdc, 0xdd, 0xcc, 0xcb, 0xbb, 0xab, 0xcc,
+    0xdc, 0xdc, 0xbd, 0xcd, 0xbc, 0xcc, 0x8c, 0xac, 0xba, 0xcc, 0xca, 0xab, 0xbb, 0xdc, 0xce, 0xdc,
+    0xee, 0xcd, 0xcd, 0xed, 0xcc, 0xcc, 0xab, 0xba, 0xcc, 0xcc, 0xbc, 0xbc, 0xdb, 0xcc, 0xcc, 0xba,
+    0xdd, 0xcd, 0xcc, 0xca, 0xcc, 0xcb, 0xde, 0xcc, 0xcc, 0xcd, 0xdd, 0xcd, 0xcd, 0xcc, 0xab, 0xdb,
+    0xab, 0xbc, 0xdc, 0xcd, 0xab, 0xcb, 0xcc, 0xbc, 0xca, 0xcd, 0xce, 0xca, 0xce, 0xbe, 0xdc, 0xaa,
+    0xcb, 0xdd, 0xcc, 0xba, 0xed, 0xcc, 0xcc, 0xae, 0x9d, 0xcc, 0xec, 0xdc, 0xcd, 0xab, 0xcc, 0xcd,
+    0xcc, 0xcb, 0xdd, 0xcc, 0xaa, 0xcc, 0xbc, 0xdb, 0xdc, 0xcc, 0xcc, 0xcc, 0xdd, 0xdd, 0xbc, 0xcb,
+    0xdc, 0xcc, 0xcc, 0xbb, 0xca, 0xcc, 0xdb, 0xed, 0xce, 0xbc, 0xdc, 0xcd, 0xcc, 0xcc, 0xbc, 0xca,
+    0xcc, 0xba, 0xdb, 0xed, 0xcc, 0xed, 0xee, 0xbd, 0xdc, 0xcc, 0xcc, 0xdb, 0xdd, 0xdc, 0xcb, 0xdd,
+    0xbc, 0xda, 0xec, 0xdd, 0xbc, 0xcc, 0xcc, 0xad, 0xcb, 0xac, 0xba, 0xda, 0xdc, 0xac, 0xdc, 0xcc,
+    0xbb, 0xba, 0xcd, 0xcc, 0xdd, 0xed, 0xcb, 0xcc, 0xdd, 0xac, 0xba, 0xcc, 0xcc, 0xda, 0xcc, 0xbe,
+    0xcd, 0xbb, 0xdb, 0xee, 0xac, 0xbb, 0xed, 0xde, 0xac, 0xea, 0x9e, 0xcc, 0xcd, 0xac, 0xcb, 0xbb,
+    0xdd, 0xbc, 0xb7, 0xcd, 0xbb, 0xab, 0xcc, 0xbc, 0xcc, 0xdd, 0xde, 0xcd, 0xed, 0xed, 0xcb, 0xbb,
+    0xce, 0x86, 0xbb, 0xcb, 0xcb, 0xcd, 0xbc, 0xc9, 0xcb, 0xbc, 0x9c, 0xea, 0xde, 0xba, 0xbc, 0xee,
+    0xde, 0xed, 0xbb, 0xbc, 0xee, 0x7e, 0x99, 0xeb, 0xee, 0xbc, 0xaa, 0xde, 0xcc, 0xca, 0xdc, 0x9c,
+    0xba, 0xcc, 0xbb, 0xa6, 0xed, 0xad, 0xcb, 0xdb, 0xce, 0xbb, 0x9c, 0xbc, 0xeb, 0xfe, 0x9c, 0xcc,
+    0xee, 0xce, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xbc, 0xcc, 0xbc, 0xab, 0xbb, 0xbc, 0xbc, 0xcb, 0xbb,
+    0xac, 0xbb, 0xcd, 0xdd, 0xdd, 0xec, 0xdc, 0xdd, 0xdd, 0xdb, 0xbc, 0xbb, 0xcb, 0xcc, 0xcc, 0xbb,
+    0xc9, 0xdc, 0xdc, 0xbc, 0xcb, 0xcc, 0xbb, 0xbc, 0xbc, 0xbd, 0xdd, 0xdd, 0xed, 0xdd, 0xdc, 0xdd,
+    0xcd, 0xbc, 0xbd, 0x9a, 0xaa, 0xcb, 0xdc, 0xcc, 0xab, 0xce, 0xdc, 0xdc, 0xcd, 0xdd, 0xcc, 0xcd,
+    0xbb, 0xcc, 0xcc, 0xdc, 0xdc, 0xdd, 0xdd, 0xbe, 0xdd, 0xdd, 0xee, 0xcc, 0xbb, 0xdc, 0xbd, 0xdb,
+    0xae, 0xcc, 0xbb, 0xba, 0xba, 0xbc, 0xab, 0xce, 0xab, 0xaa, 0xca, 0xcc, 0xcb, 0xcd, 0xdb, 0xab,
+    0xdc, 0xbb, 0xbc, 0xcb, 0x9a, 0x9a, 0xcb, 0xcd, 0xcc, 0xbb, 0xcd, 0xca, 0xbb, 0xcb, 0xcd, 0xdc,
+    0xdd, 0xcb, 0xab, 0xcb, 0xcb, 0xcc, 0xbc, 0xbc, 0xdb, 0xcd, 0xba, 0xcd, 0x9c, 0x99, 0xc9, 0xcc,
+    0xec, 0xbb, 0xba, 0xcc, 0xcd, 0xab, 0xc8, 0xed, 0xcd, 0x8a, 0xed, 0xbd, 0xdb, 0xde, 0xcc, 0xdc,
+    0xee, 0xcd, 0xdd, 0xdd, 0x9e, 0xca, 0xcc, 0xec, 0xcc, 0xdd, 0xcc, 0xbc, 0xdb, 0xcd, 0x8c, 0xcb,
+    0xed, 0xcd, 0xa7, 0xcc, 0xbc, 0xcc, 0xcd, 0xbc, 0xed, 0xcd, 0xdd, 0xed, 0xee, 0xdb, 0xcc, 0xcd,
+    0xcc, 0xdd, 0xde, 0xcc, 0xcc, 0xdd, 0xdd, 0xc8, 0xcc, 0xcd, 0x9c, 0xcb, 0xbb, 0xcb, 0xdd, 0xcd,
+    0xcc, 0xdd, 0xdc, 0xcc, 0xee, 0xad, 0xcc, 0xdc, 0xdc, 0xbc, 0xcc, 0xcc, 0xcb, 0xcb, 0xcc, 0x5c,
+    0xcb, 0xbc, 0xbb, 0xca, 0xdd, 0xdd, 0xdc, 0xcc, 0xcc, 0xed, 0xde, 0xbc, 0xdc, 0xed, 0x9c, 0xc9,
+    0xde, 0xcc, 0xeb, 0xce, 0xcc, 0xcb, 0xdc, 0xcd, 0xcc, 0xab, 0xed, 0xcb, 0xaa, 0xc9, 0xab, 0xcc,
+    0xcd, 0xba, 0xcc, 0xcb, 0xcc, 0xcd, 0xcc, 0xba, 0xaa, 0xcc, 0xbc, 0xcb, 0xcc, 0xdc, 0xcb, 0xcc,
+    0xcd, 0xac, 0xcc, 0xcd, 0xbc, 0xba, 0xcc, 0xbb, 0xcc, 0xbc, 0xaa, 0xde, 0xdc, 0xcb, 0xed, 0xcc,
+    0xcd, 0xbc, 0xcc, 0xda, 0xbb, 0xdb, 0xbc, 0xcc, 0xcd, 0xbe, 0xba, 0xdc, 0xcd, 0xaa, 0xb9, 0xdc,
+    0xdb, 0xcb, 0xcc, 0xab, 0xbc, 0xbc, 0xbb, 0xcc, 0x9a, 0xb9, 0xdb, 0xdc, 0x99, 0x9a, 0xcc, 0xcc,
+    0xbb, 0xcb, 0xcc, 0xcc, 0xcc, 0xba, 0xaa, 0xdb, 0xec, 0xcc, 0xdc, 0xcc, 0xed, 0xdc, 0xbc, 0xbb,
+    0x9c, 0x9a, 0xaa, 0xcc, 0xdc, 0xcc, 0xcc, 0xdb, 0xcd, 0xcc, 0xcc, 0xbd, 0xcc, 0xcc, 0xdd, 0xcc,
+    0xdc, 0xde, 0xdd, 0xdd, 0xee, 0xdd, 0xcc, 0xdd, 0xad, 0xcb, 0xdc, 0xdd, 0xcc, 0xab, 0xba, 0xcb,
+    0xdd, 0xcd, 0xdb, 0xcc, 0xcc, 0xdc, 0xce, 0xdd, 0xdd, 0xed, 0xed, 0xde, 0xcc, 0xee, 0xcd, 0xbb,
+    0xca, 0x9a, 0x99, 0xaa, 0xcc, 0xbc, 0xcc, 0xcc, 0xbb, 0xdc, 0xcc, 0xac, 0x9a, 0xec, 0xcb, 0xa9,
+    0xda, 0x9c, 0xbc, 0xbd, 0xab, 0xcc, 0xbb, 0xbb, 0xeb, 0xcc, 0xcb, 0xba, 0xcd, 0xcc, 0xcc, 0xdd,
+    0xcc, 0xdc, 0xcd, 0xbc, 0xcc, 0xbc, 0xbb, 0xba, 0xcd, 0xac, 0xcc, 0xed, 0xde, 0xdd, 0xcd, 0xde,
+    0xed, 0xdb, 0xbc, 0xab, 0xcc, 0xcc, 0xbb, 0xab, 0xcd, 0xcc, 0xbc, 0xa9, 0xbc, 0xbc, 0xbc, 0xbd,
+    0xdd, 0xbc, 0xed, 0xdc, 0xdd, 0xad, 0xcc, 0xdd, 0xbb, 0xbb, 0xbc, 0x56, 0xb7, 0xcc, 0xcc, 0xcd,
+    0xcc, 0xcc, 0xdd, 0xbc, 0x8a, 0xba, 0xab, 0xab, 0xa6, 0xbc, 0xac, 0xdd, 0xbc, 0xdc, 0xed, 0xbd,
+    0xbc, 0xec, 0xee, 0xcb, 0xbc, 0xcd, 0xcc, 0xaa, 0xa9, 0xc9, 0xcb, 0xac, 0xaa, 0xcb, 0xbc, 0xdb,
+    0xbd, 0xac, 0xdb, 0xdd, 0xcc, 0xdc, 0xcd, 0xdc, 0xcc, 0xba, 0xbb, 0xcc, 0x9a, 0xa9, 0xcb, 0xcc,
+    0xde, 0xbc, 0xdc, 0xcc, 0xdd, 0xbc, 0xac, 0xcc, 0xbd, 0xba, 0xba, 0xcc, 0xdc, 0xdb, 0xec, 0xcd,
+    0xcd, 0xdc, 0xee, 0xed, 0xbc, 0xcb, 0xaa, 0xcc, 0xed, 0xcc, 0xcb, 0xcc, 0xcc, 0xcc, 0xbc, 0xbb,
+    0xbc, 0xbb, 0xda, 0xcd, 0xcb, 0xdc, 0xdd, 0xcc, 0xdc, 0xbc, 0xcc, 0xdc, 0xbd, 0xbb, 0xdc, 0xdd,
+    0xcc, 0xcc, 0xbb, 0xcc, 0xdb, 0xbb, 0xac, 0xbc, 0xaa, 0xee, 0xca, 0xaa, 0xec, 0xac, 0xcd, 0xcb,
+    0xac, 0xe9, 0xcc, 0xbb, 0xcb, 0xec, 0xab, 0xac, 0xcc, 0xcb, 0xbd, 0x9b, 0xdd, 0xdc, 0xbc, 0xab,
+    0xcc, 0xcc, 0xbc, 0xc9, 0xdd, 0xcc, 0xcb, 0xcd, 0xcc, 0xbc, 0xdb, 0xdd, 0xcd, 0xcc, 0xdd, 0xdc,
+    0xad, 0xdc, 0xbc, 0xdc, 0xaa, 0xdc, 0xdd, 0xbc, 0xba, 0xdb, 0xcc, 0xc8, 0xbc, 0xda, 0xbd, 0xce,
+    0xcd, 0xcb, 0xec, 0xcc, 0xac, 0x8a, 0xcc, 0xbd, 0x97, 0xcc, 0xbe, 0xcb, 0xcb, 0xbc, 0xdc, 0xdd,
+    0xbb, 0xcc, 0xcd, 0xcc, 0xbd, 0xdc, 0xcd, 0xdb, 0xcc, 0xdd, 0xde, 0xdd, 0xdd, 0xcc, 0xea, 0xdd,
+    0xcc, 0xbb, 0xcc, 0x9b, 0xcc, 0xcc, 0xee, 0xee, 0xcc, 0xdb, 0xee, 0xbd, 0xcc, 0xbb, 0xcd, 0xcc,
+    0xce, 0xee, 0xde, 0xdc, 0xdc, 0xad, 0xcb, 0xbc, 0xcc, 0xbb, 0xcc, 0xcc, 0xcc, 0xdc, 0xcd, 0xdc,
+    0xdc, 0xc9, 0xcb, 0xab, 0xcb, 0xdb, 0xce, 0xdc, 0xcd, 0xeb, 0xdd, 0xac, 0xbd, 0xcc, 0xac, 0xca,
+    0xcb, 0xcc, 0xcb, 0xdc, 0xcb, 0xdd, 0xbc, 0xdc, 0xcd, 0xbc, 0xbb, 0xbb, 0xdc, 0xd6, 0xbd, 0xdc,
+    0xcd, 0xee, 0xdd, 0xcb, 0xdb, 0xbd, 0xcc, 0x9b, 0xec, 0xbe, 0xaa, 0xcc, 0xcc, 0xbd, 0xbb, 0xbe,
+    0xbc, 0xaa, 0xc7, 0xdd, 0xee, 0x9c, 0xaa, 0xed, 0xbd, 0xb8, 0xaa, 0xdc, 0x7b, 0xbb, 0xde, 0xed,
+    0xca, 0xdd, 0xee, 0xce, 0xdc, 0xcc, 0xdc, 0xd8, 0xdc, 0xcc, 0xac, 0xdb, 0xce, 0xcb, 0xe9, 0xbd,
+    0xcb, 0xac, 0xed, 0xde, 0xac, 0xe9, 0xce, 0xbc, 0xa9, 0xdc, 0xed, 0xbb, 0xcc, 0xcc, 0xcc, 0x9c,
+    0xca, 0xcc, 0xdc, 0xb8, 0xdd, 0xbc, 0xba, 0xce, 0xbb, 0xcd, 0xf9, 0xcc, 0xbb, 0x78, 0xee, 0xdb,
+    0xac, 0xcb, 0xbc, 0xcc, 0xcc, 0xcc, 0xcd, 0xcd, 0xcc, 0xbb, 0xba, 0xad, 0xdc, 0xbc, 0xde, 0xab,
+    0xac, 0xdd, 0xac, 0xac, 0xab, 0xbb, 0xcc, 0xbc, 0xcc, 0xbc, 0xed, 0xcd, 0xcc, 0xcc, 0xac, 0xca,
+    0xc7, 0xcd, 0xbb, 0xbb, 0xba, 0xbc, 0xed, 0x9d, 0xab, 0xeb, 0xce, 0xb9, 0xaa, 0xcb, 0xbc, 0xba,
+    0xdb, 0xdd, 0xdb, 0xcb, 0xee, 0xce, 0xcc, 0xbb, 0xaa, 0xda, 0xdd, 0xdd, 0xcc, 0xdc, 0xdc, 0xcd,
+    0xca, 0xcc, 0xde, 0xcd, 0xcc, 0xcb, 0xcd, 0xcd, 0xcd, 0xdc, 0xcc, 0xce, 0xdd, 0xed, 0xbb, 0x98,
+    0x9a, 0xca, 0xab, 0xaa, 0xd9, 0xbd, 0xbb, 0xba, 0xbb, 0xbb, 0xbc, 0xaa, 0xda, 0xab, 0xda, 0xcb,
+    0xbb, 0xa9, 0xcb, 0xbc, 0x9a, 0xaa, 0xcc, 0xcb, 0xcb, 0x9b, 0xbc, 0xac, 0xbc, 0xc7, 0xac, 0xbb,
+    0x7b, 0xbc, 0xca, 0xbc, 0xca, 0xcc, 0xbc, 0xdb, 0xbb, 0xbb, 0xca, 0xcc, 0xac, 0x99, 0xbd, 0xcc,
+    0xbc, 0xab, 0xca, 0xdd, 0xbc, 0x9a, 0xc9, 0xee, 0xac, 0x9a, 0xec, 0xde, 0xbe, 0xb9, 0xeb, 0xbd,
+    0x9a, 0xca, 0xdc, 0xcd, 0xe9, 0xdd, 0xcd, 0x9d, 0xcc, 0xcc, 0xcc, 0xcc, 0xdc, 0xbc, 0x7a, 0xcd,
+    0xcc, 0xab, 0xda, 0xcc, 0xdc, 0x8c, 0xbe, 0xdc, 0xbd, 0xca, 0xcc, 0xbd, 0xab, 0xdf, 0xdd, 0xdd,
+    0xc9, 0xbb, 0xbb, 0xcc, 0xdd, 0xed, 0xbc, 0xc9, 0xdc, 0xcd, 0x9b, 0xcc, 0xdc, 0xcd, 0xda, 0xec,
+    0xcd, 0xbc, 0xdc, 0xdd, 0xbc, 0xdb, 0xdd, 0xdd, 0x8c, 0xcc, 0xcb, 0xcc, 0xca, 0xcd, 0xbd, 0x7c,
+    0xcb, 0xdd, 0xcb, 0xa7, 0xcc, 0xcc, 0x9c, 0xcd, 0xcc, 0xbc, 0xd9, 0xcc, 0xdc, 0x7a, 0xdc, 0xde,
+    0xcc, 0xcc, 0xab, 0xca, 0xcc, 0xbb, 0xcb, 0xbb, 0xcc, 0xbb, 0xaa, 0xc7, 0xaa, 0xdb, 0xbb, 0xdc,
+    0xbc, 0xcb, 0xcc, 0xdc, 0xab, 0x9b, 0xdc, 0xbb, 0xa9, 0xcb, 0xcc, 0xba, 0xca, 0xcc, 0xcb, 0xdd,
+    0xcd, 0xbc, 0xcc, 0xdc, 0xcc, 0xaa, 0xcc, 0xcc, 0xcd, 0xdd, 0xee, 0xcb, 0xcc, 0xcc, 0xcc, 0xcd,
+    0xbc, 0xab, 0xcc, 0xbb, 0xba, 0xbb, 0xdc, 0xdb, 0xdd, 0xbc, 0xbb, 0xdd, 0xdd, 0xbd, 0xcb, 0xcc,
+    0xec, 0xbe, 0xcb, 0xee, 0xdf, 0xbb, 0xdc, 0xdd, 0xad, 0xba, 0xbd, 0xcc, 0x59, 0x98, 0xcc, 0xbc,
+    0xcb, 0x7b, 0xdc, 0xee, 0xed, 0xb9, 0xbc, 0xdb, 0xac, 0xac, 0xb9, 0xdc, 0xcb, 0xaa, 0xcd, 0xbd,
+    0x8c, 0xca, 0xdc, 0xcc, 0xbb, 0xcc, 0xba, 0xde, 0xdd, 0xcb, 0xd9, 0xcc, 0xcd, 0xab, 0xcc, 0xed,
+    0xcd, 0xca, 0xcc, 0xcd, 0xbc, 0xdc, 0xdc, 0xdd, 0xdb, 0xdd, 0xed, 0xcd, 0xbc, 0xbb, 0xab, 0xcb,
+    0xcc, 0xcc, 0x7c, 0xcc, 0xed, 0xee, 0xba, 0xdc, 0xdc, 0x8a, 0xab, 0xbb, 0xdd, 0xa9, 0xdc, 0xcd,
+    0xcd, 0xbc, 0xdd, 0xbe, 0xcc, 0xcc, 0xcc, 0xcc, 0xaa, 0xbc, 0xc9, 0xcc, 0xbc, 0xab, 0xc8, 0xbb,
+    0xba, 0x8a, 0xdc, 0xcb, 0xac, 0xcb, 0xcc, 0xbb, 0xbd, 0xec, 0xbb, 0x9b, 0xcb, 0xcc, 0xcc, 0xcb,
+    0xcc, 0xbb, 0xcb, 0xbc, 0xbc, 0xac, 0xeb, 0xba, 0xba, 0xec, 0xbe, 0xcd, 0xbb, 0xac, 0xcb, 0xbb,
+    0xbb, 0xcb, 0xcd, 0xbb, 0xcb, 0xbc, 0xbc, 0xad, 0xc9, 0xcb, 0xab, 0x7a, 0xdc, 0xbb, 0xab, 0xca,
+    0xbc, 0xdc, 0xa9, 0xbc, 0xbb, 0xcb, 0xcb, 0xac, 0xcc, 0xcb, 0xcc, 0xb8, 0xbb, 0xcc, 0xcc, 0xcc,
+    0xcc, 0xcc, 0xbd, 0xaa, 0x8a, 0xc9, 0xbb, 0xaa, 0x99, 0xba, 0xdc, 0xbb, 0x9c, 0xcb, 0x9d, 0xea,
+    0xdc, 0xac, 0x9a, 0xce, 0xcc, 0xcc, 0xc8, 0x79, 0x79, 0xc8, 0xbd, 0xaa, 0x7a, 0xcc, 0xab, 0xcb,
+    0xcb, 0xba, 0xab, 0xaa, 0xbc, 0x9a, 0xbb, 0xcc, 0xab, 0xba, 0xdc, 0xcc, 0xa8, 0xcc, 0xcb, 0xec,
+    0xbb, 0xdc, 0xcc, 0xcc, 0xcd, 0xbe, 0xa9, 0xba, 0xcc, 0xdb, 0xbc, 0xdd, 0xad, 0xdd, 0xdc, 0xec,
+    0xdb, 0xbc, 0xcc, 0xbb, 0xed, 0xcc, 0xbc, 0xcc, 0xcc, 0xdd, 0xca, 0xdd, 0xdd, 0xbc, 0xcb, 0xdc,
+    0xcd, 0x9b, 0xbb, 0xcc, 0xbd, 0xcb, 0xbc, 0xdc, 0x9b, 0xdd, 0xcd, 0xcc, 0xb8, 0xdd, 0xcc, 0xcc,
+    0xcc, 0xbb, 0xb9, 0xcc, 0xcc, 0xcb, 0xba, 0xbc, 0xdd, 0xed, 0xec, 0xcd, 0xdd, 0xcd, 0xbc, 0xcd,
+    0xbb, 0xcb, 0x96, 0xbb, 0xcd, 0xcc, 0xbb, 0xab, 0xcc, 0xab, 0xab, 0xba, 0xdc, 0xbd, 0xcb, 0xcb,
+    0xcb, 0xcb, 0xbb, 0xeb, 0xed, 0xdd, 0xcc, 0xcd, 0xdc, 0xcd, 0xab, 0xcb, 0xdd, 0xcc, 0xca, 0xbb,
+    0xcb, 0xbc, 0x89, 0xa9, 0xcb, 0xbb, 0xba, 0xbc, 0xbb, 0xbc, 0xdb, 0xcb, 0xcb, 0xbd, 0xbd, 0x9c,
+    0xcd, 0xcc, 0xcb, 0x07, 0xb9, 0xcd, 0xcc, 0xcc, 0xaa, 0xcc, 0x8a, 0x8a, 0xcc, 0xcb, 0xec, 0xcc,
+    0xdb, 0xee, 0xcb, 0xbb, 0xec, 0xde, 0xbd, 0xbb, 0xde, 0xdd, 0xbd, 0xa8, 0xcc, 0xdd, 0xcb, 0xca,
+    0xcb, 0xcc, 0xcc, 0x9a, 0xcb, 0xcc, 0xdb, 0xad, 0xcb, 0xcb, 0xad, 0x9a, 0xdc, 0xcd, 0xac, 0xca,
+    0xcd, 0xce, 0xbb, 0xac, 0xcc, 0xcc, 0xcc, 0xaa, 0xcb, 0xcc, 0xcc, 0xbb, 0xca, 0xca, 0xcb, 0xac,
+    0xbb, 0xcc, 0xcc, 0xae, 0xaa, 0xdc, 0xcc, 0xaa, 0xdc, 0xbc, 0x9b, 0xab, 0xbd, 0xda, 0xdd, 0xad,
+    0xdc, 0xcc, 0xcc, 0xbd, 0xbb, 0xbb, 0xcb, 0xce, 0xbb, 0xdc, 0xcc, 0xbd, 0xbc, 0xbb, 0xdd, 0xdd,
+    0xcd, 0xb8, 0xbd, 0xcd, 0xaa, 0xa8, 0xcc, 0xcc, 0xbc, 0xbb, 0xbb, 0xcc, 0xac, 0x68, 0xb8, 0xac,
+    0xba, 0xcb, 0xcc, 0xbb, 0xcb, 0xbd, 0xdc, 0xad, 0xdc, 0xdc, 0xac, 0xbd, 0xbc, 0xba, 0xbc, 0xa9,
+    0xcc, 0xaa, 0x98, 0xcb, 0xbd, 0xab, 0xcb, 0xcd, 0xcc, 0xcb, 0xdc, 0xbc, 0xbb, 0xba, 0xbb, 0xb9,
+    0xad, 0xbc, 0x97, 0xeb, 0xcb, 0xaa, 0x43, 0xb7, 0xcc, 0xcc, 0xbb, 0xcb, 0xcc, 0xbc, 0xaa, 0xbb,
+    0xcd, 0xaa, 0xba, 0xcd, 0xbb, 0xac, 0xba, 0xbc, 0xcc, 0xda, 0xcb, 0xbc, 0xdc, 0xcc, 0x9c, 0xa5,
+    0xed, 0xcd, 0xcc, 0xcc, 0xcc, 0xcc, 0xab, 0xcb, 0xcc, 0xbb, 0xbb, 0xdc, 0xbc, 0xcb, 0xec, 0xcd,
+    0xdd, 0xdc, 0xdd, 0xbd, 0xcb, 0xee, 0xcc, 0xbb, 0xdd, 0xcc, 0xbc, 0xab, 0xdb, 0xcc, 0xbc, 0x9b,
+    0xba, 0xbc, 0xcb, 0xdc, 0xcd, 0xcc, 0xdc, 0xde, 0xdd, 0xbd, 0xcc, 0xbb, 0xcd, 0xdc, 0xac, 0xbb,
+    0xdc, 0xdc, 0xcb, 0xbc, 0xbc, 0xcc, 0xbc, 0xaa, 0xaa, 0xcb, 0xcd, 0xbc, 0xcc, 0xcc, 0xcd, 0xdc,
+    0xbd, 0xee, 0xdc, 0xbd, 0xdd, 0xdd, 0xed, 0xcd, 0xdd, 0xcc, 0xcd, 0xba, 0xcc, 0xcc, 0xac, 0xaa,
+    0xca, 0xca, 0xcc, 0xed, 0xce, 0xec, 0xce, 0xde, 0xcc, 0xbc, 0xea, 0xbc, 0xdb, 0xcb, 0xcc, 0xab,
+    0xca, 0xcd, 0xdd, 0xbc, 0xbd, 0xbb, 0xcc, 0xac, 0xa9, 0xdb, 0xcc, 0xed, 0xed, 0xce, 0xdd, 0xdd,
+    0xee, 0xdb, 0xcd, 0xdb, 0xcc, 0xdb, 0xcb, 0xcc, 0xab, 0xca, 0xdd, 0xbb, 0xbc, 0xbc, 0xbb, 0xcc,
+    0xcc, 0xbb, 0xcb, 0xab, 0xaa, 0xba, 0xab, 0x9a, 0xbb, 0xcc, 0xdb, 0xcc, 0xec, 0xcd, 0xde, 0xee,
+    0xcd, 0xcc, 0xbc, 0xcb, 0xba, 0xcd, 0xbc, 0xbc, 0xcc, 0xcc, 0xcc, 0xcc, 0x9b, 0x9a, 0xad, 0xbc,
+    0xa9, 0xda, 0xcb, 0xed, 0xcd, 0xed, 0xdd, 0xdd, 0xde, 0x9b, 0xcd, 0xcb, 0xbc, 0xaa, 0xcc, 0xcd,
+    0xcc, 0xbb, 0xb9, 0xcc, 0xcc, 0xcd, 0xda, 0xbb, 0xbb, 0xba, 0xcb, 0xdc, 0xcd, 0xcc, 0xdd, 0xdd,
+    0xed, 0xcd, 0xbb, 0xcb, 0xdd, 0xbb, 0xdb, 0xdc, 0xcc, 0xbc, 0x9a, 0xa9, 0xca, 0xcd, 0xbb, 0xbb,
+    0xbb, 0xbc, 0xab, 0xcb, 0xbc, 0xce, 0xdc, 0xcc, 0xec, 0xcd, 0xab, 0xcc, 0xba, 0xdc, 0xac, 0xc8,
+    0xb9, 0xcc, 0xaa, 0xca, 0xcc, 0xdc, 0xec, 0xbc, 0xdc, 0xcd, 0xcc, 0xc9, 0xcd, 0xbb, 0xab, 0xcc,
+    0xcc, 0xcd, 0xcc, 0x97, 0xdc, 0xdd, 0xcc, 0xcc, 0xab, 0xcb, 0xbc, 0xaa, 0xcb, 0xdc, 0xdc, 0xce,
+    0xcd, 0xec, 0xce, 0xcc, 0xcc, 0xdc, 0xec, 0xca, 0xcc, 0xdc, 0xcb, 0xab, 0xca, 0xdd, 0xcd, 0xcc,
+    0xcd, 0xcc, 0xcc, 0x9b, 0xa9, 0xcb, 0xdd, 0xed, 0xde, 0xdc, 0xee, 0xdd, 0xbd, 0xdc, 0xcd, 0xbd,
+    0xb9, 0xcc, 0xdc, 0xac, 0xbc, 0xcc, 0xed, 0xcb, 0xda, 0xbc, 0xdb, 0xcc, 0xaa, 0xa6, 0xcc, 0xba,
+    0xbd, 0xed, 0xcd, 0xdd, 0xed, 0xbc, 0xdb, 0xcb, 0xac, 0xdc, 0xcc, 0xbc, 0xcb, 0xcc, 0xdd, 0xbd,
+    0xcc, 0xbc, 0xbb, 0xcc, 0xaa, 0xaa, 0xbb, 0xdd, 0xcc, 0xdb, 0xcd, 0xcd, 0xdc, 0xde, 0xed, 0xcd,
+    0xdd, 0xcb, 0xce, 0xdd, 0xcd, 0xcc, 0xcb, 0xcc, 0x9c, 0xbc, 0xbb, 0xdc, 0xbc, 0xba, 0xba, 0xbc,
+    0xcc, 0xdc, 0xde, 0xdc, 0xdd, 0xed, 0xcb, 0xde, 0xdc, 0xbc, 0xdc, 0xdc, 0xcb, 0xbb, 0xdb, 0xcd,
+    0xcc, 0xca, 0xab, 0xca, 0xcc, 0xbb, 0xcb, 0xcc, 0xcc, 0xbc, 0xdc, 0xec, 0xce, 0xcc, 0xcb, 0xbc,
+    0xbb, 0x9c, 0xcc, 0xcb, 0xcc, 0xcd, 0xba, 0xcc, 0xdb, 0xcc, 0xdb, 0xcb, 0xcb, 0xcc, 0xbb, 0xcb,
+    0xcc, 0xbd, 0xdb, 0xcd, 0xbc, 0xba, 0xec, 0xde, 0xcb, 0xbd, 0xcc, 0xbc, 0xbb, 0xde, 0xcc, 0xb7,
+    0xed, 0xce, 0xbc, 0xcb, 0xba, 0xdc, 0xab, 0xbb, 0xcc, 0xdb, 0xed, 0xee, 0xbc, 0xcc, 0xeb, 0xce,
+    0xdc, 0x9c, 0xac, 0xbc, 0xab, 0xbb, 0xc9, 0xc8, 0xbc, 0xbc, 0xbc, 0x9a, 0xb9, 0xcc, 0xcc, 0xcc,
+    0xcc, 0xcc, 0x49, 0x98, 0xb9, 0xaa, 0xba, 0xb9, 0xa9, 0xcb, 0xbb, 0xee, 0xdd, 0xdb, 0xdd, 0xcb,
+    0xbc, 0xba, 0xdc, 0x7c, 0xbc, 0xdc, 0xcc, 0x9a, 0xaa, 0xcb, 0xcc, 0xcd, 0xdc, 0xdb, 0xdd, 0xed,
+    0xce, 0xcd, 0xbc, 0xdd, 0xbc, 0xcd, 0xbb, 0xca, 0xb9, 0xcc, 0xdc, 0xcc, 0xbc, 0xbb, 0xcc, 0xbc,
+    0xa9, 0xab, 0xcc, 0xbc, 0xcd, 0xcc, 0xda, 0xce, 0xcd, 0xcc, 0xee, 0xed, 0xcb, 0xcb, 0xbc, 0xcc,
+    0xbc, 0xbb, 0xca, 0xbc, 0xac, 0xcc, 0xcb, 0xcc, 0xac, 0x99, 0xca, 0xcd, 0xab, 0xab, 0xcd, 0xab,
+    0xab, 0xdd, 0xcc, 0xcd, 0xdb, 0xcb, 0xcc, 0xcd, 0xbd, 0xba, 0xbb, 0xeb, 0xcb, 0xba, 0xca, 0xcb,
+    0xcc, 0xdb, 0xcd, 0xcc, 0xdb, 0xde, 0xbc, 0xdc, 0xdd, 0xcc, 0xca, 0xcc, 0xbc, 0xbb, 0xbc, 0xbb,
+    0xbb, 0xcc, 0xcb, 0xcb, 0xdb, 0xcc, 0xab, 0xcb, 0xcc, 0xba, 0xdb, 0xac, 0xbb, 0xcb, 0xdd, 0x8e,
+    0xdc, 0xdd, 0xdd, 0xeb, 0xdd, 0xbb, 0xab, 0xcc, 0xcc, 0xdc, 0xda, 0xcd, 0xcc, 0xcc, 0xcb, 0xcc,
+    0xdc, 0xbc, 0xcc, 0xcb, 0xbc, 0xcc, 0xcb, 0xdc, 0xaa, 0xdc, 0xdc, 0xcb, 0xbe, 0xde, 0xcc, 0xcc,
+    0xdc, 0xcc, 0xbe, 0xcb, 0xdc, 0xdb, 0xdc, 0xbd, 0x99, 0xcc, 0xca, 0xbc, 0xcb, 0xcb, 0xbd, 0xbc,
+    0xcc, 0xdd, 0xcc, 0xcc, 0xdb, 0xcd, 0xdd, 0xbc, 0xdc, 0xcc, 0xdd, 0xcc, 0xcc, 0xdc, 0xbd, 0xdb,
+    0xcd, 0xdb, 0xcc, 0xaa, 0xcc, 0xcc, 0xac, 0xba, 0xcd, 0xbb, 0xab, 0xcb, 0xcd, 0xce, 0xdc, 0xdc,
+    0xcc, 0xce, 0xdc, 0xcc, 0xcc, 0xbc, 0xcd, 0xb9, 0xcc, 0xbd, 0xcc, 0xbb, 0xbb, 0xcb, 0xb9, 0xba,
+    0xba, 0xbd, 0xda, 0xed, 0xbd, 0xed, 0xdd, 0xcd, 0xcd, 0xed, 0xcd, 0xdc, 0xcc, 0xbc, 0xcb, 0xca,
+    0xbc, 0xbb, 0xcc, 0xbc, 0xbc, 0xdb, 0xab, 0xcb, 0xdc, 0xcc, 0xb9, 0xcc, 0xdd, 0xdc, 0xdd, 0xcc,
+    0xcd, 0xdc, 0xcd, 0xdc, 0xbd, 0xcd, 0xcc, 0xbb, 0xbc, 0xcb, 0x9a, 0xcc, 0x9c, 0xcc, 0xdc, 0xcb,
+    0xdb, 0xee, 0xad, 0xbb, 0xba, 0xbd, 0xbb, 0xac, 0x99, 0xaa, 0xab, 0xbc, 0x8b, 0xca, 0xde, 0xec,
+    0xcb, 0xcb, 0xdd, 0xcd, 0xbb, 0xcc, 0xcc, 0xbd, 0xcb, 0xdc, 0xde, 0xaa, 0xeb, 0xce, 0xdd, 0xce,
+    0xce, 0xcc, 0xeb, 0xde, 0xbb, 0xa6, 0xcb, 0xcd, 0x9a, 0xec, 0xec, 0xee, 0xcc, 0xbb, 0xcc, 0xcc,
+    0xa9, 0xcc, 0xdc, 0xad, 0xda, 0xde, 0xcd, 0xdb, 0xcc, 0xcd, 0xa9, 0xcb, 0xcc, 0x89, 0xbc, 0xcb,
+    0xbc, 0xcc, 0xdd, 0xcc, 0xcc, 0xcc, 0xcc, 0xcb, 0xcc, 0xeb, 0xcd, 0xdc, 0xcc, 0xdd, 0xdc, 0xbd,
+    0xbb, 0xbd, 0xbb, 0xdc, 0xac, 0xcc, 0xcc, 0xcb, 0xcb, 0xcb, 0xac, 0xcb, 0xcc, 0xcc, 0x9c, 0xbb,
+    0xba, 0xcc, 0xdd, 0xbd, 0xac, 0xcd, 0xbc, 0xcc, 0xba, 0xbc, 0xaa, 0x8a, 0xab, 0xbb, 0xbc, 0xbb,
+    0xdd, 0xdd, 0xcc, 0xbb, 0xdd, 0xce, 0xbc, 0xaa, 0xcb, 0xbb, 0xbc, 0xdc, 0xdd, 0xba, 0xdc, 0xec,
+    0xae, 0xdd, 0xce, 0xcb, 0xda, 0xdd, 0xcc, 0xac, 0xdc, 0xdd, 0xdc, 0xda, 0xdc, 0xdd, 0xbd, 0xb8,
+    0xb8, 0xca, 0xdd, 0x9e, 0xba, 0xec, 0xed, 0x9a, 0x9a, 0xcb, 0xec, 0xbb, 0xbc, 0xaa, 0xcc, 0xbb,
+    0xcc, 0xbb, 0xcb, 0xcc, 0x8c, 0xba, 0xcc, 0x9c, 0xca, 0xaa, 0xac, 0xed, 0xad, 0xba, 0xdb, 0xce,
+    0x9a, 0xba, 0xdc, 0xdc, 0xbb, 0xbb, 0xbb, 0xcc, 0xdd, 0xbc, 0xba, 0xcc, 0x9c, 0x99, 0xca, 0xcc,
+    0xcc, 0xca, 0xbd, 0xa9, 0xea, 0xee, 0x9d, 0xba, 0xed, 0xde, 0xec, 0xcd, 0xbd, 0xbe, 0xed, 0xbc,
+    0xab, 0xdb, 0xce, 0xcc, 0xab, 0xcb, 0xdd, 0xbd, 0xcc, 0xcc, 0xcc, 0xbc, 0xbc, 0xdc, 0xdc, 0xbb,
+    0xdc, 0xee, 0xcd, 0xdd, 0xde, 0xed, 0xdc, 0xbd, 0xcc, 0xba, 0xdc, 0xcc, 0xbb, 0xca, 0xdd, 0xcc,
+    0xcb, 0x9b, 0xdc, 0xcd, 0xbb, 0xcc, 0xcd, 0x9d, 0xdb, 0xed, 0xde, 0xeb, 0xdd, 0xdd, 0xbc, 0xdd,
+    0xcc, 0xbd, 0xdb, 0xdd, 0xcc, 0xac, 0xdc, 0xcc, 0xdc, 0xac, 0xdb, 0xcb, 0xbb, 0xdd, 0xdc, 0xed,
+    0xbb, 0xcb, 0xde, 0xae, 0xbb, 0xcb, 0xcc, 0xc9, 0xde, 0xdb, 0xa8, 0xdc, 0xdd, 0x9c, 0xbc, 0xcd,
+    0xcc, 0xcc, 0x89, 0xca, 0xcc, 0xdd, 0xbd, 0xc8, 0xcc, 0xde, 0xad, 0xca, 0xcb, 0xdc, 0xbc, 0xcc,
+    0xba, 0xcb, 0xcd, 0xcc, 0xac, 0xca, 0xbd, 0xcb, 0xaa, 0xcd, 0xcc, 0xba, 0xbb, 0xcc, 0xcd, 0xac,
+    0xca, 0xdc, 0xbd, 0x9a, 0xdd, 0xcc, 0xcc, 0xcb, 0xcc, 0xdc, 0xdc, 0xbb, 0xbc, 0xbc, 0xcd, 0xcb,
+    0xab, 0xca, 0xcc, 0xaa, 0xab, 0xbc, 0xbc, 0xbc, 0xab, 0xbc, 0xee, 0x9c, 0xa9, 0xdc, 0xcc, 0xbc,
+    0xab, 0xbc, 0xcc, 0xdd, 0xca, 0xbc, 0xdd, 0xcc, 0xab, 0xbb, 0xeb, 0xcc, 0xba, 0xbc, 0xcb, 0xbb,
+    0xcb, 0xcc, 0xbc, 0xbb, 0xaa, 0xbb, 0xca, 0xbd, 0xaa, 0xcc, 0xcc, 0xcc, 0xcb, 0xdc, 0xcd, 0xdd,
+    0x9c, 0xcb, 0xcd, 0xcd, 0xa8, 0xcb, 0xcc, 0xdc, 0xdc, 0xee, 0xbc, 0xdc, 0xdc, 0xde, 0xdc, 0xdc,
+    0xbb, 0xcc, 0xdd, 0xcc, 0xcc, 0xdb, 0xde, 0xdd, 0xbd, 0xcc, 0xcd, 0xcd, 0xbc, 0xcb, 0xcc, 0xbd,
+    0xcc, 0xdc, 0xbd, 0xcc, 0xac, 0xaa, 0xbc, 0xcc, 0xaa, 0xaa, 0xba, 0xcc, 0xcc, 0xca, 0xcc, 0xdd,
+    0xde, 0xba, 0xcb, 0xdd, 0xcc, 0xbc, 0xcc, 0xcc, 0xdc, 0x9d, 0xc9, 0xdc, 0xcd, 0x8d, 0xc9, 0xcb,
+    0xdc, 0xab, 0xac, 0xba, 0xdb, 0xcc, 0xbb, 0xbc, 0xdb, 0xbc, 0xcc, 0xba, 0xcc, 0xcc, 0xbb, 0xcb,
+    0xcc, 0xdd, 0xce, 0xdb, 0xec, 0xdd, 0xdd, 0xcc, 0xbc, 0xbc, 0xcb, 0xbc, 0xab, 0xba, 0xdb, 0xab,
+    0xcb, 0xcd, 0xcc, 0xbb, 0xcb, 0xbc, 0xcb, 0xbc, 0xca, 0xcc, 0xdc, 0xab, 0xbc, 0xdb, 0x8e, 0xca,
+    0xcc, 0x9b, 0x99, 0xcc, 0xcd, 0xcc, 0xdc, 0xbb, 0xbb, 0xcb, 0xbc, 0xa9, 0xcc, 0xcc, 0xcc, 0xcc,
+    0xcc, 0xcc, 0xa9, 0xee, 0xdc, 0xa9, 0xdb, 0xee, 0x9d, 0xcc, 0xcd, 0xed, 0xcb, 0xcc, 0xbc, 0xb9,
+    0xdc, 0xbc, 0x9a, 0xbb, 0xcc, 0xab, 0xcb, 0x9a, 0xbb, 0xcd, 0xcb, 0xcc, 0xcd, 0xcb, 0xdd, 0x9d,
+    0xbb, 0xbb, 0xbc, 0xab, 0xbc, 0xaa, 0xdc, 0xcc, 0xac, 0xba, 0xdc, 0xcc, 0xaa, 0xcb, 0xcd, 0xac,
+    0xbc, 0xcb, 0xac, 0xdd, 0xcc, 0xbb, 0xec, 0xcd, 0xcc, 0xcd, 0xdd, 0xcc, 0xcd, 0xdb, 0xcc, 0xdc,
+    0xbc, 0xcc, 0xdb, 0xcc, 0xcc, 0xcc, 0xbc, 0xcc, 0xac, 0xcb, 0xbc, 0xcb, 0xbc, 0xdc, 0xad, 0xcb,
+    0xec, 0xdd, 0xbc, 0xcc, 0xdc, 0xbc, 0xdc, 0xcc, 0xbc, 0xcc, 0xcd, 0xcd, 0xca, 0xdc, 0xcd, 0xcc,
+    0xdc, 0xbc, 0xbb, 0xcc, 0xbb, 0x9b, 0xcb, 0xbc, 0xcb, 0xac, 0xcb, 0xce, 0xcd, 0xbc, 0xdc, 0xdc,
+    0xce, 0xcd, 0xca, 0xdc, 0xbc, 0xcc, 0x9b, 0xca, 0xcc, 0xde, 0xac, 0xdc, 0xdc, 0xbc, 0xcb, 0xab,
+    0xcc, 0xbb, 0xbb, 0xcb, 0xbc, 0xcc, 0xac, 0xdc, 0xdd, 0xbd, 0xcb, 0xdb, 0xcc, 0xcc, 0x6a, 0x66,
+    0xb7, 0xbc, 0xcb, 0xcc, 0xcd, 0xa8, 0xba, 0xcc, 0x8c, 0xbc, 0xcd, 0xcc, 0xcb, 0xcd, 0xcd, 0xac,
+    0xbb, 0xcc, 0xca, 0xa7, 0xac, 0x8a, 0xcc, 0xcc, 0xba, 0xcc, 0xde, 0xbc, 0xce, 0xbc, 0xbc, 0xdc,
+    0xbc, 0xcb, 0xbb, 0xcb, 0xd9, 0xcc, 0xec, 0x8c, 0xee, 0xed, 0xdc, 0xd8, 0xdd, 0xcd, 0xcb, 0xb8,
+    0xbc, 0xbc, 0xdc, 0xfe, 0xde, 0xcc, 0xbc, 0xbb, 0xcc, 0xbd, 0xaa, 0xbb, 0xdc, 0x9b, 0xcb, 0xdd,
+    0xca, 0xaa, 0xcd, 0xac, 0xec, 0xdd, 0xbb, 0x8a, 0xdb, 0xab, 0xcc, 0xdc, 0xdb, 0xcd, 0xaa, 0x99,
+    0xca, 0xab, 0xba, 0xdb, 0xee, 0x9c, 0xba, 0xdd, 0xdd, 0xbb, 0xcc, 0xbd, 0xca, 0xbd, 0xcb, 0x8b,
+    0xa8, 0x9a, 0xcb, 0xdc, 0xcb, 0xdc, 0xad, 0xbb, 0xcb, 0xcd, 0xb9, 0xbb, 0xdd, 0xab, 0xcd, 0xed,
+    0xbc, 0xc8, 0xdc, 0xbc, 0xac, 0xca, 0xbc, 0x9a, 0xcc, 0x8a, 0xa8, 0xcc, 0xcc, 0xbb, 0xde, 0xcc,
+    0xdd, 0xcd, 0xba, 0xcc, 0xdc, 0xaa, 0xda, 0xcc, 0xcb, 0xaa, 0xcc, 0xdc, 0xbc, 0xaa, 0xbc, 0xdc,
+    0xca, 0x79, 0x99, 0xcc, 0xbb, 0xcc, 0xdd, 0x8d, 0x9a, 0xba, 0xbc, 0x98, 0xba, 0xee, 0x9b, 0x99,
+    0xee, 0xce, 0x98, 0xb9, 0xac, 0xaa, 0x98, 0xcc, 0x9a, 0xcc, 0xcc, 0xcc, 0xcc, 0xba, 0xcb, 0xcc,
+    0x6c, 0xaa, 0xbb, 0xca, 0xb9, 0xeb, 0xee, 0xac, 0xcb, 0xce, 0xcd, 0xbc, 0xba, 0xbb, 0xac, 0xb8,
+    0xba, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xdd, 0xcc, 0xcc, 0xdc, 0xed, 0xcc, 0xec, 0xdc, 0xbd, 0xca,
+    0xbc, 0xbd, 0xba, 0xcc, 0xcc, 0xcc, 0xcc, 0xca, 0xdc, 0xab, 0xac, 0xbb, 0xba, 0xcc, 0xdc, 0xfe,
+    0xef, 0xdc, 0xdd, 0xed, 0xbb, 0xcd, 0xcd, 0xbb, 0xca, 0xdd, 0xbb, 0xbc, 0xdc, 0xdd, 0xcc, 0xaa,
+    0xcb, 0xcc, 0xcb, 0x67, 0x84, 0xcb, 0xec, 0xdd, 0xdd, 0xcd, 0xdd, 0xcc, 0xdd, 0xd9, 0xcd, 0xcb,
+    0x9b, 0xdd, 0xcc, 0xdd, 0xda, 0xed, 0xde, 0x7c, 0xdc, 0xdd, 0xbd, 0x9b, 0xbb, 0xcc, 0xea, 0xde,
+    0xfc, 0xce, 0xce, 0x9c, 0xba, 0xea, 0xbd, 0xaa, 0xba, 0xed, 0xbd, 0xdb, 0xdd, 0xde, 0xcc, 0xcd,
+    0xc9, 0x9a, 0xab, 0xcb, 0x69, 0x96, 0xcc, 0xdc, 0xee, 0xbc, 0xec, 0xbd, 0xab, 0xea, 0xde, 0xbc,
+    0x99, 0xce, 0xdd, 0xab, 0xea, 0xdc, 0xbd, 0xbc, 0xab, 0xbc, 0x99, 0xcb, 0x8c, 0x26, 0xa4, 0xcc,
+    0xcc, 0xee, 0xee, 0xba, 0xba, 0xcd, 0x6b, 0xab, 0xdc, 0x9d, 0xa8, 0xca, 0xbc, 0xab, 0xba, 0xdb,
+    0xab, 0xba, 0xeb, 0xcd, 0xbb, 0x93, 0xaa, 0x9b, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xdc, 0xbd, 0xb9,
+    0xbb, 0xec, 0xcb, 0x9b, 0xdc, 0xbc, 0xca, 0xcb, 0xbc, 0x9a, 0xdd, 0xce, 0xac, 0x8b, 0xcc, 0xcd,
+    0xca, 0xee, 0xcb, 0xcc, 0xcc, 0xcc, 0xdb, 0x8c, 0xbb, 0xba, 0xbc, 0xc9, 0xba, 0xdd, 0xab, 0xcd,
+    0xdc, 0xcc, 0xc7, 0xdd, 0xcd, 0xbc, 0xb5, 0xdd, 0x9b, 0xec, 0xcb, 0xcb, 0xcd, 0xcd, 0xcc, 0xbd,
+    0xca, 0xcc, 0xdd, 0xab, 0xcc, 0xda, 0xbd, 0xba, 0xcb, 0xbc, 0xba, 0xa7, 0xdc, 0x8b, 0xcc, 0x99,
+    0xca, 0xdc, 0xee, 0xcb, 0xcc, 0xed, 0xbb, 0xbb, 0xdc, 0xac, 0x98, 0xcb, 0xdd, 0xbc, 0xcb, 0xcc,
+    0xee, 0xcb, 0xcb, 0xca, 0xbe, 0xa9, 0xcc, 0x98, 0x99, 0xcb, 0xfc, 0xde, 0xdd, 0xdc, 0xde, 0xbb,
+    0xcb, 0xcd, 0xac, 0xba, 0xdd, 0xcd, 0xbb, 0xdc, 0xdc, 0xce, 0xcc, 0xbc, 0xdd, 0xac, 0xcb, 0xcc,
+    0xbc, 0x99, 0xcc, 0xde, 0xdc, 0xed, 0xcc, 0xcd, 0xdb, 0xcc, 0xcd, 0xab, 0xcb, 0xec, 0xcd, 0xdb,
+    0xbd, 0xed, 0xdd, 0xcd, 0xcc, 0xcd, 0xcc, 0xcb, 0xaa, 0x99, 0xc8, 0xcc, 0xff, 0xff, 0xcd, 0xdd,
+    0xce, 0xbd, 0xec, 0xdd, 0xbb, 0xc9, 0xdd, 0xab, 0xdb, 0xcc, 0xad, 0xde, 0xcc, 0xca, 0xdd, 0xcb,
+    0x8c, 0x66, 0x87, 0xcc, 0xdd, 0xdc, 0xde, 0xdd, 0xcc, 0xcc, 0xcc, 0xbd, 0xbc, 0xab, 0xdc, 0xdc,
+    0xdd, 0xbc, 0xdd, 0xdd, 0xbc, 0xbb, 0xdd, 0xcd, 0xbc, 0xa6, 0xcc, 0xcb, 0xec, 0xcd, 0xdd, 0xdb,
+    0xde, 0xdc, 0x8c, 0xdc, 0xcc, 0xbc, 0xbc, 0xdd, 0xcc, 0xcc, 0xcc, 0xcd, 0xdd, 0xbc, 0xbc, 0xcc,
+    0xcc, 0x6c, 0x53, 0xb7, 0xcc, 0xee, 0xdd, 0xcc, 0xee, 0x9c, 0xca, 0xbc, 0xad, 0x98, 0xca, 0xdc,
+    0xbb, 0xaa, 0xdc, 0xde, 0xca, 0xcc, 0xc6, 0x9b, 0xaa, 0xcc, 0xcb, 0xab, 0xcc, 0xcc, 0xdd, 0xcb,
+    0xcc, 0xcc, 0xdb, 0xbc, 0xac, 0xcb, 0xcd, 0xdc, 0xbd, 0xdd, 0xdd, 0xcc, 0xdd, 0xcd, 0xcc, 0xba,
+    0xcc, 0xcc, 0xbc, 0x9a, 0xc9, 0xcc, 0xdd, 0xed, 0xcd, 0xdd, 0xcc, 0x9b, 0xdc, 0xdc, 0xcd, 0xea,
+    0xcd, 0xed, 0xca, 0xcd, 0xab, 0xbd, 0xcb, 0xa7, 0x89, 0xc8, 0xcc, 0x89, 0xca, 0xcc, 0xcc, 0xcc,
+    0xcc, 0xcc, 0xac, 0xdb, 0xcb, 0x5c, 0xa9, 0xcb, 0xbb, 0x9b, 0xba, 0xab, 0xbc, 0xba, 0xab, 0xcb,
+    0xcc, 0xdc, 0xac, 0x4c, 0xca, 0xcc, 0xc9, 0xee, 0xef, 0xce, 0xee, 0xdd, 0xac, 0xdc, 0xce, 0xac,
+    0xda, 0xdb, 0xdd, 0xba, 0xbd, 0xcd, 0xbb, 0xcc, 0xca, 0x9b, 0xba, 0xcc, 0x48, 0x85, 0xcc, 0xdc,
+    0xbc, 0xba, 0xdc, 0xbc, 0xbb, 0xcd, 0xcb, 0xbb, 0xcb, 0xbb, 0xcd, 0xdd, 0xbc, 0xda, 0xed, 0xde,
+    0xad, 0xcd, 0xcd, 0xbb, 0xbc, 0x98, 0xa9, 0xcc, 0xbc, 0xdd, 0xee, 0xcc, 0xbc, 0xdc, 0xbc, 0xbb,
+    0xcb, 0xac, 0xbc, 0xcb, 0xde, 0xac, 0xbb, 0xcc, 0xbc, 0xba, 0xdc, 0xdd, 0xcb, 0x6a, 0xb9, 0xcc,
+    0xcc, 0xba, 0xc9, 0xdc, 0xce, 0xcd, 0xab, 0xdd, 0xa9, 0xac, 0xcd, 0x9a, 0xc9, 0xbc, 0x9c, 0xaa,
+    0xbc, 0xca, 0xaa, 0xdc, 0xbd, 0xbc, 0xdc, 0xec, 0xcc, 0x8b, 0x77, 0xb9, 0xae, 0xdc, 0xbd, 0xeb,
+    0xee, 0xdd, 0xbc, 0xdc, 0xab, 0xdc, 0xab, 0xcc, 0xcb, 0xbd, 0xcb, 0xcb, 0xcb, 0xc8, 0xcd, 0xcd,
+    0xad, 0xcc, 0x9c, 0x62, 0xec, 0xde, 0xcd, 0xab, 0xef, 0xde, 0xcd, 0xcb, 0xcb, 0xda, 0xbc, 0x9c,
+    0xaa, 0xcb, 0xca, 0x9c, 0xca, 0xac, 0xcc, 0xeb, 0xdc, 0xcd, 0x9b, 0xa8, 0xcc, 0xdd, 0xcc, 0xab,
+    0xda, 0xde, 0xdd, 0xbc, 0xcc, 0xcb, 0xcd, 0x9b, 0xba, 0xcb, 0xad, 0xba, 0xdc, 0xbc, 0xb9, 0xcb,
+    0xcd, 0xbd, 0xcc, 0xcc, 0xcc, 0xdc, 0x9a, 0x8a, 0xca, 0xdd, 0xed, 0xbc, 0xdc, 0xcc, 0xdd, 0xcc,
+    0xaa, 0xac, 0xba, 0x7c, 0xca, 0xbb, 0xcb, 0xbb, 0xcb, 0xbc, 0xcc, 0xbc, 0xbc, 0xb3, 0xcb, 0xcd,
+    0xbb, 0xcc, 0xcc, 0xbb, 0xbd, 0xbc, 0xec, 0xbb, 0xcb, 0xbc, 0xbc, 0x9a, 0xac, 0xeb, 0x9b, 0xdb,
+    0xdd, 0xcd, 0xcc, 0xbc, 0xaa, 0x85, 0xec, 0xed, 0xcd, 0x9c, 0xef, 0xde, 0xcd, 0xeb, 0xbb, 0xea,
+    0xbd, 0xa8, 0xbb, 0xbc, 0xab, 0xaa, 0xcc, 0x9c, 0xbc, 0xdc, 0xcc, 0xcc, 0xbc, 0x99, 0xcb, 0xac,
+    0xca, 0xcc, 0xb7, 0xbb, 0xdc, 0xce, 0xdc, 0xbc, 0xcb, 0xaa, 0xcb, 0xbd, 0xab, 0xeb, 0xac, 0xaa,
+    0xcb, 0xbc, 0xaa, 0xcc, 0xbd, 0xac, 0x27, 0xe8, 0xdd, 0xdd, 0xcd, 0xee, 0xde, 0xdd, 0xac, 0xee,
+    0xbc, 0xbd, 0xa7, 0xcc, 0xbb, 0xab, 0x9a, 0xa9, 0x9a, 0xbc, 0xba, 0xcb, 0xcc, 0xbb, 0xac, 0xaa,
+    0xce, 0xcd, 0xdc, 0xfc, 0xce, 0xbc, 0xbc, 0xcc, 0xad, 0xcb, 0xbb, 0xcb, 0xa9, 0xab, 0xbc, 0xa8,
+    0xaa, 0xcc, 0xcc, 0xdc, 0xcc, 0xcc, 0xbc, 0xcb, 0xcc, 0xab, 0xa9, 0xb9, 0xad, 0xba, 0xcc, 0xec,
+    0xca, 0xdc, 0xcd, 0xcc, 0xdb, 0xde, 0xcb, 0xba, 0xdd, 0xbb, 0xdc, 0xab, 0xcb, 0xcc, 0xbc, 0x88,
+    0xca, 0xac, 0xbb, 0xba, 0xb9, 0xcb, 0xcc, 0xdd, 0xca, 0xcc, 0xcc, 0xdb, 0xcc, 0xed, 0x7d, 0xeb,
+    0xcd, 0xcc, 0xca, 0xcc, 0xbb, 0xcb, 0xcc, 0x89, 0x98, 0xdb, 0xdc, 0xbc, 0xbb, 0xdd, 0xdd, 0xde,
+    0xcd, 0xdd, 0xeb, 0xcd, 0xdb, 0xcc, 0xed, 0xac, 0xcb, 0xcd, 0xac, 0xdb, 0xdd, 0xcd, 0xba, 0x99,
+    0xca, 0xcc, 0xcc, 0x7a, 0xbb, 0xeb, 0xbc, 0xbd, 0xec, 0xce, 0xec, 0xbc, 0xcc, 0xca, 0xbd, 0xac,
+    0xcb, 0xdd, 0xbd, 0xdb, 0xac, 0xcc, 0xcd, 0x8c, 0x34, 0xa8, 0xcc, 0xcd, 0x99, 0xcb, 0xbd, 0xdc,
+    0xcc, 0xcc, 0xcc, 0xec, 0xed, 0xbc, 0xcc, 0xcd, 0xab, 0xdb, 0xde, 0xcc, 0xdd, 0xdc, 0xdb, 0xcc,
+    0xcc, 0xcc, 0xcb, 0xbc, 0xee, 0x4c, 0xb6, 0xec, 0xee, 0xbc, 0xee, 0xbe, 0xdc, 0xdb, 0xce, 0xed,
+    0xae, 0xba, 0xba, 0xbb, 0xea, 0xcd, 0xbc, 0xbb, 0xcc, 0xcc, 0xcc, 0xdc, 0xcb, 0x8d, 0xa5, 0xcd,
+    0xed, 0xcd, 0xcb, 0xbb, 0xdd, 0xbc, 0xba, 0xac, 0xcd, 0x7a, 0xba, 0xbb, 0x8a, 0xca, 0xbb, 0xbc,
+    0xca, 0xbc, 0xcb, 0xcc, 0xcc, 0xdd, 0xbd, 0xc8, 0xed, 0xde, 0xcc, 0xcc, 0xbb, 0xdd, 0xcb, 0xcc,
+    0xcb, 0xbd, 0xab, 0xba, 0xbb, 0xca, 0xcc, 0xcc, 0x9c, 0xac, 0x56, 0x96, 0xbc, 0xdb, 0xdd, 0x9c,
+    0xde, 0xee, 0xed, 0xdc, 0xdd, 0xbb, 0xbe, 0xbd, 0xdd, 0xbd, 0xbc, 0xbd, 0x99, 0x9a, 0xcc, 0xaa,
+    0xcc, 0xcc, 0xbb, 0xcb, 0xcc, 0xcd, 0xaa, 0xc9, 0xdc, 0xbc, 0xbd, 0xc8, 0xbd, 0xca, 0xad, 0xbc,
+    0xba, 0xbb, 0xca, 0xba, 0xdc, 0xac, 0xdc, 0xcc, 0xcd, 0xcb, 0xbc, 0x99, 0xca, 0xcc, 0xbb, 0x9a,
+    0xca, 0xed, 0xcc, 0xdc, 0xbc, 0xab, 0xed, 0xcd, 0xcb, 0xbb, 0xbc, 0x7b, 0xcb, 0xcd, 0xcc, 0xdb,
+    0xcd, 0xbd, 0xcc, 0x8b, 0x55, 0xc8, 0xcd, 0xcc, 0xbd, 0xc9, 0xee, 0xdc, 0xbc, 0xcb, 0xbb, 0xdd,
+    0xcb, 0xdd, 0xcc, 0xbc, 0xcb, 0xec, 0xbd, 0xc9, 0xdc, 0xdd, 0xbd, 0xcc, 0x8b, 0xa8, 0xcc, 0x78,
+    0xab, 0x9a, 0xac, 0xdd, 0xdd, 0xec, 0xee, 0xcb, 0xac, 0xee, 0xdd, 0xcc, 0xc9, 0xde, 0xbd, 0xab,
+    0xdc, 0xcc, 0xbc, 0xcc, 0x89, 0x65, 0xc9, 0xdb, 0xcd, 0xcc, 0xd9, 0xdd, 0xed, 0xdd, 0xcc, 0xcd,
+    0xdd, 0xdb, 0xdd, 0xed, 0xad, 0xcc, 0xcc, 0xbc, 0xd9, 0xdd, 0xcd, 0xcc, 0x9c, 0x36, 0x54, 0xbb,
+    0xbb, 0xdb, 0x8d, 0xcc, 0xdc, 0xed, 0xca, 0xdc, 0xdd, 0xae, 0xdd, 0xdd, 0xdd, 0xca, 0xdd, 0xdc,
+    0xcc, 0xde, 0xcc, 0xcb, 0xcc, 0xcc, 0xcc, 0xcc, 0xac, 0x9a, 0xc9, 0xcc, 0xbe, 0xcc, 0xc9, 0xcd,
+    0xbb, 0xac, 0xdc, 0xbd, 0xdb, 0xca, 0xcc, 0xdd, 0xab, 0xcc, 0xcd, 0xcb, 0xcb, 0xcc, 0xcc, 0xcc,
+    0xcc, 0xab, 0xbb, 0xcb, 0xbd, 0xbb, 0xac, 0xdc, 0xbc, 0xbb, 0xcc, 0xbc, 0xca, 0xdc, 0xcb, 0xca,
+    0xdd, 0xcd, 0xec, 0xcc, 0xcc, 0xcc, 0x88, 0x42, 0xc9, 0xcc, 0xac, 0xaa, 0xcc, 0xba, 0xaa, 0xca,
+    0xbb, 0xdb, 0xde, 0xbc, 0xcb, 0xee, 0xcb, 0xdd, 0xcc, 0xbd, 0xdc, 0xcc, 0xeb, 0xcc, 0xcc, 0xcc,
+    0xcc, 0xcc, 0xcb, 0x9e, 0xb7, 0xdf, 0xec, 0xac, 0xfa, 0xbc, 0xec, 0xab, 0xac, 0xaa, 0xdd, 0xbc,
+    0x9b, 0xb9, 0xab, 0xbc, 0xba, 0xbc, 0xc9, 0x6a, 0x65, 0xca, 0xbc, 0xbc, 0x9a, 0xdb, 0xcb, 0xcc,
+    0xcb, 0xcd, 0xec, 0xde, 0xdc, 0xcc, 0xec, 0xcd, 0xdb, 0xcd, 0xbd, 0xcc, 0xbc, 0xbd, 0xcd, 0xbc,
+    0x89, 0xb7, 0xec, 0xdd, 0xbd, 0xbd, 0xdc, 0xbb, 0xcb, 0xaa, 0x9a, 0xda, 0xbd, 0xa9, 0xba, 0xac,
+    0xba, 0xbb, 0xcd, 0xbc, 0xcc, 0xcd, 0xdd, 0xcc, 0xbc, 0xcb, 0xcc, 0xbc, 0xcc, 0xbc, 0xe8, 0xcc,
+    0xdd, 0xcd, 0xad, 0xbc, 0xcb, 0xcc, 0xcd, 0xcc, 0xbc, 0xca, 0xab, 0xba, 0xb9, 0xac, 0xba, 0xcb,
+    0xcc, 0xbb, 0xbc, 0xcc, 0xbb, 0xdd, 0xcb, 0xec, 0xee, 0xce, 0xcb, 0xde, 0xdc, 0xcd, 0xcc, 0xdc,
+    0xbe, 0xcb, 0xed, 0xed, 0xcb, 0xbc, 0xac, 0xbb, 0xcc, 0xaa, 0xcc, 0xbc, 0xbb, 0xcb, 0xcc, 0xab,
+    0xcd, 0xcc, 0xdd, 0xca, 0xbc, 0xdc, 0x8c, 0xbb, 0xdc, 0xcc, 0xca, 0xdc, 0xdc, 0xcc, 0xcb, 0xdb,
+    0xab, 0x8c, 0xbb, 0xcc, 0xbc, 0xbc, 0xcc, 0xcc, 0xaa, 0xbc, 0xcb, 0xcc, 0xdc, 0xbb, 0xdc, 0x9b,
+    0xbc, 0xcc, 0xcc, 0xc9, 0xab, 0xab, 0xcc, 0xab, 0x99, 0xcc, 0xba, 0xbb, 0xcb, 0xca, 0xcc, 0xdd,
+    0xbb, 0xdd, 0xdd, 0xdd, 0xdd, 0xed, 0xcc, 0x9c, 0xdc, 0xdc, 0xcd, 0xda, 0xdd, 0xdc, 0xbb, 0xcd,
+    0xdc, 0xbc, 0xcc, 0xab, 0xca, 0xcc, 0xb9, 0xdb, 0xcd, 0xdc, 0xac, 0xdd, 0xdc, 0xee, 0xcb, 0xcc,
+    0xd9, 0xbd, 0xee, 0xbc, 0xbc, 0xac, 0xca, 0xdb, 0xdc, 0xdd, 0xcc, 0xcb, 0xbc, 0xcd, 0xc7, 0xcd,
+    0xcc, 0xdb, 0xdd, 0xbc, 0xdb, 0xcd, 0xbb, 0xda, 0xcc, 0xba, 0xda, 0xbd, 0xcb, 0xcc, 0xcb, 0xca,
+    0xcd, 0xba, 0xcb, 0xbc, 0xcc, 0xcb, 0x9c, 0xcb, 0xdd, 0xbc, 0xd9, 0xde, 0xcd, 0xac, 0xee, 0xcd,
+    0xbc, 0xb7, 0xcb, 0xdd, 0x8b, 0xdc, 0xbc, 0xab, 0xcc, 0xbb, 0x9b, 0xcc, 0xac, 0xba, 0xab, 0xbb,
+    0xcd, 0xbc, 0xcc, 0xcd, 0xdc, 0xde, 0xba, 0xce, 0xee, 0xbb, 0xdd, 0xcc, 0xbd, 0xca, 0xcb, 0xdc,
+    0xca, 0xaa, 0xdb, 0xcc, 0xcb, 0xcc, 0xcc, 0x9b, 0xcb, 0xcd, 0xcc, 0xc9, 0xbc, 0xda, 0x7c, 0xab,
+    0xaa, 0xab, 0xa4, 0xb9, 0xab, 0x79, 0x89, 0xbb, 0xc9, 0xbc, 0xb9, 0xbb, 0xcc, 0xcc, 0xcc, 0xbd,
+    0xc9, 0xcd, 0xbc, 0xab, 0xdb, 0xbb, 0xcb, 0xbc, 0xab, 0xbb, 0xa9, 0xd9, 0xac, 0x9a, 0xac, 0xbc,
+    0xab, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xde, 0xcd, 0xcd, 0xdc, 0xbc, 0xcd, 0xbb,
+    0xdd, 0xed, 0xbd, 0xec, 0xce, 0xac, 0xcb, 0xbb, 0xbb, 0xbb, 0xac, 0xdd, 0xcc, 0xcc, 0xac, 0x86,
+    0xc8, 0xdc, 0xcd, 0xbc, 0xac, 0xcd, 0xdc, 0xcd, 0xbc, 0xdd, 0xde, 0xaa, 0xee, 0xbd, 0xdb, 0xca,
+    0xbc, 0xdc, 0xbb, 0xa9, 0xbc, 0xcb, 0xbc, 0xa9, 0xbb, 0xca, 0xcd, 0xdc, 0xcc, 0xcc, 0xcc, 0xdc,
+    0xdd, 0xcd, 0xdc, 0xdc, 0xd8, 0xcc, 0xcc, 0x9c, 0xcc, 0xcc, 0xdc, 0xb9, 0xcc, 0xdd, 0xbd, 0x78,
+    0xab, 0xca, 0xbd, 0xac, 0xbd, 0xbb, 0xdc, 0xbc, 0xcc, 0xcb, 0xbb, 0xaa, 0xba, 0xdc, 0xcd, 0xcb,
+    0xdb, 0xbd, 0xbb, 0xcc, 0xad, 0xab, 0xcc, 0x9c, 0xa8, 0xac, 0xbc, 0xbc, 0xbb, 0xcc, 0xcc, 0xcc,
+    0xcb, 0x8c, 0xcb, 0xbc, 0xba, 0xb9, 0xbd, 0xbc, 0xba, 0xdc, 0xbb, 0xbb, 0xcc, 0xaa, 0xaa, 0xcc,
+    0xcc, 0xab, 0xca, 0xb9, 0xba, 0xbb, 0xaa, 0x9a, 0xcb, 0xbc, 0xbc, 0xba, 0xee, 0x9c, 0xaa, 0xdb,
+    0xab, 0xab, 0xdb, 0xdc, 0xba, 0xcb, 0xcd, 0xad, 0xcc, 0xcc, 0xcc, 0xbc, 0xbc, 0xcc, 0xbd, 0xdb,
+    0xbc, 0xbc, 0xdb, 0xcd, 0xdc, 0xce, 0xc9, 0xdc, 0xcd, 0xbb, 0xcc, 0xcc, 0xac, 0xd9, 0xdd, 0xdd,
+    0xcb, 0x9b, 0xb8, 0xcc, 0xc9, 0xdb, 0xdd, 0xbb, 0xcc, 0xcc, 0xcd, 0xed, 0xdd, 0xdd, 0xac, 0xcb,
+    0xdc, 0xbd, 0xcc, 0xcc, 0xcd, 0xab, 0xdd, 0xdd, 0xad, 0x9c, 0xb8, 0xcb, 0xbb, 0xcb, 0xcc, 0xbd,
+    0xcd, 0xdd, 0xdc, 0x8b, 0xcc, 0xbc, 0xbc, 0xca, 0xcc, 0xca, 0xa7, 0xbc, 0xbb, 0x9c, 0x9c, 0xac,
+    0xad, 0xcc, 0x9a, 0xda, 0xcc, 0xbb, 0xbb, 0xcd, 0xcc, 0xed, 0xbc, 0xcc, 0xdd, 0xcd, 0xcc, 0xcc,
+    0xcc, 0xcb, 0xcc, 0xdc, 0xcc, 0xba, 0xac, 0xce, 0xab, 0xcb, 0x9c, 0xb8, 0xca, 0xac, 0xbc, 0xcb,
+    0xce, 0xdb, 0xcd, 0xdc, 0xdc, 0xed, 0xcd, 0xcb, 0xca, 0xcd, 0xec, 0xdb, 0xdd, 0xbc, 0xbc, 0xdc,
+    0xbd, 0xbb, 0xcc, 0x8a, 0xaa, 0xaa, 0xbc, 0xbb, 0xbb, 0xac, 0xdc, 0xdd, 0xec, 0xdb, 0xec, 0xcb,
+    0xad, 0xdb, 0xcd, 0xec, 0xda, 0xdd, 0xdd, 0xcc, 0xbd, 0xba, 0xab, 0xcc, 0x59, 0xb7, 0xcb, 0xca,
+    0xcb, 0xbc, 0xbc, 0xbc, 0xdc, 0xbc, 0xca, 0xcc, 0xcc, 0xcc, 0xbd, 0xbb, 0xcc, 0xaa, 0xdc, 0xcd,
+    0xac, 0xcb, 0xdd, 0xcc, 0xb8, 0xbb, 0xbc, 0xcc, 0xdc, 0xcd, 0xbb, 0xcd, 0xcc, 0xbd, 0xdd, 0xbc,
+    0xdd, 0xcc, 0xdc, 0xcc, 0xcc, 0xcc, 0xcc, 0xdc, 0xab, 0xbb, 0xcc, 0xcd, 0x8c, 0xbc, 0xbb, 0xce,
+    0xcc, 0xcc, 0xcc, 0xcc, 0xbc, 0xee, 0xdc, 0xcb, 0xcd, 0xab, 0xeb, 0xbe, 0xcb, 0xba, 0xcc, 0xdc,
+    0xcc, 0x9b, 0xba, 0xaa, 0xcc, 0xcc, 0xcb, 0xcc, 0xca, 0xbb, 0xce, 0xcc, 0xdc, 0xcb, 0xca, 0xdb,
+    0xbd, 0xa9, 0xcc, 0xdb, 0xba, 0xcb, 0xdc, 0xbc, 0xba, 0xbc, 0xbc, 0xab, 0xcb, 0xcc, 0xbc, 0xcc,
+    0xcc, 0xde, 0xee, 0xcd, 0xec, 0xde, 0xde, 0xdb, 0xdd, 0xed, 0xdd, 0xdc, 0xde, 0xce, 0xca, 0xed,
+    0xce, 0xcb, 0xcc, 0xbb, 0xcb, 0xbc, 0xba, 0xbc, 0xcb, 0xcb, 0xcd, 0xaa, 0xde, 0xbc, 0xba, 0xcb,
+    0xba, 0xaa, 0xab, 0xcc, 0xdd, 0xaa, 0xba, 0xdc, 0xab, 0xbb, 0xac, 0x76, 0xb8, 0xcc, 0xcc, 0xcc,
+    0xcc, 0xcc, 0xb6, 0xbc, 0xcc, 0x99, 0xca, 0xab, 0x9a, 0xbd, 0xba, 0xbb, 0xdc, 0xbb, 0xab, 0xaa,
+    0xdc, 0xbd, 0x8a, 0xcc, 0xdd, 0xcc, 0xcb, 0x68, 0x89, 0xc9, 0xcc, 0xbc, 0xaa, 0xdd, 0xbc, 0xaa,
+    0xec, 0xca, 0xbb, 0xab, 0xab, 0xdd, 0xbb, 0xcb, 0xcb, 0xac, 0xbb, 0xcc, 0xaa, 0x9b, 0xcb, 0xac,
+    0xab, 0xcb, 0xac, 0xdb, 0xdd, 0xde, 0xdc, 0xee, 0xcd, 0xcb, 0xdd, 0xde, 0xcd, 0xd7, 0xcc, 0xdd,
+    0xaa, 0xde, 0xde, 0xac, 0xec, 0xdc, 0xaa, 0xcc, 0xcc, 0xaa, 0xbb, 0xbb, 0xdc, 0xcc, 0xbc, 0xcc,
+    0xbc, 0xcd, 0xcd, 0xbc, 0xdd, 0xbc, 0xcb, 0xcb, 0xbc, 0xca, 0xcc, 0xbc, 0xbb, 0xbb, 0xcb, 0xcd,
+    0xcc, 0x9b, 0xb9, 0xcc, 0xb9, 0xbb, 0xbc, 0xcc, 0xde, 0xcd, 0xcb, 0xee, 0xad, 0xba, 0xcc, 0xce,
+    0xca, 0xcd, 0xa7, 0xca, 0xcc, 0xcc, 0xdc, 0xbc, 0xcc, 0x8c, 0x77, 0xb8, 0xac, 0xcb, 0xcc, 0xaa,
+    0xab, 0xcd, 0xbc, 0xca, 0xed, 0xcd, 0xab, 0xdc, 0xbd, 0xcc, 0xca, 0xbb, 0xcc, 0xce, 0xcc, 0xcb,
+    0xcd, 0xac, 0x95, 0x49, 0xbb, 0xca, 0xdd, 0xdc, 0xa9, 0xba, 0xcc, 0xcb, 0xbb, 0xaa, 0xaa, 0xab,
+    0xbc, 0xc9, 0xcd, 0xea, 0xcc, 0xec, 0xcc, 0xdb, 0xcd, 0xce, 0x9c, 0x98, 0xcc, 0xab, 0xbb, 0xdc,
+    0xc8, 0xbc, 0xed, 0xdd, 0xdd, 0xde, 0xdc, 0xcb, 0xde, 0xcd, 0xcc, 0xca, 0xcc, 0xdc, 0xcd, 0xda,
+    0xcc, 0xdd, 0xcc, 0xbc, 0xcc, 0xcc, 0xa9, 0xa8, 0xc9, 0xa8, 0xc9, 0xbd, 0xcc, 0xed, 0xcd, 0xc9,
+    0xcc, 0xdc, 0xbc, 0xcc, 0xdb, 0xcd, 0xce, 0xd9, 0xcb, 0xdc, 0xcc, 0xab, 0xcd, 0x9c, 0x8a, 0xda,
+    0xcd, 0xac, 0xba, 0xcb, 0xbc, 0xbe, 0xbd, 0xa9, 0xb7, 0xbc, 0xad, 0xda, 0xcb, 0xbb, 0xdc, 0xdb,
+    0xcb, 0xcd, 0xcc, 0x9c, 0xa8, 0x7a, 0x9c, 0xca, 0xed, 0xbd, 0xba, 0xcc, 0xdc, 0xbc, 0xce, 0xab,
+    0xab, 0xc7, 0xae, 0xca, 0x8c, 0xdb, 0xcd, 0xdd, 0xac, 0xcc, 0xcb, 0xcd, 0xbc, 0x79, 0xc9, 0xbc,
+    0xde, 0xbd, 0xc8, 0xde, 0xce, 0xaa, 0xcc, 0xdb, 0xcd, 0xc9, 0xc9, 0xdd, 0x8a, 0xca, 0xcc, 0xab,
+    0xda, 0xcd, 0xba, 0xcc, 0x4c, 0xbc, 0x8b, 0x87, 0xbb, 0xde, 0xbb, 0xba, 0xcb, 0xac, 0xab, 0xaa,
+    0xab, 0xac, 0x99, 0xcd, 0xa9, 0x9b, 0xeb, 0xae, 0xdc, 0xbc, 0xbc, 0xbb, 0xcc, 0xd9, 0xbd, 0x9b,
+    0xba, 0xdd, 0xcc, 0xab, 0xcc, 0xbc, 0x9b, 0xbb, 0xcc, 0xca, 0xa8, 0xd9, 0xad, 0xab, 0xac, 0xab,
+    0xcc, 0xcb, 0xcc, 0xcc, 0xcc, 0xcc, 0xbc, 0xcb, 0xcc, 0xab, 0xbb, 0xab, 0xec, 0xcd, 0xcc, 0xab,
+    0xce, 0xbb, 0xbc, 0xbb, 0xca, 0xcc, 0xcb, 0xdc, 0xed, 0xdc, 0xdc, 0xcb, 0xdb, 0xcc, 0xbc, 0x78,
+    0xc9, 0x9c, 0xde, 0xad, 0xe9, 0xde, 0xcd, 0xab, 0xdd, 0xdc, 0xcc, 0xeb, 0xac, 0xdb, 0x9c, 0xb9,
+    0xcc, 0xbc, 0xc9, 0xcd, 0xcc, 0xcb, 0xcc, 0xaa, 0x99, 0xcc, 0xca, 0xdc, 0xbb, 0xcc, 0xec, 0xbd,
+    0xdb, 0xcd, 0xdc, 0xcc, 0xcd, 0xdd, 0xcd, 0xdb, 0xdc, 0xbc, 0xed, 0xda, 0xcc, 0xdc, 0xcc, 0x99,
+    0xba, 0xcc, 0xa9, 0x89, 0xba, 0xcb, 0xcd, 0xba, 0xac, 0xdc, 0xbb, 0xcc, 0xcc, 0xbc, 0xdc, 0xac,
+    0xb7, 0xcb, 0xdd, 0xbc, 0xdc, 0xdc, 0xcd, 0x8c, 0x34, 0xa5, 0xac, 0xaa, 0x99, 0xca, 0xbb, 0xbc,
+    0xab, 0xcc, 0xcd, 0xbc, 0xca, 0xdd, 0xbb, 0xdc, 0x7e, 0xbc, 0xdc, 0xee, 0xcc, 0xdc, 0xcd, 0xcc,
+    0xcc, 0xcb, 0xcb, 0x3b, 0xb9, 0xac, 0xaa, 0xaa, 0xaa, 0xab, 0xab, 0xec, 0xbc, 0xba, 0xdb, 0xce,
+    0x89, 0xac, 0xcc, 0xbb, 0xbd, 0xdd, 0xcc, 0xdc, 0xcc, 0xcc, 0xcc, 0xcc, 0xa6, 0xbd, 0x8a, 0xbb,
+    0xdc, 0xcc, 0xca, 0xdd, 0xbc, 0xcc, 0xdc, 0xde, 0xbb, 0xb9, 0xdc, 0xbc, 0xdc, 0xda, 0xbb, 0xcc,
+    0xcd, 0xbc, 0xcb, 0xcc, 0xaa, 0xdb, 0xbd, 0xb6, 0xca, 0xdc, 0xbd, 0xdd, 0xed, 0xbd, 0xcb, 0xed,
+    0xbd, 0xab, 0xbc, 0xcd, 0xdb, 0xae, 0xdc, 0xdb, 0xdd, 0xbc, 0x36, 0x74, 0xbc, 0xcc, 0xdd, 0xad,
+    0xcc, 0xcc, 0xbb, 0xca, 0xdc, 0xcc, 0x7a, 0xaa, 0xdc, 0xbc, 0x97, 0xdc, 0xcd, 0xbb, 0xbc, 0xba,
+    0xcb, 0xcc, 0xbb, 0xcb, 0xcc, 0xa9, 0x98, 0xba, 0xcc, 0xec, 0xcc, 0xca, 0xdd, 0xcd, 0xab, 0xcc,
+    0xcd, 0xcc, 0xcc, 0xa6, 0xbc, 0xed, 0xcc, 0xcc, 0xdd, 0xcd, 0xbc, 0x99, 0xc9, 0xcc, 0xaa, 0xa9,
+    0xca, 0xcb, 0xcc, 0xdc, 0xdc, 0xed, 0xcd, 0xcb, 0xed, 0xcd, 0xdc, 0xac, 0xcc, 0xcc, 0xce, 0xcb,
+    0xdd, 0xcd, 0xcc, 0x8b, 0x54, 0xc8, 0xac, 0xb9, 0xbb, 0xba, 0xbb, 0xcc, 0xdd, 0xde, 0xcc, 0xdd,
+    0xcb, 0xde, 0xdb, 0xbd, 0x9b, 0xbb, 0xdc, 0xcd, 0xcb, 0xdd, 0xcd, 0xcc, 0x7a, 0x96, 0xcc, 0x99,
+    0xaa, 0x99, 0xcc, 0xcb, 0xab, 0xba, 0xab, 0xde, 0x9c, 0xac, 0xdc, 0xcd, 0xc8, 0xdd, 0xcc, 0xbc,
+    0xdc, 0xcc, 0xcd, 0xcc, 0x6a, 0x55, 0xc8, 0xcb, 0xec, 0xcd, 0xcb, 0xdc, 0xbd, 0xbb, 0xcd, 0xdd,
+    0xdd, 0xbc, 0xcc, 0xcc, 0xac, 0xcc, 0xbc, 0xdc, 0xbc, 0xdd, 0xdc, 0xcc, 0x9c, 0x87, 0x56, 0xcb,
+    0xce, 0xbd, 0x9b, 0xdc, 0xcd, 0xcc, 0xca, 0xbc, 0xcc, 0x9d, 0xbb, 0xcb, 0xcc, 0xaa, 0xcd, 0xcc,
+    0xcc, 0xcb, 0xcc, 0xbc, 0xcc, 0xcc, 0xcc, 0xcc, 0x9b, 0x84, 0xc8, 0xcc, 0xbb, 0xbb, 0xc8, 0xcc,
+    0xbc, 0x7a, 0xbc, 0xcb, 0xcc, 0xcc, 0xb6, 0xbb, 0xdc, 0xcc, 0xcc, 0xcd, 0xcd, 0xcc, 0xcc, 0xcc,
+    0xcc, 0x9a, 0xbb, 0xbc, 0xec, 0xee, 0xbe, 0xcb, 0xde, 0xbc, 0xba, 0xbb, 0xbc, 0xcb, 0xcb, 0xa8,
+    0xca, 0xcb, 0xbc, 0xcd, 0xcc, 0xcc, 0x78, 0x58, 0xc9, 0xcc, 0xcc, 0xa9, 0xec, 0xed, 0x9b, 0xc9,
+    0xdd, 0xab, 0xdb, 0xbc, 0xaa, 0xab, 0xcb, 0xca, 0xbc, 0xdb, 0xcc, 0xbb, 0xbc, 0xcc, 0xcc, 0xcc,
+    0xcc, 0xcc, 0x49, 0xbc, 0x89, 0x4a, 0xcc, 0xbb, 0x8b, 0xec, 0xae, 0xcb, 0xdb, 0xcd, 0xaa, 0xa7,
+    0xdb, 0xab, 0xeb, 0xcb, 0xcc, 0xcd, 0xce, 0x6a, 0x55, 0xca, 0xbb, 0xac, 0xa9, 0xcb, 0xdc, 0xbb,
+    0xca, 0xcc, 0xad, 0xab, 0xcc, 0xbb, 0xbc, 0xcb, 0xca, 0xdc, 0xcc, 0xcc, 0xcc, 0xdc, 0xcb, 0xbc,
+    0x79, 0xa8, 0xbc, 0xcb, 0xde, 0xad, 0xde, 0xee, 0xdd, 0xec, 0xee, 0xbc, 0xbc, 0xed, 0xae, 0xcc,
+    0x8b, 0xba, 0xcb, 0xdd, 0xac, 0xcd, 0xcd, 0xcc, 0xcc, 0xba, 0xcc, 0xbc, 0xdd, 0xbc, 0xba, 0xcc,
+    0xcc, 0xbc, 0xcd, 0xdb, 0xcc, 0xbc, 0xdb, 0xcd, 0x9a, 0xc9, 0xbd, 0xac, 0xbd, 0xcc, 0xbc, 0xce,
+};
+
+static const float mnist_snn_layer4_codebook[16] = {
+    -8.24483681f, -7.7474165f, -6.82901382f, -5.82874393f,
+    -4.59349442f, -3.83571935f, -2.89283538f, -2.0604744f,
+    -1.36507046f, -0.799890339f, -0.441842347f, -0.205968991f,
+    -0.0295393728f, 0.110362567f, 0.291925371f, 1.06893086f,
+};
+
+// One entry per layer; pooling layers have none
+static const SNNCodebookWeights mnist_snn_codebook[5] = {
+    { mnist_snn_layer0_indices, mnist_snn_layer0_codebook },
+    { NULL, NULL },
+    { mnist_snn_layer2_indices, mnist_snn_layer2_codebook },
+    { NULL, NULL },
+    { mnist_snn_layer4_indices, mnist_snn_layer4_codebook },
+};
+
+#endif // MNIST_SNN_CODEBOOK_H
@@ -0,0 +1,10 @@
+#ifndef MNIST_SNN_MODEL_H
+#define MNIST_SNN_MODEL_H
+
+#include "snn_network.h"
+
+// conv1 -> LIF -> pool -> conv2 -> LIF -> pool -> fc1 -> LIF, forwarding
+// membrane potentials between layers and decoding the fc1 membrane.
+extern const SNNNetwork mnist_snn_network;
+
+#endif // MNIST_SNN_MODEL_H
@@ -0,0 +1,1172 @@
+// Generated by snn_core/Tools/snn_ohwi from the mnist_snn weights.
+// Regenerate with the snn_ohwi_headers target after retraining the model.
+#ifndef MNIST_SNN_OHWI_H
+#define MNIST_SNN_OHWI_H
+
+#include <stddef.h>
+
+static const float mnist_snn_layer2_ohwi[4608] = {
+    -0.0683784112f, 0.222214758f, -0.0562359095f, -0.0526313782f,
+    -0.0295131579f, 0.0253863335f, 0.01010051f, 0.119085334f,
+    -0.041986227f, 0.270999044f, 0.0530873761f, -0.1767717f,
+    0.0478738919f, -0.0255380906f, -0.0461793318f, -0.274967521f,
+    0.0205967929f, -0.0776726454f, 0.0171076655f, 0.0348913483f,
+    0.0361883566f, 0.0243106782f, -0.00266345753f, 0.205078289f,
+    0.104622506f, 0.0278370306f, -0.0102484757f, 0.00717029907f,
+    0.0459586978f, -0.097036615f, 0.0283955615f, -0.0534833483f,
+    -0.0488963127f, 0.0428875573f, 0.0789006799f, -0.0357607901f,
+    0.0348761901f, -0.0723802745f, 0.0267453995f, 0.110392891f,
+    0.0452413671f, 0.0469570123f, 0.016557131f, 0.0375981033f,
+    -0.0402806662f, 0.0535173342f, 0.011141669f, 0.00268009421f,
+    -0.0239957478f, -0.0360460058f, 0.00527547812f, 0.0279406011f,
+    0.0544405542f, -0.0505558178f, -0.0035698826f, 0.0355792008f,
+    -0.279633969f, 0.0928512886f, 0.164367065f, -0.0630005747f,
+    0.0492518097f, 0.226801082f, -0.0343026817f, -0.0448130891f,
+    0.0668146312f, -0.0541506112f, -0.0733835325f, 0.0753163099f,
+    0.157316908f, -0.0702989697f, 0.0338325873f, 0.0897245109f,
+    0.0485990345f, -0.0159178097f, 0.222556442f, 0.010138982f,
+    0.0452236608f, 0.282121807f, 0.10338375f, 0.135211632f,
+    0.0508012697f, -0.0487746671f, -0.0423988923f, 0.0257545616f,
+    -0.0432791337f, 0.0427588746f, 0.0543788821f, 0.0814868733f,
+    0.0858442634f, 0.0778306574f, -0.00858233031f, -0.0860254243f,
+    -0.03610963f, -0.000818705943f, 0.120040387f, -0.1122775f,
+    -0.0461664423f, -0.0413050167f, 0.0652078614f, -0.0220294204f,
+    0.0609919541f, -0.0224116743f, -0.127064764f, -0.0372259505f,
+    -0.154574558f, -0.0438904762f, 0.134716362f, 0.138488889f,
+    -0.0192102976f, 0.402585059f, 0.0225648489f, 0.117635347f,
+    -0.060863547f, -0.0404350683f, -0.0426744334f, 0.0195475519f,
+    0.106539197f, 0.0391120613f, -0.0361925922f, -0.0424173549f,
+    0.122166745f, 0.0122878458f, 0.0619730018f, 0.0906046629f,
+    -0.0275695994f, 0.115590341f, -0.103553854f, -0.0306167249f,
+    0.000173697874f, 0.0207101367f, 0.0760052055f, 0.0760999843f,
+    0.0527383052f, 0.00302394247f, -0.105581939f, -0.187585339f,
+    0.141066477f, 0.0713272616f, 0.0526128933f, 0.0922538862f,
+    0.0811235085f, 0.0316938646f, 0.161493361f, 0.0407009311f,
+    0.00652513932f, 0.0735527799f, -0.0466580801f, 0.042589657f,
+    -0.0866172686f, 0.0761916488f, -0.0593939498f, 0.0698485598f,
+    -0.21023351f, 0.0624985509f, -0.120760344f, -0.182172254f,
+    -0.0441055074f, -0.0131613016f, -0.00617125863f, 0.016896354f,
+    -0.0471927039f, -0.0864600763f, -0.0240109563f, 0.00289599109f,
+    0.00716048665f, 0.0253953934f, -0.00973620731f, 0.163109496f,
+    0.047947485f, 0.066799067f, 0.184408203f, -0.127803028f,
+    0.0743242204f, -0.0699317828f, -0.0979294553f, -0.146855056f,
+    -0.0177694373f, -0.0762218684f, 0.0255554225f, 0.0435931385f,
+    0.146595135f, -0.00729068136f, 0.00364146079f, -0.197749093f,
+    -0.0142676579f, -0.236622781f, 0.228437304f, -0.189297348f,
+    0.00399804395f, 0.0263267308f, 0.0397075005f, 0.0793140158f,
+    0.0463467352f, 0.0902753323f, -0.0250160098f, -0.0790301785f,
+    0.046019759f, -0.0102577507f, -0.027548274f, -0.0425911583f,
+    0.091583319f, 0.00504333153f, 0.0437082462f, 0.181196183f,
+    0.172601506f, -0.0905034021f, -0.0132525815f, -0.0357050523f,
+    -0.0831793174f, 0.108168729f, -0.0797108114f, -0.0086940527f,
+    -0.168637618f, 0.0743197203f, -0.0715790316f, -0.0658373982f,
+    0.00982818566f, -0.140932813f, -0.114409365f, 0.0921515673f,
+    0.0661538914f, 0.123160064f, -0.056203153f, -0.0198389981f,
+    0.0383339636f, -0.0570585467f, -0.0773109496f, 0.0821693391f,
+    0.0245091897f, 0.0259105563f, 0.203937486f, -0.0569696352f,
+    -0.00608737906f, -0.165952891f, -0.24346903f, -0.00590649387f,
+    0.082688421f, -0.164059505f, 0.0769074336f, -0.0151094515f,
+    -0.0322236642f, 0.217303887f, 0.0202938821f, -0.00429810118f,
+    -0.0853701606f, 0.0227476172f, -0.175651863f, -0.026957076f,
+    -0.292202026f, -0.470615596f, -0.166353539f, 0.258259803f,
+    -0.147661224f, -0.0237706248f, -0.00710971141f, -0.0285903048f,
+    -0.0389943235f, 0.33459419f, -0.0153310997f, -0.0486218855f,
+    -0.0308406688f, 0.0683692694f, -0.264581382f, 0.0282889046f,
+    -0.218209237f, -0.291473508f, -0.322681844f, 0.247035593f,
+    -0.085082449f, -0.0414422303f, 0.0458276533f, -0.0599116944f,
+    0.0255760159f, 0.123398788f, -0.0751792938f, -0.0674502552f,
+    0.0749639645f, -0.0802632794f, -0.0524453148f, -0.036059618f,
+    -0.401460171f, 0.168658718f, -0.20450677f, 0.135632873f,
+    0.0371471643f, -0.229379401f, 0.00418249145f, 0.0660574511f,
+    0.0213877968f, -0.0179593675f, -0.0178830922f, 0.0763881058f,
+    0.0581564158f, -0.0300294962f, -0.0119688874f, 0.133868828f,
+    0.0840362906f, 0.162777022f, -0.0959637761f, -0.270896822f,
+    -0.0628525987f, 0.0413891338f, 0.0309052113f, -0.104834348f,
+    -0.0470889024f, -0.197711661f, 0.0668983459f, -0.0260894503f,
+    0.00773155177f, 0.00653323531f, 0.0646782741f, -0.0743484721f,
+    -0.0350195877f, 0.00415573781f, -0.0807064921f, -0.252774566f,
+    -0.407373309f, 0.0154918171f, 0.0130740609f, -0.199117362f,
+    -0.0570123307f, -0.333580077f, -0.0457842052f, 0.0469651222f,
+    0.0436205454f, -0.0796074867f, -0.208166823f, 0.0278913788f,
+    0.0903146788f, -0.129864573f, -0.00533337472f, -0.235551432f,
+    -0.280134648f, -0.134602711f, -0.0523146093f, 0.133054197f,
+    0.0712163374f, -0.00586764328f, 0.078400515f, 0.0573059246f,
+    0.060667932f, 0.0298781805f, 0.00665327534f, 0.00907388702f,
+    0.0425637774f, -0.0323611498f, 0.276629031f, -0.1669368f,
+    0.0254650991f, 0.352984279f, -0.0379502401f, 0.103175759f,
+    0.0632367358f, -0.13040328f, 0.0617067926f, -0.0407745838f,
+    0.133344233f, -0.0216002464f, -0.050506942f, 0.00100851897f,
+    0.0445504971f, -0.111220792f, -0.0577907935f, -0.14024286f,
+    -0.0217819773f, 0.243672267f, 0.109881215f, 0.250114828f,
+    -0.075107269f, -0.198362514f, -0.0320030674f, 0.0196996834f,
+    -0.0273739118f, 0.0801033378f, -0.147046f, -0.0185372382f,
+    -0.0500427298f, -0.280653507f, -0.0154662859f, -0.163688809f,
+    -0.248862058f, 0.0371064991f, -0.124820866f, -0.051879786f,
+    -0.0697924644f, 0.170003653f, -0.0504344031f, 0.00407642126f,
+    0.0699332803f, 0.048553735f, -0.0472576432f, 0.0446424149f,
+    0.0364206396f, -0.132735834f, 0.181983754f, 0.172655031f,
+    0.0588290654f, -0.00586258154f, 0.221487105f, 0.0332034715f,
+    0.0308533721f, 0.06616126f, -0.0283131115f, 0.0326766893f,
+    0.0970005468f, -0.0665842593f, 0.00596075738f, -0.0101331444f,
+    -0.118639186f, -0.00156939717f, 0.104058459f, 0.0638638958f,
+    -0.0478717536f, 0.0429487973f, 0.0357840508f, -0.0305171441f,
+    0.0744257718f, 0.0563069135f, -0.0544123463f, -0.0772498399f,
+    0.00581079908f, -0.0250041299f, 0.159726292f, 0.101024725f,
+    0.0268965606f, -0.359987527f, 0.269902915f, -0.00642588036f,
+    0.094009757f, 0.0953510776f, 0.0857987255f, -0.0425852612f,
+    0.0568621866f, 0.167854473f, -0.00862680934f, 0.0634329468f,
+    -0.137011394f, -0.077655457f, -0.0352285802f, -0.0108205462f,
+    -0.0411341004f, 0.154582858f, 0.0202312339f, 0.136459634f,
+    0.1282731f, 0.185834244f, 0.063058883f, 0.068755202f,
+    -0.0155873001f, 0.22219269f, -0.000500291586f, 0.00669755554f,
+    -0.184493989f, -0.00600904226f, -0.0738799497f, -0.272536427f,
+    -0.0222762302f, 0.0263340622f, 0.129934609f, 0.0730636045f,
+    0.0509028099f, 0.265750736f, 0.0847066119f, -0.0411190391f,
+    -0.0184067786f, -0.00215909909f, -0.00869333744f, 0.00277063251f,
+    5.94923877e-05f, -0.0295538604f, -0.0740023106f, 0.0251759253f,
+    -0.101125613f, -0.0348224975f, 0.205643654f, -0.0760449022f,
+    -0.00943814125f, 0.350689083f, -0.153468028f, 0.0641197637f,
+    -0.0142419143f, -0.184403911f, 0.0157790687f, 0.0158903711f,
+    0.0928192288f, -0.046013236f, -0.221363336f, -0.314937949f,
+    -0.121243797f, -0.0666470304f, 0.155814871f, 0.0318906754f,
+    -0.0431825519f, 0.420454383f, -0.0205922928f, -0.0119525027f,
+    -0.039817214f, 0.0451711901f, 0.0148985293f, -0.00826413464f,
+    -0.0848975703f, -0.0280707888f, -0.114992119f, 0.0329036377f,
+    -0.105975501f, -0.0208317004f, 0.0247823019f, 0.0208035f,
+    0.0810974762f, 0.127626359f, 0.0952480212f, 0.0184987113f,
+    0.0420667231f, 0.0102765765f, -0.0584674887f, -0.0142639978f,
+    0.0342495181f, 0.0413081571f, 0.0945107266f, 0.0765490532f,
+    -0.206856593f, -0.0393900685f, 0.135233492f, -0.142113477f,
+    0.0467471592f, 0.258749813f, 0.0581047125f, -0.100997716f,
+    -0.0168149471f, 0.105881959f, -0.0672299713f, 0.0371603668f,
+    -0.0177889559f, -0.0745605826f, -0.0823827386f, 0.053343147f,
+    0.021391524f, -0.0944189951f, -0.00592640927f, -0.0620127842f,
+    -0.0659184307f, 0.0286467094f, -0.0209897067f, -0.258475155f,
+    -0.0477595143f, 0.0993101299f, -0.0528271794f, -0.00331233954f,
+    -0.0528121367f, -0.0553070232f, -0.0508464091f, -0.15060468f,
+    0.0824377462f, 0.0851555988f, -0.0246961992f, 0.119369566f,
+    0.13644734f, -0.116494596f, 0.00745360088f, -0.202559248f,
+    -0.00453317165f, 0.00164079247f, 0.0388174877f, -0.0698377192f,
+    0.0429591201f, -0.0161061995f, -0.000709213258f, -0.176645711f,
+    -0.0425351039f, 0.107051261f, 0.219841346f, 0.202814907f,
+    -0.0412609503f, -0.0741415471f, -0.000649876078f, -0.0144032016f,
+    -0.0720825717f, -0.0392993502f, -0.0636572093f, -0.0361861587f,
+    -0.0562162325f, 0.0686521381f, -0.0127506172f, -0.141559556f,
+    -0.0912965089f, -0.0074235294f, -0.141224235f, 0.0688271075f,
+    0.11967779f, 0.0689044222f, 0.0562511533f, 0.108822651f,
+    -0.0224778466f, 0.198489323f, -0.0319928527f, -0.0674089491f,
+    0.0356681682f, 0.000481168448f, -0.0629034936f, -0.0666225553f,
+    0.120441563f, 0.182805553f, 0.0390487835f, 0.0848628879f,
+    0.0455544218f, -0.146195292f, 0.101593018f, -0.0100866873f,
+    -0.0601407886f, 0.143189937f, 0.0784235597f, 0.0766425282f,
+    -0.118450448f, -0.0466104448f, -0.0432023965f, -0.0972305909f,
+    -0.157755375f, -0.186453342f, 0.151159361f, 0.0599127337f,
+    0.0840820372f, 0.0993809551f, -0.0479088314f, -0.0133709274f,
+    -0.0197472684f, -0.083610557f, 0.00987272523f, -0.0721903443f,
+    -0.115846202f, 0.0582142994f, -0.180788592f, -0.155011281f,
+    0.0987389982f, -0.116537623f, -0.164134175f, -0.0708450899f,
+    -0.0880455002f, 0.0110586844f, 0.125894517f, 0.0397501029f,
+    0.0419064462f, -0.101425357f, 0.0802050084f, 0.0594685785f,
+    0.0453964174f, -0.0440260768f, -0.0917240232f, 0.0141116288f,
+    0.163422793f, -0.0139239654f, 0.00185539806f, 0.027719615f,
+    0.012992708f, -0.233155131f, 0.0525000133f, 0.00183407019f,
+    -0.0290895998f, 0.0403662175f, 0.0532460511f, -0.0573693737f,
+    -0.051318936f, -0.0765625462f, -0.0697255433f, 0.108146377f,
+    0.0136284474f, -0.0788452476f, 0.0290705767f, 0.228691772f,
+    0.0326766297f, -0.17307356f, 0.101676464f, 0.0250795539f,
+    -0.00772316288f, -0.31251803f, 0.0715699419f, 0.0500472896f,
+    -0.069615759f, 0.0548127592f, -0.0907411575f, -0.0398730114f,
+    0.0257082023f, -0.0353546701f, -0.0740532652f, -0.204681993f,
+    -0.0396641642f, -0.235270783f, -0.136536732f, -0.0107237305f,
+    -0.0539450459f, -0.0585572608f, 0.0487675294f, -0.0152130928f,
+    -0.146956384f, 0.0754452646f, -0.300938249f, 0.125915691f,
+    0.14609161f, 0.0146462433f, 0.00429630093f, -0.338967115f,
+    0.0896235406f, -0.132463902f, -0.0107904542f, -0.105467118f,
+    0.0795786902f, 0.0196826719f, 0.0668100864f, 0.0721649751f,
+    0.00558109349f, -0.0465549156f, 0.0296105966f, -0.0107141435f,
+    0.192628071f, 0.0799499378f, -0.00490000891f, -0.169306114f,
+    0.145087928f, -0.225696623f, -0.0159507934f, -0.184672683f,
+    0.0780372545f, -0.261886835f, -0.0287383702f, -0.0774675459f,
+    0.0692953244f, 0.0257385876f, -0.388366699f, 0.0459033288f,
+    0.160901845f, -0.160040826f, -0.0502203032f, 0.0590859503f,
+    -0.212758154f, -0.0540156327f, 0.0739885345f, -0.102513917f,
+    0.0098484857f, -0.178189054f, -0.0684973523f, -0.0445660353f,
+    -0.00690233987f, 0.008246243f, -0.157161146f, 0.0147104226f,
+    -0.16362232f, -0.217783511f, -0.221764416f, 0.0381747857f,
+    -0.0642473996f, -0.128728241f, 0.0206988622f, 0.0384661034f,
+    0.0477653742f, 0.313839763f, -0.0550332591f, 0.0656505153f,
+    -0.0055451938f, -0.0614290163f, -0.276120633f, 0.0352138914f,
+    0.109707154f, 0.0484357327f, -0.171799228f, 0.117916025f,
+    0.215442926f, -0.200503543f, 0.224269256f, -0.138519973f,
+    -0.0444483273f, -0.140782148f, 0.00375059247f, -0.0206913855f,
+    -0.044134777f, 0.0206324272f, -0.142495751f, -0.0934135765f,
+    0.158913225f, 0.0643243641f, -0.0488447919f, -0.143768176f,
+    -0.183613732f, 0.0160858743f, 0.0449793376f, 0.145486161f,
+    0.0191358328f, -0.256480515f, -0.0509215109f, -0.0118940081f,
+    0.0172801167f, 0.0412591994f, -0.0618207939f, -0.120511346f,
+    -0.168791622f, -0.154212043f, -0.229606241f, -0.031165272f,
+    -0.0486345887f, 0.291246444f, -0.0334858038f, 0.137693062f,
+    0.048420839f, 0.189740747f, 0.0292966068f, -0.0253628008f,
+    0.0401975065f, -0.0698917508f, -0.116590858f, -0.168980449f,
+    -0.349333197f, -0.29678005f, 0.0117475493f, 0.239107072f,
+    0.122782148f, 0.0827950463f, 0.0382495932f, -0.0262197554f,
+    0.0349477939f, 0.176210076f, 0.0450915694f, 0.0557407662f,
+    0.104397379f, -0.0783106312f, -0.0980399475f, -0.0344864987f,
+    -0.00645670528f, -0.223969698f, 0.174029827f, 0.120765522f,
+    0.0408849828f, 0.231285006f, -0.053737618f, -0.0321525857f,
+    -0.0775277838f, 0.0253541376f, -0.0762971267f, 0.0557980053f,
+    0.153649807f, -0.0754573196f, -0.0562687665f, 0.0182996057f,
+    -0.0533901379f, -0.201841742f, 0.224845588f, 0.0667332932f,
+    0.00950515084f, 0.338693976f, 0.0527279414f, 0.247671202f,
+    -0.0502345376f, -0.0684378073f, -0.0479681604f, 0.0751066357f,
+    -0.0453874432f, -0.0442558751f, -0.00115118572f, 0.00975638162f,
+    -0.107484937f, -0.255461365f, 0.0633542165f, -0.0829939842f,
+    -0.405268162f, 0.382139683f, -0.108210683f, 0.175542682f,
+    -0.0758064091f, -0.00558276987f, 0.0731584057f, -0.048579298f,
+    -0.0753614902f, 0.079516232f, -0.0487266406f, -0.0948024988f,
+    -0.0869925842f, 0.0643473789f, -0.0750793815f, -0.100039832f,
+    0.0558665805f, 0.064379096f, -0.119449712f, -0.0539891683f,
+    0.058609277f, 0.0117228348f, -0.0124995615f, -0.0311780982f,
+    0.119375661f, 0.0444818735f, 0.00879312772f, -0.129037499f,
+    -0.0241140779f, 0.13434352f, -0.0963625312f, -0.198031902f,
+    -0.102022119f, 0.13678588f, 0.0251410957f, 0.148959115f,
+    0.027396163f, -0.254258096f, 0.0212380402f, -0.0427366421f,
+    -0.00960527454f, -0.0472597778f, -0.222453222f, -0.0408461057f,
+    -0.0853876621f, -0.0474453568f, -0.138492197f, 0.00929667056f,
+    -0.327405483f, -0.00603702851f, -0.0981055349f, 0.0468701497f,
+    0.0266496241f, 0.1333763f, -0.0570568666f, 0.0650750026f,
+    0.097450994f, 0.0234919898f, -0.0866123214f, -0.0273709837f,
+    0.0805954933f, -0.0931197852f, 0.122900605f, 0.00494164694f,
+    0.120407939f, 0.036238201f, 0.0259089172f, 0.0115164947f,
+    -0.0144337919f, 0.0887931362f, -0.0401109271f, 0.034569703f,
+    -0.0503383093f, -0.0727290213f, -0.100600153f, -0.0419643298f,
+    0.0594135411f, -0.0118325157f, 0.296596229f, 0.150274187f,
+    -0.0792250112f, 0.225180402f, -0.0116282459f, 0.0788611993f,
+    0.0728498548f, 0.0103712892f, 0.0235895421f, 0.0603075437f,
+    0.0239720568f, -0.0469712317f, -0.189084813f, -0.247086644f,
+    -0.024785988f, -0.0612181649f, 0.0563586541f, -0.105130486f,
+    -0.137603402f, 0.368910372f, -0.0840861425f, 0.17258358f,
+    0.0511948764f, -0.0303639267f, -0.0317434482f, -0.074953869f,
+    0.10451363f, 0.0497372448f, -0.0551012605f, -0.0596065782f,
+    -0.106236793f, -0.0149501879f, 0.0784339607f, 0.0439634845f,
+    -0.115507133f, -0.213966489f, 0.0166516621f, -0.0555187277f,
+    -0.0600737557f, 0.123307757f, 0.0163335614f, 0.0354662649f,
+    -0.0530419759f, -0.02533428f, -0.0392722636f, 0.0437425748f,
+    -0.133144304f, -0.109832428f, 0.105715819f, 0.164018646f,
+    0.0202989709f, 0.0679324269f, 0.00520735886f, 0.127994984f,
+    -0.0687936172f, 0.348048717f, -0.048645746f, -0.0598486289f,
+    -0.00308724027f, -0.0353104472f, -0.0115630655f, -0.350509226f,
+    -0.0843397453f, -0.135221809f, 0.151447043f, 0.0078363074f,
+    0.104223758f, 0.0998292044f, 0.0600691997f, -0.0053236587f,
+    -0.0203835871f, -0.14220269f, 0.0624787025f, 0.0717592761f,
+    -0.0954495296f, -0.00952546857f, -0.104837552f, -0.188523188f,
+    -0.0644596815f, 0.0324090719f, 0.182664543f, 0.11423178f,
+    -0.116345815f, 0.0620202571f, 0.184904307f, 0.0603258088f,
+    -0.0446463749f, -0.108998872f, -0.0478712618f, 0.0591881201f,
+    0.123416759f, -0.0785501748f, -0.0371957161f, -0.0652542636f,
+    0.154424101f, -0.0835963935f, 0.274777234f, 0.00384007371f,
+    0.161795005f, -0.174937993f, 0.0952182785f, 0.0706618577f,
+    -0.0731250197f, 0.0699654371f, 0.00954277348f, 0.037588954f,
+    -0.0662390888f, -0.0433742329f, -0.0351533443f, 0.135190487f,
+    0.228781983f, -0.1059025f, 0.010278305f, -0.0883948952f,
+    0.119570948f, -0.158989534f, -0.0145914238f, -0.0358657911f,
+    0.0548148975f, -0.116941795f, -0.07674288f, -0.0256035924f,
+    0.0423671119f, -0.0739654154f, -0.0450065173f, -0.00411990238f,
+    0.159327284f, -0.107949726f, 0.254024923f, -0.0950031653f,
+    0.223590195f, 0.00947889592f, 0.0329784341f, -0.012492937f,
+    0.0577792823f, 0.0145619828f, -0.0305240862f, 0.0736462697f,
+    0.043458242f, -0.0441756472f, -0.12086527f, 0.0573510863f,
+    0.27846849f, 0.183467671f, -0.0999304131f, -0.157376438f,
+    0.11580807f, -0.290650666f, 0.113715321f, -0.22509551f,
+    -0.079358384f, 0.0783210546f, -0.0772682279f, 0.0133064194f,
+    0.0574722886f, 0.0782107264f, 0.0288176052f, -0.0582598075f,
+    -0.0486485362f, 0.217220008f, -0.425868899f, 0.0401392654f,
+    0.0674853995f, -0.0849628299f, 0.0722710341f, -0.167939365f,
+    0.0512168519f, 0.14135915f, -0.0589390695f, -0.0500710532f,
+    0.0372941382f, 0.0515690856f, 0.0343610123f, -0.133723125f,
+    -0.00465967134f, 0.223215252f, -0.0353380442f, 0.0938910246f,
+    -0.0503953658f, 0.0595605895f, 0.150933251f, -0.066261895f,
+    -0.0813766271f, 0.0704034865f, -0.0261597242f, 0.0238127112f,
+    -0.05091675f, -0.0692949593f, -0.0746838599f, 0.0459578969f,
+    -0.177967131f, 0.0126825878f, -0.111500725f, 0.196142942f,
+    -0.10011176f, 0.208325639f, 0.000297484366f, -0.0783224478f,
+    0.0334532857f, -0.12338046f, -0.0554298982f, 0.0575624034f,
+    -0.0642509684f, -0.0373917446f, -0.0919404849f, 0.0593278557f,
+    0.0907462239f, 0.0705538914f, 0.0492134281f, 0.0654055104f,
+    -0.185137346f, 0.102351248f, -0.0694272146f, -0.109010734f,
+    -0.0488650016f, -0.289215714f, -0.0715660378f, 0.0474869125f,
+    0.0417664982f, -0.0817883313f, -0.2184553f, -0.182977632f,
+    0.132685304f, -0.251973897f, -0.121655658f, -0.217088655f,
+    -0.268107653f, -0.440066934f, -0.0281717032f, -0.0875360593f,
+    -0.0513107292f, -0.381197035f, -0.0254745893f, -0.0294185784f,
+    0.0343704671f, 0.0235850327f, -0.170384184f, -0.099583216f,
+    0.103073634f, -0.365021735f, -0.025981538f, 0.0450940579f,
+    -0.451731503f, -0.00613546791f, -0.0343162231f, 0.143513456f,
+    -0.0784263313f, -0.155568153f, 0.0777366757f, -0.0421518013f,
+    0.00698778359f, 0.00831411313f, -0.213517696f, -0.167879015f,
+    -0.116033792f, -0.394239962f, -0.266709805f, 0.190289631f,
+    -0.25496307f, 0.0170648862f, 0.110371582f, -0.0487965308f,
+    -0.0627289638f, 0.049820032f, 0.0744336247f, -0.0687086508f,
+    -0.00182145124f, 0.0595282316f, -0.0819540173f, -0.0649762899f,
+    0.309171468f, -0.0814060867f, -0.0329973362f, -0.144290566f,
+    -0.06671229f, -0.412732035f, 0.039864663f, -0.23647742f,
+    -0.0773122236f, 0.0121423006f, -0.0550106578f, 0.0175554659f,
+    0.125945389f, 0.061549902f, 0.070395045f, -0.000730168133f,
+    -0.0617896914f, -0.0519767627f, -0.0113034444f, 0.0472869575f,
+    -0.0336567648f, -0.0992468894f, -0.00166625727f, 0.0595858209f,
+    0.0457220487f, -0.228321478f, 0.0370695107f, -0.0102594793f,
+    -0.0498469919f, 0.0512068272f, -0.0225549322f, -0.0120388884f,
+    0.0663438588f, -0.341658831f, 0.029395625f, -0.205339447f,
+    -0.375236183f, 0.148529977f, 0.0880063996f, 0.160409093f,
+    0.0490935855f, 0.256509602f, 0.0314508788f, -0.0207294729f,
+    0.0442766398f, 0.0811139643f, 0.00425106008f, -0.0632943958f,
+    0.109926403f, 0.103122436f, -0.112450927f, 0.0126039935f,
+    0.187030271f, 0.0136219813f, 0.16211912f, -0.10706573f,
+    0.0187466051f, 0.329039425f, -0.0553539917f, -0.0471848473f,
+    0.0227812659f, 0.0429367721f, -0.0377774872f, -0.181833908f,
+    -0.0334674418f, -0.0569655076f, -0.0730006322f, 0.0975914523f,
+    0.036682535f, -0.0417297371f, -0.033261355f, -0.115767501f,
+    -0.0709224194f, 0.161880314f, 0.0229467358f, -0.059993349f,
+    0.155749381f, -0.0754390508f, -0.119002327f, -0.0925437957f,
+    0.135015547f, -0.241510704f, 0.253517866f, 0.175932288f,
+    0.155367315f, -0.0065212925f, 0.0667821541f, 0.113126881f,
+    0.0656767935f, 0.112469107f, -0.0133719444f, -0.0450869314f,
+    0.0372924879f, -0.050239861f, 0.00515634054f, 0.195493028f,
+    -0.00572231831f, 0.141749904f, -0.00497238478f, 0.11917384f,
+    -0.0185949989f, -0.0993329287f, -0.0337390937f, -0.0181072149f,
+    0.0595673621f, -0.117253326f, 0.0416065566f, -0.0357466042f,
+    0.0614872351f, 0.0154239442f, -0.00492193317f, -0.178179011f,
+    -0.15581885f, 0.0694356337f, -0.192834064f, -0.0249587316f,
+    -0.0867832825f, -0.243138492f, 0.0644463673f, -0.0702010468f,
+    -0.00142199802f, -0.127741814f, 0.0732746869f, 0.0214752257f,
+    0.0201835241f, 0.0608211681f, -0.0496437922f, 0.0539711565f,
+    0.0128956484f, 0.0888990462f, -0.300034016f, -0.264266431f,
+    -0.271811754f, -0.29925403f, 0.0194809996f, -0.0358450077f,
+    0.0595667064f, -0.125422567f, 0.0621878207f, 0.0247617867f,
+    -0.129322499f, 0.0438959114f, -0.15671587f, -0.00139455276f,
+    0.20589f, 0.165228844f, -0.125435084f, -0.12751396f,
+    -0.271392614f, 0.0918562412f, 0.0833128318f, -0.0321636312f,
+    0.0654271469f, -0.230114132f, -0.011637589f, -0.0680404603f,
+    -0.0640507117f, 0.0600081012f, -0.177595899f, -0.0193385594f,
+    0.159409955f, -0.091552794f, 0.0453258529f, -0.0851953179f,
+    -0.298242956f, -0.203705728f, -0.0884213671f, -0.0207158756f,
+    0.0186370723f, -0.381959796f, -0.0175173581f, 0.0778408274f,
+    0.0182441361f, -0.0520971827f, -0.263889194f, -0.0992467925f,
+    0.170950279f, -0.142795324f, -0.0513981096f, -0.0045361435f,
+    -0.222646102f, -0.101286925f, 0.0220649913f, -0.0317429751f,
+    -0.00925686955f, -0.124458097f, 0.00603548717f, 0.0285963323f,
+    0.172022089f, 0.00705501437f, -0.233417258f, 0.000468951155f,
+    0.355987519f, 0.0570151545f, 0.19296056f, 0.154406101f,
+    -0.0171328112f, -0.0241890382f, 0.162157893f, 0.13211529f,
+    0.045109313f, 0.0638620853f, 0.0649640709f, 0.0609342866f,
+    0.0281671453f, 0.0536231212f, -0.155984193f, -0.0493584983f,
+    0.228910193f, 0.0887391269f, 0.166339338f, 0.159204632f,
+    -0.0860271156f, 0.0874839723f, 0.0483164527f, 0.0270764939f,
+    0.0281165056f, -0.0237145647f, -0.00790481828f, 0.0628511235f,
+    0.0514657162f, 0.0773057193f, -0.0276900362f, -0.00230365805f,
+    0.033599481f, -0.113407262f, 0.0838324353f, 0.0864980593f,
+    -0.087959148f, 0.0774216056f, 0.0505767241f, 0.117571734f,
+    0.0763676763f, 0.0609573722f, 0.0227447953f, -0.00932194851f,
+    -0.0114714084f, -0.0807955787f, 0.0626568347f, 0.0166546833f,
+    0.0516558662f, 0.129337355f, -0.099720642f, -0.215129107f,
+    0.0996017158f, 0.0368667096f, -0.0648933798f, -0.225552931f,
+    -0.0241150074f, 0.05390938f, 0.0131116509f, -0.0162939038f,
+    0.0602439083f, 0.00344396639f, -7.03439073e-05f, 0.18227604f,
+    0.0249915309f, 0.133751661f, 0.210152775f, -0.124220952f,
+    -0.0138731236f, -0.0176317673f, -0.0707089007f, 0.0599865876f,
+    -0.0725297332f, 0.129617259f, 0.0690131411f, 0.0358116552f,
+    0.0176264402f, 0.0619339347f, -0.0503607132f, 0.0580871291f,
+    0.234767184f, 0.0682053268f, -0.133826315f, 0.155367255f,
+    0.0625448227f, -0.0251129437f, 0.0583077483f, -0.0512504354f,
+    -0.0643346831f, 0.104488879f, -0.0388687067f, 0.0285284817f,
+    -0.0358419716f, -0.0102442801f, -0.0137375854f, 0.103338979f,
+    -0.0826416761f, 0.212067544f, -0.0681180209f, -0.139342397f,
+    0.138491362f, -0.0495290868f, 0.000288615149f, -0.186068386f,
+    0.0771076083f, -0.00556351896f, 0.0746495873f, -0.020655483f,
+    0.0140227871f, 0.0604495928f, 0.0915054306f, 0.031744346f,
+    -0.0651186556f, 0.139065638f, -0.0354427807f, 0.0419445634f,
+    -0.0342442356f, -0.0659880787f, -0.0100012356f, -0.0950758085f,
+    0.0638300478f, -0.00783175137f, -0.0662810132f, 0.0279090311f,
+    0.0375250615f, 0.0541866235f, -0.253957182f, -0.106877707f,
+    0.20474115f, -0.0760627538f, -0.257720083f, 0.0539566092f,
+    -0.259543002f, -0.0583531782f, 0.00876540318f, -0.100588605f,
+    0.0156371593f, -0.0199976992f, 0.00133546197f, 0.0185733251f,
+    -0.0705223531f, -0.0388102159f, 0.149472088f, -0.110192239f,
+    -0.202745408f, 0.0614030436f, 0.186606303f, -0.0281948745f,
+    0.0914280638f, 0.200830802f, -0.00343604456f, -0.076891996f,
+    0.064319931f, -0.0438823365f, 0.0242219083f, 0.0360304043f,
+    0.0446570739f, -0.064034164f, 0.0771520808f, -0.00437009847f,
+    -0.0474032387f, -0.186554402f, 0.22252439f, -0.00794851407f,
+    -0.0573483147f, 0.255015939f, 0.0511498228f, 0.124341406f,
+    -0.0682723448f, -0.246272936f, 0.0248952117f, -0.0428195111f,
+    0.0648116246f, -0.0331228897f, -0.108489953f, -0.137510225f,
+    0.0157332551f, -0.223000988f, 0.0212150645f, -0.0999368206f,
+    -0.192482993f, -0.00435743527f, -0.122668959f, 0.135635167f,
+    0.0389336348f, -0.148777544f, 0.0267647114f, -0.00615491485f,
+    0.0209551658f, 0.0135405269f, -0.13556461f, -0.0109629882f,
+    0.155642003f, 0.119149439f, -0.0437321477f, 0.0934977308f,
+    -0.17112188f, -0.0964274555f, -0.0131952306f, -0.022539176f,
+    0.0225428846f, 0.130438894f, -0.0495583415f, -0.0616311245f,
+    -0.0771104991f, -0.0469570458f, -0.0366495773f, 0.103335567f,
+    0.122974955f, 0.161564112f, -0.017150294f, -0.124564819f,
+    0.202680871f, -0.00995352957f, -0.0624637902f, -0.0412543081f,
+    -0.015855372f, 0.123631142f, -0.0642345548f, 0.0237881541f,
+    -0.141466364f, -0.00623977184f, 0.0694520697f, 0.139377072f,
+    0.0479613058f, 0.110590421f, 0.0480081663f, -0.0445095971f,
+    0.158909202f, -0.0589588769f, 0.0530241095f, -0.0558037646f,
+    0.0726222992f, 0.0943120942f, 0.0502399206f, -0.0707762465f,
+    0.0245753024f, 0.0561858825f, 0.114326753f, 0.0434913263f,
+    0.0873944759f, 0.259567767f, -0.0439406112f, -0.273264527f,
+    0.0525937825f, -0.208245963f, -0.0898049548f, -0.27100268f,
+    0.041888237f, 0.0625969768f, 0.0384530127f, -0.0366854891f,
+    0.00535588246f, 0.055306416f, -0.1935478f, 0.0731873736f,
+    -0.0336493179f, 0.172085762f, -0.150077432f, -0.102664284f,
+    0.0767902359f, -0.07541015f, -0.10324122f, -0.18175973f,
+    -0.0692456216f, -0.00793411676f, -0.0537016317f, -0.0634980649f,
+    -0.0690131113f, -0.0615732595f, 0.0269073918f, -0.083296828f,
+    -0.217282325f, 0.229084477f, -0.0232594572f, -0.0165544953f,
+    -0.03526574f, 0.0768832415f, 0.0981002524f, -0.136243403f,
+    -0.0461364202f, 0.0745796412f, 0.0271413624f, -0.0831606314f,
+    -0.132744864f, -0.0612208061f, -0.0346335098f, -0.0870001838f,
+    -0.117631175f, 0.060107436f, -0.0586646833f, -0.0450535454f,
+    0.117972933f, 0.204578072f, 0.0298790801f, -0.217107072f,
+    0.0502522215f, -0.0194846988f, 0.0670226663f, 0.0371877551f,
+    -0.0621316433f, -0.0213692691f, 0.0642267168f, -0.117829658f,
+    -0.114708066f, 0.0628097653f, 0.0348348357f, 0.179914519f,
+    0.0905146673f, 0.151742354f, -0.0195692219f, 0.061464455f,
+    0.0405492596f, -0.0370792821f, -0.0432094634f, 0.0174660292f,
+    0.0845684782f, 0.000237693399f, -0.0859223828f, 0.0282825939f,
+    -0.0913920924f, -0.186442137f, 0.157067716f, 0.15047729f,
+    0.0267379526f, 0.242605701f, 0.0287233982f, 0.0093299225f,
+    -0.00939464569f, 0.272885114f, -0.0120855868f, -0.00538316369f,
+    0.0964048356f, -0.0153392656f, -0.224950254f, 0.123517647f,
+    0.163319886f, -0.00887769181f, 0.0247621089f, 0.130147099f,
+    0.0491186231f, -0.204602942f, -0.129810676f, -0.117899761f,
+    -0.0027216475f, 0.295274466f, -0.0633101687f, 0.0816357732f,
+    0.01867171f, -0.0445674062f, 0.0968502015f, 0.0167537164f,
+    0.241784811f, 0.215313286f, 0.183829397f, 0.0256538596f,
+    0.227741003f, -0.18737635f, -0.00937899668f, -0.111818418f,
+    0.0442075729f, 0.0723260641f, -0.0575198457f, 0.0420669317f,
+    0.0774088576f, -0.000785271346f, 0.120147698f, 0.0556099601f,
+    -0.14619042f, 0.0537862442f, 0.0717047527f, 0.0928489938f,
+    -0.0770879313f, -0.0254385509f, -0.00997226499f, 0.139717579f,
+    -0.0535647571f, 0.384842902f, -0.073515892f, 0.00385415554f,
+    -0.116394095f, 0.0815618783f, 0.000871044933f, -0.175753698f,
+    0.16306746f, 0.211453438f, -0.0642772168f, 0.485143334f,
+    0.182911783f, 0.0162750259f, 0.0536438711f, -0.00359415379f,
+    0.052673649f, 0.338889897f, 0.0558340475f, -0.030447375f,
+    0.0307600982f, -0.0388757996f, -0.161650121f, -0.214067534f,
+    -0.0475509241f, -0.0792374089f, -0.169940382f, 0.206816778f,
+    -0.0887682885f, -0.160535097f, -0.0150684463f, -0.147433817f,
+    -0.0746427402f, 0.0254463684f, -0.0520118698f, 0.0785843879f,
+    0.0125406384f, 0.0493461303f, -0.0278150979f, 0.0952998623f,
+    0.0239069778f, -0.141531959f, 0.0541097075f, -0.0296698269f,
+    -0.0835469291f, 0.0603206195f, 0.00780190155f, 0.0713904053f,
+    0.0405314863f, 0.073489897f, 0.000862628222f, -0.0700440854f,
+    -0.0720864832f, -0.0555257015f, -0.201601103f, -0.0168032628f,
+    -0.0689429194f, -0.0325868577f, 0.0151762441f, -0.0295550767f,
+    -0.0588628352f, -0.186619535f, 0.0413886495f, -0.140310973f,
+    0.072063826f, 0.0293291006f, 0.000474462926f, -0.0241417289f,
+    -0.039279718f, -0.0279061496f, -0.219877094f, 0.0427013449f,
+    -0.243121654f, 0.0694460422f, -0.0902540833f, 0.0946657062f,
+    -0.126174018f, -0.086836569f, -0.0876888782f, -0.0403237008f,
+    0.0789183974f, -0.0011699039f, 0.0284859352f, 0.0417072996f,
+    0.00299729872f, -0.0686316714f, 0.0790838003f, -0.0747113377f,
+    0.0306971967f, -0.0647575185f, 0.0571948104f, -0.0822462663f,
+    -0.145630449f, 0.135793775f, -0.0381688438f, 0.0480696261f,
+    0.0156570878f, 0.122546278f, 0.0279924478f, 0.0297208838f,
+    0.0600358397f, -0.0474288389f, 0.183752969f, -0.0779258683f,
+    0.0405550152f, -0.0603953041f, 0.0546696819f, 0.0132986801f,
+    0.00325283431f, -0.092044279f, -0.138439223f, 0.141947925f,
+    -0.0529420003f, -0.126461223f, 0.0466605835f, -0.02404074f,
+    -0.0282018147f, -0.0717225075f, -0.0447306521f, 0.0512022488f,
+    -0.108760126f, -0.0188517272f, -0.177974284f, -0.140281379f,
+    -0.132208526f, -0.0159998648f, -0.0610458367f, -0.0345635973f,
+    0.0716835186f, -0.0736459643f, -0.0517999455f, -0.0679141209f,
+    -0.0280551203f, 0.015447557f, 0.131548688f, -0.0494171493f,
+    -0.183293626f, 0.195142016f, -0.274235278f, 0.207886696f,
+    -0.000620327832f, -0.281340033f, 0.0690458715f, -0.318661213f,
+    0.0166478455f, 0.040501859f, -0.0292989425f, -0.0189895537f,
+    0.0984652787f, -0.0590465665f, 0.0533110388f, 0.101846464f,
+    0.0270785037f, 0.113065191f, -0.0202275738f, 0.0408507921f,
+    0.157918423f, 0.0398870409f, 0.11812859f, 0.0588022545f,
+    -0.0665572509f, -0.240599439f, 0.0643311068f, -0.0708661601f,
+    -0.0889398158f, -0.00880958699f, 0.0524713732f, -0.172112942f,
+    -0.172121018f, -0.0129234446f, -0.187795505f, -0.265369058f,
+    -0.28732273f, 0.136447653f, 0.0064794044f, 0.0468723439f,
+    0.0708251595f, 0.0109546678f, 0.0357256457f, 0.00185351574f,
+    -0.00457849121f, 0.0114000738f, 0.14151901f, 0.0892288685f,
+    -0.213562369f, -0.0309092421f, -0.400578946f, 0.253311008f,
+    0.233642936f, -0.28192547f, 0.0158462785f, -0.239473328f,
+    0.0748167261f, 0.122137778f, -0.0463517718f, -0.0353883207f,
+    0.0335946046f, 0.0422143564f, 0.136720002f, 0.0609978363f,
+    0.0699871927f, 0.200693041f, 0.0593915209f, -0.0946588144f,
+    -0.0798860863f, -0.0220822748f, -0.0328413211f, 0.0180634707f,
+    0.055986207f, -0.211102843f, 0.0637264773f, 0.0281267371f,
+    -0.0131830806f, -0.0729554221f, 0.0928689986f, 0.202729061f,
+    -0.0549695604f, -0.16134949f, -0.101980351f, 0.11527165f,
+    -0.122453548f, 0.101037323f, 0.119863048f, 0.176653683f,
+    0.0674026012f, -0.00872652419f, 0.0490921661f, -0.0305069685f,
+    0.0430236198f, -0.0701198503f, 0.209598571f, 0.287758023f,
+    0.0251910035f, 0.00742712151f, -0.116922967f, 0.281106591f,
+    0.291327119f, -0.154842019f, -0.000470635772f, -0.0965916365f,
+    0.025289258f, -0.242138445f, 0.0374720618f, -0.0580814183f,
+    0.0786760524f, -0.0243248753f, -0.091373831f, 0.194878429f,
+    -0.308251709f, -0.0540243611f, -0.284837097f, 0.0715058967f,
+    -0.154785007f, -0.134851843f, 0.108118974f, -0.00638836995f,
+    -0.0784647167f, 0.0035764554f, -0.0792120919f, -0.0192126837f,
+    0.00561644509f, -0.0169712901f, -0.144218758f, 0.135437429f,
+    -0.118626483f, 0.0476537719f, -0.183765262f, 0.101145677f,
+    0.0121737616f, 0.0548954047f, 0.116646774f, -0.0375550985f,
+    0.0703940019f, 0.152218983f, 0.0335052535f, -0.0594521277f,
+    -0.00929930527f, -0.041783683f, 0.0931296647f, -0.032877516f,
+    0.00960062724f, 0.105009124f, -0.134910092f, -0.231151491f,
+    0.00992727838f, 0.0190815534f, -0.10753227f, 0.0895892829f,
+    0.00832110643f, -0.359870255f, -0.00884712767f, 0.0604286715f,
+    -0.0494617298f, -0.0791535005f, -0.186712593f, 0.0959664956f,
+    -0.26309523f, -0.0124952197f, -0.162296236f, 0.0354083367f,
+    -0.0134646529f, -0.0441891067f, -0.0155707803f, -0.0723980665f,
+    0.0663738474f, 0.162193611f, 0.0414201319f, -0.0536006913f,
+    -0.0329843573f, 0.0769465864f, 0.141715124f, 0.127595901f,
+    -0.295093596f, -0.0150029818f, -0.192195728f, 0.0834200233f,
+    0.1323632f, -0.0626807511f, 0.164521679f, 0.0400217883f,
+    -0.0220019035f, 0.215084836f, 0.0652822852f, -0.0129086878f,
+    -0.00435347389f, -0.0202432182f, 0.123545714f, 0.128929138f,
+    -0.145277277f, -0.184037313f, -0.0555261262f, -0.252347231f,
+    -0.0657813922f, 0.00990298484f, -0.116148427f, 0.0835350677f,
+    -0.0201393869f, -0.265786171f, -0.0222938173f, 0.048882287f,
+    0.104763478f, -0.0678358376f, 0.244119376f, 0.348237813f,
+    -0.0688687712f, -0.130076587f, -0.218491763f, 0.0490837507f,
+    -0.0539425276f, -0.068518512f, 0.00498177391f, 0.027961202f,
+    -0.0401116014f, 0.121611327f, -0.0274948776f, -0.0659573227f,
+    -0.0129073448f, 0.010444562f, 0.130470559f, 0.0170260146f,
+    0.0294915512f, 0.00519220671f, -0.264401704f, 0.108547531f,
+    0.327812821f, -0.17282249f, 0.0554960929f, 0.155445188f,
+    0.0734294802f, 0.282449782f, 0.0713184178f, 0.0678443611f,
+    0.0344164446f, 0.0150022013f, 0.13223727f, 0.00700827502f,
+    -0.466531843f, -0.167825222f, -0.0350195654f, -0.133138463f,
+    0.121818662f, -0.0650385395f, 0.0246878024f, 0.142722905f,
+    0.0355984978f, -0.0777776688f, 0.0503443778f, 0.070875302f,
+    0.00234519597f, 0.0334786698f, -0.0957561284f, 0.085845992f,
+    0.0937104225f, -0.191547334f, -0.00627715839f, -0.113139719f,
+    -0.0158259664f, 0.207873836f, -0.0174401551f, 0.0493061356f,
+    0.0708724856f, -0.0406184904f, 0.0513528213f, -0.0627105832f,
+    0.0348663703f, -0.0476190858f, -0.0843068659f, -0.106598914f,
+    -0.0754297748f, -0.13489674f, -0.0742749944f, -0.0939979181f,
+    0.0602317303f, -0.132190987f, 0.096893318f, 0.0498494022f,
+    0.0175788701f, 0.272255957f, -0.0454123132f, 0.0286798589f,
+    0.0887249187f, -0.0743174553f, 0.016667271f, 0.0289605949f,
+    0.174116716f, 0.0526378155f, 0.0644091219f, -0.121337101f,
+    0.112859137f, -0.23384431f, -0.0837447941f, -0.190827221f,
+    -0.0425452702f, 0.319677204f, 0.0164587013f, 0.059877526f,
+    0.0336821377f, 0.0441845171f, -0.0826597661f, -0.0630660206f,
+    -0.188532367f, -0.3084144f, -0.054317832f, 0.500352442f,
+    -0.0155276461f, 0.0821259022f, 0.0809029937f, -0.0527772494f,
+    -0.0361032896f, 0.238271981f, 0.0740543902f, -0.0636407137f,
+    -0.0556814484f, 0.0754653737f, 0.0591688007f, -0.0564214699f,
+    0.158026189f, -0.0406177305f, 0.0306617543f, 0.157289252f,
+    0.156618625f, -0.243841007f, 0.0358877108f, 0.000569795957f,
+    -0.0661256462f, 0.154506862f, 0.0278148465f, 0.0538563728f,
+    0.0448293239f, -0.0119157536f, -0.0593626201f, -0.123418339f,
+    0.223929301f, 0.123358928f, -0.352757514f, 0.216601804f,
+    0.0491819829f, -0.368080616f, 0.0112779727f, -0.0520231389f,
+    -0.0571678691f, -0.07135842f, 0.000748078048f, 0.0572980046f,
+    0.0207865573f, -0.0342380926f, -0.191677675f, -0.023586981f,
+    0.00671301456f, -0.584881842f, -0.138950273f, 0.00563954422f,
+    -0.422328144f, 0.161352977f, 0.0342083611f, 0.242810413f,
+    0.0121819675f, 0.044048585f, -0.0156221688f, 0.0435137264f,
+    0.00557158282f, -0.0189541876f, -0.179948688f, -0.168629199f,
+    -0.197262734f, -0.219285697f, -0.405162364f, 0.0348984972f,
+    -0.520445704f, -0.11306721f, -0.0396153331f, 0.0053665461f,
+    0.0513105802f, -0.0882783532f, 0.0666038319f, -0.082075268f,
+    -0.00645389501f, -0.0247948971f, -0.129139349f, 0.054527238f,
+    0.256348222f, -0.12647368f, -0.333630681f, -0.0818187892f,
+    -0.266930014f, -0.251618087f, -0.0338012502f, -0.241513729f,
+    0.0794850141f, 0.286624581f, 0.0454815924f, -0.0683330223f,
+    -0.0276047587f, 0.00677063083f, -0.187169492f, -0.0513650291f,
+    0.0953832865f, -0.0497489721f, 0.250537813f, 0.0114536406f,
+    0.122516409f, 0.0139388368f, 0.0879479498f, -0.0623698831f,
+    0.0470300317f, 0.193420067f, -0.077586107f, 0.0373940282f,
+    0.0321244672f, 0.0255611353f, -0.127098888f, -0.178264737f,
+    0.140336961f, -0.100329652f, 0.131071851f, 0.0669391006f,
+    0.0482440852f, 0.187794641f, 0.0390993208f, 0.0341525823f,
+    -0.0685012564f, 0.239606082f, -0.0632673055f, 0.0730912387f,
+    0.115290888f, -0.00705752801f, -0.257311046f, -0.051569175f,
+    0.0808433816f, -0.0994646922f, 0.073263213f, 0.129340798f,
+    0.0115307458f, 0.214121655f, -0.0890779346f, 0.0552330948f,
+    0.000926762819f, 0.0182807166f, -0.0485209748f, -0.0680472851f,
+    0.0120101832f, -0.0779920146f, 0.0668355897f, 0.0139493737f,
+    -0.387565911f, -0.0740799457f, -0.179088503f, 0.08605133f,
+    0.0621290319f, 0.0162688028f, 0.097041823f, -0.27526629f,
+    -0.00311881304f, -0.05270705f, -0.00742866611f, 0.000726113736f,
+    -0.0316240899f, -0.059817683f, -0.149656594f, -0.141798034f,
+    -0.219157711f, -0.163018435f, -0.0677506924f, 0.133847922f,
+    -0.058341179f, -0.012828785f, 0.108041741f, 0.108217008f,
+    0.0071331067f, 0.064773418f, -0.0331594162f, -0.0717723519f,
+    -0.0836064816f, -0.0311723854f, -0.181157336f, 0.125720263f,
+    -0.0108916946f, -0.15757075f, -0.05699284f, 0.0718894452f,
+    0.0642039701f, -0.0469713733f, 0.0154483886f, -0.00747118285f,
+    0.0385304205f, -0.138394639f, 0.0778449774f, 0.0447547063f,
+    0.0742936507f, 0.0566987023f, 0.0284970831f, -0.210057214f,
+    -0.325787991f, -0.0553711131f, -0.101971306f, 0.0223162137f,
+    -0.292992741f, 0.26561594f, 0.0521951206f, 0.13970755f,
+    -0.0549741089f, -0.142561972f, -0.0784818679f, 0.0634394735f,
+    -0.12869741f, -0.0347271375f, 0.00212816964f, 0.103717916f,
+    -0.121972889f, -0.160357565f, -0.069736369f, 0.160835072f,
+    -0.168931589f, 0.105435483f, -0.0453182571f, -0.0388840847f,
+    0.0273758769f, 0.0310106371f, 0.00939243101f, -0.0499404073f,
+    -0.0111390315f, 0.0217148773f, -0.0250994712f, 0.0877861977f,
+    0.0757614151f, 0.0410209037f, -0.247764871f, -0.00905750133f,
+    -0.082066834f, -0.175956428f, -0.00681290962f, -0.206455827f,
+    0.00947102904f, 0.147046551f, -0.0686561763f, 0.0272401478f,
+    0.111181788f, -0.083196044f, -0.0486947149f, -0.0829102993f,
+    0.123092502f, -0.0224442817f, 0.256907165f, 0.0882504061f,
+    -0.0719729513f, 0.243096888f, 0.133781895f, 0.115043104f,
+    -0.059410166f, 0.172852665f, -0.0474592857f, -0.0727625489f,
+    0.0116960797f, 0.00860153697f, -0.107443981f, -0.0209325645f,
+    0.170479402f, -0.0969713554f, 0.100470386f, -0.0224831365f,
+    -0.117731705f, 0.232677385f, -0.0768309161f, 0.0730813891f,
+    -0.0785049051f, -0.149067789f, 0.017352175f, -0.076606743f,
+    0.14713484f, -0.00360723352f, -0.100731798f, -0.116112217f,
+    0.0659486651f, -0.10834273f, 0.100283958f, -0.0813403651f,
+    -0.0812260062f, 0.100401118f, 0.0430124328f, -0.0894859433f,
+    -0.080767028f, -0.042571906f, 0.0548223183f, 0.0582216792f,
+    -0.0191447269f, -0.0633690879f, -0.207294688f, -0.103796713f,
+    -0.150224209f, -0.194759384f, -0.0496486984f, 0.138921946f,
+    -0.0421093591f, -0.000541153422f, -0.0420784429f, -0.0435109325f,
+    0.0831432268f, 0.254779458f, -0.0538140833f, -0.0472599678f,
+    -0.0300122425f, -0.0752045959f, 0.10299053f, -0.163631454f,
+    -0.0750322863f, -0.12924239f, 0.231232569f, 0.247832164f,
+    -0.00784307718f, 0.231941774f, 0.00985804293f, 0.073618643f,
+    -0.0655223727f, 0.247676894f, -0.045600336f, 0.0310607757f,
+    -0.0488632768f, 0.0333236083f, -0.11851532f, -0.148629829f,
+    0.0358036496f, -0.144908115f, 0.0215412639f, 0.294813782f,
+    0.0574331433f, 0.0664389431f, -0.0312170144f, -0.00583920721f,
+    0.0209944658f, -0.170256659f, 0.0724419877f, 0.0414840281f,
+    0.0504006706f, 0.0102048125f, -0.29228273f, 0.157604054f,
+    0.00705767004f, -0.368891567f, -0.0612687208f, -0.0823956877f,
+    -0.210003257f, -0.0842425972f, -0.0890096053f, 0.0920217708f,
+    -0.0421372876f, 0.0772623271f, 0.00110197067f, 0.0572668426f,
+    -0.00490277307f, -0.0501791835f, 0.0818182603f, 0.0668475926f,
+    0.165589124f, -0.0394194052f, -0.175231308f, 0.0455999523f,
+    -0.160898104f, -0.0617771111f, 0.0687627271f, -0.195925787f,
+    -0.0106515987f, 0.13825193f, -0.0250502136f, 0.0142358942f,
+    -0.00579524739f, 0.0455897972f, 0.0375427157f, -0.0386008061f,
+    -0.109965548f, -0.0291195679f, -0.176499844f, -0.0103015648f,
+    -0.159990773f, -0.0484585129f, 0.0145008061f, 0.0500770323f,
+    -0.0572499931f, -0.308641553f, 0.0775816292f, -0.0128562059f,
+    -0.0929601789f, 0.0802954063f, -0.0192070547f, 0.0596598797f,
+    0.03530287f, -0.0758775398f, 0.0320357047f, -0.122347765f,
+    -0.0479530729f, -0.0568721332f, 0.00537981465f, 0.0169383734f,
+    -0.0159974806f, -0.317895323f, 0.0075645647f, -0.0367731564f,
+    -0.0751514286f, 0.0280847661f, -0.0935014337f, 0.148463339f,
+    0.138946697f, -0.22548607f, -0.0145749943f, -0.182303429f,
+    -0.280102998f, 0.15103358f, -0.0542241558f, 0.0388906598f,
+    -0.0529156253f, 0.0656797215f, -0.0412087739f, 0.0542944297f,
+    0.0605327226f, 0.00535714626f, 0.0621407852f, 0.216740131f,
+    0.0411258861f, -0.138293028f, -0.117540412f, -0.113357008f,
+    0.0232867692f, 0.0298370495f, 0.0296254158f, -0.0194761585f,
+    0.0364891402f, 0.191258743f, -0.0323432609f, 0.0709211677f,
+    -0.0644202679f, 0.019342145f, -0.195881546f, 0.126633868f,
+    0.343951583f, -0.153387949f, 0.183041275f, -0.0346390828f,
+    -0.0340328775f, 0.0972500965f, 0.00682866015f, 0.0959637985f,
+    0.0358864777f, 0.0197735447f, -0.020069113f, -0.0243081357f,
+    0.0769577771f, 0.0509007983f, -0.00395308435f, 0.0299899038f,
+    0.0587038882f, -0.263200015f, 0.274892062f, -0.118846498f,
+    -0.0276538935f, 0.0162233487f, 0.00617458764f, 0.092187196f,
+    -0.0371344984f, -0.0263655875f, 0.0660187826f, -0.0709022284f,
+    -0.0755020306f, -0.0570085756f, 0.0903749466f, 0.0217881836f,
+    0.127856731f, -0.165349767f, 0.0355083533f, -0.253220439f,
+    -0.0229997449f, -0.043772731f, 0.0605018511f, -0.0810460746f,
+    0.0117486818f, 0.152077541f, 0.000952919363f, -0.0277373102f,
+    -0.0927915201f, -0.00434797024f, -0.228702918f, -0.087066628f,
+    -0.213529795f, -0.161908522f, -0.187305227f, 0.245898083f,
+    0.0402211137f, 0.0935777277f, 0.0323031098f, 0.0205279943f,
+    -0.0098689897f, 0.107660964f, 0.0419018976f, -0.0133253634f,
+    -0.116084166f, 0.00993081927f, -0.146966547f, -0.0438719355f,
+    -0.0599132143f, -0.079636015f, -0.0331198797f, 0.145985007f,
+    0.062078055f, -0.0623357594f, 0.15151459f, 0.0133348424f,
+    0.0500838459f, 0.0439513139f, -0.0331313238f, -0.0516473576f,
+    -0.0667743012f, 0.00900643133f, 0.136179805f, 0.108830586f,
+    -0.0696200132f, 0.119787246f, -0.18854557f, -0.0155360764f,
+    0.01521313f, -0.101640157f, -0.0109774219f, 0.00522002112f,
+    -0.0492880344f, -0.0842657983f, -0.0022877953f, 0.0783447623f,
+    -0.0272348765f, 0.053045474f, 0.0667400882f, 0.0353472047f,
+    -0.097772114f, 0.0504887328f, -0.0142704891f, 0.0804804116f,
+    -0.0330531001f, -0.0970579013f, 0.0724076629f, 0.0887986645f,
+    0.0757348388f, -0.0463836901f, -0.0172498636f, 0.0130404141f,
+    0.064233005f, 0.037188381f, -0.0917710811f, 0.00505100843f,
+    -0.154934779f, -0.0510937534f, -0.121717244f, 0.146318808f,
+    0.0536251999f, 0.0435939431f, 0.0559271835f, 0.0399217568f,
+    0.0132880509f, 0.0508845933f, 0.0298894048f, 0.0226607732f,
+    0.104483813f, -0.0584232807f, 0.127894327f, -0.0748137236f,
+    -0.156655043f, 0.038809225f, -0.145650208f, 0.0456297137f,
+    0.0613747425f, 0.0450132266f, 0.0835043192f, -0.0856090561f,
+    0.0378445908f, -0.0448377728f, 0.0531451106f, 0.0581874959f,
+    -0.0532969423f, 0.0489404127f, 0.179656118f, -0.0469299294f,
+    -0.0213065986f, -0.0128239365f, -0.389992088f, 0.00210131775f,
+    -0.176384047f, -0.065155305f, 0.0560978316f, 0.0523284003f,
+    -0.0255428459f, -0.165835455f, 0.0681348071f, 0.0210456066f,
+    0.0659793988f, -0.0233913958f, 0.138827056f, 0.0949680656f,
+    -0.35490787f, -0.0754623041f, -0.0187433623f, 0.12716727f,
+    0.0552068651f, -0.213999078f, 0.0468409471f, -0.0561525784f,
+    -0.00328584528f, 0.0720083341f, 0.0115980208f, -0.0103946626f,
+    0.0516167395f, 0.0645588934f, 0.186572671f, 0.059567757f,
+    -0.27581054f, -0.105995521f, 0.162789211f, 0.139580429f,
+    0.114442542f, 0.18708083f, 0.0292019583f, 0.0187055618f,
+    0.0225278549f, -0.090185985f, -0.0280043595f, 0.048304081f,
+    0.0239029489f, -0.0518832803f, 0.123034142f, 0.0214643516f,
+    -0.0622735359f, -0.235269561f, 0.11082276f, -0.186760321f,
+    -0.268124402f, 0.0101169534f, 0.0454366766f, 0.103622332f,
+    0.0020725131f, -0.29138577f, 0.0198961198f, 0.021398237f,
+    0.000837633677f, -0.0299312975f, -0.0522072576f, -0.0100864712f,
+    -0.0459626392f, -0.405950814f, -0.155509815f, 0.0349194743f,
+    -0.0592871085f, 0.0324841812f, 0.0159263834f, -0.069148086f,
+    0.0776496232f, 0.126913771f, 0.0252978709f, 0.0199029557f,
+    0.0263755247f, 0.0364820957f, -0.049519062f, 0.0284267738f,
+    -0.26236245f, -0.131534472f, 0.0761971772f, 0.240043521f,
+    0.130390197f, -0.0419605523f, -0.0202593077f, -0.0777595565f,
+    0.00197040057f, -0.138032168f, -0.0585418455f, -0.00885304809f,
+    -0.0395155214f, 0.0239968896f, 0.040521469f, -0.00616248837f,
+    -0.0121542728f, -0.045274619f, 0.00397392642f, 0.192723364f,
+    -0.0493127406f, 0.030018229f, 0.00177492748f, 0.0358498022f,
+    -0.0752752423f, 0.0300194155f, 0.0232387688f, 0.0813018605f,
+    -0.023758838f, -0.00984980725f, 0.164367333f, -0.240519539f,
+    -0.0792063177f, 0.0727069154f, -0.0357564874f, 0.128296182f,
+    0.108997479f, 0.0467370115f, 0.0070556365f, 0.171739683f,
+    -0.0623060577f, 0.0937729552f, 0.0618755743f, -0.00423627114f,
+    -0.141593054f, -0.0457670912f, 0.111992523f, 0.0437168591f,
+    -0.0549973696f, -0.104701549f, -0.0557199828f, -0.242250472f,
+    -0.106878571f, 0.327343971f, -0.0450931899f, 0.0435083918f,
+    0.0217402279f, -0.231536239f, 0.055298917f, -0.0437543914f,
+    0.0848082975f, 0.0392533951f, -0.00644833269f, 0.0997167453f,
+    -0.0350295939f, -0.11157161f, 0.0635035262f, 0.132964373f,
+    -0.0750066265f, 0.147853434f, 0.145087391f, 0.129195482f,
+    0.0463111103f, 0.0127681755f, -0.0794787109f, 0.0411995575f,
+    0.0116938492f, -0.0786561295f, 0.227994457f, -0.00534819532f,
+    -0.0882286876f, 0.057502389f, -0.0226993207f, 0.0983414054f,
+    0.0546289347f, -0.120894462f, 0.0395130962f, -0.155399889f,
+    -0.0393810272f, 0.0758157298f, -0.0721101388f, -0.0196124129f,
+    -0.00934343878f, 0.0376722626f, 0.13005814f, 0.0312294625f,
+    -0.247584805f, -0.271097958f, 0.168629527f, -0.0378935263f,
+    -0.0356438681f, 0.080681026f, 0.056165155f, 0.136733338f,
+    0.0673895404f, -0.105791651f, 0.0589760356f, -0.0804823339f,
+    -0.0112299984f, -0.0565423779f, -0.154369786f, 0.0114293471f,
+    0.107752569f, -0.304888517f, -0.0133659849f, -0.1886345f,
+    0.0276489966f, -0.0656901374f, -0.078313604f, 0.0478976071f,
+    -0.0519783907f, 0.0122092357f, -0.00179021561f, 0.0500902757f,
+    0.0362356268f, -0.0518578291f, -0.0228535235f, 0.183364481f,
+    0.0109653324f, -0.191814452f, -0.00578756025f, 0.0646260306f,
+    0.0466158241f, -0.0975204185f, -0.074948974f, -0.0845378935f,
+    0.0122877564f, 0.181681216f, 0.0115608377f, -0.0776323825f,
+    -0.0197276194f, 0.0758352429f, 0.100648113f, -0.0406027138f,
+    -0.13960658f, -0.0443641953f, -0.0762884989f, -0.0124752717f,
+    0.103552535f, 0.0691014081f, 0.12178728f, 0.0651895627f,
+    -0.0615627691f, -0.101352386f, 0.0125528378f, -0.024259638f,
+    -0.0322443247f, 0.0807415247f, 0.167919576f, 0.0617392622f,
+    -0.170930803f, 0.0246818531f, -0.0406660028f, 0.203659311f,
+    0.0484632663f, -0.0197904073f, 0.211908057f, -0.108251698f,
+    -0.0481191576f, 0.199955702f, 0.0735198557f, 0.0314502344f,
+    0.0198223777f, 0.00367793441f, 0.107312225f, 0.0955544412f,
+    -0.1937709f, 0.027410876f, -0.0434558839f, -0.0724928603f,
+    0.128953904f, 0.0427788086f, 0.0508614816f, 0.0455009043f,
+    -0.0255095866f, -0.0984579176f, 0.071492523f, 0.0641991943f,
+    0.0296430774f, 0.0149516268f, 0.173714414f, 0.125791013f,
+    -0.224189907f, -0.154726267f, -0.00101135042f, -0.194249704f,
+    -0.088360779f, 0.182099134f, 0.0295547694f, 0.0837613642f,
+    -0.0155868335f, -0.0889582261f, 0.0032257936f, -0.00111787522f,
+    -0.0817017928f, -0.0364716873f, 0.0050136745f, 0.037870463f,
+    -0.00945075322f, 0.0184729975f, -0.179347172f, -0.008123409f,
+    0.147705644f, -0.204684764f, 0.0580627359f, -0.335966885f,
+    0.0470285341f, 0.202816606f, 0.0437067151f, -0.00187188387f,
+    0.000247449178f, -0.023802897f, 0.214621216f, -0.189703181f,
+    -0.276647836f, 0.00383361848f, -0.0135128908f, 0.0879626051f,
+    0.0909161195f, 0.178520024f, 0.0985515565f, -0.0877820849f,
+    0.00622395705f, -0.0749823749f, -0.0827843696f, -0.062015526f,
+    -0.0680825338f, -0.0500826463f, 0.0515205078f, -0.0614044927f,
+    -0.165678561f, -0.199580118f, 0.0813413486f, -0.367554903f,
+    0.0664913729f, 0.24169609f, 0.100430645f, 0.0695010349f,
+    0.00171599793f, 0.109041654f, -0.0327066109f, -0.015907824f,
+    -0.0120940097f, 0.054716032f, 0.0357819609f, 0.0875619873f,
+    0.275502503f, 0.14745453f, -0.0638564229f, -0.082933262f,
+    0.161142439f, -0.0892121196f, 0.0029647979f, -0.11080195f,
+    -0.0827614665f, 0.141969875f, -0.032372158f, 0.0265111923f,
+    -0.058560878f, 0.024061989f, 0.201075435f, 0.0997508019f,
+    -0.351277918f, 0.184034273f, 0.0678242892f, -0.0507726558f,
+    0.21778664f, -0.0912872702f, 0.144275248f, -0.134563774f,
+    -0.0717964992f, -0.0611756034f, 0.0820709616f, 0.0382100567f,
+    0.0187661871f, -0.061260879f, 0.133921519f, 0.120297328f,
+    -0.0801144093f, 0.122918643f, -0.0110738808f, -0.0528276376f,
+    -0.00481915846f, 0.0298762005f, 0.172975644f, -0.147333696f,
+    0.00463140011f, -0.0179498065f, -0.0246446934f, -0.0353642218f,
+    -0.084901683f, 0.039014034f, -0.0934807509f, 0.214434624f,
+    -0.00600228179f, -0.000473220163f, -0.0877862722f, 0.078077741f,
+    0.141398147f, 0.00714035705f, 0.0731612518f, -0.0576737635f,
+    -0.0521360748f, 0.167342603f, -0.0377602689f, -0.00500692939f,
+    0.0446053259f, -0.0461187884f, 0.0803564414f, 0.128572449f,
+    -0.109785654f, 0.134517267f, -0.00150048221f, -0.171383858f,
+    0.207843423f, -0.264858752f, -0.0462603495f, -0.0240501426f,
+    0.0828730986f, 0.00226402772f, -0.0501191542f, -0.031379275f,
+    -0.0483796634f, 0.0752209872f, 0.204279467f, 0.0175484419f,
+    -0.164292499f, 0.153285593f, -0.428859115f, 0.0127314236f,
+    0.0817991942f, -0.0270299744f, 0.0808289647f, -0.0512454845f,
+    0.0541889891f, -0.0377844609f, 0.00958768558f, 0.0669819117f,
+    -0.00637919642f, -0.0140285995f, -0.0391282663f, 0.163790166f,
+    0.0992495045f, -0.0255888123f, 0.0196758527f, -0.0175185166f,
+    0.215312645f, -0.329765409f, 0.00603104336f, -0.0593048371f,
+    -0.0529049933f, 0.0370402858f, -0.00553420186f, -0.0808178708f,
+    0.0609371997f, 0.0683881789f, -0.00341647794f, 0.0696316287f,
+    0.177900031f, 0.299252063f, -0.365818739f, -0.0152297504f,
+    0.208354786f, -0.146019503f, 0.0301263556f, -0.0370720774f,
+    0.0674300641f, -0.0559429377f, 0.0522291586f, 0.0217804126f,
+    -0.0294012241f, -0.0551522374f, 0.119153045f, 0.0346525274f,
+    -0.293408841f, 0.241679713f, -0.216108561f, -0.277072072f,
+    -0.0375841074f, 0.105436489f, 0.108754568f, -0.00365892239f,
+    0.0398941934f, 0.0754251033f, -0.00338242459f, 0.0364890099f,
+    0.0984316021f, -0.0126950545f, 0.0525620766f, -0.0225853324f,
+    0.147956207f, 0.0663978383f, -0.175870478f, 0.107712768f,
+    0.111889645f, -0.0642829686f, 0.0557800122f, -0.208216161f,
+    0.0704612657f, 0.0389648452f, -0.020546874f, 0.0379286706f,
+    -0.0365502276f, 0.0554228723f, -0.0738883913f, 0.185492247f,
+    0.026571393f, 0.0912824646f, -0.233347848f, -0.0788034126f,
+    -0.0319129936f, -0.29739359f, 0.0540400594f, -0.100976355f,
+    -0.0236918032f, -0.208268717f, 0.0483341627f, 0.0144753158f,
+    -0.0622126646f, -0.0394336805f, 0.0770476386f, -0.104128227f,
+    -0.212738499f, 0.190306261f, -0.193675071f, -0.256930619f,
+    -0.222472072f, -0.00286282855f, 0.0173905659f, -0.0342693552f,
+    0.0253776014f, -0.112568237f, 0.046412807f, 0.0635694414f,
+    -0.0736005828f, 0.0670481846f, 0.0813817307f, 0.0317502283f,
+    0.0314435326f, -0.144347727f, -0.0555278994f, -0.297555625f,
+    0.0325741991f, -0.000710023509f, 0.0211391933f, -0.209847584f,
+    -0.0185739212f, -0.0516501218f, 0.05998566f, -0.0418673381f,
+    0.0801286548f, -0.00914681982f, -0.0640382618f, -0.0872161612f,
+    0.191902727f, -0.0237744246f, 0.0449577384f, -0.199398041f,
+    -0.0322556831f, 0.246319756f, -0.0283722524f, -0.057998918f,
+    -0.0189185645f, 0.110383518f, 0.0489361994f, -0.0296830442f,
+    -0.0687512383f, -0.0753851533f, -0.0405550599f, -0.0136392014f,
+    0.175438866f, -0.100874729f, -0.0995870829f, -0.15436314f,
+    -0.0058379299f, -0.108034082f, -0.119398609f, -0.242713705f,
+    0.0136980619f, 0.196459591f, -0.0567222349f, -0.0754157752f,
+    0.0357951112f, 0.0492816791f, 0.0177910794f, -0.171736449f,
+    0.206257209f, 0.162333712f, -0.0827674717f, 0.09259253f,
+    -0.0138129247f, -0.0893229991f, -0.163116306f, 0.108257771f,
+    0.0757424831f, 0.289513767f, 0.0395119898f, -0.0692824572f,
+    0.0176254641f, 0.0794532001f, 0.0268851798f, -0.0926243737f,
+    0.272554666f, -0.0329349302f, 0.0355251804f, 0.231373921f,
+    0.238222361f, -0.278700918f, -0.0330657884f, -0.123711653f,
+    0.0730508566f, 0.285894483f, -0.0253742039f, -0.0803986117f,
+    -0.0454195738f, -0.0109374924f, -0.0306773353f, 0.0447912067f,
+    -0.0410190895f, 0.0790120512f, 0.0602130331f, 0.104379408f,
+    0.0571012497f, 0.0518821515f, 0.0357608534f, -0.103638031f,
+    -0.0705892369f, 0.148160443f, 0.0161285512f, 0.0385404937f,
+    0.0280766487f, -0.0695699677f, -0.195354432f, -0.0836179256f,
+    -0.218166605f, -0.0467568077f, 0.00570518337f, -0.0298402123f,
+    0.0219857302f, -0.0578813888f, -0.0169375837f, -0.0700313896f,
+    -0.0511310101f, 0.112465769f, -0.0347738862f, 0.00549614429f,
+    -0.122014008f, 0.0680539161f, 0.0985326096f, -0.144700423f,
+    -0.0821736455f, 0.0630484074f, -0.304979801f, 0.0610568114f,
+    -0.125745893f, 0.0578212142f, -0.0476512089f, -0.0286599044f,
+    -0.0214307904f, 0.150418133f, 0.0310495496f, -0.0639999732f,
+    0.076410152f, -0.0762444884f, -0.26286298f, -0.0669965893f,
+    -0.393561929f, -0.218346268f, 0.295619607f, 0.0772396773f,
+    -0.217042387f, 0.0608039759f, -0.168401048f, 0.172038019f,
+    -0.0139868064f, -0.147019267f, -0.0820423216f, -0.0637146831f,
+    0.0735263079f, 0.0464321077f, -0.154230744f, -0.0586146526f,
+    -0.221085668f, 0.0487923771f, -0.0551158339f, 0.108488277f,
+    -0.153568938f, -0.0985679105f, -0.00151616486f, 0.0269261356f,
+    -0.01329422f, -0.00600609928f, -0.0401663408f, -0.0492995493f,
+    0.0547396056f, -0.0254540946f, 0.0202088598f, 0.108572789f,
+    -0.075077489f, -0.0102126459f, -0.224210739f, -0.0420619026f,
+    -0.143625915f, -0.20347178f, 0.162529618f, -0.028412845f,
+    -0.00876934361f, 0.278520018f, -0.00299058366f, 0.0473352969f,
+    -0.0590002909f, 0.0440632217f, -0.0101865595f, 0.108624518f,
+    0.205336988f, 0.0925433114f, -0.0343539678f, -0.0332013145f,
+    0.130335897f, -0.193952322f, -0.0756357387f, -0.0145885283f,
+    -0.00517980289f, -0.217295066f, 0.0484392047f, 0.0651999936f,
+    0.115057446f, 0.0666700229f, -0.0904219449f, -0.105645493f,
+    -0.119136348f, -0.331102818f, -0.0572375283f, -0.0269623566f,
+    -0.164708346f, 0.110237449f, -0.0162194017f, 0.0265355799f,
+    0.0240903106f, 0.104236275f, -0.0656789541f, -0.017685404f,
+    0.0240035336f, 0.0270191729f, 0.115266614f, 0.0822797343f,
+    -0.0462356731f, 0.015465511f, -0.165289223f, -0.0529935881f,
+    0.162572026f, -0.302066952f, -0.0770594031f, 0.0804022551f,
+    0.065767251f, 0.194207355f, -0.00849938393f, 0.0092189908f,
+    -0.0216333102f, -0.0255522635f, -0.0648775548f, 0.0225863159f,
+    0.0298709553f, 0.224751338f, -0.109097585f, -0.138171658f,
+    0.1636924f, -0.247212023f, -0.102926999f, -0.139876932f,
+    -0.0286439862f, 0.00912552327f, -0.0138988495f, 0.0400016308f,
+    0.107279167f, -0.0163196921f, 0.150328755f, 0.0235285144f,
+    0.0548154898f, 0.0638394877f, 0.0205646437f, -0.16252096f,
+    0.145965397f, -0.0592050143f, -0.0534834974f, -0.0487842523f,
+    0.0115656359f, 0.292716533f, -0.0330938213f, 0.0324047618f,
+    -0.0327200294f, 0.0372576825f, 0.022396151f, 0.0857566893f,
+    0.204946086f, 0.26054731f, -0.155518979f, -0.113604009f,
+    0.247886613f, -0.248478085f, -0.0923282057f, -0.330313683f,
+    -0.0831051692f, 0.0631337389f, -0.0796825811f, -0.0111674964f,
+    -0.0146411257f, -0.0799982399f, 0.0913111195f, -0.276067376f,
+    -0.128650799f, 0.158961192f, -0.183836266f, -0.0978993252f,
+    -0.122867256f, -0.183389485f, -0.0942341834f, -0.182549059f,
+    -0.0561935008f, -0.200726539f, 0.054903429f, 0.00840545725f,
+    -0.00511922594f, -0.0275954008f, -0.0202554427f, 0.00589099573f,
+    -0.0986031443f, -0.152333185f, -0.540894032f, -0.109833919f,
+    -0.185787424f, 0.0717096552f, 0.109280109f, 0.143055588f,
+    0.05516579f, 0.0857037678f, 0.0279234163f, 0.0090348823f,
+    -0.00237309793f, 0.0672746226f, 0.0151212905f, 0.0309613124f,
+    -0.186477721f, 0.140376642f, -0.0836046413f, 0.0341070779f,
+    0.0511599891f, -0.230248421f, 0.117982924f, 0.0655662641f,
+    -0.0149283614f, 0.103837021f, -0.00787709188f, -0.030362606f,
+    0.0296129473f, -0.0458827727f, 0.300822645f, -0.0340208225f,
+    -0.0797342137f, -0.108481303f, 0.156640947f, 0.152371109f,
+    0.0802253038f, -0.010633287f, 0.110320076f, 0.0323688649f,
+    -0.0101562738f, -0.232070819f, 0.0366346352f, -0.0475659296f,
+    -0.0777317509f, 0.0776765198f, -0.160015702f, 0.0248056166f,
+    -0.333172381f, 0.0223372243f, -0.0565172136f, -0.207524076f,
+    -0.142770931f, -0.0712069049f, -0.02117729f, 0.0567590855f,
+    0.0681302175f, -0.0947707966f, 0.0623879246f, -0.0354392938f,
+    -0.0373048671f, 0.0130386055f, -0.147123605f, -0.118900068f,
+    -0.162220523f, -0.293905497f, -0.280165404f, 0.036070466f,
+    -0.0628125668f, 0.00141214312f, -0.108796641f, -0.180257738f,
+    0.0239618421f, -0.0379954688f, 0.0197617225f, 0.0192033462f,
+    0.0677203685f, -0.0301759541f, 0.201250449f, -0.0215408336f,
+    0.00280202227f, -0.207050025f, 0.000901836436f, 0.124379992f,
+    0.0278434344f, 0.162631124f, 0.0308294725f, -0.0666132942f,
+    -0.0785088986f, -0.25046584f, -0.0383046977f, -0.0161016993f,
+    0.0394072384f, 0.020451745f, -0.0512650646f, -0.16434972f,
+    0.00395820476f, -0.181030795f, -0.0910110921f, -0.026168352f,
+    -0.0292134229f, -0.0215956643f, -0.0672261938f, 0.0129137775f,
+    -0.0184944086f, -0.14071174f, 0.0270638466f, -0.0210236907f,
+    0.0157573801f, 0.0507587306f, -0.124780707f, 0.139579326f,
+    -0.257891804f, -0.267722547f, -0.117427967f, -0.0655464008f,
+    -0.0930804014f, 0.0965024903f, 0.088846609f, -0.00937441643f,
+    0.00696713757f, 0.206360877f, 0.00633575534f, 0.0565277636f,
+    -0.0473086424f, 0.0556296818f, 0.226812571f, 0.076750502f,
+    -0.00157813914f, -0.112934515f, -0.235859498f, 0.323892027f,
+    0.165543362f, 0.0417294316f, -0.0591063648f, -0.236077353f,
+    -0.0672325194f, -0.0207066145f, -0.0716378242f, -0.0307148993f,
+    0.032367032f, -0.0722573102f, -0.00591703784f, -0.0895381942f,
+    0.0113519123f, 0.138661966f, 0.016532125f, -0.0971693993f,
+    0.0897604525f, -0.0745339319f, -0.0311551355f, -0.0382486843f,
+    -0.0744447336f, -0.0306364521f, -0.0333490893f, -0.0189677384f,
+    0.0671117902f, -0.0773879141f, -0.0951498374f, 0.094350718f,
+    0.131108135f, 0.147242248f, -0.0453339741f, 0.114077345f,
+    0.0621656589f, -0.241748691f, -0.0201633032f, 0.00534418924f,
+    -0.0432669818f, 0.125713214f, 0.0734895691f, -0.0779123008f,
+    -0.0345706716f, 0.0171393566f, -0.132812664f, -0.175373301f,
+    0.104737766f, -0.0205078088f, -0.00510178413f, 0.254175603f,
+    0.0314850472f, 0.0122205019f, -0.15283443f, 0.0528200418f,
+    -0.0592654161f, -0.0471770205f, 0.0786802769f, 0.043874871f,
+    -0.00506681856f, -0.0653679296f, 0.0703962892f, -0.035926301f,
+    -0.282603085f, 0.327622592f, 0.0728281811f, 0.0247357879f,
+    0.10482166f, 0.14056778f, -0.00626867544f, -0.168682307f,
+    -0.0785405189f, -0.0879007205f, 0.0316046886f, 0.077349171f,
+    0.0613757856f, 0.0573419631f, 0.0628948882f, -0.0321078859f,
+    -0.0764669776f, 0.0150982337f, 0.120406151f, -0.0616563149f,
+    -0.0345741548f, 0.208476081f, -0.0533738211f, 0.0165443383f,
+    -0.0543858707f, 0.0195440892f, 0.0043945713f, 0.0297401659f,
+    0.0658746213f, 0.00635012984f, -0.00573271466f, -0.0463952199f,
+    -0.0742119327f, -0.0270971656f, 0.100564592f, 0.0316772275f,
+    -0.018839119f, 0.153261468f, -0.0346100703f, -0.139441594f,
+    -0.0645503327f, -0.01581119f, -0.0348382294f, 0.0237897243f,
+    0.0378771424f, -0.0569125526f, 0.121333219f, -0.0636153296f,
+    -0.224858984f, -0.147875413f, 0.0201873612f, 0.0140895573f,
+    0.119257726f, 0.243271455f, 0.0528031178f, 0.0603901409f,
+    0.0144924428f, -0.00552923139f, 0.0666125044f, -0.074827984f,
+    -0.0172790848f, 0.0170877874f, 0.0494851507f, -0.0731898993f,
+    -0.0371509269f, -0.0358651057f, 0.0154735306f, -0.0516743474f,
+    -0.0569886342f, 0.153447777f, 0.0161921661f, -0.00205951394f,
+    -0.0129033532f, 0.0138444528f, -0.00951914024f, -0.0765145048f,
+    0.0323650092f, -0.00182404125f, 0.061890617f, -0.156253174f,
+    0.0801999718f, 0.144107491f, -0.039761886f, -0.110291205f,
+    -0.0949761793f, 0.13040787f, -0.0758119747f, 0.00689536845f,
+    0.0458283424f, -0.236689672f, 0.0581469536f, -0.0495866835f,
+    0.0624600984f, -0.0409059227f, 0.0208300557f, 0.0711344406f,
+    -0.0656433105f, -0.205903009f, 0.00590551272f, -0.191266f,
+    -0.246181831f, 0.00145953533f, 0.0112225953f, -0.0284495577f,
+    -0.0486296043f, -0.397154301f, 0.0383914523f, 0.0324517414f,
+    0.00834439602f, 0.0451416597f, -0.229237512f, 0.156325862f,
+    -0.12735033f, -0.461211592f, -0.124807484f, -0.163300678f,
+    -0.100211486f, -0.160576075f, -0.025157176f, -0.222507656f,
+    -0.0761536658f, -0.20689787f, -0.082364969f, 0.0281599965f,
+    -0.00326651591f, -0.00314747309f, -0.0244358797f, 0.0873301476f,
+    0.0646899939f, -0.2960971f, -0.0832160115f, -0.157681182f,
+    0.117131419f, -0.276631922f, 0.0904592425f, -0.200413242f,
+    -0.0392407775f, -0.144466013f, -0.00427760696f, -0.0345905237f,
+    0.0844557732f, -0.032854259f, 0.190192878f, 0.22198464f,
+    -0.100311913f, 0.0524161011f, -0.310519993f, -0.282799602f,
+    -0.113424949f, -0.265797228f, -0.0135247288f, -0.0563653633f,
+    -0.057560157f, -0.04333492f, -0.0231613722f, -0.0339287147f,
+    0.0566403009f, -0.0522638783f, -0.0340451188f, 0.135632247f,
+    -0.0677086264f, 0.0492971987f, -0.253894031f, -0.102602094f,
+    0.118869476f, -0.248954549f, 0.00534498598f, 0.0657913089f,
+    -0.000243177026f, 0.229783148f, 0.0653458983f, -0.0548917465f,
+    0.0322900526f, 0.0799010098f, -0.0794550106f, 0.0573967993f,
+    -0.0392372571f, 0.0814764276f, -0.023512993f, -0.0703830793f,
+    0.275144428f, -0.022511838f, 0.0300408099f, -0.0124909729f,
+    0.0681343675f, -0.248073041f, -0.00751942396f, -0.0269262102f,
+    0.0865239426f, -0.0362324044f, -0.0148588996f, 0.0681657046f,
+    -0.0985098779f, -0.210014328f, -0.263501406f, -0.327677399f,
+    -0.0847119689f, -0.286457121f, -0.0341708437f, 0.105354764f,
+    0.0329397321f, 0.0308532193f, -0.0684392899f, -0.0177938156f,
+    0.0479289964f, 0.00411566114f, -0.0335677192f, -0.00727611873f,
+    0.0113157416f, -0.00201610033f, -0.23189947f, 0.148582801f,
+    0.199551657f, 0.0138415843f, -0.0522534326f, -0.0707419813f,
+    0.0821931064f, 0.177570581f, -0.0182258897f, -0.0376602635f,
+    -0.0242627878f, -0.0694043189f, 0.140547305f, 0.0579244159f,
+    -0.0158053525f, 0.276343554f, 0.00618953817f, -0.16821292f,
+    0.201685339f, 0.124567509f, 0.0617632344f, -0.0632811934f,
+    -0.03591647f, 0.220275506f, -0.077494882f, -0.00794454478f,
+    0.00901680999f, 0.0334933028f, -0.035060212f, 0.0752490386f,
+    -0.133789673f, -0.193545818f, 0.183009326f, 0.316055f,
+    -0.068547368f, 0.149653092f, -0.0270231906f, 0.0623382032f,
+    -0.0268693771f, 0.112209186f, -0.0326560251f, -0.0550128743f,
+    0.0188195091f, 0.0159561038f, -0.112967201f, -0.214797065f,
+    0.0328974426f, -0.269672275f, 0.170661837f, 0.0489537194f,
+    -0.076544039f, 0.0598260984f, -0.0608429387f, -0.0443619862f,
+    0.0386459753f, -0.0186031368f, -0.0792414173f, 0.0109655168f,
+    0.0845266059f, -0.0721758902f, -0.0172578525f, -0.0276641101f,
+    0.159412205f, -0.0115012405f, 0.0589397401f, 0.0642490461f,
+    -0.0748136193f, -0.0782031342f, 0.106110856f, -0.206951603f,
+    -0.0565352663f, 0.078297928f, 0.0422852151f, -0.0153125525f,
+    0.0647469461f, -0.00926918816f, -0.160959244f, -0.246910423f,
+    -0.0895761549f, -0.427134693f, 0.0194180757f, 0.0767807215f,
+    -0.0434503146f, -0.159117743f, 0.0929956287f, -0.0175876301f,
+    0.0264042821f, 0.144210115f, -0.0374019966f, -0.00485963654f,
+    -0.0549926013f, 0.0664867312f, 0.0199962743f, 0.0454359166f,
+    0.0720854849f, -0.244789466f, -0.0226800423f, 0.161297083f,
+    -0.161618561f, 0.0293018389f, 0.00270800735f, -0.0264692903f,
+    0.0404544584f, 0.16767253f, -0.0247611217f, -0.0749841928f,
+    -0.0432616659f, -0.0786176622f, -0.0207171738f, 0.0828667134f,
+    -0.142064929f, 0.0938920602f, -0.208518058f, 0.11991334f,
+    -0.182887778f, -0.0691874549f, 0.0430434085f, -0.206065312f,
+    0.0560874566f, -0.33579132f, 0.0566859469f, -0.0119911535f,
+    -0.122073479f, 0.017490983f, -0.0427109376f, -0.0262273662f,
+    0.126341045f, -0.128811762f, -0.0972442478f, -0.193339303f,
+    -0.281109124f, 0.185254946f, 0.134741902f, 0.258393496f,
+    0.000988950371f, -0.233965307f, -0.00265738368f, 0.0535498783f,
+    -0.0239486638f, -0.0475190878f, 0.0036534504f, 0.0189631637f,
+    -0.112504721f, -0.310350418f, -0.313244164f, -0.295333922f,
+    -0.291003048f, 0.225467741f, 0.18841131f, 0.0652826577f,
+    -0.0408370495f, -0.0882131383f, -0.0111798747f, 0.0827343762f,
+    -0.0240287222f, 0.0128798587f, -0.0419175252f, 0.184011623f,
+    -0.0162002165f, 0.0109746177f, -0.339225918f, -0.272654772f,
+    -0.026533952f, -0.145166978f, 0.0163289588f, -0.16354619f,
+    -0.0324527025f, -0.381319851f, 0.0170940459f, -0.0309174955f,
+    -0.054579284f, 0.0478415005f, 0.0145669291f, 0.265974879f,
+    -0.420068324f, -0.14705357f, -0.0373925902f, -0.0130102281f,
+    -0.211359769f, -0.0102653494f, -0.142852008f, -0.139365271f,
+    -0.0689721927f, -0.0505575389f, -0.0675994307f, 0.0368568003f,
+    -0.0849167258f, -0.0589023232f, 0.126562864f, 0.0980278328f,
+    -0.0127904247f, 0.0301348027f, -0.216790229f, 0.0331054293f,
+    -0.0489163473f, -0.411564529f, -0.00927811861f, 0.10069263f,
+    -0.0359566733f, 0.132067859f, -0.0272641182f, -0.0760747641f,
+    -0.117169313f, -0.0695055127f, 0.00776127214f, 0.126092911f,
+    -0.0862618759f, 0.156793341f, -0.257745236f, -0.194430068f,
+    0.111467212f, -0.0901490003f, -0.0237166081f, 0.0642955676f,
+    -0.0740431249f, -0.251508564f, 0.0809737667f, -0.0597523153f,
+    0.0210988224f, 0.019238025f, -0.0217909627f, 0.223709553f,
+    -0.152448744f, 0.00343460613f, -0.246882662f, 0.0848854408f,
+    -0.0390232764f, -0.331699133f, -0.0108706793f, -0.0570683032f,
+    -0.0084722545f, 0.165172666f, -0.0668045729f, 0.00791526865f,
+    0.0253457259f, 0.036893867f, 0.246645525f, -0.0126295639f,
+    -0.0458545275f, 0.127082035f, -0.23202078f, 0.0828054622f,
+    0.126140133f, -0.351114333f, 0.176850528f, 0.111412175f,
+    0.0188982897f, 0.166958079f, 0.0377725475f, -0.0564016327f,
+    -0.0466198362f, -0.0311433971f, 0.119930148f, 0.0997981653f,
+    -0.0744885951f, -0.107644014f, -0.27773729f, -0.276516199f,
+    0.0732666105f, -0.152947396f, -0.0674997717f, -0.0109423464f,
+    0.0368763804f, 0.00421139551f, 0.0106057031f, 0.00478547812f,
+    0.0323550254f, -0.054664135f, 0.0478527285f, 0.307521343f,
+    0.052989047f, 0.0106400857f, -0.249848381f, -0.0800417587f,
+    0.103912011f, -0.0177896023f, 0.00888328347f, -0.0694395155f,
+    0.0434448123f, 0.10010466f, 0.0601377115f, -0.078826502f,
+    0.051418703f, 0.0723213181f, 0.0110768657f, 0.0627727062f,
+    0.0522471704f, -0.000816843181f, -0.214399233f, -0.0980497226f,
+    0.218976304f, -0.103934973f, 0.0352374949f, 0.00419530924f,
+    0.0705541372f, 0.0453206338f, -0.0275692753f, -0.0450397357f,
+    -0.011094165f, -0.0577903017f, 0.225781098f, -0.196962446f,
+    -0.125237927f, -0.0238718837f, -0.162151739f, -0.319582164f,
+    0.151776522f, -0.16350168f, 0.115644217f, -0.0689246207f,
+    -0.0648830235f, -0.0454424173f, 0.0622327849f, -0.000139494747f,
+    0.0985139608f, 0.0160971396f, 0.104312666f, -0.0602539293f,
+    0.0865849257f, 0.0660087988f, 0.0151222041f, -0.00117949035f,
+    0.0927591622f, -0.0632209703f, 0.100015886f, 0.000577306317f,
+    0.0124462545f, 0.146071807f, 0.0330263674f, 0.0327638686f,
+    0.101730771f, 0.0115139587f, 0.0536272116f, -0.0595759712f,
+    -0.0124717318f, 0.172139481f, 0.0504065417f, -0.023194842f,
+    0.0282379687f, 0.192378506f, -0.0789630562f, 0.0353418812f,
+    0.0395313501f, -0.0495856665f, -0.0368585885f, 0.0141238179f,
+    -0.0839483738f, 0.0671895593f, -0.0694383457f, 0.0314217359f,
+    -0.073097989f, 0.142001733f, 0.0370360017f, 0.00800978951f,
+    0.0525043309f, 0.134070173f, -0.102804534f, -0.0975513309f,
+    -0.0591245107f, 0.0320321582f, 0.0379304886f, 0.0656023473f,
+    -0.123593867f, 0.0356456935f, -0.113309622f, -0.00537944492f,
+    -0.0150643717f, 0.102941342f, -0.0504674651f, 0.0237206165f,
+    -0.0376552641f, 0.0136715304f, 0.0528145246f, 0.00186891749f,
+    0.0348662063f, -0.018083686f, -0.0256250612f, -0.0602524392f,
+    0.0941775814f, 0.0576597564f, -0.00559141999f, 0.0858858377f,
+    -0.127792284f, 0.0488097221f, 0.244631022f, 0.0451734662f,
+    0.0849046186f, 0.533489585f, -0.0784010515f, 0.0180945769f,
+    0.0238642693f, -0.00235439022f, 0.0110237505f, -0.0545737967f,
+    -0.021866357f, -0.0718030632f, 0.0609972887f, 0.0466616713f,
+    0.0560564324f, -0.0242372788f, 0.203517944f, -0.0773009807f,
+    -0.0441844054f, 0.311411947f, -0.0105259847f, 0.0224089473f,
+    0.0772658885f, 0.0135886073f, 0.0806424543f, -0.0472743921f,
+    0.0351320691f, 0.0186786167f, -0.0570530631f, -0.0200980809f,
+    -0.115480356f, 0.131563187f, 0.122675963f, -0.0683115721f,
+    -0.0912964791f, 0.306161344f, 0.0253925864f, 0.181737393f,
+    -0.0653331578f, 0.0336550474f, -0.0363712423f, 0.0337326936f,
+    0.100896351f, -0.0600394309f, -0.121790789f, -0.0969864577f,
+    -0.112112306f, -0.292281955f, 0.1402421f, 0.0214480571f,
+    -0.0231598075f, 0.0798210427f, 0.10424979f, -0.05990104f,
+    0.0250891149f, 0.132515654f, -0.00375793385f, 0.0120114191f,
+    -0.0580927283f, -0.0358454399f, -0.13336359f, -0.161082432f,
+    -0.0280419067f, 0.0490795858f, 0.127025858f, 0.0270497389f,
+    0.0329206251f, 0.315774024f, -0.028535476f, 0.129775867f,
+    -0.0664506555f, -0.261041313f, 0.020824492f, 0.00840547681f,
+    0.106537864f, -0.0764951855f, 0.0797107741f, 0.0344524123f,
+    0.284242779f, 0.0940089449f, 0.140598521f, -0.406535625f,
+    0.0922297835f, 0.0807373673f, -0.0389866829f, 0.093718037f,
+    0.0130392713f, -0.163906932f, -0.0407583229f, 0.0737089142f,
+    0.0282182395f, 0.021667432f, -0.174369663f, -0.0381452516f,
+    0.135643393f, -0.187269792f, 0.0438932106f, -0.30716911f,
+    0.0345300324f, -0.0666144937f, 0.00941449217f, 0.0888130814f,
+    0.0599693283f, 0.00117066107f, -0.055337958f, 0.0259437468f,
+    0.0978572965f, 0.0412335917f, -0.123937257f, 0.0655007958f,
+    0.15225035f, 0.0605350137f, 0.275970221f, -0.174009457f,
+    0.000606998277f, -0.0218084268f, -0.0933927f, 0.158629864f,
+    0.0690176487f, 0.126101166f, 0.0626304299f, -0.0607030392f,
+    -0.0389960408f, -0.0101742055f, -0.198446155f, 0.00601127464f,
+    0.260405302f, 0.0679482073f, -0.0414003246f, 0.155514374f,
+    0.0502806269f, 0.0692930743f, 0.0299322437f, 0.148133561f,
+    -0.0451934747f, 0.13133432f, -0.0193694532f, -0.0379746854f,
+    -0.0868018046f, 0.00734974956f, -0.0471553542f, -0.22812137f,
+    -0.0170399081f, -0.0241875257f, 0.032703802f, 0.308940202f,
+    0.0363744237f, -0.235497519f, 0.0100023998f, 0.0910849124f,
+    0.0545876138f, 0.0399716087f, 0.0415484421f, 0.0768182501f,
+    -0.0202886146f, 0.0534650013f, -0.181130677f, 0.0575933345f,
+    -0.0150291789f, 0.049489826f, 0.125322476f, 0.209260777f,
+    -0.0235954709f, 0.0408996828f, 0.0693534315f, 0.241642222f,
+    0.0456906073f, 0.0623493828f, 0.0696635172f, -0.0256431401f,
+    0.0947738439f, 0.0318512321f, 0.0453940257f, 0.0410004482f,
+    -0.0885452628f, 0.118935518f, -0.163677156f, 0.239786774f,
+    -0.113767885f, 0.0962989181f, -0.0602570064f, 0.00934441108f,
+    0.0681306645f, 0.012076702f, -0.0283567607f, 0.0141034229f,
+    -0.0332013704f, 0.06126111f, -0.0425438769f, 0.0606649108f,
+    0.037825007f, 0.0348046385f, -0.0814956278f, 0.10645844f,
+    -0.0784427971f, -0.0418666527f, 0.00359757571f, 0.228922755f,
+    0.0378698707f, -0.0519437939f, -0.0242525339f, 0.0649951324f,
+    0.0226284061f, 0.0554218292f, -0.1191447f, 0.127493292f,
+    0.216998786f, -0.0831685588f, -0.0550076775f, 0.0598253161f,
+    0.00380088785f, -0.140740797f, 0.0905262902f, -0.176451817f,
+};
+
+// One entry per layer; only convolutions of 4 or more input channels have one
+static const float* const mnist_snn_ohwi[5] = {
+    NULL,
+    NULL,
+    mnist_snn_layer2_ohwi,
+    NULL,
+    NULL,
+};
+
+#endif // MNIST_SNN_OHWI_H
@@ -0,0 +1,1328 @@
+// Generated by snn_core/Tools/snn_quantize from the mnist_snn weights.
+// Regenerate with the snn_q8_headers target after retraining the model.
+#ifndef MNIST_SNN_Q8_H
+#define MNIST_SNN_Q8_H
+
+#include <stddef.h>
+#include "snn_quant.h"
+
+static const int8_t mnist_snn_layer0_weights[144] = {
+    -34, -88, -127, -67, -81, -24, 45, -67, -17, 127, 62, 118, -10, 81, 30, -17,
+    69, -9, -56, -32, -123, -48, -34, -127, -52, 2, 4, -2, -43, -127, -51, 28,
+    -110, -17, -90, 54, 81, -124, 45, 11, -71, -14, 127, 11, 75, -94, -62, -90,
+    -127, 28, -21, 24, -53, -36, 87, 33, -68, 28, 64, -84, 127, 41, -118, -119,
+    -122, 51, -88, -92, 42, -29, 127, 57, -127, -79, -13, -25, 24, 38, 81, 7,
+    45, -9, -6, 126, -31, 127, -94, 76, 41, -11, 40, 29, -127, 27, -27, 60,
+    29, 5, 62, 57, 28, 127, 54, -68, 54, -95, -88, 47, 63, -22, 124, -8,
+    -98, 127, 53, 111, 35, 43, -49, 20, 125, -127, -79, 48, 101, 57, -47, -4,
+    127, -8, -81, 55, -63, -67, -25, 23, -88, -127, 63, 64, -26, 60, -1, 59,
+};
+
+static const float mnist_snn_layer0_scales[16] = {
+    0.0016956341f, 0.00456493907f, 0.00414940994f, 0.00402639387f,
+    0.00289684371f, 0.00264034607f, 0.00271478854f, 0.00376387639f,
+    0.00667781429f, 0.00316394144f, 0.00531591987f, 0.00440217135f,
+    0.00314726937f, 0.0033957432f, 0.0039537088f, 0.00400696788f,
+};
+
+static const int8_t mnist_snn_layer2_weights[4608] = {
+    -22, 6, -15, -8, 21, 16, -15, -19, 0, 70, -25, 14, -11, -17, -15, -13,
+    -13, 7, -18, 5, 25, 2, -23, -13, 21, -13, 24, -17, 11, -11, 9, 24,
+    8, -7, 6, 24, -9, 11, 11, 17, 50, -14, 19, 34, 17, 8, 8, -23,
+    -16, -22, 13, -7, 12, 1, 3, -1, 8, -1, 11, 17, -40, -11, -33, 38,
+    65, 35, 11, 28, 26, -12, -13, -59, -13, 33, 14, -88, 15, 27, -49, 39,
+    45, 85, 9, 15, 29, -5, 25, -14, 4, 23, 17, -3, 5, 52, 70, -3,
+    42, 20, 17, -56, 2, 12, -20, 3, -27, 44, 29, 29, 15, 14, -13, 16,
+    14, -11, -6, -9, 26, -8, -31, 17, 72, 89, 0, 127, 36, 10, -15, 9,
+    4, -11, 33, 38, 7, -33, 51, -87, -17, 1, -14, 43, -35, 37, -10, 13,
+    2, -13, -5, 13, -22, 10, -9, -11, 7, 20, -23, -21, 24, 29, -15, 59,
+    90, 33, -13, -6, 7, -7, -22, -21, 5, -4, -20, 11, 1, 12, -21, -2,
+    22, -1, -13, -18, -23, 2, 40, 12, -46, 7, -23, -8, 20, 21, 7, -2,
+    -3, 20, 7, 6, 18, -22, -16, -3, 1, -7, -19, 55, -47, -71, -14, 19,
+    44, -53, -11, -18, -15, -7, 8, -10, -57, 13, -4, 25, 3, -2, -79, -59,
+    -108, 17, 18, -64, 1, -38, -45, -127, -79, 46, -33, 50, 62, 12, -31, -66,
+    -45, -87, -55, -49, -34, -51, 49, 25, -2, 70, 67, 37, -12, 20, 1, 47,
+    18, 22, -40, -23, 10, -4, -19, 7, -24, 33, -44, -6, -11, -62, -2, -26,
+    11, -4, -15, 21, -2, 12, 1, 5, -40, 21, -10, -5, -4, -8, -16, 18,
+    7, -15, -18, 22, 20, -23, -22, 10, 23, -6, -62, -104, -2, -41, -62, 53,
+    21, 18, -6, 21, -14, 24, 19, -10, -16, -9, -17, 24, -8, 15, 18, -13,
+    6, 1, 10, -24, 18, 2, 14, 19, 42, -9, 22, 30, 2, -9, 2, -25,
+    9, -7, 25, 15, -21, -8, -4, 20, -65, 2, -16, -46, -15, 2, 50, 42,
+    -23, 9, 3, 0, -6, 14, -3, 31, 26, -11, 28, 13, 14, -16, 11, -37,
+    8, 51, 1, -40, -10, -35, -87, -41, 0, -112, -30, -25, -2, 86, -18, -5,
+    57, 32, 84, -84, -79, -73, -52, -44, -51, 54, 20, -2, -20, -127, -87, 8,
+    -7, -78, 18, -15, 29, 13, 5, -42, 110, 76, 12, -2, 13, 30, 10, 4,
+    -16, -12, 34, -39, 69, 11, 27, -33, -62, 41, 32, 78, -16, 10, -10, -13,
+    17, -5, -6, -4, -12, 13, -5, -14, -1, 51, 67, -1, -56, 14, 3, 32,
+    30, 0, -3, 0, -3, 5, 5, -18, -20, -16, 12, 19, 2, 1, 5, -2,
+    -4, 11, -1, -21, -41, -56, 0, 28, -26, 10, -5, -16, 13, -23, -2, -9,
+    -14, -8, 12, -23, -17, -5, -11, -22, -22, -67, -35, 29, -25, -15, 0, -3,
+    -82, 8, -95, 10, 23, 16, -45, -53, -12, -7, -31, -37, -32, -62, 6, 25,
+    -13, 47, 8, -11, -20, -6, -12, -29, 26, 32, 6, 39, 62, 47, 7, 41,
+    -2, -7, 66, 41, 22, -23, 10, 6, -43, -19, 36, 61, 39, 15, -3, -13,
+    24, 14, -20, 41, -12, 56, 80, 106, 127, 39, 78, 9, -35, -22, 19, 26,
+    -46, -6, 29, 18, -6, 2, 0, 21, -12, 19, -4, 6, -31, -78, -61, -4,
+    -27, -8, -23, -7, 16, -11, -3, -20, 30, -15, 74, 54, -31, -38, 15, -117,
+    -22, 7, -24, -12, 29, 4, 30, 20, 27, 18, 25, -14, -25, 29, -27, 22,
+    -21, 19, -6, 27, -21, 13, -44, -43, 17, -19, -26, -55, 2, 26, 0, -17,
+    22, -16, -29, 21, 28, -17, -5, -24, -16, -68, -34, -26, -34, -113, 11, -53,
+    -25, -36, -58, 5, 41, -15, 47, -4, -34, 45, -59, 37, 61, 5, 10, 55,
+    72, -3, 68, -70, -44, -5, -30, -13, 5, 30, -53, 15, 57, -61, 1, 11,
+    -28, 2, -2, 26, 32, 22, -27, 10, 86, -77, -127, -63, 45, 17, 32, -33,
+    5, 12, -15, 34, 54, 26, -55, 37, 4, -87, -65, -88, -50, -85, 21, 38,
+    -18, 47, 20, 38, -51, -4, -6, 41, -4, -5, 15, 1, 9, -4, -40, -69,
+    24, 3, 15, -14, 6, 15, 11, -24, -16, -82, -56, 98, -44, -80, 59, 55,
+    8, -21, -9, -21, -17, 1, -16, 9, 14, -24, -15, -24, -14, 21, -6, -4,
+    -8, 17, 17, 24, 22, -2, -2, -14, 5, 13, 33, 48, -14, 8, 3, -19,
+    6, 13, -22, -25, -24, -14, -122, -49, -87, -45, -19, -37, -31, -18, 0, 14,
+    5, 11, -29, -38, -53, -11, 6, 3, 50, -51, 34, 50, -53, -109, -2, -17,
+    -34, -50, -68, 15, 20, -48, -93, -70, -63, -80, -16, -69, -54, -15, -72, 4,
+    55, 70, 20, 19, 12, 37, -45, -10, 75, 38, 21, -26, -67, -20, 68, -58,
+    -15, 38, 13, 3, -127, -17, -40, -63, 5, 91, 26, 72, 106, 120, 23, 6,
+    70, 14, -10, 12, -17, 17, -34, -32, 12, -43, 46, 43, -8, -10, 78, 55,
+    -26, 20, 9, 9, -5, 25, 18, -21, -24, -2, 4, -88, 46, 31, 4, -10,
+    42, 120, 25, -4, 7, -20, -14, 8, -11, 6, -17, -17, -11, -15, 22, 12,
+    21, -26, 12, -21, -26, 41, -3, 34, -17, 8, 36, -18, -1, 27, 15, -16,
+    8, -25, -16, 17, -9, -12, -17, 3, -77, -30, -35, -65, -19, -14, -4, -33,
+    -44, -14, -9, -14, -85, -21, 15, -121, -30, -8, -29, 28, 20, -9, -37, -46,
+    -29, 22, 46, -16, -32, -4, -21, -5, -38, -47, -26, -33, -48, 42, 102, 19,
+    27, 36, 52, -34, -68, 3, 2, 52, -36, 15, 56, 3, 19, -35, -113, 41,
+    -27, -47, -40, 7, 36, 22, 47, -2, 12, 78, 127, -74, 23, 34, -41, 9,
+    -34, 9, -4, -29, 6, 2, 21, -19, 51, 16, 4, 27, 59, -19, 44, -2,
+    -6, -13, -22, 16, 17, -24, 15, -24, 10, -42, -33, 21, -35, 4, 23, 42,
+    21, -37, 19, -14, 3, -23, -9, -23, -18, -8, -17, 21, 18, 11, -8, 22,
+    4, -15, 7, 17, -28, 37, -20, 13, 13, 17, 11, -15, -19, -3, -23, -13,
+    -22, -13, 23, 15, -21, -11, -31, -11, -10, -13, -36, 9, 10, -22, -27, -56,
+    -19, 40, -1, 17, -17, -40, 14, 18, -19, 46, 68, 48, 83, -15, -1, -53,
+    27, 10, -25, -32, -32, 55, 65, 67, 4, 21, 54, 82, 3, 76, -30, -127,
+    -11, -33, 15, 34, 1, -26, -28, -47, 12, 28, 58, 20, -35, 48, 36, 67,
+    35, 20, -15, -30, -55, 18, -52, -47, 3, -87, -25, 18, 62, 31, 55, 28,
+    -4, 10, 34, 22, 45, 0, -21, 18, 21, -11, -4, -67, -50, -20, -23, -33,
+    -14, -14, -22, -18, -22, 13, 14, 5, -20, -81, -107, -44, 14, 3, -64, 72,
+    93, 46, -20, -7, 22, 21, -15, 10, 9, -16, 6, 13, -8, -12, -19, 5,
+    -3, -6, -13, -17, 12, 10, 2, -1, 35, -14, 12, 6, 44, -23, 7, 2,
+    17, 17, 14, 23, 12, -21, -61, -48, -60, -23, 20, -6, 1, -11, -33, -51,
+    -28, -47, -18, 0, -3, -18, -51, -26, 37, 29, -33, 87, -17, 19, 31, -9,
+    38, -71, -103, -111, -23, -15, -96, 29, -16, -68, -34, -7, -75, -9, -3, 8,
+    -32, -21, 71, -61, 13, 53, -41, 13, -58, 4, 27, 49, -75, -127, -72, -19,
+    -9, -105, 53, 10, 44, -124, -2, 5, -116, -28, 42, 4, -12, -2, -8, -10,
+    31, 11, 0, 25, 46, -9, 19, -25, 40, -14, -66, 17, 45, -30, -33, 32,
+    22, 20, 0, 20, 22, 6, -3, 15, 9, 37, -39, -42, -42, -77, -127, -41,
+    21, -8, -4, 14, 24, 21, -4, -6, 2, 22, -3, -15, -12, 7, 8, -23,
+    26, 10, 20, 21, 12, 20, 7, -43, -21, 6, 57, 9, 17, -17, 5, 20,
+    15, 20, -17, 2, 18, 26, 2, -2, -17, -52, -59, -88, -78, -52, -9, 65,
+    -59, 18, 0, -6, -33, 0, -16, -1, -2, -52, 4, 68, 53, 57, 118, 76,
+    11, 47, 23, 30, 55, -30, -47, 19, 30, -38, -2, -64, -100, -42, 15, -17,
+    64, 55, 28, 40, -8, -88, -42, -28, -2, 51, 53, 29, -6, -29, -90, -90,
+    -99, -74, -6, -29, -29, -33, -81, -100, 31, -68, -34, -8, 29, 26, -11, 21,
+    6, 28, -29, 7, 54, 16, 17, -6, -23, -12, -11, -7, -11, 44, 9, 39,
+    37, -12, -35, -31, 38, 31, 8, 31, -33, 30, 26, 63, 51, -3, -4, -10,
+    -21, -121, 11, 6, 34, -19, 37, -32, 1, 12, 12, -5, -8, 18, 14, -10,
+    14, 9, 18, -21, -6, 29, 9, -18, 7, 18, -35, 22, 32, -40, 2, 30,
+    -5, 30, 27, -19, -31, -16, 31, 0, -25, -7, 45, -124, 73, 38, -53, 8,
+    89, 28, 51, 16, -52, -54, -2, -67, 25, 12, 115, -40, -32, 100, -99, -23,
+    8, 63, 65, 33, 104, 68, -37, 30, -91, -109, -49, 103, -65, -33, -17, -126,
+    91, 109, 10, -105, -61, 76, -68, 21, 26, -14, -4, -49, 49, -7, 31, 68,
+    -17, -127, 45, -28, -94, 18, -9, -12, -24, -32, -29, 98, 125, -2, -32, -35,
+    29, 0, -5, 4, -2, 25, -60, -110, 29, -25, -91, -47, -49, -38, 61, 66,
+    18, 10, -7, 34, 19, -32, -21, 23, 19, -69, 61, 57, 44, 29, -4, 35,
+    -9, -17, 12, -23, -30, 23, 18, -25, 13, 31, -20, -3, -29, 11, -33, -17,
+    -30, -39, 17, 8, 10, -36, -66, 11, 2, -32, -62, -29, 39, 6, -22, -3,
+    26, 26, -29, -28, -10, 0, -63, -17, 32, 53, -90, 13, -16, 30, -40, -5,
+    48, 65, 20, 34, -39, -40, -55, 13, 72, 57, 22, 41, -16, -101, -55, -53,
+    -42, 55, 75, 51, 121, 80, 106, 28, 29, -87, -20, -8, 22, -20, -70, -11,
+    -27, 16, 73, 43, -58, -21, -127, -48, -8, -21, 84, 70, -80, 94, 74, 24,
+    36, -16, 55, 42, 12, -45, -5, -27, -97, -35, 36, 95, 71, 113, -6, -29,
+    25, -42, -48, 46, 14, -9, 13, -10, -19, -26, -126, -84, -63, -101, 29, 4,
+    -2, -1, 12, -14, 14, -20, 11, 19, 21, 71, 77, 19, 101, 89, 7, 19,
+    8, 0, -3, -17, -15, -19, 15, -14, 0, 0, 7, -1, 21, 11, 1, -8,
+    21, -18, -6, 11, 25, 5, 20, -30, 8, 3, -19, -10, 1, -4, -12, 0,
+    21, -10, 13, -15, -7, -18, -59, 25, 31, 0, -42, -7, -53, -58, 21, 32,
+    4, 15, -46, -56, 25, -4, 11, -20, 43, 63, -38, 43, -12, 6, -18, -64,
+    8, -2, 56, 14, 55, -21, -37, -9, 18, -17, 6, 48, 19, -17, -44, 14,
+    4, -24, 15, 34, 7, 24, 127, 54, -8, -8, 25, -22, 13, 60, -20, 48,
+    -23, -22, -15, -33, -38, -54, -49, -7, 4, -42, 16, -49, -23, 36, -34, -2,
+    -3, 14, -4, 2, 11, -23, -10, -31, -29, 37, -1, -39, 19, -37, -11, 13,
+    5, -17, 23, 5, -21, 22, 24, 18, 21, 39, -40, -23, 13, -76, 3, 39,
+    -67, -3, 9, 15, -16, -9, 20, 11, -15, 20, 16, 9, -8, -22, -6, -22,
+    1, -11, 9, -10, 19, -9, -9, 31, -28, -1, 11, -4, 14, -15, -23, 5,
+    -19, -3, 4, 13, -23, -22, 58, -14, 42, 17, 17, 45, 43, 29, 66, -25,
+    16, -16, 32, -55, 28, 19, 64, 91, 13, -34, -58, 9, -55, -68, 22, -17,
+    8, -19, -6, 62, 36, -4, -10, 64, -51, 2, 17, -56, -87, -6, -60, -127,
+    19, -32, -37, 4, -44, 66, 13, -84, 80, -30, 37, 89, 1, -42, 0, 50,
+    -91, 74, -25, -39, 92, -29, -5, -89, 13, 43, -89, -7, 32, -49, -44, -19,
+    22, 37, 2, 5, -10, 38, 0, 45, -11, -101, 19, 15, -76, 6, 56, -31,
+    7, -21, 19, 2, 18, -6, -5, -11, 20, -66, 1, 41, -98, 44, 59, -72,
+    33, 77, 10, -22, 9, -2, 11, 18, -6, -7, 19, -16, -5, -16, 16, -15,
+    -4, 13, -18, 18, 21, 2, -3, -13, -9, -1, 29, -4, 9, -7, -5, -11,
+    -22, 21, -6, -18, 3, 4, -25, -39, 25, -51, 39, 34, 66, 36, 36, 53,
+    37, -9, 26, 35, 35, 95, 5, 2, -84, -32, 3, -72, -80, -40, -19, 8,
+    -127, -15, 13, 29, -3, -4, -50, -35, 1, -46, -78, -50, -37, -44, -52, -15,
+    -59, -72, -10, 19, 28, -63, 10, 23, -69, 13, 30, -36, -42, 3, 3, -4,
+    36, -18, -15, 89, 33, -37, 15, 5, -12, -17, 3, -19, -47, -18, 29, 32,
+    -29, -4, 45, -32, 1, 15, 7, -2, -10, 24, -20, 11, 23, 8, 42, 39,
+    8, 15, 4, -9, -8, -14, -12, 3, 11, -17, -9, 59, 69, 52, 34, -15,
+    10, -19, 11, 11, -10, 4, 16, 6, 0, -3, 14, 15, -14, 6, 13, -14,
+    12, 12, 9, -18, 1, 8, 19, 7, -12, 10, 5, 1, -1, 7, -10, -16,
+    10, 16, -3, -7, -4, -5, -21, -18, 4, -18, 13, -13, -42, -39, -28, 19,
+    -23, 6, -14, -12, -27, -5, -37, 12, 20, -16, 38, -41, 34, 49, 1, -43,
+    56, -42, -29, 11, -67, -9, 27, -127, -48, -27, -1, -16, 14, -12, 7, -77,
+    -30, -88, -72, -25, -20, -26, 109, 34, 47, 1, 8, -18, -3, 13, 25, -3,
+    34, 11, -92, -113, -58, 45, -29, -51, 18, -53, -80, 35, -25, -55, -4, 21,
+    -18, 18, 8, 2, 7, -9, -7, 11, 11, -41, -11, 0, -11, 53, 1, -52,
+    26, 15, -22, 0, -1, 2, 13, -18, 9, 94, 63, 79, 6, -17, 21, -45,
+    -47, 10, 15, -25, -21, -16, -2, -11, 26, -26, 3, -22, 12, 24, -22, 0,
+    -24, 15, 21, -16, -9, 11, 38, 4, -10, -27, 24, -42, -4, 2, 8, -2,
+    -26, -20, -10, 19, -11, 7, -61, -42, -84, 22, -49, -59, 9, 1, -8, -17,
+    -58, -17, 5, -46, 41, -69, 34, 29, 31, 46, 26, -127, -72, -4, -107, -40,
+    25, -16, -33, -33, -24, -53, -52, -18, -53, 13, 82, 43, 24, -59, -22, -19,
+    -33, -23, -81, 4, 22, 42, 28, 44, 24, 7, 53, -3, 40, 16, 4, 20,
+    -19, 21, -96, -55, -27, 5, 62, 70, 5, -4, -15, 87, 35, -58, 29, 13,
+    -29, 32, 35, 5, 17, -15, -2, -20, 11, 18, -90, 35, -2, 46, -13, -68,
+    3, -20, -27, -28, 29, -23, 7, -15, -4, 51, 60, -51, -15, 88, 85, -59,
+    27, 48, -24, -16, 6, 19, -19, -16, 25, 0, -9, 9, -25, -26, 20, -16,
+    11, 14, 20, 5, 38, 4, 51, -7, -10, -17, 17, -2, -2, -29, 3, -1,
+    -22, -26, 11, 4, -17, 16, -17, -37, -35, -71, 35, -41, -101, 28, 13, -29,
+    -7, -40, -36, -56, -51, 54, 23, -13, 42, 59, 23, -52, -26, 12, 2, 57,
+    -38, -8, -33, -37, -67, -44, -50, -127, -14, -10, 88, 35, 35, -17, 80, 7,
+    -21, -60, -61, 30, -8, -28, 48, 85, 101, -28, 16, -4, -25, -41, -28, -14,
+    -3, 20, -72, -55, -55, 84, 80, 35, 0, 80, 23, -29, -21, -17, 46, -26,
+    15, -14, 3, -11, -31, 24, 5, 40, 25, -31, -15, 25, -2, 32, -67, 17,
+    -21, -6, -20, 13, 13, -14, 4, -4, 18, -114, -117, 24, 71, 7, -10, 56,
+    40, 16, 29, 3, -15, -12, -7, 24, 0, 15, -12, -5, -14, 20, 26, -9,
+    -26, -10, -5, -19, -34, -28, 22, -24, 28, -28, -34, -43, -25, 30, 10, 2,
+    7, 19, -21, -2, 4, 3, -7, -35, 23, -72, -1, 33, -84, -54, 50, 22,
+    55, 80, 47, 11, 8, -32, -16, 40, 13, 51, 15, 127, 22, 47, -79, -22,
+    -26, -28, -83, -51, -57, -97, -61, -60, -29, 44, 12, -5, -43, 68, 102, 13,
+    -69, -12, -70, -45, -67, -42, -13, -44, -93, 91, 54, -6, -18, -103, 9, -13,
+    -10, -8, 15, 23, 6, -21, 56, 11, 36, 6, -16, 35, -23, -38, 2, -20,
+    11, 3, 2, 22, 12, 56, -4, 6, 14, -7, 35, 34, -30, 8, 5, 2,
+    -15, 24, 4, 12, -8, -1, 7, 1, 24, -26, -15, 16, -14, -52, 23, -28,
+    -91, 40, -1, -5, 9, 17, 21, 4, -9, 6, 8, 25, 4, 7, 18, 7,
+    -3, 15, 7, 6, -9, 20, 33, -17, 21, 16, 7, 0, 8, 17, 12, -18,
+    15, -7, 20, -16, -9, 11, 21, -29, 40, 56, 43, 58, 38, -16, -15, 11,
+    2, -23, -15, 30, 19, 7, -3, 9, -31, -48, -49, -7, -111, -86, -19, -14,
+    -82, 16, -16, 12, -4, -24, -33, -74, -127, -41, -4, -38, -46, -122, -6, 51,
+    35, -49, 24, 25, 46, 14, 1, 40, 44, -58, 11, 75, -10, 17, 19, -55,
+    17, 36, -84, -19, 41, -30, 14, 14, -20, -67, 59, 3, 10, -13, 23, 17,
+    26, 18, 15, 9, 14, 5, -6, 28, 12, -27, 16, -18, 6, 32, -22, -24,
+    1, -29, -24, 8, 18, -15, 26, -20, 5, -54, 12, 36, -90, 5, 29, -41,
+    5, 70, -23, 9, 24, 21, -31, -28, 23, -1, 4, -3, 32, -2, -17, 16,
+    -8, -31, 19, -30, -15, -9, -55, 33, 5, -4, -4, 14, -8, 9, -4, -18,
+    15, -31, 15, -22, -20, 29, 16, 64, 43, -3, 88, 50, -60, -9, 39, -2,
+    -93, 17, 39, -2, 12, 4, 71, -16, -5, -31, -21, -14, -34, -96, 42, 4,
+    -54, -18, 28, -41, -43, 22, -105, -118, -74, -17, 2, -14, -22, 25, -9, 65,
+    -5, -2, -30, 75, 50, -94, 52, 38, -15, -73, 25, -5, -19, 42, -41, -29,
+    21, -14, 11, 18, 40, 12, 18, 127, 57, -47, 31, -25, -38, 27, 1, 3,
+    -17, 56, 15, 22, -30, -29, 47, 14, 67, 17, 50, -60, 53, 19, -33, 25,
+    -21, -17, -9, -5, 16, 2, 1, -29, -25, -35, 69, -34, -31, 70, -26, 38,
+    49, -21, 4, 25, 25, 1, 15, -29, -11, -11, 28, -8, 11, 22, 0, -1,
+    -21, -5, 9, 13, -11, 7, 10, -28, 0, -24, -4, -20, 6, 28, 1, 5,
+    -13, -8, -17, 19, 8, -21, 58, 37, 60, 2, 74, 18, 12, 69, 46, 21,
+    33, 43, 13, -66, -21, 30, 34, 42, -59, -67, -77, -3, -96, -57, 95, -121,
+    -28, 9, 9, -53, 6, 1, -69, 51, 64, 42, -14, -15, 0, -62, -5, 28,
+    -22, 23, -4, 70, -25, -67, -3, 30, -127, -29, -18, -18, 17, 45, -31, 51,
+    31, 23, 56, 75, -2, -7, 15, 63, -71, 62, 84, -31, -32, 10, 73, 18,
+    10, 20, 34, 35, 1, 50, 60, -37, 16, 29, -116, -30, 24, -38, -46, -51,
+    1, -15, 25, 16, -16, 20, 12, 21, -7, -5, 50, 1, -11, 11, -17, 22,
+    12, -62, -7, -11, -15, 3, -2, 15, -1, -6, 14, -10, -1, -9, 20, -24,
+    6, 11, 11, 4, -25, 13, -14, -2, 18, -9, 29, -11, -18, 12, -14, 22,
+    -4, 20, -16, -4, 16, -12, -28, 24, 60, -12, -1, 35, 16, -22, 23, 64,
+    38, 5, 49, 21, 10, -7, 55, -31, -2, -33, -49, 29, 53, -87, 44, 8,
+    -63, 0, 40, 45, -8, 89, 72, 20, 27, 56, -26, 0, -127, 6, -108, -64,
+    -52, -69, -57, 23, -51, 4, -5, -5, -82, 32, -23, -76, 42, 62, 24, 64,
+    62, -11, 33, -9, -66, 2, -78, -8, -98, -43, 31, -19, -88, -1, 22, -14,
+    24, 2, 9, 32, 17, 16, 5, -17, -7, -15, -18, -11, -1, -62, -30, -10,
+    8, -6, -6, 4, 24, 24, -23, -16, -7, -36, -17, 36, 63, 93, 92, 48,
+    36, 49, 15, 19, 16, -18, 13, -8, 5, -11, 10, 21, -14, -10, -24, -22,
+    -26, 12, 2, -21, -24, 26, -22, 12, 6, -15, 9, -39, 25, 22, -3, -24,
+    16, 26, -4, -22, 22, -25, 26, -21, -13, 6, 9, -10, -63, 32, -85, 10,
+    -28, -4, -55, -30, 14, -27, -47, -22, 10, 62, 57, 67, 88, -13, -70, -27,
+    -127, -47, -8, -33, 52, -11, 25, -15, 20, -70, -18, 15, -32, -27, 11, 19,
+    2, -98, 95, -96, -64, -50, 30, 75, 34, -10, 20, 25, 11, -10, -2, -4,
+    77, 18, 7, -41, -70, 0, 79, -35, -29, -90, 17, -19, 19, 20, 7, -9,
+    -39, -53, -11, 12, -5, -15, -54, -68, -19, -78, 35, -40, -33, -23, -9, 56,
+    -5, -5, -3, -2, 9, 25, -11, 4, -32, -56, -2, 107, -83, 40, 74, 4,
+    112, 24, -31, -15, -1, 19, -25, -3, -5, -13, -31, -24, -19, 18, 25, -7,
+    4, 15, 12, -4, 28, 21, -23, 44, 9, -8, 41, -13, -6, 18, -10, 17,
+    26, 10, -10, -6, 14, -31, -59, 8, -4, -35, 44, -25, 58, 9, 35, -22,
+    42, 42, -41, 32, 9, 9, 33, -106, -85, -29, 79, -46, -18, 11, 21, 79,
+    -49, 19, -4, 35, -127, 6, 86, 24, 100, 61, -21, -86, -13, -22, -63, -42,
+    8, -60, -71, 42, -16, -13, -10, -20, -53, -62, -44, -38, -59, -55, 50, -63,
+    62, 63, 56, 95, -47, -38, -78, -74, 42, -116, -95, -23, -95, -70, -1, 62,
+    -29, -6, -30, -39, -21, -35, -36, 10, -11, -6, 10, 31, -54, -19, -127, -70,
+    -13, 13, -4, -2, 16, 6, -18, -4, 2, -47, 20, 24, -54, -22, -9, -59,
+    -33, 48, 13, 7, -2, 9, 15, 5, -9, 6, 1, 2, 2, -7, -11, -8,
+    5, -4, -5, 13, -1, -1, 7, -18, -9, 16, 9, 4, -11, -6, 16, -11,
+    18, 3, -7, 5, 12, 13, -5, 4, 71, -38, -35, 47, -12, -29, 53, 1,
+    7, -8, 6, -28, -5, -39, 33, 18, -23, -44, -19, -78, -38, 1, 1, -61,
+    0, -36, 33, -25, 5, -69, -49, -43, -63, -27, -127, -20, 37, -13, -66, 0,
+    -21, -28, -55, -26, 8, 36, -49, 8, 29, -6, -15, 76, -44, 12, 19, -34,
+    -15, 7, -7, -22, 39, 17, -54, -2, -17, 0, 38, -5, 23, 10, 26, 28,
+    26, -5, -26, 7, -16, 21, -14, 34, 15, 8, 13, -42, -16, 3, -2, -55,
+    -26, -29, -17, -23, -30, -21, -25, 6, -5, -8, -12, 49, -18, -34, 8, -6,
+    -2, 5, -28, -13, 28, 30, 12, 2, -14, 26, -4, -12, -7, -30, 17, 30,
+    12, 9, -29, -30, 13, 26, -13, -2, 24, 26, 15, -7, 13, -28, -30, 7,
+    -25, 22, 2, -22, 7, -1, -2, -37, -51, 27, 24, -2, 47, 19, 24, -35,
+    37, -68, -14, -12, -18, -25, -28, -61, 4, 51, 41, -110, -30, -29, -87, -14,
+    31, 54, 57, -8, 127, 6, -11, -57, -14, 56, 6, -18, -2, 28, 47, 39,
+    8, 6, -15, -38, 44, 99, 10, -24, 12, 5, -20, -43, 35, 24, 12, 41,
+    -13, -7, 46, -22, -37, -29, -94, 5, 54, 81, 59, 94, 59, 51, -12, -8,
+    -59, -2, -21, -13, 20, 6, -29, -15, 2, 20, -65, 6, -54, 23, -1, 3,
+    13, -13, -21, -11, -16, 0, 19, 9, 23, -65, -109, -57, -40, -12, 63, -68,
+    8, 49, 16, 11, -23, -1, -6, 18, -2, -19, -5, -14, 9, 8, -10, -9,
+    -15, -7, -5, -10, 17, 2, -1, 23, 16, 9, 24, 13, -7, -11, 12, -1,
+    -9, -14, 22, -10, 1, -19, 6, -63, -7, 52, -9, -22, -4, -9, 39, 20,
+    43, 24, 61, 37, 16, 19, -2, 16, -18, -35, 18, -28, -19, -11, -27, 3,
+    -4, -57, -127, -82, 14, 14, 22, -58, -1, 76, 2, -34, -23, -86, -70, -6,
+    -73, -64, 2, -53, -45, -43, -78, -28, -19, -90, 41, -46, -68, -28, 32, -31,
+    33, 76, -23, 55, 56, 0, -44, -76, -73, -69, -6, -79, 4, 34, 3, -7,
+    25, -4, 1, 8, -9, -14, 17, -8, -61, -55, -16, 18, -3, 29, -19, -17,
+    -11, -8, 11, -17, 8, 12, 17, 0, -12, 65, 33, -6, 23, 43, 50, -100,
+    -70, -26, -23, -10, -24, 13, -11, -7, 17, -1, -3, -2, -16, 3, -5, -1,
+    -22, -4, 16, 25, 3, 6, 25, 19, -16, -13, -36, -7, -7, 10, 5, -21,
+    -3, 20, -23, 5, -14, 4, -10, -34, -5, -48, 6, -6, -13, 1, -12, 22,
+    -64, -8, -73, 14, 25, -8, 6, 55, -40, 10, 47, -27, 21, -42, 38, -33,
+    -5, -58, -80, -3, -127, -73, 28, -38, -92, 3, 54, 51, 18, 6, -7, -62,
+    -29, -93, -101, 94, 15, 19, 23, 48, 36, -57, -88, -81, -20, -23, -22, -13,
+    -48, -54, -84, -87, -8, 44, 18, -23, -47, 9, -21, 55, 67, -43, -8, -18,
+    32, 28, 1, 13, 40, 56, 5, 19, -13, -62, -5, -8, -61, 77, 19, -49,
+    -10, -21, -11, -22, -3, 6, 11, 13, 21, -115, -15, 40, -76, 50, 50, 1,
+    30, 14, 5, -20, -8, 24, -20, 11, 3, 18, -8, -9, 11, -23, -18, 2,
+    -17, 1, -24, -14, -17, -26, -35, 6, 8, -14, 10, 16, -3, 14, -18, -21,
+    6, 11, -9, -17, 22, -17, 4, 38, 2, -7, 75, 36, 14, 3, 68, 80,
+    30, 38, 68, -4, 30, 93, 19, -60, -127, -4, -26, -46, -14, -23, 16, 16,
+    -38, -44, 9, 47, 1, 38, -33, 3, 0, -7, -11, -66, -78, -75, -70, -84,
+    -76, -65, -49, -4, 10, -59, 26, 25, -84, -24, -30, -97, -64, -15, 34, -12,
+    38, 22, 31, 66, 46, -3, -124, -27, -100, -106, -46, -5, -31, -49, -43, -3,
+    -7, -3, 53, -20, 3, 11, 35, -42, 30, 19, -17, 34, -3, -21, 1, -21,
+    -15, 3, 9, -14, 8, 6, 18, -16, 6, -11, 35, -12, 8, -4, -1, 3,
+    8, 32, 15, 8, -9, 9, -6, 3, 19, -9, -1, 0, 8, 3, 16, -14,
+    -13, -11, 8, 3, 23, 24, -20, -29, 22, -5, 8, 24, -14, 4, 3, 16,
+    8, 14, -17, 4, -14, -9, 25, 13, -17, -27, -1, 15, -14, -29, -32, -14,
+    -14, 7, -1, 20, 11, -5, -23, -38, 21, -3, -17, -4, -30, 13, -27, -27,
+    -7, 16, 41, 34, 25, 12, -6, 31, -70, 12, 4, 12, 9, -12, 58, 48,
+    29, 33, 30, 0, -6, 2, 6, 11, -18, -16, 5, 6, 22, 7, 12, -9,
+    20, -11, -22, -6, 8, -15, 46, 32, 3, 127, 74, 73, 19, 75, 24, -19,
+    -24, 13, -19, -3, 6, 25, -7, 0, 8, -23, 0, 4, 5, 43, -14, 31,
+    -21, 4, 19, 22, -14, 17, 14, 21, 12, -82, -51, 0, 39, 41, 12, 19,
+    4, -16, 7, -13, -17, 20, -6, 13, 22, -9, -8, 3, 23, 8, -19, -12,
+    24, -8, 4, 20, 33, 9, 31, -12, -27, -6, 30, -10, 7, -24, 7, 13,
+    -3, 2, 17, 10, 19, 17, 25, -54, -39, -62, -15, -57, 14, -13, -37, 11,
+    -12, 20, 2, -71, 18, 13, 19, 40, 89, 42, 48, 81, -5, -5, -28, 12,
+    68, 29, -59, 19, 21, -8, 15, 37, 11, -26, 44, 14, 86, -13, 10, 39,
+    -51, -25, -17, -127, -96, -54, 49, 97, 65, 75, 33, 19, 29, 11, 0, 16,
+    11, -7, -36, -25, 1, 25, -21, -7, 22, -74, 13, 30, -13, -44, -12, 3,
+    -29, 9, 3, 22, -19, 1, 28, 29, 28, 50, 46, 28, 75, 3, 72, -55,
+};
+
+static const float mnist_snn_layer2_scales[32] = {
+    0.00316996104f, 0.0037056345f, 0.00320766377f, 0.00331066432f,
+    0.00266903243f, 0.00319108786f, 0.00290480605f, 0.00335329841f,
+    0.00355694094f, 0.00300755748f, 0.0020436456f, 0.00215168926f,
+    0.00382002629f, 0.00315416488f, 0.00367347919f, 0.00460536871f,
+    0.00305170007f, 0.00290465797f, 0.00270828023f, 0.00319646322f,
+    0.00257751159f, 0.0028941331f, 0.00337684341f, 0.00309891277f,
+    0.00260710879f, 0.00425900798f, 0.00257970556f, 0.00363158737f,
+    0.00336326519f, 0.00330762449f, 0.00420070533f, 0.00320106791f,
+};
+
+static const int8_t mnist_snn_layer4_weights[15680] = {
+    1, 0, -6, -6, -2, 3, 0, 0, -8, 0, 3, 2, 3, 4, 0, -2,
+    -10, -13, -7, 0, 10, -1, 0, -1, -5, -2, -8, 5, -2, 8, 2, 3,
+    -11, -9, -1, 0, 4, 7, 3, -6, -9, 2, 0, -1, -10, -36, -16, -7,
+    0, 0, -13, -10, -8, -3, -3, -1, -2, -1, -6, -7, -7, 0, 3, -32,
+    2, -1, 2, 7, -1, -4, -8, 0, -1, -9, -3, -3, 5, -20, 1, 0,
+    -2, -2, -2, 3, -15, 3, -2, -4, -1, -2, -2, 1, -6, -3, -10, -18,
+    -18, -7, 0, -31, -4, -6, -3, -5, -6, -4, -5, 5, 5, 5, -1, 4,
+    -8, -3, -9, -3, -4, 0, 2, 0, -13, -2, -8, -25, -6, 7, -6, -12,
+    -1, 1, -6, -30, -16, -1, 4, -5, 2, -7, -17, -20, -1, 1, -2, -17,
+    -27, -13, 0, 0, -7, -6, -5, -6, -4, 0, -3, -1, 2, 3, 1, 5,
+    1, -20, -1, -3, 2, 7, 4, 1, -4, 3, -1, -4, 6, 1, 1, -8,
+    2, 2, -4, -7, -1, 0, -8, 3, 5, -3, -2, -8, -1, -3, 4, -2,
+    3, 1, -5, -8, 0, -1, -4, -11, -8, -1, 0, -1, -1, -11, -7, -3,
+    1, -1, -9, -6, -13, -8, 2, 6, -2, 2, -6, -11, 1, 7, 3, -2,
+    -2, 1, -7, -14, -3, 1, -1, -1, -1, 0, -5, -2, -9, -3, -30, -1,
+    2, 2, -3, -5, 0, 0, -17, -5, 2, -2, -4, -1, -36, -19, -8, 3,
+    7, 5, -6, -25, -14, -16, -11, 0, -3, -4, -5, -19, -8, -1, -6, -3,
+    5, 2, -7, -13, 5, 2, -6, -43, 1, -5, 3, -2, -5, -2, -8, -6,
+    -6, -1, -21, -15, -4, 0, -1, -12, -7, -4, -2, -2, -5, -17, -1, 6,
+    4, 6, 1, -3, -15, -2, -9, -2, 1, 0, -4, -2, 0, -11, -8, -11,
+    0, 2, -21, -2, 3, -1, -7, -15, -5, -2, -3, 1, -1, -6, -9, -28,
+    0, -10, -13, -51, -51, -23, -1, 0, 0, -13, -3, -10, -9, -2, -1, -4,
+    -3, -5, -1, 1, -9, -11, 1, -4, -1, -2, -4, -28, -6, -1, 0, -15,
+    -8, -3, -14, -5, -4, -3, -1, 2, 6, -15, -5, -6, 3, 2, 6, 4,
+    -8, 0, -82, -7, -10, -1, -3, 0, -6, -4, 0, -2, 0, -6, -11, -24,
+    -6, -4, 4, 3, -1, -6, -19, -3, 2, -1, -7, -11, -13, -10, -9, -19,
+    -11, -20, -21, -18, -40, -24, -9, -1, 2, -21, -8, -52, -16, -14, -6, -6,
+    -7, -31, 0, -3, -5, -2, -1, -1, 0, 0, -2, -6, -4, -4, -3, -6,
+    -9, -10, 1, -2, -7, 0, -8, -8, -9, -7, -7, -6, -11, -9, -3, -6,
+    -11, -7, -9, -15, -45, -15, -5, 0, 1, -5, -27, -40, -1, 3, -1, -1,
+    3, 4, -3, 0, -1, -1, -1, 0, -1, 0, 0, 1, -1, 0, 3, 4,
+    -1, 0, -14, -6, -11, -7, -1, -1, -2, 1, 1, -5, -12, -9, 1, -5,
+    3, 8, -3, -16, -5, 3, -1, 5, 4, -7, -1, -5, 2, -1, -7, 3,
+    3, -3, 3, 4, 0, 3, 3, 2, 1, -4, 0, 0, 0, -11, -14, -28,
+    -63, -3, 0, -4, -1, -4, -1, -4, -9, -12, 3, 0, 2, -3, 0, -3,
+    -10, 3, 6, -3, -11, 1, 3, 2, 3, -2, -4, 5, 4, 1, 3, -1,
+    -5, 1, 0, -1, 2, -1, -4, -15, -21, -9, -13, 0, 0, -3, -8, -5,
+    -12, -12, -7, -2, -2, -7, -2, -2, -3, -5, -12, 0, -1, 2, 4, 4,
+    2, -10, 7, 6, 0, -1, 4, 1, -3, 3, 6, -4, -1, 5, 5, -9,
+    2, 3, 2, 1, 2, 2, -25, 0, 1, -1, -3, -9, -3, -7, -11, -22,
+    -20, -14, -13, 0, -1, -2, -7, -7, -4, -3, -3, 3, 4, -4, 6, 10,
+    1, 6, 7, 1, -1, 9, 9, -1, 7, 0, 0, 0, 7, 4, -3, 2,
+    7, 2, -10, -19, -11, -3, 0, -7, -22, -61, -26, -7, -2, 0, -1, -21,
+    -14, -12, -1, -10, 0, -13, -4, -4, -3, -10, -2, -1, -3, 1, -1, -10,
+    7, 8, 0, -3, 2, 4, -9, 7, 8, -1, 1, 1, 5, -10, 1, 3,
+    -8, 0, 5, 1, -23, -28, -9, 0, 2, -27, -45, -22, -23, -14, -1, 0,
+    1, -2, 6, -8, -10, -2, -21, -19, -19, -9, -10, -10, -16, -14, -7, -6,
+    -2, -1, -11, -9, -10, -4, -15, -7, -8, -18, -13, -10, -5, -11, -4, 1,
+    2, -14, -2, 3, 1, 6, -1, 1, -12, -25, -2, -6, -1, -2, -3, -27,
+    0, -1, -1, 0, 0, 0, -1, -3, -2, -9, -6, -3, -1, -13, -56, -5,
+    -3, 6, 4, -1, -12, -2, -1, -7, 1, -2, -2, -12, -3, 2, -4, -12,
+    -5, 0, -7, 0, 0, 5, 3, -2, 2, -2, -5, 2, 0, 2, 2, 0,
+    -16, 1, -4, -30, -15, -4, 0, 0, -3, -6, -4, -2, 0, 1, -5, -2,
+    -3, -3, 0, 7, 3, -13, -2, 0, -7, -7, 1, -1, 2, -7, 0, -2,
+    -8, -6, 2, -1, -4, -1, 5, 1, -4, -1, -5, -21, 0, -3, 0, -1,
+    -4, -25, 0, -13, -17, -9, -6, -9, -4, -9, 2, -3, -6, -4, -2, -10,
+    -6, 4, -1, 4, 2, -8, -6, -3, -2, -1, -16, -11, -5, -11, 1, -4,
+    -4, -2, 4, 3, -67, -5, -10, 0, 2, 1, 1, -36, 0, -18, -26, -5,
+    -23, -4, 0, -1, -21, -29, -20, 0, -1, 0, -8, -9, -10, -7, 3, 4,
+    0, -1, -2, -4, 1, 12, 12, 1, 5, 2, -3, 8, 5, 2, 0, 1,
+    3, 6, -6, -4, -2, 0, 3, 1, 5, -20, -26, -12, 0, -3, 0, -14,
+    -18, -13, -9, 0, 0, -9, -14, -8, -5, 0, 0, -10, -6, -1, -3, -2,
+    0, -1, -11, 3, -3, -1, 4, 8, -1, -6, 3, 2, -1, 7, 10, -5,
+    1, 4, 3, -7, 0, 6, -4, 3, 2, 4, -7, -17, -6, -3, -8, -1,
+    0, -12, -17, -12, 0, 0, -6, -9, -9, -15, -9, -2, 0, -8, -3, 1,
+    3, 0, -3, -7, 1, 2, -2, 6, 5, 2, -7, 5, 4, 0, 4, 7,
+    4, -13, 5, 8, 1, 0, 0, 8, -12, -2, 4, -3, -5, -3, 3, 0,
+    2, -19, -15, -17, -13, -5, 0, -1, -6, -40, -13, -9, -2, 1, -15, -14,
+    -19, -10, -6, -8, -1, 5, 2, 2, 0, 0, -6, -6, 2, 6, 3, 0,
+    3, -1, -1, 5, 5, -1, 8, 0, -1, 4, -4, 0, 2, -2, 3, -3,
+    -1, -34, -16, -12, -9, -10, -1, -1, -13, -4, -10, -10, -12, -8, -11, -6,
+    -4, -1, 0, 0, -7, 2, 2, -2, 4, 4, -3, -4, -3, 1, 2, -8,
+    0, 1, -1, 1, 1, 1, -4, 2, 4, -3, -1, -1, 0, 1, 0, 3,
+    -2, -19, -3, -6, -6, -9, -2, -1, 0, -6, -8, -16, -16, -9, -3, -11,
+    -3, -3, -2, 4, 0, -16, -4, 1, 4, 2, -4, 4, -11, -2, 3, 0,
+    -6, 7, 7, -7, 2, 1, -2, 0, 3, 3, -6, -5, 1, -4, -2, 0,
+    0, 0, -7, -20, -13, -26, -16, -9, 0, -1, -2, -3, -1, 0, 0, 0,
+    -7, -7, -8, -5, -2, 2, 0, 4, 1, -7, -7, 4, 75, 0, 5, 3,
+    3, -7, 13, 9, 0, 7, 0, 2, 1, -3, 4, 0, 1, -4, 5, -20,
+    -34, -4, 0, -1, 1, 0, -7, -35, -3, 0, 0, 0, -2, 1, -3, -1,
+    -1, 0, -3, -2, 0, 0, 2, 4, 0, 8, 3, -2, -4, -3, 2, -1,
+    3, 0, 9, -7, -6, -2, 1, 0, 0, -3, -13, -6, 2, 2, -2, -11,
+    -8, -5, -4, -2, 0, 0, -5, -10, -11, -3, 0, -5, -13, -9, -11, -16,
+    -14, 0, -7, -3, -6, 1, -7, -14, -1, -7, -2, -2, -4, -20, -4, -6,
+    0, -2, 3, -7, -9, 1, -1, 1, -2, -10, -5, -1, 9, -2, -3, -4,
+    -28, -17, -4, -2, 0, -5, -90, -127, -11, -3, 0, 0, 0, -1, 1, 0,
+    0, 0, -1, 0, -18, -22, -3, -4, -4, -36, -10, -25, -13, -4, -6, -10,
+    -7, -15, -15, -7, -2, -3, 0, -9, -2, -10, -14, -9, -1, -8, -28, -11,
+    3, -3, -4, 2, -7, -14, -2, 2, 1, -1, -8, -7, -24, 0, -3, -11,
+    -9, -21, -4, 1, -12, 1, -4, 0, -5, -14, -3, -5, 3, -1, 4, -7,
+    3, -3, 2, 4, 6, -14, 7, 3, -6, 5, 7, 4, 1, 7, 0, -1,
+    2, 1, -21, -13, -6, -2, 0, 0, -13, -16, -20, -13, -2, 0, 0, -10,
+    0, -10, -2, 5, 0, -6, 1, 5, 5, 2, 7, 2, -13, -3, -4, -5,
+    6, 8, -3, 3, -1, -1, -5, 0, 2, 1, 2, 2, 4, -1, -8, -3,
+    3, -3, -1, 2, 2, -5, -9, -8, -1, -14, 0, -10, -6, -12, -1, 0,
+    -1, -18, -13, -4, -14, -2, -3, -4, -4, 0, -2, -4, -9, -5, -1, 1,
+    -2, -2, -5, -1, -3, -2, -4, -4, -17, -1, 0, -4, -1, -3, -2, 0,
+    0, -7, -1, 2, -1, 2, -1, 2, -28, -1, -8, 1, 0, 2, -2, 0,
+    0, 0, -2, -3, -6, -2, 0, 0, -2, 3, 2, -5, -6, 2, 0, -2,
+    -12, -8, -12, 2, 0, 0, -8, -127, -16, -10, -4, -1, 0, -40, -6, -14,
+    0, -6, -2, 0, -3, -6, -6, 3, 2, 0, 0, 0, -1, -14, -8, 0,
+    0, 0, -2, -6, 0, 0, -4, -6, 0, -19, 1, -2, -2, -3, -2, -4,
+    -29, -1, 3, 0, 1, -2, -1, -34, -1, 4, -1, -3, -12, -3, 1, 0,
+    1, 2, 3, -2, -1, 2, 3, 3, 4, -1, -5, 0, -14, -2, -5, -7,
+    -13, 0, 0, -5, -10, -7, -8, -10, -2, -1, -40, -1, -7, -3, -4, 0,
+    -1, -4, -3, 1, -2, -11, -28, 0, -14, -13, -9, -3, -60, -16, -1, -9,
+    1, -8, 2, -3, -6, 0, -11, -10, -1, 0, 2, -8, 0, 0, 0, -3,
+    -6, -1, 0, 0, 0, -7, -2, -4, -1, 0, -1, -9, 4, 4, -3, -3,
+    -1, -5, -3, 2, 1, -6, -2, -4, -3, -73, -5, 0, -4, -6, -8, -15,
+    -15, -6, -2, -2, -17, -6, -19, -1, -5, 2, 5, 1, -2, 0, -2, -2,
+    -5, -2, -4, 0, 0, 0, 0, -3, -2, 0, 0, 0, -3, -2, -8, -3,
+    -2, 0, -10, -9, -3, -7, -13, -25, 0, -10, -13, 0, -6, -27, -36, 0,
+    -6, -6, -3, -2, -80, -24, 0, -34, 1, -6, -1, -2, -1, 0, -6, -3,
+    0, 1, -1, -11, 0, 0, 0, 1, -4, -2, -2, 1, -3, -3, -7, -5,
+    -8, -6, 0, -39, 0, -6, -4, -4, -4, -11, -28, -2, -4, -5, -14, -75,
+    -8, -39, -1, 2, 4, -3, -2, 0, -2, -2, 0, 3, -3, -3, 0, 2,
+    2, 2, 0, 0, 0, 0, 0, -5, -7, -5, -3, -5, 0, -4, -13, 0,
+    -2, -3, 0, -6, -7, -6, -3, 3, -3, -1, -15, -1, -9, -13, -4, -1,
+    -18, -10, -18, -7, -3, -2, 4, -2, -4, -10, -2, -4, 0, 5, -1, -10,
+    0, -2, -4, -3, -9, -2, 0, 0, 0, -4, 1, 0, -7, -2, 0, -30,
+    0, -3, -4, -1, -23, -2, -22, 1, -3, -2, -3, -16, -1, -22, 4, -1,
+    -11, -46, -4, -4, 3, 0, -6, 1, -5, -19, -5, 2, 0, -6, -1, -10,
+    -4, 0, -13, -18, -9, -6, 0, 0, -1, -4, -5, -1, -3, 1, 0, -15,
+    -10, -1, -7, -1, 0, -2, -9, -2, -5, -8, -17, -12, -44, -5, -1, -13,
+    -17, -15, -13, -12, -22, 1, 3, 1, 0, 1, -18, -12, -3, 1, -4, -3,
+    -4, -9, 0, 0, -2, 0, -1, 0, 0, 0, -5, -3, -5, -8, -1, -2,
+    -1, -38, -4, -6, -6, 0, -13, 0, -8, -2, -4, -13, -15, -2, 0, -5,
+    -11, -7, -8, -18, -9, -1, -4, -1, -6, -2, 1, -10, 0, -9, -19, -11,
+    -4, -4, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -2, -1, -1,
+    0, 0, -4, -3, -2, -2, 3, -1, 0, -14, 1, -8, 0, 3, -7, -1,
+    -13, -4, -6, -2, -2, -4, 0, -31, 1, 3, -1, -8, -3, 0, 4, -1,
+    -1, -1, -3, -1, 0, -1, -3, -6, -6, -1, 0, 0, 0, -3, -3, -7,
+    -16, 0, 0, -15, -4, 0, 0, 1, -2, -1, -66, 1, 0, 0, 4, -8,
+    -2, -59, 0, 0, -2, -9, -10, -3, -2, 0, -2, -4, -21, -15, -1, 3,
+    1, 0, -2, -10, -2, -1, -3, -5, -5, -22, -1, 0, 0, -1, -4, 0,
+    -3, -6, -4, -1, -4, -1, 3, 3, 1, 1, -12, -5, -1, 2, 2, 0,
+    0, -3, -4, -2, 7, 3, -1, -2, -5, -1, -1, 7, 0, 1, -3, -15,
+    2, 4, 3, 0, 3, 0, -6, 1, 3, -1, 2, -2, -14, 0, -3, 3,
+    -4, -4, -3, 0, -3, 5, 6, 5, -2, 3, 2, -5, -4, 2, -3, -3,
+    1, -2, -48, -10, 6, 1, -1, -4, -6, -17, -3, 5, -3, -5, 4, -3,
+    1, 3, 3, -3, 1, -3, -1, 0, -2, -12, -9, -3, 0, 0, 0, -9,
+    -3, -1, -3, -2, 0, 3, -34, 4, 6, 2, -2, 0, 1, -37, 0, -1,
+    -6, -9, 0, -9, -20, -1, 8, -18, -7, 0, -42, -3, -1, 8, -21, 3,
+    6, -7, -1, 1, 1, 5, 3, 0, 0, -2, -8, -2, -12, -1, 0, 0,
+    0, -1, 0, -1, -1, 0, -1, -5, -9, -5, -9, -9, -9, -23, -11, -1,
+    -3, -4, -3, -6, -8, -17, 0, -6, 0, -4, -1, -11, 0, 1, -6, -2,
+    -1, -19, -4, 5, 6, 2, 5, 1, -9, -3, -1, -3, -2, -1, -6, -5,
+    0, 0, -1, 0, 0, 0, 0, 0, -2, -6, -11, -13, -4, -4, -11, -4,
+    1, -7, -9, -2, -3, -8, -15, 2, 1, -3, -3, -13, -7, -7, -4, -3,
+    -1, -38, -19, -32, 3, -2, 1, 4, 4, -17, -8, -1, 1, 2, 1, -3,
+    -2, 0, -1, -3, -3, -2, 0, 0, -2, -5, -2, -3, -6, -6, -7, -23,
+    -1, 1, -2, -8, -1, -4, -9, -5, -5, -1, -5, 1, -22, -12, -1, -4,
+    -2, -2, -2, -26, -11, 3, 1, 3, 5, 2, -4, -7, 0, -1, -1, -1,
+    -3, -4, 0, -5, -8, -7, -4, -6, -2, -1, -68, 0, -3, -3, -2, -7,
+    -6, -61, -3, 0, 1, -5, -26, -1, -15, 5, -5, -15, -82, -7, -6, 0,
+    2, -6, 2, 4, -25, -4, 1, 2, 0, -3, -1, -9, 0, -4, -17, -10,
+    -4, 0, 0, 0, -2, -1, -5, -1, 0, 0, -2, 3, 3, -1, -8, 0,
+    0, -6, -12, 3, -5, -12, -2, 0, -17, -26, 2, 4, -11, -5, 0, -26,
+    -8, -2, 6, -16, 4, 0, 1, 2, -1, 3, 2, 1, 0, -3, 2, -3,
+    -5, -7, -1, 0, 0, -1, -5, -3, -4, -1, 0, -1, -6, 5, 5, 1,
+    -3, 0, -2, -2, 0, 1, -5, -13, -1, -5, -60, -3, 4, -2, -22, 0,
+    -14, -5, -2, 6, -1, 1, 3, -26, -4, -3, 4, 2, 0, 0, -3, -1,
+    -5, -3, -3, -5, 0, 0, 0, -5, 0, -7, -6, -1, 0, -5, 3, 6,
+    4, 2, -5, -1, -5, -2, 2, 2, -1, -4, 0, -29, -10, 4, 2, -2,
+    -24, -1, -21, -4, 4, 0, -21, 2, -1, -4, 1, 3, 0, -2, 2, 0,
+    1, 0, -2, -2, -4, 0, 0, 0, -1, 0, -8, -4, 0, 0, -4, -1,
+    1, 0, -1, -6, 0, -11, 1, 3, 1, 1, -10, 0, -36, 5, 4, 0,
+    -18, -7, 0, -3, 9, 3, -7, -13, -11, 0, 7, 5, -2, -6, -6, 2,
+    0, -2, -3, -2, -5, -3, 0, 0, -9, -7, -3, -8, -5, -1, -10, -1,
+    -1, 0, 3, 2, -6, -20, 0, -2, 3, 1, 2, -9, -10, -2, 2, 4,
+    -1, -1, -12, -47, 1, 1, 4, -1, 0, -5, -2, 4, 4, -1, 4, -3,
+    -4, -4, 0, -3, -3, -2, -6, 0, 0, -6, -6, -5, -8, -3, -4, -4,
+    -6, 1, 4, 3, 2, -7, -3, -1, -1, 3, 2, 1, -3, -13, -3, 2,
+    4, -2, -38, -5, -33, 3, 0, 3, -4, -7, -1, -4, 1, 3, 1, -3,
+    -3, 0, -2, -6, -8, -1, -19, -1, 0, 0, 0, 0, -1, 0, 0, 0,
+    0, 4, 3, -1, 3, 0, 0, -4, -10, 2, -4, -41, -2, 0, -9, -6,
+    2, 1, -7, -5, 0, -16, -3, -1, 6, -29, 1, 0, -1, 2, -3, 6,
+    0, -1, 0, 0, 0, -1, 2, 1, 0, 0, 0, 0, -1, -2, -2, -1,
+    0, 0, -2, -6, -7, -9, -4, 0, 0, -12, -12, -9, -6, 1, -1, 0,
+    -15, -19, -6, -5, 3, -1, 0, -36, -12, -6, -7, -29, 0, 0, -2, -6,
+    -5, 1, -5, 0, 0, -3, -5, -6, -6, 0, 0, 0, -2, 1, -1, -4,
+    3, 0, -2, -8, -1, 6, 7, 2, 0, -5, -13, -6, 6, 0, -5, 0,
+    -17, -5, -3, -3, -31, -5, 0, -39, -3, -2, -3, -1, 3, 4, -1, -3,
+    -2, -1, 5, 0, 0, -3, -27, -21, -8, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -11, -4, -4, -4, -10, -6, -1, -45, -3, -9, -12, -6,
+    -3, -1, -7, -7, -10, -6, 4, -10, 0, -14, -12, -11, -4, -22, -13, -1,
+    -1, 0, -2, 2, 2, -14, -1, 1, -3, 1, 4, 1, -4, 0, -1, -9,
+    -3, -9, -3, 0, 0, -20, -1, 5, 6, 0, 0, 2, -98, -1, 5, 6,
+    -7, 0, -10, -5, 4, 7, -5, -42, 0, -20, 4, 1, 4, -64, -3, 0,
+    -10, 4, 3, 1, -30, -3, 0, 0, -4, -5, -2, -9, 0, 0, 0, -1,
+    -7, -1, -9, -2, 0, 0, -7, 2, 2, -2, 0, -2, -2, -6, 1, 0,
+    -3, 1, -3, -1, -65, -15, -5, -6, -23, -1, -10, -12, -8, -1, 5, -14,
+    -2, -9, -11, -8, 0, 5, -3, -1, 0, -3, -3, -7, -10, -1, 0, 0,
+    0, -2, -1, -3, -2, 0, 0, -12, -3, -4, -2, -1, 0, -3, -7, -2,
+    -8, -4, 0, -8, -1, -2, 0, -3, -3, 1, -3, -2, -1, -2, -6, 0,
+    0, -11, -2, 3, 2, 1, -1, -1, -3, -1, -4, -4, -3, -8, -1, 0,
+    0, 3, 0, 4, 3, -6, 1, 0, 1, -7, -1, 1, 0, -35, -1, -11,
+    -14, -8, -2, -3, -12, -4, -8, -18, -9, -4, 1, 2, 6, -1, 0, 6,
+    9, 16, 3, -1, 2, -1, 4, 12, -2, -2, 0, -1, -6, -10, -11, -5,
+    0, 1, 0, -3, 1, -4, -2, -4, -6, 3, 1, 0, -3, 0, -11, -5,
+    4, 4, 3, -2, 0, -3, -10, -3, -2, -2, -5, -2, 9, 3, 0, 1,
+    0, -1, 6, 1, 5, 2, 2, -3, 2, 1, 0, 0, -9, -10, -5, 4,
+    -5, -14, 0, -7, -3, 4, 3, 1, -8, -14, -9, -1, -1, 0, 0, -8,
+    -15, -1, 4, -1, 6, 1, -10, -1, 10, -1, 8, -4, -1, 3, -14, -11,
+    -9, 1, 2, 1, -1, -2, -14, -9, 4, 12, -1, 0, -1, 0, 9, -15,
+    4, -20, -2, 0, -3, 8, -2, 2, 2, 0, -5, -10, -2, 0, 5, -1,
+    -3, 0, -8, -3, 5, 1, 1, 0, -12, -16, -2, -1, -2, -5, -7, 2,
+    1, 6, 0, 1, 0, -1, 1, 0, 3, 4, 5, 4, -2, -5, -4, -1,
+    0, 5, 0, 1, -1, 0, -5, -10, -11, 0, 0, -2, -9, 5, 4, 6,
+    8, 0, 0, -8, -1, 4, 6, -3, -1, -1, -2, 0, 0, -5, -16, -1,
+    -3, -3, -12, -5, -9, 1, 2, 7, -3, -3, 6, 7, 7, 11, 5, -5,
+    -1, 2, 0, 0, 0, -1, -5, 2, 2, 2, -3, 3, -7, -3, 3, 5,
+    -3, -6, -12, 5, 0, 7, 5, 4, -2, -10, -1, -2, -2, -1, 3, -13,
+    -4, -2, -2, -17, -10, -7, -10, 6, -1, 4, -3, -12, -3, 2, -2, 0,
+    -6, -4, -19, -6, 1, 0, -1, -3, 4, 4, 3, 7, -4, -1, -1, -3,
+    2, 3, 1, -11, -17, -8, -3, 0, 0, 0, -16, 5, -3, -1, 6, -5,
+    2, 0, -8, -8, -5, 2, 8, 6, 1, -13, -4, -4, 3, 15, 8, 5,
+    0, -11, -12, 10, 11, -23, -1, 0, 3, -2, -3, -10, -9, -3, -6, -5,
+    4, 2, 1, -7, -55, -6, 3, -2, -6, -10, -10, -17, -2, -2, 1, -6,
+    0, -2, 3, 3, 9, 6, 4, -3, 2, 6, 2, 10, -4, 0, -7, -4,
+    19, -2, -93, -47, -8, -4, -6, 1, -8, -2, 5, -2, -2, -8, -29, -2,
+    -5, -1, -1, -4, -1, -22, -12, 6, 7, 6, -10, -4, -3, -4, 15, 16,
+    13, 3, 6, 14, -7, -8, 0, -4, 7, 18, 10, -57, -25, -22, -9, 16,
+    12, 16, 0, -6, -16, -12, 7, 5, 1, 0, -11, -1, 1, 3, 0, -22,
+    -17, -5, 1, -2, -5, -4, -99, -14, 4, 8, 2, -15, -9, 0, -6, 3,
+    6, 1, -5, -7, 1, -24, -3, -6, -7, 7, 12, 29, -3, -27, -3, 0,
+    10, 9, 15, -1, 0, 0, 0, 0, 0, 1, 0, 1, 1, -1, 1, -4,
+    0, 0, -3, -5, -5, -12, -5, -9, -1, -6, -2, -6, -8, -3, -4, -7,
+    -2, -14, -4, -4, 4, -1, 1, 3, 2, 2, -3, 9, -3, 2, 5, 5,
+    2, 5, -4, 2, -1, -7, -6, -5, -8, -3, 1, 0, 1, -1, -5, -5,
+    -19, -3, -1, 3, -2, 4, 1, -8, -4, -2, 1, 0, -5, -5, -2, -10,
+    -1, -10, 1, -7, 1, 4, 5, 4, 5, 11, 4, 5, -4, 4, 6, 5,
+    3, -2, -1, -8, 2, -4, -14, -21, -17, -18, -9, 0, 1, 2, -2, -3,
+    -4, -11, 8, -1, -1, 4, 1, 2, 1, -2, 1, 5, 1, 0, 2, -1,
+    -6, -7, -3, -2, -2, 0, 1, 2, -1, 3, 2, 6, 2, 5, 10, -6,
+    5, 6, 3, 4, 10, 6, -3, 1, -5, -8, 1, 2, 5, -8, -9, 1,
+    7, -16, 1, 0, -9, -9, -15, -6, -11, -4, 1, -5, -7, -10, 7, 1,
+    -7, -10, -15, -14, -12, 0, 0, -1, -7, -1, 4, -2, -8, 4, -7, -11,
+    -2, 4, -8, -7, -1, -6, -6, -3, -18, -29, -15, -29, -5, 0, 6, -3,
+    -3, 1, -6, -6, 1, -2, -11, -2, -8, -7, -6, -2, 2, -2, -1, 1,
+    5, 2, -4, -3, -8, -11, -8, 1, -5, 0, -2, -3, 0, -6, -4, -6,
+    -8, 3, 2, 1, -10, -4, 2, -2, 1, -23, -30, -33, -26, -3, 1, 0,
+    -1, 13, -5, -5, -12, -5, -2, -2, 3, -1, -6, -14, -44, -2, 6, 8,
+    5, -3, -12, -47, 2, 9, 2, -9, -6, 4, 10, 6, 1, -1, -1, 3,
+    7, 8, 4, 0, 4, 2, 2, 6, 10, -20, -11, -2, -1, 1, 1, 8,
+    -1, 0, 5, 5, 0, 0, 0, -4, -4, 3, 3, -1, -2, -52, -5, -2,
+    1, 7, 2, -1, -58, -12, -3, 1, -2, -5, -2, -3, 3, -2, 1, -4,
+    2, 11, 5, 1, 2, 3, 6, 11, 10, 7, -9, 2, -2, -1, 1, -4,
+    1, 0, 4, 6, 7, 3, -2, 0, -2, 0, 2, 2, 4, 1, -41, 1,
+    -2, 1, 6, 1, -2, -19, -6, -4, -8, -4, -4, -2, 5, 3, 1, -1,
+    0, 0, 5, 6, -1, 1, 1, 0, 9, 10, 2, -14, -3, -3, 0, 4,
+    -2, 3, 0, -4, -2, -3, -3, -1, -9, -1, -5, -1, 0, -1, -1, -127,
+    -7, -1, 1, -5, -4, -4, -11, -4, 4, 3, 2, 3, -1, 3, -2, -4,
+    -2, -3, 2, 11, 17, 5, 0, -6, -1, 2, 6, 15, 1, -19, -29, 0,
+    9, 2, 0, 0, -4, 9, 11, 1, 1, 0, -5, -3, -2, 6, 5, -2,
+    0, -2, -8, -11, 2, 7, -9, 1, -11, -18, -19, -3, -5, -14, 0, -2,
+    2, 0, -10, -9, 0, 0, -5, 1, -2, 1, 6, 0, 0, -4, -13, -8,
+    -15, -18, -2, 0, 0, -7, -6, 0, 1, -1, -1, 2, -4, -2, 0, 0,
+    2, 0, -2, -10, -3, 0, 4, -1, -2, -5, -16, -8, -3, -1, -4, -4,
+    1, 0, 0, -6, -11, -11, 10, 2, 0, 4, -4, 1, 4, 8, 1, 0,
+    5, 0, -3, -7, -1, -1, -12, 5, -8, -6, -8, 5, -2, -4, 0, 0,
+    2, 1, 7, -5, -19, -9, -1, 3, 3, -2, -10, -16, -20, -4, 0, 5,
+    -6, 3, -5, 0, 1, -3, -4, -12, -2, -4, 0, -6, -5, -5, -1, 0,
+    -11, -21, -21, -4, -8, 2, 1, 2, -31, -25, -18, -28, -1, 0, -3, 0,
+    -9, -5, -8, -3, 0, 0, -2, -2, -1, 1, -13, -7, -12, -13, -5, 3,
+    -1, 6, 1, -3, -2, 4, -3, -3, 3, 6, -3, 3, -3, -8, -9, -5,
+    0, -19, -19, -31, -15, -11, -1, -1, -1, 5, -2, -2, 1, -1, -5, 2,
+    3, 0, -2, -1, 1, -1, 3, -6, 0, -2, -2, -3, 2, 4, -2, -1,
+    -1, 2, 7, 3, 5, 6, 4, 4, 8, 11, 6, 4, 1, -1, 2, 4,
+    3, -12, -9, -2, -2, 3, 3, 2, 0, 0, -6, -12, -10, -10, -8, -3,
+    5, 2, 1, -1, -9, 2, -3, 0, 1, -2, -2, 3, 7, 1, 1, 2,
+    4, 5, 3, 11, 5, 7, 8, 2, -4, -3, 9, 8, 4, 1, -6, -7,
+    -14, 1, -11, -24, -29, -27, -11, -11, 0, 0, -3, -7, 0, -1, 0, 0,
+    -8, -5, -2, 4, -3, -1, -1, -13, -11, -19, 0, 8, -9, 1, -27, -10,
+    -12, 4, 1, -25, 0, -4, 1, -7, -5, -15, -2, 1, -5, -7, -4, -6,
+    -4, 8, -1, -1, -8, -1, -19, -5, 2, -1, -1, 0, 0, -1, 2, 2,
+    0, 1, -3, 3, 2, -2, -3, -8, -3, 1, -3, -8, -5, -7, -18, -4,
+    4, -2, -1, -15, -1, -1, 4, 11, 11, 1, 3, 3, 2, -2, 10, 6,
+    6, 6, -8, 3, 0, -7, -10, -18, -2, 1, 0, 0, -4, -4, -6, -12,
+    6, 0, 0, -1, -1, -6, -24, -12, -2, -5, -2, -6, 0, -6, 5, -6,
+    2, 4, -1, -6, 2, 7, -1, 3, 5, 6, 3, -12, -1, -3, 5, 2,
+    -9, -8, -8, -9, 0, -9, -97, -116, -66, -4, 0, 0, 0, -1, 2, 0,
+    -1, 1, 0, 1, 2, 2, 0, -6, -11, -41, -16, -7, -9, -10, -6, -19,
+    -84, -16, -1, -8, -2, -11, 4, 4, -1, -9, -3, 1, 1, 10, 3, -5,
+    -3, -4, 0, 8, 10, 10, -4, 1, -3, -5, 6, 0, -1, 0, -10, -17,
+    -23, -13, -25, 0, -4, -2, 1, -10, -18, -16, -4, 0, -3, -4, -4, 2,
+    4, -5, -4, -16, -4, 3, 5, 5, -3, 1, 1, 4, 2, -1, 0, 2,
+    0, 1, -11, -7, -7, -4, 0, -1, -15, -25, -20, -14, -4, 0, 0, -1,
+    11, 3, 0, -6, 1, 2, -3, 1, 3, 3, -2, -9, -3, -12, -3, 0,
+    2, -4, -12, -8, -10, -10, -3, -3, -1, 2, -5, 1, 1, 6, 5, -3,
+    3, 0, -2, 1, 6, 6, 1, 7, 0, -9, -6, -1, -12, -12, -1, 1,
+    2, 11, 1, -3, -7, -2, 0, -3, 0, -3, -2, -1, -3, -6, -6, -5,
+    1, -6, -9, -7, -14, 3, 5, 0, -5, -2, 1, 2, 2, 1, 0, 0,
+    1, 3, 0, -5, -1, -2, -2, 3, 4, -4, -10, -9, 0, 3, 2, 4,
+    1, -3, 0, 0, -8, -5, -1, -1, -4, 3, -6, -9, -4, -11, -3, -4,
+    -16, -18, 8, 7, -13, -1, -20, -13, -1, 10, 0, -16, 5, -2, -8, -3,
+    -1, -13, -26, 7, -2, -3, -7, -5, -8, -3, 0, 9, -5, -18, -4, -11,
+    1, 0, -4, 1, 3, -4, -8, -21, 4, 2, 1, 1, -2, -10, -8, -15,
+    1, 0, 1, 0, -2, -8, -31, -2, 2, 6, 1, -1, -5, -1, 3, -2,
+    0, -1, 1, -8, -5, 3, 3, 2, 2, 1, 1, 0, 6, 3, 0, 2,
+    6, -11, 0, 2, 0, -5, -1, 5, -19, -19, 0, 2, 4, 2, -2, -7,
+    -20, -8, -9, 1, 1, -2, -38, 1, 1, -8, -13, 5, 4, -5, 9, -1,
+    4, -1, -4, -2, 0, 13, -4, -2, -1, -15, -16, -40, 0, -4, 6, -10,
+    -64, -34, 0, -1, 7, -7, -5, 1, -8, -1, 0, -6, -1, 4, 3, 3,
+    -9, -7, 0, 1, 6, 0, -1, 1, 4, -8, -4, 5, 6, -1, -6, 3,
+    -1, 1, 4, 3, 7, 2, 3, 6, 2, 3, -4, 0, -12, 17, 6, 2,
+    -3, -2, -7, -10, 0, -1, -7, -21, 1, -1, 0, -3, 7, 8, 13, 8,
+    -1, 0, -6, 5, 13, 10, 4, -9, 0, -2, -4, -5, 2, 0, -1, 0,
+    8, -1, 8, 12, 9, 2, -1, 3, -1, 2, 2, -11, -11, -3, -1, -4,
+    -2, -4, -4, -4, 1, 0, 0, -4, 1, -1, -3, 3, 5, 1, -2, 3,
+    1, 6, -26, -2, -5, 0, -7, -12, -6, -3, -6, 2, 16, -1, -3, 4,
+    2, 1, -4, 10, 5, 4, 1, -14, 3, -6, 1, 0, 0, -18, -13, -2,
+    -9, 1, -1, -3, -7, 0, 0, 6, -9, -1, 6, 6, -4, -9, -1, 3,
+    6, 0, -1, -11, -7, -11, -10, -7, 0, 2, -110, 4, 5, -6, 1, 3,
+    3, -2, 8, 9, 6, 4, -7, -3, -7, 1, 4, -4, -3, -3, -9, -34,
+    0, 13, 8, -7, -18, -15, 0, 1, -2, 0, 2, -7, -11, -4, 13, -6,
+    -1, -6, -13, -12, -82, -3, 6, 4, 9, 9, -3, -25, -15, -12, 3, 9,
+    5, -7, -48, -8, -17, -12, -1, 3, -7, -71, -6, -10, 8, 6, 3, 7,
+    -12, 0, 2, 4, 8, 11, 8, 1, -1, 2, -1, -1, 1, 2, -36, 2,
+    1, 6, 1, -3, -3, -19, -10, 3, 11, -3, -6, 0, -21, 9, 3, -8,
+    -7, -2, -1, -11, 2, 8, 11, 5, -4, -19, -23, 11, 11, 1, -1, -5,
+    -30, -18, -1, 2, 4, 8, -6, -5, 0, 0, 0, -3, 0, -3, 1, -31,
+    -12, -1, 0, 0, -4, 2, -49, -9, 2, 5, -2, -7, -14, -10, 13, -1,
+    -9, -5, 3, -2, -24, 52, 0, -1, -5, -9, -38, -74, 15, 9, -7, 2,
+    -1, -18, -4, 0, -2, -6, 1, -1, 0, 0, 0, -1, 2, -3, 4, 1,
+    0, 0, -4, -7, -16, -8, 5, -14, 1, 2, -1, -9, 9, 5, -7, -13,
+    0, -12, 2, 4, -3, -14, -2, -15, -10, -15, -6, -5, 0, -2, -3, -8,
+    -3, -1, -3, -8, 3, 8, 2, 1, 0, -4, 0, 0, -1, -11, -17, -4,
+    -61, -3, 2, -1, -5, -8, -5, -9, -12, -6, 0, -5, 3, 7, 6, -31,
+    -10, -14, -5, 9, 7, 1, -28, -6, -14, -17, -9, -1, 1, -10, -12, -7,
+    -4, 3, 6, 5, -10, 5, -5, -3, 11, 7, 9, 0, 0, -3, -7, -6,
+    -11, -17, -15, 2, 5, 4, 5, 3, -2, -2, -2, 4, -1, 3, 2, -2,
+    -11, -3, -3, 0, 8, 5, 5, -2, 1, 0, -5, 1, 4, -1, 2, -1,
+    2, 1, 0, 4, -2, -1, 10, 1, 3, 4, 4, 8, -7, -5, -52, -24,
+    -14, -23, -13, 0, -8, -18, -11, -15, -24, 5, 2, -9, -10, -5, -13, -8,
+    -8, -6, -9, -10, -2, -10, -12, -16, -19, 2, -7, -15, -12, 3, -7, -3,
+    -6, -5, -24, -15, -7, -4, -3, -6, -14, -27, -18, -13, 0, 0, -6, -3,
+    -11, 1, -5, -21, 1, -4, -2, -12, -2, -5, -66, -2, -1, -12, -6, -6,
+    -10, -61, -3, -6, -13, 0, 0, -6, -18, -3, 0, -1, -3, -6, -6, 2,
+    -8, -8, -4, -9, -15, 0, 1, -3, 0, -18, -27, -24, 4, -7, 0, 0,
+    0, -8, -7, -15, -14, -1, 4, 3, -2, -6, -20, -31, -25, 1, 8, 10,
+    -3, -12, -18, -25, -1, 7, 7, 7, 10, -6, -30, -6, -6, 9, 3, -6,
+    -17, -23, -13, -1, -1, 2, 3, -2, -33, 14, 3, 5, 5, 1, 2, -28,
+    -1, 1, -1, -1, 0, 0, 0, 0, 1, 2, -2, -6, -11, -64, 3, 0,
+    0, -4, -10, -15, -14, 3, -2, -3, 1, 6, 0, -49, 10, -8, 0, 3,
+    2, -10, -16, 1, 1, -1, 2, -5, -5, -16, 29, 3, 4, 5, 1, 5,
+    -22, 0, -9, -6, -4, -11, -1, 0, 4, 7, 2, 7, -1, -5, -21, 0,
+    0, 3, 2, -4, -6, -24, 0, -3, 1, 5, 5, -3, -12, 6, -2, 8,
+    3, 1, 0, -6, 1, 2, 2, 2, 0, -7, -11, 3, 5, 2, 2, 2,
+    -2, -37, -1, -1, -8, -1, 1, 1, -11, -1, 5, 0, 5, -4, -3, -67,
+    -5, 1, 3, 2, -5, -3, -65, -14, -3, -2, 0, 0, -1, -31, 3, 0,
+    -1, -2, -2, -5, -27, 3, -1, -1, 0, 3, -13, -58, 0, 4, 10, 6,
+    -1, -1, 1, -1, -9, -12, -11, -3, 0, 0, -5, -7, -5, -3, -9, -7,
+    0, -1, -4, -7, -18, -13, -75, 1, -13, -16, -4, 2, -5, -10, 0, 6,
+    -3, -6, -5, -1, -3, -1, 1, 3, -8, -18, -5, -30, 0, 6, -5, -11,
+    -21, -16, -8, 0, 0, -4, -13, -11, -16, -3, 0, -1, -5, -4, 4, 3,
+    6, 0, 1, -5, -3, 0, 0, 3, -2, -4, -15, -12, -3, -1, -4, -2,
+    6, 1, 2, 6, 7, 7, -6, 0, 0, -2, -4, 0, -2, -3, 5, -1,
+    -3, -10, -7, -16, 1, 0, -11, -5, -12, -6, -8, -4, 1, 2, -4, 2,
+    5, 5, -1, -5, -6, -9, 3, 5, 6, 6, 4, -5, -9, -4, -1, 1,
+    -4, 15, 7, -8, -6, 0, 8, 9, 28, 3, -7, -5, 1, 4, 1, 3,
+    1, -16, -16, -8, 3, -6, 0, -2, -28, -127, -54, -27, -1, 0, -2, -7,
+    -5, -2, -7, -58, 1, 5, 8, 7, 4, 9, -32, -6, -2, -8, -5, 1,
+    -2, -19, -3, -12, -28, -7, 1, 2, -7, -3, -19, -15, 3, 1, 6, -7,
+    0, -46, -19, 1, 0, 6, 0, 0, -5, -6, -3, -2, -11, -5, 8, 4,
+    3, 3, -4, -4, -30, 3, 0, 0, 3, 0, -5, -14, -1, -3, 4, 8,
+    4, -2, -11, 0, -2, 1, 2, -1, -3, -4, -1, 3, 0, 4, 1, 5,
+    -5, 2, 3, 2, 4, 9, 5, -1, 0, -7, -5, -11, -8, -14, -8, 0,
+    -2, 0, -2, -2, -3, -60, 0, 0, 5, 11, 10, 7, -13, -8, -2, 2,
+    0, 2, -15, -41, -6, -14, -4, -5, 4, 4, -22, -14, -2, 4, 3, 0,
+    5, 0, -2, -8, 2, 6, 9, -9, 0, 1, -2, -4, -3, -1, 0, 1,
+    -13, -12, 0, -6, -23, 0, 0, 1, 0, -5, -7, -15, -47, 0, -6, -5,
+    -11, -6, -15, -53, -1, 6, -5, -3, -2, -13, -11, 0, -3, -3, -4, -10,
+    6, -9, -1, 14, -8, -7, -7, -21, -5, 0, 0, 0, -2, -4, -5, -1,
+    0, -1, -4, -5, -5, -3, 0, -5, -3, -6, -4, -12, -4, 8, -16, -4,
+    -16, -5, -3, 10, 11, -6, 5, -4, -11, -5, -2, -12, -5, -1, -9, -9,
+    -4, -4, -6, 1, 3, 1, -8, -5, -5, -2, 0, -6, -2, -11, 4, -15,
+    -32, 1, -6, -1, -5, -12, -18, -81, -1, 2, -6, -10, -11, -15, -19, -1,
+    -1, -7, -1, 3, -29, -15, 0, -5, -6, -10, -6, 1, -8, -2, 1, -12,
+    -3, -1, -6, -4, 0, -2, -40, -10, -9, -10, 0, 1, 0, 0, -1, 0,
+    0, 0, 0, 1, 6, -4, -11, -15, -20, -56, -26, -3, -10, -9, -19, -18,
+    -33, -24, -16, -8, -1, 4, -8, -8, 0, -25, -5, 0, 3, -24, -16, 7,
+    -2, 1, 1, -11, -18, -25, 19, -1, -2, -1, -1, -2, -40, 1, -24, -58,
+    -30, -64, -38, 1, 2, -9, -12, -12, -18, -80, -1, 0, -6, -15, -6, -1,
+    -10, -2, -13, -10, -9, -11, -12, -16, -3, -8, -18, -22, -8, -4, -1, -1,
+    -5, -13, -17, -7, 0, 3, 0, -1, -36, -12, -2, 0, -6, 0, 0, 8,
+    -10, -8, 0, 6, -1, -3, 1, 0, 2, -1, 7, -6, -26, -11, -16, -4,
+    -4, -1, -10, 5, -4, -9, 4, 6, 4, -18, 4, 3, -3, 5, 0, 7,
+    -6, 3, 0, -7, -1, -3, -9, -5, 2, 8, -1, -3, -2, -6, -1, 0,
+    0, -3, 4, 2, -18, -1, 4, 4, 3, 3, -1, -5, -6, -4, -1, 2,
+    5, -1, -5, -27, -4, -8, -2, -1, 1, -6, -6, 0, -2, -8, 0, 1,
+    -7, -30, 3, 4, 3, 1, -1, -3, -49, -4, 2, 3, 1, -1, -3, -1,
+    0, 0, -4, -5, -13, -5, 0, 0, 0, -1, -3, 0, -6, -3, -1, -3,
+    1, 1, 2, 5, 0, 4, 2, 0, 3, 2, 2, 0, 0, -2, 1, 0,
+    -2, -5, -3, 0, -42, -15, -3, -5, 1, -2, 0, -1, -3, -3, -4, -6,
+    0, 0, -3, -9, -4, -8, -5, -4, 0, 1, 2, -2, -4, 0, -3, -1,
+    -3, 0, -3, -1, -3, -4, -3, 3, 3, 3, 1, 2, -1, -1, 3, 0,
+    1, 2, 2, -1, -5, -6, -2, -1, 1, 3, -1, 0, -9, 1, -3, -2,
+    -4, -2, 0, -2, -13, -19, -10, -7, -2, 0, -3, -2, -5, -4, -1, -4,
+    -4, -2, -2, -3, -4, 2, -5, 0, -3, 0, 1, -2, 3, -2, -1, -12,
+    2, 1, 0, -1, -5, 0, -35, -127, -16, -5, 2, 0, 0, 0, -1, -1,
+    -5, -6, -1, 0, -5, -17, -9, -17, -1, 0, -2, 0, -1, 4, -2, 0,
+    -4, 1, 4, 5, -3, -2, -3, -2, 1, 3, 5, 1, 1, -3, -2, -3,
+    3, 2, 3, 1, 1, -3, -20, -6, 0, -1, 2, 2, -2, 0, -6, 0,
+    -2, -1, -1, 0, 0, -1, -7, -13, -4, -1, 0, 0, -4, 2, 1, -5,
+    -2, 0, -3, 0, 1, -8, -9, -12, -1, 2, 2, 1, 0, -7, -8, 0,
+    2, 0, 4, -1, -2, -2, 0, -6, 0, -2, -1, -1, -2, -1, -9, -9,
+    -2, 0, -1, 1, 0, 0, -3, -2, -9, 0, -9, 0, -4, 0, 0, -6,
+    -5, -4, -1, -2, 0, -1, 5, -6, -7, -8, -1, 1, -1, -1, -5, -8,
+    -1, 1, -1, -4, -3, -10, -3, -5, 3, -5, -7, 2, 1, 2, 1, -7,
+    0, 2, -1, -2, 0, 0, 1, -4, -4, -5, -4, -5, -2, -2, 3, -1,
+    -3, -3, 1, 2, -1, -1, 2, -3, 0, -3, -3, -3, 1, 1, 1, 1,
+    1, -1, -18, -4, 2, -3, 2, 1, -7, -8, -19, -9, -2, -1, 1, -1,
+    0, -3, -4, -2, -5, -3, -1, 0, 0, -8, -21, -49, -19, -2, 1, -5,
+    -8, -3, -3, -1, -2, 0, -2, -3, -3, 0, 2, -2, -1, 2, 2, -6,
+    0, 2, -2, 1, -2, -5, 1, -3, -1, -3, -7, -2, 0, -4, -14, -5,
+    0, 0, -6, -10, -21, -15, -3, 0, 1, -4, -4, -7, -2, 0, 1, 0,
+    0, -1, -2, -2, 0, 2, -1, -3, -2, -3, -7, -3, -4, -2, -11, -4,
+    2, -8, -1, -2, -37, -14, -5, 4, -4, 0, -5, -7, -91, -71, -33, -4,
+    0, -1, 0, -1, -3, -2, -2, -2, 0, 0, 0, -4, -8, -9, -3, -3,
+    3, 0, -6, -7, -8, -3, 1, -1, -3, -3, -1, -6, -6, -4, -1, -5,
+    -2, 0, -6, 1, -3, -1, 0, -2, 0, 1, 1, 0, 0, -11, -61, -7,
+    1, 3, 1, 0, 0, -1, -1, -1, 0, 0, 0, 0, -2, -6, -4, -2,
+    0, 0, -3, -4, -3, -4, 0, 2, -1, -4, -2, 0, 0, 5, 2, -1,
+    1, 1, -1, 1, 2, 1, 2, -2, -4, -1, 4, 3, -2, -1, -4, -3,
+    2, 1, 0, 0, 0, -4, -4, -8, -2, 1, 0, 0, -1, -2, -3, -10,
+    -9, -3, 0, -2, -3, -2, -1, 2, 2, 0, 0, -1, 0, 3, 4, 2,
+    2, 3, 3, -3, -1, -1, -5, -4, 3, -2, -1, 1, -1, -6, -5, -5,
+    0, 1, -2, 3, -4, -1, 0, -4, -2, -4, -1, 0, 0, -4, -9, -5,
+    -6, -5, -2, -1, 1, -2, -1, -3, 0, 0, -1, 0, 3, -1, 0, 3,
+    2, -3, 3, 4, -1, 2, 2, -3, 1, 3, 2, 1, 2, 3, 1, -1,
+    1, 1, -1, 0, 1, -2, -5, -2, 0, 0, 0, 0, -2, -7, -7, -5,
+    -6, -1, -5, 0, -1, -2, 3, 7, 4, 0, 0, 4, 4, 0, 6, 3,
+    -1, -1, -1, -3, -6, 4, 0, -3, -3, 2, -2, -1, -1, 0, -3, -7,
+    -7, 0, 1, 0, 2, 1, 0, -2, 3, -3, -5, -3, -1, 0, 0, -9,
+    -11, -6, -3, 3, 0, -2, 2, 5, 3, 6, 4, -1, 1, 2, 2, 1,
+    5, 3, -3, 3, 1, -1, -4, 2, -1, -1, -4, 1, -2, -1, -1, -1,
+    -3, -8, -5, -1, 2, 3, -3, -2, 0, -2, 0, -3, -5, -4, 0, 0,
+    0, 0, -3, -4, -3, -1, -2, -6, -8, -7, -8, -4, -4, -5, -8, -11,
+    -4, -4, -1, 0, -3, 2, 0, 1, -2, 6, 1, 1, 3, 3, 4, 3,
+    2, 0, -2, 0, -1, -3, -2, -1, -5, -5, 1, 0, -1, -4, -1, -4,
+    0, -1, 0, -2, 0, 0, 0, -1, -3, -12, -6, -11, 1, -7, -1, -3,
+    -12, -5, -5, 1, -2, 0, 2, 4, 2, -1, 1, 3, 1, 2, 2, 2,
+    4, 2, -5, -11, 1, 0, -2, 0, 0, -2, -5, -8, -1, 0, 1, 1,
+    -1, 0, -2, -4, -15, -4, 0, 0, 1, -1, 1, -1, -6, 1, -2, -5,
+    -3, -3, -8, -5, -2, -2, 0, 2, 2, 0, 0, 0, 1, 1, 1, 2,
+    2, 3, 2, -1, -3, -3, -5, -1, 1, 2, -2, -4, -5, 2, 0, 2,
+    0, -2, 0, -4, -7, -14, -12, -9, -5, 0, 3, 0, -3, -2, -5, -2,
+    -2, -2, -1, -4, -2, -5, -2, -1, 0, -3, 4, -1, -1, 1, 0, -1,
+    -1, 4, 1, 0, -4, -5, 0, -1, -6, -3, -2, 1, 0, -8, -24, -2,
+    -10, -4, 0, -1, -6, -7, -6, -2, 0, 0, 0, 2, -1, 3, 0, -3,
+    0, 3, 3, 0, 0, -2, -12, 0, 1, 0, -3, -3, -2, -6, 0, 0,
+    0, -1, 1, 0, 0, 0, -31, -10, -1, 2, 3, 1, 0, -2, 0, -1,
+    -3, -5, -3, 0, 0, -3, -6, -9, -3, -1, 0, 3, -1, 1, 3, 1,
+    1, 0, -1, 3, 4, 0, 0, -1, -1, 1, 0, 2, -1, 3, -5, -1,
+    -1, 0, -2, 2, -3, -1, -3, -9, -5, -1, 1, 3, 1, -1, -2, -1,
+    1, -1, -1, -1, 0, 0, -4, -12, -15, -10, -4, 0, 2, 3, 3, 4,
+    4, 2, -2, 3, 4, 6, 3, 2, 1, -2, 1, 1, 1, -1, 2, -3,
+    -11, -4, -1, 0, -1, 1, -1, -7, -2, -4, 0, 1, 3, 3, -2, 0,
+    -7, 2, -1, -3, -3, 1, 0, 0, -7, -9, -45, -7, -1, 0, -7, -3,
+    1, -3, 1, 4, 1, -1, 1, 2, 3, 4, 0, -2, -4, 1, -3, 0,
+    1, -7, -1, 1, 0, 0, 0, -5, -2, -1, -2, -1, 1, 1, 2, -4,
+    0, -1, -1, -4, -3, -4, -1, 0, -6, -10, -6, -8, -3, -4, 2, 2,
+    -1, 0, -2, 1, 1, -2, 1, 0, -1, 2, 4, 1, 1, 4, 3, -1,
+    1, 1, -3, 0, 4, -1, 1, 3, 1, -1, -2, -1, -2, -2, -1, 0,
+    -1, -12, 0, -3, -3, -2, 0, 1, 0, -4, -9, -3, -7, -2, 0, -2,
+    -2, -1, -1, 3, 5, 1, 0, 2, 3, 1, 2, 5, -5, 1, 3, 1,
+    -1, 2, -1, -3, -1, 3, 0, 1, -2, -2, -2, -5, -2, 1, 1, -2,
+    0, 0, -6, -2, -3, -5, -6, 0, 0, 0, -3, -2, -2, 0, 0, 0,
+    -1, -1, -1, -2, 0, 1, 0, 3, 4, -1, 0, 0, -4, 0, 0, -3,
+    -4, -5, -1, -11, 0, -1, -2, 0, 0, -1, 2, 0, -7, -2, -1, -2,
+    -3, 1, 0, 0, -5, 1, -2, -1, -3, 0, 0, 0, -2, -3, -2, 0,
+    0, 0, 2, -3, -2, 2, 1, -1, 0, -3, -7, -4, -1, 3, 3, 2,
+    -2, -2, 2, -2, -1, -1, 0, -5, -3, -2, 3, 2, 0, -1, -31, -4,
+    1, 3, 4, -1, 0, -3, -2, -2, -8, -2, 0, 1, -5, -7, -3, -3,
+    0, 0, -2, 3, 1, 4, 6, 9, -1, -3, 0, 0, -3, 6, 4, -2,
+    0, 1, -2, -10, -1, -5, 0, -5, -4, -6, -5, -3, -14, 0, -17, -1,
+    0, -2, -1, -2, 0, -3, -10, -13, -13, -2, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -16, -67, -17, -14, -11, -3, -8, -5, -8, -5, -15, -2,
+    -10, -9, -4, 0, -4, -4, 3, 6, 2, 2, -2, 2, 3, 1, -2, -2,
+    0, -3, -6, -2, 0, 1, 0, -31, -1, -3, -1, 1, -1, 0, -6, -10,
+    -6, -7, -3, 0, -2, -2, 2, 1, 0, 2, -3, 1, 2, 2, 1, 4,
+    8, -1, 1, 1, 0, -5, 3, 2, -1, -3, 3, -1, -3, -4, -7, 0,
+    -12, -3, -1, 0, -1, 2, 0, 0, -2, -4, -3, -3, -1, 0, 0, -2,
+    -12, -5, -3, -9, 0, 0, 0, -2, 1, -1, -2, -1, -5, 3, 4, 0,
+    2, 0, -1, -1, 3, 5, 2, 4, -2, 0, -4, -1, -1, -3, -1, 0,
+    -2, -4, -3, -5, -6, -1, 0, -3, 0, -5, 0, 0, -3, 0, 0, 0,
+    0, -6, -13, -16, -7, -2, 2, 1, -4, -8, -3, -6, 1, -1, -3, -6,
+    -4, -5, 1, 2, -2, 0, 3, 0, -2, 1, -3, -1, -1, 0, 2, 0,
+    2, -2, -5, -3, -3, -2, -4, 5, -2, 0, -8, -3, -5, -1, -2, -1,
+    -1, -2, -9, 3, 4, 1, -2, 0, -6, 9, 12, 7, -4, -11, -2, 4,
+    7, 3, -1, 0, -18, -1, -5, -3, -5, -13, -9, -9, -4, -9, -8, -7,
+    -14, -6, -2, -2, -12, -3, -10, -5, -10, 2, 0, -6, -9, -23, -12, -4,
+    0, -1, -22, -14, -10, 3, 2, -16, -12, -10, -8, -2, 6, 6, 14, -57,
+    -4, 6, 6, 7, 6, 5, -12, 11, 9, 4, -9, -7, -6, -21, 2, 2,
+    -4, -5, -4, 2, -19, 2, 6, 1, 1, 0, 0, -1, -12, 1, 0, -2,
+    -5, 9, -1, -12, -3, -5, -11, -5, -5, -14, 1, -3, -7, -3, -3, 6,
+    -22, -18, -4, 7, 2, 6, -9, 0, 18, -7, 15, 5, -2, -5, -2, -2,
+    1, 2, 1, -1, 10, -7, -9, -3, -2, 2, -14, 4, 1, 9, 6, -11,
+    -51, -35, -2, 0, -20, -4, -5, -15, -8, 0, -14, -1, 4, -12, -2, -14,
+    -3, -5, 5, 5, -1, -4, -4, -5, -6, 5, 6, 0, 2, 5, -5, -6,
+    2, 6, -2, -2, 8, 4, -1, -1, -3, -5, -1, 4, 5, -11, -7, 3,
+    5, -2, -14, 3, 1, -2, -17, -18, -3, -1, 0, -3, -5, -22, -21, -11,
+    5, 1, -9, -13, -13, -26, -13, -2, 5, -1, 13, -3, -3, 2, 0, 3,
+    0, 0, 10, 1, -1, 8, -2, -1, -2, -1, -1, -10, 3, -3, -37, -8,
+    -1, -1, 2, -13, 0, -1, -15, -13, -9, -8, -14, -3, -34, -13, -28, -9,
+    -15, -14, 4, -13, -21, 2, 6, 11, 4, -9, 6, 11, 5, 6, 6, 2,
+    4, -6, 6, 13, 8, 1, -4, 6, -1, -5, -6, -9, -8, -3, -19, 0,
+    -4, -10, -6, -10, 0, -1, -1, -11, 2, -8, -6, 4, -6, -21, -15, -1,
+    0, 3, 1, -2, -38, -6, 2, 2, 7, 4, 1, 5, 7, 5, 1, -2,
+    4, 0, 1, 8, 5, 2, 1, 7, 9, -12, 3, 1, -4, -1, -6, -6,
+    1, -13, -10, -4, -29, -35, 0, -1, 0, -40, -4, 1, -4, 6, -8, -2,
+    -13, 6, 10, 12, 9, -21, -14, -10, -18, -12, 3, -7, -12, -9, 0, -26,
+    -38, -37, -24, -21, -14, -19, -5, -6, -15, -60, -24, -2, 12, 7, -2, 11,
+    -15, 1, -15, -3, 4, 4, 10, 0, -14, -9, 2, -5, -2, -5, 5, -8,
+    -6, 0, -2, 8, 15, 7, -22, -25, -7, 16, 11, 1, 3, 6, 11, -3,
+    19, 0, 1, 0, -6, 12, 13, 4, -6, -10, -127, -22, -8, -2, 2, 1,
+    -19, -47, 0, 12, -2, 13, 13, 11, 0, 0, -11, -8, 1, -2, -1, 1,
+    -32, -16, 0, -2, -3, 6, 9, -26, -21, 5, 16, 3, 4, 1, -11, 9,
+    -4, -1, 3, -2, -32, -23, -9, 0, -2, -5, -30, -53, -5, -10, -15, -1,
+    -1, -11, -5, 0, 2, 4, -2, 2, 0, 0, 0, 1, -4, 2, -6, -1,
+    1, -1, -7, 12, 3, 2, 1, 3, -4, 2, 3, 8, -3, 4, 3, -15,
+    -9, -8, 2, -11, -12, -10, -4, 3, -6, -22, -4, -4, -2, 0, -12, 0,
+    -8, 1, -6, -2, 0, -18, -7, -1, -4, -1, 1, -1, -2, -39, -15, -15,
+    -27, -7, -1, 2, 5, 6, 9, -6, 1, -19, 4, -3, -4, -9, -4, -5,
+    -27, -13, -2, -13, -27, -25, -18, -61, -9, -21, -9, -6, -1, -8, -11, -13,
+    3, 6, 3, 6, -1, -3, -12, -11, 4, 3, 16, -1, 0, -11, -16, -16,
+    -9, -5, -9, -6, -3, -7, -6, 4, 8, 8, -23, -7, 1, 6, -2, 14,
+    17, -21, 3, 5, 11, -5, -6, -3, -19, 5, 6, 3, -3, 0, -3, -19,
+    0, 6, 7, 5, 0, 8, -17, 2, 1, 3, 7, 7, 8, -8, -73, -13,
+    -67, -12, -28, -1, 8, 6, 13, -38, -15, -6, -3, 10, 3, 11, -18, -42,
+    -29, -50, -7, -3, 1, 12, -10, -15, -4, -7, -19, -21, -3, 1, -8, -10,
+    -1, -4, -9, -14, -9, -3, -1, -2, -5, -63, -24, -15, -2, 0, 0, -33,
+    -16, -6, -19, -27, 1, -21, 4, 10, 6, -27, -19, -9, -9, 5, 11, -2,
+    -24, -33, -17, -8, -5, 8, 1, 4, -12, -12, -9, -7, -9, -6, -1, -1,
+    9, 4, -3, -9, -25, -15, 1, -5, 0, -32, -32, -31, -17, -5, -1, 0,
+    1, -1, -19, -1, 3, -11, -50, -29, -16, 15, 22, 10, 8, -30, -28, -7,
+    6, 23, 27, 9, -4, 13, 5, 1, 2, -8, 11, -12, 2, 19, 2, -15,
+    -15, -19, -11, 5, 11, 2, -1, 1, -15, -17, -6, 0, 5, 8, 2, -8,
+    -1, 0, -2, 0, -1, 0, 0, -9, -5, -15, 2, 4, -4, 9, -12, -7,
+    -4, 7, 11, 18, 4, -2, 6, 5, 10, 4, 8, 10, -5, 3, 9, -6,
+    -5, -2, -16, -8, -1, 3, 0, -2, -8, -12, -23, -2, 4, 4, -3, -2,
+    -6, 1, -10, -31, -6, 3, 2, -1, -12, -8, -3, -5, 5, -4, 3, -30,
+    -6, 4, 5, 12, 11, 8, -8, 10, 2, 6, 5, 4, 1, -8, 5, 9,
+    -2, -3, 2, -6, -11, 7, 7, 3, -4, 1, -4, -18, 0, 2, 2, 1,
+    -4, 7, 0, -22, -12, 5, -9, -1, -11, -11, 4, 7, 2, 4, 7, 18,
+    -6, -13, -15, 1, 12, 6, 12, -25, -10, -8, -7, -1, 1, -5, -36, -1,
+    12, 3, -9, 3, -70, -26, -5, 6, 6, 3, 0, -44, 0, -12, 4, -2,
+    -4, 0, 0, -2, -39, -64, -28, -2, 1, -1, 2, 2, 4, -6, -59, 1,
+    0, -2, 10, 4, 3, -27, -17, 0, -13, 1, 1, 2, 1, -7, 0, -1,
+    -17, -13, -7, -3, 6, -1, -1, -4, -5, -17, -16, -3, 2, -11, -13, -1,
+    -19, -23, 7, -1, -1, 0, -27, -10, -6, -6, -1, 0, 9, 0, -5, -18,
+    -16, 2, 0, 4, 5, -9, -22, -35, 5, 4, -5, 0, -2, -1, -8, 1,
+    -4, -4, 0, 5, 0, 4, -9, -10, -2, -6, -5, -13, 2, -2, -8, -2,
+    -8, -18, -19, -2, -1, -1, -25, -18, -7, -16, -3, -9, -3, -13, -5, -13,
+    -13, -17, -3, -13, 11, 12, 0, -31, -31, -20, -3, 4, -1, 1, -5, -6,
+    -12, -23, -3, -12, -5, 1, 4, 4, -26, 2, -5, -9, 2, 4, 1, -1,
+    -12, -22, -15, -8, -8, 10, -1, 0, -16, -15, -4, -10, -6, -1, -15, -6,
+    -14, -1, 2, -3, -3, -12, -6, -7, -17, -22, -7, -11, -25, -3, 3, -11,
+    -17, -16, -3, 1, 2, 0, -1, -5, -12, -2, 0, 9, 3, 0, 6, 2,
+    -1, -31, -14, -2, 3, 1, 4, -1, -68, -16, -8, 0, -2, -5, -4, 2,
+    -3, 3, 12, 13, 2, -15, -2, 4, 1, 6, 12, 5, 0, 5, 0, 3,
+    -10, -6, 1, -3, 2, 4, -4, 0, -2, -3, -6, 7, 11, 4, 2, 5,
+    9, -13, 0, 1, 9, 1, 6, 1, 0, -8, -10, -3, -4, -4, 6, -10,
+    0, -3, -1, 8, 4, -10, -3, -1, 0, -17, -28, -20, -5, -8, -5, -1,
+    -16, -18, -20, -19, -21, -10, 2, -2, -5, 0, -16, 0, -2, -1, 3, 6,
+    13, 4, -23, -12, -6, 1, 4, 9, -1, 0, -3, -7, -3, -1, 0, -1,
+    -5, 4, 9, -38, -35, 0, 0, 2, 6, -3, 3, -67, -33, -1, -15, -5,
+    -5, 7, -7, -15, 0, -18, -18, -14, -12, 2, -1, 0, -9, -11, -5, -12,
+    -11, 5, -1, -12, -3, -3, -26, -14, 1, 0, 1, 0, -6, -11, -13, -3,
+    1, -1, 8, 7, 16, -3, -15, 3, -4, 10, 4, 6, 4, 3, -4, -5,
+    0, -13, -3, -15, -8, -1, -2, -9, -6, -20, -25, -9, -8, 4, -9, -22,
+    -9, -4, 4, -1, 1, -4, -14, -14, -11, -3, -1, -6, -8, -5, 2, -6,
+    -20, 0, 1, 1, 1, 3, -10, -20, -4, -14, -6, 3, 12, -73, -16, -4,
+    -2, -4, -6, -32, -45, -33, 0, -1, 2, 1, -4, -2, -5, 5, -7, -13,
+    -10, -13, -10, 2, 1, -12, -38, -16, -3, -2, 1, -1, 1, -1, 0, 1,
+    -1, 1, 1, 0, -42, -22, 12, 17, -2, 6, -32, -17, -9, 4, 23, 20,
+    5, -39, -2, -4, 6, 2, 7, 15, -6, -3, -2, 0, -1, -13, -40, -9,
+    1, 3, -4, -11, -16, -46, -12, -13, -5, -2, -6, -16, -15, 0, -16, -34,
+    -11, -9, 4, 0, -9, 2, -3, 0, 7, -5, -12, -2, 3, 5, 7, -47,
+    -12, -9, -11, -9, -4, -6, -15, -24, -5, -13, -22, -24, 1, 6, 1, -1,
+    -2, -16, -19, -8, 1, 6, 0, -1, -18, -29, -9, -5, 6, 0, 0, -19,
+    -4, -13, -12, -3, 1, -21, 5, 3, -1, -5, -9, -13, -1, 17, 7, -4,
+    -5, 0, 9, 2, 4, 4, -5, 1, 5, -4, -12, 3, 2, -2, -3, 6,
+    0, -11, -5, -1, -6, 2, -3, -5, -2, -4, -5, -4, -2, -14, 1, 0,
+    -1, -18, -11, -1, -4, -11, -12, -4, -4, -9, -1, 2, 6, -21, -15, -3,
+    -3, 12, 6, 5, 2, -11, -5, -1, 2, 6, 0, -6, -1, 3, -1, -2,
+    -2, -9, 0, 1, 9, 2, 3, 2, -21, 2, -1, 3, 7, -5, -4, -1,
+    0, 2, -1, -3, -5, -4, 0, 0, -6, -3, -5, -12, -4, 0, 0, -4,
+    -4, -1, -2, -7, -5, 0, 6, 0, 2, -1, -1, -2, 0, 2, 0, 2,
+    5, -1, 3, 0, -8, -1, -1, 2, -1, -5, 0, 0, -4, -14, -11, -1,
+    0, 0, 7, 1, -2, -6, 0, 1, 0, 3, -2, -5, -3, 1, -3, -9,
+    -1, -2, -6, -6, -3, -3, -5, -1, 0, -3, 0, -1, -1, -9, 0, 2,
+    3, 1, 1, -5, -5, -2, -2, 2, -1, -1, -2, 0, -9, -47, -61, -59,
+    -35, -3, 0, -5, -4, -1, -1, -1, 2, 0, -30, -11, -8, -5, -2, -1,
+    -2, -27, 0, -3, 2, -1, -1, 0, -4, 1, 2, 0, 1, -1, 0, -6,
+    -3, -2, -1, 0, -9, 0, -46, -10, 0, -9, -9, -25, 0, 0, 0, -2,
+    -7, -3, 0, 0, 6, 2, -2, -3, 5, 0, -1, -2, 0, -3, -1, 4,
+    1, -2, -3, -2, -4, -4, -3, -1, -17, 1, 0, 1, 0, 4, -2, -31,
+    4, 4, 3, 4, 0, 2, -30, 1, 3, 2, 2, -1, -2, 0, -24, -5,
+    0, -3, 0, -5, 0, 3, 7, 16, 5, 1, 0, -1, -1, -4, -4, -3,
+    -1, 0, 1, -2, -9, -9, -3, -2, -1, 2, -2, -14, -5, -2, 2, 2,
+    -10, -1, -8, -7, 2, -2, -1, -8, 0, 4, 3, 1, -6, -3, -7, -30,
+    -3, 1, -4, -9, 0, 0, 0, 3, -5, 2, 2, -1, -7, -7, -17, -13,
+    -7, -2, -4, -10, -11, -6, -4, 3, 7, 5, -1, -12, -9, -4, 3, 3,
+    2, 2, -4, -6, 1, 1, 1, -5, -6, 0, 1, -5, -4, -1, -4, -26,
+    -22, -9, -11, -12, -3, 0, 0, 2, -2, -1, -1, 1, 2, -9, -4, -4,
+    -6, -2, 1, 0, -14, -6, -5, -3, 1, 2, -3, -10, 2, -2, 3, 4,
+    0, -3, -25, 1, -1, 2, -1, -2, -1, -9, -8, -2, -1, -3, -7, -16,
+    0, -1, -11, -29, -31, -8, 0, 0, 0, -2, -5, -2, 6, 1, -1, 0,
+    2, 1, 1, 0, -6, -5, -2, -2, -1, 3, -6, -7, -9, 1, -1, 0,
+    -3, -2, -7, -7, -1, 0, -1, 1, 1, -2, -6, -7, 0, -4, -1, 1,
+    -7, 0, -18, -39, -12, -14, -1, 0, -3, -5, -1, 0, 2, 3, 2, -28,
+    -9, -12, -11, -3, -1, -4, -21, -14, -11, -5, 7, 8, -2, -13, -12, -12,
+    4, 10, 4, -1, -26, -15, -12, -5, 0, -7, -8, -7, -26, -19, -2, 0,
+    -9, -16, 0, 0, -1, -1, -1, 0, 0, 0, -7, -2, -3, -1, -2, 0,
+    -1, -52, -7, -9, -5, -4, -7, -1, -12, -4, -4, 6, 8, 4, 0, -12,
+    -6, 0, 5, -1, 1, -2, -1, -4, -8, -4, -4, -5, 0, -11, -23, -4,
+    -6, -5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 1, 0, 0,
+    0, 0, -1, 2, 2, 4, -1, -1, 0, 5, 0, 3, 3, -6, -9, -1,
+    0, -3, 3, -4, -8, -3, -1, 1, 1, 1, -1, -2, 0, 0, -12, 0,
+    0, 1, -6, -8, 0, -11, -4, -6, -7, -3, 0, 0, 1, 2, 5, 14,
+    22, 5, 0, 4, 2, 2, 2, 4, -3, -4, 2, 0, 1, -2, -3, -5,
+    -11, 0, 1, 2, -3, -3, 1, -3, 0, 2, 1, 2, 1, 0, -10, -8,
+    -4, 0, 0, 0, -3, 0, -34, -58, -87, -23, -5, 0, 0, 5, 3, 1,
+    2, 3, 3, 0, 2, 2, 1, 0, 2, 1, -12, 3, 1, 0, -3, -1,
+    -3, -15, 2, 3, 0, 0, 2, 3, -11, 2, 4, 4, 4, 3, 0, -39,
+    -2, 2, 3, 4, 3, -5, -4, -12, -3, -3, -1, -1, -8, 11, 7, 1,
+    -1, 14, 13, 0, 5, -1, -1, -12, -8, -3, -7, 5, 1, -3, -11, -9,
+    -9, -2, 2, 6, 1, -4, -4, 2, 1, 1, 5, 1, 1, -1, 2, -1,
+    -12, 0, -6, -13, -5, -6, -5, -1, -16, -62, -61, -14, -1, 0, 0, 3,
+    9, 4, 0, -4, 0, 4, 3, -2, -4, -8, -10, 4, 5, 2, 0, -2,
+    -12, -16, 7, -2, 3, 3, -3, -7, -6, 4, 0, 1, 3, -5, 1, -2,
+    -3, -7, -2, -2, -13, -14, -4, -1, 0, -25, -61, -127, -85, -9, 0, 0,
+    0, -1, 4, 11, 5, 6, -10, -4, -9, -3, 4, -2, -3, -47, -5, -6,
+    -2, 1, 3, -14, -26, -11, -10, -1, -2, -5, -6, -8, -7, -5, -4, 2,
+    -4, -6, -10, -4, -2, 4, 2, 0, -3, -4, -110, -17, -7, -8, -4, -13,
+    0, 0, -1, 0, 0, 0, 0, -1, 0, -1, -1, 2, 3, -3, -15, -4,
+    -4, -3, 0, 5, -5, 0, -5, -12, -1, 3, -2, -6, -11, -1, -4, -1,
+    -1, -3, -7, -13, 2, 3, 4, 0, 1, -7, -4, -28, -2, -2, 2, -1,
+    -8, 0, 6, 11, -3, 1, 0, 0, -2, 0, -2, -1, -3, 2, -1, -23,
+    -4, -4, -11, -4, 0, -4, -14, -2, -7, -3, 4, 3, -5, -10, 1, 0,
+    -1, 1, -2, -1, -33, -1, 3, 3, 1, 0, -1, -3, -64, -3, 2, 1,
+    -5, -13, 0, 8, -3, -2, -4, -2, 3, 0, 1, -2, -1, -1, 1, -5,
+    -6, -1, -2, -1, 3, 2, -4, -7, -2, -1, -7, 3, 2, -4, -9, -4,
+    -3, -1, 0, -3, -6, -4, -35, -7, -2, 2, -4, -23, 0, -2, -14, -19,
+    -9, -1, 0, 3, 6, 4, -3, 0, 0, 0, 2, 4, -3, -4, -2, -3,
+    0, 1, 0, -11, -21, -16, -5, 0, 3, 2, -1, -3, -3, 1, 0, -2,
+    4, 6, -4, -2, -3, 0, -10, 0, 4, -6, -12, -10, 0, 0, -27, -12,
+    -13, -17, -3, 0, 0, 13, 11, 2, 3, 2, 0, 2, 4, 3, -4, -3,
+    -2, 0, 3, 1, -2, -8, -9, -5, 1, 2, 3, 0, -6, -3, -2, 2,
+    -1, 2, 4, -1, 0, 1, -2, -5, 3, 2, 1, -7, -3, -2, -1, -2,
+    -1, -2, -12, -18, 0, 0, 5, 2, -1, 2, 3, 6, -1, 0, 2, -1,
+    -5, 1, -1, 0, 1, 1, -2, -11, -6, 0, -2, 4, 2, 0, -4, 3,
+    2, -4, 3, 6, 2, 3, 2, 0, -1, -2, 2, 0, 0, -1, -2, 0,
+    -9, -7, -12, -15, -26, -2, 0, 0, 16, 18, 18, 21, 3, 0, 3, 2,
+    4, -1, 1, -2, -1, 5, 3, 2, -2, -4, -12, -1, 3, 1, -3, -10,
+    -2, 4, 0, 0, 2, -8, 4, 2, 0, 0, -9, -1, 3, 1, -3, -1,
+    0, -23, -49, -57, -42, -22, 0, 0, 3, 1, 1, 2, 5, 3, 1, 1,
+    0, 0, 0, 1, -1, 0, 2, -3, -1, -4, -4, -6, 0, 1, 0, 3,
+    1, 1, -1, -3, 2, 1, 1, 3, -2, -3, -2, -3, 3, 3, 2, 1,
+    0, -5, -60, -8, 0, 0, -3, 0, 0, 8, 1, -1, 2, 3, -5, 2,
+    4, 1, 1, 1, 0, -31, 0, 2, -1, -2, -2, -2, -2, -4, 2, 2,
+    0, -1, 0, 0, 0, 0, 2, 0, 3, 1, -1, -3, -1, -3, -1, -1,
+    -1, 0, -1, -53, -105, -77, -33, -3, 0, 0, 5, 5, 3, 1, 0, 0,
+    7, 4, 1, -20, -6, -1, 0, -3, 3, -7, -29, -14, -6, 0, 1, 3,
+    -5, -6, -7, -7, 0, 1, 6, 2, -7, -2, -2, 0, -52, 0, -3, -13,
+    -10, -7, 0, -1, -2, -2, -5, -8, -2, 0, 0, 0, 3, 1, -3, 0,
+    0, 0, -1, -2, -5, 2, -1, -3, 0, -6, -2, -1, 2, 0, -1, 1,
+    3, -2, 3, 3, 1, 1, -1, 0, 3, 3, 3, 0, -1, -1, -8, -3,
+    -1, -1, -1, -1, 0, -2, -7, -18, -12, -1, 0, 0, 4, 2, 1, 7,
+    1, 0, 3, 1, -2, 1, -2, -20, -1, 4, -1, 1, 4, 0, -6, 6,
+    2, -1, 1, 9, -9, 0, 1, -2, -3, -7, 1, -3, -4, -1, -36, -11,
+    -20, -26, -22, -1, 0, -1, -14, -26, -9, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -2, -9, -4, 1, -6, -1, -1, -65, -17, -7, -2, 1,
+    -3, -2, -4, -13, -8, -4, -5, -10, -1, -4, -11, -4, -4, -10, -6, -2,
+    0, -2, 0, 2, -1, -8, 0, -91, -7, 0, -1, -2, -12, 0, 8, 8,
+    13, 7, 4, 0, 4, 6, 3, 3, 0, -9, 0, 2, 4, 0, 1, -7,
+    -7, 2, -3, 2, 3, 1, -10, -3, 3, -3, 2, -1, -3, -3, -1, 0,
+    -11, -2, -5, -12, -7, -5, 0, 0, -28, -83, -78, -27, -1, 0, 0, 3,
+    -1, -3, -6, -3, 0, 1, -2, -3, -6, -5, 1, 0, -3, -1, -5, -3,
+    -3, -1, -4, -3, 3, -1, 2, 3, 1, -3, -9, 2, 3, 4, 4, 1,
+    2, -8, 1, 0, 3, -1, -5, -2, 0, -2, -24, -14, -15, -6, 0, 0,
+    0, -4, 2, 2, 9, 7, -1, 0, -1, -3, -2, 1, 0, -5, -4, -3,
+    -4, -2, -2, -6, -2, -4, -6, 0, 5, 4, 0, -8, -3, -3, -2, 0,
+    -1, -2, -6, -2, -1, 1, 3, 1, -5, 0, -8, -50, -17, -5, -1, 0,
+    0, 0, -7, -6, -13, -1, 0, 1, 4, 0, 1, 0, -4, -7, 4, 1,
+    -12, -10, 0, -8, 2, 0, -8, -12, -12, -2, -1, -6, 0, -13, -10, -10,
+    -1, -2, -10, 0, -10, -7, 0, 2, 1, -3, 0, -2, 1, 2, 0, 4,
+    0, 0, -4, -27, -41, -37, -20, -3, 4, -6, 1, 1, 1, -2, -6, 7,
+    5, 5, 3, 4, 0, -4, 0, 1, -3, -7, 0, 4, -5, -8, 0, -1,
+    -4, 1, 2, -4, -3, -1, -2, 0, -2, -1, -21, 0, 1, 0, 1, 0,
+    1, -8, 0, -1, -1, -13, -127, -46, -1, 12, 5, 2, 3, -1, -3, -8,
+    20, 9, 7, 3, 3, 0, -4, 0, -3, -1, -9, 2, 1, -4, -1, -12,
+    -8, -6, -4, -2, -10, -1, -2, -13, -10, -1, 0, -11, 0, 0, -4, 8,
+    -1, 3, 1, 1, -4, -19, -22, -7, -1, 0, 2, 1, -2, 0, -5, -10,
+    -7, 2, 4, 4, 4, 2, -2, -5, -2, -1, -6, -1, 3, 1, -3, -12,
+    -6, -3, -6, -1, 1, -6, -10, -4, 1, 2, -1, -4, -12, -2, -2, 0,
+    2, -2, 1, -5, 0, 0, -1, -2, -1, 0, 0, 2, -7, -12, -11, -29,
+    -10, 0, 3, 1, 1, 5, -1, -4, -1, 1, -2, -1, 2, 4, -1, -1,
+    -6, -7, -1, -7, -7, -6, 0, -39, -6, -1, -4, -4, -6, 0, -3, -2,
+    -2, -2, 1, -5, 0, 0, 0, -5, -1, -3, -107, -5, -3, 0, 3, -1,
+    -3, -5, 0, 0, -2, -1, -5, -4, 1, -2, 0, -5, -2, 4, -3, -3,
+    -5, 0, 0, -4, -1, -2, -7, -15, 0, -8, -3, 4, -5, -12, -5, 3,
+    1, 2, 1, -1, -2, 0, 0, -4, -11, -7, -71, -26, 0, 10, 2, 6,
+    2, 0, 0, -13, 22, 7, 5, 1, 1, 0, -2, 6, -5, -5, -7, 4,
+    3, -4, -25, -6, -5, -5, 1, -4, -6, -9, -6, -7, 0, -2, 0, -17,
+    0, -5, 0, 2, 0, -1, 0, 0, 0, -5, -12, -15, -5, 0, -1, -8,
+    -6, -2, 0, -2, -34, -6, -5, -3, 0, 2, 5, -1, -1, 1, 0, -5,
+    -5, 0, -6, -6, -4, 0, 1, -2, -4, -10, -4, 4, -1, -8, -9, -8,
+    -3, 0, -2, -5, -7, -8, -2, 0, 1, -4, -2, -8, -42, -124, -22, 4,
+    2, 3, 2, 1, 2, -1, 4, 7, 7, 2, 1, 1, -2, -6, 5, 10,
+    -1, -4, 3, -4, -38, -8, -1, -1, -3, -3, -5, -7, -6, -14, -19, -8,
+    -8, -12, 0, -3, -7, -5, -4, -2, 0, 0, -4, -4, -1, -6, -10, -7,
+    5, -1, 3, 0, 0, 2, -2, 15, 6, 0, -1, -4, -1, -2, -1, -1,
+    1, -6, -3, 1, -3, -2, -5, -1, -13, -9, -2, -10, -2, -4, -20, -9,
+    -8, -7, -1, 0, 0, 0, 0, 1, 0, 0, 0, 0, -1, -3, -3, 0,
+    0, 0, -5, -8, -17, -10, -12, -6, 2, -6, -6, -3, -1, -1, 0, 11,
+    -6, -1, 0, 2, 1, -1, 0, -2, -4, 3, 5, 1, -5, -1, -8, -2,
+    2, 3, -3, -6, -1, 1, -5, -7, -3, -2, 0, 0, 0, -5, -21, -24,
+    -9, 0, 0, -10, -5, -3, -6, -6, -15, -4, -4, -2, -2, 1, 3, 1,
+    -7, -2, -1, -2, 0, 1, -5, 2, 0, -1, 2, 5, 2, -44, -4, 5,
+    2, 1, 0, -1, -7, -1, -1, -1, -3, -5, -5, 0, 0, -2, -15, -24,
+    -25, -16, -2, 3, -1, 2, -1, -2, -4, -5, 2, 1, 3, 2, 4, 2,
+    1, -1, 1, 3, -2, 5, 3, 0, -3, 1, 0, -1, 4, 4, 0, -6,
+    -3, -1, 2, -1, 0, -9, -4, 4, 3, 2, 1, 0, -7, -2, -16, -12,
+    -6, -2, -2, 0, 0, -2, -11, -31, -3, -4, -3, 6, 0, -5, 3, -3,
+    -1, 5, 4, 0, -2, 8, -1, -4, -1, 0, -6, -2, 1, -3, -2, -9,
+    -5, -1, 1, 3, 3, -5, -5, 1, -1, -6, -1, -1, 1, 0, 0, -28,
+    -81, -106, -25, -8, 0, 0, 3, -1, -19, -12, -5, -1, 1, -3, -1, 1,
+    1, 0, 0, -1, -1, -1, 0, 7, 1, 5, -1, -3, -2, 0, 1, 0,
+    -3, -8, -5, 1, 5, 1, 0, -2, 2, 1, 1, 3, -5, 4, 0, 0,
+    0, 0, -1, -1, -2, 0, -2, -3, 4, 7, 0, -83, -52, -3, -1, 6,
+    6, 6, -1, -2, 6, 6, 5, -4, -2, 2, -3, 2, 4, -1, 1, 4,
+    4, -8, -8, -4, -8, -4, -3, -5, -8, 4, 2, -1, -1, -2, -5, -4,
+    0, 0, 0, 0, 0, 0, 0, 2, -3, 0, 1, -29, -76, -10, 2, 0,
+    4, 8, 2, -2, -2, 0, -4, -2, 2, 3, 0, -3, -9, -3, -2, -7,
+    2, 1, -6, -42, -10, -6, -5, -4, -7, -23, -7, -1, -3, -5, -2, -3,
+    -9, 0, -2, -6, -3, 0, 0, 0, -1, -1, 3, 3, 1, -3, -27, -1,
+    3, 6, 4, 1, -2, 0, 0, -2, -4, -3, 2, 2, -3, -2, -1, 1,
+    -4, 0, 2, -4, -4, -9, -7, -3, -3, -5, -9, 0, -2, -1, 0, 1,
+    0, -12, 0, -9, -53, -66, -59, -14, -1, -3, -4, 2, 2, 2, -2, -17,
+    4, 1, 5, 5, 2, 4, -1, 3, 3, 1, -6, -3, 4, -4, 2, -5,
+    3, 3, 1, -3, -1, -4, 4, -5, -13, -12, -7, -14, 0, -2, -8, -10,
+    -2, -1, 0, -1, -4, -4, -2, 0, 0, 0, 2, -1, -6, -9, -18, -2,
+    0, 2, 1, -5, 3, -4, -20, 0, 1, -4, -8, 1, 3, -7, 0, -4,
+    -7, -3, -4, -3, -7, 0, -10, -4, 0, 2, -1, -7, 0, 1, 0, -2,
+    1, 0, -5, 0, 0, -5, -19, -19, -7, 0, 0, -1, -2, -3, -7, -16,
+    -11, 0, 3, 6, 0, 0, 0, 1, -1, -3, -3, -6, 3, 5, 2, -2,
+    -4, -1, -3, -4, -2, -6, -4, -44, -4, -1, 4, 1, -2, 0, -5, 2,
+    1, 1, 3, -2, 0, 0, -3, -30, -64, -67, -21, -1, 1, 0, 0, -1,
+    1, -2, -12, 0, 4, 4, -1, 2, 0, -5, -2, 0, -3, -3, 3, 1,
+    -3, -1, 3, 1, -2, -1, -1, -6, -3, 1, -1, 4, 1, -2, -14, -2,
+    0, 2, 2, 3, 1, -4, 0, 0, -6, -21, -29, -8, 0, 0, -23, -33,
+    -5, -6, -11, -14, -2, -6, 3, 3, 2, 3, -1, 10, 6, 10, -3, 0,
+    1, -9, 4, 8, 3, 1, 0, 0, -12, -2, 5, 2, 1, -3, -4, -10,
+    0, 2, 0, -2, 0, -5, -1, 0, -16, -21, -74, -59, -19, 0, -4, 1,
+    2, 0, 0, 0, -15, 2, 3, 4, 2, 4, 3, 1, -1, 0, 1, -1,
+    2, 1, -6, 3, 1, 1, 1, 4, 2, -7, 0, 0, 0, 0, -1, -6,
+    -17, 3, 3, 1, 1, 0, -1, 0, 0, -19, -50, -104, -86, -72, -3, -5,
+    -3, -3, -3, 2, 2, -22, 0, -1, -2, 1, 1, 7, -6, 1, 0, 1,
+    1, 1, 5, -9, 2, 1, 1, 2, 1, 3, -6, -1, 3, 3, 0, 1,
+    -1, 0, 5, 1, -1, -1, -2, -1, 0, 0, 0, 0, 0, 0, 0, 0,
+    -1, -11, -10, -15, -15, 0, 0, 0, 5, -3, 0, -1, -13, 0, 1, -1,
+    -6, -3, -1, -7, 0, 1, 2, -2, -5, 1, -9, 0, -1, -1, 2, 1,
+    -3, -9, 0, 0, 1, 0, -3, 0, -4, 0, 0, 0, 0, -1, -1, 0,
+    0, 0, -4, -7, -6, -2, -4, -2, 3, -5, -4, -3, -1, -7, 0, 2,
+    0, -4, -4, -3, -1, -1, -1, -3, -6, 0, 0, 1, -3, -1, -9, -1,
+    2, 4, 3, 0, -1, 5, 0, -1, -1, -1, 0, -1, -27, -29, -123, -78,
+    -13, 0, 0, 0, -1, -8, -9, -8, -1, -1, -6, -3, -11, -11, -8, 0,
+    -3, -5, -4, 2, 6, 1, 0, -5, -4, -1, 5, 10, -5, 0, 3, 2,
+    0, -1, 2, -4, 0, 1, -2, 1, -2, 6, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -5, 1, 4, -19, -36, -6, 16, 2, -1, 6, 0, -10,
+    -9, 28, -1, -4, -2, 4, -3, -7, -1, -7, -7, -6, 3, 1, 0, -2,
+    -5, -14, -14, -3, -2, -9, -2, -4, -8, -3, -2, -5, -14, 0, -10, -53,
+    -76, -57, -6, 0, -2, -3, -2, -4, -7, -16, -2, 1, -2, -2, -1, 0,
+    -3, -1, 3, 1, -2, 4, 6, 4, -1, 2, 0, 0, 0, 5, 2, 0,
+    -5, 3, 2, 1, 1, -4, 0, 0, -1, -3, 1, -4, 2, 0, 0, -3,
+    -13, -27, -34, -4, 0, 6, 3, 2, 2, -3, 1, -2, 1, 1, -4, -3,
+    -4, -2, -6, -11, -10, -14, -7, 4, 1, -2, -12, -8, -7, -3, -2, -7,
+    -6, -6, -4, -4, 1, 0, 0, -2, -2, 0, 1, 1, 1, 1, 0, 0,
+    0, -3, -4, -2, 0, 0, 1, -5, 0, -2, 0, -4, -26, 9, 0, 0,
+    3, 3, 1, -1, 1, -6, 0, -3, -4, -1, -2, -2, 2, 0, -1, 1,
+    -1, -3, -9, -1, -4, -9, -8, -4, -14, -2, -1, -7, -9, -3, -3, -1,
+    0, 0, -9, -9, -3, -4, -1, -1, -8, -4, 6, 3, -4, -2, -2, 8,
+    8, 6, 8, -1, -5, 0, 12, 6, 1, 5, 3, 1, 0, -3, 1, 2,
+    7, -4, -6, 0, 4, 9, 5, 7, -8, -3, 0, -5, 0, -10, -8, -4,
+    0, -1, -10, -17, 1, 1, 0, -5, -5, -4, -6, -2, 1, -1, -4, -12,
+    3, 0, 0, 0, 4, 2, -13, -3, -3, -4, 0, 4, 1, -38, -5, -6,
+    -1, 2, 1, 0, -16, -3, 0, 1, -1, 2, 0, 0, -8, -2, -4, 3,
+    -5, -10, -1, -33, -5, -5, -2, -2, 0, -9, -3, -6, 1, 1, -2, 0,
+    -13, -12, 0, -4, -9, -3, -3, 0, -2, 4, -4, -6, -1, 5, -4, -24,
+    -3, -9, -1, 0, -3, -2, -19, -2, -9, -11, -6, -17, 0, -1, -9, -11,
+    -26, -29, -1, 0, -12, -5, -9, -8, -8, 0, -11, -3, -3, -2, 5, 5,
+    -7, -6, 3, 4, 3, 5, 5, 1, 5, 4, 6, 8, -1, -1, -1, -22,
+    0, 2, -1, 2, 3, -1, -18, 3, 4, 5, 1, 3, -8, -4, 2, 0,
+    -1, 2, -1, -8, 0, 0, -8, -14, -14, -1, 0, -3, -19, -6, -6, 3,
+    3, 0, -3, 1, -1, -10, 3, 4, -2, 2, 7, 11, -9, -1, 0, -2,
+    -20, 4, 3, -9, 6, 8, -1, -5, -1, -6, -3, -11, -12, -3, -8, 3,
+    0, 1, 5, 4, -1, 0, -5, 1, -2, -4, 3, -1, -57, -2, 3, -1,
+    -2, -2, -5, 4, 4, 6, 1, -9, -7, 2, 2, -2, -6, -5, -11, 1,
+    -2, -2, -10, -7, -13, 3, 3, -9, -4, -3, 0, -1, -4, -3, -10, -3,
+    5, 0, -16, -9, -8, -1, 0, -9, -3, -2, -4, -1, 1, -29, -6, -3,
+    2, 3, 1, -4, -19, 5, 9, 4, 2, 0, -3, -17, 10, 8, 3, 0,
+    0, -6, -71, -7, -5, -2, 3, 4, -8, -44, 0, 3, -2, -6, -6, -14,
+    0, -3, -4, -7, -4, -26, -1, -1, 0, -12, -12, -9, -6, -10, -6, -5,
+    2, 0, 1, -3, -2, 0, 2, -2, 1, 6, 7, 2, -17, -7, 7, 1,
+    10, 11, -5, -5, 3, 5, -1, -2, 3, -6, -10, -1, -8, -2, 1, 2,
+    -15, -2, -16, -10, -9, 6, 0, 0, -8, 0, -1, -1, -2, -3, -8, -20,
+    -5, -1, 2, 1, -1, -2, -29, -3, -1, -8, -12, 3, -2, -52, -6, -12,
+    -10, -11, -9, -14, -127, -16, -29, -7, -5, -12, -31, -57, -22, -33, -9, -8,
+    -21, 0, 0, -9, -21, -4, -9, -6, 0, 0, 1, -2, -1, 1, 2, -9,
+    -20, 0, 3, 1, 0, -4, -4, -12, -4, 4, -5, -10, -7, -2, -1, -7,
+    -6, -10, -4, -4, -26, -10, -28, 3, -1, -13, -13, -30, -2, -18, -1, -6,
+    -9, -16, 1, 0, 0, -3, -2, -1, 0, 0, 0, -1, -2, -2, -3, -2,
+    0, 0, 7, 6, 3, -2, 1, 0, -3, 4, 1, -5, 3, -2, -6, -7,
+    1, 3, 2, 7, 1, -5, -1, 7, 11, -1, -2, -15, -8, -1, -4, -4,
+    -8, -5, -4, -6, -1, -10, 5, 5, 0, -2, 0, 0, -1, -14, -84, -45,
+    -44, -3, 0, 3, 3, 1, -3, -4, -3, -10, 1, 1, 0, 1, 3, -1,
+    0, -4, 3, 1, 9, 4, -10, -16, 8, 9, 6, -6, -6, 1, -13, 0,
+    0, -6, 0, 2, -6, -4, -20, -14, -3, -7, -7, 0, 0, -5, -19, -10,
+    -5, -9, -11, -2, 2, 0, 0, 2, 0, 0, -2, 1, 0, -2, -1, 3,
+    5, 4, 2, 0, -3, 4, 0, 3, -50, 2, -1, 0, -1, -3, -1, -19,
+    0, -1, -1, -1, 1, 5, -19, -4, -2, 1, 2, 3, 5, -7, -49, -65,
+    -6, -11, -16, 0, 4, -5, -3, -10, 3, -6, -6, -6, 0, 6, -2, -5,
+    -1, -3, -4, -2, -4, -7, -15, -16, -10, -4, 0, 5, 3, -3, -7, -2,
+    -5, 2, 2, -7, -6, -5, -3, 0, 3, -13, -7, -15, -1, 0, -1, -21,
+    -37, -12, -1, -11, 0, -9, -3, -5, -9, -4, -2, 0, 0, 0, -1, 1,
+    -5, -2, -2, -33, -4, -1, 0, -7, -13, -4, -20, -4, 3, -4, -3, -4,
+    -14, -4, -1, 1, -5, -7, -5, -6, -1, -1, -11, -16, -13, -10, 0, 0,
+    0, -2, -7, -15, -14, -3, -27, -9, -16, -5, -6, -6, -12, -11, -17, -20,
+    -6, -1, 0, -6, -2, -9, -12, -6, 8, 10, -3, -28, -14, -11, -5, 1,
+    -9, -13, -8, -11, -6, 3, -1, 1, -15, -8, -9, -2, 3, 0, 2, -14,
+    0, 0, -1, 0, 0, -1, -1, -5, 0, -6, 0, -3, 3, -6, -5, 3,
+    0, -4, 0, -5, -6, 1, 4, 0, -2, 5, 6, 0, -29, -1, -1, 1,
+    6, 0, -5, -4, 1, -3, 1, -2, -2, -14, -26, 1, 4, 6, 3, 3,
+    -7, 0, -5, -25, -36, -8, -2, 0, -22, -1, -8, 5, 2, 1, -4, -5,
+    1, -1, 0, 1, 3, -3, 3, 7, 6, 4, 2, 2, -3, -17, -4, -1,
+    0, 2, 2, -5, -1, 0, -1, 1, 1, -1, -9, -12, 5, 2, 3, 3,
+    4, -13, -1, -22, -47, -7, -4, -2, -8, -6, -4, -3, 1, 1, 2, -9,
+    2, 0, 2, 6, -3, 4, -6, -34, -2, 1, -1, -5, -3, -8, -15, 0,
+    0, 0, -12, -2, -60, -11, -3, -7, -5, -5, -3, -26, 1, -24, -3, -12,
+    3, -15, 0, 0, -18, -20, -10, 5, -1, -1, -8, -4, -7, -5, 5, 0,
+    1, -2, 5, 10, 0, -7, -3, -1, 1, 3, 5, -2, -3, -1, 0, -2,
+    0, 1, -6, -1, -3, -1, -1, 2, 1, 1, -11, -9, 1, -11, 7, -3,
+    -5, -10, -7, 0, 0, -21, -50, -4, -12, -2, 0, -11, -2, -7, -4, 0,
+    7, 0, -4, 2, 2, 1, 0, 4, 0, 4, 3, 6, 5, -3, -5, -2,
+    -18, 1, 4, -2, 1, 8, -8, 2, 3, 2, -3, -5, -3, -4, -2, 4,
+    2, -4, -6, -7, 0, 0, -13, -40, -15, -10, -12, -10, -2, -9, -9, -7,
+    -4, -4, 0, -11, -3, 1, 2, 2, 0, 6, -6, 1, 1, 7, -4, -3,
+    3, -14, -5, 4, 2, -3, 0, 7, -11, 2, 2, 4, 1, 1, -2, 0,
+    4, -6, -10, -8, -8, -13, 0, 0, -26, -106, -65, -8, -4, 1, -11, -1,
+    -7, -3, -2, -8, -2, -8, -2, -6, 0, 2, 1, -6, -18, -2, -3, -1,
+    -1, -1, -1, 1, 6, -4, -7, -6, 0, -2, -11, -11, -2, 3, 5, 0,
+    -1, -18, -9, -1, 3, 4, -2, 1, -47, -9, -6, -8, -1, -4, -2, 0,
+    0, 3, 3, -2, -6, -4, 4, -1, -1, 0, 1, -6, 4, 2, -1, -4,
+    3, 4, -3, -2, 1, 3, -3, 0, -3, -3, 0, 1, 0, -1, 0, 1,
+    -4, -11, -9, -4, 1, -2, 2, -3, 0, -47, -2, -4, -9, -8, 7, 0,
+    -1, -2, -2, -3, -3, -3, 0, 0, -3, -4, 6, 10, -1, 1, -4, -3,
+    3, -1, -7, -11, -6, 7, 7, -6, -5, 0, -12, -7, -1, -3, -2, 6,
+    1, -1, -8, -22, -12, -5, -10, -11, 1, 0, -1, -3, -4, 1, 0, 0,
+    -13, -3, -7, -5, 10, -1, 0, -1, 1, 5, -6, 0, -10, 0, -4, 1,
+    2, -9, -28, -14, -1, -2, -4, 4, -11, -4, -7, 1, -1, 4, 1, -7,
+    -12, -9, 0, -4, 1, -6, -4, -14, -5, 0, 0, -1, -2, -7, -3, -3,
+    0, 0, 10, 5, 9, 6, 3, 0, -1, 8, 8, 6, 6, 3, -5, 2,
+    5, 5, 4, 8, 1, 1, -3, 6, 7, 5, 7, -3, -14, -1, 3, 8,
+    7, 1, -8, -2, 0, -1, -10, -7, -4, -3, 1, -4, -10, -7, -1, -5,
+    -5, 1, -7, -1, 2, -2, -11, -13, 9, 2, -1, -4, -11, -8, -6, 0,
+    -16, -5, -12, -16, -8, -13, 0, 0, 2, 5, -12, -12, -10, -6, 1, 1,
+    -6, -17, -8, -4, 0, -11, -73, -52, -33, -6, 0, 1, 0, -1, 0, 0,
+    0, 0, -1, 0, -78, -8, -2, -5, -2, 1, -19, -24, -13, -3, -4, -14,
+    -14, -25, 5, -6, -14, -7, -7, -8, -1, 3, -8, -6, -8, -15, -18, -10,
+    0, 4, 2, -9, -12, -48, -3, -1, 3, 1, 1, 0, -4, 0, -35, -90,
+    -28, -33, -27, 0, -1, -1, -3, -5, -14, -13, 4, 3, -1, -7, -12, -12,
+    -2, 9, -14, -3, -6, -9, -7, -17, -5, -10, 3, 3, -9, -8, -8, 0,
+    -7, -1, -2, -15, -4, -4, 0, -2, -18, -14, -9, -22, -8, 0, 0, -14,
+    -9, -13, -4, 1, 0, -13, -4, 4, 3, 3, 7, 1, -2, 3, 8, 9,
+    5, -1, -6, 1, 6, 5, 9, 1, 4, -2, -57, 3, 0, 1, 2, 4,
+    -12, -11, 7, 6, 8, 3, -1, -13, -1, 7, -2, 5, -12, -10, 0, 1,
+    -1, -3, -14, -10, -7, -4, -7, -4, -3, 1, -2, 0, 0, -8, -1, -1,
+    -1, -4, 5, 0, 2, -1, -2, -5, 3, 2, -1, -5, -6, 0, -7, -2,
+    -2, -7, -18, 0, -2, -3, -2, -5, -8, -5, -7, -7, -4, 1, 2, -2,
+    0, 0, -4, -17, -13, -7, 0, 0, -15, -5, -4, -3, 0, -6, -1, 1,
+    7, 4, 2, -2, -3, 0, 8, 5, 3, -9, -8, -3, 0, 0, 6, -1,
+    -11, -2, 2, 0, -44, -9, -10, 0, -1, 1, 0, 0, -1, 3, -1, -2,
+    1, 0, -2, -28, -40, -43, -30, -4, -2, -8, -5, -1, 0, 0, -8, -7,
+    -4, -7, 2, 0, 1, -3, -7, -1, 2, 5, 3, 0, -6, -7, -2, 2,
+    1, -2, -1, 0, -10, -2, -3, -4, -2, 1, 4, 0, -1, 0, -3, 0,
+    3, 0, 0, -8, -74, -13, -20, -97, -3, -6, -7, 0, 2, 4, 1, 1,
+    -13, -10, -11, -5, -1, 1, -4, 0, -2, -4, -7, -11, -7, -8, -4, -8,
+    1, -6, -17, -2, 4, 0, -12, 4, 1, -2, -1, 7, 0, -1, -5, 2,
+    1, -2, 6, 0, -2, -13, -29, -19, -1, 0, -5, -8, -2, -3, -1, 1,
+    -23, 0, -2, -3, 1, 6, 4, 1, 3, 4, 7, 2, -1, 3, -4, 0,
+    5, 3, 4, -2, -2, -1, -9, -2, 1, 0, -1, 3, 3, -2, -9, 1,
+    0, 1, 1, 1, 0, -1, -2, -6, -2, 0, 0, -1, -14, -9, -24, -12,
+    -21, 0, -23, -11, -14, -1, 2, -6, -2, -2, 1, 7, 2, -2, -17, 0,
+    0, 1, 1, 3, 0, -4, 0, 0, -3, 4, 2, -1, 7, -1, -22, 2,
+    -4, -2, 0, 2, 0, 0, -5, -12, 2, 0, 0, -17, -10, -32, -12, 4,
+    3, 0, 1, -9, -7, -3, -5, -1, -1, -5, 5, -3, 3, -6, -14, -12,
+    -48, -4, -1, -3, 3, -11, -9, 2, -6, -1, -3, -3, 0, 1, -3, 1,
+    -3, 0, 3, 0, -1, 0, 0, -16, -32, -12, -10, -49, -1, -15, -12, -1,
+    3, 4, 2, -5, -11, -6, 0, 1, 0, 1, -1, -4, 6, 0, -4, -8,
+    -3, -9, -42, 0, 7, -9, -7, 0, -1, -26, -6, 2, 2, 0, 3, 2,
+    0, -8, 0, -1, -4, -2, 3, 0, 0, -4, -22, -41, -15, 0, 0, -4,
+    6, 2, 1, -4, -30, 1, 5, 2, 5, 0, -9, -8, 0, -2, -5, 2,
+    1, 0, -17, -1, -14, -1, 4, 2, -10, -33, -10, -2, -2, -2, -4, -12,
+    -8, 2, 2, -2, -7, -6, -2, 0, -1, -88, -1, -3, -4, -32, -37, -33,
+    -4, -3, 6, 2, -3, -3, -10, -5, -3, -1, -1, -7, -5, -12, -9, -7,
+    -4, -7, -1, -11, -14, -13, 3, -2, -14, -8, -5, -13, -4, 6, 4, -8,
+    0, 4, 0, -3, -1, -6, -4, -3, 0, 0, -19, 3, 1, -4, -5, -20,
+    -11, -4, 1, 3, 0, 0, -3, -11, -2, -2, -1, -3, -6, -18, -4, -5,
+    1, -1, -7, -2, -33, -8, -14, 2, 2, -7, -4, -10, -1, -10, -3, -11,
+    0, 0, -3, 0, 0, 0, -2, -1, -1, 0, 0, 0, 0, -4, -6, -1,
+    0, 0, -5, -7, -4, -5, -3, -8, -1, 6, 3, 0, -2, -2, -3, -8,
+    5, 1, -6, -4, 0, -5, -3, -5, -7, 1, -2, 1, -5, -1, -2, 1,
+    3, 5, 1, 3, -1, 1, -4, -2, -5, 1, 0, 0, 0, -4, -29, -46,
+    -17, -1, 0, -17, 6, 1, 2, -7, -18, 5, 4, 2, 3, 0, -4, -9,
+    1, 3, -1, 1, -2, -1, -3, 4, -1, -9, -3, 1, -1, -19, -13, -5,
+    -1, 1, 0, -2, -13, 0, 2, -1, -2, -1, -4, 0, 0, -2, -12, -10,
+    -16, -20, -2, -1, -7, -1, 1, 3, -3, -3, -1, 0, -2, 5, 1, -5,
+    -4, 1, 1, 1, 0, 1, -2, -2, 3, -1, 1, 3, 1, -1, -6, 2,
+    -1, 1, 0, -5, 2, 5, -7, 4, 1, 0, -2, 1, 0, -2, -16, -14,
+    -9, -4, -2, 0, -13, -8, -18, -30, -10, -6, -2, -1, 1, 0, -8, -3,
+    -2, -7, 0, 3, -4, -6, -2, 0, -2, -2, 0, -6, 1, 1, 0, -8,
+    -46, -5, -3, -1, 2, 3, -1, -5, 0, 3, 0, 2, 3, 0, 0, -27,
+    -86, -127, -72, -10, 0, -10, -11, -9, -18, -16, -12, 0, -4, -3, 0, -4,
+    -4, -8, -1, -1, 2, 0, -1, -4, -7, -2, 3, 2, -3, -4, 0, 2,
+    5, -36, 0, -3, 0, 2, 4, 5, -2, -1, 0, 1, 2, -1, 0, 0,
+    0, -1, -3, -1, -5, 0, -5, -115, -13, -4, 0, -9, -9, -8, -11, -9,
+    -8, -7, -3, -11, -6, -10, -2, 9, 0, -4, -9, -5, -4, 2, 4, -1,
+    -16, -24, -2, -7, -2, -2, -5, -4, 1, -3, 2, 1, -2, 1, 0, 3,
+    0, 0, 0, 0, 0, 0, 0, -1, -55, -11, 2, -2, -9, -29, -3, -3,
+    -1, 2, -1, -2, -7, 0, 2, 2, 1, -5, -2, -2, 0, 3, 5, 2,
+    -3, -4, -14, -3, -1, 4, -2, -6, -1, 2, -11, 2, -4, -6, 1, -2,
+    3, 0, -1, -5, -5, -2, 0, 0, -10, -8, -6, 3, 2, -3, -52, -5,
+    -8, -2, 0, 2, 1, -5, 1, 3, 3, 4, 1, -3, -6, 0, 2, 5,
+    1, -4, -4, -11, -2, -3, 1, -2, -3, 1, 5, -9, -2, 1, -3, 3,
+    2, 1, 0, -5, -54, -110, -104, -37, -2, -5, -1, 0, 3, 3, 1, -11,
+    -1, -1, -1, 1, -3, -6, -9, 0, -1, 1, -2, -1, -7, -46, -10, -10,
+    0, 2, 0, -6, -40, -14, -1, 1, 3, -2, -5, -5, 0, -4, -7, -5,
+    -3, -2, 0, 0, -3, -4, -3, -1, 0, 0, -13, -11, -26, -15, -11, -5,
+    0, -2, -2, 4, -1, -1, -11, 0, 1, 2, 3, 0, -6, -11, 0, -2,
+    3, -1, 0, 0, -1, 0, -52, -9, -2, -3, 2, 7, 0, -2, -1, -1,
+    2, 2, 3, 0, 0, -5, -20, -15, -14, -1, 0, -1, -8, -8, -13, -7,
+    -10, 0, -6, -1, -1, -1, 0, 4, -2, 3, 2, 6, 2, -1, -3, -1,
+    4, 5, 2, -1, -2, 4, -2, -12, -2, -1, -2, 0, 6, 0, -6, -1,
+    1, 3, 4, 1, 0, 0, -2, -33, -91, -84, -34, -1, 0, -9, -14, -4,
+    -3, -4, -10, -4, -4, -5, -1, 1, 2, 1, 7, 3, 0, 0, 1, 2,
+    -6, 0, 4, 1, -3, 2, 3, -5, -5, -18, -4, -3, -1, 3, 3, 0,
+    -4, 0, 3, 2, 4, -1, 0, 0, -7, -37, -60, -17, 0, 0, -14, -16,
+    -12, -10, -19, -15, -1, -1, -4, -1, -3, -7, -7, -6, -3, -7, 4, 2,
+    0, -21, -2, -9, -2, 2, 1, 1, -28, 0, 1, 3, -1, -1, -1, -6,
+    0, 4, 1, 0, 1, 0, 1, 0, -10, -51, -76, -74, -28, 0, -3, -2,
+    0, 4, 2, -1, -5, -2, -1, 1, 2, -3, -4, -6, 3, 0, 1, 3,
+    1, 3, -2, -4, 0, 0, -2, 0, 0, -8, 0, 0, -2, -3, -1, 2,
+    0, -3, 2, 1, 0, 3, 0, 0, 0, -20, -50, -30, -61, -81, -5, 0,
+    5, 0, 4, -4, -6, -16, -1, 1, 1, 1, -1, -1, -8, 1, -2, -4,
+    1, 0, 1, -15, -6, -4, -3, 0, 0, -1, -9, -7, 2, 0, -1, 0,
+    1, 0, -3, 0, -1, -2, -1, -3, 0, 0, 0, 0, 0, 0, 0, 0,
+    -6, -19, -93, -23, -23, 0, 0, -2, -4, -6, -4, -4, -32, 0, -1, 0,
+    -1, -3, -10, -35, 0, -5, -3, -1, -1, -1, -2, 0, -56, -5, -4, -2,
+    -1, 1, 0, -2, 1, -1, 3, 0, 3, 0, 0, 0, -1, -1, -2, 0,
+    0, 0, -7, -15, -6, -3, -1, -3, -1, 7, 6, 7, 4, -4, -5, 0,
+    8, 4, 0, -5, -7, -4, -3, -4, -1, -5, -6, -2, -2, -2, -22, -7,
+    -7, -1, -3, 0, 0, -4, 1, -1, 0, 1, 0, 0, -33, -44, -34, -73,
+    -15, 0, 1, -1, 0, -1, -16, -10, -2, 8, 3, 5, -3, -19, -14, 0,
+    4, 2, -3, -10, -4, 1, 0, -6, -8, -9, -6, -11, -3, -1, -8, 0,
+    -2, -4, -4, 2, 0, -1, -4, -5, 0, -3, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -16, -90, 0, -4, -19, -22, -12, -92, -1, 1, -4, -6,
+    -3, -24, 0, 6, 4, -11, -6, -1, -5, 3, 4, -1, -10, -9, -37, -7,
+    -3, 1, -2, -10, -2, 6, -3, -2, -1, -2, 2, -2, 6, 0, -11, -59,
+    -76, -77, -9, 0, -3, -4, -1, -7, -17, -9, -3, -2, -1, 1, -3, -6,
+    -12, -1, 0, 0, 2, -9, -6, -7, 0, 0, -3, -6, -1, -3, -5, 0,
+    -9, -2, 1, 1, -2, 0, 0, 0, 0, 0, 0, 1, -2, 0, 0, -3,
+    -21, -36, -34, -10, 0, -6, -6, -2, 4, 1, 2, -8, 5, 3, 4, 6,
+    3, 2, 1, 8, 7, 5, 0, -5, -1, -5, 3, 5, 6, -8, -1, 1,
+    -6, -23, -11, -4, -3, 1, 4, 2, 0, -9, 2, 1, 2, 0, 0, 0,
+    0, -2, -7, -6, -2, -1, -1, -6, 3, 2, -2, -3, -9, -5, -1, 1,
+    -1, 0, -2, -4, 2, 0, -3, 1, -1, -2, -1, -3, -4, 2, 2, -1,
+    -7, -16, -18, -2, 1, -5, -2, -9, 4, -3, -2, -2, -1, -3, 6, 0,
+};
+
+static const float mnist_snn_layer4_scales[10] = {
+    0.0361807309f, 0.0610032789f, 0.032602977f, 0.0302675162f,
+    0.0649199784f, 0.0210532006f, 0.0538405776f, 0.0548079163f,
+    0.0338224284f, 0.0497311763f,
+};
+
+// One entry per layer; pooling layers have none
+static const SNNQuantWeights mnist_snn_quantized[5] = {
+    { mnist_snn_layer0_weights, mnist_snn_layer0_scales },
+    { NULL, NULL },
+    { mnist_snn_layer2_weights, mnist_snn_layer2_scales },
+    { NULL, NULL },
+    { mnist_snn_layer4_weights, mnist_snn_layer4_scales },
+};
+
+#endif // MNIST_SNN_Q8_H
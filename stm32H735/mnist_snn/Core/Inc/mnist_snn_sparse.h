@@ -0,0 +1,2155 @@
+// Generated by snn_core/Tools/snn_sparse from the mnist_snn weights.
+// Regenerate with the snn_sparse_headers target after retraining the model.
+#ifndef MNIST_SNN_SPARSE_H
+#define MNIST_SNN_SPARSE_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "snn_sparse.h"
+
+// layer 4: 50% of the 1x4 blocks pruned, 1960 kept, 35324 bytes (dense 62720)
+static const float mnist_snn_layer4_values[7840] = {
+    -0.374739498f, -0.46760726f, -0.269629657f, -0.0103010358f,
+    -0.176067054f, -0.065235801f, -0.301641434f, 0.176749974f,
+    -0.409122348f, -0.313886881f, -0.0194316022f, -0.00344746513f,
+    0.1504962f, 0.246118173f, 0.123237155f, -0.210459262f,
+    -0.357744157f, -1.30768967f, -0.583469808f, -0.248994201f,
+    0.00791866612f, 0.000570009055f, -0.45892787f, -0.346828461f,
+    -0.239866436f, 0.00212425971f, 0.103090093f, -1.17487144f,
+    0.18443501f, -0.730953217f, 0.03729707f, -0.0128757711f,
+    -0.532721341f, 0.100992173f, -0.0664117336f, -0.12692897f,
+    -0.214784205f, -0.0933205187f, -0.369074374f, -0.636089087f,
+    -0.643485963f, -0.270842463f, 0.000858230283f, -1.10398448f,
+    -0.229877502f, -0.155969813f, -0.194621265f, 0.185782194f,
+    -0.294431597f, -0.107325666f, -0.329964608f, -0.0919078067f,
+    -0.456969082f, -0.0771062598f, -0.283182383f, -0.92170608f,
+    -0.20450145f, 0.247357816f, -0.212448344f, -0.421913087f,
+    -0.0194763634f, 0.0506025851f, -0.232300758f, -1.08027565f,
+    -0.565880179f, -0.0375950299f, 0.162022337f, -0.166711912f,
+    0.0773166493f, -0.250396371f, -0.606845796f, -0.717172921f,
+    -0.0248885266f, 0.0186661277f, -0.0550019555f, -0.607497633f,
+    -0.989449859f, -0.481651515f, -0.00654330524f, 0.0135282846f,
+    -0.24357067f, -0.232313067f, -0.188397065f, -0.206248537f,
+    0.0315616317f, -0.715752244f, -0.0404768363f, -0.107326984f,
+    -0.0423497483f, -0.39301306f, -0.248032168f, -0.122858368f,
+    -0.487984985f, -0.274902433f, 0.0632509813f, 0.211032048f,
+    -0.0595539324f, 0.0667988583f, -0.223801836f, -0.408776671f,
+    -0.0564222373f, 0.0427868143f, -0.254239172f, -0.490783125f,
+    -0.327182889f, -0.106623203f, -1.06829476f, -0.0217395928f,
+    -0.00857397821f, 0.00945600402f, -0.605233192f, -0.198368281f,
+    -1.29304576f, -0.678677857f, -0.295200765f, 0.106636934f,
+    0.253003418f, 0.189597115f, -0.202577159f, -0.918789089f,
+    -0.496030152f, -0.593797743f, -0.397712439f, -0.00618648622f,
+    -0.116395436f, -0.137501866f, -0.185966641f, -0.675256431f,
+    0.167496055f, 0.0680459663f, -0.267172933f, -0.457687378f,
+    0.175838873f, 0.0876248926f, -0.22886239f, -1.5518111f,
+    -0.172937676f, -0.0854428783f, -0.273428559f, -0.21512942f,
+    -0.199392676f, -0.0460368618f, -0.764680445f, -0.541355014f,
+    -0.170831263f, -0.61287123f, -0.0534777008f, 0.215447545f,
+    -0.535009444f, -0.0682095289f, -0.318358511f, -0.0724174455f,
+    0.00859266613f, -0.391776681f, -0.286820054f, -0.408833116f,
+    -0.0029328533f, 0.074396275f, -0.753916681f, -0.0873981342f,
+    0.125391021f, -0.0237906128f, -0.258697599f, -0.536890745f,
+    -0.033735171f, -0.217134058f, -0.327370316f, -1.01005077f,
+    -0.0099551715f, -0.351458669f, -0.476118892f, -1.83473265f,
+    -1.85567427f, -0.84268558f, -0.021998236f, -0.0106186215f,
+    -0.00746146403f, -0.486754209f, -0.108386248f, -0.345196158f,
+    -0.341525346f, -0.40481174f, 0.0532564372f, -0.128595442f,
+    -0.0411929861f, -0.0660393089f, -0.143425733f, -1.00062048f,
+    -0.219330713f, -0.020463489f, 0.00999111403f, -0.527540982f,
+    -0.293410003f, -0.10619954f, -0.499313861f, -0.178123683f,
+    0.213738561f, -0.553142488f, -0.1688997f, -0.221248806f,
+    -0.299254268f, -0.00360468728f, -2.95311284f, -0.236968815f,
+    0.0150275184f, -0.203841358f, -0.406134993f, -0.874687254f,
+    -0.0301156119f, -0.210198879f, -0.700457156f, -0.116670698f,
+    0.0601848625f, -0.0389312431f, -0.241391659f, -0.406544894f,
+    -0.45811072f, -0.344183475f, -0.321163774f, -0.669442534f,
+    -0.410867989f, -0.740501463f, -0.754918098f, -0.638936162f,
+    -1.43813801f, -0.859731376f, -0.328178227f, -0.0213434696f,
+    0.0875105187f, -0.75124377f, -0.298397154f, -1.89168632f,
+    -0.596272707f, -0.496366113f, -0.208424538f, -0.203556791f,
+    -0.262153506f, -1.11287165f, 0.00840304885f, -0.103865899f,
+    -0.312366366f, -0.353794068f, 0.0257334951f, -0.0635491684f,
+    -0.250358731f, -0.0029380566f, -0.298104554f, -0.286338776f,
+    -0.307980746f, -0.271147698f, -0.259546489f, -0.218445271f,
+    -0.405088484f, -0.3263686f, -0.116513953f, -0.211839139f,
+    -0.392881572f, -0.242679626f, -0.326715976f, -0.5518291f,
+    -1.63592911f, -0.547782838f, -0.188559413f, -0.011902757f,
+    0.0478622429f, -0.176569045f, -0.974368453f, -1.43008196f,
+    -0.0211415179f, 0.0133492406f, -0.519680202f, -0.212544739f,
+    -0.401069194f, -0.26191628f, -0.0355512053f, -0.0311153531f,
+    -0.451511443f, -0.339469045f, 0.0318397731f, -0.168686658f,
+    0.110298887f, 0.290842414f, -0.12396089f, -0.594311535f,
+    -0.0125201829f, -0.392062485f, -0.506618798f, -1.0032779f,
+    -2.27239251f, -0.108113311f, -0.000143653044f, -0.13235949f,
+    -0.338763297f, -0.433680892f, 0.119520098f, 0.0180143639f,
+    -0.363191038f, 0.102497511f, 0.202848598f, -0.0974450111f,
+    0.0802027062f, -0.0327252746f, -0.141803563f, -0.526372671f,
+    -0.746790946f, -0.342295259f, -0.468850732f, -0.0129854437f,
+    -0.447794646f, -0.420295596f, -0.252843589f, -0.0782770067f,
+    -0.111234248f, -0.171947196f, -0.426885575f, 0.0161546078f,
+    0.0604164898f, -0.349299014f, 0.245026529f, 0.205500007f,
+    -0.0284900572f, 0.17816177f, 0.190968215f, -0.32945472f,
+    0.0752603412f, 0.060547106f, -0.888601422f, 0.0118305553f,
+    -0.124656528f, -0.237273559f, -0.381606042f, -0.787324727f,
+    -0.713322222f, -0.524497747f, -0.48585102f, 0.00041754017f,
+    0.14023526f, -0.131336898f, 0.210207045f, 0.369842023f,
+    -0.0447597131f, 0.323848546f, 0.337190449f, -0.0217724461f,
+    0.239035368f, 0.0654168576f, -0.367422909f, -0.684224486f,
+    -0.414559662f, -0.114332378f, 0.00490708463f, -0.240921557f,
+    -0.783208013f, -2.21001363f, -0.936691701f, -0.263507068f,
+    -0.0696687773f, -0.00196664617f, -0.0208182521f, -0.763564825f,
+    -0.521843076f, -0.442224026f, -0.0441499166f, -0.358690798f,
+    0.0106429094f, -0.45828566f, -0.131392255f, -0.134094656f,
+    0.0650964975f, 0.130615234f, -0.338490039f, 0.242063224f,
+    0.192392722f, -0.376956403f, 0.0417431705f, 0.0962159783f,
+    -0.827727079f, -0.997991681f, -0.330452174f, 0.0115563283f,
+    0.0795832351f, -0.971852601f, -1.61614227f, -0.791845441f,
+    -0.830138087f, -0.495235294f, -0.0190274082f, 0.0132666267f,
+    -0.36549139f, -0.0563292056f, -0.7580446f, -0.678136706f,
+    -0.704714596f, -0.313728839f, -0.3450436f, -0.355233222f,
+    -0.56326443f, -0.497812599f, -0.257916361f, -0.22664611f,
+    -0.0609415956f, -0.0530709065f, -0.403310716f, -0.318312615f,
+    -0.359467298f, -0.155931443f, -0.556527674f, -0.248376563f,
+    -0.296658039f, -0.648963511f, -0.482564807f, -0.362443626f,
+    -0.187801108f, -0.383684635f, -0.133557454f, 0.0386431701f,
+    0.0710085109f, -0.498092026f, -0.0603238828f, 0.0981331766f,
+    -0.427618891f, -0.917543709f, -0.0613536127f, -0.208649561f,
+    -0.039803803f, -0.0656994954f, -0.111262873f, -0.967866421f,
+    -0.0688339695f, -0.329060495f, -0.200048655f, -0.118794754f,
+    -0.0401390679f, -0.480823845f, -2.01861334f, -0.169589102f,
+    -0.431907415f, -0.0550613254f, -0.0357693844f, -0.258421004f,
+    -0.121310554f, 0.0570955835f, -0.134233445f, -0.450779617f,
+    -0.566509008f, 0.0208367165f, -0.144429117f, -1.07573295f,
+    -0.550329506f, -0.158810899f, -0.00437588291f, 0.00688737631f,
+    -0.159403667f, -0.0355775803f, -0.180942461f, -0.753372073f,
+    -0.153985351f, -0.911322892f, 0.0167812463f, -0.47272107f,
+    -0.614258707f, -0.337652355f, -0.201994374f, -0.312789947f,
+    -0.153130829f, -0.341653466f, 0.0722035468f, -0.121892191f,
+    -0.200545982f, -0.131685853f, -0.0768436566f, -0.349875659f,
+    0.0721237063f, -0.282972664f, -0.221263304f, -0.102091536f,
+    -0.0898712352f, -0.0348207057f, -0.593077719f, -0.412172645f,
+    -0.195976898f, -0.382410049f, 0.0369919278f, -0.13586843f,
+    -2.42430496f, -0.195629537f, -0.373967409f, 0.00757926842f,
+    0.0703319758f, 0.0310865659f, 0.0454321355f, -1.29836082f,
+    0.00318498909f, -0.636816025f, -0.922839522f, -0.163068771f,
+    -0.831219494f, -0.140577331f, 0.00522798439f, -0.0368866399f,
+    -0.754729033f, -1.04412079f, -0.722059846f, -0.00264165504f,
+    -0.0283587426f, -0.0156668574f, -0.301750988f, -0.335017204f,
+    -0.349645168f, -0.255947143f, 0.0990334079f, 0.158683807f,
+    0.0369302183f, 0.448960513f, 0.446898162f, 0.0181991905f,
+    0.108651623f, 0.203828916f, -0.228441134f, -0.133625075f,
+    0.181979284f, -0.717807114f, -0.935254395f, -0.423529267f,
+    -0.635407984f, -0.465030164f, -0.331564039f, 0.000218549467f,
+    -0.00240725651f, -0.338571787f, -0.520974338f, -0.278230011f,
+    -0.0306192096f, 0.255664408f, 0.353404909f, -0.165698141f,
+    0.0589262769f, 0.144132078f, -0.244710311f, -0.610172093f,
+    -0.0117784934f, -0.433868885f, -0.598095655f, -0.429814577f,
+    -0.322458625f, -0.536066115f, -0.342819184f, -0.077118732f,
+    0.190198779f, 0.0841257945f, -0.252745181f, 0.19157815f,
+    0.132175609f, -0.471660882f, 0.195977747f, 0.304773778f,
+    -0.417932928f, -0.0582475476f, 0.140104488f, -0.122280724f,
+    0.0785640627f, -0.68347156f, -0.536848068f, -0.600308776f,
+    -0.470821977f, -0.194655448f, -0.00666185142f, -0.0331511386f,
+    -0.228337958f, -1.44689548f, -0.46933496f, -0.313111693f,
+    -0.0588419102f, 0.0223272666f, -0.550288141f, -0.504150331f,
+    -0.69129926f, -0.355776727f, -0.213818058f, -0.288170278f,
+    -0.0187863354f, -1.22749257f, -0.583001614f, -0.424638063f,
+    -0.327783614f, -0.375945747f, -0.0250938497f, -0.0218149591f,
+    -0.458965182f, -0.162578613f, -0.355627775f, -0.349018991f,
+    -0.438047886f, -0.305529416f, -0.414532989f, -0.20107241f,
+    -0.0774348751f, -0.687192261f, -0.0940164924f, -0.210785314f,
+    -0.0155190928f, -0.234439045f, -0.305590153f, -0.566852093f,
+    -0.585372865f, -0.33110553f, -0.0922390074f, -0.394513756f,
+    0.00136042119f, -0.568886161f, -0.13818115f, 0.0315351821f,
+    -0.234665632f, 0.237353966f, 0.249563485f, -0.262706667f,
+    0.00745396269f, 0.0150036328f, -0.256885916f, -0.726638854f,
+    -0.465251774f, -0.950757325f, -0.562957883f, -0.30878517f,
+    -0.254366308f, -0.246177614f, -0.304754496f, -0.168846175f,
+    0.0492449477f, -0.252390563f, -0.263455182f, 0.148018971f,
+    2.69592929f, 0.0143763833f, 0.195415288f, 0.111336753f,
+    0.114844911f, -0.249723479f, 0.487781167f, 0.33808127f,
+    0.0231525097f, -0.144921079f, 0.174332365f, -0.72368443f,
+    -1.22781432f, -0.152098894f, -0.0150263868f, -0.0348839089f,
+    0.0390773453f, 0.00779038528f, -0.252896219f, -1.2713393f,
+    0.124875411f, -0.00826899987f, 0.313877761f, -0.23586151f,
+    0.00370942592f, -0.0918400064f, -0.462643236f, -0.210789561f,
+    -0.281179577f, -0.186113551f, -0.129637837f, -0.0865601227f,
+    -0.405435473f, -0.112852998f, -0.0113288108f, -0.165106639f,
+    -0.481087118f, -0.340193301f, -0.392527461f, -0.58340776f,
+    -0.510116518f, -0.0179790147f, -0.265948504f, -0.102989681f,
+    -0.207054839f, 0.0292407405f, -0.256447434f, -0.510572016f,
+    -0.159895748f, -0.72438544f, -0.140214115f, -0.212095976f,
+    0.337022156f, -0.0899156556f, -0.123177938f, -0.146400496f,
+    -1.02763486f, -0.628856897f, -0.154047653f, -0.069423914f,
+    0.00430431031f, -0.182434738f, -3.24575377f, -4.59495306f,
+    -0.661493182f, -0.793197513f, -0.122953944f, -0.140919402f,
+    -0.151452914f, -1.29646266f, -0.348314375f, -0.889726937f,
+    -0.468835443f, -0.130690306f, -0.205401272f, -0.364023268f,
+    -0.237608016f, -0.550621092f, -0.545964479f, -0.241831571f,
+    -0.0737366602f, -0.344726533f, -0.510823786f, -0.336096287f,
+    -0.0454422049f, -0.281100482f, -0.997967422f, -0.409158289f,
+    -0.254784197f, -0.491008103f, -0.0902911872f, 0.0756037459f,
+    -0.856040716f, 0.0180029068f, -0.118140385f, -0.410139471f,
+    -0.339723557f, -0.764415383f, -0.153846636f, 0.0204083417f,
+    -0.172328934f, -0.517803848f, -0.123004399f, -0.173553661f,
+    0.21816577f, -0.520592272f, 0.269250095f, 0.0905120373f,
+    -0.202332035f, 0.178066656f, 0.24186869f, 0.12720789f,
+    0.0565817021f, 0.0314359739f, -0.750493169f, -0.469784975f,
+    -0.471666068f, -0.596675694f, -0.722654164f, -0.461694688f,
+    -0.455682337f, -0.116833158f, -0.136578321f, -0.198458999f,
+    0.221604869f, 0.293456435f, -0.107984036f, 0.103672527f,
+    0.0557197742f, -0.185667351f, -0.318032563f, -0.275696248f,
+    -0.0304675885f, -0.502268553f, 0.0085992869f, -0.355296254f,
+    -0.0303740818f, -0.636197448f, -0.478995681f, -0.140366018f,
+    -0.507069886f, -0.0752925724f, -0.109234646f, -0.145643145f,
+    -0.613915801f, -0.0395283587f, 0.00710439356f, -0.150285095f,
+    -1.01393008f, -0.0301197171f, -0.281615943f, 0.0183996111f,
+    -0.714087546f, -0.471460342f, -0.736211956f, 0.1061114f,
+    -0.029165484f, -0.00361495465f, -0.474956453f, -7.7474165f,
+    -0.978318214f, -0.626247704f, -0.271823406f, -0.0567309223f,
+    0.00785207935f, -2.46561241f, -0.390350878f, -0.862414479f,
+    -0.186587438f, -0.377477735f, -0.392995477f, 0.209667116f,
+    -0.0521282628f, -0.884245336f, -0.498388261f, 0.00234104809f,
+    -0.0102138044f, -1.16436398f, 0.045799844f, -0.126603499f,
+    -1.79831684f, -0.0649877191f, 0.156500533f, 0.0227709785f,
+    0.0818943083f, -0.113879159f, -0.0739081204f, -2.10035777f,
+    -0.704867363f, -0.179740086f, 0.0309565719f, -0.0102546569f,
+    -0.858363152f, -0.0937576145f, -0.282943279f, -0.415511638f,
+    -0.764085352f, -0.0220131017f, 0.0247730985f, -0.275664717f,
+    -0.593369901f, -0.425135761f, -0.490286082f, -0.59556967f,
+    -0.124398224f, -0.0521989726f, -2.43749619f, -0.034790162f,
+    -0.121436201f, -0.694206297f, -1.73827195f, -0.0247603208f,
+    -0.827065527f, -0.820778012f, -0.557487309f, -0.193664774f,
+    -3.64146757f, -1.00257683f, -0.050724335f, -0.523626804f,
+    0.0895166844f, -0.50792551f, 0.134155437f, -0.201608315f,
+    -0.365036279f, -0.00700112944f, -0.659284234f, -0.608368874f,
+    -0.176399022f, -4.43031025f, -0.312350661f, -0.0199861974f,
+    -0.219681293f, -0.35070622f, -0.487386793f, -0.929059088f,
+    -0.92134285f, -0.370037198f, -0.10203854f, -0.118997887f,
+    -1.02755892f, -0.348038197f, -1.15894067f, -0.0468297601f,
+    -0.200395703f, -0.122079551f, -0.468007386f, -0.188698918f,
+    -0.141854227f, -5.00734677e-05f, -0.594094336f, -0.527512789f,
+    -0.171074048f, -0.426116019f, -0.789093733f, -1.54150677f,
+    0.0103678405f, -0.607691944f, -0.8102054f, 0.0144955432f,
+    -0.358486533f, -1.6481154f, -2.18186736f, -0.00315941451f,
+    -0.38642031f, -0.349367231f, -0.199804947f, -0.116065793f,
+    -4.89468241f, -1.47145355f, -0.0234669875f, -2.08441639f,
+    -0.195001706f, -0.185631841f, -0.426992327f, -0.306785583f,
+    -0.509405375f, -0.364998013f, -0.000539702713f, -2.36181092f,
+    0.0214783326f, -0.346540064f, -0.274190098f, -0.268107086f,
+    -0.250098675f, -0.654617608f, -1.70964086f, -0.110232316f,
+    -0.246888161f, -0.292433143f, -0.866198301f, -4.56384945f,
+    -0.487384945f, -2.37247062f, -0.075103417f, 0.0975167453f,
+    -0.436522454f, -0.308380455f, -0.166980729f, -0.303957105f,
+    -0.0216993932f, -0.233186662f, -0.823100686f, 0.0176740978f,
+    -0.430475295f, -0.354842901f, -0.19098556f, 0.167569712f,
+    -0.171188474f, -0.0501530245f, -0.928766787f, -0.0891461521f,
+    -0.550131679f, -0.778682947f, -0.26234737f, -0.085877344f,
+    -1.0804472f, -0.604861796f, -1.09779239f, -0.415017605f,
+    -0.216499761f, -0.611050844f, -0.106281601f, -0.248538703f,
+    0.0121500334f, 0.308115304f, -0.0784253851f, -0.627389014f,
+    -0.396904945f, -0.125576839f, 0.0117534809f, -1.80806661f,
+    -1.42846763f, -0.117100075f, -1.34580874f, 0.0655602813f,
+    -0.180585355f, -0.095019564f, -0.155955791f, -0.987749815f,
+    -0.0545887798f, -1.33823574f, 0.220344722f, -0.0419257432f,
+    -0.664013326f, -2.79478073f, -0.222607374f, -0.218075514f,
+    -0.303130656f, -1.16415548f, -0.305155337f, 0.100545593f,
+    0.0122844446f, -0.338634461f, -0.0638915747f, -0.585353911f,
+    -0.214708522f, -0.0184638426f, -0.76328516f, -1.09888506f,
+    -0.161726221f, 0.0518655181f, 0.000562001602f, -0.918152094f,
+    -0.614695609f, -0.072314769f, -0.450061649f, -0.0475325957f,
+    -0.295155525f, -0.479400009f, -1.05378425f, -0.72440815f,
+    -2.65797615f, -0.293872029f, -0.0343748406f, -0.764383674f,
+    -1.0460391f, -0.922540009f, -0.797647893f, -0.756161511f,
+    -1.35475922f, 0.0674531087f, 0.181925446f, 0.0337250456f,
+    -0.0153900692f, 0.0779296085f, -1.10525906f, -0.756546378f,
+    -0.29488501f, -0.459496439f, -0.0443243831f, -0.13328965f,
+    -0.0560023189f, -2.3324945f, -0.219348863f, -0.395736903f,
+    -0.383626819f, -0.00550532062f, -0.810244203f, -0.0130496323f,
+    -0.48820138f, -0.113342181f, -0.219730839f, -0.810073972f,
+    -0.92017132f, -0.115406401f, 0.00952556636f, -0.303765386f,
+    -0.697332144f, -0.453086227f, -0.504790962f, -1.06890595f,
+    -0.554523766f, -0.0877931267f, -0.264184713f, -0.0601895638f,
+    -0.372162908f, -0.10253571f, 0.0801956505f, -0.619053781f,
+    -0.0137759279f, -0.570835829f, -1.18559182f, -0.696430564f,
+    -0.00098332495f, -0.869517803f, 0.0605092086f, -0.505462229f,
+    -0.790533423f, -0.236323044f, -0.339061052f, -0.121110171f,
+    -0.107015297f, -0.255217403f, -0.0106807034f, -1.90239716f,
+    -0.977161527f, -0.0258588977f, -0.0080231512f, -0.895884097f,
+    -0.0968234092f, -0.0615526214f, -4.04231405f, 0.0674306601f,
+    -0.0984088555f, -3.57731652f, -0.0239704754f, 0.0246204995f,
+    -0.118177548f, -0.561274052f, -0.588950396f, -0.18212007f,
+    -1.27128756f, -0.925883174f, -0.0436561033f, 0.174186572f,
+    -0.319188148f, -1.31817234f, -0.056105338f, -0.0180209968f,
+    0.0650331303f, 0.063411653f, -0.73334223f, -0.288225621f,
+    0.00925988518f, 0.0416003168f, -0.168231785f, -0.901989341f,
+    -0.882512212f, -0.0282883272f, -0.177541271f, 0.211504728f,
+    -0.193906128f, 0.293671846f, 0.389221877f, 0.277581215f,
+    0.0343474932f, -0.150616318f, -2.92207575f, -0.594110131f,
+    -0.358852506f, -1.04073477f, -0.170900866f, 0.314907432f,
+    -0.208764866f, -0.313275278f, 0.25924176f, -0.152945101f,
+    -0.106216468f, -0.726018727f, -0.544825613f, -0.173546955f,
+    0.00446900167f, 0.185090005f, -2.04746485f, 0.250122398f,
+    0.0866744667f, -2.23343229f, 0.0071096695f, -0.0368751623f,
+    -0.373514026f, -0.544766366f, -0.0224880222f, -0.545839846f,
+    -1.22779346f, -0.0430990085f, 0.475615948f, -1.12303317f,
+    -0.444277346f, -0.00586807309f, -2.57937217f, -0.190012872f,
+    -0.068691045f, 0.487081021f, -1.27811873f, 0.178276792f,
+    0.387346596f, -0.432370335f, -0.0783020034f, 0.0637558252f,
+    -0.565115154f, -0.330501348f, -0.531940937f, -0.555571496f,
+    -0.542616725f, -1.42727411f, -0.690534949f, -0.0616125464f,
+    -0.210238874f, -0.240556359f, -0.180167019f, -0.372645527f,
+    -0.488501787f, -1.03954232f, -0.0279817972f, -0.341921479f,
+    -0.0221691374f, -0.217475176f, -0.0914575681f, -0.644153416f,
+    -0.0708883479f, -1.18204284f, -0.219557852f, 0.288520366f,
+    -0.539424062f, -0.176140144f, -0.0815194249f, -0.171115831f,
+    -0.0918971822f, -0.33981818f, -0.672465086f, -0.803618789f,
+    -0.269437879f, -0.23129487f, -0.662920773f, -0.236048266f,
+    0.0693482533f, -0.436761647f, -0.566392601f, -0.100392044f,
+    -0.163877755f, -0.508351922f, -0.891481698f, 0.131789044f,
+    0.0354959331f, -0.158432961f, -0.155083045f, -0.79837358f,
+    -0.406120181f, -0.43693316f, -0.244367227f, -0.184463292f,
+    -0.0911335424f, -2.34720731f, -1.18349648f, -1.9350543f,
+    0.227605075f, -1.05781388f, -0.483579665f, -0.0819092691f,
+    -0.342547983f, -0.368734777f, -0.413539261f, -1.41052651f,
+    -0.0642636493f, -0.240400404f, -0.572715938f, -0.321710706f,
+    -1.37031162f, -0.761671007f, -0.0654570833f, -0.239202112f,
+    -0.122795351f, -0.124366976f, -0.13303493f, -1.59328282f,
+    -0.681639433f, 0.170043066f, 0.0820747837f, 0.170366809f,
+    0.329065323f, 0.137834787f, -0.228469849f, -0.437254161f,
+    -0.507183671f, -0.428589374f, -0.254352599f, -0.338596195f,
+    -0.151279002f, -0.0500128753f, -4.12961483f, 0.00811970886f,
+    -0.209234387f, -0.203797683f, -0.110396959f, -0.456933051f,
+    -0.344594777f, -3.7096045f, -0.183708817f, -0.0095993029f,
+    0.0658128783f, -0.309261113f, -1.5627197f, -0.0649102554f,
+    -0.927203774f, 0.308993489f, -0.325482428f, -0.908304811f,
+    -5.00232267f, -0.4063963f, -0.375442713f, 0.00994532276f,
+    -1.51863599f, -0.215695068f, 0.0689846873f, 0.123350568f,
+    0.0235065594f, -0.241738364f, -1.03380513f, -0.616696537f,
+    -0.00941824634f, -0.392796308f, -0.741895437f, 0.153834879f,
+    -0.287733376f, -0.738385022f, -0.143382907f, 0.0015452028f,
+    -1.02224839f, -1.56315637f, 0.111724772f, 0.227140129f,
+    -0.682416975f, -0.314273685f, -0.0214746203f, -1.58693385f,
+    -0.460163236f, -0.106831469f, 0.361078769f, -0.991011918f,
+    -0.349063993f, 0.304760337f, 0.27900213f, 0.0695770606f,
+    0.0117911668f, 0.0671281144f, -0.280393183f, -0.791237175f,
+    -0.0369550884f, -0.294167608f, -3.68433976f, -0.180090055f,
+    0.263447553f, -0.115797982f, -1.33503509f, -0.0127280541f,
+    -0.883041859f, -0.278071821f, -0.13131316f, 0.364770502f,
+    -0.0419917144f, 0.0713302717f, 0.170939788f, -1.60984707f,
+    -0.283622324f, -0.15271236f, -0.210667521f, -0.285311133f,
+    -0.0501235276f, -0.256984591f, -0.00319899339f, -1.76230085f,
+    -0.58126384f, 0.253578365f, 0.0951228365f, -0.120771341f,
+    -1.49387658f, -0.0724038407f, -1.28939652f, -0.239186749f,
+    0.2332609f, 0.0251455717f, -1.29883873f, 0.131194308f,
+    -2.21297216f, 0.294809788f, 0.22639434f, -0.00727381604f,
+    -1.09756184f, -0.420896083f, 0.013235026f, -0.164001137f,
+    0.546446264f, 0.189435035f, -0.419342548f, -0.816879928f,
+    -0.69432205f, -0.0173131637f, 0.408951074f, 0.333951682f,
+    -0.137076497f, -0.373346806f, -0.389435768f, 0.115900829f,
+    -0.568655968f, -0.40487802f, -0.205779836f, -0.483664334f,
+    -0.305715442f, -0.0784806237f, -0.63433969f, -0.0654160827f,
+    -0.389210522f, -1.2478286f, 0.00242397492f, -0.10764531f,
+    0.196971178f, 0.0533312187f, 0.101186782f, -0.56526345f,
+    -0.639905334f, -0.115096368f, 0.124510773f, 0.264707088f,
+    -0.0340203531f, -0.0392246097f, -0.73330766f, -2.88509655f,
+    -0.0124344919f, -0.374721199f, -0.395624578f, -0.288028628f,
+    -0.482108712f, -0.172429681f, -0.226660252f, -0.261593521f,
+    -0.165311456f, -0.797455847f, -0.18714194f, 0.132825077f,
+    0.263517559f, -0.114238091f, -2.30081248f, -0.281045139f,
+    -2.00319767f, 0.197290584f, -0.0262320191f, 0.184905261f,
+    -0.260394931f, -0.401707917f, -0.0741681978f, -0.240572095f,
+    -0.496460199f, -0.0767091289f, -1.17201221f, -0.0483472534f,
+    -0.62589097f, 0.132196397f, -0.226336107f, -2.49100137f,
+    -0.119908035f, -0.014851002f, -0.5464921f, -0.343208373f,
+    0.119054541f, 0.0881078243f, -0.425995857f, -0.279814124f,
+    -0.0230649691f, -1.00275993f, -0.154997289f, -0.0716250762f,
+    0.352678537f, -1.77104795f, 0.0476581268f, 0.00659583136f,
+    -0.446576476f, -0.572422922f, -0.259712994f, 0.0224299636f,
+    -0.00972367544f, -0.705791831f, -0.758989334f, -0.544381201f,
+    -0.887055635f, -1.13482141f, -0.363024205f, -0.310598046f,
+    0.172011003f, -0.0442741401f, -0.0277817901f, -2.20659566f,
+    -0.744067132f, -0.351166755f, -0.427843451f, -1.75330544f,
+    -0.0408321843f, 0.34030658f, 0.397440016f, 0.129836649f,
+    0.0133659095f, -0.305821925f, -0.821455598f, -0.380511969f,
+    -1.01948631f, -0.307842225f, -0.16600354f, -0.186695471f,
+    -1.86302388f, -0.283395588f, 0.0127188824f, -2.38136625f,
+    0.0171475299f, -0.173282623f, -1.67132998f, -1.30443275f,
+    -0.690099657f, -0.25423786f, -0.25298211f, -0.229358107f,
+    -0.617694497f, -0.352220118f, -0.0486213155f, -2.72656512f,
+    -0.203265697f, -0.552674472f, -0.732006073f, -0.345002204f,
+    -0.183073148f, -0.0628632233f, -0.404653311f, -0.418737203f,
+    -0.59534514f, -0.350284278f, 0.236680821f, -0.595130444f,
+    -0.0227886736f, -0.839436829f, -0.719963193f, -0.651697099f,
+    -0.235736683f, -1.32578576f, -0.787798464f, -0.0794275552f,
+    0.101304136f, -0.859537363f, -0.0355440155f, 0.0383087248f,
+    -0.272383183f, -0.0208340362f, -0.0657957941f, -0.551133335f,
+    0.00270105642f, -1.19434381f, -0.0504756421f, 0.304087192f,
+    -5.94885015f, -0.0644317567f, 0.277490377f, 0.38392058f,
+    -0.441856861f, 0.00658786483f, -0.595727742f, -0.302028656f,
+    0.214103952f, 0.440330833f, -0.293102413f, -2.5799334f,
+    -0.0207647197f, -1.2036798f, 0.230680078f, 0.085066244f,
+    0.261125326f, -3.89915371f, -0.167613223f, -0.0235438254f,
+    -0.596309185f, 0.257599354f, 0.182345584f, 0.033974994f,
+    -1.82817709f, -0.168820605f, 0.0154417567f, 0.0110820429f,
+    -0.223703131f, -0.331188083f, -0.144499153f, -0.530207694f,
+    -0.451321959f, -0.0876405537f, -0.53443867f, -0.126490995f,
+    -3.94526768f, -0.925227702f, -0.289810896f, -0.366701186f,
+    -1.41581118f, -0.0815617964f, -0.585428894f, -0.709071338f,
+    -0.475227952f, -0.0419867113f, 0.303429842f, -0.833946049f,
+    -0.100422047f, -0.542520881f, -0.692206144f, -0.468389988f,
+    -0.508805811f, -0.271756828f, 0.0273440797f, -0.486169219f,
+    -0.0245418642f, -0.6620574f, -0.100673325f, 0.17640394f,
+    -0.00379453902f, -1.12598848f, -0.0261689816f, -0.356343359f,
+    -0.45307526f, -0.26072076f, -0.0587273501f, -0.0897071511f,
+    -0.399319261f, -0.11758393f, -0.248996809f, -0.578120112f,
+    0.289817035f, 0.53223139f, 0.100943096f, -0.0389180891f,
+    0.0594308935f, -0.0336510502f, 0.138567537f, 0.389962018f,
+    -0.195847034f, -0.330905944f, -0.365131229f, -0.161695734f,
+    -0.106422901f, -0.00260909367f, -0.359363109f, -0.161115915f,
+    -0.293475449f, -0.326590449f, -0.168441549f, 0.14622812f,
+    -0.177645087f, -0.448836356f, -0.01149981f, -0.238337561f,
+    -0.266832352f, -0.453894585f, -0.278444231f, -0.0258492455f,
+    -0.495467484f, -0.029488476f, 0.131227553f, -0.0356977805f,
+    0.209966958f, 0.0219593532f, -0.329520196f, -0.0274889302f,
+    0.337150842f, -0.0241901334f, 0.253909349f, -0.122732252f,
+    -0.0450999327f, 0.108940311f, -0.470759183f, -0.349265069f,
+    -0.0242299065f, -0.0711608827f, -0.452624887f, -0.27976805f,
+    0.143352047f, 0.375224769f, -0.0461273976f, 0.0123116616f,
+    -0.0171837099f, -0.00245703268f, 0.28224051f, -0.503755927f,
+    0.126272544f, -0.662345648f, -0.0610036924f, 0.00618420774f,
+    -0.375722229f, -0.536643922f, -0.049902685f, -0.0393896513f,
+    -0.30572769f, 0.154832423f, 0.115404032f, 0.206160933f,
+    -0.00488348911f, -0.165505245f, -0.525206208f, -0.0237925388f,
+    -0.0818348229f, -0.0972397551f, -0.407444298f, -0.15468806f,
+    -0.285862058f, 0.0433893688f, 0.077846542f, 0.236380026f,
+    -0.097320579f, -0.0870000198f, 0.193319663f, 0.213740245f,
+    0.22346513f, 0.363824844f, 0.15736711f, -0.176049948f,
+    -0.227888152f, -0.101171151f, 0.0955033153f, 0.153742254f,
+    -0.11233139f, -0.191165075f, -0.381185114f, 0.163976297f,
+    -0.0661315843f, -0.0393971466f, 0.0871691778f, -0.419021577f,
+    -0.127337113f, -0.065306291f, -0.0703535154f, -0.568116426f,
+    -0.325126976f, -0.213507369f, -0.32593596f, 0.180899292f,
+    -0.0241303034f, 0.119115584f, -0.108881406f, -0.385511488f,
+    -0.207928598f, -0.139853492f, -0.61150521f, -0.195441023f,
+    -0.552212894f, -0.267699778f, -0.0845213607f, 0.00173890567f,
+    0.00991716329f, -0.00112615072f, -0.526427269f, 0.15268366f,
+    0.0698647127f, -0.00267099845f, -0.265752703f, -0.261020929f,
+    -0.174794406f, 0.0660231635f, 0.248276919f, 0.204384506f,
+    0.0235387627f, -0.419095933f, -0.123388611f, -0.144467875f,
+    0.107142724f, 0.487914473f, 0.258009702f, 0.177554265f,
+    -0.00191156217f, -0.34653455f, -0.375583261f, 0.336210012f,
+    0.342760175f, -0.742510557f, -0.041946996f, 0.0150534213f,
+    0.111380979f, -0.0645080507f, -0.109217465f, -0.342132449f,
+    -0.292859137f, -0.108545505f, -0.208132297f, -0.158195436f,
+    -1.77950251f, -0.192588165f, 0.0997461155f, -0.0552675463f,
+    -0.202535525f, -0.323739767f, -0.31981647f, -0.552256644f,
+    0.284578741f, 0.191232964f, 0.143007204f, -0.0875820741f,
+    0.0621846281f, 0.210807532f, 0.062072061f, 0.339044124f,
+    0.631421626f, -0.0682043806f, -3.0374105f, -1.54327214f,
+    -0.245173052f, -0.136997685f, -0.197374001f, 0.0197740067f,
+    -0.0544565544f, -0.251604676f, -0.94551748f, -0.0773348957f,
+    -0.0287402179f, -0.705518067f, -0.387257755f, 0.211058751f,
+    0.23794131f, 0.180690676f, -0.340372086f, -0.121202409f,
+    -0.083855547f, -0.132828251f, 0.491192222f, 0.52436918f,
+    0.417006046f, 0.0852880329f, 0.189241722f, 0.445504606f,
+    -0.241850778f, -0.255743295f, -0.00183344528f, -0.119586237f,
+    0.229653254f, 0.588571787f, 0.326942563f, -1.84597921f,
+    -0.812753916f, -0.712608159f, -0.301575691f, 0.529715776f,
+    0.379948318f, 0.536082923f, 0.0119563323f, -0.202660009f,
+    -0.512648046f, -0.381518573f, 0.220636025f, 0.154282138f,
+    0.0170981493f, 0.104205139f, -0.0125690475f, -0.703919291f,
+    -0.549590409f, -0.173719317f, 0.0331428908f, -0.0748386234f,
+    -0.161270291f, -0.145467281f, -3.22840738f, -0.460599065f,
+    0.13879995f, 0.266548008f, 0.060372673f, -0.481337547f,
+    -0.285978854f, -0.0129948268f, -0.194531575f, 0.105852552f,
+    0.204389974f, 0.0209112931f, -0.176987633f, -0.213298947f,
+    0.0387623683f, -0.783973277f, -0.11218065f, -0.204632193f,
+    -0.220543012f, 0.233701304f, 0.406720877f, 0.951199472f,
+    -0.106374763f, -0.884823918f, -0.0929679424f, 0.00422398606f,
+    0.334486604f, 0.289623171f, 0.493387789f, -0.0206604637f,
+    -0.153689653f, -0.378182501f, -0.169574425f, -0.288583964f,
+    -0.261271894f, -0.104275256f, -0.139867693f, -0.234453991f,
+    -0.0745642036f, -0.44127503f, -0.135699913f, -0.131230548f,
+    -0.0476533994f, -0.230130196f, -0.200125799f, -0.146821469f,
+    -0.626641273f, -0.108963355f, -0.042248439f, 0.102868468f,
+    -0.177576244f, -0.165754735f, -0.0619233027f, -0.313339561f,
+    -0.0403260849f, -0.319360346f, 0.0412168317f, -0.213908076f,
+    0.161837444f, 0.372237176f, 0.133503735f, 0.155877843f,
+    -0.11603944f, 0.14237316f, 0.191682518f, 0.160734847f,
+    0.073943831f, -0.122405909f, -0.457174212f, -0.690133214f,
+    -0.568235159f, -0.594896615f, -0.303261042f, 0.0157357212f,
+    -0.126809746f, -0.347751707f, 0.27203843f, -0.0483358018f,
+    0.0616562031f, 0.174993142f, 0.333381563f, -0.192276597f,
+    0.169486985f, 0.193997845f, 0.0935498029f, 0.144364536f,
+    0.315327704f, 0.209127471f, -0.0926166251f, 0.0250693113f,
+    0.16743879f, -0.256095231f, -0.296444714f, 0.0412480645f,
+    0.214731097f, -0.531008184f, 0.0257812385f, 0.0033169724f,
+    -0.301747829f, -0.287271529f, -0.498223156f, -0.18308033f,
+    -0.354318023f, -0.13469547f, 0.0288495012f, -0.157144055f,
+    -0.219893917f, -0.336505622f, 0.231320664f, 0.0283510033f,
+    -0.236217961f, -0.327837944f, -0.481368929f, -0.455263138f,
+    -0.24853538f, 0.137459949f, -0.225879699f, -0.364003181f,
+    -0.058959268f, 0.144004345f, -0.249746233f, -0.227033019f,
+    -0.601591408f, -0.937719166f, -0.487883955f, -0.938645661f,
+    -0.263342857f, -0.221831888f, -0.185429558f, -0.0618125685f,
+    -0.272532284f, -0.346950591f, -0.263366133f, 0.0189923011f,
+    -0.333934426f, -0.127818644f, 0.072108984f, -0.0760797188f,
+    0.0201065727f, -0.761366487f, -0.964281559f, -1.06847274f,
+    -0.8546803f, -0.0851028413f, 0.0194769111f, -0.00121661695f,
+    -0.0180389266f, 0.427408755f, -0.157724082f, -0.159133285f,
+    -0.405377954f, -0.150012821f, -0.0716876239f, -0.0722267702f,
+    0.0895440206f, -0.035201814f, -0.201836467f, -0.44031316f,
+    -1.42769253f, -0.0630414337f, 0.194444343f, 0.270644754f,
+    0.14998664f, -0.113671847f, -0.397943944f, -1.53276384f,
+    0.0503642596f, 0.279623687f, 0.0658782944f, -0.296370298f,
+    -0.196125582f, 0.124857195f, 0.325383365f, 0.196120262f,
+    0.23055248f, 0.276704639f, 0.129094452f, 0.00648383517f,
+    0.337500244f, -0.641832888f, -0.368001252f, -0.0706394464f,
+    -0.0724925026f, -1.68963599f, -0.152764231f, -0.0661557093f,
+    -1.90089607f, -0.400979131f, -0.0984141231f, 0.016909318f,
+    0.08010865f, 0.371833414f, 0.159796193f, 0.0187186394f,
+    0.0669531822f, 0.0863531977f, 0.193844765f, 0.356833071f,
+    0.332726866f, 0.218147576f, -0.2909742f, 0.080663003f,
+    0.138177142f, 0.0436908975f, -1.34070003f, 0.0282249656f,
+    -0.0734632537f, -0.621840954f, -0.205608115f, -0.117088929f,
+    0.291364998f, 0.324138612f, 0.0614049546f, -0.44555825f,
+    0.00420678454f, -0.0393720232f, -0.0291120056f, -4.14057827f,
+    -0.142560869f, -0.142673835f, -0.363709629f, -0.11668279f,
+    0.548551321f, 0.174032435f, 0.00101789972f, -0.195917696f,
+    -0.0300317556f, 0.0745950043f, 0.188224405f, 0.478154689f,
+    0.0195516422f, -0.621824026f, -0.935127616f, 0.00175519194f,
+    -0.135213807f, 0.295542628f, 0.374168128f, 0.0194694847f,
+    -0.000877277635f, -0.0572433993f, -0.271001667f, -0.352592766f,
+    0.0546217859f, 0.212522358f, -0.305738866f, 0.0238500535f,
+    -0.370730311f, -0.596011221f, -0.622689664f, -0.08902812f,
+    -0.148708194f, -0.454030961f, 0.00582333095f, -0.0666591302f,
+    0.0770534202f, -0.000463300617f, -0.337100357f, -0.279917479f,
+    0.00609304383f, -0.117521875f, -0.421752542f, -0.260721356f,
+    -0.488593519f, -0.578018367f, -0.0740257129f, 0.0103603154f,
+    -0.0766281486f, -0.148768574f, -0.534218371f, -0.271071345f,
+    -0.374528944f, -0.343798906f, 0.331445307f, 0.0674129799f,
+    -0.0229477976f, -0.0220196061f, -0.395152628f, 0.15124312f,
+    -0.251733333f, -0.184423029f, -0.254249871f, 0.160259306f,
+    -0.606938303f, -0.298145324f, -0.0271477457f, 0.0885831863f,
+    0.108861618f, -0.0690527558f, -0.341240317f, -0.524681747f,
+    -0.65389967f, -0.123524286f, -0.0124123404f, 0.172396049f,
+    0.026467612f, -0.0835762396f, -0.138265148f, -0.396838039f,
+    -0.373731703f, -0.688105404f, -0.685997963f, -0.133543223f,
+    -1.00179219f, -0.82234931f, -0.577724576f, -0.923112929f,
+    -0.288724959f, -0.161323011f, -0.272878736f, -0.095055379f,
+    -0.0463095494f, 0.017461637f, -0.425698489f, -0.237647295f,
+    -0.385521144f, -0.418975323f, -0.14889577f, 0.106026858f,
+    -0.107753538f, -0.267769903f, -0.277669221f, -0.150013477f,
+    -0.0152767515f, -0.627374947f, -0.607369781f, -1.01592278f,
+    -0.49870953f, -0.363228232f, -0.0177935362f, -0.0236661695f,
+    0.157919705f, 0.198305264f, 0.117213376f, 0.127846852f,
+    0.247673184f, 0.355498582f, 0.18390356f, 0.119057983f,
+    0.0844461471f, -0.403337121f, -0.287247807f, -0.0708939731f,
+    -0.0106068021f, -0.0117051927f, -0.179779023f, -0.399678499f,
+    -0.341219485f, -0.312652797f, -0.27234897f, -0.0845591947f,
+    0.133837044f, 0.17593497f, 0.108634159f, 0.349261791f,
+    0.165582389f, 0.220553324f, 0.274902701f, 0.0788537711f,
+    -0.116738953f, -0.109357797f, 0.302978575f, 0.27448231f,
+    0.138630405f, 0.0225903559f, -0.208948836f, -0.224305049f,
+    -0.462325931f, 0.0167995524f, -0.349724621f, -0.77632761f,
+    -0.934881866f, -0.884848833f, -0.370893836f, -0.355150372f,
+    -0.274154752f, -0.160826042f, -0.0652986914f, 0.121971816f,
+    -0.0827857628f, -0.0367248841f, -0.0235776659f, -0.434500635f,
+    -0.361261308f, -0.630674481f, 0.00424394244f, 0.269170016f,
+    -0.308272243f, 0.0230641756f, -0.86491257f, -0.32493788f,
+    -0.402425587f, 0.138884977f, 0.0340906717f, -0.804861307f,
+    -0.160589084f, -0.482325912f, -0.0742975399f, 0.0201528016f,
+    -0.157735497f, -0.218535706f, -0.124283768f, -0.193883568f,
+    -0.259645611f, -0.0217286255f, -0.604582369f, -0.162159294f,
+    -0.16038394f, -0.236959398f, -0.596127331f, -0.129763633f,
+    0.135918692f, -0.0763644055f, -0.0458065346f, -0.475912392f,
+    0.343593776f, 0.0455485135f, 0.0938643217f, 0.105192617f,
+    0.0750460327f, -0.0732451081f, 0.325906605f, 0.198628888f,
+    0.188776672f, 0.211161211f, -0.247709557f, 0.101807825f,
+    -0.00304036634f, -0.239857078f, -0.321767539f, -0.59745574f,
+    -0.140670046f, -0.127876192f, -0.20254159f, -0.388607681f,
+    -0.0415094867f, -0.184411958f, -0.785629809f, -0.378014535f,
+    0.177936301f, 0.185121983f, 0.103939712f, -0.384876311f,
+    -0.308018476f, -0.267548233f, -0.257057279f, -0.289334416f,
+    0.00808755308f, -0.295388788f, -3.15857387f, -3.78317642f,
+    -2.16012764f, -0.131413162f, -0.012796443f, -0.00234438526f,
+    -0.353325993f, -1.34742355f, -0.525788784f, -0.225504324f,
+    -0.299335122f, -0.337509453f, -0.1796249f, -0.603880584f,
+    -2.74555779f, -0.531161308f, -0.0165957753f, -0.270165116f,
+    -0.0616660938f, -0.347477883f, 0.122798823f, 0.131617069f,
+    0.0411652811f, 0.311399996f, 0.101551421f, -0.178750813f,
+    0.314528227f, 0.342294216f, -0.126743466f, 0.0190182999f,
+    -0.0297414232f, 0.0118797189f, -0.32424891f, -0.54623425f,
+    -0.754486501f, -0.412025332f, -0.800723732f, 0.0146728326f,
+    -0.57951206f, -0.506544948f, -0.128131434f, -0.00896715093f,
+    0.123811737f, -0.148137137f, -0.116580434f, -0.521189332f,
+    -0.0118776979f, 0.0350698456f, -0.354633451f, -0.23728472f,
+    -0.479267418f, -0.829487681f, -0.651193738f, -0.450308174f,
+    0.351253361f, 0.105454884f, -0.00181514991f, -0.205276027f,
+    -0.0943530053f, -0.376121253f, -0.104941726f, -0.0135622444f,
+    0.0611307658f, -0.132954478f, -0.381073207f, -0.257864833f,
+    -0.331214905f, -0.310356379f, -0.0877651945f, -0.107450068f,
+    0.20541212f, 0.207706451f, 0.0489033163f, 0.233718276f,
+    -0.396692157f, -0.391084701f, -0.0249527711f, 0.0250186827f,
+    -0.0827576742f, -0.203977093f, -0.193068206f, -0.163555026f,
+    0.0223281886f, -0.202917993f, -0.291106701f, -0.212918207f,
+    -0.449764162f, 0.0866590738f, 0.162664279f, 0.0117689716f,
+    0.145909891f, -0.122580625f, -0.315928042f, -0.299381405f,
+    -0.116399221f, -0.344808728f, -0.0870704725f, -0.127155185f,
+    -0.497443527f, -0.538406432f, 0.253703266f, 0.211746141f,
+    -0.382490814f, -0.0251799282f, -0.603209198f, -0.389100999f,
+    -0.0192244835f, 0.303236544f, 0.0107319457f, -0.478706717f,
+    -0.0345569625f, -0.395056963f, -0.786910057f, 0.201452002f,
+    -0.160871133f, -0.538312376f, -0.112178981f, -0.326240331f,
+    0.0802422389f, -0.133963481f, -0.244298026f, -0.623746336f,
+    -0.057100866f, -0.304557472f, -0.241106063f, -0.439887822f,
+    -0.0554853864f, -0.229932472f, -0.932120681f, -0.0754458979f,
+    -0.587893903f, -0.581192434f, -0.0134025095f, 0.067968525f,
+    -0.612061322f, -0.241319314f, -0.260665327f, 0.0434505977f,
+    0.0248472504f, -0.0706160516f, -1.13860548f, 0.0260943789f,
+    0.0223454498f, -0.254996747f, -0.381180137f, 0.137489051f,
+    -0.0279556718f, -0.4418495f, -0.473371685f, -1.22565889f,
+    -1.9398371f, -1.01418078f, 0.00131243875f, -0.0282749943f,
+    -0.357624739f, 0.512781739f, 0.185630232f, 0.0641698986f,
+    0.012931454f, -0.0338021591f, -0.198094457f, -0.637135386f,
+    0.22033231f, 0.256841838f, 0.385252029f, 0.245384946f,
+    0.395993501f, 0.298798174f, 0.106724262f, -0.277835459f,
+    0.242656678f, -0.0369976684f, 0.241816431f, 0.361453235f,
+    0.0338782445f, 0.172667384f, -0.786254942f, -0.0674322993f,
+    -0.146331504f, 0.0143104121f, -0.203010514f, -0.371499598f,
+    0.480121672f, -0.0243652202f, -0.0946474001f, 0.125551552f,
+    0.140817523f, 0.13184756f, 0.030994527f, -0.427938551f,
+    -0.00961663667f, -0.535000443f, -0.406296909f, -0.0622786246f,
+    -0.216084987f, -0.322168887f, -0.290133685f, -0.198988169f,
+    0.0142346378f, 0.0482473262f, -3.326267f, 0.115743659f,
+    0.08283557f, -0.0720333755f, 0.241382062f, 0.284663439f,
+    -0.0828228965f, -0.100167677f, -0.268977076f, -1.03498542f,
+    -0.00498292409f, 0.406861275f, 0.24103649f, -0.199004591f,
+    -0.533567071f, -0.453038871f, 0.000623352476f, 0.021011183f,
+    -0.322298378f, -0.11867705f, 0.403877258f, -0.185565576f,
+    -0.0268492885f, -0.170757622f, -0.403401822f, -0.37627995f,
+    -2.47427177f, -0.0858408958f, 0.186966226f, 0.10616076f,
+    0.261510342f, 0.273225337f, -0.0919337496f, -0.771089792f,
+    -0.453667343f, -0.373225838f, 0.0952309296f, 0.257667899f,
+    0.145391509f, -0.19963488f, -1.45875525f, -0.252731085f,
+    -0.50623548f, -0.349361181f, -0.0321917199f, 0.0765665546f,
+    -0.196829379f, -2.13796449f, -0.185300559f, -0.289761007f,
+    0.243443534f, 0.191751793f, 0.0865468755f, 0.210337266f,
+    0.229425579f, 0.333041787f, 0.25003469f, 0.015162061f,
+    0.0165910888f, 0.0498475581f, -1.09844136f, 0.0581803843f,
+    -0.0870967358f, -0.562612951f, -0.306460917f, 0.0953952968f,
+    -0.624920487f, 0.265393108f, 0.0874758884f, -0.255845428f,
+    0.0538546555f, 0.236018866f, 0.347842664f, 0.139039189f,
+    -0.107306086f, -0.568914235f, -0.697641373f, 0.330468446f,
+    -0.895369768f, -0.540342867f, -0.0210331194f, 0.0521984138f,
+    0.12039534f, 0.238707304f, -0.186642468f, -0.1549467f,
+    -0.00907051563f, -0.0891727954f, 0.0157091636f, -0.944233119f,
+    -0.117037535f, 0.0476387963f, -1.48637974f, -0.279560387f,
+    -0.411466122f, -0.306461513f, 0.384969354f, -0.0167714152f,
+    -0.738032043f, 1.57413745f, -0.004940602f, -0.0445116945f,
+    -0.164732352f, -0.264044315f, -1.15671885f, -2.25276971f,
+    0.466929615f, 0.283343941f, -0.206492722f, 0.0730623603f,
+    -0.0268819053f, -0.544578671f, -0.118069038f, -0.00766365463f,
+    -0.493322015f, -0.229650527f, 0.163123801f, -0.430291653f,
+    0.261586994f, 0.161475152f, -0.201941594f, -0.382972032f,
+    -0.0944944173f, -0.413412333f, -0.0601320714f, -0.465587854f,
+    -0.30273366f, -0.442109525f, -0.183466941f, -0.160197243f,
+    -0.0216518454f, -0.334767491f, -0.50715524f, -0.11511524f,
+    -1.8441931f, -0.0809720978f, 0.0533438474f, -0.0344991349f,
+    -0.147300199f, -0.243562803f, -0.164805114f, -0.286122829f,
+    -0.362775505f, -0.176087752f, 0.014108968f, -0.142289013f,
+    0.10421408f, 0.218108594f, 0.18432191f, -0.923903942f,
+    -0.308857173f, -0.426243454f, -0.149016291f, 0.287417591f,
+    0.204866722f, 0.0317485929f, -0.851693749f, -0.174163967f,
+    -0.428432018f, -0.508893251f, -0.267212719f, -0.0261229016f,
+    0.0381639935f, -0.296743363f, -0.356593102f, -0.202744946f,
+    -0.301987439f, 0.144437805f, -0.163275138f, -0.0861296579f,
+    0.338282436f, 0.223650917f, 0.271634907f, 0.00460015377f,
+    -0.343289465f, -0.511593223f, -0.456261456f, 0.0460197814f,
+    -0.208500803f, -0.164308429f, -1.56290388f, -0.728970349f,
+    -0.41827482f, -0.687886655f, -0.400373966f, -2.32100465e-05f,
+    -0.256939203f, -0.551092207f, -0.332340747f, -0.447613716f,
+    -0.72214359f, 0.146312177f, 0.065537326f, -0.279589593f,
+    -0.289924771f, -0.138237387f, -0.382324278f, -0.236567363f,
+    -0.248322278f, -0.196556091f, -0.269566953f, -0.287885487f,
+    -0.053945519f, -0.292485923f, -0.352644295f, -0.472031593f,
+    -0.569950044f, 0.050900884f, -0.221394897f, -0.449389219f,
+    -0.360405505f, 0.100189559f, -0.217091441f, -0.0909688324f,
+    -0.195095241f, -0.162795439f, -0.715142012f, -0.447770983f,
+    -0.417864174f, -0.816046536f, -0.553090036f, -0.406172544f,
+    -0.318381637f, 0.0184271839f, -0.143085957f, -0.629931509f,
+    -0.0645367056f, -0.15627405f, -2.00821805f, -0.0491646267f,
+    -0.0184276029f, -0.354717046f, -0.170586199f, -0.189668074f,
+    -0.304751545f, -1.8410002f, -0.079314284f, -0.172197685f,
+    -0.537585735f, -0.0964084268f, -0.00921660382f, -0.0334098637f,
+    -0.256370366f, -0.254641503f, -0.12436986f, -0.278667986f,
+    -0.0053059943f, -0.529769063f, -0.817421079f, -0.721748114f,
+    0.00382162933f, -0.234962508f, -0.222266376f, -0.456822246f,
+    -0.411522031f, -0.0392541066f, 0.112704821f, 0.101973049f,
+    -0.047668986f, -0.18946892f, -0.614010632f, -0.924514472f,
+    -0.758357108f, 0.0309813134f, 0.241560698f, 0.299081504f,
+    -0.0760081708f, -0.368799269f, -0.558439434f, -0.747578084f,
+    0.288380057f, -0.194636047f, -0.92036134f, -0.176639915f,
+    -0.186963424f, 0.258464813f, 0.07997673f, -0.185574338f,
+    -0.514573634f, -0.70055598f, -0.4007653f, -0.0397541672f,
+    -0.984160364f, 0.424238414f, 0.0947440565f, 0.15157418f,
+    0.156532526f, 0.0184216723f, 0.0539132729f, -0.847073138f,
+    -0.332749963f, -1.94037688f, 0.100590512f, -0.00598181551f,
+    0.0130796703f, -0.106692955f, -0.303445578f, -0.448350132f,
+    -0.428517133f, 0.0922011957f, -0.0662132353f, -0.0803485438f,
+    0.0157505013f, 0.191036314f, 0.00625601457f, -1.49294484f,
+    0.0492677093f, -0.29538697f, -0.487856925f, 0.0206868406f,
+    -0.153816193f, -0.479837656f, 0.878632605f, 0.0848637968f,
+    -0.651923418f, 0.00325492583f, -0.275958687f, -0.187628731f,
+    -0.0452618822f, -0.15899159f, -0.645490706f, 0.010702203f,
+    -0.188950345f, -0.722439706f, -0.00216325396f, -0.0927840918f,
+    -0.350321859f, 0.190882593f, -0.0567479096f, 0.233764961f,
+    -0.0503300689f, -1.11402464f, -0.0224829353f, -0.0166032128f,
+    0.16081664f, -0.126316741f, -0.0876622722f, -2.01951122f,
+    -0.159474462f, -0.0906382501f, -1.97355032f, -0.425632775f,
+    -0.0271346681f, -0.9303146f, 0.0798579976f, -0.00328278774f,
+    -0.815544724f, 0.0777617022f, -0.0310114771f, -0.0277106185f,
+    -0.00897915475f, 0.10079211f, -0.407512158f, -1.74766791f,
+    -0.258916914f, -0.349882185f, -0.347156435f, -0.0817391202f,
+    -0.14793773f, -0.08280503f, -0.286061674f, -0.213121325f,
+    -0.544199109f, -0.386607021f, -2.26247931f, 0.0181459282f,
+    -0.403459996f, -0.489001602f, -0.120570496f, 0.0482234173f,
+    -0.23209846f, -0.545277119f, -0.153331652f, -0.898376107f,
+    -0.00364320236f, 0.181142554f, -0.164616525f, -0.319587737f,
+    -0.630636573f, -0.472357661f, -0.256904662f, -0.0112134852f,
+    -0.000215888198f, -0.111466981f, -0.387982726f, -0.323382854f,
+    -0.0718686134f, -0.111610673f, -0.456840754f, -0.348595381f,
+    -0.100507505f, -0.289284796f, -0.204457819f, -0.476697832f,
+    -0.365917265f, -0.168272451f, -0.253695995f, -0.118096881f,
+    -0.172890842f, -0.28363499f, 0.0777009204f, 0.142165706f,
+    -0.115409084f, 0.459204614f, 0.204464108f, -0.248319685f,
+    -0.178898171f, 0.00693068374f, 0.250831455f, 0.273943901f,
+    0.85838902f, 0.081225507f, -0.21804373f, -0.154178098f,
+    0.0415820926f, -0.473543972f, -0.472434938f, -0.251303673f,
+    -0.844802976f, -3.84397459f, -1.63324559f, -0.817115307f,
+    -0.154669181f, -0.0752382874f, -0.199597597f, -1.75212002f,
+    0.128071725f, 0.285944253f, -0.969020963f, -0.190479368f,
+    -0.0619125292f, -0.589468896f, -0.0943091214f, -0.371552318f,
+    -0.851365268f, -0.217725903f, 0.0330765098f, 0.0592687316f,
+    -0.215170071f, -0.0947839469f, -0.563241601f, -0.443573743f,
+    -0.00538272178f, -1.40352952f, -0.566041529f, 0.0245332457f,
+    -0.346784174f, -0.140526116f, 0.229396403f, 0.119023181f,
+    -0.898098171f, 0.0761366934f, 0.0133776637f, 0.00240247534f,
+    0.086608611f, 0.000985145103f, -0.156884372f, -0.433146685f,
+    0.00271357363f, -0.215231583f, -0.158492863f, -0.31896022f,
+    -0.255031645f, -0.40940538f, -0.238301337f, -0.00859075505f,
+    -0.0853368938f, -1.81287277f, -0.000850092794f, 0.0147421258f,
+    0.166242838f, 0.338710338f, 0.30558154f, 0.202177972f,
+    -0.403564572f, -0.252997935f, -0.0742765889f, 0.0702957287f,
+    0.00286863861f, 0.0621507056f, -0.44486627f, -1.22775674f,
+    -0.195302516f, -0.430346221f, -0.125648975f, -0.156796336f,
+    0.118473843f, 0.127221003f, -0.662074447f, -0.411587775f,
+    0.0490178503f, 0.174252778f, 0.281986058f, -0.269531935f,
+    -0.397392184f, -0.35167402f, -0.0143236797f, -0.19545339f,
+    -0.706528366f, -0.00544697978f, -0.00801701378f, 0.0173923336f,
+    -0.00786589645f, -0.139840752f, -0.213399276f, -0.441009045f,
+    -1.42496431f, 0.00564409839f, -0.172337711f, -0.147955835f,
+    -0.339261174f, -0.194028407f, -0.442126215f, -1.6064328f,
+    -0.0607030503f, -0.381588548f, -0.322235405f, 0.00162499584f,
+    0.183938399f, -0.25985989f, -0.0200519562f, 0.436206967f,
+    -0.231369793f, -0.218879089f, -0.209104002f, -0.64605552f,
+    -0.0801266357f, -0.168798283f, -0.111821115f, -0.349542856f,
+    -0.127445579f, 0.252475441f, -0.483529955f, -0.12661235f,
+    -0.482649237f, -0.150834844f, -0.0924697369f, 0.297478348f,
+    0.342350572f, -0.192926586f, 0.161281362f, -0.117522441f,
+    -0.319229066f, -0.147369802f, -0.0710392147f, -0.352397144f,
+    -0.161205351f, -0.022661658f, -0.287072301f, -0.270382077f,
+    -0.0615088157f, -0.318313837f, 0.11445944f, -0.466500521f,
+    -0.97817564f, 0.0238164011f, -0.182069018f, -0.0261609983f,
+    -0.155512393f, -0.360312968f, -0.534278035f, -2.46427035f,
+    -0.317997336f, -0.447875559f, -0.564569652f, -0.0212722123f,
+    -0.8889184f, -0.458464205f, -0.00182277279f, -0.165044144f,
+    -0.171070874f, -0.301535219f, -0.185298026f, 0.0202497803f,
+    -0.251360863f, -0.0594646819f, 0.039517913f, -0.377332807f,
+    0.00978877675f, -0.0749225169f, -1.20835602f, -0.299555838f,
+    0.171667129f, -0.13460283f, -0.324194819f, -0.44958055f,
+    -0.603055656f, -1.68435502f, -0.79600054f, -0.0999424085f,
+    -0.297421366f, -0.282735229f, -0.580352724f, -0.557353318f,
+    -1.00239182f, -0.73508215f, -0.496207118f, -0.238045484f,
+    -0.0149071012f, -0.759240031f, -0.153271586f, 0.0112766428f,
+    0.0769369751f, -0.726584852f, -0.471878648f, 0.204649061f,
+    -0.547501326f, -0.757670045f, 0.588770688f, -0.0155617185f,
+    -1.21520317f, 0.023364136f, -0.728530169f, -1.76957953f,
+    -0.905535042f, -1.94475579f, -1.15184009f, 0.0153703326f,
+    0.0748638436f, -0.275438249f, -0.362576216f, -0.351804078f,
+    -0.533448517f, -2.43154907f, -0.0378087573f, -0.00610737223f,
+    -0.185764536f, -0.454919338f, -0.19383958f, -0.0443756692f,
+    -0.301792413f, -0.061240416f, -0.383924037f, -0.305994093f,
+    -0.28225708f, -0.329076022f, -0.377866238f, -0.493018061f,
+    -0.0785080269f, -0.248530403f, -0.541117251f, -0.652150035f,
+    -0.164024025f, -0.407308221f, -0.52019769f, -0.218777508f,
+    -1.09210503f, -0.354498684f, -0.0463777743f, -0.00629607635f,
+    -0.298863262f, -0.243151799f, -0.0118122278f, 0.187621489f,
+    -0.787267208f, -0.346459121f, -0.490328968f, -0.118398733f,
+    0.1291527f, -0.555506825f, 0.114696145f, 0.0789025128f,
+    -0.536628366f, -0.0265392084f, 0.109839596f, 0.134810224f,
+    0.140367746f, -0.0300103277f, -0.159234688f, -0.8181023f,
+    -0.200719088f, -0.919256926f, 0.0865449458f, 0.130359426f,
+    -1.47665656f, -0.120351955f, 0.0690150857f, 0.10235548f,
+    0.00373694138f, -0.0294383187f, -0.283606797f, -0.301925778f,
+    -0.827316523f, -0.31014508f, -0.0126051847f, -0.0141506745f,
+    -0.377902567f, -0.193144709f, -0.0446820296f, -0.196010292f,
+    0.0763468295f, 0.0831942111f, 0.158973813f, 0.296061665f,
+    -0.12267752f, -0.297570765f, -0.190582901f, -0.0269614179f,
+    -2.69767547f, -1.00016248f, -0.167997658f, -0.305180401f,
+    -0.166662574f, -0.217525512f, -0.258068085f, -0.372531176f,
+    -0.0162148159f, -0.0249003246f, -0.195694104f, -0.610223114f,
+    -0.265995771f, -0.502598107f, -0.324261785f, -0.234515071f,
+    -0.178906649f, -0.268391192f, -0.165242344f, 0.217447102f,
+    0.192570373f, 0.204816431f, 0.070578143f, 0.152042523f,
+    -0.295629889f, -0.388445228f, -0.141420409f, -0.0811142698f,
+    -0.577975154f, 0.0401030071f, -0.20802252f, -0.139635399f,
+    -0.847812593f, -1.25308454f, -0.679492295f, -0.423370957f,
+    -0.337409496f, -0.278610826f, -0.0819058567f, -0.236376151f,
+    -0.235573709f, -0.148409083f, -0.115296856f, -0.189328715f,
+    -0.240756541f, 0.134666517f, -0.313982159f, 0.0197084118f,
+    0.170016974f, -0.159648404f, -0.0362017043f, -0.805268764f,
+    -0.30144453f, 0.0157701429f, -2.3040626f, -8.24483681f,
+    -1.05230248f, -0.299701273f, 0.140641958f, -0.0170345958f,
+    -0.347421706f, -0.408870727f, -0.0888144448f, -0.0117933238f,
+    -0.338277638f, -1.12994969f, -0.59905225f, -1.12529981f,
+    -0.278449208f, 0.0481155142f, 0.272915602f, 0.328447342f,
+    -0.196625784f, -0.108914986f, -0.220870107f, -0.146750346f,
+    0.0355216973f, 0.203216001f, 0.325570017f, 0.0815482736f,
+    0.0723931715f, -0.16362372f, -1.32172728f, -0.363375396f,
+    0.0138551174f, -0.0452045351f, -0.422389358f, -0.874669552f,
+    -0.241220638f, 0.121415325f, 0.0931176692f, -0.33901751f,
+    0.0856221691f, -0.524732709f, -0.590050638f, -0.777852952f,
+    -0.0150261959f, -0.438905895f, -0.541071475f, -0.0101782251f,
+    -0.15434809f, -0.158362687f, -0.0230736192f, -0.407818466f,
+    -0.115711726f, -0.0668754727f, -0.614432216f, -0.558797598f,
+    -0.602305055f, -0.0171785206f, -0.563276947f, -0.00220644218f,
+    -0.23939693f, -0.000582691515f, -0.0132620623f, -0.392132759f,
+    -0.317579091f, -0.250287592f, -0.0897353366f, -0.101528369f,
+    0.00357438647f, -0.0857724994f, 0.317424744f, -0.383886814f,
+    -0.449033886f, -0.549744189f, -0.0650856197f, 0.0561450236f,
+    -0.0575513057f, -0.0507894084f, -0.325323343f, -0.539354861f,
+    -0.196837515f, -0.627827287f, -0.173482046f, -0.350939333f,
+    0.17731148f, -0.31194821f, -0.431785703f, 0.108992077f,
+    0.0945825279f, 0.132862881f, 0.095616363f, -0.427212834f,
+    -0.281691253f, -0.318886787f, -0.260303855f, -0.292799145f,
+    0.0947700739f, -0.077125214f, -1.14853489f, -0.269746929f,
+    -0.447878331f, -0.516985536f, -1.20985663f, -0.608350337f,
+    0.0204009004f, -0.174160928f, -0.245926976f, -0.14862293f,
+    -0.317766219f, -0.219347537f, -0.0652583763f, -0.00782838557f,
+    -0.030623354f, -0.490994871f, -1.33265769f, -3.16376281f,
+    -1.23078811f, -0.144942582f, 0.0371764451f, -0.335648865f,
+    -0.518108308f, -0.172769144f, -0.171784103f, -0.0677241385f,
+    -0.0700561851f, 0.141367808f, 0.0996193364f, -0.361122668f,
+    -0.104019068f, -0.333735526f, 0.0711732432f, -0.171712458f,
+    -0.0941265374f, -0.198983341f, -0.4863922f, -0.154410198f,
+    -0.00111148972f, -0.234393418f, -0.889863968f, -0.334963799f,
+    0.0066634696f, -0.00636395533f, -0.375797033f, -0.61875993f,
+    -1.35162127f, -0.980247438f, -0.187930629f, 0.00309885899f,
+    0.0955834016f, -0.287712604f, -0.253133476f, -0.45796302f,
+    -0.146399707f, -0.191257074f, -0.446304798f, -0.170449838f,
+    -0.257546127f, -0.141632497f, -0.734013081f, -0.242153019f,
+    0.114631765f, -0.507895708f, -0.0433343053f, -0.119913124f,
+    -2.37889361f, -0.879633963f, -0.314976454f, 0.228557706f,
+    -0.276444465f, 0.0278020799f, -0.349466592f, -0.475134492f,
+    -5.91051435f, -4.63139677f, -2.11971211f, -0.273863286f,
+    -0.489256769f, -0.60216403f, -0.163952842f, -0.224022508f,
+    0.185971886f, 0.0212020464f, -0.389229745f, -0.47819674f,
+    -0.491146713f, -0.217532828f, 0.092151165f, -0.0766776055f,
+    -0.184466064f, -0.215843096f, -0.0771306232f, -0.40851903f,
+    -0.381799877f, -0.270707816f, -0.0476624817f, -0.300661445f,
+    -0.0979732051f, -0.0149333524f, -0.404969126f, 0.0797813833f,
+    -0.00118938624f, -0.682938516f, -3.94935703f, -0.484216809f,
+    -0.14943935f, -0.373000085f, -0.2285413f, -0.109036468f,
+    -0.165034518f, -0.246304244f, 0.020690538f, 0.152549207f,
+    -0.23675026f, -0.062962614f, 0.264025778f, 0.204372495f,
+    -0.0229581594f, -0.25880298f, -0.268896788f, -0.530778229f,
+    -0.0759865418f, -0.135303676f, -0.209463626f, -0.641745329f,
+    -0.601198733f, -0.193716541f, -0.0165645946f, -0.125475809f,
+    0.133605748f, 0.194209933f, 0.195197761f, -0.176834807f,
+    -0.0325227566f, -0.0718253627f, -0.321601808f, -0.241410896f,
+    -0.0757133886f, -0.407616168f, -0.306562245f, -0.312595606f,
+    0.0173025243f, -0.26706022f, -0.599122226f, -0.338479608f,
+    -0.393896371f, -0.353897542f, -0.141844258f, -0.044782117f,
+    0.153635055f, -0.184081092f, 0.225889817f, 0.28088364f,
+    0.0498346835f, -0.104245484f, -0.35693574f, -0.135924593f,
+    -0.106054902f, -0.424929202f, -0.479671717f, -0.328766853f,
+    -0.371581674f, -0.0722607598f, -0.336128563f, -0.000223504176f,
+    -0.0417717472f, -0.105278328f, 0.182339728f, 0.475694835f,
+    0.232018799f, 0.0279871076f, 0.368616581f, 0.198200822f,
+    -0.418378055f, 0.254615724f, 0.00777245453f, -0.201762691f,
+    -0.0534188487f, -0.012583999f, -0.196470767f, -0.484078139f,
+    0.166175634f, -0.210338101f, -0.31876111f, -0.213385284f,
+    -0.0940526277f, -0.0259827934f, -0.00121550378f, -0.562786162f,
+    -0.707257688f, -0.359780639f, -0.164092243f, 0.179069877f,
+    -0.0279497318f, -0.10145507f, 0.160148457f, 0.337740928f,
+    0.175537825f, 0.35899809f, 0.267029583f, -0.093465589f,
+    0.306946635f, 0.210133925f, -0.214415699f, 0.195789978f,
+    -0.180798873f, -0.509643376f, -0.328348964f, -0.0844501182f,
+    0.132238373f, 0.170226857f, -0.187434405f, -0.140580609f,
+    -0.210607141f, -0.0857013017f, -0.128845975f, -0.387315691f,
+    -0.497864574f, -0.478087902f, -0.548498213f, -0.234701186f,
+    -0.253463894f, -0.33665061f, -0.530000329f, -0.682694495f,
+    -0.279158443f, -0.260538489f, -0.0810718313f, -0.0196644757f,
+    -0.101781271f, 0.415323168f, 0.0752705634f, 0.0349749476f,
+    0.217289224f, 0.200006798f, 0.236057699f, 0.205244884f,
+    -0.335396677f, -0.304371297f, 0.0519474745f, 0.00603779359f,
+    -0.192216143f, -0.786595225f, -0.367179602f, -0.715483904f,
+    0.0555188656f, -0.46396324f, -0.0597390495f, -0.172715798f,
+    -0.7524243f, -0.32442534f, -0.333585501f, 0.0476838201f,
+    0.247280002f, 0.146525487f, -0.308903396f, -0.724690616f,
+    -0.000561230525f, -0.128428087f, -0.348432273f, -0.530684471f,
+    -0.959275603f, -0.292058706f, -0.00388616533f, 0.000534680963f,
+    -0.375750273f, 0.0569411814f, -0.123525314f, -0.298943728f,
+    -0.180204883f, -0.220728979f, -0.500415385f, -0.304280668f,
+    -0.217680261f, -0.189263031f, -0.296503514f, -0.0563631579f,
+    0.0551627539f, 0.158390462f, -0.148446187f, -0.274802923f,
+    -0.479299396f, -0.882390201f, -0.804153264f, -0.571339011f,
+    -0.176609337f, -0.156756848f, -0.323755473f, -0.149232149f,
+    -0.122229964f, -0.122397229f, -0.0592011549f, -0.279056042f,
+    -0.155108646f, -0.329262614f, -0.137660056f, -0.0482355617f,
+    -0.286836147f, -0.333231807f, -0.00937551912f, -0.0446390584f,
+    -0.416140795f, -0.21492447f, -0.100650147f, 0.0748724192f,
+    -0.0242858473f, -0.523458242f, -1.55897331f, -0.100460693f,
+    -0.627098143f, -0.249228105f, -0.0267310925f, -0.0723187476f,
+    -0.360327095f, -0.444986254f, -0.373006731f, -0.108750328f,
+    -0.0101430165f, -0.114884831f, -0.799835801f, -0.00370702613f,
+    0.0300669353f, -0.0243899524f, -2.00204229f, -0.649817944f,
+    -0.217866138f, -0.326458484f, -0.164578199f, -0.0228542797f,
+    0.0186632052f, -0.208025008f, -0.381897122f, -0.590058148f,
+    -0.0887757987f, 0.205929384f, -0.335201085f, -0.0533541366f,
+    -0.223547503f, -0.0842645541f, -0.175886273f, -0.554860592f,
+    -0.333524704f, -0.0605426021f, 0.0884903595f, 0.169827431f,
+    -0.0180139989f, -0.00587638142f, -0.262215108f, -0.787878752f,
+    -0.956983685f, -0.617819369f, -0.291902512f, 0.0113739921f,
+    0.156911984f, 0.201090693f, 0.191418216f, 0.234994531f,
+    0.233450174f, 0.151659161f, -0.100358546f, 0.162920579f,
+    0.259501636f, 0.389022708f, 0.181668922f, 0.112142555f,
+    -0.725159645f, -0.23796314f, -0.0593336821f, 0.00242993655f,
+    -0.0805969536f, 0.0508882478f, -0.0914336517f, -0.444689363f,
+    -0.462365597f, 0.109686024f, -0.0675630942f, -0.195314631f,
+    -0.473205388f, -0.607563436f, -2.91627026f, -0.455349833f,
+    -0.0591762662f, 0.00284291944f, -0.468703926f, -0.171649858f,
+    0.0951471329f, -0.176707923f, 0.0549669415f, 0.261736989f,
+    0.0335539021f, -0.437462866f, -0.0590258613f, 0.0626388788f,
+    -0.392733902f, -0.620808184f, -0.399757624f, -0.529042661f,
+    -0.184827f, -0.27174446f, 0.124259688f, 0.156222373f,
+    -0.0515315793f, -0.787701547f, -0.0250956099f, -0.165945515f,
+    -0.00777239678f, -0.259882241f, -0.569195211f, -0.174472138f,
+    -0.45366326f, -0.137875333f, -0.0229748823f, -0.134347141f,
+    0.179982558f, 0.0685699359f, 0.161093622f, 0.307084084f,
+    -0.315042526f, 0.0395973176f, 0.205872148f, 0.0790509358f,
+    -0.127631232f, -0.113743581f, -0.142690837f, -0.319011122f,
+    -0.183301613f, -0.35333553f, -0.370458215f, -0.0234292019f,
+    -0.279045075f, -0.298220903f, -0.0951219872f, -0.687849343f,
+    -0.480787992f, -0.156757683f, -0.0680960789f, -0.100381814f,
+    0.0228975452f, -0.186526284f, -0.478694499f, -0.234934598f,
+    -0.0339166522f, 0.204514325f, 0.201305628f, 0.150856405f,
+    -0.216345444f, -0.12514846f, 0.20830515f, 0.153880388f,
+    0.0212772526f, -0.0567173921f, -2.02661514f, -0.283440977f,
+    0.0729434863f, 0.221063793f, 0.230799466f, -0.0738790482f,
+    -0.511850357f, -0.137052163f, 0.0081410436f, 0.0597819909f,
+    -0.306469977f, -0.472463489f, -0.178093404f, -0.203691334f,
+    0.0649199113f, 0.283065319f, 0.403224558f, 0.603188872f,
+    -0.204373017f, 0.416811049f, 0.248652264f, -0.112322189f,
+    -0.00214784895f, 0.0861128941f, -0.106543362f, -0.622737885f,
+    -0.0428262092f, -0.349114358f, 0.00519278087f, -0.292358518f,
+    -0.233270511f, -0.415984631f, -0.317343593f, -0.183193386f,
+    -0.913459003f, -0.0156831741f, -1.12990832f, -0.0737385824f,
+    0.0193682052f, -0.165661931f, -0.617469013f, -0.861032128f,
+    -0.854207337f, -0.133797362f, 0.0240606572f, -0.0187294763f,
+    -1.03873527f, -4.329741f, -1.12542319f, -0.916092992f,
+    -0.704301298f, -0.177005455f, -0.512943566f, -0.348427981f,
+    -0.497197777f, -0.307509542f, -0.975351214f, -0.149553433f,
+    -0.660926819f, -0.603291571f, -0.232409015f, -0.00572065962f,
+    -0.286007047f, -0.233756393f, 0.224811688f, 0.369980067f,
+    -0.0102036102f, -0.18237406f, -0.388532311f, -0.123864584f,
+    -0.0118267611f, 0.0968765095f, -0.0112924902f, -2.02382493f,
+    -0.089083463f, -0.012897986f, -0.372087628f, -0.672778189f,
+    -0.387201846f, -0.46028468f, -0.163972303f, 0.000770372164f,
+    0.112832829f, 0.15613398f, 0.0702024475f, 0.273190171f,
+    0.532541811f, -0.0823431388f, 0.0579524823f, 0.0345604382f,
+    0.0151914926f, -0.305635124f, 0.171246082f, 0.128732204f,
+    -0.206038833f, -0.245857164f, -0.431134522f, -0.000504100637f,
+    -0.808621943f, -0.191159785f, -0.0405754894f, 0.01703793f,
+    -0.106662914f, -0.235837579f, -0.166145071f, -0.202299222f,
+    -0.797650874f, -0.352685302f, -0.167622581f, -0.608849704f,
+    -0.341334313f, 0.195454344f, 0.240662068f, 0.0197990555f,
+    0.20802471f, 0.312694997f, 0.161322415f, 0.269436479f,
+    -0.106663324f, -0.274651617f, -0.203641802f, -0.315610826f,
+    -0.409185648f, -0.0420012139f, -0.0158619881f, -0.221831381f,
+    -0.00296239089f, -0.382635176f, -0.862977445f, -1.03564465f,
+    -0.4754242f, -0.107202493f, 0.148878291f, 0.0340659767f,
+    -0.291408271f, -0.521072626f, -0.163452089f, -0.362405956f,
+    0.0897431225f, -0.0964925438f, -0.187804326f, -0.369297147f,
+    -0.270094246f, -0.330049098f, 0.083770521f, 0.104904637f,
+    0.144182429f, -0.140535474f, -0.344239235f, -0.224897936f,
+    -0.22175467f, -0.158663899f, -0.243299082f, 0.332075894f,
+    -0.137236372f, 0.000798753928f, -0.498961836f, -0.222392842f,
+    -0.342618287f, -0.085808292f, -0.122877494f, -0.0336283371f,
+    -0.126581967f, 0.181061387f, 0.246871099f, 0.153762534f,
+    -0.387277216f, -0.0251636375f, -0.101778239f, -0.0718258992f,
+    -0.102112509f, -0.276421666f, -0.180437624f, -0.199781761f,
+    -0.0885172635f, -0.180982515f, -0.172191501f, -0.149413064f,
+    -0.261300415f, -0.0596868023f, -0.207427546f, -0.11195194f,
+    -0.183982223f, -0.476417631f, -0.245290503f, -0.0932072699f,
+    0.000256590545f, -0.0212265104f, -0.473352879f, -0.296712846f,
+    -0.200263709f, 0.069735162f, 0.0322263688f, -0.345347166f,
+    -0.25066179f, -0.215069652f, -0.171259835f, -0.0384630337f,
+    0.13533622f, 0.128152281f, 0.289987236f, -1.19872475f,
+    0.13286081f, 0.10291563f, -0.249988437f, 0.230882928f,
+    0.18845275f, 0.0785513818f, -0.179638386f, -0.15184918f,
+    -0.12887764f, -0.447081923f, 0.0399514735f, 0.0320264362f,
+    -0.403822303f, 0.0425928719f, 0.131517559f, 0.0280988701f,
+    -0.462427676f, -0.368511617f, -0.0921886563f, 0.141538739f,
+    0.373871028f, -0.144019499f, 0.313422561f, 0.0979800597f,
+    0.201464236f, -0.148750424f, -0.182612002f, -0.0533787534f,
+    -1.06762373f, -0.737808645f, -0.0435687155f, -0.00137728848f,
+    -0.425347984f, -0.0927550793f, -0.10060294f, -0.305808485f,
+    0.0871897936f, -0.259062022f, -0.0470069312f, -0.299772322f,
+    0.0185183883f, -0.037343394f, -0.348804921f, -0.373404741f,
+    -0.110947147f, -0.455133229f, -0.438306391f, -0.224781588f,
+    0.107035317f, 0.015117473f, -0.196318254f, -0.278363734f,
+    -0.281727493f, -0.545565009f, -0.266642869f, -0.0359748043f,
+    0.0723180026f, -0.0679154322f, -0.774166644f, -0.171897992f,
+    -0.000401301222f, -0.0179953407f, -0.322088391f, -0.270287931f,
+    -0.18542695f, -0.178444117f, -0.286892295f, -0.0527155437f,
+    -0.723426342f, -0.263305753f, -0.583466947f, -0.189082548f,
+    -0.325438321f, -0.303176582f, 0.093318522f, -0.272538483f,
+    -0.452139318f, 0.0434209891f, 0.125063941f, 0.224330649f,
+    0.091136232f, -0.18403776f, 0.117717326f, 0.225201964f,
+    0.079450652f, -0.117706232f, 0.130276427f, 0.271272928f,
+    -0.161909327f, -0.0575892814f, -0.402438015f, 0.0067606126f,
+    -0.0887744501f, -0.203753397f, -0.123522483f, -0.2186459f,
+    -0.121697634f, -0.451892734f, -0.311646074f, -0.0198400095f,
+    -0.798095644f, -0.123837851f, 0.0341102257f, 0.0391839482f,
+    0.0278537981f, -0.27264896f, -0.201524571f, -0.0874246433f,
+    -0.618264258f, -0.73262763f, -0.00678938627f, -0.0174727309f,
+    -0.00313734799f, -0.83359921f, -0.0764062777f, 0.0135258753f,
+    -0.269761413f, 0.122559763f, 0.209556162f, 0.250859469f,
+    0.179669648f, -0.444016248f, -0.289852828f, -0.220982373f,
+    -0.371524811f, -0.244280115f, 0.0596132465f, -0.157648727f,
+    -0.247021586f, -0.193505496f, 0.00985520147f, -0.537550032f,
+    -0.810422182f, -0.769650459f, -0.51068759f, -0.438772172f,
+    -0.289451867f, -0.392670572f, -0.0964234248f, -0.132706553f,
+    -0.309485823f, -1.26688468f, -0.495657563f, -0.034506958f,
+    0.246328056f, 0.139068291f, -0.0429627933f, 0.231023639f,
+    -0.307258189f, 0.0260254163f, -0.314454257f, -0.0567492358f,
+    -0.301951021f, -0.184707791f, 0.0378815494f, -0.109422244f,
+    0.32312575f, 0.14865534f, -0.467315197f, -0.53459084f,
+    -0.145146057f, 0.33654353f, 0.223657653f, 0.0163836014f,
+    -0.130601585f, 0.245526507f, 0.280952513f, 0.0846500024f,
+    -0.131491125f, -0.210912794f, -2.67375636f, -0.467158645f,
+    -0.408728212f, -0.991619408f, -0.00969079789f, 0.248206958f,
+    -0.0397141725f, 0.264707237f, 0.27644223f, 0.241926312f,
+    -0.679180801f, -0.340341598f, 0.0104991207f, -0.0346671157f,
+    -0.0645656809f, 0.123562947f, 0.189926937f, -0.53828913f,
+    -0.438353091f, 0.0949281529f, 0.32734251f, 0.0644465908f,
+    -0.675412536f, -0.48363927f, -0.185257301f, 0.00912420079f,
+    -0.0437192768f, -0.108804762f, -0.632958531f, -1.1055944f,
+    -0.106130891f, -0.205184415f, -0.316150457f, -0.0272807609f,
+    -0.187097877f, -0.165091604f, 0.0506197773f, -0.227302551f,
+    -0.242715985f, -0.20422931f, -0.0750713646f, 0.0575010255f,
+    -0.116194062f, -0.463978231f, -0.0925982222f, -0.0919342265f,
+    -0.0405759849f, -0.813482881f, -0.317297459f, -0.32375887f,
+    -0.57713753f, -0.144227937f, -0.0161557458f, 0.0333851576f,
+    -0.566618383f, -0.275535166f, -0.0470426269f, -0.264319241f,
+    -0.574056923f, -0.519587874f, -0.388773769f, -1.28366554f,
+    -0.194732904f, -0.445457578f, -0.18745473f, -0.130534023f,
+    -0.0266402531f, -0.159017369f, -0.224626064f, -0.269636989f,
+    -0.00689020613f, -0.236975402f, -0.327022821f, -0.327340811f,
+    -0.193087235f, -0.108274855f, -0.194525018f, -0.126137868f,
+    0.17576237f, 0.172025964f, -0.482882231f, -0.142946571f,
+    0.357996374f, -0.437382221f, 0.0569930784f, 0.112492979f,
+    -0.40069434f, 0.112758443f, 0.117381215f, 0.0584275648f,
+    0.161627874f, -0.166242778f, -1.53402567f, -0.273687989f,
+    -1.42007828f, -0.255015969f, -0.581580877f, -0.0209995434f,
+    0.164140329f, 0.122829638f, 0.275054902f, -0.7938146f,
+    -0.324880451f, -0.121381387f, -0.0594239682f, 0.209467605f,
+    0.0635616332f, 0.23904635f, -0.380910009f, -0.887910903f,
+    -0.602012396f, -1.04566252f, -0.140867025f, -0.0693672225f,
+    0.0195985772f, 0.250311732f, -0.210391313f, -0.307809561f,
+    -0.089350082f, -0.151021868f, -0.400517464f, -0.444965631f,
+    -0.0166422073f, -0.0866098702f, -0.181772754f, -0.301195771f,
+    -0.10708756f, -1.31959164f, -0.508142889f, -0.310329676f,
+    -0.0391095169f, 0.00106769346f, -0.00506743789f, -0.703001201f,
+    -0.334263325f, -0.116223417f, -0.406972587f, -0.568698227f,
+    0.0151845841f, -0.444953173f, 0.0916196853f, 0.213412419f,
+    0.121458463f, -0.567854464f, -0.393530756f, -0.184337884f,
+    -0.196290687f, 0.115709461f, 0.227241635f, -0.042184405f,
+    -0.512511015f, -0.702110231f, -0.352383316f, -0.174599558f,
+    -0.254205555f, -0.249181971f, -0.183060035f, -0.151346251f,
+    -0.530834913f, -0.319078386f, 0.0110121053f, -0.0979180858f,
+    -0.0051866211f, -0.679979503f, -0.681266427f, -0.657564461f,
+    0.0533730052f, -0.221789092f, -1.04749775f, -0.615366995f,
+    -0.337488145f, 0.324319631f, 0.461732358f, 0.210149154f,
+    0.174853086f, -0.626350105f, -0.589140356f, -0.150809929f,
+    0.116268612f, 0.487177163f, 0.578525066f, 0.184748754f,
+    0.0457484871f, -0.166172892f, 0.228102192f, -0.254607499f,
+    0.0483615026f, 0.401477486f, 0.0377968363f, -0.313150555f,
+    -0.309809446f, -0.402166933f, -0.22536923f, 0.105570592f,
+    -0.322761327f, -0.365520418f, -0.1246958f, -0.00831411034f,
+    -0.0841818601f, 0.180052832f, -0.247591853f, -0.142952695f,
+    -0.0925196707f, 0.146580935f, 0.228369519f, 0.380048633f,
+    0.202966407f, 0.0918027535f, 0.166253403f, 0.202452078f,
+    -0.100054793f, -0.0410788618f, -0.345230281f, -0.174074426f,
+    -0.175688103f, -0.24652119f, -0.482033312f, -0.040114399f,
+    -0.128193289f, 0.0183525346f, -0.219679043f, -0.653371692f,
+    -0.260360479f, -0.1659199f, -0.0696762875f, -0.111535445f,
+    0.112565026f, -0.0762954727f, 0.0666630864f, -0.627551556f,
+    0.236478701f, 0.177508622f, -0.173278362f, 0.214013174f,
+    -0.224702016f, 0.148972481f, 0.142818645f, 0.0605622455f,
+    -0.0754205063f, 0.139732912f, 0.00318076857f, -0.463329256f,
+    -0.224797785f, -0.229828417f, 0.0775392652f, 0.147059843f,
+    0.0362778828f, 0.08962401f, 0.138489395f, 0.3850559f,
+    -0.130022481f, -0.267344087f, -0.314049035f, 0.0257397946f,
+    0.262719363f, 0.132170811f, 0.243708551f, -0.531519651f,
+    0.0117635494f, -0.105009831f, -0.762045622f, -0.0108695989f,
+    -1.47338402f, -0.548944235f, -0.11074464f, 0.130431473f,
+    0.126463547f, 0.0573282652f, 0.00715610944f, -0.925187707f,
+    -0.811786354f, -1.35748363f, -0.587753832f, -0.0318894535f,
+    0.0805281699f, -0.126579165f, -1.23938024f, 0.0233493242f,
+    0.0557724796f, -0.558314025f, -0.357197046f, -0.00551812118f,
+    -0.363693237f, -0.271577567f, -0.144379079f, -0.0723342523f,
+    -0.114886925f, -0.363980472f, -0.32976982f, -0.0654944256f,
+    -0.399253488f, -0.487883836f, 0.139899611f, -0.0182389095f,
+    -0.0205382742f, -0.00398120703f, -0.576097548f, -0.214610428f,
+    0.198157534f, 0.00605956884f, -0.110093258f, -0.384826392f,
+    0.0996010751f, -0.199456915f, -0.46954453f, -0.74556613f,
+    -0.172518954f, -0.373288184f, -0.408715814f, -0.0441503711f,
+    -0.0144410729f, -0.011634225f, -0.53332001f, -0.376426756f,
+    -0.153201401f, -0.334263861f, -0.0655988306f, -0.192613885f,
+    -0.0563336089f, -0.26736781f, -0.111901909f, -0.265718549f,
+    -0.269943237f, -0.363856584f, -0.0624118261f, -0.273632616f,
+    0.236461177f, 0.247103587f, 0.0056374711f, -0.645401716f,
+    -0.648893058f, -0.416747183f, -0.0656716526f, 0.0801983252f,
+    -0.247330293f, -0.479655892f, -0.0631742179f, -0.252106935f,
+    -0.536905825f, 0.0335289501f, -0.0994982868f, -0.192359596f,
+    -0.259912401f, -0.471161187f, -0.315062463f, -0.1585868f,
+    -0.328343242f, -0.309998423f, -0.079797551f, -0.200755462f,
+    -0.124205098f, -0.011788344f, -0.317625612f, -0.128421843f,
+    -0.0609595701f, -0.260756165f, -0.127875686f, -0.14596568f,
+    -0.362458795f, -0.46347481f, -0.141641945f, -0.226777062f,
+    -0.531502128f, -0.0666496083f, 0.0666383281f, -0.232132137f,
+    -0.350792438f, -0.341608226f, -0.0656166673f, 0.0222562961f,
+    -0.0153117031f, -0.650931895f, -0.296084791f, -0.0326578766f,
+    -1.4282496f, -0.329427302f, -0.174085319f, -0.00613672705f,
+    -0.0623741373f, 0.0712448061f, 0.25391224f, 0.282452106f,
+    -0.00610251678f, -0.34860909f, -0.591108739f, -0.413759917f,
+    -0.331127405f, -0.383296192f, -0.431447685f, -0.394710064f,
+    -0.452538878f, -0.215133771f, 0.0403554216f, -0.0387801267f,
+    0.278789788f, 0.0780792609f, -0.478952169f, -0.24606134f,
+    -0.112874627f, 0.0872376785f, 0.185300589f, -0.808701932f,
+    -0.74358052f, 0.00611671899f, -0.0047861659f, 0.0419966355f,
+    0.116603419f, -0.0730495229f, 0.052782286f, -1.40343642f,
+    -0.693765342f, -0.016399622f, -0.321642667f, -0.0996001065f,
+    -0.110829294f, 0.137949973f, -0.153670728f, -0.325431943f,
+    0.00496642804f, -0.378905416f, -0.380328089f, -0.304753751f,
+    -0.179573119f, -0.221977085f, -0.110189192f, -0.260017693f,
+    -0.23899132f, 0.104276367f, -0.0124036307f, -0.248066574f,
+    -0.0623622872f, -0.0736024603f, -0.543716311f, -0.294500053f,
+    -0.121536493f, -0.22499527f, -0.27715531f, -0.0535106622f,
+    0.343000472f, -0.0623086616f, -0.309720606f, 0.0597225428f,
+    -0.00924679544f, -0.277571321f, -0.0548719913f, -0.318869263f,
+    -0.126776397f, -0.424162835f, -0.519645214f, -0.195786208f,
+    -0.17001614f, 0.0879859254f, -0.181448624f, -0.460458338f,
+    0.0246645156f, -0.0913308188f, -0.291567385f, -0.298543513f,
+    0.0210259203f, 0.0654401034f, -0.212470174f, -0.429304659f,
+    0.246950105f, -1.5469172f, -0.342223078f, -0.0924549773f,
+    -0.0350736342f, -0.0938553512f, -0.122818053f, -0.668686211f,
+    -0.939595342f, -0.697100401f, -0.00142567279f, -0.0160280932f,
+    -0.102482669f, 0.0970932767f, -0.149676397f, -0.27515921f,
+    -0.206362531f, -0.272842735f, -0.201327413f, 0.0334528573f,
+    0.0207659509f, -0.260513514f, -0.810120821f, -0.335927069f,
+    -0.882995784f, -0.455964625f, 0.24556607f, 0.359426737f,
+    -0.0482889265f, 0.122542977f, -0.684063137f, -0.354952574f,
+    -0.185061052f, 0.0882276669f, 0.490101308f, 0.427359015f,
+    0.113457188f, -0.813223779f, -0.0419755541f, -0.0864213184f,
+    0.117207877f, 0.0378973484f, 0.139956146f, 0.318327457f,
+    -0.0110163493f, -0.276021093f, -0.850363672f, -0.187645912f,
+    -0.331185937f, -0.970132589f, -0.243693113f, -0.28108719f,
+    -0.106448762f, -0.0323610902f, -0.126798525f, -0.327580333f,
+    -0.311690807f, 0.00154919468f, -0.330979377f, -0.719181001f,
+    0.0660353303f, 0.10236758f, 0.157699838f, -0.987528622f,
+    -0.249945626f, -0.193424836f, -0.228310108f, -0.188075125f,
+    -0.082650587f, -0.126141608f, -0.32100141f, -0.503943801f,
+    -0.101642586f, -0.26739192f, -0.454419881f, -0.511995435f,
+    -0.0468377396f, -0.336107731f, -0.40833348f, -0.163503364f,
+    -0.382319957f, -0.60923928f, -0.179580703f, -0.103303254f,
+    -0.0848626718f, -0.278346837f, -0.245361105f, -0.067661427f,
+    0.0138972374f, -0.432991982f, 0.105560951f, 0.0714852661f,
+    -0.0204246193f, -0.102814212f, -0.18834053f, -0.278660506f,
+    -0.019981239f, 0.362346351f, 0.153766036f, -0.0877155513f,
+    -0.0168754216f, -0.380577505f, -0.22250329f, -0.0292577129f,
+    -0.0757722259f, -0.236464173f, -0.253147364f, -0.0772562474f,
+    0.128278926f, -0.452552855f, -0.315222621f, -0.0704469085f,
+    -0.30465436f, -0.156317353f, -0.271252036f, -0.625602067f,
+    -0.210446656f, -0.0806078464f, -0.117289238f, -0.35261783f,
+    -0.233413294f, -0.731025875f, -0.601054668f, -0.0741562769f,
+    -0.183653042f, 0.0316354074f, -0.157907009f, -0.473963559f,
+    -0.0511608198f, -0.0916017815f, -0.305337459f, -0.322719455f,
+    -0.0772853345f, -0.507062793f, -0.0192026924f, 0.119508356f,
+    -0.470658362f, -2.50825047f, -3.30027986f, -3.19090176f,
+    -1.88090515f, -0.154401124f, 0.0252222661f, -0.25148496f,
+    0.10085272f, -0.019291712f, -1.62440479f, -0.574120462f,
+    -0.454278558f, -0.278343052f, -0.0896299481f, -0.0531766191f,
+    -0.110220894f, -1.47683859f, 0.0137827368f, -0.157279924f,
+    -0.459040135f, -0.00496117119f, -2.46547723f, -0.546214163f,
+    0.0124753714f, -0.502364635f, -0.508305609f, -1.35069394f,
+    -0.911845684f, 0.0671632886f, 0.0103622722f, 0.0397628695f,
+    0.0117328791f, 0.231397003f, -0.103040382f, -1.67989326f,
+    0.211476907f, 0.227967843f, 0.142120838f, 0.227962717f,
+    0.0158149358f, 0.104158573f, -1.59632874f, 0.0435620993f,
+    -0.123824202f, -0.014670385f, -1.30319667f, -0.245992824f,
+    0.00899956282f, 0.150424123f, 0.401763678f, 0.841227531f,
+    -0.491548121f, -0.49035731f, -0.143219724f, -0.126642853f,
+    -0.0651999861f, 0.0987550318f, -0.118890956f, -0.750875592f,
+    -0.520515561f, -0.060934864f, -0.415775061f, -0.392943799f,
+    0.1175531f, -0.0962883756f, -0.0300507471f, -0.439012259f,
+    -0.301582068f, -0.135773972f, -0.393862635f, -1.63796604f,
+    -0.166780293f, 0.0595055819f, -0.226929188f, -0.49335295f,
+    -0.386300325f, -0.358412862f, -0.914957762f, -0.69935739f,
+    -0.375319272f, -0.102961928f, -0.197130248f, -0.533014178f,
+    -0.614255726f, -0.307976007f, -0.217188463f, 0.173731759f,
+    0.394176841f, 0.284301788f, -0.0609675832f, -0.635175884f,
+    -0.482138753f, -0.23885034f, 0.187318563f, 0.169444084f,
+    0.129996717f, 0.0947967544f, -0.24095878f, -0.298511356f,
+    -0.23632054f, -0.03136307f, -0.213492528f, -1.42244112f,
+    -1.16898251f, -0.469001532f, -0.584133744f, -0.632659733f,
+    0.123031549f, -0.483115256f, -0.198983148f, -0.239183515f,
+    -0.727897346f, -0.306258589f, -0.267180711f, -0.154217049f,
+    0.0585157871f, 0.0875579342f, -0.163495734f, -0.530219436f,
+    -0.00862440094f, -0.137282342f, -1.37119639f, 0.0283476263f,
+    -0.054301396f, -0.468114227f, -0.421373636f, -0.104513228f,
+    -0.0749122724f, -0.153076142f, -0.383617401f, -0.850931585f,
+    -0.00198475877f, -0.0530927144f, -0.614529014f, -1.57846832f,
+    -1.67302084f, -0.434503525f, 0.00452159485f, 0.0180180576f,
+    -0.335634679f, -0.263575375f, -0.0818911418f, -0.114897281f,
+    -0.0347482301f, 0.169873342f, -0.324450374f, -0.370175034f,
+    -0.164800987f, -0.104488127f, -0.383852035f, -0.355317354f,
+    0.0325962603f, -0.125006795f, -0.333778977f, -0.393458873f,
+    -0.387639731f, -0.0120806498f, -0.943972349f, -2.08985186f,
+    -0.654115677f, -0.746248305f, -0.0741418004f, -0.0165065899f,
+    0.1321356f, 0.157330379f, 0.0885123536f, -1.523399f,
+    -0.505420506f, -0.638484418f, -0.608850837f, -0.167317808f,
+    -0.0452883206f, -0.191505507f, -1.10982585f, -0.74451685f,
+    -0.579282701f, -0.258611649f, 0.367244512f, 0.440631151f,
+    -0.122223429f, -0.705799103f, -0.648340702f, -0.630523086f,
+    0.226423606f, 0.54713136f, 0.232618764f, -0.0649392456f,
+    -1.39256167f, -0.781523526f, -0.627549648f, -0.266662866f,
+    0.0108458316f, -0.391101241f, -0.427721888f, -0.386137635f,
+    -1.39369786f, -1.00116301f, -0.113775291f, -0.0228618849f,
+    -0.473525941f, -0.852411568f, 0.00589737389f, -0.00401063357f,
+    -0.0424641594f, -2.78592706f, -0.371887475f, -0.467821807f,
+    -0.287752718f, -0.236995712f, -0.384780735f, -0.0602224059f,
+    -0.635558009f, -0.191155553f, -0.206841275f, 0.309925854f,
+    0.43075642f, 0.239770085f, -0.022719929f, -0.620350301f,
+    -0.424902439f, -0.22233817f, -0.191888809f, -0.271456033f,
+    0.0141660785f, -0.593835533f, -1.21332359f, -0.235224143f,
+    0.156950742f, -0.320086807f, -0.471909612f, -0.0563424192f,
+    -0.444038957f, -0.161729395f, -0.0422562622f, 0.0335713327f,
+    -0.0242323317f, 0.0115305753f, -0.619856119f, 0.0261928663f,
+    0.0159753449f, 0.0617313869f, -0.318802893f, -0.428333759f,
+    0.021531811f, -0.59703362f, -0.237358645f, -0.307014912f,
+    0.0290792231f, 0.109924838f, 0.24268572f, 0.750148118f,
+    1.20941293f, 0.272008151f, -0.0192472227f, 0.190268338f,
+    -0.589089215f, -0.0146478359f, 0.048623044f, 0.11178045f,
+    0.0281618275f, 0.0225927234f, -0.522011161f, -0.4227162f,
+    -0.184732109f, 0.0140975052f, -1.80620539f, -3.14504385f,
+    -4.65880251f, -1.22811711f, -0.271979809f, -0.00956545025f,
+    0.11116077f, 0.07770551f, -0.664212704f, 0.173835084f,
+    -0.149379879f, -0.815047383f, 0.101127714f, 0.178639695f,
+    -0.590881646f, 0.107781157f, 0.193016768f, 0.234740496f,
+    0.202581927f, 0.154986635f, -0.0244420376f, -2.08267546f,
+    0.152589411f, -0.265273869f, -0.218996748f, -0.648018837f,
+    -0.423915595f, 0.610485017f, 0.399384707f, 0.0653087869f,
+    -0.0309265479f, 0.748220623f, 0.673549831f, -0.0262435563f,
+    0.252479434f, -0.0443389937f, -0.0400699787f, -0.637727261f,
+    -0.415811151f, -0.136631951f, -0.387366772f, 0.256524831f,
+    0.05030296f, -0.17462796f, -0.580426514f, -0.489925146f,
+    -0.461222202f, -0.11855188f, 0.116470918f, 0.301015228f,
+    -0.623952866f, -0.00565450406f, -0.339511901f, -0.677098513f,
+    -0.243791968f, -0.324884504f, -0.295734346f, -0.0433042198f,
+    -0.859506011f, -3.34069228f, -3.29833722f, -0.729833543f,
+    0.495234579f, 0.238404825f, -0.0215978976f, -0.233322278f,
+    -0.212991774f, -0.448738635f, -0.549753308f, 0.208640233f,
+    -0.652117372f, -0.839776754f, 0.384614974f, -0.10909199f,
+    0.180929601f, 0.152810797f, -0.175587282f, -0.351414233f,
+    -0.155398145f, -0.396878242f, -0.106115811f, -0.130149603f,
+    -0.705986142f, -0.748134494f, -0.188794523f, -0.0340502374f,
+    -0.0129867429f, -1.35694635f, -3.2682066f, -6.8377533f,
+    -4.55989504f, -0.465853423f, 0.0115636559f, -0.0236370638f,
+    -0.00643556798f, -0.0422131084f, 0.229314655f, 0.581500649f,
+    0.26614362f, 0.317930967f, -0.532218695f, -0.23208046f,
+    -0.497846961f, -0.175281465f, 0.189849123f, -0.0953041837f,
+    -0.178708136f, -2.53197765f, -0.271095157f, -0.340464532f,
+    -0.116986923f, 0.048408661f, 0.156163275f, -0.776912034f,
+    -1.41136682f, -0.576011002f, -0.525793493f, -0.0622251816f,
+    -0.115860678f, -0.245863184f, -0.309863657f, -0.447774798f,
+    -0.40331316f, -0.260216266f, -0.22104302f, 0.122417718f,
+    -0.22149536f, -0.341313571f, -0.562628984f, -0.212060004f,
+    -0.180209175f, -0.219711661f, -5.93761778f, -0.925555587f,
+    -0.374997616f, -0.418379009f, -0.19730556f, -0.7168504f,
+    0.134641603f, -0.138981193f, -0.802065074f, -0.188593313f,
+    -0.248377442f, -0.0180751234f, -0.276873738f, -0.645661712f,
+    -0.572203636f, -0.0741541162f, -0.217433736f, -0.0345706232f,
+    -0.0308543853f, -0.156856284f, -0.366984189f, -0.710692763f,
+    0.0331954509f, -0.382398874f, -0.234899312f, -1.48080897f,
+    -0.44835642f, -0.0168654565f, 0.342828244f, 0.596303463f,
+    -0.152503178f, 0.0957830176f, -0.0399930105f, -1.22401202f,
+    -0.222805545f, -0.229863629f, -0.59120822f, -0.20331189f,
+    -0.003907762f, -0.199122638f, -0.752003491f, -0.100801393f,
+    -0.390104324f, -0.160228312f, 0.196684331f, 0.183097541f,
+    -0.247576222f, -0.541831672f, 0.0661189705f, 0.0129784299f,
+    -1.75770485f, -0.0576084293f, 0.174294129f, 0.13505581f,
+    -3.46210289f, -0.17508702f, 0.0892350972f, 0.0679128319f,
+    -0.286866724f, -0.684521616f, -0.0148083251f, 0.432188362f,
+    0.158471167f, 0.112173527f, -0.215600133f, -0.392761618f,
+    -0.0874070525f, -0.0297842231f, -0.380526125f, 0.18654874f,
+    0.0810912624f, -0.221176162f, -0.474965006f, -0.216757789f,
+    -0.34828794f, -0.233668163f, -1.8966707f, -0.388369322f,
+    -0.107674703f, 0.0978489146f, -0.204430208f, -1.25132f,
+    -0.0185354352f, -0.0840503797f, -0.773026586f, -1.00108325f,
+    0.336478472f, 0.229600176f, -0.171948031f, -0.00771915028f,
+    -0.186848372f, -0.241022781f, -0.128190771f, -0.138623431f,
+    -1.13481724f, -0.864208817f, -0.295185387f, -0.0193386544f,
+    0.227040187f, 0.341296881f, -0.195473388f, -0.0885732993f,
+    -0.175660312f, 0.0102583151f, -0.562003195f, -0.0115884217f,
+    0.201826856f, -0.317550123f, -0.634524822f, -0.529548883f,
+    -0.0120318951f, 0.000463465229f, -1.46630597f, -0.652797163f,
+    -0.691037238f, -0.91560787f, -0.140897632f, 0.000974937866f,
+    -0.00839565787f, 0.724705398f, 0.608516574f, 0.110224843f,
+    0.21959956f, 0.14830187f, -0.2037386f, -0.149605483f,
+    -0.110220134f, -0.418013304f, -0.502577245f, -0.283130318f,
+    -0.306111544f, -0.154849559f, -0.0982095376f, 0.133349717f,
+    0.166835651f, 0.129374251f, 0.0387986861f, -0.388872057f,
+    -0.073717691f, -0.127625838f, -0.62843585f, -0.959165931f,
+    0.074821569f, 0.0305172708f, -0.121393897f, -0.602573395f,
+    0.0895466581f, -0.213523388f, 0.184402004f, 0.338178158f,
+    -0.49107644f, -0.384712905f, -0.621049166f, -0.814098418f,
+    -1.38268101f, -0.108668216f, -0.0132587664f, 0.00753848115f,
+    0.870722353f, 0.959082305f, 0.985925794f, 1.11871886f,
+    -0.134434953f, -0.220863298f, -0.630717397f, -0.0495098345f,
+    0.16057463f, 0.0718913525f, -0.158180118f, -0.548272848f,
+    0.123057246f, -0.404958099f, 0.210786313f, 0.098319374f,
+    0.00323345815f, -1.26510561f, -2.61816907f, -3.07593155f,
+    -2.24714518f, -1.17266786f, -0.0250405967f, -0.0114342356f,
+    -0.028668873f, -0.204668954f, -0.210553184f, -0.327468216f,
+    -0.0120779853f, -0.253267854f, -3.21057677f, -0.451160997f,
+    0.0219128486f, -1.64442229f, -0.023848718f, 0.116493702f,
+    -0.0545264371f, -0.0207080562f, -0.0352974832f, -2.83829403f,
+    -5.67816591f, -4.13482332f, -1.76559973f, -0.149531424f,
+    0.358252466f, 0.208483979f, 0.0349889137f, -1.06374514f,
+    0.157159567f, -0.402899355f, -1.54347825f, -0.731529176f,
+    -0.292279452f, -0.323033512f, -0.384032339f, -0.402274579f,
+    -2.78494382f, 0.0168022849f, -0.157474428f, -0.683509767f,
+    -0.559867024f, -0.358133048f, -0.00300954701f, -0.0322767682f,
+    -0.1298545f, -0.0909748748f, -0.283779085f, -0.449326366f,
+    -0.00918730069f, -0.121720366f, -0.403782219f, -0.945752323f,
+    -0.647093058f, -0.0640328899f, -0.00350851449f, -0.0116145993f,
+    0.199086964f, 0.0825339034f, 0.0586189441f, 0.394899458f,
+    -0.110893674f, 0.0292011928f, -0.130159453f, -1.06568658f,
+    0.196973443f, -0.0167690981f, -0.331306964f, 0.322731555f,
+    0.110980377f, -0.0504343547f, 0.0714663193f, 0.47994864f,
+    -0.174328253f, -0.383765459f, 0.0691731498f, -0.178634748f,
+    -0.213467583f, -0.0670473501f, -1.92570221f, -0.607096851f,
+    -1.05762494f, -1.39135253f, -1.179775f, -0.0621749647f,
+    0.00365448999f, -0.0272814278f, -0.751296461f, -1.42532361f,
+    -0.101371706f, -0.470868289f, -0.234974444f, 0.0479410589f,
+    -0.29699564f, -0.0603098162f, -0.063659817f, -3.49216962f,
+    -0.940603197f, -0.36587745f, -0.125038132f, 0.0371972024f,
+    -0.182055384f, -0.130592138f, -0.240135908f, -0.685709f,
+    -0.434367299f, -0.208112925f, -0.281824499f, -0.533842266f,
+    -0.0406433418f, -0.204980478f, -0.575100124f, -0.234677374f,
+    -0.23371394f, -0.553416312f, -0.308271229f, -0.083532311f,
+    -0.0796156526f, -0.444875181f, 0.014096939f, -4.91275167f,
+    -0.621986568f, 0.0251689833f, 0.426666439f, 0.423451126f,
+    0.7247684f, 0.397501975f, 0.236628443f, 0.00255046529f,
+    0.204116911f, 0.303758889f, 0.173868313f, 0.152372614f,
+    -0.351678103f, 0.0991957933f, -0.178257629f, 0.129186735f,
+    0.181631118f, 0.0443009883f, -0.537075996f, -0.159251988f,
+    -0.587340951f, -0.102382943f, -0.271964192f, -0.647275269f,
+    -1.48345971f, -4.49250841f, -4.19921017f, -1.45896637f,
+    -0.0430559441f, -0.178483099f, -0.334883928f, -0.17293179f,
+    0.027222449f, -0.153885692f, -0.504999638f, 0.118251301f,
+    0.00785153732f, -0.125663057f, -1.30770755f, -0.749708593f,
+    -0.78494674f, -0.342131376f, 0.000651515904f, -0.0160147939f,
+    0.486382574f, 0.380795121f, -0.0584525131f, -0.0236124732f,
+    -0.213822752f, -0.082277298f, -0.0978966132f, -0.33329016f,
+    0.282458901f, 0.200592726f, -0.0222976655f, -0.411282897f,
+    -0.259489983f, 0.0133710606f, -0.440844357f, -2.68455291f,
+    -0.895363092f, -0.26940769f, -0.0376766212f, 0.00306271669f,
+    -0.00957774464f, -0.0248091631f, -0.387192637f, -0.316386938f,
+    -0.694940805f, -0.071648173f, -0.00105878094f, 0.0586502217f,
+    -0.194265828f, -0.40469411f, 0.199401021f, 0.065699257f,
+    -0.683836102f, -0.574105144f, -0.0146263689f, -0.443835258f,
+    0.108534165f, -0.00982483383f, -0.412908763f, -0.649294794f,
+    -0.677098632f, -0.0913813189f, -0.0656488389f, -0.31632188f,
+    -0.00714090513f, -0.724823773f, -0.532106698f, -0.574230611f,
+    -0.0723643079f, -0.133658573f, -0.539307237f, -0.0100010224f,
+    -0.522948563f, -0.397668779f, 0.00845973566f, 0.0971446037f,
+    -0.015000199f, -0.0186120085f, -0.19855991f, -1.46145642f,
+    -2.2219727f, -2.01624656f, -1.06953287f, -0.167143255f,
+    0.0820369944f, -0.123162366f, -0.318328232f, 0.378880829f,
+    0.265379846f, 0.297759384f, 0.190357596f, 0.198311582f,
+    -0.158392757f, -0.366716832f, -0.0172212571f, 0.198952377f,
+    -0.287543327f, -0.439079762f, 0.024516046f, -0.0379826799f,
+    -0.122349851f, -0.0734441802f, -1.1582731f, -0.00499656005f,
+    -0.0523463003f, -0.691934466f, -6.96060514f, -2.49921036f,
+    -0.0338758379f, 0.641946018f, 0.260442823f, 0.10954202f,
+    0.145271018f, -0.0562927462f, -0.150540113f, -0.427766055f,
+    1.09128654f, 0.494612992f, 0.393845439f, 0.161836207f,
+    -0.149900317f, -0.0795300752f, -0.468933284f, 0.106947176f,
+    0.0394493826f, -0.197114542f, -0.0608036108f, -0.679228663f,
+    -0.441010624f, -0.339286745f, -0.207251534f, -0.105733581f,
+    -0.527109087f, -0.0357072763f, -0.0935378f, -0.701859176f,
+    -0.521082878f, -0.0646715909f, -0.0229262095f, -0.590528607f,
+    -0.0136563824f, -0.0220554993f, -0.222816974f, 0.456266522f,
+    -0.19444102f, -1.03752947f, -1.22781873f, -0.40532288f,
+    -0.116946727f, 0.0158091858f, -0.256255955f, -0.548319578f,
+    -0.404422641f, 0.131579712f, 0.229500741f, 0.195002273f,
+    0.160121009f, 0.0347998179f, -0.138854861f, -0.660989642f,
+    -0.346164346f, -0.1873831f, -0.319598228f, -0.0340973474f,
+    0.0451848507f, -0.325341493f, -0.552688062f, -0.238950029f,
+    -0.665145457f, -0.118712924f, -0.117778972f, -0.0190896131f,
+    -0.40686202f, -0.638287008f, -0.601874232f, -1.56739557f,
+    -0.553521335f, 0.00582237355f, 0.165613219f, 0.0634040609f,
+    -0.343663722f, -0.401364237f, -0.0540241562f, -0.375559092f,
+    -0.378393859f, -0.305619925f, -0.0133820986f, -2.13474059f,
+    -0.349829078f, -0.0783327743f, -0.192451999f, -0.202577978f,
+    -0.0694033578f, -0.191601962f, -5.84957552f, -0.277967751f,
+    -0.032116171f, -0.127696693f, -0.36614114f, -0.828515053f,
+    0.0244862679f, -0.444687217f, -0.163610101f, 0.238413498f,
+    -0.255058289f, -0.682110786f, -0.26569891f, 0.1418598f,
+    -0.619101048f, -0.405698895f, -3.91219449f, -1.44606292f,
+    -0.0269626305f, 0.541140378f, 0.0877621993f, 0.302890748f,
+    0.0846817791f, 0.000158844021f, 0.00449621398f, -0.718616128f,
+    1.20722032f, 0.393624336f, 0.258685678f, 0.0746591017f,
+    -0.249163762f, -0.285765469f, -0.394222677f, 0.22198081f,
+    0.159719422f, -0.199677557f, -1.3587395f, -0.350495517f,
+    -0.24672921f, -0.300901145f, 0.0339826904f, -0.202411339f,
+    -0.312499583f, -0.502156198f, -0.335681677f, -0.400269479f,
+    -0.0140705165f, -0.0851557553f, -0.0240633041f, -0.928358376f,
+    -0.0259400271f, -0.262370616f, -0.681727052f, -0.835375726f,
+    -0.276631683f, 0.0167797972f, -0.0605503209f, -0.421672374f,
+    -1.86677337f, -0.302597106f, -0.289581329f, -0.168928608f,
+    -0.284890085f, -0.0149062527f, -0.331095934f, -0.335358053f,
+    -0.22788462f, -0.524103105f, -0.204882711f, 0.243936256f,
+    -0.0280767605f, -0.430546373f, -0.482737184f, -0.442593545f,
+    -0.379808456f, -0.442097008f, -0.113027088f, -0.00211220142f,
+    0.0583725348f, -0.239959866f, -0.084090881f, -0.45714736f,
+    -2.29258227f, -6.79508066f, -1.22008276f, 0.243237659f,
+    0.105167724f, -0.0600556098f, 0.245944738f, 0.389703006f,
+    -0.0832280666f, -0.327410758f, 0.249466807f, 0.526256561f,
+    -2.07392335f, -0.457893014f, -0.032425981f, -0.0382532626f,
+    -0.177250549f, -0.158006623f, -0.257931173f, -0.367972314f,
+    -0.334148228f, -0.766334534f, -1.06375563f, -0.434736967f,
+    -0.429112226f, -0.63903451f, 0.000844318769f, -0.146082357f,
+    -0.379968017f, -0.291664779f, -0.193631396f, -0.0839139596f,
+    -0.048168961f, -0.34396553f, -0.538462222f, -0.407669753f,
+    0.0270921644f, 0.090035446f, -0.0824036077f, 0.803263903f,
+    -0.736636639f, -0.504678905f, -0.126644939f, -0.558546484f,
+    -0.108148284f, -0.242330849f, -1.09003675f, -0.47249195f,
+    -0.437292457f, -0.376901895f, -0.0736619383f, -0.0231387168f,
+    0.0124299396f, 0.007713906f, -0.298565418f, -0.452893049f,
+    -0.929862797f, -0.564618647f, -0.652720869f, -0.308477938f,
+    0.108708806f, -0.354598135f, -0.354230285f, -0.176034898f,
+    -0.0531620383f, -0.0402725376f, -0.00540890917f, 0.606768668f,
+    -0.243083045f, 0.165302679f, 0.276646018f, 0.0597370006f,
+    -0.281167686f, -0.0384598933f, -0.412845939f, -0.122002855f,
+    0.125882924f, 0.149872795f, -0.165010452f, -0.305352658f,
+    -0.0358414948f, 0.0424320437f, -0.248724043f, -0.382965267f,
+    -0.0209314842f, -0.268070728f, -1.16710889f, -1.31115711f,
+    -0.476683289f, -0.00328570092f, 0.00503286114f, -0.56041187f,
+    -0.279172152f, -0.173183814f, -0.33703512f, -0.31934455f,
+    -0.826041698f, -0.230370015f, -0.218834877f, -0.112338684f,
+    0.0865863338f, -2.40127444f, -0.195213273f, 0.257794529f,
+    -0.0148954671f, -0.115141787f, -0.828589976f, -1.30315495f,
+    -1.38691354f, -0.898193598f, -0.127284244f, 0.142377168f,
+    0.200754523f, 0.228854269f, -0.0145124774f, -0.329699069f,
+    -0.0218350533f, -0.487174362f, -0.208638519f, 0.196890041f,
+    -0.378908426f, -0.120280698f, -0.849917173f, -0.642174065f,
+    0.0166637953f, -0.112175323f, -0.598940849f, -1.7234962f,
+    -0.171983927f, -0.19288072f, -0.137355357f, 0.333471507f,
+    -0.106484227f, 0.437743813f, -0.0553756468f, -0.231776983f,
+    0.0734495819f, -0.164207086f, -0.0827536806f, -0.495559633f,
+    0.176484913f, -0.261294305f, -0.295172781f, 0.0526198782f,
+    0.0645365715f, -0.0213335175f, 0.010267783f, -1.52209067f,
+    -4.4591403f, -5.79003906f, -1.34831548f, -0.458392203f,
+    -1.04032171f, -0.638879418f, -0.264410317f, -0.0393361039f,
+    -0.14748174f, -0.42688179f, -0.297006905f, 0.06047507f,
+    0.21426487f, 0.372525156f, -0.0113725187f, -4.54789591f,
+    -2.86206532f, -0.170241743f, -0.0749139562f, 0.32586652f,
+    0.334160537f, 0.326405555f, -0.0519828871f, -0.127436325f,
+    0.324006796f, 0.339424759f, 0.299263895f, -0.211221218f,
+    0.213881344f, -0.427107245f, -0.433425188f, -0.219088361f,
+    -0.447674632f, -0.202966422f, -0.166633651f, -0.297989935f,
+    -0.440250814f, 0.214752316f, 0.114669427f, -0.0800235644f,
+    -0.164013699f, 0.0229518451f, 0.0616588257f, -1.59402013f,
+    -4.14652538f, -0.531312585f, 0.135733292f, 0.0201439522f,
+    0.193814367f, 0.436299026f, 0.0988586918f, -0.100333832f,
+    -0.476889998f, -0.180791169f, -0.104724504f, -0.358900249f,
+    0.122291237f, 0.03433403f, -0.351271182f, -2.32884669f,
+    -0.526467025f, -0.321852446f, -0.257554591f, -0.204569817f,
+    -0.392619729f, -1.27760875f, -0.386293441f, -0.0532135144f,
+    -0.498796761f, 0.00788371544f, -0.105067611f, -0.3188636f,
+    0.0451721251f, -0.166590154f, -1.50653851f, -0.0331428796f,
+    0.161669418f, 0.354334444f, 0.238683879f, 0.0488163866f,
+    -0.215558767f, -0.51694268f, -0.371021807f, -0.185815915f,
+    -0.171157092f, -0.266878873f, -0.509308875f, 0.0207474083f,
+    0.000758625509f, -0.659912288f, -0.00643978268f, -0.480675787f,
+    -2.88611984f, -3.61632657f, -3.23037338f, -0.75281626f,
+    0.120883584f, 0.0861808434f, -0.104854569f, -0.941022098f,
+    0.213790402f, 0.0462671109f, 0.260013133f, 0.254790545f,
+    0.180688515f, 0.0646214336f, -0.301693559f, -0.172835842f,
+    0.215131968f, -0.22634989f, 0.0861250162f, -0.299129456f,
+    -0.069576174f, -0.203002572f, 0.193432033f, -0.271630943f,
+    -0.691083729f, -0.642432928f, -0.399563938f, -0.764275968f,
+    0.0117234737f, -0.100307584f, -0.441960216f, -0.53816247f,
+    -0.328411698f, -0.4868294f, -0.991912901f, -0.0901557133f,
+    0.182845935f, -0.232809663f, -1.11426938f, 0.0177691393f,
+    0.0508831926f, -0.213285059f, -0.437210113f, 0.0347024165f,
+    0.155576289f, -0.378014952f, 0.0184173007f, -0.240592748f,
+    -0.373340905f, -0.144589171f, -0.223552167f, -0.184432954f,
+    -0.376981795f, -0.0235418063f, -0.535421133f, -0.233294278f,
+    0.000322260836f, -0.299926043f, -1.02877009f, -1.02814925f,
+    -0.120394319f, -0.169758439f, -0.389440179f, -0.898676276f,
+    -0.581581771f, -0.0112936227f, 0.184521616f, 0.319144636f,
+    -0.0914381668f, -0.309900522f, -0.201247349f, -2.38433695f,
+    -0.0131346323f, 0.0243736971f, -0.156544387f, -1.65415132f,
+    -3.51755905f, -3.6598742f, -1.12805676f, -0.0504790954f,
+    0.0709515214f, -0.128497869f, -0.649104953f, 0.0267888829f,
+    0.0642902702f, -0.118541621f, -0.787892461f, -0.0937710926f,
+    -0.307009697f, -1.16511142f, -1.60950482f, -0.427556306f,
+    -0.00160229509f, 0.0213520303f, -1.24294055f, -1.80789852f,
+    -0.272961974f, -0.343283474f, -0.580970764f, -0.792091727f,
+    -0.101548128f, -0.331724167f, 0.173220053f, 0.139925554f,
+    0.122722544f, 0.159801811f, -0.0305522326f, 0.567105949f,
+    0.351379156f, 0.533871293f, -0.17657721f, 0.00292247976f,
+    0.0309746526f, -0.485684544f, 0.225288674f, 0.421037793f,
+    -0.645126641f, -0.101024531f, 0.250425756f, 0.115430325f,
+    0.069413662f, -0.137965187f, -0.224279404f, -0.556251645f,
+    -0.886039078f, -1.16067457f, -4.06200457f, -3.25886631f,
+    -1.05912983f, 0.00568149425f, -0.216484308f, 0.0740907043f,
+    -0.817072809f, 0.0845477954f, 0.137180239f, 0.198469311f,
+    -0.908809066f, 0.17741783f, 0.171859682f, 0.042168621f,
+    0.00447408948f, -1.01983202f, -2.76641083f, -5.67391729f,
+    -4.6892333f, -3.96194792f, -0.153280407f, -0.266906917f,
+    0.11606963f, -1.21319735f, 0.0205357913f, -0.0419080295f,
+    0.0607860498f, 0.0773145258f, 0.269427359f, -0.484939754f,
+    -0.0687844902f, -0.602362514f, -0.558534145f, -0.841467679f,
+    -0.839698374f, -0.0249654297f, -0.00179351401f, -0.00590804685f,
+    -0.689318359f, -0.0236579236f, 0.0676275343f, -0.030762013f,
+    -0.308785856f, -0.139096752f, -0.0790387467f, -0.375527561f,
+    -0.248423025f, 0.0596573167f, -0.472208053f, -0.00877869781f,
+    -0.317957878f, -0.128822625f, -0.23469536f, -0.0910029784f,
+    0.14334777f, -0.299919933f, -0.220231295f, -0.190325826f,
+    -0.151915863f, -0.0504612029f, -0.468447655f, -0.0768383667f,
+    -1.46682239f, -1.6104486f, -6.72261715f, -4.30173731f,
+    -0.691088617f, 0.00563052716f, -0.0195129365f, -0.00357180531f,
+    -0.0345678777f, -0.450366795f, -0.497971416f, -0.43356204f,
+    -0.614603698f, -0.587035537f, -0.435732663f, -0.00537733315f,
+    -0.15834035f, -0.278579414f, -0.218438327f, 0.0888125896f,
+    -0.194702759f, -0.0689178929f, 0.300956368f, 0.546800494f,
+    -0.281392783f, 0.035343349f, 0.214408904f, -1.01643431f,
+    -1.94717133f, -0.308299899f, 0.856406033f, 0.119122162f,
+    -0.0585856251f, 0.319673061f, -0.021192532f, -0.531082511f,
+    -0.518310428f, 1.52921987f, -0.0490983799f, -0.195078105f,
+    -0.11771322f, 0.212046608f, -0.160845175f, -0.374682873f,
+    -0.0387593359f, -0.368505746f, -0.40024519f, -0.34375146f,
+    -0.280919135f, -0.753045201f, -0.761787653f, -0.173918933f,
+    -0.126099363f, -0.515790761f, -0.10686972f, -0.20064716f,
+    -0.426940769f, -0.172853962f, -0.0895245671f, -0.262842774f,
+    -0.779498219f, -0.0137908282f, -0.550157607f, -2.88262272f,
+    -4.18948364f, -3.14330292f, -0.34164992f, -0.0236860495f,
+    -0.403758049f, -0.861617863f, -0.120637149f, 0.0737797618f,
+    -0.0843086168f, 0.234422013f, 0.322549313f, 0.19308497f,
+    -0.730142534f, -1.4598279f, -1.86373723f, -0.213715881f,
+    -0.214434057f, -0.101061799f, -0.345021099f, -0.599019349f,
+    -0.566772759f, -0.753825963f, -0.364101827f, 0.193823963f,
+    0.0650486425f, -0.121472917f, -0.636098623f, -0.462713987f,
+    -0.38867259f, -0.163802281f, -0.114246115f, -0.370696396f,
+    -0.354206145f, -0.319828302f, -0.234778211f, -0.211234823f,
+    -1.42723191f, 0.511562109f, -0.0262655709f, -0.0138044693f,
+    -0.045660466f, -0.150766864f, -0.501093924f, -0.0323415436f,
+    -0.224035665f, -0.478724509f, -0.426222354f, -0.231558532f,
+    -0.751060307f, -0.122167036f, -0.0300492607f, -0.360053986f,
+    -0.482649505f, -0.179525554f, -0.142217904f, -0.0634288266f,
+    -0.25810799f, -0.123474628f, 0.195014223f, 0.0979650542f,
+    0.260453314f, 0.219124854f, 0.283112705f, -0.0320663974f,
+    -0.156710669f, -0.00384679716f, 0.393409491f, 0.193989381f,
+    0.149297789f, 0.302590489f, 0.180237189f, 0.252204835f,
+    -0.00719530322f, -0.3393417f, -0.26039511f, -0.143418193f,
+    0.00568843633f, -0.0176801849f, -0.34141162f, -0.577235341f,
+    0.131231427f, 0.0528310351f, -0.445061445f, -0.0893978626f,
+    0.0379573554f, -1.27143908f, -0.180863351f, -0.201242045f,
+    -0.551421285f, -0.110644877f, 0.00746251596f, 0.0410907939f,
+    -0.178027615f, -0.345035613f, -0.0240909047f, -1.11478317f,
+    -0.451883584f, -0.417736232f, 0.0116651757f, -0.135999471f,
+    -0.0318556242f, 0.169835061f, -0.133301184f, -0.820324004f,
+    -0.106711462f, -0.0757282674f, -0.653789937f, -0.0558571219f,
+    -0.316970319f, -0.374097914f, -0.199776113f, -0.568252921f,
+    -0.00148586603f, -0.0291551687f, -0.293934613f, -0.363276184f,
+    -0.889341414f, -0.985922515f, -0.0385613628f, -0.000169800012f,
+    -0.391480386f, -0.160405606f, -0.293305874f, -0.261291921f,
+    -0.266964614f, 0.00507625658f, -0.382902771f, -0.104897887f,
+    -0.233140364f, -0.216899693f, 0.114934839f, 0.141063467f,
+    0.184011653f, 0.146620989f, 0.19555141f, 0.268743098f,
+    -0.0496400259f, -0.0196169652f, -0.0184707716f, -0.738296986f,
+    0.0904906616f, -0.0431784876f, -0.592784822f, 0.106983222f,
+    -0.0113894632f, -0.00401381077f, -0.282228708f, -0.48753491f,
+    -0.652661383f, -0.19470793f, -0.186157584f, 0.098894991f,
+    -0.0517297015f, 0.0757033899f, 0.249193162f, 0.380574942f,
+    -0.674757957f, 0.151640818f, 0.108404115f, -0.303036779f,
+    0.205085665f, 0.272738904f, -0.0230966005f, -0.179736495f,
+    -0.0185365528f, -0.192455038f, -0.109188981f, -0.359597415f,
+    -0.389215797f, -0.0907387882f, -0.285228401f, 0.114422336f,
+    -1.92656779f, -0.061806716f, 0.105208509f, -0.0252417289f,
+    -0.207269758f, -0.185252994f, -0.377413392f, 0.0484244227f,
+    -0.0792706162f, -0.0706293583f, -0.350341886f, -0.243990019f,
+    -0.438830227f, 0.118128985f, 0.10988909f, -0.309223205f,
+    0.160335004f, -5.51783196e-05f, -0.551887751f, -0.301538557f,
+    0.021610871f, -0.980379343f, -0.198447347f, -0.0895218924f,
+    -0.640503228f, 0.165612206f, 0.302433461f, 0.138210267f,
+    0.0790304467f, -0.0082615139f, -0.0990861878f, -0.578843176f,
+    0.336982876f, 0.266271621f, 0.104729779f, -0.014392077f,
+    0.00296657928f, -0.2021503f, -2.38943982f, -0.249567866f,
+    -0.269680798f, -1.48416102f, 0.0102137998f, 0.110547207f,
+    -0.0615135245f, -0.186577067f, -0.189425498f, -0.478895694f,
+    -0.146541536f, -0.892614186f, -0.042527359f, -0.0171937011f,
+    -0.0060657328f, -0.39375031f, -0.420872509f, -0.311009616f,
+    -0.206142545f, -0.347113311f, -0.203842953f, -0.165514037f,
+    -0.57401365f, -0.246572167f, 0.226569444f, 0.0184247196f,
+    0.347492009f, 0.377337396f, -0.17067793f, -0.181767315f,
+    0.10291338f, -0.212941319f, -0.348864853f, -0.0383757912f,
+    -0.515031397f, -0.0730601698f, -0.530233264f, -0.332215041f,
+    -0.055632636f, -0.0921687856f, -0.286823153f, -0.67710638f,
+    -0.0395352803f, -0.0535326712f, -0.98062849f, -0.0975323543f,
+    -0.0259894151f, -0.256683558f, -0.401879996f, 0.0909932181f,
+    -0.0584902987f, -1.76861453f, -0.190772682f, -0.408052176f,
+    -0.335662812f, -0.376146972f, -0.299836665f, -0.488812149f,
+    -4.2954483f, -0.526278436f, -0.976184547f, -0.241479471f,
+    -0.156278566f, -0.416714668f, -1.06502473f, -1.93601859f,
+    -0.735762298f, -1.12299156f, -0.315079778f, -0.269544214f,
+    -0.712155402f, -0.0163436141f, -0.000365286745f, -0.306302845f,
+    -0.72164464f, -0.137224615f, -0.318476319f, -0.208784461f,
+    -0.660214007f, -0.0107955439f, 0.0932187662f, 0.0393117517f,
+    -0.0029842481f, -0.142791882f, -0.136643201f, -0.417797118f,
+    -0.133936971f, 0.140003353f, -0.163262099f, -0.32207647f,
+    -0.19293575f, -0.328898132f, -0.131781369f, -0.137418881f,
+    -0.882860005f, -0.325794607f, -0.947897613f, 0.0944028869f,
+    -0.0290202796f, -0.430837721f, -0.426413298f, -1.01238906f,
+    -0.0575955473f, -0.593156576f, -0.0280306078f, -0.21762085f,
+    -0.314221472f, -0.536306798f, 0.0379243232f, -0.00415193429f,
+    0.377837718f, -0.0196125135f, -0.0808096603f, -0.516511679f,
+    -0.257757366f, -0.182998091f, -0.135909647f, -0.203395233f,
+    -0.0251681544f, -0.350295126f, 0.159030482f, 0.158978879f,
+    -0.0272163358f, -0.486402422f, -2.83782601f, -1.53301632f,
+    -1.47634327f, -0.101789862f, -0.00543013262f, 0.106978126f,
+    0.289298505f, 0.137613162f, -0.331394106f, -0.550069988f,
+    0.265321404f, 0.316914022f, 0.190544218f, -0.194799945f,
+    -0.219008997f, 0.0408642069f, -0.435023129f, -0.0158694983f,
+    -0.18641606f, -0.127655253f, -0.68224901f, -0.467265248f,
+    -0.00522390008f, -0.155521989f, -0.627039671f, -0.327366889f,
+    -0.153979227f, -0.298286706f, -0.360818207f, -0.0742065609f,
+    -1.69587076f, 0.0739012882f, -0.0178662948f, 0.000191529674f,
+    -0.0351069309f, -0.0898988619f, -0.0259191655f, -0.654131234f,
+    0.0276851822f, 0.170295298f, -0.650400758f, -0.123819306f,
+    0.183912978f, -0.248505905f, -1.65542793f, -2.19077754f,
+    -0.206567243f, -0.359000146f, -0.550363362f, -0.00174320256f,
+    0.149482056f, -0.16314581f, -0.0853803083f, -0.34184882f,
+    0.102018498f, -0.217488304f, -0.199003339f, -0.2000366f,
+    -0.138539806f, -0.221751258f, -0.523079336f, -0.53362602f,
+    0.101465851f, -0.441607237f, -0.220574766f, -0.494329304f,
+    -0.031136509f, -0.0132085038f, -0.0229978021f, -0.726356864f,
+    -1.24125922f, -0.414430678f, -0.0325367525f, -0.35771656f,
+    -0.178715885f, -0.0594255365f, -0.0777958706f, -1.10185516f,
+    -0.430051386f, -0.131115988f, -0.681462348f, -0.125553906f,
+    -0.480921566f, -0.135984451f, -0.044324711f, 0.0487223901f,
+    -0.16915825f, -0.224274412f, -0.16759488f, -0.195597231f,
+    -0.0478351787f, -0.0182942357f, -0.363483757f, -0.52931416f,
+    -0.424457103f, -0.335884959f, 0.0023219001f, 0.0115564344f,
+    -0.0073980093f, -0.053412836f, -0.226046205f, -0.522593856f,
+    -0.482602894f, -0.116621897f, -0.927309394f, -0.288885027f,
+    -0.538311124f, -0.17056866f, -0.18923144f, -0.19054395f,
+    -0.419742316f, -0.376169711f, -0.576533079f, -0.663040996f,
+    -0.0720601007f, -0.288021713f, -0.408679724f, -0.198176965f,
+    0.256604016f, 0.324076742f, -0.0996790975f, -0.940444946f,
+    -0.459637433f, -0.367130011f, -0.170714095f, 0.044324901f,
+    -0.308639854f, -0.439258426f, -0.261941344f, -0.356502116f,
+    -0.517368436f, -0.259676963f, -0.312943518f, -0.060093388f,
+    -0.98932004f, -0.0422999822f, -0.0338383205f, 0.0479635857f,
+    -0.0798206627f, -0.45704481f, -0.875831425f, 0.0475243889f,
+    -0.247145489f, -0.0128479404f, -0.171445072f, -0.86039263f,
+    -1.23226392f, -0.268199593f, -0.0695308149f, 0.0121435514f,
+    -0.745633006f, -0.0387645178f, -0.266115785f, 0.171461478f,
+    -0.102773421f, -0.589471996f, -0.118473202f, -0.045420818f,
+    0.0501271561f, -0.0260304343f, -0.312581986f, -0.405174404f,
+    0.121436007f, -0.451580465f, -0.0239127222f, -0.743041396f,
+    -1.5924927f, -0.222302973f, -0.134290919f, -0.0734117776f,
+    -0.267448992f, -0.212161109f, -0.131177068f, -0.104773805f,
+    -0.10677921f, 0.132835284f, -0.206542283f, -1.16078627f,
+    -0.10591349f, -0.263078451f, -0.496534765f, 0.00982117094f,
+    -2.01408815f, -0.355894148f, -0.10089606f, -0.239346176f,
+    -0.178351179f, -0.163499117f, -0.0915616304f, -0.870985925f,
+    0.023698492f, -0.818340659f, -0.0859918371f, -0.401410818f,
+    -0.596018672f, -0.679216981f, -0.341973305f, 0.185997382f,
+    0.0187482424f, 0.0214785282f, -0.370503783f, -0.311919004f,
+    0.0214210674f, -0.381439477f, 0.253297359f, -0.0883752853f,
+    -0.185237363f, -0.330383778f, -0.231982648f, 0.0104600107f,
+    0.0141738467f, -0.693394184f, -1.68651676f, -0.145932674f,
+    -0.414273679f, -0.0829275101f, -0.00691739377f, -0.382214338f,
+    -0.59915179f, 0.0245327763f, 0.121037662f, -0.0685327575f,
+    -0.00802570209f, -0.0141154369f, -0.443152994f, -1.33868372f,
+    -0.502710223f, -0.344016045f, -0.408995628f, -0.325236648f,
+    -0.0593992323f, -0.312332839f, -0.318604231f, -0.225690514f,
+    0.0952430815f, -0.462292582f, -0.155792981f, 0.128617778f,
+    -0.388144463f, 0.0779207498f, 0.0695381314f, 0.143883958f,
+    0.123676613f, -0.192112237f, -0.354648232f, -0.273482382f,
+    -0.258511573f, -0.432110161f, 0.0121467216f, 0.0065682428f,
+    -0.887141943f, -3.59429598f, -2.21080875f, -0.275907099f,
+    -0.246778876f, -0.103583381f, -0.0781492069f, -0.286542952f,
+    -0.594127417f, -0.0686856657f, -0.105856918f, -0.0395985208f,
+    0.188656464f, -0.13177669f, -0.244224623f, -0.186643884f,
+    0.00515787443f, -0.0515943207f, -0.381067783f, -0.359555215f,
+    -0.0241011493f, -0.611987054f, -0.32064113f, -0.0391422883f,
+    -1.58288157f, -0.290970236f, -0.201484069f, -0.282342106f,
+    -0.130096421f, -0.386272609f, -0.316927791f, -0.138437077f,
+    0.00398340123f, -1.60160339f, -0.0540744178f, -0.142053202f,
+    -0.287646651f, -0.259081095f, 0.224038497f, 0.00378026627f,
+    -0.097853072f, -0.124741994f, 0.201320574f, 0.345262349f,
+    0.085342057f, -0.0331881121f, -0.221140593f, -0.380604833f,
+    -0.203896046f, 0.250717789f, 0.229164377f, -0.206396475f,
+    -0.165943384f, -0.000364003849f, -0.395433068f, -0.227975801f,
+    0.0235145316f, -0.0403458402f, -0.285668373f, -0.760660172f,
+    -0.399400622f, -0.164354458f, -0.352712065f, -0.356174916f,
+    -0.445824891f, -0.104312539f, -0.220869437f, -0.182716697f,
+    0.0825773776f, -0.297216564f, -0.957038164f, -0.465484113f,
+    -0.362363756f, -0.143605605f, -0.23728691f, 0.0190852527f,
+    -0.408080429f, -0.292900622f, -0.00953086f, -0.144900337f,
+    0.0369705819f, -0.19738625f, -0.126505047f, -0.458038539f,
+    -0.0346321054f, 0.268219501f, 0.25895384f, 0.193788201f,
+    0.16949147f, 0.158770397f, 0.134474471f, 0.275226861f,
+    0.220011115f, 0.182983726f, 0.229324743f, -0.0929417983f,
+    -0.485117733f, -0.0193482991f, 0.111023717f, 0.273759544f,
+    -0.338806152f, -0.246857688f, -0.0207190961f, -0.156797364f,
+    0.0645888597f, -0.054206945f, -0.364713103f, -0.423632503f,
+    -0.376023114f, -0.279479951f, -0.201304868f, 0.0102072312f,
+    -0.550014079f, -0.175489053f, -0.402207196f, -0.558047175f,
+    -0.272382081f, -0.427345455f, 0.0125626093f, 0.00331164594f,
+    0.0743979365f, 0.15485543f, -0.392060935f, -0.414061397f,
+    -0.203008473f, -0.573400676f, -0.260003537f, -0.125643834f,
+    0.0114895888f, -0.38454935f, -2.47816539f, -1.74364209f,
+    -1.10323226f, -0.198825613f, 0.00360725541f, 0.0244121719f,
+    -2.65300679f, -0.268538892f, -0.075010024f, -0.178127259f,
+    -0.051240962f, 0.0306844432f, -0.655058086f, -0.798464835f,
+    -0.445862502f, -0.0977245569f, -0.133726984f, -0.465007663f,
+    -0.485048205f, -0.844245195f, 0.163133577f, -0.20572345f,
+    -0.4722206f, -0.244354978f, -0.245019585f, -0.265386969f,
+    -0.268666089f, -0.505697846f, -0.6193012f, -0.353136539f,
+    -0.416050494f, -1.64029765f, -0.0914499983f, -0.0440365747f,
+    -0.14500317f, 0.0055464711f, -1.17887211f, -3.04128218f,
+    -0.954006493f, -1.12499261f, -0.92220968f, 0.0063490523f,
+    -0.46706295f, -0.441741675f, 0.13682273f, 0.104336821f,
+    -0.0469871722f, -0.25351423f, -0.399857908f, -0.407366365f,
+    -0.0759163275f, 0.301544875f, -0.467699379f, -0.0984889865f,
+    -0.208161354f, -0.29165408f, -0.233375803f, -0.568511128f,
+    -0.160621509f, -0.3340047f, 0.113886178f, 0.105626091f,
+    -0.289062589f, -0.276772082f, -0.261718661f, -0.00904334337f,
+    -0.223775432f, -0.0502646789f, -0.0760914236f, -0.501881778f,
+    -0.611242414f, -0.472597748f, -0.300034881f, -0.728319526f,
+    -0.256942213f, 0.00604236173f, -0.00151372515f, -0.463181883f,
+    -0.288030952f, -0.432745129f, -0.137226328f, 0.0198312663f,
+    0.00677813729f, -0.426223189f, -0.145628512f, 0.138209447f,
+    -0.0680234507f, 0.106407382f, 0.272095621f, 0.30933094f,
+    0.186560616f, 0.1744387f, 0.318271846f, 0.0502725914f,
+    0.137902349f, -0.0682392716f, -1.9277575f, 0.0960185453f,
+    -0.405847818f, -0.362004459f, 0.243329093f, 0.197229758f,
+    0.263342798f, 0.0948781893f, -0.0194139872f, -0.433859974f,
+    -0.405785799f, -0.344955087f, -0.00830020756f, 0.0236140266f,
+    -0.0246959794f, -0.0977005884f, -0.466505378f, -0.353485227f,
+    -0.231821328f, -0.140595227f, -0.220863953f, -0.130038425f,
+    -0.0508623458f, -0.246041581f, -0.595415592f, -0.0109198056f,
+    -0.275547355f, -0.167477086f, -0.227125347f, -0.237655118f,
+    0.0214485321f, -0.0234308895f, -0.186097816f, -0.846811712f,
+    -0.645983934f, -0.32362929f, -0.0063165524f, 0.00275934977f,
+    -0.76352489f, -0.269943058f, -0.212328419f, -0.141036406f,
+    0.325464964f, 0.178148866f, 0.114329115f, -0.0783194378f,
+    -0.124338672f, -0.0208129734f, 0.418219537f, 0.259772748f,
+    0.147193402f, -0.453426391f, -0.414400697f, -0.136526614f,
+    -0.531273305f, -0.0982940048f, 0.113911159f, 0.0169367883f,
+    -2.21260047f, -0.42926541f, -0.496403337f, 0.0216322318f,
+    0.0390300788f, 0.00135203777f, -0.087602891f, -1.39441347f,
+    -1.99269354f, -2.14171195f, -1.49576759f, -0.21728237f,
+    -0.0823566541f, -0.39669919f, -0.227416888f, -0.0550829135f,
+    0.0220134649f, -0.0201584306f, -0.411839992f, -0.357250601f,
+    -0.288546234f, -0.32885921f, -0.0935492888f, 0.119458713f,
+    -0.477332771f, -0.0928862989f, -0.14855656f, -0.208942696f,
+    -3.70108294f, -0.640982747f, -1.01333439f, -4.84031773f,
+    -0.127651364f, -0.301205128f, -0.369521409f, -0.0199735612f,
+    -0.66600436f, -0.49810493f, -0.56528151f, -0.22605367f,
+    -0.124246776f, -0.213858336f, -0.367865145f, -0.536794484f,
+    -0.356001616f, -0.373250872f, -0.198827684f, -0.41316694f,
+    0.0332776383f, -0.284308672f, -0.841398656f, -0.0927093402f,
+    0.186670676f, -0.0115869995f, -0.601047754f, 0.218525767f,
+    -0.0823562592f, -0.658997476f, -1.4394666f, -0.948076367f,
+    -0.0640969723f, 0.0231329296f, -0.245930523f, -0.414837301f,
+    -1.13819087f, -0.0119944979f, -0.110763863f, -0.159238502f,
+    0.13359949f, 0.177801326f, 0.360491127f, 0.0903870091f,
+    0.269032985f, 0.145005062f, 0.184886321f, -0.0856975168f,
+    -0.0826461539f, -0.063294962f, -0.442257702f, -0.109401941f,
+    0.148904756f, -0.0885155797f, -0.461593568f, 0.058727175f,
+    -0.701762676f, -0.442282051f, -1.20277667f, -0.610349715f,
+    -1.02352834f, 0.0214278251f, -1.14777565f, -0.55853349f,
+    -0.705935538f, -0.0390152857f, 0.0997385457f, -0.277548254f,
+    0.101989992f, -0.0831692442f, -0.864613771f, -0.0184324514f,
+    0.329094797f, -0.0406532586f, -1.07165825f, 0.0896074399f,
+    -0.00514941476f, 0.00111320661f, -0.270539373f, -0.589050114f,
+    0.101720721f, -0.0132618938f, -0.0011044126f, -0.838883698f,
+    -0.510294735f, -1.60782254f, -0.605555654f, 0.189113319f,
+    -0.335265189f, -0.128209889f, -0.224554449f, -0.0445052981f,
+    0.133489668f, -0.322055608f, -0.675923169f, -0.612904847f,
+    -2.37321186f, -0.198534772f, -0.0661070868f, -0.147734389f,
+    0.153970718f, -0.53757751f, -0.442673028f, 0.099789612f,
+    -0.0585551225f, -0.00940475892f, -0.0167593993f, -0.817422271f,
+    -1.60815012f, -0.587347388f, -0.499052584f, -2.44615221f,
+    -0.0523518026f, -0.752671838f, -0.60857302f, -0.055772014f,
+    0.170061633f, 0.220273525f, 0.0960386992f, -0.265788615f,
+    -0.531761229f, -0.277258784f, -0.00261779851f, 0.0334625952f,
+    0.306143433f, -0.000598454499f, -0.21488139f, -0.37742421f,
+    -0.13506645f, -0.445434719f, -2.08150244f, -0.00534891337f,
+    0.345502555f, -0.471184582f, -0.340391546f, -0.00604141504f,
+    -0.0400181413f, -1.28713679f, -0.315377057f, 0.0857165754f,
+    0.0163650718f, -0.190593958f, -1.07886004f, -2.01745892f,
+    -0.74865973f, -0.0175161324f, -0.0155236581f, -0.211485505f,
+    0.313953668f, 0.124091357f, 0.0722339079f, -0.198358163f,
+    -1.5055908f, 0.0402199887f, 0.270764172f, 0.104450315f,
+    0.22527644f, -0.0143190874f, -0.427433223f, -0.385999382f,
+    0.0733823702f, -0.0244026557f, -0.86560905f, -0.0335870422f,
+    -0.686814964f, -0.0403665788f, 0.179466411f, 0.104871437f,
+    -0.478850812f, -1.61948848f, -0.485253274f, -0.0966800079f,
+    -0.0964235365f, -0.08232034f, -0.200325608f, -0.605164409f,
+    -0.340329707f, -0.29026109f, -0.0882820562f, -0.0191951822f,
+    -0.0498587824f, -4.39986658f, -0.0263876356f, -0.163303092f,
+    -0.175967544f, -1.57971513f, -1.85880554f, -1.66149044f,
+    -0.222065285f, -0.132757753f, 0.309833467f, 0.0962235928f,
+    -0.15920049f, -0.137788281f, -0.486209989f, -0.228083447f,
+    -0.270276129f, -0.602926493f, -0.464286953f, -0.367458969f,
+    -0.192640081f, -0.353013426f, -0.0708767995f, -0.526164591f,
+    -0.703754306f, -0.634461462f, 0.139664337f, -0.0873177946f,
+    -0.707560718f, -0.397868663f, -0.241163373f, -0.663259208f,
+    -0.203204155f, 0.281263828f, 0.221008822f, -0.376472622f,
+    -0.0742177889f, -0.299891382f, -0.185433134f, -0.156277969f,
+    0.00418389961f, 0.0208648611f, -0.959604502f, 0.156730205f,
+    0.058577504f, -0.212827533f, -0.261035532f, -1.00325441f,
+    -0.571664155f, -0.215529278f, 0.0541222803f, 0.142504692f,
+    0.0131956683f, 0.0176114328f, -0.142255574f, -0.52731508f,
+    -0.317658693f, -0.878121853f, -0.187211826f, -0.268086761f,
+    -1.66390324f, -0.401344687f, -0.686874926f, 0.0918956324f,
+    0.0772961006f, -0.356250942f, -0.201268181f, -0.502911806f,
+    -0.0556333549f, -0.50046438f, -0.164100111f, -0.527263343f,
+    -0.206685364f, -0.261882216f, -0.125198931f, -0.396659076f,
+    -0.110454403f, -0.102738179f, -0.159161776f, -0.384500414f,
+    0.247820362f, 0.0373979546f, -0.295791328f, -0.177186951f,
+    0.00783104077f, -0.209945589f, -1.46041393f, -2.27379608f,
+    -0.865826368f, -0.0384730175f, 0.0137962867f, -0.85555011f,
+    0.290604949f, 0.0485265255f, 0.121253371f, -0.352128029f,
+    -0.916811407f, 0.245665625f, 0.219418526f, 0.0853822604f,
+    0.125348225f, 0.0223074816f, -0.191738829f, -0.465686321f,
+    -0.0671269074f, -0.456192344f, -0.126626343f, 0.0476311222f,
+    -0.0650417507f, -0.94411695f, -0.63148129f, -0.226344019f,
+    -0.631050289f, 0.00346213533f, 0.0855070427f, -0.061627049f,
+    -0.00667423056f, -0.0879895538f, -0.599941373f, -0.497273445f,
+    -0.787787259f, -0.976796627f, -0.0881669149f, -0.0534513853f,
+    0.0974881724f, 0.226740763f, -0.332049161f, 0.190165251f,
+    -0.0124077713f, -0.108686365f, -0.777752936f, -0.72025907f,
+    -0.471427619f, -0.215629682f, -0.094146587f, -0.0203865319f,
+    -0.664082885f, -0.39742738f, -0.888549507f, -1.48928559f,
+    -0.483865678f, -0.319919825f, -0.121558078f, -0.0539569408f,
+    -2.27531052f, -0.225264579f, -0.154479533f, -0.0626557991f,
+    0.148812279f, 0.00339913485f, 9.30594688e-05f, -1.36146498f,
+    -4.28686619f, -6.31585932f, -3.58844137f, -0.51668483f,
+    -0.0203458332f, -0.499324352f, -0.550122559f, -0.422787994f,
+    -0.909892976f, -0.817323089f, -0.618351161f, 0.000838531647f,
+    -0.203801513f, -0.420329124f, -0.0502007343f, -0.0429724529f,
+    0.256966382f, -1.78366244f, 0.000251185935f, -0.12644805f,
+    -0.27011779f, 0.00933449157f, -0.254521698f, -5.71601152f,
+    -0.645964086f, -0.184591949f, -0.0113192033f, -0.431165665f,
+    -0.462817907f, -0.408686221f, -0.542566717f, -0.464296877f,
+    -0.376401216f, -0.339877397f, -0.136947766f, -0.566776097f,
+    -0.289892703f, -0.482296407f, -0.104537971f, 0.453048557f,
+    -0.00902069174f, -0.220991164f, -0.439264327f, -0.256862581f,
+    -0.804592907f, -1.2034657f, -0.0926468894f, -0.364050508f,
+    -2.73984146f, -0.54970789f, 0.0975965708f, -0.119495831f,
+    -0.470276892f, -1.43712807f, -0.14731504f, -0.164240271f,
+    -0.130710378f, -0.223766044f, -0.684467852f, -0.142317951f,
+    -0.0364580899f, 0.0943449661f, -0.552920401f, 0.0909928977f,
+    -0.515525818f, -0.399407655f, -0.287240863f, 0.136177927f,
+    0.0945864394f, -0.171015143f, -2.56917214f, -0.249128148f,
+    0.0462102406f, -0.198676869f, -0.211481646f, -0.547513247f,
+    -0.172108918f, 0.0683878362f, 0.240706608f, -0.437576354f,
+    -2.67707586f, -5.46688938f, -5.16597795f, -1.84788454f,
+    0.139458522f, 0.154795885f, 0.0559157133f, -0.53742075f,
+    -0.170684233f, -0.307928622f, -0.469077915f, 0.0121982824f,
+    -0.346207082f, -2.27635145f, -0.485194534f, -0.502301693f,
+    -1.97459495f, -0.6898036f, -0.0365520492f, 0.0550636649f,
+    0.144956812f, -0.100594372f, -0.227606401f, -0.25652048f,
+    -0.00493038073f, -0.194556028f, -0.340845346f, -0.256781042f,
+    -0.0150453905f, -0.00259507168f, -0.656647086f, -0.530094147f,
+    -1.29499483f, -0.767783582f, -0.540358841f, -0.239508182f,
+    -0.050663583f, -0.0664777905f, -0.570761085f, 0.0194549877f,
+    -0.292374164f, -0.549256206f, -0.0180042759f, -0.102997132f,
+    -0.0633537546f, -0.00303666969f, -2.58726096f, -0.450150698f,
+    -0.0208888389f, -0.230903491f, -1.00059664f, -0.739555597f,
+    -0.705890179f, -0.0523243584f, -0.0120474873f, -0.0700738057f,
+    -0.373771012f, -0.422119051f, -0.652796745f, -0.346374243f,
+    -0.489517301f, -0.0181924179f, -0.301109046f, -0.0318618007f,
+    -0.0877782255f, 0.182207108f, -0.08387959f, -0.603455722f,
+    0.0129231839f, -0.0205817781f, -0.121102065f, -1.65697169f,
+    -4.50933599f, -4.15419006f, -1.67375481f, -0.0635478646f,
+    -0.0198094342f, -0.427301943f, -0.697654366f, -0.200969875f,
+    -0.129533485f, -0.219585434f, -0.474694699f, -0.210377455f,
+    -0.24822332f, -0.902380884f, -0.215171218f, -0.157713071f,
+    -0.337976098f, -1.84768593f, -2.98280287f, -0.827745318f,
+    -0.00192932296f, 0.0166748706f, -0.716871977f, -0.807342231f,
+    -0.597921014f, -0.476085097f, -0.939766407f, -0.734429181f,
+    -0.163112968f, -0.33881706f, -0.336276084f, -0.32211113f,
+    -0.133932292f, -0.328496724f, 0.2051844f, 0.0846185163f,
+    0.0127624376f, -1.03502405f, -0.10293299f, -0.461747825f,
+    -1.40068197f, -0.000898085069f, 0.0448944494f, 0.135518655f,
+    -0.474403262f, -2.51454258f, -3.76588702f, -3.68789315f,
+    -1.4079262f, -0.0162052531f, -0.173436001f, -0.0936583653f,
+    0.086932689f, -0.124631211f, -0.209332928f, -0.281120896f,
+    0.00746222911f, -0.979508519f, -2.46553302f, -1.49300838f,
+    -3.01799321f, -4.01671219f, -0.260937184f, -0.0157144554f,
+    -0.311409324f, -0.786751628f, -0.0492454395f, 0.0467122383f,
+    -0.379429907f, 0.0385567471f, -0.0882788748f, -0.183264703f,
+    0.0267826989f, 0.0116518857f, 0.0699606165f, -0.721296489f,
+    -0.00851999689f, -0.0538158268f, -0.471952558f, -0.361936241f,
+    -0.29991135f, -0.960441172f, -4.62031984f, -1.14784086f,
+    -1.12519085f, -0.0216054115f, -0.0129954237f, -0.114712507f,
+    -0.185127228f, -0.291606516f, -0.180604726f, -0.205143511f,
+    -1.60410869f, -0.0106147956f, -0.0346228294f, -0.00583175477f,
+    -0.0718121305f, -0.134462088f, -0.491209209f, -1.73952472f,
+    -2.77302194f, -0.227035254f, -0.221871689f, -0.120862015f,
+    -0.0067737815f, -0.00272040744f, -0.32866478f, -0.770540893f,
+    -0.0333499499f, 0.365816593f, 0.319110632f, 0.334219187f,
+    0.373419732f, 0.184809864f, -0.0213707816f, -0.263461202f,
+    -0.324036032f, -0.218341202f, -0.154192165f, -0.202978f,
+    -0.0734307766f, -0.246059701f, -0.318106741f, -0.113412887f,
+    -0.119377181f, -0.0794536918f, -1.08411574f, -0.363867491f,
+    -1.66157055f, -2.18594861f, -1.66892076f, -3.63372064f,
+    -0.762924552f, 0.00260300143f, 0.0304768085f, -0.0493099466f,
+    -0.0150026213f, -0.0446209423f, -0.81733042f, -0.509542644f,
+    -0.077549845f, 0.389675438f, 0.136993617f, 0.256899536f,
+    -0.171217576f, -0.963555694f, -0.697128236f, 0.00415188028f,
+    0.200267166f, 0.0764289275f, -0.125519276f, -0.511229157f,
+    -0.373922169f, -0.450137258f, -0.290290833f, -0.550090253f,
+    -0.790768385f, -4.47113752f, 0.00785877462f, -0.204224348f,
+    -0.934925377f, -1.09823048f, -0.585264623f, -4.58537388f,
+    -0.140806273f, -1.19918025f, -0.0225439593f, 0.291666865f,
+    0.208975717f, -0.536910832f, -0.323162496f, -0.0642156675f,
+    -0.483015031f, -0.452613711f, -1.85740387f, -0.348772943f,
+    -0.126183927f, 0.0601061471f, -0.118234292f, -0.517155528f,
+    0.27591747f, 0.00488825189f, -0.5350613f, -2.92487741f,
+    -3.75873947f, -3.81311059f, -0.462751716f, -0.0233148783f,
+    -0.141441867f, -0.177786529f, -0.065496169f, -0.326086044f,
+    -0.869935751f, -0.465755492f, -0.135748148f, -0.10172911f,
+    0.114545301f, -0.431019723f, -0.283366263f, -0.369598538f,
+    -1.06507039f, -1.77984333f, -1.67489576f, -0.498463333f,
+    0.0223464128f, -0.311119884f, -0.276708812f, -0.111621603f,
+    0.207348451f, 0.0630794466f, 0.0810719281f, -0.381583899f,
+    0.231965065f, 0.138640732f, 0.223535717f, 0.273666054f,
+    0.369116932f, 0.233769029f, -0.00383920968f, -0.234311998f,
+    0.275854051f, -0.39866209f, -0.0686026737f, 0.0311087742f,
+    -0.274749339f, -1.16814852f, -0.529028356f, -0.223731518f,
+    -0.0213171989f, -0.100158475f, -0.355888903f, -0.298682332f,
+    -0.424250007f, -0.244955227f, -0.0483239293f, 0.0393986404f,
+    -0.367804945f, -0.814601421f, -0.877984881f, -0.112056881f,
+    0.0441809371f, -0.233177096f, -0.116436563f, -0.453390032f,
+};
+
+static const uint16_t mnist_snn_layer4_columns[1960] = {
+    16, 24, 32, 36, 44, 48, 60, 76, 84, 92, 96, 104,
+    112, 120, 124, 128, 132, 136, 140, 144, 148, 160, 204, 212,
+    216, 224, 236, 244, 252, 256, 260, 264, 272, 276, 284, 288,
+    300, 308, 316, 320, 324, 332, 336, 340, 344, 356, 360, 364,
+    368, 376, 384, 396, 404, 408, 412, 416, 420, 424, 428, 432,
+    448, 452, 456, 460, 464, 468, 472, 496, 500, 508, 512, 540,
+    544, 552, 560, 580, 584, 592, 600, 608, 620, 628, 636, 640,
+    652, 660, 672, 676, 680, 684, 688, 692, 708, 716, 724, 728,
+    732, 740, 744, 748, 752, 756, 760, 764, 768, 776, 780, 792,
+    796, 804, 812, 832, 836, 872, 880, 884, 888, 892, 900, 904,
+    908, 916, 920, 924, 928, 932, 936, 940, 948, 960, 968, 976,
+    980, 1004, 1016, 1024, 1032, 1048, 1056, 1064, 1072, 1076, 1080, 1084,
+    1088, 1120, 1124, 1128, 1132, 1168, 1176, 1180, 1188, 1200, 1216, 1220,
+    1232, 1240, 1244, 1248, 1260, 1264, 1268, 1296, 1304, 1312, 1320, 1324,
+    1328, 1332, 1340, 1356, 1360, 1364, 1380, 1384, 1388, 1392, 1400, 1404,
+    1412, 1420, 1424, 1432, 1444, 1448, 1456, 1464, 1484, 1488, 1508, 1512,
+    1520, 1524, 1544, 1560, 16, 20, 24, 28, 36, 44, 56, 64,
+    68, 76, 92, 96, 100, 104, 116, 120, 124, 128, 132, 168,
+    172, 176, 180, 204, 208, 212, 216, 220, 224, 228, 252, 256,
+    260, 264, 268, 272, 296, 300, 308, 312, 316, 320, 328, 332,
+    348, 356, 360, 364, 368, 376, 380, 384, 396, 400, 408, 412,
+    416, 420, 424, 444, 448, 452, 456, 460, 464, 468, 472, 476,
+    504, 512, 516, 544, 552, 560, 564, 572, 584, 600, 620, 636,
+    644, 656, 664, 668, 680, 692, 700, 704, 708, 712, 716, 720,
+    744, 748, 752, 756, 760, 768, 776, 792, 796, 800, 804, 808,
+    812, 816, 824, 844, 852, 860, 864, 868, 872, 884, 888, 892,
+    896, 900, 904, 908, 916, 924, 944, 948, 952, 956, 960, 988,
+    996, 1000, 1004, 1008, 1012, 1024, 1048, 1052, 1056, 1060, 1100, 1104,
+    1108, 1112, 1116, 1128, 1132, 1140, 1144, 1148, 1152, 1176, 1180, 1196,
+    1200, 1204, 1208, 1220, 1240, 1244, 1248, 1252, 1256, 1284, 1288, 1296,
+    1300, 1304, 1332, 1336, 1344, 1348, 1364, 1380, 1384, 1388, 1392, 1396,
+    1400, 1404, 1412, 1420, 1428, 1436, 1440, 1444, 1448, 1452, 1456, 1460,
+    1464, 1472, 1492, 1496, 1500, 1504, 1536, 1552, 12, 16, 20, 32,
+    36, 44, 60, 92, 96, 104, 112, 116, 120, 124, 132, 136,
+    140, 144, 168, 204, 220, 224, 228, 232, 236, 252, 256, 268,
+    272, 276, 280, 288, 308, 312, 320, 324, 328, 332, 336, 340,
+    344, 348, 356, 360, 372, 376, 384, 388, 396, 404, 408, 412,
+    416, 420, 424, 428, 432, 436, 444, 448, 452, 456, 460, 464,
+    468, 472, 476, 480, 500, 508, 512, 532, 544, 556, 560, 568,
+    572, 580, 584, 592, 620, 624, 628, 636, 640, 644, 648, 652,
+    656, 668, 672, 680, 696, 708, 724, 728, 732, 736, 740, 744,
+    748, 752, 756, 760, 768, 776, 796, 804, 816, 820, 824, 844,
+    852, 872, 892, 900, 916, 920, 924, 932, 944, 948, 952, 956,
+    960, 972, 976, 1000, 1012, 1028, 1032, 1044, 1048, 1052, 1060, 1072,
+    1080, 1088, 1096, 1100, 1116, 1120, 1124, 1156, 1160, 1168, 1176, 1180,
+    1200, 1204, 1208, 1212, 1216, 1220, 1232, 1236, 1240, 1244, 1248, 1256,
+    1260, 1268, 1292, 1296, 1304, 1308, 1312, 1316, 1324, 1332, 1352, 1360,
+    1364, 1368, 1384, 1388, 1392, 1396, 1404, 1412, 1420, 1424, 1432, 1440,
+    1456, 1464, 1472, 1484, 1488, 1492, 1508, 1516, 1532, 1536, 1540, 1560,
+    12, 16, 20, 24, 32, 44, 52, 60, 68, 104, 112, 116,
+    120, 136, 144, 188, 196, 204, 212, 224, 256, 260, 268, 276,
+    284, 308, 312, 320, 332, 336, 340, 348, 352, 356, 360, 364,
+    368, 372, 376, 380, 388, 396, 404, 412, 420, 424, 432, 436,
+    444, 452, 460, 468, 472, 476, 480, 500, 508, 516, 520, 540,
+    544, 548, 552, 556, 560, 564, 568, 572, 580, 584, 592, 636,
+    640, 644, 648, 652, 656, 660, 664, 668, 672, 680, 688, 696,
+    700, 704, 712, 720, 728, 736, 740, 744, 748, 752, 760, 764,
+    768, 776, 780, 796, 800, 804, 808, 816, 824, 832, 844, 852,
+    860, 880, 892, 900, 908, 916, 920, 932, 940, 948, 952, 968,
+    972, 976, 980, 1000, 1024, 1032, 1044, 1056, 1060, 1064, 1072, 1080,
+    1088, 1096, 1104, 1108, 1112, 1120, 1132, 1140, 1144, 1176, 1180, 1188,
+    1192, 1196, 1200, 1204, 1208, 1220, 1232, 1236, 1240, 1244, 1248, 1256,
+    1264, 1268, 1288, 1292, 1296, 1300, 1304, 1308, 1324, 1328, 1332, 1340,
+    1348, 1352, 1356, 1364, 1380, 1384, 1388, 1392, 1400, 1404, 1412, 1420,
+    1424, 1428, 1432, 1436, 1440, 1444, 1448, 1456, 1464, 1472, 1484, 1496,
+    1524, 1536, 1552, 1560, 0, 4, 12, 16, 32, 36, 44, 48,
+    52, 68, 72, 84, 92, 100, 108, 112, 116, 124, 132, 136,
+    144, 148, 160, 164, 168, 180, 196, 204, 212, 220, 228, 236,
+    248, 252, 256, 260, 264, 268, 276, 280, 284, 296, 320, 328,
+    336, 340, 344, 348, 352, 364, 372, 376, 380, 384, 388, 392,
+    408, 412, 416, 420, 424, 428, 444, 448, 452, 456, 460, 464,
+    476, 492, 500, 520, 532, 540, 544, 560, 564, 572, 588, 592,
+    608, 628, 636, 640, 644, 652, 660, 668, 680, 684, 688, 692,
+    696, 704, 720, 724, 740, 744, 748, 752, 760, 764, 776, 792,
+    796, 800, 816, 824, 836, 844, 848, 868, 872, 884, 892, 896,
+    900, 916, 920, 924, 928, 932, 948, 964, 976, 980, 1004, 1012,
+    1016, 1028, 1032, 1036, 1040, 1044, 1056, 1060, 1072, 1080, 1084, 1088,
+    1104, 1128, 1132, 1168, 1176, 1180, 1192, 1196, 1208, 1220, 1248, 1260,
+    1288, 1292, 1304, 1308, 1312, 1320, 1324, 1332, 1340, 1344, 1348, 1352,
+    1356, 1364, 1368, 1380, 1384, 1388, 1392, 1396, 1408, 1412, 1420, 1424,
+    1436, 1440, 1444, 1452, 1456, 1464, 1472, 1484, 1492, 1504, 1508, 1520,
+    1524, 1528, 1532, 1536, 1552, 1556, 1560, 1564, 8, 20, 24, 28,
+    36, 44, 48, 52, 56, 60, 68, 72, 76, 84, 112, 120,
+    132, 144, 148, 156, 196, 204, 208, 212, 236, 244, 248, 252,
+    256, 260, 264, 272, 284, 288, 300, 308, 336, 340, 344, 352,
+    356, 360, 364, 368, 372, 376, 380, 384, 392, 404, 408, 420,
+    424, 432, 436, 448, 452, 456, 468, 472, 476, 512, 516, 520,
+    540, 544, 560, 564, 568, 572, 588, 592, 600, 608, 616, 636,
+    640, 644, 648, 652, 656, 660, 664, 672, 680, 684, 688, 692,
+    696, 700, 704, 712, 724, 728, 740, 744, 748, 752, 760, 764,
+    768, 776, 796, 800, 808, 816, 824, 832, 840, 844, 852, 868,
+    880, 888, 892, 896, 900, 908, 916, 920, 932, 940, 948, 960,
+    968, 976, 980, 988, 996, 1024, 1028, 1032, 1036, 1040, 1044, 1048,
+    1056, 1064, 1072, 1080, 1084, 1092, 1096, 1100, 1104, 1120, 1128, 1136,
+    1192, 1200, 1204, 1216, 1232, 1236, 1240, 1244, 1248, 1252, 1260, 1264,
+    1268, 1276, 1284, 1296, 1304, 1308, 1316, 1332, 1340, 1344, 1348, 1356,
+    1360, 1364, 1380, 1384, 1388, 1392, 1396, 1404, 1412, 1416, 1420, 1436,
+    1440, 1444, 1448, 1456, 1464, 1472, 1476, 1480, 1484, 1520, 1524, 1532,
+    8, 16, 44, 60, 64, 76, 92, 96, 104, 108, 112, 132,
+    136, 168, 172, 176, 180, 188, 196, 212, 216, 224, 228, 236,
+    240, 252, 256, 260, 264, 268, 272, 284, 288, 300, 308, 312,
+    320, 328, 332, 336, 340, 356, 360, 368, 376, 384, 388, 396,
+    400, 404, 408, 412, 416, 420, 424, 428, 432, 448, 452, 456,
+    460, 472, 476, 508, 516, 524, 528, 532, 540, 544, 560, 572,
+    580, 584, 600, 608, 616, 620, 628, 636, 640, 644, 648, 652,
+    656, 672, 676, 680, 688, 696, 704, 708, 720, 724, 728, 732,
+    736, 740, 744, 748, 752, 756, 760, 764, 768, 776, 780, 796,
+    804, 812, 816, 824, 832, 844, 848, 852, 856, 860, 868, 876,
+    880, 900, 904, 908, 916, 920, 924, 932, 940, 948, 960, 964,
+    968, 972, 976, 980, 988, 996, 1004, 1016, 1024, 1044, 1056, 1072,
+    1076, 1080, 1096, 1100, 1108, 1120, 1124, 1144, 1168, 1188, 1216, 1220,
+    1232, 1240, 1248, 1260, 1264, 1268, 1316, 1320, 1324, 1332, 1340, 1344,
+    1352, 1356, 1360, 1364, 1380, 1384, 1388, 1392, 1396, 1400, 1404, 1412,
+    1420, 1424, 1428, 1440, 1444, 1456, 1464, 1472, 1496, 1512, 1516, 1524,
+    1536, 1544, 1560, 1564, 0, 4, 12, 16, 20, 24, 28, 32,
+    36, 48, 52, 60, 64, 72, 76, 88, 100, 104, 108, 112,
+    120, 124, 128, 132, 136, 140, 148, 156, 160, 172, 176, 180,
+    188, 204, 208, 224, 228, 232, 248, 276, 280, 284, 296, 300,
+    304, 308, 316, 320, 324, 328, 332, 344, 348, 356, 368, 376,
+    380, 388, 392, 396, 404, 412, 420, 424, 428, 432, 436, 444,
+    452, 472, 476, 480, 496, 500, 504, 508, 520, 524, 528, 532,
+    540, 544, 548, 552, 572, 588, 592, 620, 628, 636, 644, 648,
+    660, 668, 676, 684, 688, 696, 720, 744, 748, 752, 756, 768,
+    772, 776, 792, 796, 800, 812, 816, 820, 824, 832, 844, 848,
+    868, 872, 880, 884, 892, 896, 904, 908, 916, 920, 924, 940,
+    948, 952, 956, 960, 964, 980, 988, 992, 1012, 1028, 1032, 1040,
+    1068, 1080, 1084, 1088, 1092, 1096, 1100, 1104, 1112, 1116, 1128, 1132,
+    1140, 1168, 1176, 1180, 1188, 1200, 1232, 1236, 1244, 1248, 1256, 1284,
+    1288, 1308, 1324, 1328, 1332, 1340, 1344, 1352, 1380, 1384, 1388, 1392,
+    1396, 1400, 1408, 1412, 1416, 1420, 1424, 1432, 1444, 1472, 1488, 1492,
+    1496, 1500, 1504, 1532, 1552, 1556, 1560, 1564, 8, 16, 20, 36,
+    44, 48, 68, 76, 84, 96, 112, 124, 132, 136, 140, 144,
+    148, 152, 160, 168, 172, 180, 196, 204, 216, 224, 228, 232,
+    236, 252, 268, 272, 276, 288, 300, 308, 312, 316, 320, 328,
+    332, 340, 344, 348, 364, 368, 376, 384, 396, 404, 408, 412,
+    416, 420, 424, 428, 432, 436, 448, 452, 456, 464, 468, 472,
+    476, 480, 520, 528, 532, 540, 544, 564, 568, 572, 580, 588,
+    592, 616, 620, 628, 636, 640, 644, 648, 660, 680, 684, 688,
+    704, 712, 720, 724, 728, 732, 736, 740, 744, 748, 756, 760,
+    764, 768, 776, 812, 824, 832, 836, 840, 860, 872, 880, 884,
+    888, 900, 908, 916, 920, 924, 932, 968, 972, 976, 980, 984,
+    1008, 1028, 1032, 1036, 1056, 1064, 1072, 1076, 1080, 1088, 1100, 1108,
+    1112, 1120, 1128, 1168, 1176, 1180, 1192, 1200, 1204, 1208, 1216, 1220,
+    1232, 1248, 1256, 1264, 1268, 1288, 1296, 1304, 1308, 1324, 1332, 1340,
+    1344, 1348, 1352, 1360, 1364, 1368, 1380, 1384, 1388, 1392, 1396, 1404,
+    1412, 1420, 1424, 1432, 1436, 1440, 1444, 1448, 1452, 1456, 1464, 1468,
+    1472, 1476, 1484, 1492, 1496, 1504, 1508, 1516, 1520, 1524, 1552, 1560,
+    0, 4, 8, 16, 20, 24, 32, 36, 48, 52, 56, 60,
+    76, 84, 100, 104, 112, 120, 124, 128, 132, 148, 152, 160,
+    168, 176, 180, 188, 204, 208, 212, 220, 236, 244, 248, 252,
+    260, 268, 272, 276, 292, 296, 300, 304, 308, 316, 320, 324,
+    328, 344, 348, 352, 356, 360, 368, 372, 376, 380, 388, 392,
+    396, 400, 404, 412, 416, 420, 424, 428, 436, 440, 444, 448,
+    452, 460, 468, 472, 476, 500, 508, 512, 540, 544, 548, 552,
+    556, 568, 572, 580, 588, 592, 628, 636, 640, 644, 648, 672,
+    684, 688, 692, 696, 704, 720, 740, 744, 748, 752, 756, 760,
+    768, 792, 796, 816, 824, 840, 844, 864, 872, 884, 892, 900,
+    908, 916, 920, 924, 936, 940, 948, 956, 964, 980, 984, 988,
+    992, 1012, 1028, 1032, 1036, 1040, 1064, 1080, 1084, 1088, 1096, 1100,
+    1104, 1112, 1128, 1132, 1144, 1176, 1180, 1188, 1196, 1200, 1208, 1232,
+    1236, 1240, 1244, 1248, 1260, 1280, 1288, 1296, 1300, 1304, 1308, 1324,
+    1328, 1332, 1336, 1340, 1344, 1352, 1380, 1384, 1392, 1396, 1404, 1408,
+    1420, 1424, 1428, 1432, 1444, 1472, 1476, 1480, 1484, 1492, 1500, 1504,
+    1520, 1532, 1552, 1556,
+};
+
+static const uint32_t mnist_snn_layer4_row_starts[11] = {
+    0, 196, 392, 588, 784, 980, 1176, 1372,
+    1568, 1764, 1960,
+};
+
+// One entry per layer; dense layers have none
+static const SNNSparseWeights mnist_snn_sparse[5] = {
+    { NULL, NULL, NULL },
+    { NULL, NULL, NULL },
+    { NULL, NULL, NULL },
+    { NULL, NULL, NULL },
+    { mnist_snn_layer4_values, mnist_snn_layer4_columns, mnist_snn_layer4_row_starts },
+};
+
+#endif // MNIST_SNN_SPARSE_H
@@ -0,0 +1,2135 @@
+// Generated by snn_core/Tools/snn_winograd from the mnist_snn weights.
+// Regenerate with the snn_winograd_headers target after retraining the model.
+#ifndef MNIST_SNN_WINOGRAD_H
+#define MNIST_SNN_WINOGRAD_H
+
+#include <stddef.h>
+
+static const float mnist_snn_layer0_winograd[256] = {
+    -0.0582028627f, -0.211140096f, -0.0624082908f, -0.215345532f,
+    -0.0478852615f, -0.19527255f, 0.00451166928f, -0.142875612f,
+    0.0656591207f, -0.0490678847f, 0.0126759596f, -0.102051042f,
+    0.0759767145f, -0.0332003273f, 0.0795959309f, -0.0295811146f,
+    0.57974726f, 0.698826671f, 0.417988539f, 0.53706795f,
+    0.228952467f, 0.514499426f, 0.0302802771f, 0.315827221f,
+    0.272577465f, 0.282624066f, 0.170113683f, 0.180160299f,
+    -0.0782173127f, 0.0982968062f, -0.217594549f, -0.0410804376f,
+    -0.23171404f, -0.437516242f, -0.303776443f, -0.509578645f,
+    -0.323150128f, -0.483214498f, -0.350323409f, -0.510387778f,
+    -0.123444937f, -0.049609676f, -0.0572480485f, 0.0165872164f,
+    -0.214881018f, -0.0953079611f, -0.103795007f, 0.0157780442f,
+    -0.00804604497f, -0.345323563f, -0.174074501f, -0.511352003f,
+    -0.139998019f, -0.358658582f, -0.14913401f, -0.367794573f,
+    0.064919576f, -0.0916185901f, 0.230525315f, 0.0739871413f,
+    -0.0670324042f, -0.104953617f, 0.255465806f, 0.217544585f,
+    0.236021042f, 0.00420173258f, 0.363361299f, 0.131541982f,
+    0.31796822f, 0.102314785f, 0.369737953f, 0.154084504f,
+    0.285951972f, 0.210337311f, 0.27108869f, 0.195474029f,
+    0.36789915f, 0.308450371f, 0.277465343f, 0.21801655f,
+    -0.247869328f, -0.324577212f, -0.160726741f, -0.237434626f,
+    -0.260301739f, -0.285184771f, -0.169141799f, -0.194024831f,
+    0.0750222206f, -0.126005262f, 0.0629053414f, -0.138122141f,
+    0.0625898093f, -0.0866128206f, 0.0544902831f, -0.0947123468f,
+    0.236422941f, 0.0707410201f, -0.0183965787f, -0.1840785f,
+    0.328282237f, 0.0740910321f, -0.112473711f, -0.366664916f,
+    0.252918869f, 0.0641115978f, 0.0501214564f, -0.138685808f,
+    0.34477815f, 0.0674616098f, -0.0439556837f, -0.321272224f,
+    -0.446085066f, -0.357842207f, 0.102145486f, 0.190388337f,
+    -0.443155855f, -0.162758723f, 0.00133623183f, 0.281733364f,
+    -0.111613318f, 0.0973874331f, -0.0847321227f, 0.124268636f,
+    -0.10868413f, 0.292470902f, -0.185541391f, 0.215613648f,
+    -0.848082423f, -0.732677221f, -0.204391629f, -0.0889863819f,
+    -0.235974371f, -0.0822501332f, 0.0774907619f, 0.231215f,
+    -0.0710459352f, -0.206609696f, 0.115792274f, -0.0197714865f,
+    0.541062117f, 0.443817347f, 0.39767465f, 0.300429881f,
+    -0.0273422599f, 0.175982133f, 0.19579421f, 0.399118602f,
+    0.0575250424f, 0.172702253f, -0.0831562877f, 0.0320209265f,
+    0.155082241f, 0.169943959f, 0.315905988f, 0.330767721f,
+    0.239949539f, 0.166664079f, 0.0369554982f, -0.0363299511f,
+    0.213131115f, -0.154753551f, -0.307237178f, -0.675121844f,
+    0.257429153f, 0.130906552f, 0.113146812f, -0.0133758038f,
+    0.112093046f, -0.0298463404f, -0.192144036f, -0.334083438f,
+    0.156391099f, 0.255813748f, 0.228239939f, 0.327662587f,
+    0.252131701f, 0.468163252f, 0.343044221f, 0.559075773f,
+    0.0379954427f, 0.129517466f, 0.41038695f, 0.501908958f,
+    -0.20191291f, 0.042017512f, 0.021503754f, 0.265434176f,
+    -0.416049153f, -0.296628296f, 0.0888464823f, 0.208267346f,
+    0.197394669f, 0.259981513f, 0.32866621f, 0.391253054f,
+    0.170374587f, 0.303497136f, 0.31727919f, 0.450401723f,
+    0.194226757f, 0.269964665f, -0.0250393916f, 0.0506985299f,
+    0.167206675f, 0.313480258f, -0.0364263989f, 0.10984721f,
+    0.146725476f, 0.0244626254f, 0.191181019f, 0.0689181685f,
+    0.367400229f, 0.118472084f, 0.245991677f, -0.00293647498f,
+    -0.0578631461f, 0.255705476f, -0.0480342954f, 0.265534341f,
+    0.162811607f, 0.349714935f, 0.00677637011f, 0.193679705f,
+    -0.185045972f, 0.150406897f, 0.166668162f, 0.502121031f,
+    -0.232265949f, -0.110987648f, 0.189222246f, 0.310500532f,
+    -0.201463073f, -0.0442715287f, -0.0641846359f, 0.0930069089f,
+    -0.24868305f, -0.305666059f, -0.0416305549f, -0.0986135826f,
+    0.0936356634f, -0.384908557f, -0.0303407013f, -0.508884907f,
+    0.293213278f, 0.027368173f, 0.0779679865f, -0.187877119f,
+    0.0418616086f, -0.175537407f, 0.132196397f, -0.0852026269f,
+    0.241439208f, 0.236739308f, 0.24050504f, 0.235805139f,
+};
+
+static const float mnist_snn_layer2_winograd[8192] = {
+    -0.0683784112f, -0.0483389646f, -0.0689357594f, -0.0488963127f,
+    -0.0692702979f, -0.0274785161f, -0.0407524556f, 0.00103932747f,
+    -0.045274552f, -0.0742885917f, -0.0207479019f, -0.0497619435f,
+    -0.0461664423f, -0.053428147f, 0.00743540144f, 0.000173697874f,
+    0.222214758f, 0.0937148333f, 0.171387494f, 0.0428875573f,
+    0.0724318698f, -0.00314288773f, 0.0829862654f, 0.00741151348f,
+    0.108477868f, 0.0663427487f, 0.0983213037f, 0.0561861843f,
+    -0.0413050167f, -0.0305149723f, 0.00992009416f, 0.0207101367f,
+    -0.0562359095f, 0.019886218f, 0.00277855247f, 0.0789006799f,
+    0.00712371431f, 0.00695103221f, 0.0564261824f, 0.0562534966f,
+    0.00184823759f, 0.0622045062f, 0.0382961258f, 0.0986523926f,
+    0.0652078614f, 0.0492693186f, 0.0919437483f, 0.0760052055f,
+    -0.0526313782f, -0.02675041f, -0.0616417602f, -0.0357607901f,
+    -0.0233600996f, 0.0372821912f, -0.027595412f, 0.0330468789f,
+    -0.0513007008f, -0.0272235461f, -0.0167848393f, 0.00729231536f,
+    -0.0220294204f, 0.036809057f, 0.0172615051f, 0.0760999843f,
+    -0.0295131579f, 0.0207756944f, -0.0154126622f, 0.0348761901f,
+    0.0429596752f, 0.107574791f, -0.0424474329f, 0.0221676808f,
+    -0.0114808772f, 0.0233356319f, 0.0306303091f, 0.0654468164f,
+    0.0609919541f, 0.110134728f, 0.00359553099f, 0.0527383052f,
+    0.0253863335f, -0.0113416314f, -0.0356523097f, -0.0723802745f,
+    -0.0237905793f, -0.020263711f, -0.0168255959f, -0.0132987285f,
+    0.0267652385f, 0.0187842473f, -0.0480766073f, -0.0560576022f,
+    -0.0224116743f, 0.00986216497f, -0.0292498972f, 0.00302394247f,
+    0.01010051f, 0.0170912258f, 0.0197546836f, 0.0267453995f,
+    -0.0602670684f, -0.0375038162f, -0.0349920839f, -0.0122288279f,
+    -0.0566971861f, -0.0798246115f, -0.043480292f, -0.0666077137f,
+    -0.127064764f, -0.13441965f, -0.0982270539f, -0.105581939f,
+    0.119085334f, 0.217278257f, 0.0121999681f, 0.110392891f,
+    0.0587192923f, 0.0935296118f, -0.0326631069f, 0.00214721262f,
+    0.0231400933f, -0.00986567885f, -0.0463338904f, -0.0793396607f,
+    -0.0372259505f, -0.133614331f, -0.0911969692f, -0.187585339f,
+    -0.041986227f, 0.053938821f, -0.0506836846f, 0.0452413671f,
+    -0.23809737f, 0.0178364217f, -0.119857728f, 0.136076063f,
+    0.0415365919f, 0.0904317498f, 0.00133663788f, 0.050231792f,
+    -0.154574558f, 0.054329332f, -0.0678374097f, 0.141066477f,
+    0.270999044f, 0.172896549f, 0.145059511f, 0.0469570123f,
+    0.159979925f, 0.135070458f, 0.12296693f, 0.0980574638f,
+    0.0671286434f, 0.0576883964f, 0.0296670534f, 0.0202268083f,
+    -0.0438904762f, 0.0198623165f, 0.00757446885f, 0.0713272616f,
+    0.0530873761f, 0.0296980161f, 0.039946489f, 0.016557131f,
+    0.176085398f, 0.171759859f, 0.0346193798f, 0.0302938465f,
+    0.0117183365f, -0.0174107254f, 0.068005234f, 0.0388761759f,
+    0.134716362f, 0.124651134f, 0.0626781285f, 0.0526128933f,
+    -0.1767717f, -0.0660016462f, -0.0731719509f, 0.0375981033f,
+    -0.0506416932f, 0.01261428f, -0.0413426906f, 0.0219132826f,
+    0.0123588815f, 0.082057789f, 0.0382397994f, 0.107938707f,
+    0.138488889f, 0.160673723f, 0.0700690597f, 0.0922538862f,
+    0.0478738919f, 0.0267759617f, -0.0191827361f, -0.0402806662f,
+    0.0389577001f, 0.0365653411f, 0.00475896336f, 0.00236660615f,
+    -0.0102941077f, 0.00738242362f, 0.0207997039f, 0.0384762362f,
+    -0.0192102976f, 0.0171718057f, 0.044741407f, 0.0811235085f,
+    -0.0255380906f, -0.0345286839f, 0.0625079274f, 0.0535173342f,
+    0.30192402f, 0.247229025f, 0.0968912467f, 0.042196244f,
+    0.0751229376f, -0.00682308152f, 0.124960974f, 0.0430149511f,
+    0.402585059f, 0.274934649f, 0.159344301f, 0.0316938646f,
+    -0.0461793318f, -0.00332105067f, -0.031716615f, 0.011141669f,
+    -0.0289585814f, 0.0657459348f, 0.0516332015f, 0.146337718f,
+    0.00534409937f, -0.0288148001f, 0.0604562238f, 0.0262973234f,
+    0.0225648489f, 0.0402521789f, 0.14380604f, 0.161493361f,
+    -0.274967521f, -0.162885383f, -0.109402038f, 0.00268009421f,
+    -0.101072639f, -0.0549825504f, -0.080538325f, -0.0344482362f,
+    -0.056259539f, -0.0440430678f, 0.065612793f, 0.0778292641f,
+    0.117635347f, 0.0638597757f, 0.0944764987f, 0.0407009311f,
+    0.00652513932f, -0.0292185005f, 0.0179742035f, -0.0177694373f,
+    0.0103241056f, -0.0256443974f, 0.0590387732f, 0.0230702721f,
+    -0.0360226296f, -0.0263950881f, -0.0248912331f, -0.0152636925f,
+    -0.0322236642f, -0.0228209831f, 0.0161733367f, 0.0255760159f,
+    0.0735527799f, -0.0445645824f, 0.0418954939f, -0.0762218684f,
+    0.190566003f, 0.181888312f, 0.00373688154f, -0.00494081154f,
+    0.100290671f, 0.111195549f, 0.0412128568f, 0.0521177351f,
+    0.217303887f, 0.337648422f, 0.00305424258f, 0.123398788f,
+    -0.0466580801f, -0.0225568078f, 0.00145414937f, 0.0255554225f,
+    -0.0256901048f, -0.0743419752f, -0.0148155428f, -0.0634674132f,
+    -0.000674094073f, 0.0166769121f, -0.00350746512f, 0.0138435401f,
+    0.0202938821f, -0.0351082571f, -0.0197771564f, -0.0751792938f,
+    0.042589657f, 0.044539392f, 0.0416434035f, 0.0435931385f,
+    -0.0203693118f, -0.00921158679f, 0.0179983862f, 0.0291561112f,
+    0.0586608686f, -0.00643413886f, 0.0120817795f, -0.0530132279f,
+    -0.00429810118f, -0.0601851195f, -0.0115632359f, -0.0674502552f,
+    -0.0866172686f, 0.0335691758f, 0.026408691f, 0.146595135f,
+    -0.0629838333f, -0.0180542916f, 0.0781046078f, 0.123034149f,
+    -0.109003589f, 0.0310000442f, -0.0414786786f, 0.0985249579f,
+    -0.0853701606f, -0.0206234343f, 0.0102172364f, 0.0749639645f,
+    0.0761916488f, 0.0471481793f, 0.0217527878f, -0.00729068136f,
+    0.0443407595f, 0.0487806238f, -0.0352615677f, -0.0308217034f,
+    0.0545985103f, 0.00379436091f, -0.00592811033f, -0.0567322597f,
+    0.0227476172f, 0.00542680547f, -0.0629424676f, -0.0802632794f,
+    -0.0593939498f, -0.032744348f, -0.0230081417f, 0.00364146079f,
+    -0.131297052f, -0.113339268f, 0.0596090406f, 0.0775668174f,
+    -0.103748769f, -0.165744364f, -0.0643750802f, -0.126370668f,
+    -0.175651863f, -0.246339276f, 0.0182421021f, -0.0524453148f,
+    0.0698485598f, 0.0176044777f, -0.145505011f, -0.197749093f,
+    0.000150162727f, -0.0412292555f, -0.104009755f, -0.145389169f,
+    0.042741321f, 0.0414698347f, -0.0871480554f, -0.0884195417f,
+    -0.026957076f, -0.0173638947f, -0.0456527993f, -0.036059618f,
+    -0.21023351f, -0.0882768407f, -0.136224329f, -0.0142676579f,
+    -0.205426112f, -0.24827525f, -0.16805847f, -0.210907608f,
+    -0.297009408f, -0.2959373f, -0.205892324f, -0.204820231f,
+    -0.292202026f, -0.455935717f, -0.23772648f, -0.401460171f,
+    0.0624985509f, -0.0536625832f, -0.12046165f, -0.236622781f,
+    -0.201536864f, -0.250649482f, -0.0678458512f, -0.116958477f,
+    -0.206580192f, -0.0997283012f, -0.0578574799f, 0.0489944145f,
+    -0.470615596f, -0.2967152f, -0.00524168462f, 0.168658718f,
+    -0.120760344f, 0.146042585f, -0.0383656174f, 0.228437304f,
+    -0.12170282f, -0.178906783f, -0.0525652803f, -0.109769247f,
+    -0.165411055f, -0.0218217075f, -0.00988957286f, 0.133699775f,
+    -0.166353539f, -0.346771061f, -0.0240892321f, -0.20450677f,
+    -0.182172254f, -0.249636307f, -0.121833287f, -0.189297348f,
+    0.128641874f, 0.102274224f, -0.00341783836f, -0.0297854841f,
+    -0.0525543243f, -0.0314464085f, -0.0449869074f, -0.0238789916f,
+    0.258259803f, 0.320464134f, 0.0734285414f, 0.135632873f,
+    -0.0441055074f, 0.0171083789f, -0.0572158433f, 0.00399804395f,
+    -0.00958261639f, 0.0400160104f, 0.0123181846f, 0.0619168133f,
+    -0.18218413f, -0.120705895f, -0.0822498426f, -0.0207716078f,
+    -0.147661224f, -0.0977982581f, -0.0127158053f, 0.0371471643f,
+    -0.0131613016f, -0.0283831768f, 0.041548606f, 0.0263267308f,
+    -0.0637176633f, -0.120690361f, -0.126583382f, -0.18355608f,
+    0.0267857388f, -0.0549889393f, 0.0622780956f, -0.0194965824f,
+    -0.0237706248f, -0.147296131f, -0.1058539f, -0.229379401f,
+    -0.00617125863f, -0.0321966037f, 0.0657328516f, 0.0397075005f,
+    -0.0132667758f, -0.00351026654f, 0.0506422073f, 0.0603987128f,
+    -1.41942874e-05f, -0.00723611983f, -0.00928679481f, -0.0165087208f,
+    -0.00710971141f, 0.021450216f, -0.0243774373f, 0.00418249145f,
+    0.016896354f, -0.0253223442f, 0.121532708f, 0.0793140158f,
+    -0.0236995015f, -0.035935685f, 0.077367194f, 0.0651310086f,
+    0.0120055499f, -0.000608932227f, 0.0928549469f, 0.0802404583f,
+    -0.0285903048f, -0.0112222731f, 0.0486894213f, 0.0660574511f,
+    0.0213877968f, -0.04135672f, 0.00573218428f, -0.0570123307f,
+    0.0114058331f, 0.00302976184f, -0.0204708409f, -0.0288469121f,
+    -0.0598105043f, -0.0266431384f, 0.013092991f, 0.0462603569f,
+    -0.0697924644f, 0.0177433398f, -0.0131100342f, 0.0744257718f,
+    -0.0179593675f, -0.27462554f, -0.0769138932f, -0.333580077f,
+    0.0730883181f, -0.147853181f, -0.0168763548f, -0.237817854f,
+    0.0789559633f, 0.0194635391f, 0.0200370997f, -0.0394553244f,
+    0.170003653f, 0.146235913f, 0.080074653f, 0.0563069135f,
+    -0.0178830922f, 0.00161552429f, -0.0652828217f, -0.0457842052f,
+    0.00504150987f, -0.00545614213f, -0.0556021556f, -0.0660998076f,
+    -0.0733590052f, -0.0595082603f, -0.0479474813f, -0.0340967402f,
+    -0.0504344031f, -0.0665799305f, -0.038266819f, -0.0544123463f,
+    0.0763881058f, 0.0486318879f, 0.0747213364f, 0.0469651222f,
+    0.0688852221f, 0.0232495163f, 0.0403431877f, -0.0052925162f,
+    0.0115793012f, 0.0051340051f, -0.0185469054f, -0.0249922015f,
+    0.00407642126f, -0.0202483647f, -0.052925054f, -0.0772498399f,
+    0.0581564158f, 0.0547542572f, 0.047022704f, 0.0436205454f,
+    0.0943788141f, 0.11222285f, -0.00681531709f, 0.0110287163f,
+    0.0337108821f, 0.0289037228f, 0.0432097875f, 0.0384026282f,
+    0.0699332803f, 0.0863723159f, -0.0106282337f, 0.00581079908f,
+    -0.0300294962f, -0.0515518747f, -0.05808511f, -0.0796074867f,
+    0.0242012106f, -0.014439282f, 0.0263863541f, -0.0122541394f,
+    -0.00567696989f, -0.0586299188f, -0.0394045301f, -0.092357479f,
+    0.048553735f, -0.0215173271f, 0.0450669304f, -0.0250041299f,
+    -0.0119688874f, -0.0777287185f, -0.142407f, -0.208166823f,
+    -0.0262866281f, -0.0569819212f, -0.0670479685f, -0.0977432579f,
+    -0.0329399034f, 0.0384679064f, -0.0221050791f, 0.0493027344f,
+    -0.0472576432f, 0.0592147037f, 0.053253945f, 0.159726292f,
+    0.133868828f, 0.0437058657f, 0.118054338f, 0.0278913788f,
+    0.0937925652f, 0.0536227226f, 0.0953592733f, 0.0551894307f,
+    0.0847186819f, 0.0578501411f, 0.100595213f, 0.073726669f,
+    0.0446424149f, 0.0677669942f, 0.0779001415f, 0.101024725f,
+    0.0840362906f, 0.0696656927f, 0.104685277f, 0.0903146788f,
+    0.0815103576f, 0.0302702375f, 0.0848243758f, 0.0335842557f,
+    0.0389465764f, 0.0117344633f, 0.110839099f, 0.0836269855f,
+    0.0364206396f, -0.027660992f, 0.0909781978f, 0.0268965606f,
+    0.162777022f, 0.0185340941f, 0.014378354f, -0.129864573f,
+    -0.00115998089f, -0.220365003f, -0.166047782f, -0.385252804f,
+    0.0312011689f, -0.00824727863f, -0.0651508495f, -0.104599297f,
+    -0.132735834f, -0.247146368f, -0.245576978f, -0.359987527f,
+    -0.0959637761f, -0.0910018235f, -0.0102953296f, -0.00533337472f,
+    0.181324512f, 0.144328356f, 0.16154778f, 0.124551624f,
+    -0.0953045264f, 0.0426423848f, 0.00207100064f, 0.140017912f,
+    0.181983754f, 0.277972579f, 0.173914105f, 0.269902915f,
+    -0.270896822f, -0.379611403f, -0.126836836f, -0.235551432f,
+    -0.132589281f, -0.249999553f, -0.085422799f, -0.202833071f,
+    0.0343475044f, -0.0145653263f, 0.00976857916f, -0.0391442515f,
+    0.172655031f, 0.115046516f, 0.0511826277f, -0.00642588036f,
+    -0.0628525987f, -0.375180274f, 0.0321930349f, -0.280134648f,
+    0.0107207838f, -0.222643107f, 0.0158704221f, -0.217493474f,
+    -0.0147443172f, -0.100053638f, 0.11667791f, 0.0313685834f,
+    0.0588290654f, 0.0524835363f, 0.10035529f, 0.094009757f,
+    0.0413891338f, -0.0388608798f, -0.054352697f, -0.134602711f,
+    0.194255412f, 0.172119647f, 0.021063203f, -0.00107256696f,
+    -0.158728868f, -0.144761875f, -0.0521460548f, -0.038179066f,
+    -0.00586258154f, 0.0662186444f, 0.0232698489f, 0.0953510776f,
+    0.0309052113f, -0.00416766852f, -0.0172417294f, -0.0523146093f,
+    0.107221037f, 0.0704611689f, -0.00890849903f, -0.045668371f,
+    0.145171285f, 0.0969061106f, 0.127417669f, 0.0791524947f,
+    0.221487105f, 0.171534956f, 0.13575089f, 0.0857987255f,
+    -0.104834348f, -0.0854487568f, 0.113668606f, 0.133054197f,
+    0.0157724414f, 0.022653589f, 0.0124134272f, 0.0192945749f,
+    -0.0874033198f, -0.128051817f, 0.111822851f, 0.0711743683f,
+    0.0332034715f, -0.019949466f, 0.0105676763f, -0.0425852612f,
+    0.0568621866f, 0.011434054f, 0.0270213559f, -0.0184067786f,
+    0.0129026622f, -0.0145579837f, 0.0370240323f, 0.00956338644f,
+    0.0271445774f, -0.00856177974f, 0.0032030195f, -0.0325033367f,
+    -0.0168149471f, -0.0345538184f, 0.0132056978f, -0.00453317165f,
+    0.167854473f, 0.193944037f, -0.0282486584f, -0.00215909909f,
+    0.0446662605f, 0.116441198f, -0.0668958053f, 0.00487913471f,
+    0.229070172f, 0.180919275f, 0.042753458f, -0.0053974418f,
+    0.105881959f, 0.103416443f, 0.00410631113f, 0.00164079247f,
+    -0.00862680934f, -0.00891021919f, -0.0084099276f, -0.00869333744f,
+    -0.030038856f, -0.0317124985f, -0.0124980286f, -0.0141716711f,
+    -0.0458179265f, -0.0178175569f, 0.0162954461f, 0.0442958176f,
+    -0.0672299713f, -0.0406198315f, 0.0122073479f, 0.0388174877f,
+    0.0634329468f, 0.0364505686f, 0.0297530126f, 0.00277063251f,
+    0.0582418442f, 0.0075684227f, 0.0100078806f, -0.0406655408f,
+    0.0423514694f, 0.0108872997f, 0.00506262574f, -0.026401544f,
+    0.0371603668f, -0.0179948453f, -0.0146825071f, -0.0698377192f,
+    -0.137011394f, -0.160722941f, 0.0237710439f, 5.94923877e-05f,
+    -0.0309905596f, -0.076729171f, 0.0843726769f, 0.0386340655f,
+    -0.123809792f, -0.0978147611f, -0.0216104835f, 0.00438454747f,
+    -0.0177889559f, -0.0138209853f, 0.0389911532f, 0.0429591201f,
+    -0.077655457f, -0.0566091798f, -0.0506001376f, -0.0295538604f,
+    -0.0991146415f, -0.0729920119f, -0.0282985829f, -0.00217595138f,
+    -0.0531014018f, -0.0566040725f, -0.039981436f, -0.0434841067f,
+    -0.0745605826f, -0.0729869083f, -0.0176798794f, -0.0161061995f,
+    -0.0352285802f, -0.0915554166f, -0.0176754706f, -0.0740023106f,
+    -0.169487327f, -0.13972348f, -0.0198642425f, 0.00989960134f,
+    0.0518760085f, -0.0188011155f, -0.0139339939f, -0.0846111178f,
+    -0.0823827386f, -0.0669691786f, -0.0161227714f, -0.000709213258f,
+    -0.0108205462f, -0.129090518f, 0.143445909f, 0.0251759253f,
+    -0.13620767f, -0.184393376f, 0.0107253455f, -0.0374603644f,
+    0.178730279f, -0.0816507488f, 0.146371618f, -0.114009418f,
+    0.053343147f, -0.136953622f, 0.0136510581f, -0.176645711f,
+    -0.0411341004f, -0.0822679698f, -0.0599917397f, -0.101125613f,
+    -0.070493184f, -0.134329408f, -0.11142242f, -0.175258651f,
+    0.0507506132f, 0.0827085301f, -0.000359976664f, 0.0315979384f,
+    0.021391524f, 0.0306470841f, -0.0517906621f, -0.0425351039f,
+    0.154582858f, 0.0730472133f, 0.046713151f, -0.0348224975f,
+    -0.0032415837f, 0.0292533729f, -0.0160756093f, 0.0164193474f,
+    0.0634054393f, 0.0926877707f, 0.0265270881f, 0.0558094159f,
+    -0.0944189951f, 0.0488939323f, -0.0362616666f, 0.107051261f,
+    0.0202312339f, 0.177904755f, 0.0479701385f, 0.205643654f,
+    0.085059844f, 0.215214714f, 0.15020436f, 0.280359238f,
+    -0.0707550272f, 0.0572993867f, 0.0170713328f, 0.145125747f,
+    -0.00592640927f, 0.0946093649f, 0.119305566f, 0.219841346f,
+    0.136459634f, 0.0667391643f, -0.00632443652f, -0.0760449022f,
+    0.0531687625f, 0.0760576874f, -0.0305606555f, -0.00767173618f,
+    0.021278087f, 0.120767325f, 0.0349524915f, 0.134441733f,
+    -0.0620127842f, 0.130085841f, 0.0107162744f, 0.202814907f,
+    0.1282731f, 0.0848688856f, 0.0339660719f, -0.00943814125f,
+    0.00958605856f, 0.0709169582f, -0.0633068606f, -0.00197596662f,
+    0.0527686104f, 0.0285859108f, -0.0245404243f, -0.048723124f,
+    -0.0659184307f, 0.0146339796f, -0.121813357f, -0.0412609503f,
+    0.185834244f, 0.401137054f, 0.135386288f, 0.350689083f,
+    0.31746766f, 0.361778796f, 0.223337531f, 0.267648667f,
+    -0.102986716f, -0.0416364819f, -0.0524513721f, 0.00889886171f,
+    0.0286467094f, -0.0809947178f, 0.0354998782f, -0.0741415471f,
+    0.063058883f, -0.00285127014f, -0.0875578821f, -0.153468028f,
+    0.0107384408f, 0.0282179806f, -0.0654861405f, -0.0480065979f,
+    0.0313307345f, -0.0381622352f, -0.0366183296f, -0.106111303f,
+    -0.0209897067f, -0.00709299091f, -0.0145465918f, -0.000649876078f,
+    0.068755202f, 0.0458779633f, 0.0869970024f, 0.0641197637f,
+    -0.100836232f, -0.1195333f, -0.00694350898f, -0.0256405771f,
+    -0.0888837278f, -0.072307542f, 0.0587809533f, 0.0753571391f,
+    -0.258475155f, -0.237718806f, -0.0351595543f, -0.0144032016f,
+    -0.0720825717f, -0.0773506016f, -0.0548727587f, -0.0601407886f,
+    -0.0497764982f, -0.0359302834f, -0.0186720621f, -0.00482584909f,
+    -0.0300292335f, -0.0324650779f, 0.0266995952f, 0.0242637508f,
+    -0.00772316288f, 0.00895524025f, 0.0629002899f, 0.0795786902f,
+    -0.0392993502f, 0.151189953f, -0.0472993702f, 0.143189937f,
+    -0.217713967f, -0.0484205969f, -0.0676739514f, 0.101619415f,
+    -0.134103417f, 0.0239142478f, -0.0967644751f, 0.0612531975f,
+    -0.31251803f, -0.175696313f, -0.117139041f, 0.0196826719f,
+    -0.0636572093f, -0.00861325115f, 0.0233796015f, 0.0784235597f,
+    0.00889272988f, 0.0783112124f, 0.0298213679f, 0.0992398486f,
+    -0.000979997218f, 0.00664931722f, 0.0383644849f, 0.0459937975f,
+    0.0715699419f, 0.0935737789f, 0.0448062494f, 0.0668100864f,
+    -0.0361861587f, -0.0134762898f, 0.0539326593f, 0.0766425282f,
+    -0.0291646067f, 0.00248886272f, 0.0140655953f, 0.0457190648f,
+    0.0430257395f, 0.0375344343f, 0.10857974f, 0.103088439f,
+    0.0500472896f, 0.0534995869f, 0.0687126815f, 0.0721649751f,
+    -0.0562162325f, -0.0694992542f, -0.105167426f, -0.118450448f,
+    -0.120839089f, -0.117939562f, -0.0849936604f, -0.0820941404f,
+    -0.00499289483f, -0.0570552126f, 0.021287106f, -0.0307752099f,
+    -0.069615759f, -0.10549552f, 0.0414608605f, 0.00558109349f,
+    0.0686521381f, 0.0112614296f, 0.0107802637f, -0.0466104448f,
+    0.0908395946f, 0.010962911f, -0.00498726964f, -0.0848639533f,
+    0.0326252989f, 0.0421500728f, -0.0178261828f, -0.0083014071f,
+    0.0548127592f, 0.0418515541f, -0.0335937105f, -0.0465549156f,
+    -0.0127506172f, -0.0594282523f, 0.0034752395f, -0.0432023965f,
+    -0.14214018f, -0.205790862f, 0.021992011f, -0.0416586734f,
+    0.0386484116f, -0.0346717909f, 0.101387076f, 0.0280668717f,
+    -0.0907411575f, -0.181034401f, 0.119903848f, 0.0296105966f,
+    -0.141559556f, -0.152706355f, -0.0860837996f, -0.0972305909f,
+    -0.168221921f, -0.0657093599f, -0.10241174f, 0.000100821257f,
+    -0.0132106431f, -0.049332723f, -0.0719234794f, -0.108045556f,
+    -0.0398730114f, 0.0376642682f, -0.0882514268f, -0.0107141435f,
+    -0.0912965089f, -0.0643051565f, -0.184746727f, -0.157755375f,
+    0.0165753458f, 0.127901956f, -0.0870760232f, 0.0242505744f,
+    -0.0821636543f, -0.00999317132f, -0.0615483634f, 0.0106221214f,
+    0.0257082023f, 0.182213932f, 0.0361223295f, 0.192628071f,
+    -0.0074235294f, -0.00553566217f, -0.188341215f, -0.186453342f,
+    -0.0796579123f, -0.0402841605f, -0.13204807f, -0.0926743299f,
+    0.0368797109f, 0.0643692538f, -0.0413186252f, -0.0138290785f,
+    -0.0353546701f, 0.0296207555f, 0.0149745122f, 0.0799499378f,
+    -0.141224235f, 0.0244919546f, -0.0145568326f, 0.151159361f,
+    -0.189705834f, -0.0397203118f, -0.0623205602f, 0.0876649618f,
+    -0.0255716629f, 0.0268837828f, 0.00613894127f, 0.058594387f,
+    -0.0740532652f, -0.0373284854f, -0.0416247882f, -0.00490000891f,
+    0.0688271075f, 0.106801361f, 0.0219384767f, 0.0599127337f,
+    -0.103349984f, -0.0784465522f, 0.0347457565f, 0.0596491918f,
+    -0.0325049013f, -0.171229705f, -0.0303177834f, -0.169042587f,
+    -0.204681993f, -0.356477588f, -0.0175104961f, -0.169306114f,
+    0.11967779f, 0.124657124f, 0.0791027024f, 0.0840820372f,
+    -0.00401593745f, 0.100496352f, 0.0264110118f, 0.130923301f,
+    0.0840295628f, 0.121684425f, 0.060591802f, 0.0982466638f,
+    -0.0396641642f, 0.097523652f, 0.00790011138f, 0.145087928f,
+    0.0689044222f, 0.0110450424f, 0.157240331f, 0.0993809551f,
+    -0.0776538402f, -0.241627812f, 0.0142793581f, -0.149694622f,
+    -0.0887125209f, -0.0440428071f, -0.0212907754f, 0.0233789384f,
+    -0.235270783f, -0.296715647f, -0.164251745f, -0.225696623f,
+    0.0562511533f, 0.0549676716f, -0.0466253459f, -0.0479088314f,
+    0.0228044689f, 0.0566820875f, -0.0149691999f, 0.0189084187f,
+    -0.103090048f, -0.0833534151f, -0.102504686f, -0.0827680454f,
+    -0.136536732f, -0.0816389918f, -0.0708485395f, -0.0159507934f,
+    0.108822651f, 0.042682521f, 0.0527692065f, -0.0133709274f,
+    0.0689245164f, -0.0372086875f, 0.0196511783f, -0.0864820257f,
+    0.0291744061f, -0.0705405548f, -0.0118466169f, -0.111561581f,
+    -0.0107237305f, -0.150431767f, -0.0449646488f, -0.184672683f,
+    0.0780372545f, 0.0678255558f, 0.0579770729f, 0.0477653742f,
+    0.0342683606f, 0.0164862331f, 0.0407579653f, 0.0229758378f,
+    0.0787166879f, 0.00493205991f, 0.0483396277f, -0.0254450012f,
+    0.0349477939f, -0.0464072637f, 0.0311205182f, -0.0502345376f,
+    -0.261886835f, -0.0631180555f, 0.115070991f, 0.313839763f,
+    -0.113229454f, -0.0501579046f, 0.154499799f, 0.217571348f,
+    0.0275526941f, 0.0536030456f, 0.00178024918f, 0.0278306045f,
+    0.176210076f, 0.0665632039f, 0.0412090681f, -0.0684378073f,
+    -0.0287383702f, -0.076134488f, -0.00763713941f, -0.0550332591f,
+    0.0100518959f, -0.0623292513f, 0.0355287455f, -0.0368524045f,
+    0.00630130246f, -0.0533920974f, -0.0064556133f, -0.0661490113f,
+    0.0450915694f, -0.039586857f, 0.0367102697f, -0.0479681604f,
+    -0.0774675459f, -0.0281915329f, 0.0163745023f, 0.0656505153f,
+    -0.0212090835f, 0.0180785358f, 0.0184095576f, 0.0576971769f,
+    -0.000517696142f, 0.047052633f, 0.0354896449f, 0.083059974f,
+    0.0557407662f, 0.0933227018f, 0.0375247002f, 0.0751066357f,
+    0.0692953244f, 0.0284238942f, 0.035326235f, -0.0055451938f,
+    0.0647789612f, 0.0707125962f, -0.011301199f, -0.0053675659f,
+    0.108913735f, 0.0640411675f, -0.000692507252f, -0.0455650724f,
+    0.104397379f, 0.106329873f, -0.0473199338f, -0.0453874432f,
+    0.0257385876f, -0.0137220919f, -0.0219683349f, -0.0614290163f,
+    -0.0159698091f, -0.0583670363f, -0.0453910977f, -0.0877883285f,
+    -0.0366022363f, -0.0543669723f, -0.000131834298f, -0.0178965703f,
+    -0.0783106312f, -0.0990119129f, -0.0235545933f, -0.0442558751f,
+    -0.388366699f, -0.410824239f, -0.253663093f, -0.276120633f,
+    -0.314451188f, -0.324503958f, -0.186878592f, -0.196931332f,
+    -0.171955451f, -0.164050251f, -0.0882456899f, -0.0803404823f,
+    -0.0980399475f, -0.0777299479f, -0.0214611832f, -0.00115118572f,
+    0.0459033288f, 0.0479138196f, 0.0332034007f, 0.0352138914f,
+    -0.0409983732f, -0.0733770579f, -0.029626403f, -0.0620050915f,
+    0.0524151996f, 0.118075624f, 0.0413149372f, 0.106975362f,
+    -0.0344864987f, -0.00321525568f, -0.0215148609f, 0.00975638162f,
+    0.160901845f, 0.0534933396f, 0.217115656f, 0.109707154f,
+    0.156679183f, -0.104889177f, 0.0880128741f, -0.173555493f,
+    -0.00223404285f, 0.0747166201f, 0.0988270417f, 0.175777704f,
+    -0.00645670528f, -0.0836658925f, -0.0302757528f, -0.107484937f,
+    -0.160040826f, -0.164694309f, 0.0530892089f, 0.0484357327f,
+    -0.159843087f, -0.349332273f, -0.0624136478f, -0.251902848f,
+    -0.224167436f, -0.155998409f, -0.0232918039f, 0.0448772162f,
+    -0.223969698f, -0.340636402f, -0.138794661f, -0.255461365f,
+    -0.0502203032f, -0.221891969f, -0.00012756139f, -0.171799228f,
+    0.037482366f, -0.0620644465f, 0.0511980876f, -0.0483487286f,
+    0.0863271579f, 0.0712872967f, -0.0450564176f, -0.0600962825f,
+    0.174029827f, 0.23111482f, 0.00626922771f, 0.0633542165f,
+    0.0590859503f, 0.107588381f, 0.0694135949f, 0.117916025f,
+    0.018041648f, 0.0959638059f, 0.0590923987f, 0.137014553f,
+    0.161809832f, 0.063876994f, -0.0041596815f, -0.102092519f,
+    0.120765522f, 0.0522524118f, -0.0144808777f, -0.0829939842f,
+    -0.212758154f, -0.0307813138f, 0.0334660858f, 0.215442926f,
+    -0.177743465f, -0.131476715f, -0.0797882974f, -0.0335215479f,
+    0.00587028079f, -0.0767436177f, -0.0736897886f, -0.156303689f,
+    0.0408849828f, -0.177439019f, -0.186944157f, -0.405268162f,
+    -0.0540156327f, -0.191623718f, -0.0628954694f, -0.200503543f,
+    0.0966776237f, 0.239749655f, -0.0108564347f, 0.132215589f,
+    0.0805917531f, 0.0446859747f, 0.0853263289f, 0.0494205505f,
+    0.231285006f, 0.476059318f, 0.137365356f, 0.382139683f,
+    0.0739885345f, 0.159478322f, 0.138779461f, 0.224269256f,
+    0.0326151289f, 0.0648698583f, 0.0448993593f, 0.077154085f,
+    -0.0123642106f, 0.0399982929f, -0.0134580135f, 0.0389044881f,
+    -0.053737618f, -0.0546101779f, -0.107338123f, -0.108210683f,
+    -0.102513917f, -0.101283893f, -0.139750004f, -0.138519973f,
+    0.00540982932f, 0.111363254f, -0.100551941f, 0.00540147722f,
+    -0.140076339f, -0.0171164945f, -0.0913386121f, 0.0316212326f,
+    -0.0321525857f, 0.195530653f, -0.0521405488f, 0.175542682f,
+    -0.0758064091f, 0.00509951543f, -0.0535097606f, 0.027396163f,
+    0.00101904571f, 0.00439805537f, 0.0123471916f, 0.0157262012f,
+    -0.0256305784f, -0.0381347872f, -0.0446194448f, -0.0571236536f,
+    0.0511948764f, -0.0388362482f, 0.0212375075f, -0.0687936172f,
+    -0.00558276987f, -0.124059014f, -0.135781854f, -0.254258096f,
+    0.0487148054f, 0.106353804f, -0.00555805489f, 0.0520809516f,
+    -0.0846614987f, -0.00991655514f, -0.033035282f, 0.0417096615f,
+    -0.0303639267f, 0.220496267f, 0.0971885175f, 0.348048717f,
+    0.0731584057f, 0.0409484431f, 0.0534480065f, 0.0212380402f,
+    -0.00782095455f, -0.01393425f, 0.00420421269f, -0.00190908276f,
+    0.0492359102f, 0.0228548739f, 0.000882411376f, -0.0254986249f,
+    -0.0317434482f, -0.0320278183f, -0.0483613759f, -0.048645746f,
+    -0.048579298f, -0.0612470172f, -0.0300689209f, -0.0427366421f,
+    -0.0292290822f, -0.0154695055f, -0.0348984413f, -0.0211388636f,
+    -0.0943040848f, -0.0954456329f, -0.0803048611f, -0.0814464092f,
+    -0.074953869f, -0.0496681184f, -0.085134387f, -0.0598486289f,
+    -0.0753614902f, 0.0172044486f, -0.102171212f, -0.00960527454f,
+    0.0633015633f, 0.0384695083f, 0.0304718241f, 0.005639771f,
+    -0.0341494307f, 0.00292714033f, -0.0554088578f, -0.0183322858f,
+    0.10451363f, 0.0241922066f, 0.0772341862f, -0.00308724027f,
+    0.079516232f, 0.0383691639f, -0.00611270964f, -0.0472597778f,
+    0.0763727352f, -0.00759435445f, 0.0191963613f, -0.0647707283f,
+    0.0528807417f, 0.0405097753f, -0.00542853028f, -0.0177994967f,
+    0.0497372448f, -0.00545374118f, 0.0198805407f, -0.0353104472f,
+    -0.0487266406f, -0.13119337f, -0.1399865f, -0.222453222f,
+    -0.0952201113f, -0.18615514f, -0.120615512f, -0.211550549f,
+    -0.00860778987f, 0.00199349131f, -0.0330670178f, -0.0224657375f,
+    -0.0551012605f, -0.0529682934f, -0.0136960316f, -0.0115630655f,
+    -0.0948024988f, -0.132343054f, -0.00330555253f, -0.0408461057f,
+    -0.0908900276f, -0.236870319f, -0.173240691f, -0.31922099f,
+    -0.0635190457f, -0.0786593407f, -0.056994047f, -0.0721343458f,
+    -0.0596065782f, -0.18318662f, -0.226929188f, -0.350509226f,
+    -0.0869925842f, -0.098247163f, -0.0741330832f, -0.0853876621f,
+    -0.056316942f, -0.101248026f, -0.0523256101f, -0.0972566977f,
+    -0.136912435f, -0.158859551f, -0.050523594f, -0.0724707097f,
+    -0.106236793f, -0.161860421f, -0.0287161171f, -0.0843397453f,
+    0.0643473789f, 0.0756227672f, -0.0587207489f, -0.0474453568f,
+    -0.0218612961f, -0.0687323362f, -0.0750716254f, -0.121942669f,
+    0.0712584853f, 0.0143528935f, -0.00381891057f, -0.0607245006f,
+    -0.0149501879f, -0.130002216f, -0.0201697834f, -0.135221809f,
+    -0.0750793815f, -0.154967055f, -0.0586045235f, -0.138492197f,
+    0.0631275922f, 0.125379547f, -0.0275952071f, 0.0346567482f,
+    -0.059773013f, -0.112548195f, 0.0310732797f, -0.0217019022f,
+    0.0784339607f, 0.1677984f, 0.0620825924f, 0.151447043f,
+    -0.100039832f, -0.144387543f, 0.0536443703f, 0.00929667056f,
+    -0.025567349f, -0.00571781956f, -0.0638482869f, -0.0439987555f,
+    -0.0305089988f, -0.0307604969f, 0.061383225f, 0.0611317307f,
+    0.0439634845f, 0.107909217f, -0.0561094284f, 0.0078363074f,
+    0.0558665805f, -0.186780512f, -0.0847583935f, -0.327405483f,
+    0.0303836949f, -0.115241475f, -0.0347673967f, -0.180392563f,
+    -0.0900242478f, -0.0670312345f, -0.0657821745f, -0.0427891612f,
+    -0.115507133f, 0.0045077987f, -0.0157911703f, 0.104223758f,
+    0.064379096f, 0.0975639746f, -0.0392219052f, -0.00603702851f,
+    -0.0566745959f, 0.194813013f, -0.020136334f, 0.231351271f,
+    -0.0929127932f, -0.120351471f, -0.110120423f, -0.137559101f,
+    -0.213966489f, -0.0231024288f, -0.0910348594f, 0.0998292044f,
+    -0.119449712f, -0.0962070748f, -0.121348172f, -0.0981055349f,
+    -0.0384445675f, -0.0450728461f, -0.0544329509f, -0.0610612333f,
+    -0.0643534809f, -0.0101701124f, -0.0311584659f, 0.0230249036f,
+    0.0166516621f, 0.0409641117f, 0.0357567519f, 0.0600691997f,
+    -0.0539891683f, 0.0709200501f, -0.078039065f, 0.0468701497f,
+    -0.0489957035f, 0.117988482f, -0.0599191599f, 0.107065029f,
+    -0.0605121925f, -0.0134921446f, -0.112538606f, -0.0655185506f,
+    -0.0555187277f, 0.0335762985f, -0.0944186896f, -0.0053236587f,
+    -0.0203835871f, -0.0690774918f, -0.0244311169f, -0.0731250197f,
+    0.0428240821f, -0.0254064184f, 0.00871544331f, -0.059515059f,
+    -0.0119908173f, -0.0420243144f, 0.049876824f, 0.019843325f,
+    0.0512168519f, 0.00164675526f, 0.0830233842f, 0.0334532857f,
+    -0.14220269f, -0.0906180665f, 0.0183808096f, 0.0699654371f,
+    -0.0588926673f, -0.0292281751f, -0.0172114745f, 0.0124530159f,
+    0.0580491275f, -0.0171987955f, 0.00937988609f, -0.065868035f,
+    0.14135915f, 0.0441910885f, -0.026212398f, -0.12338046f,
+    0.0624787025f, 0.0120751075f, 0.0599463694f, 0.00954277348f,
+    -0.0366016254f, -0.0752284229f, -0.0229508821f, -0.0615776777f,
+    0.0401412547f, 0.0170391779f, 0.0387926251f, 0.0156905502f,
+    -0.0589390695f, -0.0702643469f, -0.0441046208f, -0.0554298982f,
+    0.0717592761f, 0.0842681751f, 0.025080055f, 0.037588954f,
+    -0.00195768476f, 0.0652973801f, -0.0130261742f, 0.054228887f,
+    0.0236459076f, 0.0346228294f, 0.0299455486f, 0.0409224704f,
+    -0.0500710532f, 0.0156520307f, -0.00816068053f, 0.0575624034f,
+    -0.0954495296f, -0.0191359296f, -0.142552689f, -0.0662390888f,
+    -0.00789413974f, 0.00678805262f, -0.0511910766f, -0.0365088843f,
+    -0.0502612516f, -0.0648607761f, -0.0793816596f, -0.0939811766f,
+    0.0372941382f, -0.0389367901f, 0.0119799599f, -0.0642509684f,
+    -0.00952546857f, -0.0657249391f, 0.0128252357f, -0.0433742329f,
+    -0.0159609001f, -0.0566244572f, 0.0393859297f, -0.00127762556f,
+    0.0580045134f, -0.0366592929f, 0.0151754543f, -0.0794883519f,
+    0.0515690856f, -0.0275588091f, 0.041736152f, -0.0373917446f,
+    -0.104837552f, -0.0885933042f, -0.0513975918f, -0.0351533443f,
+    -0.0577415265f, -0.111626029f, 0.00474639051f, -0.0491381139f,
+    -0.0127350111f, -0.0430989414f, -0.0475917906f, -0.0779557228f,
+    0.0343610123f, -0.0661316663f, 0.00855219364f, -0.0919404849f,
+    -0.188523188f, -0.0592934787f, 0.00596078113f, 0.135190487f,
+    -0.163183108f, -0.0380132347f, -0.057040602f, 0.0681292713f,
+    -0.159063205f, -0.0354989246f, 0.00282480568f, 0.126389086f,
+    -0.133723125f, -0.014218688f, -0.0601765811f, 0.0593278557f,
+    -0.0644596815f, 0.159373194f, 0.00494910032f, 0.228781983f,
+    0.0451039672f, 0.154003263f, 0.0265405402f, 0.135439843f,
+    -0.114223316f, -0.0405703485f, 0.110435411f, 0.184088379f,
+    -0.00465967134f, -0.0459402874f, 0.132026851f, 0.0907462239f,
+    0.0324090719f, -0.0785449147f, 0.00505148247f, -0.1059025f,
+    0.0738372952f, 0.110524967f, 0.0542480312f, 0.0909356996f,
+    0.181787029f, -0.0358440056f, 0.0913467407f, -0.126284301f,
+    0.223215252f, 0.153225869f, 0.140543282f, 0.0705538914f,
+    0.182664543f, 0.233860046f, -0.0409171917f, 0.010278305f,
+    0.200675711f, 0.0245800987f, -0.00709296018f, -0.183188573f,
+    -0.0533492118f, 0.160467282f, 0.0288638324f, 0.242680326f,
+    -0.0353380442f, -0.0488126725f, 0.0626880527f, 0.0492134281f,
+    0.11423178f, 0.0148384795f, 0.0109984055f, -0.0883948952f,
+    0.0565598197f, 0.0432190262f, 0.0219157357f, 0.00857494026f,
+    0.151562989f, 0.149339199f, -0.0293405373f, -0.0315643288f,
+    0.0938910246f, 0.177719742f, -0.0184232034f, 0.0654055104f,
+    -0.116345815f, 0.082510069f, -0.0792849362f, 0.119570948f,
+    0.028424507f, 0.059064839f, -0.0296808295f, 0.00095950067f,
+    -0.195165694f, -0.144377008f, -0.117314592f, -0.0665258989f,
+    -0.0503953658f, -0.167822242f, -0.0677104741f, -0.185137346f,
+    0.0620202571f, -0.135953635f, 0.0389843583f, -0.158989534f,
+    0.065529868f, -0.0669510961f, 0.0616804063f, -0.0708005577f,
+    0.0560509749f, 0.116116203f, -0.04590296f, 0.0141622722f,
+    0.0595605895f, 0.185118735f, -0.0232069045f, 0.102351248f,
+    0.184904307f, 0.132765576f, 0.0375473015f, -0.0145914238f,
+    0.184407994f, 0.14157486f, 0.0369593278f, -0.00587380305f,
+    0.151429564f, 0.0320924744f, 0.0411922559f, -0.0781448334f,
+    0.150933251f, 0.0409017615f, 0.0406042747f, -0.0694272146f,
+    0.0603258088f, 0.0475609414f, -0.02310092f, -0.0358657911f,
+    -0.00921451114f, -0.141000241f, -0.0246221982f, -0.156407937f,
+    0.00327842683f, 0.0617636517f, -0.0469538048f, 0.0115314238f,
+    -0.066261895f, -0.126797542f, -0.0484750904f, -0.109010734f,
+    -0.0488650016f, -0.0893010348f, -0.0379903018f, -0.0784263313f,
+    -0.0312501863f, -0.0690008551f, -0.0140626822f, -0.0518133491f,
+    0.0314787738f, -0.0218412895f, -0.0442153364f, -0.0975354016f,
+    0.0490935855f, -0.00154111534f, -0.0202877186f, -0.0709224194f,
+    -0.289215714f, -0.412990451f, -0.0317934155f, -0.155568153f,
+    0.00855696201f, -0.0612276718f, -0.0412200168f, -0.111004651f,
+    -0.0412630737f, 0.0219518952f, 0.0541018508f, 0.11731682f,
+    0.256509602f, 0.373714656f, 0.0446752459f, 0.161880314f,
+    -0.0715660378f, -0.00965197384f, 0.0158226136f, 0.0777366757f,
+    0.0171592329f, 0.00905803591f, 0.0769776553f, 0.0688764602f,
+    -0.0572743937f, -0.0191882011f, -0.00627924129f, 0.0318069495f,
+    0.0314508788f, -0.000478188507f, 0.0548758022f, 0.0229467358f,
+    0.0474869125f, -0.0120417336f, 0.0173768438f, -0.0421518013f,
+    -0.0209756047f, -0.0533509478f, -0.0238269698f, -0.0562023148f,
+    0.0477330424f, -0.0226446185f, 0.0244348235f, -0.0459428355f,
+    -0.0207294729f, -0.0639538318f, -0.0167689882f, -0.059993349f,
+    0.0417664982f, 0.041562371f, 0.00719190761f, 0.00698778359f,
+    0.0421108454f, 0.0950522423f, 0.00350368395f, 0.0564450845f,
+    0.0439322963f, 0.0579137728f, 0.0923106f, 0.106292076f,
+    0.0442766398f, 0.111403644f, 0.0886223763f, 0.155749381f,
+    -0.0817883313f, -0.0249445923f, -0.0485296287f, 0.00831411313f,
+    0.0294269323f, 0.0427518673f, -0.0212839879f, -0.00795905478f,
+    -0.0301012993f, -0.043390613f, -0.0458765663f, -0.0591658801f,
+    0.0811139643f, 0.0243058428f, -0.0186309293f, -0.0754390508f,
+    -0.2184553f, -0.301178575f, -0.130794406f, -0.213517696f,
+    -0.148079127f, -0.197249949f, -0.128366649f, -0.177537471f,
+    -0.0661251098f, -0.180193007f, -0.0409146473f, -0.154982537f,
+    0.00425106008f, -0.0762643814f, -0.0384868905f, -0.119002327f,
+    -0.182977632f, -0.225219935f, -0.125636712f, -0.167879015f,
+    -0.155624151f, -0.216464326f, -0.0753906816f, -0.136230856f,
+    -0.0906478688f, -0.177591652f, -0.0372481793f, -0.124191962f,
+    -0.0632943958f, -0.168836057f, 0.0129978582f, -0.0925437957f,
+    0.132685304f, 0.059862569f, -0.0432110615f, -0.116033792f,
+    0.275891602f, 0.161231324f, 0.157323077f, 0.0426628068f,
+    -0.0332798809f, 0.00436850265f, -0.0613294356f, -0.023681052f,
+    0.109926403f, 0.105737254f, 0.139204696f, 0.135015547f,
+    -0.251973897f, -0.505617797f, -0.140596062f, -0.394239962f,
+    -0.11512877f, -0.420407772f, -0.183425754f, -0.488704741f,
+    -0.0337226875f, -0.182886913f, 0.00211831927f, -0.14704591f,
+    0.103122436f, -0.0976768881f, -0.0407113805f, -0.241510704f,
+    -0.121655658f, -0.207173496f, -0.181191966f, -0.266709805f,
+    -0.133551955f, -0.0902964622f, -0.0351536535f, 0.0081018433f,
+    -0.100554623f, -0.0828438848f, -0.039004527f, -0.0212937891f,
+    -0.112450927f, 0.0340331495f, 0.107033789f, 0.253517866f,
+    -0.217088655f, 0.00914751738f, -0.0359465405f, 0.190289631f,
+    -0.174387604f, 0.000519931316f, -0.0944662988f, 0.0804412365f,
+    -0.0300970469f, 0.151691452f, 0.103992172f, 0.285780668f,
+    0.0126039935f, 0.143063873f, 0.0454724133f, 0.175932288f,
+    -0.268107653f, -0.487401128f, -0.0356696099f, -0.25496307f,
+    -0.073894836f, -0.267831832f, -0.0434789658f, -0.237415969f,
+    -0.00718254596f, -0.0300292075f, 0.160666883f, 0.137820214f,
+    0.187030271f, 0.189540058f, 0.152857527f, 0.155367315f,
+    -0.440066934f, -0.214568749f, -0.208433285f, 0.0170648862f,
+    -0.419588476f, -0.206803858f, -0.133247823f, 0.0795367807f,
+    -0.00685645873f, -0.0250794068f, -0.0507702455f, -0.0689931959f,
+    0.0136219813f, -0.0173145235f, 0.0244152136f, -0.0065212925f,
+    -0.0281717032f, 0.0239418279f, 0.0582580492f, 0.110371582f,
+    0.0869060382f, 0.0924320966f, 0.127054006f, 0.132580072f,
+    0.0470413789f, 0.0293296929f, 0.0622853562f, 0.0445736684f,
+    0.16211912f, 0.0978199542f, 0.131081313f, 0.0667821541f,
+    -0.0875360593f, 0.00359043293f, -0.139923021f, -0.0487965308f,
+    -0.215539604f, -0.0297520012f, -0.0734178871f, 0.112369716f,
+    0.020937819f, -0.0215107445f, -0.00559080951f, -0.048039373f,
+    -0.10706573f, -0.0548531748f, 0.0609143265f, 0.113126881f,
+    0.0656767935f, 0.06191108f, 0.00234371657f, -0.00142199802f,
+    0.0579933152f, 0.0828555077f, -0.00219640136f, 0.0226657912f,
+    -0.00157339126f, 0.0110400449f, -0.00858471915f, 0.00402871799f,
+    -0.00925686955f, 0.0319844745f, -0.0131248385f, 0.0281165056f,
+    0.112469107f, -0.06626302f, 0.0509903133f, -0.127741814f,
+    -0.0687057823f, -0.238583267f, -0.0968305841f, -0.266708076f,
+    0.0567167886f, 0.130164966f, 0.0418035239f, 0.115251705f,
+    -0.124458097f, -0.0421552882f, -0.106017381f, -0.0237145647f,
+    -0.0133719444f, 0.0507546514f, 0.00914809294f, 0.0732746869f,
+    0.0274256822f, 0.0494092256f, 0.00194270816f, 0.0239262544f,
+    -0.0347621404f, 0.0328927897f, -0.0262113158f, 0.0414436124f,
+    0.00603548717f, 0.0315473676f, -0.0334166996f, -0.00790481828f,
+    -0.0450869314f, -0.0296791568f, 0.00606744923f, 0.0214752257f,
+    0.00413559377f, 0.0318963975f, 0.0533227846f, 0.0810835883f,
+    -0.020626191f, 0.0146153215f, -0.0319987535f, 0.0032427609f,
+    0.0285963323f, 0.076190874f, 0.0152565837f, 0.0628511235f,
+    0.0372924879f, 0.0594816245f, -0.00200561155f, 0.0201835241f,
+    0.0399960391f, 0.0488722771f, 0.0360704437f, 0.0449466854f,
+    0.169318527f, 0.13643682f, 0.0595842674f, 0.026702553f,
+    0.172022089f, 0.125827476f, 0.0976603329f, 0.0514657162f,
+    -0.050239861f, 0.0130026266f, -0.00242131948f, 0.0608211681f,
+    0.000355532393f, 0.0539489873f, -0.0105785988f, 0.0430148542f,
+    -0.0435403809f, 0.0280455686f, 0.0235260837f, 0.0951120332f,
+    0.00705501437f, 0.0689919293f, 0.0153688062f, 0.0773057193f,
+    0.00515634054f, -0.0247046929f, -0.0197827592f, -0.0496437922f,
+    -0.192488402f, -0.266175449f, -0.0969244465f, -0.170611501f,
+    -0.0357725248f, 0.0329250246f, 0.0245801359f, 0.0932776853f,
+    -0.233417258f, -0.20854573f, -0.0525615513f, -0.0276900362f,
+    0.195493028f, 0.0356425866f, 0.21382159f, 0.0539711565f,
+    0.0972837135f, -0.0249719862f, 0.0984660536f, -0.023789648f,
+    0.0986782685f, 0.0350179672f, 0.13911745f, 0.0754571408f,
+    0.000468951155f, -0.0255966038f, 0.0237618946f, -0.00230365805f,
+    -0.00572231831f, -0.0743227601f, 0.0814960897f, 0.0128956484f,
+    0.278077602f, 0.251525462f, 0.135274827f, 0.108722702f,
+    0.0721876025f, -0.016599644f, 0.0265596695f, -0.062227577f,
+    0.355987519f, 0.309248596f, 0.0803384036f, 0.033599481f,
+    0.141749904f, 0.150042295f, 0.0806066543f, 0.0888990462f,
+    0.181996956f, 0.0658280849f, 0.0325171053f, -0.0836517662f,
+    0.0167681072f, 0.100387722f, -0.0244760569f, 0.0591435544f,
+    0.0570151545f, 0.016173508f, -0.0725656152f, -0.113407262f,
+    -0.00497238478f, -0.248920232f, -0.0560861677f, -0.300034016f,
+    0.0312765464f, -0.0465538613f, -0.0559694283f, -0.133799836f,
+    0.156711638f, 0.0191998035f, 0.0551100969f, -0.0824017376f,
+    0.19296056f, 0.22156617f, 0.0552268289f, 0.0838324353f,
+    0.11917384f, -0.0850256607f, -0.0600669309f, -0.264266431f,
+    0.0730329901f, 0.00320300832f, -0.0213222839f, -0.0911522657f,
+    0.20054695f, 0.111825727f, 0.00210511312f, -0.0866161138f,
+    0.154406101f, 0.200054392f, 0.0408497639f, 0.0864980593f,
+    -0.0185949989f, -0.188595027f, -0.101811737f, -0.271811754f,
+    -0.153560221f, -0.340147704f, -0.104621023f, -0.291208506f,
+    0.117832392f, 0.0559931323f, -0.00672314316f, -0.0685624033f,
+    -0.0171328112f, -0.0955595374f, -0.00953242183f, -0.087959148f,
+    -0.0993329287f, -0.32086271f, -0.0777242333f, -0.29925403f,
+    -0.0158328637f, -0.178536326f, 0.00114379823f, -0.161559671f,
+    -0.107689105f, -0.0719681233f, -0.0959937274f, -0.0602727532f,
+    -0.0241890382f, 0.0703582689f, -0.0171257034f, 0.0774216056f,
+    -0.0337390937f, 0.0250941366f, -0.0393522307f, 0.0194809996f,
+    0.105865814f, 0.0820489526f, 0.0698782206f, 0.0460613593f,
+    0.022552982f, 0.0735707209f, -0.0270213708f, 0.0239963662f,
+    0.162157893f, 0.130525529f, 0.0822090805f, 0.0505767241f,
+    -0.0181072149f, -0.0620766357f, 0.00812441297f, -0.0358450077f,
+    0.0409222208f, 0.0169969387f, 0.048917152f, 0.0249918737f,
+    0.073085852f, 0.0593081824f, 0.0705125183f, 0.0567348525f,
+    0.13211529f, 0.138381764f, 0.111305267f, 0.117571734f,
+    0.0763676763f, -0.0101385321f, 0.0139764771f, -0.0725297332f,
+    0.0138350762f, 0.0170026664f, -0.0416536033f, -0.0384860151f,
+    0.0781697631f, -0.0212988239f, -0.00284747779f, -0.102316067f,
+    0.0156371593f, 0.00584237278f, -0.0584775582f, -0.0682723448f,
+    0.0609573722f, 0.122242004f, 0.0683326274f, 0.129617259f,
+    0.0727242753f, 0.00635616109f, 0.00412439927f, -0.0622437149f,
+    -0.0317646042f, -0.0391906425f, -0.0469859242f, -0.0544119626f,
+    -0.0199976992f, -0.155076489f, -0.111194149f, -0.246272936f,
+    0.0227447953f, 0.0524347946f, 0.0393231437f, 0.0690131411f,
+    -0.00739422487f, 0.0312055107f, -0.0247860644f, 0.0138136698f,
+    0.0314744823f, 0.0464555733f, 0.0651135892f, 0.0800946802f,
+    0.00133546197f, 0.0252262913f, 0.00100438297f, 0.0248952117f,
+    -0.00932194851f, 0.00509790145f, 0.0213918053f, 0.0358116552f,
+    0.0188899301f, 0.0144405132f, 0.0149000054f, 0.0104505885f,
+    -0.00963855349f, -0.00345050264f, -0.0236464925f, -0.0174584426f,
+    0.0185733251f, 0.00589210913f, -0.0301382951f, -0.0428195111f,
+    -0.0114714084f, 0.0331994705f, -0.0270444378f, 0.0176264402f,
+    -0.0589178652f, 0.0302627906f, -0.0291990936f, 0.0599815622f,
+    -0.0230758954f, 0.0224098526f, -0.0230292473f, 0.0224565007f,
+    -0.0705223531f, 0.0194731727f, -0.0251839012f, 0.0648116246f,
+    -0.0807955787f, -0.00770884007f, -0.0111528039f, 0.0619339347f,
+    -0.0649250373f, -0.0117482524f, -0.0116779488f, 0.0414988361f,
+    -0.0546807572f, -0.0639442205f, -0.00342432503f, -0.0126877893f,
+    -0.0388102159f, -0.0679836348f, -0.00394947082f, -0.0331228897f,
+    0.0626568347f, 0.00611289032f, 0.00618323125f, -0.0503607132f,
+    0.0991956666f, -0.0114573315f, -0.0957509279f, -0.206403926f,
+    0.112933256f, 0.0766373351f, 0.0838491768f, 0.0475532599f,
+    0.149472088f, 0.059067104f, -0.0180849731f, -0.108489953f,
+    0.0166546833f, 0.128508925f, -0.0537671149f, 0.0580871291f,
+    0.00490071252f, 0.00828773156f, -0.0965374112f, -0.0931503996f,
+    -0.0984382629f, -0.00581507757f, -0.0788958818f, 0.0137273073f,
+    -0.110192239f, -0.126036286f, -0.121666178f, -0.137510225f,
+    0.0516558662f, 0.1557073f, 0.130715758f, 0.234767184f,
+    -0.116865605f, 0.033494994f, 0.0772601813f, 0.22762078f,
+    -0.034223929f, 0.0050045941f, -0.0163488779f, 0.0228796452f,
+    -0.202745408f, -0.117207699f, -0.0698044524f, 0.0157332551f,
+    0.129337355f, 0.165647164f, 0.0318955109f, 0.0682053268f,
+    0.201403975f, 0.0645531118f, 0.021421656f, -0.115429208f,
+    -0.0106635727f, -0.0729821101f, 0.0229520798f, -0.0393664539f,
+    0.0614030436f, -0.17407617f, 0.0124782249f, -0.223000988f,
+    -0.099720642f, -0.0116970912f, -0.221849859f, -0.133826315f,
+    0.00938382f, 0.011417672f, -0.187199518f, -0.185165673f,
+    0.0775018409f, 0.192058116f, -0.0420018546f, 0.072554417f,
+    0.186606303f, 0.215172872f, -0.00735151116f, 0.0212150645f,
+    -0.215129107f, -0.0919913948f, 0.0322295502f, 0.155367255f,
+    -0.19133319f, -0.0908760577f, -0.0457636118f, 0.0546935238f,
+    -0.0519907922f, -0.0691554472f, 0.0179015677f, 0.00073691085f,
+    -0.0281948745f, -0.0680401027f, -0.0600915924f, -0.0999368206f,
+    0.0996017158f, 0.0741367042f, 0.0880098343f, 0.0625448227f,
+    0.164760575f, -0.0413564295f, 0.0113764107f, -0.194740593f,
+    0.0262692086f, 0.0362915099f, 0.0547801107f, 0.0648024157f,
+    0.0914280638f, -0.0792016238f, -0.0218533054f, -0.192482993f,
+    0.0368667096f, -0.00293900073f, 0.0146927675f, -0.0251129437f,
+    0.0940842107f, 0.0679352432f, -0.0177628063f, -0.0439117774f,
+    0.143613309f, 0.154870421f, 0.00318428874f, 0.0144414008f,
+    0.200830802f, 0.22574465f, -0.029271286f, -0.00435743527f,
+    -0.0648933798f, -0.0386472642f, 0.0320616364f, 0.0583077483f,
+    -0.0340204053f, -0.0382992327f, -0.0235190764f, -0.0277979039f,
+    -0.0343090184f, -0.0378256217f, -0.0330467001f, -0.036563307f,
+    -0.00343604456f, -0.0374775901f, -0.0886274129f, -0.122668959f,
+    -0.225552931f, -0.108408391f, -0.168394968f, -0.0512504354f,
+    -0.24425666f, -0.103866249f, -0.148492351f, -0.00810194016f,
+    -0.0581882708f, 0.0870001465f, -0.0527017564f, 0.0924866647f,
+    -0.076891996f, 0.0915422887f, -0.0327991173f, 0.135635167f,
+    0.0389336348f, 0.0228105746f, 0.000267689116f, -0.015855372f,
+    0.032709755f, 0.0338877812f, -0.0234538913f, -0.0222758669f,
+    -0.0399125442f, 0.0112553239f, -0.00419811159f, 0.0469697565f,
+    -0.0461364202f, 0.0223325305f, -0.0279196892f, 0.0405492596f,
+    -0.148777544f, 0.0526462458f, -0.0777926445f, 0.123631142f,
+    0.0100570954f, 0.0680707768f, -0.0187048111f, 0.0393088721f,
+    -0.0842550024f, -0.00641670264f, -0.0305953119f, 0.0472429879f,
+    0.0745796412f, 0.00900783017f, 0.0284925289f, -0.0370792821f,
+    0.0267647114f, -0.0435140915f, 0.00604424998f, -0.0642345548f,
+    0.0520729981f, -0.000270582736f, -0.0282292496f, -0.0805728287f,
+    0.00183307659f, -0.0177662298f, -0.00727188634f, -0.0268711932f,
+    0.0271413624f, 0.0254772827f, -0.0415453836f, -0.0432094634f,
+    -0.00615491485f, -0.0219989419f, 0.0396321826f, 0.0237881541f,
+    -0.0800458938f, -0.0608661324f, -0.0303017031f, -0.0111219408f,
+    -0.00926965103f, 0.0246137679f, 0.0184927061f, 0.052376125f,
+    -0.0831606314f, -0.0142534235f, -0.0514411777f, 0.0174660292f,
+    0.0209551658f, -0.0988108516f, -0.0217003487f, -0.141466364f,
+    -0.0436071977f, -0.0867529139f, -0.0198097825f, -0.0629554987f,
+    -0.0681824982f, -0.0672119409f, 0.00508706272f, 0.0060576126f,
+    -0.132744864f, -0.0551540144f, 0.00697762892f, 0.0845684782f,
+    0.0135405269f, -0.0198281445f, 0.0271289013f, -0.00623977184f,
+    0.00425280072f, -0.0180224087f, -0.0115124583f, -0.0337876678f,
+    -0.05193308f, -0.0429819264f, 0.0188344382f, 0.0277855899f,
+    -0.0612208061f, -0.0411761887f, -0.0198069233f, 0.000237693399f,
+    -0.13556461f, -0.0513810553f, -0.0147314817f, 0.0694520697f,
+    -0.0279356837f, -0.0528512374f, 0.0301340912f, 0.00521853939f,
+    -0.142262444f, -0.0266944114f, -0.137256876f, -0.0216888525f,
+    -0.0346335098f, -0.0281645879f, -0.0923913047f, -0.0859223828f,
+    -0.0109629882f, 0.115874827f, 0.0125392601f, 0.139377072f,
+    -0.0272359233f, 0.0221460685f, -0.00720057264f, 0.0421814173f,
+    -0.0707272515f, 0.00545512885f, 0.0492958575f, 0.125478238f,
+    -0.0870001838f, -0.0882736221f, 0.0295560341f, 0.0282825939f,
+    0.155642003f, 0.16328913f, 0.0403141752f, 0.0479613058f,
+    0.0627026558f, -0.0401725546f, -0.0274813399f, -0.13035655f,
+    -0.0246918239f, 0.0415960178f, 0.0206379164f, 0.0869257599f,
+    -0.117631175f, -0.161865667f, -0.0471576005f, -0.0913920924f,
+    0.119149439f, 0.195651993f, 0.034087874f, 0.110590421f,
+    0.219412327f, 0.247129261f, 0.048899442f, 0.0766163766f,
+    -0.0401554406f, -0.0832397416f, -0.109383799f, -0.1524681f,
+    0.060107436f, -0.0317624658f, -0.0945722312f, -0.186442137f,
+    -0.0437321477f, -0.00643713772f, 0.0107131563f, 0.0480081663f,
+    -0.0731687173f, -0.024228476f, 0.0419679731f, 0.0909082144f,
+    -0.0292281099f, 0.0844102725f, 0.00052928552f, 0.114167668f,
+    -0.0586646833f, 0.0666189343f, 0.0317840986f, 0.157067716f,
+    0.0934977308f, -0.0377883427f, 0.0867764801f, -0.0445095971f,
+    -0.112410173f, -0.0456804335f, -0.0220231414f, 0.0447065979f,
+    0.160854355f, 0.150561213f, 0.0715542287f, 0.0612610951f,
+    -0.0450535454f, 0.142669141f, -0.0372453853f, 0.15047729f,
+    -0.17112188f, 0.0952340961f, -0.107446775f, 0.158909202f,
+    -0.000277582556f, 0.129952997f, -0.0550398752f, 0.075190708f,
+    -0.0528713651f, 0.0828938708f, -0.0253087804f, 0.110456452f,
+    0.117972933f, 0.117612779f, 0.0270981081f, 0.0267379526f,
+    -0.0964274555f, -0.0826699287f, -0.0727164f, -0.0589588769f,
+    -0.0500476807f, 0.056703344f, 0.0235140026f, 0.130265027f,
+    0.158198297f, 0.160089791f, 0.0514903031f, 0.0533817932f,
+    0.204578072f, 0.299463063f, 0.147720709f, 0.242605701f,
+    -0.0131952306f, -0.0113174561f, 0.0511463359f, 0.0530241095f,
+    -0.0365605541f, -0.0196368955f, 0.0730002224f, 0.089923881f,
+    0.0532444008f, 0.0278360657f, 0.0172319636f, -0.00817637239f,
+    0.0298790801f, 0.0195166282f, 0.0390858501f, 0.0287233982f,
+    -0.022539176f, -0.0597986206f, -0.0185443163f, -0.0558037646f,
+    -0.255324453f, -0.213728935f, -0.13295415f, -0.0913586169f,
+    0.0156782195f, 0.080773972f, -0.0202109683f, 0.0448847823f,
+    -0.217107072f, -0.0731563419f, -0.134620801f, 0.0093299225f,
+    -0.00939464569f, 0.0160456393f, 0.018767288f, 0.0442075729f,
+    -0.0112139583f, 0.037017785f, -0.0239901301f, 0.0242416151f,
+    0.0423507988f, 0.074784711f, 0.0664504468f, 0.098884359f,
+    0.0405314863f, 0.0957568586f, 0.0236930288f, 0.0789183974f,
+    0.272885114f, 0.320242822f, 0.0249683559f, 0.0723260641f,
+    0.36560896f, 0.372828484f, 0.0410817489f, 0.0483012646f,
+    -0.0192339458f, -0.00176110864f, 0.00538205681f, 0.0228548944f,
+    0.073489897f, 0.0508245453f, 0.0214954466f, -0.0011699039f,
+    -0.0120855868f, -0.0664578006f, -0.00314763188f, -0.0575198457f,
+    -0.0423694253f, -0.0431965739f, -0.0396957397f, -0.0405228883f,
+    0.0311464667f, -0.00834971573f, 0.0509851612f, 0.0114889797f,
+    0.000862628222f, 0.0149115128f, 0.0144370506f, 0.0284859352f,
+    -0.00538316369f, 0.0591597706f, -0.0224760026f, 0.0420669317f,
+    -0.0357865468f, 0.029458046f, 0.0159347132f, 0.0811793059f,
+    -0.0396407023f, 0.00346246548f, -0.0405082479f, 0.00259492174f,
+    -0.0700440854f, -0.0262392573f, -0.00209752843f, 0.0417072996f,
+    0.0964048356f, 0.096242696f, 0.0775709897f, 0.0774088576f,
+    -0.0460378714f, 0.00275578722f, -0.00232025981f, 0.0464733988f,
+    0.07035622f, 0.0393024646f, 0.0649865121f, 0.0339327604f,
+    -0.0720864832f, -0.054184448f, -0.0149047337f, 0.00299729872f,
+    -0.0153392656f, -0.0303459726f, 0.0142214345f, -0.000785271346f,
+    0.00534845702f, -0.0301808137f, 0.0254938658f, -0.0100354068f,
+    -0.0762134194f, -0.0761969164f, -0.0593980402f, -0.0593815371f,
+    -0.0555257015f, -0.0760317594f, -0.0481256098f, -0.0686316714f,
+    -0.224950254f, -0.00397617742f, -0.100826383f, 0.120147698f,
+    -0.212840155f, -0.134735227f, 0.00760328025f, 0.0857082009f,
+    -0.213711202f, -0.0404381417f, -0.0597497635f, 0.113523297f,
+    -0.201601103f, -0.171197206f, 0.0486798957f, 0.0790838003f,
+    0.123517647f, 0.097940661f, 0.0811869428f, 0.0556099601f,
+    -0.0345196575f, -0.0368633233f, 0.04044291f, 0.0380992442f,
+    0.14123404f, 0.110397369f, -0.0263639353f, -0.0572006181f,
+    -0.0168032628f, -0.0244066268f, -0.0671079755f, -0.0747113377f,
+    0.163319886f, 0.129457146f, -0.112327673f, -0.14619042f,
+    0.128722221f, 0.0292426087f, 0.0536864884f, -0.0457931235f,
+    -0.0343452469f, -0.0404691547f, -0.0635761917f, -0.0697000995f,
+    -0.0689429194f, -0.140683696f, 0.102437966f, 0.0306971967f,
+    -0.00887769181f, 0.130110919f, -0.0852023661f, 0.0537862442f,
+    0.0849944428f, 0.0557518974f, -0.0470090657f, -0.0762516111f,
+    -0.126459002f, 0.0604098588f, -0.121588513f, 0.0652803481f,
+    -0.0325868577f, -0.013949167f, -0.0833952129f, -0.0647575185f,
+    0.0247621089f, 0.140148133f, -0.0436812676f, 0.0717047527f,
+    -0.0121694319f, 0.0205763374f, 0.0587588698f, 0.0915046409f,
+    0.0521077849f, 0.110630281f, -0.0211275741f, 0.037394926f,
+    0.0151762441f, -0.00894151442f, 0.081312567f, 0.0571948104f,
+    0.130147099f, 0.124324977f, 0.0986711159f, 0.0928489938f,
+    0.292867661f, 0.223451138f, 0.0598829687f, -0.00953355059f,
+    -0.192275658f, -0.107693993f, -0.0644453838f, 0.0201362781f,
+    -0.0295550767f, -0.00856781751f, -0.103233524f, -0.0822462663f,
+    0.0491186231f, 0.0998858511f, -0.127855152f, -0.0770879313f,
+    0.0865837857f, -0.0300747566f, -0.036474105f, -0.153132647f,
+    -0.0963279977f, -0.0353730395f, -0.130540684f, -0.0695857257f,
+    -0.0588628352f, -0.165333658f, -0.0391596332f, -0.145630449f,
+    -0.204602942f, -0.208708912f, -0.0213325713f, -0.0254385509f,
+    -0.187473714f, -0.159754902f, 0.0576191097f, 0.085337922f,
+    -0.203748763f, -0.117785178f, -0.0609462708f, 0.0250173025f,
+    -0.186619535f, -0.0688311607f, 0.0180054046f, 0.135793775f,
+    -0.129810676f, -0.0745809674f, -0.065201968f, -0.00997226499f,
+    -0.0173890796f, -0.046813421f, 0.00925473683f, -0.0201696046f,
+    -0.0710329488f, -0.0700020865f, -0.0290023703f, -0.0279715061f,
+    0.0413886495f, -0.0422345363f, 0.0454543382f, -0.0381688438f,
+    -0.117899761f, -0.0450002998f, 0.0668181181f, 0.139717579f,
+    -0.130902439f, -0.0755508095f, 0.0742371753f, 0.129588813f,
+    -0.127308294f, -0.0357320197f, -0.0333778709f, 0.0581983998f,
+    -0.140310973f, -0.0662825257f, -0.0259588212f, 0.0480696261f,
+    0.0156570878f, 0.017199304f, 0.0701413006f, 0.0716835186f,
+    0.0535608307f, 0.0633799732f, 0.0951364934f, 0.104955643f,
+    0.0369129851f, 0.0529220998f, 0.0181213673f, 0.0341304801f,
+    0.0748167261f, 0.0991027653f, 0.0431165621f, 0.0674026012f,
+    0.122546278f, -0.0387804545f, 0.0876807645f, -0.0736459643f,
+    0.142592952f, -0.0910988525f, 0.197982907f, -0.035708908f,
+    0.102091104f, 0.00347260572f, 0.0519549176f, -0.0466635786f,
+    0.122137778f, -0.0488457941f, 0.162257046f, -0.00872652419f,
+    0.0279924478f, 0.011426542f, -0.0352340415f, -0.0517999455f,
+    -0.0238291323f, 0.0400194451f, -0.0473396406f, 0.0165089332f,
+    0.00546980835f, 0.00464053638f, -0.0183874406f, -0.0192167126f,
+    -0.0463517718f, 0.033233434f, -0.0304930396f, 0.0490921661f,
+    0.0297208838f, -0.0311169885f, -0.00707624853f, -0.0679141209f,
+    -0.0123284953f, -0.0470011793f, -0.0136111006f, -0.0482837856f,
+    0.00666105747f, -0.00300008431f, -0.040476162f, -0.0501373038f,
+    -0.0353883207f, -0.0188842751f, -0.0470110141f, -0.0305069685f,
+    0.0600358397f, 0.00188945234f, 0.0300912689f, -0.0280551203f,
+    0.0960478634f, 0.0180402547f, 0.0832026154f, 0.00519500487f,
+    -0.00241741724f, 0.01556677f, -0.00821069069f, 0.00977349561f,
+    0.0335946046f, 0.0317175724f, 0.044900652f, 0.0430236198f,
+    -0.0474288389f, -0.0518518947f, 0.0198706128f, 0.015447557f,
+    -0.0321305245f, -0.0652551949f, 0.0114885624f, -0.0216361098f,
+    0.026916042f, -0.0370271578f, 0.0309070144f, -0.0330361836f,
+    0.0422143564f, -0.050430458f, 0.0225249641f, -0.0701198503f,
+    0.183752969f, 0.135285497f, 0.18001616f, 0.131548688f,
+    0.186892003f, 0.239264995f, 0.188960135f, 0.241333142f,
+    0.133580968f, 0.115614295f, 0.117780805f, 0.0998141244f,
+    0.136720002f, 0.219593793f, 0.12672478f, 0.209598571f,
+    -0.0779258683f, -0.0380703844f, -0.0892726332f, -0.0494171493f,
+    0.042459216f, 0.123576641f, 0.0826674551f, 0.163784876f,
+    -0.059387248f, 0.114095435f, -0.0989266932f, 0.0745560005f,
+    0.0609978363f, 0.275742471f, 0.0730133951f, 0.287758023f,
+    0.0405550152f, -0.125749364f, -0.0169892386f, -0.183293626f,
+    0.0688103586f, -0.142473742f, 0.0254516006f, -0.1858325f,
+    0.041731853f, 0.0368286967f, 0.0326330289f, 0.0277298726f,
+    0.0699871927f, 0.0201043189f, 0.0750738829f, 0.0251910035f,
+    -0.0603953041f, 0.0579474941f, 0.0767992213f, 0.195142016f,
+    0.126681462f, 0.0579745397f, 0.154536873f, 0.0858299509f,
+    0.0136162713f, 0.0233582892f, 0.106997177f, 0.116739191f,
+    0.200693041f, 0.0233853366f, 0.184734836f, 0.00742712151f,
+    0.0546696819f, -0.198769942f, -0.0207956582f, -0.274235278f,
+    0.0469168127f, -0.291413426f, -0.0575383604f, -0.395868599f,
+    0.0671443939f, 0.0128875896f, 0.0589671507f, 0.00471035019f,
+    0.0593915209f, -0.0797559023f, 0.0222244523f, -0.116922967f,
+    0.0132986801f, 0.040451996f, 0.180733383f, 0.207886696f,
+    -0.0202546716f, 0.102854051f, 0.248043448f, 0.371152163f,
+    -0.0611054637f, 0.0884576738f, -0.0317219943f, 0.117841139f,
+    -0.0946588144f, 0.150859714f, 0.0355880633f, 0.281106591f,
+    0.00325283431f, -0.0647880062f, 0.0674205199f, -0.000620327832f,
+    0.0406425856f, 0.0159125328f, 0.286904931f, 0.262174875f,
+    -0.117275834f, -0.0362067856f, -0.0525371172f, 0.0285319313f,
+    -0.0798860863f, 0.0444937423f, 0.16694729f, 0.291327119f,
+    -0.092044279f, -0.19469209f, -0.178692222f, -0.281340033f,
+    -0.0371197574f, -0.142715484f, -0.253458023f, -0.359053761f,
+    -0.0770067945f, -0.0899200886f, -0.0642149895f, -0.0771282911f,
+    -0.0220822748f, -0.0379434861f, -0.138980806f, -0.154842019f,
+    -0.138439223f, -0.065219596f, -0.00417375565f, 0.0690458715f,
+    -0.026575977f, 0.0241415463f, -0.00850676373f, 0.0422107577f,
+    -0.144704565f, -0.0460855886f, -0.0722544938f, 0.0263644792f,
+    -0.0328413211f, 0.0432755426f, -0.0765875056f, -0.000470635772f,
+    0.141947925f, -0.105638444f, -0.0710748434f, -0.318661213f,
+    0.109406821f, -0.0617375374f, -0.156218752f, -0.327363104f,
+    0.0506045707f, 0.00516184047f, -0.0424470305f, -0.0878897607f,
+    0.0180634707f, 0.0490627587f, -0.127590925f, -0.0965916365f,
+    0.025289258f, 0.00860927254f, 0.0870739892f, 0.0703940019f,
+    0.0067354897f, 0.0207725223f, 0.0468737558f, 0.0609107912f,
+    -0.00158561766f, -0.00557400659f, 0.0869010836f, 0.0829126909f,
+    -0.0201393869f, 0.00658924505f, 0.0467008464f, 0.0734294802f,
+    -0.242138445f, -0.0431715026f, -0.0467479602f, 0.152218983f,
+    -0.433897436f, 0.0173350275f, -0.126355678f, 0.324876785f,
+    -0.0740271807f, 0.0086309351f, 0.0271338485f, 0.109791964f,
+    -0.265786171f, 0.0691374689f, -0.052473858f, 0.282449782f,
+    0.0374720618f, -0.00411738828f, 0.0750946999f, 0.0335052535f,
+    0.00316555798f, 0.0277875606f, 0.0604309812f, 0.085052982f,
+    0.0120126866f, -0.0211400874f, 0.0529234707f, 0.019770693f,
+    -0.0222938173f, 0.0107648615f, 0.0382597372f, 0.0713184178f,
+    -0.0580814183f, -0.0683731139f, -0.0491604283f, -0.0594521277f,
+    0.0256147701f, -0.0230144039f, 0.0463709459f, -0.00225822628f,
+    -0.0348139033f, -0.019974051f, -0.00418939255f, 0.0106504597f,
+    0.048882287f, 0.0253846627f, 0.0913419873f, 0.0678443611f,
+    0.0786760524f, 0.0374965966f, 0.0318801478f, -0.00929930527f,
+    0.0669889003f, 0.0286165513f, 0.0487541817f, 0.0103818327f,
+    0.11645063f, 0.072016336f, 0.0591696016f, 0.0147353066f,
+    0.104763478f, 0.0631362945f, 0.0760436356f, 0.0344164446f,
+    -0.0243248753f, -0.0415399224f, -0.0245686341f, -0.041783683f,
+    -0.0856571048f, -0.0369797647f, -0.0721896887f, -0.0235123504f,
+    -0.00650360622f, -0.0257546995f, 0.0159819592f, -0.00326913176f,
+    -0.0678358376f, -0.0211945362f, -0.0316390991f, 0.0150022013f,
+    -0.091373831f, -0.0712314621f, 0.0729872957f, 0.0931296647f,
+    -0.016983524f, 0.11072813f, 0.0467446707f, 0.174456328f,
+    0.169729069f, 0.0714540109f, 0.149185672f, 0.0509106107f,
+    0.244119376f, 0.253413588f, 0.122943044f, 0.13223727f,
+    0.194878429f, 0.148719177f, 0.0132817421f, -0.032877516f,
+    0.319541365f, 0.255550504f, 0.11552082f, 0.0515299477f,
+    0.223574877f, 0.0793047249f, 0.0668709576f, -0.0773991942f,
+    0.348237813f, 0.186136052f, 0.169110045f, 0.00700827502f,
+    -0.308251709f, -0.208638772f, -0.0900123045f, 0.00960062724f,
+    -0.320107847f, -0.406663179f, -0.214548916f, -0.301104248f,
+    -0.057012625f, -0.0549301319f, -0.157909453f, -0.155826971f,
+    -0.0688687712f, -0.252954543f, -0.282446086f, -0.466531843f,
+    -0.0540243611f, 0.0493192673f, 0.00166549534f, 0.105009124f,
+    -0.0982980877f, -0.101401649f, -0.120323144f, -0.123426706f,
+    -0.085802868f, 0.00436610915f, -0.029558368f, 0.0606106073f,
+    -0.130076587f, -0.146354795f, -0.151547015f, -0.167825222f,
+    -0.284837097f, -0.301756233f, -0.117990963f, -0.134910092f,
+    -0.332812548f, -0.382860899f, -0.0626795292f, -0.112727888f,
+    -0.170516312f, -0.177851856f, -0.0498662256f, -0.0572017655f,
+    -0.218491763f, -0.258956522f, 0.00544518791f, -0.0350195654f,
+    0.0715058967f, -0.0292499587f, -0.130395636f, -0.231151491f,
+    0.0779989958f, -0.0418814868f, -0.188438103f, -0.308318585f,
+    0.0425906554f, 0.0248779431f, -0.0382586494f, -0.0559713617f,
+    0.0490837507f, 0.0122464076f, -0.0963011235f, -0.133138463f,
+    -0.154785007f, -0.0663419887f, -0.0785157457f, 0.00992727838f,
+    -0.111096099f, 0.0790305287f, -0.157144338f, 0.0329822749f,
+    -0.0976314396f, 0.0524719618f, -0.0513397343f, 0.098763667f,
+    -0.0539425276f, 0.197844476f, -0.129968345f, 0.121818662f,
+    -0.134851843f, -0.0304374434f, -0.0853328481f, 0.0190815534f,
+    -0.123779729f, -0.116055325f, -0.0257514045f, -0.0180270001f,
+    -0.0795906186f, -0.0675718859f, -0.0399487168f, -0.0279299859f,
+    -0.068518512f, -0.153189763f, 0.0196327195f, -0.0650385395f,
+    0.108118974f, 0.0586167388f, -0.0580300353f, -0.10753227f,
+    0.0487649813f, 0.0588003993f, -0.109531879f, -0.099496454f,
+    0.0643357635f, 0.042399168f, 0.038588576f, 0.0166519806f,
+    0.00498177391f, 0.042582836f, -0.0129132578f, 0.0246878024f,
+    -0.00638836995f, 0.0228229072f, 0.0603780076f, 0.0895892829f,
+    -0.0254126154f, 0.105733477f, 0.0267775357f, 0.157923624f,
+    0.0469854511f, 0.0801540837f, 0.0412199348f, 0.0743885636f,
+    0.027961202f, 0.163064644f, 0.00761945546f, 0.142722905f,
+    0.0355984978f, 0.0620249286f, -0.00884755887f, 0.0175788701f,
+    -0.0320573226f, -0.00359991938f, -0.0270754993f, 0.00138190202f,
+    0.0104879495f, 0.0687871873f, 0.00920831412f, 0.0675075501f,
+    -0.0571678691f, 0.00316233933f, -0.00901963003f, 0.0513105802f,
+    -0.0777776688f, 0.0769298971f, 0.117548391f, 0.272255957f,
+    0.0852705538f, 0.187681913f, 0.0668308735f, 0.169242233f,
+    -0.234406635f, -0.168546095f, -0.0511251613f, 0.0147353709f,
+    -0.07135842f, -0.0577940941f, -0.101842679f, -0.0882783532f,
+    0.0503443778f, 0.0281424429f, -0.0232103784f, -0.0454123132f,
+    0.0337755792f, 0.0565856472f, 0.00169311836f, 0.0245031826f,
+    0.0173168778f, -0.00257832743f, 0.0165835414f, -0.00331166387f,
+    0.000748078048f, 0.0258648712f, 0.0414870381f, 0.0666038319f,
+    0.070875302f, 0.0184222888f, 0.0811328739f, 0.0286798589f,
+    0.0940254182f, 0.0264185593f, 0.0678373426f, 0.000230483711f,
+    0.0341478884f, 0.00137196481f, -0.0208499655f, -0.0536258891f,
+    0.0572980046f, 0.00936823338f, -0.0341454968f, -0.082075268f,
+    0.00234519597f, 0.0629682392f, 0.0281018727f, 0.0887249187f,
+    0.028406946f, 0.0421676859f, 0.0497894362f, 0.0635501742f,
+    -0.00527519174f, 0.0307526775f, -0.0173070207f, 0.0187208503f,
+    0.0207865573f, 0.00995212235f, 0.00438053953f, -0.00645389501f,
+    0.0334786698f, -0.0442289338f, 0.00339014828f, -0.0743174553f,
+    0.0217125453f, -0.0146777285f, -0.0191237777f, -0.0555140525f,
+    -0.0224719699f, -0.0685447976f, 0.00247452594f, -0.043598298f,
+    -0.0342380926f, -0.0389935896f, -0.0200394019f, -0.0247948971f,
+    -0.0957561284f, -0.0816978589f, 0.00260900427f, 0.016667271f,
+    -0.185046792f, -0.186753765f, -0.0842103809f, -0.0859173536f,
+    -0.102387019f, -0.145326957f, 0.0163852107f, -0.0265547298f,
+    -0.191677675f, -0.25038287f, -0.070434168f, -0.129139349f,
+    0.085845992f, 0.0041038366f, 0.110702753f, 0.0289605949f,
+    -0.000403504819f, -0.0930967778f, 0.0727280229f, -0.0199652538f,
+    0.0626625121f, 0.0283561386f, 0.137759447f, 0.103453085f,
+    -0.023586981f, -0.0688444749f, 0.0997847244f, 0.054527238f,
+    0.0937104225f, 0.096198678f, 0.171628445f, 0.174116716f,
+    -0.0440544635f, 0.112904757f, 0.170237914f, 0.327197134f,
+    0.144477889f, 0.0161931813f, 0.231552526f, 0.103267819f,
+    0.00671301456f, 0.0328992531f, 0.230161995f, 0.256348222f,
+    -0.191547334f, -0.136903137f, -0.0020063892f, 0.0526378155f,
+    -0.542421818f, -0.357530177f, -0.160130098f, 0.0247615352f,
+    -0.234007388f, -0.244693577f, -0.087911211f, -0.0985973924f,
+    -0.584881842f, -0.465320587f, -0.24603492f, -0.12647368f,
+    -0.00627715839f, -0.00807151571f, 0.066203475f, 0.0644091219f,
+    -0.0997726321f, -0.317574978f, -0.0931871831f, -0.310989529f,
+    -0.0454548001f, -0.129368186f, 0.12568137f, 0.0417679846f,
+    -0.138950273f, -0.438871652f, -0.0337092876f, -0.333630681f,
+    -0.113139719f, -0.16423738f, -0.0702394545f, -0.121337101f,
+    0.196426138f, 0.126121998f, 0.0770270899f, 0.0067229569f,
+    -0.303926289f, -0.310999751f, -0.2028054f, -0.209878847f,
+    0.00563954422f, -0.0206403732f, -0.0555388704f, -0.0818187892f,
+    -0.0158259664f, 0.0786324516f, 0.0184007213f, 0.112859137f,
+    -0.226840883f, -0.215541512f, -0.0637438223f, -0.0524444431f,
+    -0.211313233f, -0.310678005f, -0.00226167589f, -0.101626426f,
+    -0.422328144f, -0.604851902f, -0.0844062269f, -0.266930014f,
+    0.207873836f, -0.0790807307f, 0.0531102568f, -0.23384431f,
+    0.225676358f, -0.222822368f, 0.0217272341f, -0.426771492f,
+    0.143550456f, 0.042075485f, 0.0427840799f, -0.0586908907f,
+    0.161352977f, -0.10166616f, 0.0114010572f, -0.251618087f,
+    -0.0174401551f, -0.00214581564f, -0.0990391374f, -0.0837447941f,
+    0.0488355979f, 0.0211422052f, -0.0254406426f, -0.0531340353f,
+    -0.0320673957f, -0.0428921357f, -0.0535872728f, -0.0644120127f,
+    0.0342083611f, -0.0196041111f, 0.0200112201f, -0.0338012502f,
+    0.0493061356f, -0.0458358414f, -0.0956852436f, -0.190827221f,
+    0.119669646f, -0.0473097637f, -0.0752026364f, -0.242182046f,
+    0.172446907f, 0.00480554253f, -0.0225175396f, -0.190158904f,
+    0.242810413f, 0.00333161652f, -0.00203493237f, -0.241513729f,
+    0.0794850141f, 0.0290068947f, -0.018023137f, -0.0685012564f,
+    0.0594711006f, 0.0184717588f, 0.024003204f, -0.0169961359f,
+    0.0585443377f, 0.016001232f, 0.0184138641f, -0.0241292417f,
+    0.0385304205f, 0.00546609424f, 0.060440205f, 0.0273758769f,
+    0.286624581f, 0.359825373f, 0.16640529f, 0.239606082f,
+    0.0832553282f, 0.125012964f, 0.125937432f, 0.16769506f,
+    0.0649746135f, 0.109839424f, 0.05805685f, 0.102921657f,
+    -0.138394639f, -0.124972992f, 0.0175889842f, 0.0310106371f,
+    0.0454815924f, -0.04768591f, 0.0299001969f, -0.0632673055f,
+    0.0374027975f, -0.0439313352f, 0.0378169864f, -0.0435171463f,
+    0.085923776f, 0.000623196829f, 0.0749428496f, -0.0103577292f,
+    0.0778449774f, 0.00437777024f, 0.0828596354f, 0.00939243101f,
+    -0.0683330223f, 0.0210761223f, -0.016317904f, 0.0730912387f,
+    -0.0458128043f, -0.00967187807f, -0.0604516864f, -0.0243107602f,
+    0.0222344846f, 0.0598748848f, 0.00982119143f, 0.0474615917f,
+    0.0447547063f, 0.0291268863f, -0.0343125872f, -0.0499404073f,
+    -0.0276047587f, 0.0599052981f, 0.0277808309f, 0.115290888f,
+    0.0293495376f, -0.0122381458f, 0.0518603697f, 0.0102726873f,
+    0.0173393544f, 0.0393720455f, 0.0718464702f, 0.0938791633f,
+    0.0742936507f, -0.0327713937f, 0.0959260166f, -0.0111390315f,
+    0.00677063083f, 0.0126371179f, -0.0129240155f, -0.00705752801f,
+    -0.00726133958f, -0.0250053518f, 0.00948649365f, -0.00825751759f,
+    0.0707306713f, 0.0594856888f, 0.0341598466f, 0.0229148678f,
+    0.0566987023f, 0.021843221f, 0.0565703586f, 0.0217148773f,
+    -0.187169492f, -0.285789728f, -0.158690825f, -0.257311046f,
+    -0.0459184088f, -0.207507998f, -0.0701943412f, -0.231783926f,
+    -0.112753995f, -0.0755188242f, -0.0878617615f, -0.0506265908f,
+    0.0284970831f, 0.00276289042f, 0.00063472148f, -0.0250994712f,
+    -0.0513650291f, -0.140599474f, 0.0376652628f, -0.051569175f,
+    -0.123736434f, -0.0754701048f, 0.0327023119f, 0.0809686407f,
+    -0.137685806f, -0.0744059086f, -0.108031511f, -0.0447516218f,
+    -0.210057214f, -0.00927655026f, -0.112994462f, 0.0877861977f,
+    0.0953832865f, 0.158281818f, 0.0179448538f, 0.0808433816f,
+    -0.308985293f, -0.16826278f, -0.0678659678f, 0.0728565454f,
+    0.078580603f, 0.140544876f, 0.0217839777f, 0.0837482512f,
+    -0.325787991f, -0.185999736f, -0.0640268475f, 0.0757614151f,
+    -0.0497489721f, -0.124771655f, -0.0244420059f, -0.0994646922f,
+    -0.0896000117f, -0.204730064f, 0.0071227774f, -0.108007267f,
+    -0.0155200697f, -0.007395491f, 0.0414388999f, 0.0495634824f,
+    -0.0553711131f, -0.0873538852f, 0.0730036795f, 0.0410209037f,
+    0.250537813f, 0.227436453f, 0.0963645875f, 0.073263213f,
+    -0.0152609982f, -0.0671079308f, -0.0639003217f, -0.115747251f,
+    0.163827509f, 0.0848080963f, 0.0202650093f, -0.0587544069f,
+    -0.101971306f, -0.209736273f, -0.139999896f, -0.247764871f,
+    0.0114536406f, 0.103866771f, 0.0369276702f, 0.129340798f,
+    0.0599105954f, 0.168404013f, -0.0124070421f, 0.096086368f,
+    -0.0261407364f, 0.0225096568f, -0.0244534668f, 0.0241969265f,
+    0.0223162137f, 0.0870468915f, -0.0737881809f, -0.00905750133f,
+    0.122516409f, 0.0911456198f, 0.0429015309f, 0.0115307458f,
+    -0.0541736484f, -0.0734270215f, 0.0160873197f, -0.00316605717f,
+    -0.116302684f, -0.107422933f, -0.0762497783f, -0.0673700273f,
+    -0.292992741f, -0.271995574f, -0.103063993f, -0.082066834f,
+    0.0139388368f, 0.207927555f, 0.0201329216f, 0.214121655f,
+    0.147911787f, 0.141854703f, 0.00165402144f, -0.00440306962f,
+    0.131642982f, 0.163620368f, 0.0105909109f, 0.0425682962f,
+    0.26561594f, 0.0975475013f, -0.00788798928f, -0.175956428f,
+    0.0879479498f, 0.018984668f, -0.0201146528f, -0.0890779346f,
+    0.118592449f, 0.0646413118f, 0.0137299094f, -0.0402212255f,
+    0.0215506237f, -0.0456246659f, 0.0115056727f, -0.0556696169f,
+    0.0521951206f, 3.19769606e-05f, 0.045350235f, -0.00681290962f,
+    -0.0623698831f, 0.013507897f, -0.0206446853f, 0.0552330948f,
+    -0.0989643112f, -0.0632842556f, -0.11502701f, -0.0793469548f,
+    0.176301986f, 0.0239759795f, 0.0804502368f, -0.0718757734f,
+    0.13970755f, -0.0528161824f, -0.013932094f, -0.206455827f,
+    0.00947102904f, -0.0642220229f, -0.00481185317f, -0.0785049051f,
+    -0.0251507666f, -0.0558461621f, -0.0466440469f, -0.0773394406f,
+    0.0556162596f, -0.0242730752f, 0.0680722669f, -0.011817066f,
+    0.0209944658f, -0.0158972107f, 0.026240075f, -0.0106515987f,
+    0.147046551f, 0.085415706f, -0.0874369517f, -0.149067789f,
+    -0.0328910053f, 0.168993369f, -0.083453849f, 0.118430518f,
+    0.009680897f, -0.0609488524f, -0.0586166196f, -0.129246369f,
+    -0.170256659f, 0.0226287991f, -0.054633528f, 0.13825193f,
+    -0.0686561763f, -0.0493816435f, -0.00192235783f, 0.017352175f,
+    0.0293040648f, -0.0237154122f, 0.0263702888f, -0.0266491883f,
+    -0.0255182534f, -0.00141936075f, -0.0051477449f, 0.0189511478f,
+    0.0724419877f, 0.0242468715f, 0.0231449008f, -0.0250502136f,
+    0.0272401478f, -0.0610645711f, 0.0116979778f, -0.076606743f,
+    0.0634729266f, 0.0082200272f, 0.0395978652f, -0.0156550352f,
+    0.00525124837f, -0.0127912182f, -0.0286733489f, -0.0467158146f,
+    0.0414840281f, 0.0564933829f, -0.000773460139f, 0.0142358942f,
+    0.111181788f, 0.135006353f, 0.123310275f, 0.14713484f,
+    0.0712188631f, 0.0529237762f, 0.0645332411f, 0.0462381579f,
+    0.0903635919f, 0.101933897f, 0.0835311264f, 0.0951014385f,
+    0.0504006706f, 0.0198513251f, 0.0247540977f, -0.00579524739f,
+    -0.083196044f, -0.0391008705f, -0.0477024093f, -0.00360723352f,
+    -0.0681801662f, -0.0444590971f, 0.0139320195f, 0.0376530848f,
+    -0.00481107179f, 0.00816594064f, -0.00864753406f, 0.00432947837f,
+    0.0102048125f, 0.00280771405f, 0.0529868975f, 0.0455897972f,
+    -0.0486947149f, -0.128435239f, -0.0209912658f, -0.100731798f,
+    -0.274136066f, -0.163152933f, -0.201835334f, -0.090852201f,
+    -0.0668413788f, -0.0517431907f, 0.0125649311f, 0.0276631191f,
+    -0.29228273f, -0.0864608809f, -0.168279141f, 0.0375427157f,
+    -0.0829102993f, -0.109977543f, -0.0890449733f, -0.116112217f,
+    -0.0145514831f, -0.112540558f, -0.0536823459f, -0.151671425f,
+    0.08924523f, 0.0954884365f, -0.00928480271f, -0.00304159708f,
+    0.157604054f, 0.0929254219f, 0.0260778274f, -0.0386008061f,
+    0.123092502f, 0.179760277f, 0.00928088278f, 0.0659486651f,
+    -0.010037018f, 0.0581872426f, -0.0723308772f, -0.00410661846f,
+    0.140187189f, 0.15291366f, -0.0526367389f, -0.0399102643f,
+    0.00705767004f, 0.0313406214f, -0.134248495f, -0.109965548f,
+    -0.0224442817f, -0.113879189f, -0.0169078298f, -0.10834273f,
+    -0.293047607f, -0.283524692f, -0.150708109f, -0.141185209f,
+    -0.0982882306f, -0.0490697548f, -0.0454955697f, 0.00372290891f,
+    -0.368891567f, -0.21871528f, -0.179295868f, -0.0291195679f,
+    0.256907165f, 0.228830755f, 0.128360361f, 0.100283958f,
+    0.0729948729f, 0.0619466901f, -0.0162891299f, -0.0273373127f,
+    0.122643575f, -0.0396158732f, 0.113380864f, -0.0488785729f,
+    -0.0612687208f, -0.206499934f, -0.0312686265f, -0.176499844f,
+    0.0882504061f, -0.0077865459f, 0.0146965869f, -0.0813403651f,
+    0.0723883286f, 0.154724374f, 0.0192498825f, 0.101585925f,
+    -0.0665336102f, -0.186059564f, -0.0737019032f, -0.193227857f,
+    -0.0823956877f, -0.0235486496f, -0.0691486001f, -0.0103015648f,
+    -0.0719729513f, -0.135465324f, -0.0177336261f, -0.0812260062f,
+    -0.162042782f, -0.198585525f, -0.055349078f, -0.0918918177f,
+    -0.119933426f, -0.202325881f, -0.0669325069f, -0.149324954f,
+    -0.210003257f, -0.265446067f, -0.104547963f, -0.159990773f,
+    0.243096888f, 0.288087696f, 0.0554103106f, 0.100401118f,
+    0.0791565701f, 0.16988419f, -0.0315368399f, 0.0591907725f,
+    0.0796977207f, 0.020964399f, 0.0514851511f, -0.00724816881f,
+    -0.0842425972f, -0.0972391143f, -0.0354619995f, -0.0484585129f,
+    0.133781895f, 0.0499817058f, 0.126812622f, 0.0430124328f,
+    0.00134692341f, 0.00769498106f, 0.00680005457f, 0.0131481122f,
+    0.04342537f, 0.0394136906f, 0.0483768061f, 0.0443651266f,
+    -0.0890096053f, -0.00287303608f, -0.0716357604f, 0.0145008061f,
+    0.115043104f, 0.0493192747f, -0.0237621143f, -0.0894859433f,
+    0.0817769766f, 0.0172700174f, 0.0418828987f, -0.0226240586f,
+    0.125287905f, 0.00513576437f, 0.103367291f, -0.0167848524f,
+    0.0920217708f, -0.026913492f, 0.169012293f, 0.0500770323f,
+    -0.0572499931f, -0.0630815476f, -0.0470840707f, -0.0529156253f,
+    -0.00450608553f, -0.00973961037f, -0.0147496145f, -0.0199831389f,
+    -0.040995229f, -0.0273601729f, 0.00351630244f, 0.0171513595f,
+    0.0117486818f, 0.025981769f, 0.0358507596f, 0.0500838459f,
+    -0.308641553f, -0.280428559f, 0.0374667458f, 0.0656797215f,
+    0.0173473656f, -0.0181251578f, 0.0771052539f, 0.0416327268f,
+    -0.173911363f, -0.110458493f, 0.00454545021f, 0.0679983124f,
+    0.152077541f, 0.151844904f, 0.0441839471f, 0.0439513139f,
+    0.0775816292f, 0.0219687112f, 0.0144041441f, -0.0412087739f,
+    0.0230956431f, 0.0168168303f, 0.00211815536f, -0.00416065753f,
+    0.055438906f, 0.0100136288f, -0.024754161f, -0.0701794401f,
+    0.000952919363f, 0.00486174598f, -0.0370401517f, -0.0331313238f,
+    -0.0128562059f, 0.00233253464f, 0.039105691f, 0.0542944297f,
+    0.0151638249f, -0.0280835405f, 0.00911978632f, -0.0341275781f,
+    -0.0557573438f, -0.0159389395f, -0.00304374844f, 0.0367746539f,
+    -0.0277373102f, -0.0463550165f, -0.0330296531f, -0.0516473576f,
+    -0.0929601789f, -0.0537894443f, 0.0213619862f, 0.0605327226f,
+    -0.12508598f, -0.111548349f, -0.0544094406f, -0.0408718064f,
+    -0.0606657155f, -0.0800660849f, 0.0540305972f, 0.0346302278f,
+    -0.0927915201f, -0.137824997f, -0.0217408277f, -0.0667743012f,
+    0.0802954063f, 0.0568686575f, 0.0287838932f, 0.00535714626f,
+    0.0476447903f, 0.0353902429f, -0.00906795077f, -0.0213225f,
+    0.0283026453f, 0.0287730582f, 0.0352156647f, 0.0356860757f,
+    -0.00434797024f, 0.00729463995f, -0.00263617933f, 0.00900643133f,
+    -0.0192070547f, -0.0252838507f, 0.068217583f, 0.0621407852f,
+    -0.221895754f, -0.0998792574f, 0.022331275f, 0.144347772f,
+    -0.0260142162f, -0.0451494232f, 0.0731080249f, 0.0539728217f,
+    -0.228702918f, -0.119744837f, 0.0272217169f, 0.136179805f,
+    0.0596598797f, 0.212431669f, 0.0639683381f, 0.216740131f,
+    0.0496135615f, 0.145291835f, 0.0780011788f, 0.173679441f,
+    -0.0770203024f, 0.0560858548f, 0.0187851042f, 0.151891261f,
+    -0.087066628f, -0.0110539868f, 0.0328179449f, 0.108830586f,
+    0.03530287f, 0.107687727f, -0.0312589705f, 0.0411258861f,
+    0.0828623325f, 0.10070616f, 0.0318374783f, 0.0496813059f,
+    -0.261089265f, -0.164549947f, -0.174714744f, -0.0781754255f,
+    -0.213529795f, -0.171531513f, -0.111618295f, -0.0696200132f,
+    -0.0758775398f, -0.219828323f, 0.00565774739f, -0.138293028f,
+    -0.195587009f, -0.285837919f, -0.00167686492f, -0.0919277817f,
+    -0.0421990566f, 0.00513095036f, 0.0260919854f, 0.0734219924f,
+    -0.161908522f, -0.0608786494f, 0.0187573694f, 0.119787246f,
+    0.0320357047f, -0.0500398502f, -0.0354648568f, -0.117540412f,
+    0.013885878f, -0.00390216708f, -0.117500752f, -0.135288805f,
+    -0.169155389f, -0.250623018f, -0.0893295407f, -0.170797169f,
+    -0.187305227f, -0.204485327f, -0.17136547f, -0.18854557f,
+    -0.122347765f, -0.209004104f, -0.0267006718f, -0.113357008f,
+    0.0444556177f, -0.112091802f, -0.0345093384f, -0.191056758f,
+    0.0790947005f, 0.0912612081f, 0.0499971695f, 0.0621636771f,
+    0.245898083f, 0.188173503f, 0.0421884991f, -0.0155360764f,
+    -0.0479530729f, -0.152384654f, 0.127718344f, 0.0232867692f,
+    -0.0208824184f, -0.0679858774f, 0.0548535399f, 0.00775007717f,
+    0.0131504592f, -0.0256426167f, 0.0695428997f, 0.0307498239f,
+    0.0402211137f, 0.0587561503f, -0.00332190562f, 0.01521313f,
+    -0.0568721332f, 0.0619992502f, -0.0890343338f, 0.0298370495f,
+    0.0669778436f, 0.0308252536f, -0.0216353275f, -0.0577879176f,
+    -0.0302722529f, -0.0040250998f, -0.0402623415f, -0.0140151866f,
+    0.0935777277f, -0.0351990946f, 0.0271366648f, -0.101640157f,
+    0.00537981465f, -0.00960946269f, 0.044614695f, 0.0296254158f,
+    0.0222557932f, 0.0567816123f, 0.00504910201f, 0.0395749211f,
+    0.0154271321f, 0.0200290643f, -0.0255288593f, -0.0209269281f,
+    0.0323031098f, 0.0864201412f, -0.0650944486f, -0.0109774219f,
+    0.0169383734f, 0.0181764364f, -0.0207142234f, -0.0194761585f,
+    0.066715084f, 0.0456351638f, -0.0265711863f, -0.0476511084f,
+    -0.0292487144f, -0.007917298f, 0.0120635498f, 0.0333949663f,
+    0.0205279943f, 0.0195414294f, 0.00620658649f, 0.00522002112f,
+    -0.0492880344f, 0.0198674276f, -0.0558674112f, 0.0132880509f,
+    0.00554220565f, 0.0377501845f, 0.0116179334f, 0.0438259132f,
+    -0.0323023871f, 0.0332422368f, -0.0184328649f, 0.0471117608f,
+    0.0225278549f, 0.0511249974f, 0.0490524843f, 0.0776496232f,
+    -0.0842657983f, -0.0398824513f, 0.00650124252f, 0.0508845933f,
+    -0.109644778f, -0.118271932f, 0.133530512f, 0.124903351f,
+    -0.0648070052f, -0.0489394926f, 0.037027508f, 0.052895017f,
+    -0.090185985f, -0.127328992f, 0.164056778f, 0.126913771f,
+    -0.0022877953f, 0.00517587271f, 0.0224257372f, 0.0298894048f,
+    0.0114264786f, 0.0401048288f, 0.00471429713f, 0.0333926491f,
+    -0.041718632f, -0.0263341386f, 0.00641013496f, 0.0217946284f,
+    -0.0280043595f, 0.00859481562f, -0.0113013042f, 0.0252978709f,
+    0.0783447623f, 0.0570229739f, 0.043982558f, 0.0226607732f,
+    0.0924181715f, 0.0681224167f, 0.0403802916f, 0.0160845332f,
+    0.0342306718f, 0.0337031931f, 0.0270066727f, 0.0264791958f,
+    0.048304081f, 0.0448026359f, 0.0234044008f, 0.0199029557f,
+    -0.0272348765f, 0.070740968f, 0.00650796667f, 0.104483813f,
+    -0.0283144359f, 0.0642243102f, -0.00130070746f, 0.0912380368f,
+    0.0249825083f, 0.0320747159f, 0.0325290933f, 0.039621301f,
+    0.0239029489f, 0.0255580544f, 0.0247204192f, 0.0263755247f,
+    0.053045474f, 0.0159052871f, -0.0212830938f, -0.0584232807f,
+    0.0250513032f, 0.0191465002f, 0.0272136573f, 0.0213088542f,
+    -0.0238891095f, -0.025907455f, -0.0412316918f, -0.0432500392f,
+    -0.0518832803f, -0.022666242f, 0.00726505648f, 0.0364820957f,
+    0.0667400882f, 0.0514316671f, 0.143202752f, 0.127894327f,
+    0.184715182f, 0.157306761f, 0.159882396f, 0.132473975f,
+    0.00505905598f, -0.0952211618f, 0.046181526f, -0.054098703f,
+    0.123034142f, 0.010653913f, 0.0628611669f, -0.049519062f,
+    0.0353472047f, -0.0172077548f, -0.0222587641f, -0.0748137236f,
+    0.00494081341f, 0.0282487608f, -0.016717542f, 0.00659040362f,
+    0.051870741f, -0.0255541857f, 0.0244475771f, -0.0529773496f,
+    0.0214643516f, 0.0199023262f, 0.0299887992f, 0.0284267738f,
+    -0.097772114f, -0.204680964f, -0.0497461893f, -0.156655043f,
+    -0.0906761214f, -0.357996404f, -0.0800937563f, -0.347414017f,
+    -0.0693695247f, -0.0319838896f, -0.108989112f, -0.071603477f,
+    -0.0622735359f, -0.185299307f, -0.139336675f, -0.26236245f,
+    0.0504887328f, 0.0191021021f, 0.0701958537f, 0.038809225f,
+    -0.0988023803f, -0.232208103f, 0.0340453349f, -0.099360384f,
+    -0.0859784484f, -0.135067225f, 0.0557239093f, 0.0066351369f,
+    -0.235269561f, -0.386377424f, 0.0195733905f, -0.131534472f,
+    -0.0142704891f, -0.140818968f, -0.0191017278f, -0.145650208f,
+    -0.146719903f, -0.12401852f, 0.0239667036f, 0.0466680899f,
+    0.243272185f, -0.00104539841f, 0.128196448f, -0.116121128f,
+    0.11082276f, 0.0157550611f, 0.171264872f, 0.0761971772f,
+    0.0804804116f, 0.136214465f, -0.0101043414f, 0.0456297137f,
+    -0.0520892963f, 0.15737015f, 0.00316738337f, 0.21262683f,
+    -0.0541906133f, 0.0229456462f, -0.00408985838f, 0.0730464011f,
+    -0.186760321f, 0.0441013351f, 0.00918186456f, 0.240043521f,
+    -0.0330531001f, 0.0409734212f, -0.0126517769f, 0.0613747425f,
+    -0.238780767f, -0.0304522738f, -0.0552247465f, 0.153103739f,
+    -0.0623967275f, -0.0270849578f, 0.00334942713f, 0.0386611968f,
+    -0.268124402f, -0.0985106528f, -0.0392235518f, 0.130390197f,
+    -0.0970579013f, -0.00422536582f, -0.0478193127f, 0.0450132266f,
+    -0.0760481283f, -0.0249709226f, 0.0439895466f, 0.0950667486f,
+    -0.0108928215f, 0.0210658498f, -0.123972759f, -0.0920140818f,
+    0.0101169534f, 0.000320291147f, -0.0321638882f, -0.0419605523f,
+    0.0724076629f, 0.105919585f, 0.0499923974f, 0.0835043192f,
+    0.0869710892f, 0.0962709188f, 0.0369236581f, 0.046223484f,
+    0.0308732539f, 0.0302005447f, 0.0176942348f, 0.0170215257f,
+    0.0454366766f, 0.0205518752f, 0.00462549273f, -0.0202593077f,
+    0.0887986645f, 0.0215556808f, -0.0183660742f, -0.0856090561f,
+    0.122374699f, 0.0036768578f, 0.0463663153f, -0.0723315254f,
+    0.0700462982f, -0.00376383215f, -0.0172269568f, -0.0910370871f,
+    0.103622332f, -0.0216426551f, 0.0475054272f, -0.0777595565f,
+    0.00197040057f, -0.0678054467f, 0.00746979378f, -0.0623060577f,
+    0.0455500856f, -0.0198104214f, 0.0206608418f, -0.0446996652f,
+    0.0238098577f, -0.034145575f, 0.0526367985f, -0.00531863701f,
+    0.0673895404f, 0.0138494531f, 0.0658278391f, 0.0122877564f,
+    -0.138032168f, -0.00711989775f, -0.0371393152f, 0.0937729552f,
+    -0.237680033f, -0.0172733366f, -0.0447717458f, 0.17563495f,
+    -0.00614378974f, 0.0542028323f, 0.0394725949f, 0.0998192206f,
+    -0.105791651f, 0.0440494008f, 0.0318401642f, 0.181681216f,
+    -0.0585418455f, 0.0132862478f, -0.00995251909f, 0.0618755743f,
+    0.0278665535f, -0.000242693583f, 0.0287723821f, 0.000663136598f,
+    -0.0274323616f, 0.0479022749f, -0.00256135687f, 0.0727732778f,
+    0.0589760356f, 0.0343733281f, 0.0361635424f, 0.0115608377f,
+    -0.00885304809f, 0.0341062695f, -0.047195591f, -0.00423627114f,
+    -0.0665448904f, -0.0154947899f, -0.101790637f, -0.0507405326f,
+    -0.0227904953f, -0.00441116281f, -0.049507454f, -0.0311281197f,
+    -0.0804823339f, -0.0540122204f, -0.1041025f, -0.0776323825f,
+    -0.0395155214f, -0.102433711f, -0.0786748677f, -0.141593054f,
+    0.0170313884f, -0.0281076767f, -0.0401929952f, -0.0853320584f,
+    -0.0677769035f, -0.0716870278f, -0.0720784962f, -0.0759886131f,
+    -0.0112299984f, 0.00263900403f, -0.0335966237f, -0.0197276194f,
+    0.0239968896f, -0.0158100054f, -0.00596019626f, -0.0457670912f,
+    0.00335395522f, -0.0164788626f, 0.0537030213f, 0.0338702053f,
+    -0.0358994417f, -0.0156136248f, -0.0240878705f, -0.00380205363f,
+    -0.0565423779f, -0.0162824839f, 0.0355753452f, 0.0758352429f,
+    0.040521469f, 0.158440664f, -0.00592666864f, 0.111992523f,
+    -0.0601483248f, 0.147977591f, -0.0367765352f, 0.171349391f,
+    -0.0536999926f, -0.0278245341f, 0.0154157896f, 0.0412912481f,
+    -0.154369786f, -0.0382875986f, -0.0154340751f, 0.100648113f,
+    -0.00616248837f, -0.101482585f, 0.139036953f, 0.0437168591f,
+    0.0524918027f, 0.0192059912f, 0.0504576117f, 0.0171718039f,
+    -0.0472249426f, -0.0435930155f, -0.0176895838f, -0.0140576586f,
+    0.0114293471f, 0.0770955533f, -0.106268927f, -0.0406027138f,
+    -0.0121542728f, -0.0731789768f, 0.00602733716f, -0.0549973696f,
+    0.0302843507f, -0.134522423f, -0.0562875904f, -0.22109437f,
+    0.0653139427f, 0.0508991107f, 0.0409052595f, 0.0264904276f,
+    0.107752569f, -0.0104443394f, -0.0214096718f, -0.13960658f,
+    -0.045274619f, -0.0386346281f, -0.111341543f, -0.104701549f,
+    -0.230867371f, -0.23587589f, -0.205073327f, -0.210081846f,
+    -0.119295761f, -0.073292315f, 0.0150126554f, 0.0610161051f,
+    -0.304888517f, -0.270533592f, -0.0787191316f, -0.0443641953f,
+    0.00397392642f, -0.0437512696f, -0.00799478404f, -0.0557199828f,
+    0.0270557329f, 0.00662228465f, 0.0387439691f, 0.0183105208f,
+    -0.0364477932f, -0.0980945826f, -0.0886722207f, -0.15031901f,
+    -0.0133659849f, -0.0477210209f, -0.041933462f, -0.0762884989f,
+    0.192723364f, 0.039384529f, -0.0889116451f, -0.242250472f,
+    0.0685266182f, 0.0339243859f, -0.111707419f, -0.146309644f,
+    -0.0644377545f, -0.0627817288f, -0.110072136f, -0.108416103f,
+    -0.1886345f, -0.0682418719f, -0.132867903f, -0.0124752717f,
+    -0.0493127406f, -0.0235969163f, -0.132594392f, -0.106878571f,
+    -0.0483351871f, 0.0186504908f, -0.0864706263f, -0.0194849521f,
+    0.0266714413f, 0.0466612689f, -0.00383091252f, 0.0161589161f,
+    0.0276489966f, 0.0889086798f, 0.0422928557f, 0.103552535f,
+    0.030018229f, 0.202049613f, 0.155312598f, 0.327343971f,
+    0.056090761f, 0.104407519f, 0.190246448f, 0.23856321f,
+    -0.0917626768f, 0.05058752f, 0.015531987f, 0.157882184f,
+    -0.0656901374f, -0.0470545739f, 0.0504658446f, 0.0691014081f,
+    0.00177492748f, -0.018131312f, -0.0251869485f, -0.0450931899f,
+    0.0342743546f, 0.0432569273f, 0.0574470498f, 0.0664296225f,
+    -0.110813037f, -0.077125892f, -0.0234226752f, 0.0102644674f,
+    -0.078313604f, -0.0157376528f, 0.0592113249f, 0.12178728f,
+    0.0358498022f, 0.125548929f, -0.0461907461f, 0.0435083918f,
+    0.106471449f, 0.0975440294f, 0.131643072f, 0.122715652f,
+    -0.0227240361f, 0.0422795564f, -0.079021275f, -0.01401769f,
+    0.0478976071f, 0.0142746381f, 0.0988125354f, 0.0651895627f,
+    -0.0615627691f, -0.0675957575f, -0.0194766f, -0.0255095866f,
+    -0.0377168022f, -0.0625919551f, -0.0206659101f, -0.045541063f,
+    -0.0221299678f, -0.0814247876f, 0.00752979703f, -0.0517650209f,
+    0.00171599793f, -0.0764209852f, 0.00634048134f, -0.0717964992f,
+    -0.101352386f, 7.26990402e-05f, -0.199883014f, -0.0984579176f,
+    -0.0406344794f, 0.0572143272f, -0.215156764f, -0.117307946f,
+    0.0483237468f, 0.0377763286f, -0.0317781568f, -0.0423255712f,
+    0.109041654f, 0.0949179605f, -0.047051914f, -0.0611756034f,
+    0.0125528378f, 0.0787826031f, 0.00526275299f, 0.071492523f,
+    -0.00846398994f, 0.0346763879f, -0.00775081851f, 0.0353895575f,
+    -0.0116897831f, 0.0526023172f, 0.0538818277f, 0.118173927f,
+    -0.0327066109f, 0.00849609822f, 0.0408682525f, 0.0820709616f,
+    -0.024259638f, 0.0356948972f, 0.00424466096f, 0.0641991943f,
+    -0.020642668f, 0.013799483f, -0.0142452884f, 0.0201968625f,
+    -0.0195247941f, 0.0463021249f, 0.0163854696f, 0.0822123885f,
+    -0.015907824f, 0.0244067125f, -0.00210447982f, 0.0382100567f,
+    -0.0322443247f, 0.00861056522f, -0.0112118125f, 0.0296430774f,
+    -0.0630200654f, -0.0460511148f, -0.0268055871f, -0.00983663462f,
+    0.0186817292f, 0.0287173279f, 0.0482103005f, 0.058245901f,
+    -0.0120940097f, -0.0259443484f, 0.0326165259f, 0.0187661871f,
+    0.0807415247f, 0.0496855415f, 0.0460076071f, 0.0149516268f,
+    0.0494929329f, 0.00163274817f, -0.000335766003f, -0.0481959507f,
+    0.0859646201f, 0.0568113625f, 0.0310399532f, 0.00188669562f,
+    0.054716032f, 0.008758571f, -0.015303418f, -0.061260879f,
+    0.167919576f, 0.224473119f, 0.117160887f, 0.173714414f,
+    0.104357608f, 0.272720128f, 0.0112156868f, 0.179578215f,
+    0.0993439332f, 0.137142435f, 0.0902592167f, 0.128057718f,
+    0.0357819609f, 0.185389459f, -0.0156859756f, 0.133921519f,
+    0.0617392622f, 0.14154236f, 0.045987919f, 0.125791013f,
+    0.0935858563f, 0.0943644047f, 0.0915633738f, 0.0923419222f,
+    0.0557153933f, 0.200983018f, 0.00847879797f, 0.153746426f,
+    0.0875619873f, 0.153805047f, 0.0540542565f, 0.120297328f,
+    -0.170930803f, -0.294445813f, -0.100674905f, -0.224189907f,
+    0.0475604758f, -0.299139619f, 0.111708686f, -0.234991431f,
+    0.0570112243f, -0.0732510686f, 0.0609494112f, -0.069312878f,
+    0.275502503f, -0.077944912f, 0.273332983f, -0.0801144093f,
+    0.0246818531f, -0.0513167679f, -0.0787276477f, -0.154726267f,
+    0.0953046903f, 0.043625094f, -0.0640142858f, -0.115693882f,
+    0.076831691f, 0.132261842f, 0.0284560882f, 0.0838862509f,
+    0.14745453f, 0.227203712f, 0.04316945f, 0.122918643f,
+    -0.0406660028f, -0.0425666161f, 0.000889265328f, -0.00101135042f,
+    -0.141934797f, -0.0509394854f, -0.0563672483f, 0.0346280597f,
+    0.0374123752f, 0.00481986813f, -0.0141207809f, -0.0467132889f,
+    -0.0638564229f, -0.00355300726f, -0.0713772997f, -0.0110738808f,
+    0.203659311f, -0.0315416232f, 0.0409512296f, -0.194249704f,
+    0.0563013181f, -0.134333134f, -0.11668168f, -0.307316124f,
+    0.0644247308f, 0.00952472538f, 0.115138784f, 0.0602387786f,
+    -0.082933262f, -0.0932667777f, -0.0424941219f, -0.0528276376f,
+    0.0484632663f, 0.0445281975f, -0.0844257027f, -0.088360779f,
+    0.178655684f, 0.192069858f, -0.0267584659f, -0.0133442823f,
+    0.0309500322f, 0.0395132899f, -0.0883989185f, -0.0798356533f,
+    0.161142439f, 0.187054962f, -0.0307316799f, -0.00481915846f,
+    -0.0197904073f, 0.102543771f, 0.0597649589f, 0.182099134f,
+    -0.156843647f, 0.0674989223f, 0.00249314308f, 0.226835713f,
+    0.0478411168f, -0.0402667522f, 0.0732474923f, -0.0148603776f,
+    -0.0892121196f, -0.0753115937f, 0.0159756765f, 0.0298762005f,
+    0.211908057f, 0.146162152f, 0.0953006744f, 0.0295547694f,
+    0.1364678f, 0.217396244f, 0.0705520883f, 0.151480526f,
+    0.0784050599f, 0.0888737664f, 0.0405811816f, 0.0510498844f,
+    0.0029647979f, 0.160107851f, 0.0158325955f, 0.172975644f,
+    -0.108251698f, 0.0105052851f, -0.0349956155f, 0.0837613642f,
+    -0.277510256f, -0.181484193f, -0.0930617154f, 0.00296435505f,
+    0.0584566221f, -0.00436022505f, -0.00371983275f, -0.0665366799f,
+    -0.11080195f, -0.19634971f, -0.0617859364f, -0.147333696f,
+    0.00463140011f, 0.017684212f, 0.0698202848f, 0.0828730986f,
+    0.0493572913f, 0.0476865321f, 0.0649764389f, 0.063305676f,
+    -0.00483169779f, 0.0133295059f, -0.0222855881f, -0.00412438437f,
+    0.0398941934f, 0.043331828f, -0.0271294378f, -0.0236918032f,
+    -0.0179498065f, 0.0758284107f, -0.0915141925f, 0.00226402772f,
+    0.00984541699f, 0.000272735953f, -0.121401131f, -0.130973816f,
+    0.0476298779f, 0.0286162868f, -0.0560172871f, -0.0750308782f,
+    0.0754251033f, -0.0469393842f, -0.0859042257f, -0.208268717f,
+    -0.0246446934f, -0.0562620573f, -0.0185017884f, -0.0501191542f,
+    -0.0092197163f, -0.00795915257f, 0.023961518f, 0.0252220836f,
+    -0.0188074019f, -0.0361004733f, -0.00971400365f, -0.027007075f,
+    -0.00338242459f, 0.0122024324f, 0.0327493064f, 0.0483341627f,
+    -0.0353642218f, -0.0358752124f, -0.0308682844f, -0.031379275f,
+    0.034053348f, 0.00627175439f, 0.0302198194f, 0.00243822671f,
+    -0.0329285637f, 0.00229952764f, -0.0545702763f, -0.0193421859f,
+    0.0364890099f, 0.0444464982f, 0.00651782751f, 0.0144753158f,
+    -0.084901683f, -0.0443380103f, -0.0889433324f, -0.0483796634f,
+    0.00357536227f, -0.0159626305f, -0.0504587814f, -0.0699967742f,
+    0.00995455682f, -0.0285410248f, -0.00209997222f, -0.0405955538f,
+    0.0984316021f, -0.000165645033f, 0.0363845825f, -0.0622126646f,
+    0.039014034f, 0.0340581164f, 0.0801769048f, 0.0752209872f,
+    0.00614518998f, 0.0176544283f, -0.0211917032f, -0.00968246534f,
+    0.0201737899f, 0.0180507563f, 0.0475928038f, 0.0454697721f,
+    -0.0126950545f, 0.00164706819f, -0.0537758023f, -0.0394336805f,
+    -0.0934807509f, 0.0955775827f, 0.0152211413f, 0.204279467f,
+    -0.0400234684f, 0.0808711946f, 0.0793454126f, 0.200240076f,
+    -0.000895204023f, 0.0425670445f, 0.0376247801f, 0.0810870305f,
+    0.0525620766f, 0.027860662f, 0.101749048f, 0.0770476386f,
+    0.214434624f, 0.180277765f, 0.0517053083f, 0.0175484419f,
+    0.177819729f, 0.171852127f, -0.0199960284f, -0.0259636287f,
+    0.0140295625f, 0.0378149711f, -0.0844015628f, -0.0606161579f,
+    -0.0225853324f, 0.0293893442f, -0.156102896f, -0.104128227f,
+    -0.00600228179f, -0.140040219f, -0.0302545652f, -0.164292499f,
+    0.120601714f, -0.0836376622f, -0.130980551f, -0.33521992f,
+    0.0213522092f, -0.0755080134f, 0.0550491363f, -0.0418110788f,
+    0.147956207f, -0.0191054493f, -0.0456768423f, -0.212738499f,
+    -0.000473220163f, 0.143664822f, 0.00914755464f, 0.153285593f,
+    0.0201679021f, 0.287664771f, 0.0251388773f, 0.292635769f,
+    0.0457567163f, 0.0299933106f, 0.0667194724f, 0.0509560704f,
+    0.0663978383f, 0.173993289f, 0.0827108175f, 0.190306261f,
+    -0.0877862722f, -0.25907293f, -0.257572442f, -0.428859115f,
+    -0.12199045f, -0.42082268f, -0.120489135f, -0.419321358f,
+    -0.141666293f, -0.139696956f, -0.205182165f, -0.203212813f,
+    -0.175870478f, -0.301446676f, -0.0680988505f, -0.193675071f,
+    0.078077741f, -0.0402873456f, 0.131096512f, 0.0127314236f,
+    0.0841359943f, -0.154604062f, -0.0218955576f, -0.260635614f,
+    0.101654515f, 0.000306099653f, 0.117784858f, 0.0164364427f,
+    0.107712768f, -0.114010632f, -0.0352072194f, -0.256930619f,
+    0.141398147f, 0.215520382f, 0.00767695904f, 0.0817991942f,
+    0.234300226f, 0.168657169f, -0.023485437f, -0.0891284943f,
+    0.0189875737f, -0.0243844949f, -0.00817231461f, -0.0515443832f,
+    0.111889645f, -0.0712477118f, -0.0393347144f, -0.222472072f,
+    0.00714035705f, -0.142374173f, 0.122484572f, -0.0270299744f,
+    -0.193453997f, -0.254909039f, 0.099226892f, 0.0377718434f,
+    0.136311412f, -0.0697348267f, 0.138381585f, -0.0676646456f,
+    -0.0642829686f, -0.182269707f, 0.115123898f, -0.00286282855f,
+    0.0731612518f, 0.0538649336f, 0.100125283f, 0.0808289647f,
+    0.0674861521f, 0.0949631184f, 0.0760100856f, 0.103487052f,
+    0.0614551082f, 0.022507133f, 0.0336804576f, -0.00526751857f,
+    0.0557800122f, 0.063605316f, 0.00956525933f, 0.0173905659f,
+    -0.0576737635f, -0.0664846972f, -0.0424345508f, -0.0512454845f,
+    -0.162597388f, -0.144116789f, -0.0630674958f, -0.044586882f,
+    -0.10329254f, -0.0940988585f, -0.0501216426f, -0.0409279577f,
+    -0.208216161f, -0.171730936f, -0.0707545802f, -0.0342693552f,
+    0.0253776014f, -0.00605744217f, 0.012516479f, -0.0189185645f,
+    -0.0157567859f, 0.00180636998f, -0.00121240597f, 0.0163507499f,
+    -0.0294548497f, -0.0794393346f, -0.00671562366f, -0.0567001067f,
+    -0.0705892369f, -0.0715755224f, -0.0204445086f, -0.0214307904f,
+    -0.112568237f, -0.0269174241f, 0.0247327015f, 0.110383518f,
+    0.116025895f, 0.282269329f, 0.107104629f, 0.273348063f,
+    -0.0804336891f, -0.103664577f, 0.0106844716f, -0.0125464201f,
+    0.148160443f, 0.205522165f, 0.0930564031f, 0.150418133f,
+    0.046412807f, 0.0776673332f, 0.0176816732f, 0.0489361994f,
+    0.00290956162f, 0.0312886089f, -0.0010732729f, 0.0273057725f,
+    0.0596317947f, 0.0525808334f, 0.0597309396f, 0.0526799783f,
+    0.0161285512f, 0.0062021073f, 0.0409759954f, 0.0310495496f,
+    0.0635694414f, -0.00399047043f, 0.0378768668f, -0.0296830442f,
+    0.01334708f, -0.0632602796f, -0.0104334541f, -0.0870408118f,
+    0.088762857f, 0.0492881387f, 0.0328325108f, -0.00664220378f,
+    0.0385404937f, -0.00998166762f, -0.0154778119f, -0.0639999732f,
+    -0.0736005828f, -0.0311115831f, -0.111240238f, -0.0687512383f,
+    -0.00486441143f, -0.0179373436f, -0.00580739882f, -0.01888033f,
+    -0.0406595245f, -0.0219378434f, 0.00781756453f, 0.0265392438f,
+    0.0280766487f, -0.00876360387f, 0.113250405f, 0.076410152f,
+    0.0670481846f, -0.00874189474f, 0.000404924154f, -0.0753851533f,
+    0.023379948f, 0.00563826412f, -0.0635418817f, -0.0812835693f,
+    -0.0259017311f, -0.053260427f, -0.0429873765f, -0.0703460723f,
+    -0.0695699677f, -0.03888027f, -0.106934182f, -0.0762444884f,
+    0.0813817307f, -0.0116057955f, 0.0524324626f, -0.0405550599f,
+    -0.0480908118f, -0.0922243595f, -0.122914128f, -0.167047679f,
+    -0.065881893f, -0.0992238298f, -0.103028409f, -0.136370346f,
+    -0.195354432f, -0.179842398f, -0.27837503f, -0.26286298f,
+    0.0317502283f, -0.0345525667f, 0.0526635908f, -0.0136392014f,
+    -0.111802071f, -0.14599742f, 0.0162730627f, -0.0179222915f,
+    0.0599343777f, -0.0362126119f, 0.0334334932f, -0.0627134964f,
+    -0.0836179256f, -0.147657469f, -0.00295704603f, -0.0669965893f,
+    0.0314435326f, 0.199392557f, 0.00748983771f, 0.175438866f,
+    0.00976707041f, 0.0356689319f, -0.155472934f, -0.12957108f,
+    -0.196490139f, -0.18322745f, -0.101814665f, -0.0885519832f,
+    -0.218166605f, -0.346951067f, -0.264777452f, -0.393561929f,
+    -0.144347727f, -0.134498447f, -0.110724017f, -0.100874729f,
+    -0.0143854115f, -0.0656601787f, -0.0688297078f, -0.120104477f,
+    -0.176719129f, -0.169865608f, -0.205970049f, -0.199116528f,
+    -0.0467568077f, -0.101027332f, -0.164075732f, -0.218346268f,
+    -0.0555278994f, -0.055078622f, -0.10003636f, -0.0995870829f,
+    -0.0662950948f, -0.0252103806f, 0.0870380625f, 0.128122777f,
+    0.0164723769f, -0.0316957533f, 0.11607787f, 0.0679097474f,
+    0.00570518337f, -0.00182750821f, 0.303152293f, 0.295619607f,
+    -0.297555625f, -0.325658411f, -0.12626037f, -0.15436314f,
+    -0.117401652f, -0.0286286678f, -0.0751450062f, 0.0136279725f,
+    -0.209994182f, -0.242801592f, -0.0579440258f, -0.0907514319f,
+    -0.0298402123f, 0.0542281382f, -0.00682867318f, 0.0772396773f,
+    0.0325741991f, -0.00275970693f, 0.0294959787f, -0.0058379299f,
+    0.0203735009f, -0.0112028196f, -0.051313214f, -0.0828895345f,
+    0.0341864266f, -0.151958168f, 0.0461538061f, -0.139990777f,
+    0.0219857302f, -0.16040127f, -0.0346553847f, -0.217042387f,
+    -0.000710023509f, 0.0687878281f, -0.177531928f, -0.108034082f,
+    -0.0739572048f, -0.029455578f, -0.0421756059f, 0.00232602283f,
+    0.0153657924f, 0.12861529f, -0.162805647f, -0.0495561287f,
+    -0.0578813888f, 0.0303719006f, -0.0274493117f, 0.0608039759f,
+    0.0211391933f, -0.0633158311f, -0.0349435806f, -0.119398609f,
+    -0.0794573501f, -0.130010694f, -0.0754660666f, -0.126019403f,
+    0.083658956f, -0.0498000681f, -0.0283212289f, -0.161780253f,
+    -0.0169375837f, -0.116494924f, -0.0688437074f, -0.168401048f,
+    -0.209847584f, -0.255280107f, -0.197281182f, -0.242713705f,
+    -0.0858106017f, -0.139076352f, -0.0338911116f, -0.087156862f,
+    -0.194068372f, -0.0795303881f, -0.0980568081f, 0.016481176f,
+    -0.0700313896f, 0.0366733633f, 0.0653332621f, 0.172038019f,
+    -0.0139868064f, -0.0180251859f, -0.00473096501f, -0.00876934361f,
+    -0.0239052977f, -0.0128890332f, -0.0240698978f, -0.0130536314f,
+    -0.0187254958f, -0.055227913f, -0.0423184671f, -0.0788208842f,
+    -0.0286439862f, -0.0500917584f, -0.0616573952f, -0.0831051692f,
+    -0.147019267f, 0.0627473295f, 0.0687534213f, 0.278520018f,
+    -0.177594393f, 0.142904758f, -0.0525685996f, 0.267930537f,
+    0.0397006609f, 0.102330469f, 0.0110933874f, 0.073723197f,
+    0.00912552327f, 0.182487905f, -0.110228628f, 0.0631337389f,
+    -0.0820423216f, -0.0625996217f, -0.0224332828f, -0.00299058366f,
+    -0.0237509832f, -0.06940341f, 6.61499798e-05f, -0.0455862731f,
+    -0.0721901879f, -0.0565338396f, -0.0527432375f, -0.0370868891f,
+    -0.0138988495f, -0.0633376241f, -0.0302438047f, -0.0796825811f,
+    -0.0637146831f, -0.0328394696f, 0.0164600816f, 0.0473352969f,
+    0.0207434706f, 0.0130733857f, 0.0303634815f, 0.0226933956f,
+    -0.0444565266f, -0.0152934082f, -0.0156887136f, 0.0134744048f,
+    0.0400016308f, 0.0306194499f, -0.00178531371f, -0.0111674964f,
+    0.0735263079f, 0.0346328132f, -0.0201067943f, -0.0590002909f,
+    0.147931457f, 0.0616528206f, 0.0386412703f, -0.0476373658f,
+    0.0328740142f, 0.00293899234f, 0.0039309701f, -0.0260040518f,
+    0.107279167f, 0.0299590062f, 0.0626790375f, -0.0146411257f,
+    0.0464321077f, 0.0325206183f, 0.0579747111f, 0.0440632217f,
+    0.0483912192f, 0.0185294803f, -0.000881901011f, -0.0307436399f,
+    -0.0182788037f, -0.0155389877f, -0.00793119427f, -0.0051913783f,
+    -0.0163196921f, -0.0295301247f, -0.0667878091f, -0.0799982399f,
+    -0.154230744f, -0.0721042156f, -0.092313081f, -0.0101865595f,
+    -0.0471619666f, 0.0199486725f, -0.0589871332f, 0.00812350214f,
+    0.0432599783f, 0.0399651155f, 0.0762959197f, 0.0730010569f,
+    0.150328755f, 0.132018015f, 0.109621868f, 0.0913111195f,
+    -0.0586146526f, 0.0792913288f, -0.0292814597f, 0.108624518f,
+    -0.0703658164f, -0.00224474072f, -0.140549347f, -0.0724282712f,
+    0.0352796763f, -0.00185501948f, -0.0578798912f, -0.095014587f,
+    0.0235285144f, -0.0833910853f, -0.169147775f, -0.276067376f,
+    -0.221085668f, -0.0454130769f, 0.0296644047f, 0.205336988f,
+    -0.14270325f, -0.0238041095f, -0.0656205714f, 0.0532785729f,
+    -0.0235669147f, 0.0439464189f, -0.0441057198f, 0.0234076157f,
+    0.0548154898f, 0.0655553862f, -0.139390707f, -0.128650799f,
+    0.0487923771f, 0.0655615181f, 0.075774163f, 0.0925433114f,
+    -0.109235466f, 0.13089627f, -0.00200381875f, 0.238127917f,
+    0.221867353f, 0.176339269f, 0.0589046814f, 0.0133765861f,
+    0.0638394877f, 0.241674006f, -0.0188733116f, 0.158961192f,
+    -0.0551158339f, -0.156840265f, 0.0673704669f, -0.0343539678f,
+    -0.0458943583f, -0.241023868f, 0.0314855948f, -0.163643911f,
+    0.011343169f, -0.0752117038f, 0.0320085436f, -0.0545463264f,
+    0.0205646437f, -0.159395307f, -0.00387632102f, -0.183836266f,
+    0.108488277f, 0.0166125298f, 0.0586744361f, -0.0332013145f,
+    -0.0404975191f, -0.139731705f, -0.035401959f, -0.134636149f,
+    -0.0135351643f, -0.0306679085f, 0.0206682533f, 0.00353550911f,
+    -0.16252096f, -0.187012136f, -0.0734081417f, -0.0978993252f,
+    -0.153568938f, -0.0834294707f, 0.0601964369f, 0.130335897f,
+    -0.086155951f, 0.0664204583f, -0.0669958964f, 0.0855805129f,
+    0.0785524026f, -0.0143575706f, 0.0147980936f, -0.0781118795f,
+    0.145965397f, 0.13549237f, -0.112394236f, -0.122867256f,
+    -0.0985679105f, -0.247996002f, -0.0445242263f, -0.193952322f,
+    -0.0237677377f, -0.356526494f, 0.0204818696f, -0.3122769f,
+    -0.134005189f, -0.137005776f, -0.0620643124f, -0.0650648922f,
+    -0.0592050143f, -0.245536298f, 0.00294179469f, -0.183389485f,
+    -0.00151616486f, 0.0426888578f, -0.119840756f, -0.0756357387f,
+    -0.0356095321f, -0.0877184942f, -0.0842894986f, -0.136398464f,
+    -0.0193901304f, 0.0103844088f, -0.0632459968f, -0.0334714614f,
+    -0.0534834974f, -0.120022945f, -0.0276947375f, -0.0942341834f,
+    0.0269261356f, -0.00803761929f, 0.0203752257f, -0.0145885283f,
+    0.00233873166f, -0.152665332f, -0.0135031939f, -0.168507263f,
+    -0.0241968483f, -0.136195779f, 0.0833686069f, -0.0286303312f,
+    -0.0487842523f, -0.280823499f, 0.0494901836f, -0.182549059f,
+    -0.0561935008f, -0.00797803607f, -0.063143827f, -0.0149283614f,
+    -0.0724293366f, -0.00601411518f, -0.0584149137f, 0.00800030865f,
+    -0.0622730628f, -0.046982009f, -0.0312525891f, -0.0159615334f,
+    -0.0785088986f, -0.0450180881f, -0.0265236758f, 0.00696713757f,
+    -0.200726539f, -0.00559287518f, -0.091296643f, 0.103837021f,
+    -0.341631591f, -0.140209883f, -0.0653204918f, 0.136101216f,
+    -0.10956078f, 0.0422086529f, 0.0223272443f, 0.174096674f,
+    -0.25046584f, -0.0924083591f, 0.0483033881f, 0.206360877f,
+    0.054903429f, 0.0374748781f, 0.00955145992f, -0.00787709188f,
+    0.0266166832f, 0.0472072326f, -0.0114803594f, 0.00911019277f,
+    -0.010017952f, -0.0121849068f, -0.0084845759f, -0.0106515298f,
+    -0.0383046977f, -0.00245254789f, -0.029516397f, 0.00633575534f,
+    0.00840545725f, -0.00646113325f, -0.0154960155f, -0.030362606f,
+    -0.0276310854f, -0.0143304421f, 0.00938360859f, 0.0226842519f,
+    0.0199348442f, 0.0175704956f, 0.00584525336f, 0.00348090567f,
+    -0.0161016993f, 0.00970118679f, 0.0307248775f, 0.0565277636f,
+    -0.00511922594f, 0.0110603115f, 0.0134334099f, 0.0296129473f,
+    -0.0217218697f, -0.0043349145f, 0.00762537913f, 0.0250123348f,
+    0.0560098812f, 0.0193232112f, -0.0060213618f, -0.0427080318f,
+    0.0394072384f, 0.00392798893f, -0.0118293921f, -0.0473086424f,
+    -0.0275954008f, -0.00310177542f, -0.0703763962f, -0.0458827727f,
+    0.0352664329f, 0.0452939421f, -0.0202420354f, -0.0102145243f,
+    -0.0424100868f, 0.0150243584f, -0.0374730155f, 0.0199614316f,
+    0.020451745f, 0.0634200796f, 0.0126613481f, 0.0556296818f,
+    -0.0202554427f, 0.14784424f, 0.132722959f, 0.300822645f,
+    -0.115768105f, 0.0601416081f, 0.188533112f, 0.364442825f,
+    0.0442475975f, 0.113086045f, 0.0943539441f, 0.163192391f,
+    -0.0512650646f, 0.0253833979f, 0.150164098f, 0.226812571f,
+    0.00589099573f, 0.00141574256f, -0.0295455698f, -0.0340208225f,
+    -0.0668265522f, -0.0152059216f, -0.0410262048f, 0.0105944239f,
+    -0.0916321725f, 0.0426117145f, -0.102108628f, 0.0321352556f,
+    -0.16434972f, 0.025990054f, -0.113589264f, 0.076750502f,
+    -0.0986031443f, -0.182407528f, 0.0040701814f, -0.0797342137f,
+    -0.213908657f, -0.278229415f, 0.0250655971f, -0.0392551646f,
+    0.119263723f, -0.0319339857f, 0.10914053f, -0.0420571864f,
+    0.00395820476f, -0.12775588f, 0.130135924f, -0.00157813914f,
+    -0.152333185f, -0.0602189228f, -0.200595558f, -0.108481303f,
+    -0.155513376f, -0.290185988f, -0.0795602947f, -0.214232922f,
+    -0.177850604f, -0.0508768559f, -0.134156644f, -0.00718289614f,
+    -0.181030795f, -0.280843943f, -0.0131213814f, -0.112934515f,
+    -0.540894032f, -0.233928859f, -0.150324225f, 0.156640947f,
+    -0.344211191f, -0.311984271f, -0.0713852718f, -0.0391583592f,
+    -0.287693948f, -0.144093871f, -0.183660269f, -0.0400601923f,
+    -0.0910110921f, -0.222149283f, -0.104721308f, -0.235859498f,
+    -0.109833919f, 0.0383221358f, 0.00421505421f, 0.152371109f,
+    -0.171763167f, 0.0654369891f, 0.0631214231f, 0.300321579f,
+    0.0357609019f, 0.0889737904f, 0.122728683f, 0.175941572f,
+    -0.026168352f, 0.116088636f, 0.181635037f, 0.323892027f,
+    -0.185787424f, -0.0272010639f, -0.0783610567f, 0.0802253038f,
+    -0.178885892f, -0.0472231656f, 0.0051433146f, 0.136806041f,
+    -0.0361149572f, 0.041646868f, 0.0312007908f, 0.108962618f,
+    -0.0292134229f, 0.02162477f, 0.114705175f, 0.165543362f,
+    0.0717096552f, -0.0845860243f, 0.145662397f, -0.010633287f,
+    -0.010546457f, 0.0100751407f, 0.0762420371f, 0.0968636349f,
+    0.0606604479f, -0.0363430381f, 0.0312359966f, -0.0657674894f,
+    -0.0215956643f, 0.0583181307f, -0.0381843597f, 0.0417294316f,
+    0.109280109f, 0.168791562f, 0.0508086309f, 0.110320076f,
+    0.0104383118f, 0.0502381772f, 0.00122172944f, 0.0410215929f,
+    0.0316156037f, 0.0998104066f, -0.0580026843f, 0.0101921186f,
+    -0.0672261938f, -0.0187429748f, -0.10758958f, -0.0591063648f,
+    0.143055588f, 0.120495364f, 0.0549290925f, 0.0323688649f,
+    0.106364228f, -0.0454148054f, 0.01661814f, -0.135160893f,
+    0.0496051386f, 0.0496411659f, -0.06858363f, -0.068547599f,
+    0.0129137775f, -0.116268992f, -0.106894583f, -0.236077353f,
+    -0.0672325194f, -0.0924721211f, -0.0180273838f, -0.0432669818f,
+    -0.0955241323f, -0.110024326f, -0.0407779142f, -0.0552781038f,
+    -0.0362587199f, -0.013928419f, -0.023222534f, -0.000892232172f,
+    -0.0645503327f, -0.0314806215f, -0.0459730662f, -0.0129033532f,
+    -0.0207066145f, 0.0371850729f, 0.067821525f, 0.125713214f,
+    -0.0418474115f, -0.0121648684f, 0.0498683341f, 0.0795508772f,
+    0.00532960799f, 0.0456019565f, 0.0197344404f, 0.0600067899f,
+    -0.01581119f, -0.00374798477f, 0.00178124709f, 0.0138444528f,
+    -0.0716378242f, -0.0157486722f, 0.0176004171f, 0.0734895691f,
+    -0.0138978884f, 0.0263593327f, -0.00607472099f, 0.0341825001f,
+    -0.0925781652f, -0.030980438f, -0.0318097994f, 0.0297879297f,
+    -0.0348382294f, 0.0111275669f, -0.0554849356f, -0.00951914024f,
+    -0.0307148993f, -0.0637974739f, -0.0448297299f, -0.0779123008f,
+    0.0184748471f, -0.0260458756f, -0.017822599f, -0.0623433217f,
+    -0.0254000239f, -0.101527981f, -0.0159555282f, -0.0920834839f,
+    0.0237897243f, -0.0637763813f, 0.0110516027f, -0.0765145048f,
+    0.032367032f, 0.0324540772f, -0.0346577168f, -0.0345706716f,
+    0.0325886756f, 0.0600136966f, 0.00440945663f, 0.0318344794f,
+    0.0376554951f, -0.00107809342f, 0.00469344668f, -0.0340401419f,
+    0.0378771424f, 0.0264815334f, 0.0437606201f, 0.0323650092f,
+    -0.0722573102f, -0.066252932f, 0.0111349802f, 0.0171393566f,
+    -0.0972689018f, -0.043957632f, -0.0424785502f, 0.0108327223f,
+    -0.0319009647f, -0.0431197099f, 0.0157013368f, 0.00448259292f,
+    -0.0569125526f, -0.0208244026f, -0.0379121937f, -0.00182404125f,
+    -0.00591703784f, -0.116939768f, -0.0217899308f, -0.132812664f,
+    0.0929062366f, 0.0315969773f, 0.0229818784f, -0.038327381f,
+    0.0225099474f, -0.0321822539f, 0.0220975354f, -0.0325946659f,
+    0.121333219f, 0.116354495f, 0.0668693408f, 0.061890617f,
+    -0.0895381942f, -0.0852803886f, -0.179631114f, -0.175373301f,
+    -0.0945399106f, -0.144512147f, -0.139038622f, -0.189010859f,
+    -0.0586136132f, -0.0872974396f, -0.11393179f, -0.142615616f,
+    -0.0636153296f, -0.146529198f, -0.0733392984f, -0.156253174f,
+    0.0113519123f, 0.123598903f, -0.00750922784f, 0.104737766f,
+    -0.248055071f, -0.0919735283f, -0.100718632f, 0.0553629026f,
+    0.034548007f, 0.124667466f, 0.0394553728f, 0.129574835f,
+    -0.224858984f, -0.0909049734f, -0.0537540391f, 0.0801999718f,
+    0.138661966f, 0.132698208f, -0.0145440456f, -0.0205078088f,
+    0.159204572f, 0.135346755f, 0.0721090734f, 0.0482512563f,
+    -0.16841802f, -0.0224650726f, -0.0706045255f, 0.0753484219f,
+    -0.147875413f, -0.0198165178f, 0.0160485916f, 0.144107491f,
+    0.016532125f, -0.0169518162f, 0.028382156f, -0.00510178413f,
+    0.0547738336f, 0.0639485717f, 0.0186757203f, 0.0278504603f,
+    -0.0180543475f, -0.0829508901f, -0.00781759061f, -0.0727141351f,
+    0.0201873612f, -0.00205049664f, -0.0175240282f, -0.039761886f,
+    -0.0971693993f, 0.135541767f, 0.0214644298f, 0.254175603f,
+    -0.0291720275f, 0.0294910595f, 0.0291177183f, 0.0877808034f,
+    -0.0539078154f, 0.0321127102f, -0.029916944f, 0.0561035834f,
+    0.0140895573f, -0.0739379972f, -0.0222636499f, -0.110291205f,
+    0.0897604525f, 0.091705583f, 0.0295399204f, 0.0314850472f,
+    0.156919912f, 0.0505281091f, 0.0652266741f, -0.0411651246f,
+    0.0520982593f, 0.0248239189f, 0.00494833104f, -0.0223260075f,
+    0.119257726f, -0.0163535438f, 0.0406350903f, -0.0949761793f,
+    -0.0745339319f, -0.152031064f, 0.0897176266f, 0.0122205019f,
+    0.154652655f, 0.181342587f, 0.121254995f, 0.147944927f,
+    0.0140848681f, -0.0698100924f, 0.0785783976f, -0.00531654805f,
+    0.243271455f, 0.263563544f, 0.110115774f, 0.13040787f,
+    -0.0311551355f, -0.102076434f, -0.0819131285f, -0.15283443f,
+    0.00768965296f, -0.0763055384f, -0.0476330556f, -0.131628245f,
+    0.0139583293f, -0.029179249f, -0.0538805909f, -0.0970181674f,
+    0.0528031178f, -0.00340834633f, -0.0196005106f, -0.0758119747f,
+    -0.0382486843f, 0.00995777361f, 0.00461358391f, 0.0528200418f,
+    -0.0732704252f, -0.0516095012f, -0.0615240112f, -0.039863091f,
+    0.0954118818f, 0.094180271f, 0.100810111f, 0.0995784998f,
+    0.0603901409f, 0.032612998f, 0.0346725136f, 0.00689536845f,
+    0.0458283424f, -0.0394774638f, 0.00915214047f, -0.0761536658f,
+    0.0373609662f, 0.00181704201f, 0.0384420529f, 0.00289813057f,
+    0.0766017437f, 0.0503390953f, 0.0294039566f, 0.00314131007f,
+    0.0681343675f, 0.091633603f, 0.0586938709f, 0.0821931064f,
+    -0.236689672f, -0.420370907f, -0.0232166201f, -0.20689787f,
+    -0.314614356f, -0.209602222f, -0.00478420779f, 0.10022793f,
+    -0.170148343f, -0.230593324f, -0.0691102445f, -0.129555225f,
+    -0.248073041f, -0.0198246241f, -0.0506778359f, 0.177570581f,
+    0.0581469536f, 0.00708672032f, -0.031304732f, -0.082364969f,
+    0.023174962f, -0.0105260611f, 0.0160785429f, -0.0176224802f,
+    0.0274525676f, -0.0294795223f, -0.0260362886f, -0.0829683766f,
+    -0.00751942396f, -0.0470923036f, 0.0213469882f, -0.0182258897f,
+    -0.0495866835f, 0.00551252719f, -0.0269392133f, 0.0281599965f,
+    -0.0555517115f, -0.0486915559f, -0.0390561633f, -0.0321960077f,
+    -0.0209611841f, 0.0130139375f, -0.0112793837f, 0.0226957388f,
+    -0.0269262102f, -0.0411901437f, -0.0233963281f, -0.0376602635f,
+    0.0624600984f, 0.0337689891f, 0.0254245922f, -0.00326651591f,
+    0.116719902f, 0.0877785608f, 0.0313217156f, 0.00238037482f,
+    0.0322641358f, 0.00108550116f, 0.00126895681f, -0.0299096778f,
+    0.0865239426f, 0.0550950766f, 0.00716607925f, -0.0242627878f,
+    -0.0409059227f, 0.000544131966f, -0.0445975289f, -0.00314747309f,
+    -0.054996293f, -0.0264124814f, -0.0249092039f, 0.00367460772f,
+    -0.022142034f, -0.0238039158f, -0.0745645165f, -0.0762263983f,
+    -0.0362324044f, -0.0507605299f, -0.0548761934f, -0.0694043189f,
+    0.0208300557f, -0.11642167f, 0.112815842f, -0.0244358797f,
+    0.0980820134f, -0.0160074774f, 0.132417709f, 0.0183282085f,
+    -0.0921108648f, -0.0543538556f, 0.0600262098f, 0.0977832228f,
+    -0.0148588996f, 0.0460603423f, 0.0796280652f, 0.140547305f,
+    0.0711344406f, 0.157395214f, 0.00106936321f, 0.0873301476f,
+    0.180642396f, 0.212154537f, 0.0698135495f, 0.101325683f,
+    -0.041342251f, 0.0046476908f, -0.00206105784f, 0.043928884f,
+    0.0681657046f, 0.0594070032f, 0.066683121f, 0.0579244159f,
+    -0.0656433105f, -0.0641518235f, 0.0631985068f, 0.0646899939f,
+    -0.132232547f, -0.109640226f, -0.0177686252f, 0.00482369214f,
+    -0.0319206379f, -0.00601133332f, 0.0181516483f, 0.044060953f,
+    -0.0985098779f, -0.0514997467f, -0.0628154874f, -0.0158053525f,
+    -0.205903009f, -0.481605858f, -0.0203942657f, -0.2960971f,
+    -0.181750625f, -0.178927213f, 0.0280380324f, 0.0308614373f,
+    -0.234166712f, -0.270522058f, -0.0142596215f, -0.0506149828f,
+    -0.210014328f, 0.0321565643f, 0.0341726616f, 0.276343554f,
+    0.00590551272f, -0.10105899f, 0.0237484947f, -0.0832160115f,
+    -0.284057945f, -0.319814086f, -0.0145136006f, -0.0502697304f,
+    0.0264620483f, -0.0258505754f, 0.0255558826f, -0.0267567411f,
+    -0.263501406f, -0.244605675f, -0.0127061987f, 0.00618953817f,
+    -0.191266f, -0.25612393f, -0.0928232521f, -0.157681182f,
+    -0.400871515f, -0.32883504f, -0.27017507f, -0.198138595f,
+    -0.118071899f, -0.100942649f, -0.144884765f, -0.127755508f,
+    -0.327677399f, -0.173653752f, -0.322236538f, -0.16821292f,
+    -0.246181831f, -0.114630952f, -0.0144194625f, 0.117131419f,
+    -0.222159371f, 0.0919630229f, -0.0171418041f, 0.29698059f,
+    -0.108734429f, -0.0483314581f, -0.0385668091f, 0.0218361616f,
+    -0.0847119689f, 0.158262521f, -0.0412891358f, 0.201685339f,
+    0.00145953533f, -0.217874229f, -0.0572981536f, -0.276631922f,
+    -0.27539742f, -0.280265033f, -0.0824205056f, -0.0872881263f,
+    -0.00960017741f, -0.0116332173f, -0.0627432466f, -0.0647762865f,
+    -0.286457121f, -0.0740240216f, -0.087865591f, 0.124567509f,
+    0.0112225953f, 0.03826233f, 0.063419506f, 0.0904592425f,
+    -0.0182364881f, 0.0184311718f, 0.0544639826f, 0.0911316425f,
+    -0.00471176021f, 0.00750063732f, 0.048878435f, 0.0610908344f,
+    -0.0341708437f, -0.0123305209f, 0.0399229117f, 0.0617632344f,
+    -0.0284495577f, -0.225685239f, -0.00317757577f, -0.200413242f,
+    0.0102699213f, -0.120775968f, -0.00704680383f, -0.138092697f,
+    0.0666352808f, -0.119243465f, 0.0602770075f, -0.125601739f,
+    0.105354764f, -0.0143342055f, 0.056407772f, -0.0632811934f,
+    -0.03591647f, -0.0120699368f, 0.0147994412f, 0.0386459753f,
+    -0.0181821398f, 0.000605738722f, 0.000343811698f, 0.0191316903f,
+    0.0383531265f, -0.00455599744f, 0.0215863585f, -0.0213227663f,
+    0.0560874566f, 0.00811967812f, 0.00713072903f, -0.0408370495f,
+    0.220275506f, 0.156940773f, 0.0447315909f, -0.0186031368f,
+    -0.0186089426f, 0.0115230922f, 0.000296095386f, 0.0304281302f,
+    -0.0969068706f, -0.183567196f, -0.0505840778f, -0.137244403f,
+    -0.33579132f, -0.328984886f, -0.0950195789f, -0.0882131383f,
+    -0.077494882f, -0.0946961641f, -0.0620401353f, -0.0792414173f,
+    0.01073814f, -0.0416053832f, -0.00524768047f, -0.0575912036f,
+    -0.0315470733f, -0.0316664316f, -0.0327107236f, -0.0328300856f,
+    0.0566859469f, 0.0214243438f, 0.0240817275f, -0.0111798747f,
+    -0.00794454478f, -0.0259959511f, 0.0290169232f, 0.0109655168f,
+    -0.0176241249f, -0.00571379531f, -0.00255247857f, 0.009357851f,
+    -0.0023115729f, 0.0418643989f, 0.0401660763f, 0.0843420476f,
+    -0.0119911535f, 0.0621465519f, 0.00859667361f, 0.0827343762f,
+    0.00901680999f, 0.0561814606f, 0.0373619534f, 0.0845266059f,
+    -0.0241548605f, -0.0227988139f, 0.00726206228f, 0.00861810893f,
+    -0.0889018029f, -0.00604514778f, -0.0309768766f, 0.0518797785f,
+    -0.122073479f, -0.0850254297f, -0.0610767677f, -0.0240287222f,
+    0.0334933028f, -0.0113632418f, -0.0273193456f, -0.0721758902f,
+    0.0208575483f, -0.0153187104f, -0.0327805839f, -0.0689568445f,
+    0.0301267374f, -0.00461865216f, 0.0444062054f, 0.00966081582f,
+    0.017490983f, -0.00857412256f, 0.0389449634f, 0.0128798587f,
+    -0.035060212f, -0.0826426372f, 0.0303245671f, -0.0172578525f,
+    -0.1193652f, -0.101985104f, -0.057326369f, -0.0399462767f,
+    0.0415940471f, -0.0211450346f, 0.0435099825f, -0.0192291029f,
+    -0.0427109376f, -0.0404875055f, -0.0441409573f, -0.0419175252f,
+    0.0752490386f, -0.0836060718f, 0.131190985f, -0.0276641101f,
+    -0.0989443734f, -0.0272681303f, 0.0479308665f, 0.119607113f,
+    0.147966057f, 0.0320357718f, 0.152670681f, 0.0367403999f,
+    -0.0262273662f, 0.0883737132f, 0.0694105476f, 0.184011623f,
+    -0.133789673f, 0.0292599872f, -0.0036374554f, 0.159412205f,
+    -0.0485123917f, -0.0258498788f, -0.0220889822f, 0.000573529862f,
+    0.0410637632f, 0.0539279208f, 0.129774302f, 0.14263846f,
+    0.126341045f, -0.00118194614f, 0.111322775f, -0.0162002165f,
+    -0.193545818f, -0.237359673f, 0.0323126093f, -0.0115012405f,
+    -0.374746144f, -0.370234758f, 0.0421713293f, 0.0466827191f,
+    0.0523885563f, -0.0812186971f, 0.0863979086f, -0.0472093411f,
+    -0.128811762f, -0.214093789f, 0.0962566361f, 0.0109746177f,
+    0.183009326f, 0.206305444f, 0.0356436148f, 0.0589397401f,
+    0.0525915772f, -0.13722086f, -0.0545896739f, -0.244402111f,
+    0.0331735015f, -0.0313308537f, 0.0286202878f, -0.0358840674f,
+    -0.0972442478f, -0.374857187f, -0.0616130009f, -0.339225918f,
+    0.316055f, 0.214628875f, 0.165675163f, 0.0642490461f,
+    0.0997482166f, 0.00648022816f, 0.0490217954f, -0.0442461967f,
+    0.0229674876f, -0.172515348f, 0.0313232988f, -0.164159536f,
+    -0.193339303f, -0.380663991f, -0.0853300765f, -0.272654772f,
+    -0.068547368f, -0.109952517f, -0.0334084742f, -0.0748136193f,
+    -0.196553409f, -0.301626951f, -0.0370441377f, -0.142117679f,
+    -0.153103083f, -0.107648619f, -0.00468435697f, 0.0407701023f,
+    -0.281109124f, -0.299323082f, -0.00832001399f, -0.026533952f,
+    0.149653092f, 0.0656380206f, 0.0058119297f, -0.0782031342f,
+    0.0878951475f, 0.0494570956f, -0.107840732f, -0.146278784f,
+    0.247012883f, 0.148958772f, 0.0209627785f, -0.0770913288f,
+    0.185254946f, 0.13277784f, -0.0926898867f, -0.145166978f,
+    -0.0270231906f, 0.00912236422f, 0.0699653029f, 0.106110856f,
+    0.100357175f, 0.124118492f, 0.0589802973f, 0.0827416107f,
+    0.00736154243f, 0.0547449626f, -0.00768521614f, 0.0396982059f,
+    0.134741902f, 0.169741079f, -0.0186702237f, 0.0163289588f,
+    0.0623382032f, -0.0944876969f, -0.0501257069f, -0.206951603f,
+    0.151572034f, -0.0697419196f, -0.0669676065f, -0.28828156f,
+    0.169159666f, 0.0553192012f, 0.031624224f, -0.0822162405f,
+    0.258393496f, 0.0800649896f, 0.0147823244f, -0.16354619f,
+    -0.0324527025f, -0.0686907843f, 0.000281408429f, -0.0359566733f,
+    -0.0348097235f, -0.0125308326f, 0.00446898583f, 0.0267478768f,
+    0.0392334014f, 0.0192777142f, 0.0278052762f, 0.00784958713f,
+    0.0368763804f, 0.075437665f, 0.0319928527f, 0.0705541372f,
+    -0.381319851f, -0.149904758f, -0.0993472338f, 0.132067859f,
+    -0.314308524f, -0.0173876733f, -0.124747559f, 0.172173291f,
+    -0.0627999455f, -0.0576987565f, 0.000114017166f, 0.00521520711f,
+    0.00421139551f, 0.0748183429f, -0.025286315f, 0.0453206338f,
+    0.0170940459f, -0.0388847515f, 0.0287146792f, -0.0272641182f,
+    0.0543367565f, 0.00433659367f, 0.0414697379f, -0.00853042305f,
+    -0.0266370084f, -0.021634277f, -0.0513057038f, -0.0463029742f,
+    0.0106057031f, 0.0215870682f, -0.0385506414f, -0.0275692753f,
+    -0.0309174955f, -0.0350677297f, -0.07192453f, -0.0760747641f,
+    -0.0429421663f, -0.0743637234f, -0.0573365092f, -0.0887580663f,
+    0.016810149f, -0.020244386f, 0.00469810143f, -0.0323564336f,
+    0.00478547812f, -0.0595403798f, 0.0192861222f, -0.0450397357f,
+    -0.054579284f, -0.12833266f, -0.0434159338f, -0.117169313f,
+    -0.000562718138f, -0.046040263f, -0.0419641137f, -0.0874416605f,
+    -0.0216615424f, -0.0459526181f, -0.0165307447f, -0.0408218205f,
+    0.0323550254f, 0.0363397822f, -0.0150789209f, -0.011094165f,
+    0.0478415005f, -0.0402831659f, 0.0186191574f, -0.0695055127f,
+    0.00620769709f, -0.0239277408f, -0.0490841717f, -0.0792196095f,
+    -0.0130303297f, -0.0364219882f, -0.0246845521f, -0.0480762087f,
+    -0.054664135f, -0.0200665593f, -0.0923878849f, -0.0577903017f,
+    0.0145669291f, 0.0744455308f, -0.0521173328f, 0.00776127214f,
+    0.020314347f, 0.194596618f, 0.00245399028f, 0.176736265f,
+    0.0421053097f, 0.0222042613f, 0.0767071545f, 0.0568061098f,
+    0.0478527285f, 0.142355353f, 0.131278485f, 0.225781098f,
+    0.265974879f, 0.245047808f, 0.147019982f, 0.126092911f,
+    0.398602903f, 0.243576348f, 0.169490874f, 0.0144643188f,
+    0.174893335f, 0.088137269f, 0.00142221525f, -0.085333854f,
+    0.307521343f, 0.0866657943f, 0.0238930956f, -0.196962446f,
+    -0.420068324f, -0.259560317f, -0.24676989f, -0.0862618759f,
+    -0.259763986f, -0.202978536f, -0.199779645f, -0.142994195f,
+    -0.107315265f, -0.0665826127f, -0.109238252f, -0.0685056001f,
+    0.052989047f, -0.0100008547f, -0.0622480251f, -0.125237927f,
+    -0.14705357f, 0.019937288f, -0.0101975128f, 0.156793341f,
+    -0.0664894357f, 0.0121746417f, -0.0660253614f, 0.0126387216f,
+    -0.0699240491f, 0.000738322735f, 0.0496203601f, 0.120282732f,
+    0.0106400857f, -0.00702432077f, -0.0062074773f, -0.0238718837f,
+    -0.0373925902f, -0.255964041f, -0.0391737968f, -0.257745236f,
+    -0.26706183f, -0.473742008f, -0.142136931f, -0.34881714f,
+    -0.0201791525f, -0.0954216719f, 0.00416267291f, -0.0710798427f,
+    -0.249848381f, -0.313199669f, -0.0988004431f, -0.162151739f,
+    -0.0130102281f, -0.0871674344f, -0.12027286f, -0.194430068f,
+    -0.00408327207f, -0.195208445f, -0.204139024f, -0.395264208f,
+    -0.0889687091f, -0.140795797f, -0.0669209212f, -0.118748017f,
+    -0.0800417587f, -0.248836815f, -0.1507871f, -0.319582164f,
+    -0.211359769f, -0.0744044483f, -0.0254881084f, 0.111467212f,
+    -0.0732355192f, 0.121559858f, -0.02654019f, 0.16825518f,
+    -0.0342122391f, 0.0413681157f, 0.0194082074f, 0.0949885622f,
+    0.103912011f, 0.237332419f, 0.0183561146f, 0.151776522f,
+    -0.0102653494f, -0.255989432f, 0.155575097f, -0.0901490003f,
+    -0.179877043f, -0.40824151f, 0.0250654221f, -0.203299046f,
+    0.15182209f, 0.0096389316f, 0.0918315202f, -0.0503516421f,
+    -0.0177896023f, -0.142613128f, -0.0386781543f, -0.16350168f,
+    -0.142852008f, -0.0879233703f, -0.0786452517f, -0.0237166081f,
+    -0.072419703f, 0.0205995832f, -0.0808053687f, 0.0122139193f,
+    -0.0615490228f, -0.0286404565f, 0.046805121f, 0.0797136873f,
+    0.00888328347f, 0.0798824951f, 0.044645004f, 0.115644217f,
+    -0.139365271f, 0.0128114633f, -0.0878811628f, 0.0642955676f,
+    -0.132936537f, -0.0162860937f, -0.12443614f, -0.00778570026f,
+    -0.0758682415f, -0.037986856f, -0.0347247384f, 0.00315664709f,
+    -0.0694395155f, -0.0670844167f, -0.0712797195f, -0.0689246207f,
+    -0.0648830235f, -0.00645270944f, -0.0188989639f, 0.0395313501f,
+    -0.0233708248f, 0.00593059696f, 0.0149409454f, 0.0442423671f,
+    0.0357536897f, 0.00612761639f, 0.0500041693f, 0.0203780979f,
+    0.0772658885f, 0.0185109228f, 0.0838440806f, 0.0250891149f,
+    -0.0454424173f, 0.0255218614f, -0.120549947f, -0.0495856665f,
+    8.91741365e-05f, 0.0605992787f, -0.0202223025f, 0.0402878001f,
+    -0.031942986f, 0.0548022389f, -0.0441030338f, 0.0426421911f,
+    0.0135886073f, 0.0898796543f, 0.0562246069f, 0.132515654f,
+    0.0622327849f, 0.0292002819f, -0.00382608548f, -0.0368585885f,
+    0.0904028639f, 0.030560758f, 0.0450457223f, -0.0147963855f,
+    0.0524723753f, 0.0188961662f, 0.0077560721f, -0.0258201379f,
+    0.0806424543f, 0.0202566385f, 0.0566278808f, -0.00375793385f,
+    -0.000139494747f, 0.0233740956f, -0.00938977208f, 0.0141238179f,
+    0.00909422897f, -0.00100149401f, -0.0041235555f, -0.0142192785f,
+    -0.0565081164f, 0.0236104522f, -0.0397640541f, 0.0403545164f,
+    -0.0472743921f, -0.000765139703f, -0.0344978347f, 0.0120114191f,
+    0.0985139608f, 0.0581481755f, -0.0435825922f, -0.0839483738f,
+    0.00502608158f, 0.0357373506f, -0.112664998f, -0.0819537342f,
+    0.128619954f, 0.0613786802f, 0.00715390407f, -0.0600873716f,
+    0.0351320691f, 0.0389678478f, -0.0619285032f, -0.0580927283f,
+    0.0160971396f, 0.0474003293f, 0.0358863696f, 0.0671895593f,
+    0.0352107249f, 0.00977419782f, 0.00520705525f, -0.0202294718f,
+    -0.000434968621f, -0.000976996496f, 0.0521156192f, 0.0515735894f,
+    0.0186786167f, -0.038603127f, 0.0214363057f, -0.0358454399f,
+    0.104312666f, 0.0442507677f, -0.00937644579f, -0.0694383457f,
+    -0.0330250114f, -0.0704024136f, -0.0335249193f, -0.0709023252f,
+    0.0802846104f, -0.0414505377f, -0.010164462f, -0.13189961f,
+    -0.0570530631f, -0.15610373f, -0.0343129337f, -0.13336359f,
+    -0.0602539293f, -0.0442040823f, 0.0153718889f, 0.0314217359f,
+    -0.0428657271f, -0.0598517656f, -0.02451347f, -0.0414995104f,
+    -0.0374862812f, -0.123435803f, -0.0022116676f, -0.0881611854f,
+    -0.0200980809f, -0.13908349f, -0.0420970283f, -0.161082432f,
+    0.0865849257f, 0.000507600605f, 0.0129793361f, -0.073097989f,
+    -0.0219799019f, -0.0853548944f, 0.0408332646f, -0.0225417316f,
+    -0.00691552833f, -0.0419547819f, -0.043558903f, -0.0785981566f,
+    -0.115480356f, -0.127817288f, -0.0157049783f, -0.0280419067f,
+    0.0660087988f, 0.19007501f, 0.0179355256f, 0.142001733f,
+    0.150256664f, 0.0990061536f, 0.134672523f, 0.0834220201f,
+    0.0473153219f, 0.0352492593f, 0.119725354f, 0.107659295f,
+    0.131563187f, -0.0558195934f, 0.23646237f, 0.0490795858f,
+    0.0151222041f, 0.0512823723f, 0.000875832513f, 0.0370360017f,
+    0.0436653495f, 0.222547546f, 0.00490771234f, 0.183789909f,
+    0.0941328108f, 0.0237067901f, 0.0506979786f, -0.0197280422f,
+    0.122675963f, 0.194971949f, 0.0547298603f, 0.127025858f,
+    -0.00117949035f, -0.00818227138f, 0.0150125707f, 0.00800978951f,
+    -0.022885222f, -0.0111463033f, -0.0328596458f, -0.0211207252f,
+    -0.0466058403f, -0.00694285706f, 0.0165172704f, 0.0561802536f,
+    -0.0683115721f, -0.00990688801f, -0.0313549489f, 0.0270497389f,
+    0.0927591622f, 0.0867507309f, 0.0585127622f, 0.0525043309f,
+    -0.0180962905f, 0.0237576868f, -0.0212337021f, 0.0206202753f,
+    0.0195589736f, 0.0222252123f, 0.062138442f, 0.0648046806f,
+    -0.0912964791f, -0.0407678336f, -0.0176080223f, 0.0329206251f,
+    -0.0632209703f, 0.131613851f, -0.060764648f, 0.134070173f,
+    0.128305957f, 0.455889285f, 0.0530447215f, 0.380628079f,
+    0.114634424f, 0.0266027711f, 0.157247782f, 0.0692161247f,
+    0.306161344f, 0.350878209f, 0.271057159f, 0.315774024f,
+    0.100015886f, -0.0408758521f, 0.0380872078f, -0.102804534f,
+    0.0891114995f, -0.00418932736f, 0.0223678276f, -0.0709329993f,
+    0.0362969749f, 0.0138669275f, -0.0379769653f, -0.0604070127f,
+    0.0253925864f, 0.0505534522f, -0.0536963418f, -0.028535476f,
+    0.000577306317f, -0.0308160726f, -0.066157952f, -0.0975513309f,
+    0.0920918062f, 0.0580881275f, 0.0613204204f, 0.0273167416f,
+    0.0902228877f, 0.0369019061f, 0.0582287759f, 0.0049077943f,
+    0.181737393f, 0.125806108f, 0.185707152f, 0.129775867f,
+    -0.0664506555f, 0.00327897258f, -0.00976029783f, 0.0599693283f,
+    0.0241288003f, 0.059165217f, 0.0411769859f, 0.0762134045f,
+    -0.0448888466f, 0.0199593268f, -0.0432223789f, 0.0216257926f,
+    0.0456906073f, 0.0758455694f, 0.00771490671f, 0.0378698707f,
+    -0.261041313f, -0.21188879f, -0.047981862f, 0.00117066107f,
+    -0.0362953842f, -0.0259720497f, -0.0157240964f, -0.00540076196f,
+    -0.16239655f, -0.174675584f, -0.0330933258f, -0.0453723706f,
+    0.0623493828f, 0.0112411454f, -0.000835556537f, -0.0519437939f,
+    0.020824492f, -0.0376358926f, 0.00312242843f, -0.055337958f,
+    0.0765592158f, 0.00664796028f, 0.0508902296f, -0.0190210249f,
+    0.0139287896f, -0.0357567444f, -0.0108839311f, -0.0605694652f,
+    0.0696635172f, 0.00852711126f, 0.036883872f, -0.0242525339f,
+    0.00840547681f, 0.0540290698f, -0.0196798444f, 0.0259437468f,
+    -0.0389703512f, 0.0349135175f, 0.0099946931f, 0.0838785619f,
+    0.021732688f, 0.0458432585f, -0.0170502532f, 0.00706031546f,
+    -0.0256431401f, 0.0267277081f, 0.0126242843f, 0.0649951324f,
+    0.106537864f, 0.1163067f, 0.0880884603f, 0.0978572965f,
+    0.0811578333f, 0.0426819548f, 0.0885744244f, 0.0500985421f,
+    0.120153874f, 0.115725189f, 0.0748158544f, 0.0703871623f,
+    0.0947738439f, 0.0421004407f, 0.0753018111f, 0.0226284061f,
+    -0.0764951855f, -0.00679708086f, -0.0284645148f, 0.0412335917f,
+    -0.0274090804f, 0.0463951379f, 0.0012559928f, 0.0750602111f,
+    -0.017234873f, 0.0210748669f, -0.0167145301f, 0.0215952098f,
+    0.0318512321f, 0.0742670894f, 0.0130059756f, 0.0554218292f,
+    0.0797107741f, -0.109298073f, 0.0650715977f, -0.123937257f,
+    -0.0366706774f, -0.190405726f, -0.0583712719f, -0.212106317f,
+    0.161775485f, 0.022960376f, 0.107839465f, -0.0309756398f,
+    0.0453940257f, -0.058147274f, -0.015603397f, -0.1191447f,
+    0.0344524123f, 0.0309039783f, 0.0690492317f, 0.0655007958f,
+    0.0407320671f, 0.0316124558f, 0.134413302f, 0.125293702f,
+    0.0347207934f, 0.113870844f, -0.011449676f, 0.0677003786f,
+    0.0410004482f, 0.114579327f, 0.0539144129f, 0.127493292f,
+    0.284242779f, 0.286068261f, 0.150424868f, 0.15225035f,
+    0.228051394f, 0.241687819f, 0.163473576f, 0.177109987f,
+    -0.0323538929f, 0.127519697f, 0.0322655514f, 0.192139149f,
+    -0.0885452628f, 0.0831392631f, 0.0453142598f, 0.216998786f,
+    0.0940089449f, -0.0163629167f, 0.170906872f, 0.0605350137f,
+    0.140446335f, 0.0327740684f, 0.121100403f, 0.0134281404f,
+    0.0724981278f, -0.0138511863f, 0.0502876267f, -0.0360616855f,
+    0.118935518f, 0.035285797f, 0.00048116222f, -0.0831685588f,
+    0.140598521f, 0.230230972f, 0.186337769f, 0.275970221f,
+    -0.0322394818f, 0.069226861f, 0.0716761649f, 0.173142508f,
+    0.00916084647f, 0.0109138843f, 0.046066992f, 0.0478200316f,
+    -0.163677156f, -0.150090232f, -0.0685946047f, -0.0550076775f,
+    -0.406535625f, -0.443857074f, -0.136687994f, -0.174009457f,
+    -0.00561724603f, 0.0480179191f, -0.00609684736f, 0.0475383177f,
+    -0.161131606f, -0.288839757f, -0.034014307f, -0.161722451f,
+    0.239786774f, 0.203035265f, 0.0965768248f, 0.0598253161f,
+    0.0922297835f, 0.0636834055f, 0.029153375f, 0.000606998277f,
+    0.0143712647f, 0.000504150987f, 0.00427332148f, -0.00959379226f,
+    -0.0359093621f, -0.0310256388f, 0.00911795534f, 0.0140016787f,
+    -0.113767885f, -0.0942048952f, -0.0157621f, 0.00380088785f,
+    0.0807373673f, -0.00384277664f, 0.0627717152f, -0.0218084268f,
+    0.123164676f, -0.0548247173f, 0.117164619f, -0.0608247705f,
+    0.0538716055f, 0.00782766566f, -0.0556805134f, -0.101724453f,
+    0.0962989181f, -0.0431542657f, -0.00128761679f, -0.140740797f,
+    -0.0389866829f, -0.0614824444f, -0.0708969384f, -0.0933927f,
+    -0.0346557237f, 0.00504751038f, -0.0064597223f, 0.0332435109f,
+    -0.0645879656f, -0.0495965257f, -0.0511013567f, -0.0361099206f,
+    -0.0602570064f, 0.01693343f, 0.0133358538f, 0.0905262902f,
+    0.093718037f, 0.170580491f, 0.08176741f, 0.158629864f,
+    0.125597998f, 0.220959261f, 0.0165488757f, 0.111910127f,
+    -0.0225355569f, -0.0194710903f, -0.132796556f, -0.129732087f,
+    0.00934441108f, 0.0309076756f, -0.198015079f, -0.176451817f,
+};
+
+// One entry per layer; only 3x3 stride-1 convolutions have one
+static const float* const mnist_snn_winograd[5] = {
+    mnist_snn_layer0_winograd,
+    NULL,
+    mnist_snn_layer2_winograd,
+    NULL,
+    NULL,
+};
+
+#endif // MNIST_SNN_WINOGRAD_H
@@ -0,0 +1,15 @@
+// Generated by snn_core/Tools/snn_place from the mnist_snn layer table, host
+// timings and code sizes. Regenerate with the snn_placement_headers target
+// after changing the model; included by snn_placement.h in builds with
+// SNN_TCM_PLACEMENT. Tags left out keep flash and RAM_D1.
+#ifndef SNN_PLACEMENT_CONFIG_H
+#define SNN_PLACEMENT_CONFIG_H
+
+#define SNN_PLACE_CONV2D_WINOGRAD SNN_ITCM           // 2817 bytes, 71% of the time
+#define SNN_PLACE_LINEAR SNN_ITCM                    // 392 bytes, 6% of the time
+#define SNN_PLACE_MAXPOOL2D SNN_ITCM                 // 485 bytes, 0% of the time
+#define SNN_PLACE_LIF SNN_ITCM                       // 1186 bytes, 22% of the time
+#define SNN_PLACE_ARENA SNN_DTCM                     // 69776 bytes, 52.6 accesses per byte
+#define SNN_PLACE_RESULTS SNN_RAM_D3                 // 3096 bytes, 0.0 accesses per byte
+
+#endif // SNN_PLACEMENT_CONFIG_H
@@ -22,9 +22,11 @@
 
 /* Private includes ----------------------------------------------------------*/
 /* USER CODE BEGIN Includes */
-#include <stdbool.h>
 #include "mnist_test_images.h"
-#include "model_parameters.h"
+#include "mnist_snn_model.h"
+#include "mnist_snn_arena.h"
+#include "snn_placement.h"
+#include "snn_cache.h"
 /* USER CODE END Includes */
 
 /* Private typedef -----------------------------------------------------------*/
@@ -35,216 +37,66 @@
 /* Private define ------------------------------------------------------------*/
 /* USER CODE BEGIN PD */
 #define INPUT_SIZE 28
-#define CONV1_IN_CHANNELS 1
-#define CONV1_OUT_CHANNELS 16
-#define CONV1_KERNEL_SIZE 3
-#define CONV1_STRIDE 1
-#define CONV1_PADDING 1
-
-#define CONV2_IN_CHANNELS 16
-#define CONV2_OUT_CHANNELS 32
-#define CONV2_KERNEL_SIZE 3
-#define CONV2_STRIDE 1
-#define CONV2_PADDING 1
-
-#define FC1_IN_FEATURES 1568
-#define FC1_OUT_FEATURES 10
-#define THRESHOLD 1
-
-#define LIF1_BETA 0.9
-#define LIF2_BETA 0.9
-#define LIF3_BETA 0.9
-
-typedef struct {
-    float membrane_potential;
-    bool should_spike;
-} LIFNeuron;
-
-typedef struct {
-    int in_channels;
-    int out_channels;
-    int kernel_size;
-    int stride;
-    int padding;
-    const float (*weights)[CONV1_IN_CHANNELS][CONV1_KERNEL_SIZE][CONV1_KERNEL_SIZE];
-} conv1;
-
-typedef struct {
-    int in_channels;
-    int out_channels;
-    int kernel_size;
-    int stride;
-    int padding;
-    const float (*weights)[CONV2_IN_CHANNELS][CONV2_KERNEL_SIZE][CONV2_KERNEL_SIZE];
-} conv2;
-
-typedef struct {
-    const float (*weights)[FC1_OUT_FEATURES][FC1_IN_FEATURES];
-} FullyConnectedLayer;
-
-// LIFNeuron lif1_neurons[CONV1_OUT_CHANNELS * INPUT_SIZE * INPUT_SIZE] = {0};
-// LIFNeuron lif2_neurons[CONV2_OUT_CHANNELS * (INPUT_SIZE/2) * (INPUT_SIZE/2)] = {0};
-// LIFNeuron lif3_neurons[FC1_OUT_FEATURES] = {0};
-
-
-// Function to apply Leaky Integrate and Fire (LIF) neuron update
-void update_neuron(LIFNeuron *neuron, float input_current, float beta, float threshold) {
-    neuron->membrane_potential = (beta * neuron->membrane_potential + input_current);
-
-    if (neuron->should_spike) {
-        neuron->membrane_potential = 0;
-        neuron->should_spike = false;
-    } else if (neuron->membrane_potential >= threshold) {
-        neuron->should_spike = true;
-    }
-}
 
-// Function to perform 2D convolution
-void conv1_2d(const float* input, float* output, const conv1* conv_layer, int input_size) {
-    int output_size = (input_size - conv_layer->kernel_size + 2 * conv_layer->padding) / conv_layer->stride + 1;
-
-    for (int oc = 0; oc < conv_layer->out_channels; ++oc) {
-        for (int oh = 0; oh < output_size; ++oh) {
-            for (int ow = 0; ow < output_size; ++ow) {
-                float sum = 0;
-                for (int ic = 0; ic < conv_layer->in_channels; ++ic) {
-                    for (int kh = 0; kh < conv_layer->kernel_size; ++kh) {
-                        for (int kw = 0; kw < conv_layer->kernel_size; ++kw) {
-                            int ih = oh * conv_layer->stride + kh - conv_layer->padding;
-                            int iw = ow * conv_layer->stride + kw - conv_layer->padding;
-                            if (ih >= 0 && ih < input_size && iw >= 0 && iw < input_size) {
-                                sum += input[ic * input_size * input_size + ih * input_size + iw] * conv_layer->weights[oc][ic][kh][kw];
-                            }
-                        }
-                    }
-                }
-                output[oc * output_size * output_size + oh * output_size + ow] = sum;
-            }
-        }
-    }
-}
+// AXI SRAM given to activations; inference_batch() runs as many images per
+// pass over the weights as fit in it, and no more than there are test
+// images, so a single test image reserves no second arena
+#define SNN_ARENA_BUDGET (192 * 1024)
+#define SNN_BUDGET_BATCH SNN_BATCH_SIZE(MNIST_SNN_ARENA_SIZE, SNN_ARENA_BUDGET)
+#define SNN_BATCH (NUM_TEST_IMAGES < SNN_BUDGET_BATCH ? NUM_TEST_IMAGES : SNN_BUDGET_BATCH)
+
+// Layer outputs of one image, placed by snn_plan so dead buffers are
+// reused, and by snn_place in DTCM when it fits there
+static uint8_t snn_arena[MNIST_SNN_ARENA_SIZE] SNN_PLACE_ARENA __attribute__((aligned(SNN_ARENA_ALIGNMENT)));
+
+// One arena per image of a batch, in AXI SRAM; a batch of one runs in
+// snn_arena
+#if SNN_BATCH > 1
+static uint8_t snn_batch_arena[(SNN_BATCH - 1) * SNN_BATCH_STRIDE(MNIST_SNN_ARENA_SIZE) + MNIST_SNN_ARENA_SIZE]
+    __attribute__((aligned(SNN_ARENA_ALIGNMENT)));
+#else
+#define snn_batch_arena snn_arena
+#endif
 
-// Function to perform 2D convolution
-void conv2_2d(float* input, float* output, const conv2* conv_layer, int input_size) {
-    int output_size = (input_size - conv_layer->kernel_size + 2 * conv_layer->padding) / conv_layer->stride + 1;
-
-    for (int oc = 0; oc < conv_layer->out_channels; ++oc) {
-        for (int oh = 0; oh < output_size; ++oh) {
-            for (int ow = 0; ow < output_size; ++ow) {
-                float sum = 0;
-                for (int ic = 0; ic < conv_layer->in_channels; ++ic) {
-                    for (int kh = 0; kh < conv_layer->kernel_size; ++kh) {
-                        for (int kw = 0; kw < conv_layer->kernel_size; ++kw) {
-                            int ih = oh * conv_layer->stride + kh - conv_layer->padding;
-                            int iw = ow * conv_layer->stride + kw - conv_layer->padding;
-                            if (ih >= 0 && ih < input_size && iw >= 0 && iw < input_size) {
-                                sum += input[ic * input_size * input_size + ih * input_size + iw] * conv_layer->weights[oc][ic][kh][kw];
-                            }
-                        }
-                    }
-                }
-                output[oc * output_size * output_size + oh * output_size + ow] = sum;
-            }
-        }
-    }
-}
+// Per-step and per-layer cycle counts of the last inference, for the debugger
+static SNNRunResult snn_result SNN_PLACE_RESULTS;
+static SNNRunResult snn_batch_results[SNN_BATCH] SNN_PLACE_RESULTS;
 
-// Function to perform 2D max pooling
-void maxpool2d(float* input, float* output, int in_channels, int input_size, int kernel_size, int stride) {
-    int output_size = (input_size - kernel_size) / stride + 1;
-
-    for (int ic = 0; ic < in_channels; ++ic) {
-        for (int oh = 0; oh < output_size; ++oh) {
-            for (int ow = 0; ow < output_size; ++ow) {
-                int ih = oh * stride;
-                int iw = ow * stride;
-                float max_value = input[ic * input_size * input_size + ih * input_size + iw];
-                for (int kh = 0; kh < kernel_size; ++kh) {
-                    for (int kw = 0; kw < kernel_size; ++kw) {
-                        int nih = ih + kh;
-                        int niw = iw + kw;
-                        if (nih < input_size && niw < input_size) {
-                            float value = input[ic * input_size * input_size + nih * input_size + niw];
-                            if (value > max_value) {
-                                max_value = value;
-                            }
-                        }
-                    }
-                }
-                output[ic * output_size * output_size + oh * output_size + ow] = max_value;
-            }
-        }
-    }
+static uint32_t snn_cycles(void) {
+    return DWT->CYCCNT;
 }
 
 // Function to perform inference
-int inference(const float input_image[1][INPUT_SIZE][INPUT_SIZE], conv1* conv1, conv2* conv2, FullyConnectedLayer* fc_layer) {
-    // Step 1: Convolutional Layer 1
-    float conv1_output[CONV1_OUT_CHANNELS][INPUT_SIZE][INPUT_SIZE] = {0};
-
-    LIFNeuron lif1_neurons[CONV1_OUT_CHANNELS * INPUT_SIZE * INPUT_SIZE] = {0};
-    conv1_2d(&input_image[0][0][0], &conv1_output[0][0][0], conv1, INPUT_SIZE);
-
-    // Step 2: Apply LIF neurons to conv1 output
-    for (int i = 0; i < CONV1_OUT_CHANNELS * INPUT_SIZE * INPUT_SIZE; i++) {
-        update_neuron(&lif1_neurons[i], conv1_output[0][0][i], LIF1_BETA, THRESHOLD);
-        conv1_output[0][0][i] = lif1_neurons[i].membrane_potential;
-    }
-
-    // Step 3: Max Pooling for Conv1
-    float pool1_output[CONV1_OUT_CHANNELS][INPUT_SIZE/2][INPUT_SIZE/2] = {0};
-    maxpool2d(&conv1_output[0][0][0], &pool1_output[0][0][0], CONV1_OUT_CHANNELS, INPUT_SIZE, 2, 2);
-
-    // Step 4: Convolutional Layer 2
-    float conv2_output[CONV2_OUT_CHANNELS][INPUT_SIZE/2][INPUT_SIZE/2] = {0};
-    conv2_2d(&pool1_output[0][0][0], &conv2_output[0][0][0], conv2, INPUT_SIZE/2);
-
-    // Step 5: Apply LIF neurons to conv2 output
-    LIFNeuron lif2_neurons[CONV2_OUT_CHANNELS * (INPUT_SIZE/2) * (INPUT_SIZE/2)] = {0};
-
-    for (int i = 0; i < CONV2_OUT_CHANNELS * (INPUT_SIZE/2) * (INPUT_SIZE/2); i++) {
-        update_neuron(&lif2_neurons[i], conv2_output[0][0][i], LIF2_BETA, THRESHOLD);
-        conv2_output[0][0][i] = lif2_neurons[i].membrane_potential;
-    }
+int inference(const float input_image[1][INPUT_SIZE][INPUT_SIZE]) {
+    SNNRunConfig config = {0, snn_cycles};
+    return snn_network_run(&mnist_snn_network, &input_image[0][0][0], snn_arena, sizeof(snn_arena), &config, &snn_result);
+}
 
-    // Step 6: Max Pooling for Conv2
-    float pool2_output[CONV2_OUT_CHANNELS][INPUT_SIZE/4][INPUT_SIZE/4] = {0};
-    maxpool2d(&conv2_output[0][0][0], &pool2_output[0][0][0], CONV2_OUT_CHANNELS, INPUT_SIZE/2, 2, 2);
-
-    // Step 7: Flatten
-    float flattened_output[FC1_IN_FEATURES] = {0};
-    int index = 0;
-    for (int c = 0; c < CONV2_OUT_CHANNELS; ++c) {
-        for (int h = 0; h < INPUT_SIZE/4; ++h) {
-            for (int w = 0; w < INPUT_SIZE/4; ++w) {
-                flattened_output[index++] = pool2_output[c][h][w];
-            }
+// Classify count images, SNN_BATCH at a time, so conv2 and fc1 weights are
+// streamed from flash once per batch rather than once per image. Returns 0,
+// or -1 if a batch failed to run, its images then predicted as -1.
+int inference_batch(const float input_images[][1][INPUT_SIZE][INPUT_SIZE], int count, int* predicted) {
+    SNNRunConfig config = {0, snn_cycles};
+    int status = 0;
+    for (int first = 0; first < count; first += SNN_BATCH) {
+        const float* inputs[SNN_BATCH];
+        int batch = count - first < SNN_BATCH ? count - first : SNN_BATCH;
+        for (int b = 0; b < batch; ++b) {
+            inputs[b] = &input_images[first + b][0][0][0];
         }
-    }
-
-    // Step 8: Fully Connected Layer
-    LIFNeuron lif3_neurons[FC1_OUT_FEATURES] = {0};
-    for (int i = 0; i < FC1_OUT_FEATURES; i++) {
-        float input_current = 0;
-        for (int j = 0; j < FC1_IN_FEATURES; j++) {
-            input_current = input_current + ((fc1_weights[i][j]) * flattened_output[j]);
+        if (snn_network_run_batch(&mnist_snn_network, inputs, batch, snn_batch_arena, sizeof(snn_batch_arena),
+                                  &config, snn_batch_results) != 0) {
+            for (int b = 0; b < batch; ++b) {
+                predicted[first + b] = -1;
+            }
+            status = -1;
+            continue;
         }
-        update_neuron(&lif3_neurons[i], input_current, LIF3_BETA, THRESHOLD);
-        // fc_layer->neurons[i] = lif3_neurons[i];
-    }
-
-    // Find the index of the maximum value in the output (predicted label)
-    int predicted_label = 0;
-    float max_val = lif3_neurons[0].membrane_potential;
-    for (int i = 1; i < FC1_OUT_FEATURES; ++i) {
-        // printf("mem_val[%d]:%f\n",i,lif3_neurons[i].membrane_potential);
-        if (lif3_neurons[i].membrane_potential > max_val) {
-            max_val = lif3_neurons[i].membrane_potential;
-            predicted_label = i;
+        for (int b = 0; b < batch; ++b) {
+            predicted[first + b] = snn_batch_results[b].predicted;
         }
     }
-
-    return predicted_label;
+    return status;
 }
 /* USER CODE END PD */
 
@@ -330,14 +182,12 @@ int main(void)
 {
 
   /* USER CODE BEGIN 1 */
-   conv1 conv1 = {CONV1_IN_CHANNELS, CONV1_OUT_CHANNELS, CONV1_KERNEL_SIZE, CONV1_STRIDE, CONV1_PADDING, (const float (*)[CONV1_IN_CHANNELS][CONV1_KERNEL_SIZE][CONV1_KERNEL_SIZE])conv1_weights};
-   conv2 conv2 = {CONV2_IN_CHANNELS, CONV2_OUT_CHANNELS, CONV2_KERNEL_SIZE, CONV2_STRIDE, CONV2_PADDING, (const float (*)[CONV2_IN_CHANNELS][CONV2_KERNEL_SIZE][CONV2_KERNEL_SIZE])conv2_weights};
-
-	// Initialize fully connected layer
-   FullyConnectedLayer fc_layer = {(const float (*)[FC1_OUT_FEATURES][FC1_IN_FEATURES])fc1_weights};
    int predicted_label;
+   int predicted_labels[NUM_TEST_IMAGES];
+   int batch_status;
    uint32_t timestamp0;
    uint32_t timestamp1;
+   uint32_t timestamp2;
   /* USER CODE END 1 */
 
   /* MCU Configuration--------------------------------------------------------*/
@@ -346,7 +196,12 @@ int main(void)
   HAL_Init();
 
   /* USER CODE BEGIN Init */
-
+  // D2 SRAM is unclocked after reset; then move the tagged kernels and
+  // buffers into place before anything runs from them
+  __HAL_RCC_D2SRAM1_CLK_ENABLE();
+  __HAL_RCC_D2SRAM2_CLK_ENABLE();
+  snn_placement_init();
+  snn_cache_init();
   /* USER CODE END Init */
 
   /* Configure the system clock */
@@ -365,6 +220,10 @@ int main(void)
   MX_USART1_UART_Init();
   /* USER CODE BEGIN 2 */
   HAL_TIM_Base_Start(&htim1);
+  CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+  DWT->LAR = 0xC5ACCE55;
+  DWT->CYCCNT = 0;
+  DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
   /* USER CODE END 2 */
 
   /* Infinite loop */
@@ -372,8 +231,10 @@ int main(void)
   while (1)
   {
 	  timestamp0 = htim1.Instance->CNT;
-	  predicted_label = inference(mnist_test_images[0], &conv1, &conv2, &fc_layer);
+	  predicted_label = inference(mnist_test_images[0]);
 	  timestamp1 = htim1.Instance->CNT;
+	  batch_status = inference_batch(mnist_test_images, NUM_TEST_IMAGES, predicted_labels);
+	  timestamp2 = htim1.Instance->CNT;
 
 	  HAL_Delay(500);
     /* USER CODE END WHILE */
@@ -0,0 +1,126 @@
+#include "mnist_snn_model.h"
+#include "model_parameters.h"
+
+// SNN_INT8_WEIGHTS builds run on the int8 weights of mnist_snn_q8.h and
+// SNN_CODEBOOK_WEIGHTS builds on the 4-bit codebook weights of
+// mnist_snn_codebook.h; both leave the float weights out of flash
+#if defined(SNN_INT8_WEIGHTS)
+#include "mnist_snn_q8.h"
+#define WEIGHTS(name) NULL
+#define QUANTIZED mnist_snn_quantized
+#define CODEBOOK NULL
+#elif defined(SNN_CODEBOOK_WEIGHTS)
+#include "mnist_snn_codebook.h"
+#define WEIGHTS(name) NULL
+#define QUANTIZED NULL
+#define CODEBOOK mnist_snn_codebook
+#else
+#define WEIGHTS(name) name
+#define QUANTIZED NULL
+#define CODEBOOK NULL
+#endif
+
+// SNN_FIXED_MEMBRANES builds keep the LIF membranes in Q16.16 fixed point
+#ifdef SNN_FIXED_MEMBRANES
+#define FIXED_MEMBRANES 1
+#else
+#define FIXED_MEMBRANES 0
+#endif
+
+// The 3x3 convolutions run as Winograd F(2x2,3x3) on the kernels of
+// mnist_snn_winograd.h. SNN_DIRECT_CONV builds run them direct, to save arena
+// and flash or to compare the layer_ticks of both on target; SNN_GEMM_CONV
+// builds run conv2 as a GEMM, which cannot fuse the pool after it.
+#if defined(SNN_DIRECT_CONV) || defined(SNN_INT8_WEIGHTS) || defined(SNN_CODEBOOK_WEIGHTS) || \
+    defined(SNN_CHANNELS_LAST)
+#define WINOGRAD NULL
+#else
+#include "mnist_snn_winograd.h"
+#define WINOGRAD mnist_snn_winograd
+#endif
+
+// SNN_CHANNELS_LAST builds run conv2 on the OHWI weights of mnist_snn_ohwi.h
+// over a channels-last (HWC) copy of its input, in place of Winograd
+#if defined(SNN_CHANNELS_LAST) && !defined(SNN_INT8_WEIGHTS) && !defined(SNN_CODEBOOK_WEIGHTS)
+#include "mnist_snn_ohwi.h"
+#define OHWI mnist_snn_ohwi
+#else
+#define OHWI NULL
+#endif
+
+// SNN_SPARSE_FC builds run fc1 on the block-sparse weights of
+// mnist_snn_sparse.h, pruned by the snn_sparse_headers target, and leave its
+// dense weights out of flash
+#if defined(SNN_SPARSE_FC) && !defined(SNN_INT8_WEIGHTS) && !defined(SNN_CODEBOOK_WEIGHTS)
+#include "mnist_snn_sparse.h"
+#define SPARSE mnist_snn_sparse
+#define FC_WEIGHTS(name) NULL
+#else
+#define SPARSE NULL
+#define FC_WEIGHTS(name) WEIGHTS(name)
+#endif
+
+// SNN_CACHE_ENABLE builds run with the caches on (snn_cache_init()) and
+// compute the float conv layers in tiles sized to the L1 D-cache
+#ifdef SNN_CACHE_ENABLE
+#define CONV_LAYER SNN_TILED_CONV2D
+#else
+#define CONV_LAYER SNN_CONV2D
+#endif
+
+#ifdef SNN_GEMM_CONV
+#define CONV2_LAYER SNN_GEMM_CONV2D
+#else
+#define CONV2_LAYER CONV_LAYER
+#endif
+
+#define INPUT_SIZE 28
+#define THRESHOLD 1
+#define TIMESTEPS 1
+
+// Early exit of runs longer than TIMESTEPS: membrane sums over windows of
+// 4 steps, stopping once the top class leads by 8. On the test image and
+// its perturbed copies this stops 16- and 32-step runs after 4 steps
+// without changing a prediction (snn_bench -x); shorter windows change
+// some unless the margin is 16 or more.
+#define EXIT_WINDOW 4
+#define EXIT_MARGIN 8
+
+#define LIF1_BETA 0.9f
+#define LIF2_BETA 0.9f
+#define LIF3_BETA 0.9f
+
+// snn_conv2d() specialised for the two conv shapes, for the builds (and
+// layers) that run them direct
+SNN_SPECIALIZE_CONV2D(mnist_snn_conv1, CONV1_IN_CHANNELS, INPUT_SIZE, CONV1_KERNEL_SIZE, CONV1_STRIDE, CONV1_PADDING);
+SNN_SPECIALIZE_CONV2D(mnist_snn_conv2, CONV2_IN_CHANNELS, INPUT_SIZE/2, CONV2_KERNEL_SIZE, CONV2_STRIDE, CONV2_PADDING);
+
+static const SNNConvKernel* const mnist_snn_kernels[] = { &mnist_snn_conv1, NULL, &mnist_snn_conv2, NULL, NULL };
+
+static const SNNLayer mnist_snn_layers[] = {
+    CONV_LAYER(CONV1_IN_CHANNELS, CONV1_OUT_CHANNELS, INPUT_SIZE, CONV1_KERNEL_SIZE, CONV1_STRIDE, CONV1_PADDING,
+               WEIGHTS(conv1_weights), NULL, SNN_ACT_LIF_MEMBRANE, LIF1_BETA, THRESHOLD),
+    SNN_MAXPOOL2D(CONV1_OUT_CHANNELS, INPUT_SIZE, 2, 2),
+    CONV2_LAYER(CONV2_IN_CHANNELS, CONV2_OUT_CHANNELS, INPUT_SIZE/2, CONV2_KERNEL_SIZE, CONV2_STRIDE, CONV2_PADDING,
+                WEIGHTS(conv2_weights), NULL, SNN_ACT_LIF_MEMBRANE, LIF2_BETA, THRESHOLD),
+    SNN_MAXPOOL2D(CONV2_OUT_CHANNELS, INPUT_SIZE/2, 2, 2),
+    SNN_LINEAR(FC1_IN_FEATURES, FC1_OUT_FEATURES,
+               FC_WEIGHTS(fc1_weights), NULL, SNN_ACT_LIF_MEMBRANE, LIF3_BETA, THRESHOLD),
+};
+
+const SNNNetwork mnist_snn_network = {
+    "mnist_snn",
+    mnist_snn_layers,
+    sizeof(mnist_snn_layers) / sizeof(mnist_snn_layers[0]),
+    TIMESTEPS,
+    QUANTIZED,
+    FIXED_MEMBRANES,
+    WINOGRAD,
+    mnist_snn_kernels,
+    OHWI,
+    SPARSE,
+    CODEBOOK,
+    NULL,
+    EXIT_WINDOW,
+    EXIT_MARGIN,
+};
@@ -0,0 +1,43 @@
+#include <stdint.h>
+#include "cifar10_images.h"
+#include "cifar_parameters.h"
+#include "cifar_snn_model.h"
+#include "bench_models.h"
+
+#ifdef BENCH_SYNTHETIC_CIFAR
+float conv1_weights[CONV1_OUT_CHANNELS][CONV1_IN_CHANNELS][CONV1_KERNEL_SIZE][CONV1_KERNEL_SIZE];
+float conv2_weights[CONV2_OUT_CHANNELS][CONV2_IN_CHANNELS][CONV2_KERNEL_SIZE][CONV2_KERNEL_SIZE];
+float conv3_weights[CONV3_OUT_CHANNELS][CONV3_IN_CHANNELS][CONV3_KERNEL_SIZE][CONV3_KERNEL_SIZE];
+float fc1_weights[FC1_OUT_FEATURES][FC1_IN_FEATURES];
+float fc2_weights[FC2_OUT_FEATURES][FC2_IN_FEATURES];
+
+// Fill with a fixed uniform sequence in [-scale, scale) so runs are repeatable
+static void fill_weights(float* weights, int count, float scale, uint32_t* seed) {
+    for (int i = 0; i < count; ++i) {
+        *seed = *seed * 1664525u + 1013904223u;
+        weights[i] = ((float)(*seed >> 8) / (float)(1u << 24) * 2.0f - 1.0f) * scale;
+    }
+}
+#endif
+
+void bench_cifar_snn(BenchModel* model) {
+#ifdef BENCH_SYNTHETIC_CIFAR
+    static int initialised = 0;
+    if (!initialised) {
+        uint32_t seed = 12345;
+        fill_weights(&conv1_weights[0][0][0][0], sizeof(conv1_weights) / sizeof(float), 0.5f, &seed);
+        fill_weights(&conv2_weights[0][0][0][0], sizeof(conv2_weights) / sizeof(float), 0.25f, &seed);
+        fill_weights(&conv3_weights[0][0][0][0], sizeof(conv3_weights) / sizeof(float), 0.25f, &seed);
+        fill_weights(&fc1_weights[0][0], sizeof(fc1_weights) / sizeof(float), 0.1f, &seed);
+        fill_weights(&fc2_weights[0][0], sizeof(fc2_weights) / sizeof(float), 0.2f, &seed);
+        initialised = 1;
+    }
+    model->synthetic = 1;
+#else
+    model->synthetic = 0;
+#endif
+    model->network = &cifar_snn_network;
+    model->input = &cifar10_images[0][0][0][0];
+    model->input_count = NUM_CHANNELS * IMAGE_HEIGHT * IMAGE_WIDTH;
+    model->label = -1;
+}
@@ -0,0 +1,15 @@
+// mnist_test_images.h defines its arrays with external linkage, so rename
+// them per project to keep the two MNIST image sets apart on the host.
+#define mnist_test_images mnist_cnn_test_images
+#define mnist_test_images_labels mnist_cnn_test_images_labels
+#include "mnist_test_images.h"
+#include "mnist_cnn_model.h"
+#include "bench_models.h"
+
+void bench_mnist_cnn(BenchModel* model) {
+    model->network = &mnist_cnn_network;
+    model->input = &mnist_test_images[0][0][0][0];
+    model->input_count = IMAGE_CHANNELS * IMAGE_SIZE * IMAGE_SIZE;
+    model->label = mnist_test_images_labels[0];
+    model->synthetic = 0;
+}
@@ -0,0 +1,18 @@
+#ifndef BENCH_MODELS_H
+#define BENCH_MODELS_H
+
+#include "snn_network.h"
+
+typedef struct {
+    const SNNNetwork* network;
+    const float* input;         // first test image shipped with the project
+    int input_count;
+    int label;                  // expected class, -1 when unknown
+    int synthetic;              // weights are placeholders, labels meaningless
+} BenchModel;
+
+void bench_mnist_snn(BenchModel* model);
+void bench_mnist_cnn(BenchModel* model);
+void bench_cifar_snn(BenchModel* model);
+
+#endif // BENCH_MODELS_H
@@ -0,0 +1,184 @@
+#include "bench_weight_file.h"
+
+#include <fcntl.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <time.h>
+#include <unistd.h>
+
+static double now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+// Busy-wait, as the core stalls on the external memory
+static void wait_ns(double ns) {
+    double end = now_ns() + ns;
+    while (now_ns() < end) {
+    }
+}
+
+static const void* read_file(SNNWeightSource* source, const void* address, size_t bytes) {
+    const BenchWeightFile* file = source->context;
+
+    wait_ns(file->access_ns + file->ns_per_byte * (double)bytes);
+    if (source->staging == NULL) {
+        return address;
+    }
+    memcpy(source->staging, address, bytes);
+    return source->staging;
+}
+
+int bench_weight_file_open(BenchWeightFile* file, const char* path, const SNNNetwork* network) {
+    size_t size = snn_weights_image_size(network);
+    void* image;
+    FILE* out;
+    int fd;
+
+    memset(file, 0, sizeof(*file));
+    if (size == 0 || (image = malloc(size)) == NULL) {
+        return -1;
+    }
+    if (snn_weights_image_write(network, image) != 0) {
+        free(image);
+        return -1;
+    }
+    out = fopen(path, "wb");
+    if (out == NULL || fwrite(image, 1, size, out) != size) {
+        if (out != NULL) fclose(out);
+        free(image);
+        return -1;
+    }
+    fclose(out);
+    free(image);
+
+    fd = open(path, O_RDONLY);
+    if (fd < 0) {
+        return -1;
+    }
+    image = mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (image == MAP_FAILED) {
+        return -1;
+    }
+    file->image = image;
+    file->size = size;
+    return 0;
+}
+
+void bench_weight_file_close(BenchWeightFile* file) {
+    if (file->image != NULL) {
+        munmap((void*)file->image, file->size);
+        file->image = NULL;
+    }
+}
+
+void bench_weight_file_source(BenchWeightFile* file, SNNWeightSource* source, void* staging,
+                              size_t staging_bytes, double access_ns, double ns_per_byte) {
+    if (staging != NULL) {
+        snn_weights_copy(source, staging, staging_bytes);
+    } else {
+        snn_weights_mapped(source);
+    }
+    file->access_ns = access_ns;
+    file->ns_per_byte = ns_per_byte;
+    source->read = read_file;
+    source->context = file;
+}
+
+typedef struct {
+    const BenchWeightFile* file;
+    pthread_t thread;
+    pthread_mutex_t lock;
+    pthread_cond_t changed;
+    void* destination;
+    const void* source;
+    size_t bytes;
+    int busy;
+    int stop;
+} AsyncCopier;
+
+static void* copy_thread(void* arg) {
+    SNNAsyncCopy* copy = arg;
+    AsyncCopier* copier = copy->context;
+
+    pthread_mutex_lock(&copier->lock);
+    for (;;) {
+        while (!copier->busy && !copier->stop) {
+            pthread_cond_wait(&copier->changed, &copier->lock);
+        }
+        if (copier->stop) break;
+        pthread_mutex_unlock(&copier->lock);
+
+        wait_ns(copier->file->access_ns + copier->file->ns_per_byte * (double)copier->bytes);
+        memcpy(copier->destination, copier->source, copier->bytes);
+        copy->finished = copy->clock != NULL ? copy->clock() : 0;
+
+        pthread_mutex_lock(&copier->lock);
+        copier->busy = 0;
+        pthread_cond_broadcast(&copier->changed);
+    }
+    pthread_mutex_unlock(&copier->lock);
+    return NULL;
+}
+
+static void start_async(SNNAsyncCopy* copy, void* destination, const void* source, size_t bytes) {
+    AsyncCopier* copier = copy->context;
+
+    pthread_mutex_lock(&copier->lock);
+    copier->destination = destination;
+    copier->source = source;
+    copier->bytes = bytes;
+    copier->busy = 1;
+    pthread_cond_broadcast(&copier->changed);
+    pthread_mutex_unlock(&copier->lock);
+}
+
+static void wait_async(SNNAsyncCopy* copy) {
+    AsyncCopier* copier = copy->context;
+
+    pthread_mutex_lock(&copier->lock);
+    while (copier->busy) {
+        pthread_cond_wait(&copier->changed, &copier->lock);
+    }
+    pthread_mutex_unlock(&copier->lock);
+}
+
+int bench_weight_file_async(BenchWeightFile* file, SNNAsyncCopy* copy, uint32_t (*clock)(void)) {
+    AsyncCopier* copier = calloc(1, sizeof(*copier));
+
+    if (copier == NULL) {
+        return -1;
+    }
+    copier->file = file;
+    pthread_mutex_init(&copier->lock, NULL);
+    pthread_cond_init(&copier->changed, NULL);
+    memset(copy, 0, sizeof(*copy));
+    copy->start = start_async;
+    copy->wait = wait_async;
+    copy->clock = clock;
+    copy->context = copier;
+    if (pthread_create(&copier->thread, NULL, copy_thread, copy) != 0) {
+        free(copier);
+        return -1;
+    }
+    return 0;
+}
+
+void bench_weight_file_async_stop(SNNAsyncCopy* copy) {
+    AsyncCopier* copier = copy->context;
+
+    wait_async(copy);
+    pthread_mutex_lock(&copier->lock);
+    copier->stop = 1;
+    pthread_cond_broadcast(&copier->changed);
+    pthread_mutex_unlock(&copier->lock);
+    pthread_join(copier->thread, NULL);
+    pthread_mutex_destroy(&copier->lock);
+    pthread_cond_destroy(&copier->changed);
+    free(copier);
+}
@@ -0,0 +1,36 @@
+#ifndef BENCH_WEIGHT_FILE_H
+#define BENCH_WEIGHT_FILE_H
+
+#include <stddef.h>
+#include "snn_weights.h"
+
+// Host stand-in for weights in slow external memory: the weight image of a
+// network in a file, mmap'ed, read through an SNNWeightSource that waits
+// access_ns plus ns_per_byte for every byte on each read, before it hands
+// out the mapping (mapped) or copies into staging (copying). Tiling and
+// prefetch strategies can so be compared against an OctoSPI-like memory
+// without the board. A mapped read is charged once per chunk, as if the
+// D-cache kept the chunk for the kernel's re-reads.
+typedef struct {
+    const void* image;
+    size_t size;
+    double access_ns;
+    double ns_per_byte;
+} BenchWeightFile;
+
+// Write the weight image of network to path and map it. Returns 0, or -1
+// if network has no float weights or the file fails.
+int bench_weight_file_open(BenchWeightFile* file, const char* path, const SNNNetwork* network);
+void bench_weight_file_close(BenchWeightFile* file);
+
+// A source over file with the given latency; staging NULL for a mapped one
+void bench_weight_file_source(BenchWeightFile* file, SNNWeightSource* source, void* staging,
+                              size_t staging_bytes, double access_ns, double ns_per_byte);
+
+// A helper thread copying out of file with its latency, standing in for
+// MDMA behind a prefetching source (snn_weights_prefetch()). clock stamps
+// the completion of each copy.
+int bench_weight_file_async(BenchWeightFile* file, SNNAsyncCopy* copy, uint32_t (*clock)(void));
+void bench_weight_file_async_stop(SNNAsyncCopy* copy);
+
+#endif // BENCH_WEIGHT_FILE_H
@@ -0,0 +1,1727 @@
+// Host benchmark for the snn_core kernels.
+//
+// Runs every firmware model end to end on its bundled test image and times
+// each layer in isolation, so kernel changes can be measured off-target,
+// then times the LIF state update on its own.
+//
+//   snn_bench [-n iterations] [-t timesteps] [-c] [-s] [-e] [-q] [-k] [-f] [-l] [-p] [-x] [-b] [-r] [-w] [-m]
+//             [-z] [model ...]
+//
+// -c times the direct (border/interior split), GEMM and Winograd convolutions
+// against an all-checked one, -s the shape-specialised convolutions against
+// the generic ones, -e adds a firing-rate sweep of the dense vs
+// event-driven convolution, -q compares the int8 weight build against the
+// float one, -k the 4-bit codebook build against the float one, -f the
+// fixed-point membranes of the LIF models against float ones, -l the
+// channels-last (HWC) convolutions against the CHW ones and -p block-sparse
+// linear layers pruned to a range of sparsities, -x early exits over a
+// range of windows and margins against the full run, -b the throughput
+// of batched runs by batch size, -r the row-streaming run, whole input
+// and row by row, against the whole-map one, -w weights read from a
+// file-backed external memory through mapped and copying weight sources,
+// -m the conv
+// layers tiled to the Cortex-M7 D-cache against untiled ones, with the
+// line fills of a model of that cache, and -z the
+// model run in place from an mmap'ed model blob, then a blob it must reject.
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "snn_core.h"
+#include "bench_models.h"
+#include "bench_weight_file.h"
+
+typedef void (*BenchModelFn)(BenchModel* model);
+
+static const struct {
+    const char* name;
+    BenchModelFn load;
+} bench_models[] = {
+    { "mnist_snn", bench_mnist_snn },
+    { "mnist_cnn", bench_mnist_cnn },
+    { "cifar_snn", bench_cifar_snn },
+};
+
+#define NUM_BENCH_MODELS (int)(sizeof(bench_models) / sizeof(bench_models[0]))
+
+static double now_us(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e6 + ts.tv_nsec / 1e3;
+}
+
+// Microsecond tick source for SNNRunConfig.clock
+static uint32_t clock_us(void) {
+    return (uint32_t)now_us();
+}
+
+static const char* layer_name(const SNNLayer* layer) {
+    switch (layer->type) {
+    case SNN_LAYER_CONV2D:    return "conv2d";
+    case SNN_LAYER_MAXPOOL2D: return "maxpool2d";
+    case SNN_LAYER_LINEAR:    return "linear";
+    }
+    return "?";
+}
+
+// Multiply-accumulates per inference, the usual cost measure for conv/FC
+static long layer_macs(const SNNLayer* layer) {
+    switch (layer->type) {
+    case SNN_LAYER_CONV2D:
+        return (long)snn_layer_output_count(layer) * layer->in_channels * layer->kernel_size * layer->kernel_size;
+    case SNN_LAYER_LINEAR:
+        return (long)layer->in_channels * layer->out_channels;
+    default:
+        return 0;
+    }
+}
+
+static void bench_layers(const SNNNetwork* network, const float* input, int iterations) {
+    int max_count = 0;
+    int max_scratch = 0;
+    for (int l = 0; l < network->num_layers; ++l) {
+        const SNNLayer* layer = &network->layers[l];
+        if (snn_layer_input_count(layer) > max_count) max_count = snn_layer_input_count(layer);
+        if (snn_layer_output_count(layer) > max_count) max_count = snn_layer_output_count(layer);
+        if (layer->type == SNN_LAYER_CONV2D) {
+            int tiles = snn_winograd_tiles(layer->input_size, layer->padding);
+            if (SNN_GEMM_COLUMNS(layer->in_channels, layer->kernel_size) > max_scratch) {
+                max_scratch = SNN_GEMM_COLUMNS(layer->in_channels, layer->kernel_size);
+            }
+            if (SNN_WINOGRAD_INPUT_FLOATS(layer->in_channels, tiles) > max_scratch) {
+                max_scratch = SNN_WINOGRAD_INPUT_FLOATS(layer->in_channels, tiles);
+            }
+        }
+    }
+
+    float* layer_input = calloc(max_count, sizeof(float));
+    float* layer_output = calloc(max_count, sizeof(float));
+    float* currents = calloc(max_count, sizeof(float));
+    int8_t* input_q8 = calloc(max_count, 1);
+    if (max_count > max_scratch) max_scratch = max_count;     // the HWC input of a channels-last layer
+    float* scratch = calloc(max_scratch, sizeof(float));
+    SNNLayerMemory memory = { NULL, currents, input_q8, NULL };
+    float* fused_output = calloc(max_count, sizeof(float));
+    int packed = 0;
+
+    // Feed each layer the real activations of the previous one
+    memcpy(layer_input, input, snn_layer_input_count(&network->layers[0]) * sizeof(float));
+
+    // Fusable conv rows also time the conv and the pool after it as one
+    // layer; the pool row checks the fused output against its own
+    printf("  %-3s %-10s %-18s %12s %14s %8s %12s %12s\n", "#", "layer", "in -> out", "MACs", "synops", "in nz",
+           "us/call", "fused us");
+    for (int l = 0; l < network->num_layers; ++l) {
+        const SNNLayer* layer = &network->layers[l];
+        SNNLayerWeights weights = snn_network_weights(network, l);
+        int input_count = snn_layer_input_count(layer);
+        int output_count = snn_layer_output_count(layer);
+        int nonzero = packed ? snn_spikes_count((const SNNSpikeWord*)layer_input, input_count)
+                             : snn_count_nonzero(layer_input, input_count);
+        const char* path = "";
+        char shape[32];
+        char fused[16] = "";
+        char synops[32] = "";
+        SNNSynapticOps ops = { 0, 0 };
+
+        snn_layer_count_synops(layer, &weights, layer_input, packed, &ops);
+        if (ops.acs > 0 || ops.macs > 0) {
+            snprintf(synops, sizeof(synops), "%lu %s", (unsigned long)(ops.acs > 0 ? ops.acs : ops.macs),
+                     ops.acs > 0 ? "AC" : "MAC");
+        }
+
+        memory.scratch = snn_layer_scratch_count(layer, &weights, packed, NULL) > 0 ? scratch : NULL;
+        double start = now_us();
+        for (int it = 0; it < iterations; ++it) {
+            snn_layer_forward(layer, &weights, layer_input, packed, layer_output, &memory);
+        }
+        double elapsed = (now_us() - start) / iterations;
+
+        if (snn_network_fuses_pool(network, l)) {
+            const SNNLayer* pool = &network->layers[l + 1];
+            start = now_us();
+            for (int it = 0; it < iterations; ++it) {
+                snn_layer_forward_pooled(layer, pool, &weights, layer_input, packed, fused_output, &memory);
+            }
+            snprintf(fused, sizeof(fused), "%.1f", (now_us() - start) / iterations);
+        } else if (l > 0 && snn_network_fuses_pool(network, l - 1)) {
+            size_t bytes = snn_layer_output_bytes(layer, packed);
+            snprintf(fused, sizeof(fused), "%s", memcmp(layer_output, fused_output, bytes) ? "MISMATCH" : "ok");
+        }
+
+        if (packed) {
+            path = "  (spikes)";
+        } else if (snn_layer_uses_events(layer, layer_input)) {
+            path = "  (events)";
+        }
+        snprintf(shape, sizeof(shape), "%d -> %d", input_count, output_count);
+        printf("  %-3d %-10s %-18s %12ld %14s %7.1f%% %12.1f %12s%s\n", l, layer_name(layer), shape,
+               layer_macs(layer), synops, 100.0 * nonzero / input_count, elapsed, fused, path);
+
+        packed = snn_layer_output_packed(layer, packed);
+        float* swap = layer_input;
+        layer_input = layer_output;
+        layer_output = swap;
+    }
+
+    free(layer_input);
+    free(layer_output);
+    free(currents);
+    free(input_q8);
+    free(scratch);
+    free(fused_output);
+}
+
+// snn_conv2d() as it was before the border/interior split, with every tap
+// bounds-checked: the baseline and reference for bench_conv()
+static void conv2d_checked(const float* input, float* output, const float* weights, const float* biases,
+                           int in_channels, int out_channels, int input_size, int kernel_size, int stride,
+                           int padding) {
+    int output_size = snn_conv_output_size(input_size, kernel_size, stride, padding);
+    int taps = kernel_size * kernel_size;
+
+    for (int oc = 0; oc < out_channels; ++oc) {
+        for (int oh = 0; oh < output_size; ++oh) {
+            for (int ow = 0; ow < output_size; ++ow) {
+                float sum = biases != NULL ? biases[oc] : 0;
+                for (int ic = 0; ic < in_channels; ++ic) {
+                    for (int kh = 0; kh < kernel_size; ++kh) {
+                        for (int kw = 0; kw < kernel_size; ++kw) {
+                            int ih = oh * stride + kh - padding;
+                            int iw = ow * stride + kw - padding;
+                            if (ih >= 0 && ih < input_size && iw >= 0 && iw < input_size) {
+                                sum += input[(ic * input_size + ih) * input_size + iw] *
+                                       weights[(oc * in_channels + ic) * taps + kh * kernel_size + kw];
+                            }
+                        }
+                    }
+                }
+                output[(oc * output_size + oh) * output_size + ow] = sum;
+            }
+        }
+    }
+}
+
+// Winograd outputs differ from the direct ones by float rounding; the
+// largest error allowed, relative to the output magnitude (plus one)
+#define WINOGRAD_TOLERANCE 1e-4
+
+// Time the direct, GEMM and Winograd convolutions of every conv layer against
+// the all-checked baseline on a random input; the first three must agree bit
+// for bit
+static void bench_conv(const SNNNetwork* network, int iterations) {
+    unsigned seed = 3;
+
+    printf("  %-3s %-10s %-8s %12s %12s %8s %12s %8s %12s %8s\n", "#", "dense conv", "map", "checked us",
+           "direct us", "speedup", "gemm us", "speedup", "winograd us", "speedup");
+    for (int l = 0; l < network->num_layers; ++l) {
+        const SNNLayer* layer = &network->layers[l];
+        if (layer->type != SNN_LAYER_CONV2D) continue;
+
+        int input_count = snn_layer_input_count(layer);
+        int output_count = snn_layer_output_count(layer);
+        int winograd = layer->kernel_size == 3 && layer->stride == 1;
+        int tiles = snn_winograd_tiles(layer->input_size, layer->padding);
+        float* input = malloc(input_count * sizeof(float));
+        float* checked = malloc(output_count * sizeof(float));
+        float* direct = malloc(output_count * sizeof(float));
+        float* gemm = malloc(output_count * sizeof(float));
+        float* columns = malloc(SNN_GEMM_COLUMNS(layer->in_channels, layer->kernel_size) * sizeof(float));
+        float* tiled = malloc(SNN_WINOGRAD_INPUT_FLOATS(layer->in_channels, tiles) * sizeof(float));
+        float* transformed = malloc(layer->out_channels * layer->in_channels * 16 * sizeof(float));
+        char map[16];
+        char winograd_us[16] = "-";
+        char winograd_speedup[16] = "-";
+        double winograd_error = 0;
+
+        for (int i = 0; i < input_count; ++i) {
+            seed = seed * 1103515245u + 12345u;
+            input[i] = (float)((seed >> 8) % 1000) / 1000.0f;
+        }
+
+        double start = now_us();
+        for (int it = 0; it < iterations; ++it) {
+            conv2d_checked(input, checked, layer->weights, layer->biases, layer->in_channels,
+                           layer->out_channels, layer->input_size, layer->kernel_size, layer->stride,
+                           layer->padding);
+        }
+        double checked_us = (now_us() - start) / iterations;
+
+        start = now_us();
+        for (int it = 0; it < iterations; ++it) {
+            snn_conv2d(input, direct, layer->weights, layer->biases, layer->in_channels, layer->out_channels,
+                       layer->input_size, layer->kernel_size, layer->stride, layer->padding);
+        }
+        double direct_us = (now_us() - start) / iterations;
+
+        start = now_us();
+        for (int it = 0; it < iterations; ++it) {
+            snn_conv2d_gemm(input, gemm, layer->weights, layer->biases, layer->in_channels, layer->out_channels,
+                            layer->input_size, layer->kernel_size, layer->stride, layer->padding, columns);
+        }
+        double gemm_us = (now_us() - start) / iterations;
+        int mismatch = memcmp(checked, direct, output_count * sizeof(float)) != 0 ||
+                       memcmp(checked, gemm, output_count * sizeof(float)) != 0;
+
+        // Kernels are transformed offline, so only the input transform is
+        // timed; the result reuses the gemm buffer
+        if (winograd) {
+            snn_winograd_weights(layer->weights, transformed, layer->in_channels, layer->out_channels);
+            start = now_us();
+            for (int it = 0; it < iterations; ++it) {
+                snn_winograd_input(input, tiled, layer->in_channels, layer->input_size, layer->padding);
+                snn_conv2d_winograd(tiled, gemm, transformed, layer->biases, layer->in_channels,
+                                    layer->out_channels, layer->input_size, layer->padding);
+            }
+            double elapsed = (now_us() - start) / iterations;
+            snprintf(winograd_us, sizeof(winograd_us), "%.1f", elapsed);
+            snprintf(winograd_speedup, sizeof(winograd_speedup), "%.2fx", checked_us / elapsed);
+            for (int i = 0; i < output_count; ++i) {
+                double error = fabs(gemm[i] - checked[i]) / (fabs(checked[i]) + 1.0);
+                if (error > winograd_error) winograd_error = error;
+            }
+        }
+
+        mismatch |= winograd_error > WINOGRAD_TOLERANCE;
+        snprintf(map, sizeof(map), "%dx%d", layer->input_size, layer->input_size);
+        printf("  %-3d %-10s %-8s %12.1f %12.1f %7.2fx %12.1f %7.2fx %12s %8s%s%s\n", l, "conv2d", map,
+               checked_us, direct_us, checked_us / direct_us, gemm_us, checked_us / gemm_us, winograd_us,
+               winograd_speedup, layer->algorithm == SNN_CONV_GEMM ? "  (gemm)" : "", mismatch ? "  MISMATCH" : "");
+
+        free(input);
+        free(checked);
+        free(direct);
+        free(gemm);
+        free(columns);
+        free(tiled);
+        free(transformed);
+    }
+}
+
+// Time the shape-specialised kernels of the model against the generic ones
+// they replace, on random input (20% spikes for the spike kernels); both
+// must agree bit for bit. Code sizes come from the snn_kernel_sizes target.
+static void bench_specialized(const SNNNetwork* network, int iterations) {
+    unsigned seed = 5;
+
+    printf("  %-3s %-18s %-8s %12s %14s %8s\n", "#", "specialised conv", "input", "generic us", "specialised us",
+           "speedup");
+    for (int l = 0; network->kernels != NULL && l < network->num_layers; ++l) {
+        const SNNLayer* layer = &network->layers[l];
+        const SNNConvKernel* conv = network->kernels[l];
+        if (conv == NULL) continue;
+
+        if (snn_network_weights(network, l).conv != conv) {
+            printf("  %-3d %-18s shape does not match the layer, unused\n", l, "conv2d");
+            continue;
+        }
+
+        int input_count = snn_layer_input_count(layer);
+        int output_count = snn_layer_output_count(layer);
+        float* input = malloc(input_count * sizeof(float));
+        SNNSpikeWord* packed = malloc(SNN_SPIKE_WORDS(input_count) * sizeof(SNNSpikeWord));
+        float* generic = malloc(output_count * sizeof(float));
+        float* specialized = malloc(output_count * sizeof(float));
+        double generic_us;
+        double specialized_us;
+
+        for (int i = 0; i < input_count; ++i) {
+            seed = seed * 1103515245u + 12345u;
+            input[i] = conv->spikes != NULL ? ((seed >> 8) % 100 < 20 ? 1.0f : 0.0f)
+                                            : (float)((seed >> 8) % 1000) / 1000.0f;
+        }
+        snn_spikes_pack(input, packed, input_count);
+
+        double start = now_us();
+        for (int it = 0; it < iterations; ++it) {
+            if (conv->spikes != NULL) {
+                snn_conv2d_spikes(packed, generic, layer->weights, layer->biases, layer->in_channels,
+                                  layer->out_channels, layer->input_size, layer->kernel_size, layer->stride,
+                                  layer->padding);
+            } else {
+                snn_conv2d(input, generic, layer->weights, layer->biases, layer->in_channels, layer->out_channels,
+                           layer->input_size, layer->kernel_size, layer->stride, layer->padding);
+            }
+        }
+        generic_us = (now_us() - start) / iterations;
+
+        start = now_us();
+        for (int it = 0; it < iterations; ++it) {
+            if (conv->spikes != NULL) {
+                conv->spikes(packed, specialized, layer->weights, layer->biases, layer->out_channels);
+            } else {
+                conv->dense(input, specialized, layer->weights, layer->biases, layer->out_channels);
+            }
+        }
+        specialized_us = (now_us() - start) / iterations;
+
+        printf("  %-3d %-18s %-8s %12.1f %14.1f %7.2fx%s\n", l, "conv2d", conv->spikes != NULL ? "spikes" : "dense",
+               generic_us, specialized_us, generic_us / specialized_us,
+               memcmp(generic, specialized, output_count * sizeof(float)) ? "  MISMATCH" : "");
+
+        free(input);
+        free(packed);
+        free(generic);
+        free(specialized);
+    }
+}
+
+// Time the dense and event-driven kernels of every event-enabled conv layer
+// on random spike maps of increasing firing rate, to place max_event_rate
+static void bench_event_sweep(const SNNNetwork* network, int iterations) {
+    static const double rates[] = { 0.01, 0.02, 0.05, 0.1, 0.2, 0.3, 0.5 };
+
+    for (int l = 0; l < network->num_layers; ++l) {
+        const SNNLayer* layer = &network->layers[l];
+        if (layer->type != SNN_LAYER_CONV2D || layer->max_event_rate <= 0) continue;
+
+        int input_count = snn_layer_input_count(layer);
+        int output_count = snn_layer_output_count(layer);
+        float* spikes = malloc(input_count * sizeof(float));
+        float* dense = malloc(output_count * sizeof(float));
+        float* events = malloc(output_count * sizeof(float));
+        SNNSpikeWord* packed = malloc(SNN_SPIKE_WORDS(input_count) * sizeof(SNNSpikeWord));
+        unsigned seed = 1;
+
+        printf("  layer %d, max_event_rate %.2f\n", l, layer->max_event_rate);
+        printf("  %8s %12s %12s %12s %8s\n", "rate", "dense us", "events us", "spikes us", "speedup");
+        for (size_t r = 0; r < sizeof(rates) / sizeof(rates[0]); ++r) {
+            for (int i = 0; i < input_count; ++i) {
+                seed = seed * 1103515245u + 12345u;
+                spikes[i] = (seed >> 8) % 10000 < rates[r] * 10000 ? 1.0f : 0.0f;
+            }
+
+            double start = now_us();
+            for (int it = 0; it < iterations; ++it) {
+                snn_conv2d(spikes, dense, layer->weights, layer->biases, layer->in_channels, layer->out_channels,
+                           layer->input_size, layer->kernel_size, layer->stride, layer->padding);
+            }
+            double dense_us = (now_us() - start) / iterations;
+
+            start = now_us();
+            for (int it = 0; it < iterations; ++it) {
+                snn_conv2d_events(spikes, events, layer->weights, layer->biases, layer->in_channels,
+                                  layer->out_channels, layer->input_size, layer->kernel_size, layer->stride,
+                                  layer->padding);
+            }
+            double events_us = (now_us() - start) / iterations;
+            int mismatch = memcmp(dense, events, output_count * sizeof(float)) != 0;
+
+            snn_spikes_pack(spikes, packed, input_count);
+            start = now_us();
+            for (int it = 0; it < iterations; ++it) {
+                snn_conv2d_spikes(packed, events, layer->weights, layer->biases, layer->in_channels,
+                                  layer->out_channels, layer->input_size, layer->kernel_size, layer->stride,
+                                  layer->padding);
+            }
+            double spikes_us = (now_us() - start) / iterations;
+            mismatch |= memcmp(dense, events, output_count * sizeof(float)) != 0;
+
+            printf("  %7.0f%% %12.1f %12.1f %12.1f %7.2fx%s\n", 100.0 * rates[r], dense_us, events_us,
+                   spikes_us, dense_us / events_us, mismatch ? "  MISMATCH" : "");
+        }
+
+        free(spikes);
+        free(dense);
+        free(events);
+        free(packed);
+    }
+}
+
+typedef struct {
+    int iterations;
+    int timesteps;      // 0 for the network default
+    int event_sweep;
+    int quantized;
+    int fixed;
+    int conv;
+    int specialized;
+    int layout;
+    int sparse;
+    int codebook;
+    int early_exit;
+    int batch;
+    int stream;
+    int weights;
+    int memory;
+    int blob;
+} BenchOptions;
+
+// A copy of network on int8 weights, quantized the way snn_quantize
+// quantizes them for the firmware headers
+static SNNNetwork quantize_network(const SNNNetwork* network, SNNQuantWeights* table) {
+    SNNNetwork quantized = *network;
+
+    for (int l = 0; l < network->num_layers; ++l) {
+        const SNNLayer* layer = &network->layers[l];
+        int count = snn_layer_weight_count(layer);
+
+        table[l].weights = NULL;
+        table[l].scales = NULL;
+        if (count == 0) continue;
+
+        int8_t* weights = malloc(count);
+        float* scales = malloc(layer->out_channels * sizeof(float));
+        snn_quantize_weights(layer->weights, layer->out_channels, count / layer->out_channels, weights, scales);
+        table[l].weights = weights;
+        table[l].scales = scales;
+    }
+    quantized.quantized = table;
+    return quantized;
+}
+
+// Time a run and keep a copy of its decoded outputs
+static double time_run(const SNNNetwork* network, const float* input, int timesteps, int iterations,
+                       float* outputs, int* predicted) {
+    SNNRunConfig config = { timesteps, NULL };
+    SNNRunResult result;
+    size_t arena_size = snn_network_arena_size(network, timesteps);
+    void* arena = malloc(arena_size);
+    const SNNLayer* last = &network->layers[network->num_layers - 1];
+
+    double start = now_us();
+    for (int it = 0; it < iterations; ++it) {
+        snn_network_run(network, input, arena, arena_size, &config, &result);
+    }
+    double elapsed = (now_us() - start) / iterations;
+
+    memcpy(outputs, result.outputs, snn_layer_output_count(last) * sizeof(float));
+    *predicted = result.predicted;
+    free(arena);
+    return elapsed;
+}
+
+// Predictions, latency and output error of a variant build of a model
+// against the base one (model->network for the float build), then the
+// variant's per-layer timings
+static void compare_build(const BenchModel* model, const SNNNetwork* base, const char* base_name,
+                          const SNNNetwork* variant, const char* name, int timesteps, int iterations) {
+    const SNNNetwork* network = base;
+    const SNNLayer* last = &network->layers[network->num_layers - 1];
+    int output_count = snn_layer_output_count(last);
+    float* float_outputs = malloc(output_count * sizeof(float));
+    float* variant_outputs = malloc(output_count * sizeof(float));
+    int float_predicted;
+    int variant_predicted;
+
+    double float_us = time_run(network, model->input, timesteps, iterations, float_outputs, &float_predicted);
+    double variant_us = time_run(variant, model->input, timesteps, iterations, variant_outputs,
+                                 &variant_predicted);
+
+    float max_error = 0;
+    float max_output = 0;
+    for (int i = 0; i < output_count; ++i) {
+        float error = float_outputs[i] > variant_outputs[i] ? float_outputs[i] - variant_outputs[i]
+                                                            : variant_outputs[i] - float_outputs[i];
+        float magnitude = float_outputs[i] < 0 ? -float_outputs[i] : float_outputs[i];
+        if (error > max_error) max_error = error;
+        if (magnitude > max_output) max_output = magnitude;
+    }
+
+    // All-zero base outputs, such as the untrained cifar_snn's, leave no
+    // scale for the error; it is then reported absolute only
+    char relative[48] = "n/a, all base outputs are 0";
+    if (max_output > 0) {
+        snprintf(relative, sizeof(relative), "%.1f%% of the largest output", 100.0 * max_error / max_output);
+    }
+    printf("  %-6s predicted %d, %.1f us\n", base_name, float_predicted, float_us);
+    printf("  %-6s predicted %d, %.1f us (%.2fx), max output error %g (%s)%s\n", name, variant_predicted,
+           variant_us, float_us / variant_us, max_error, relative,
+           variant_predicted != float_predicted ? "  PREDICTION DIFFERS" : "");
+    bench_layers(variant, model->input, iterations);
+
+    free(float_outputs);
+    free(variant_outputs);
+}
+
+// Channels-last outputs differ from the CHW ones by float rounding; the
+// largest error allowed, relative to the output magnitude (plus one)
+#define HWC_TOLERANCE 1e-5
+
+// Whether snn_ohwi gives a conv layer OHWI weights: runs of fewer input
+// channels are too short to pay for the input transform
+static int hwc_layer(const SNNLayer* layer) {
+    return layer->type == SNN_LAYER_CONV2D && layer->in_channels >= 4;
+}
+
+// Time every conv layer in both layouts on a random input, the HWC one
+// including its input transform, then run the model end to end on OHWI
+// weights against the CHW direct build (no Winograd in either)
+static void bench_layout(const BenchModel* model, int timesteps, int iterations) {
+    const SNNNetwork* network = model->network;
+    const float* table[SNN_MAX_LAYERS] = { NULL };
+    SNNNetwork chw = *network;
+    SNNNetwork hwc = *network;
+    unsigned seed = 7;
+
+    printf("  %-3s %-10s %-8s %12s %12s %12s %8s\n", "#", "dense conv", "map", "chw us", "hwc us", "transform us",
+           "speedup");
+    for (int l = 0; l < network->num_layers; ++l) {
+        const SNNLayer* layer = &network->layers[l];
+        if (layer->type != SNN_LAYER_CONV2D) continue;
+
+        int input_count = snn_layer_input_count(layer);
+        int output_count = snn_layer_output_count(layer);
+        float* input = malloc(input_count * sizeof(float));
+        float* transposed = malloc(input_count * sizeof(float));
+        float* ohwi = malloc(snn_layer_weight_count(layer) * sizeof(float));
+        float* direct = malloc(output_count * sizeof(float));
+        float* channels_last = malloc(output_count * sizeof(float));
+        double error = 0;
+        char map[16];
+
+        for (int i = 0; i < input_count; ++i) {
+            seed = seed * 1103515245u + 12345u;
+            input[i] = (float)((seed >> 8) % 1000) / 1000.0f;
+        }
+        snn_weights_to_ohwi(layer->weights, ohwi, layer->in_channels, layer->out_channels, layer->kernel_size);
+
+        double start = now_us();
+        for (int it = 0; it < iterations; ++it) {
+            snn_conv2d(input, direct, layer->weights, layer->biases, layer->in_channels, layer->out_channels,
+                       layer->input_size, layer->kernel_size, layer->stride, layer->padding);
+        }
+        double chw_us = (now_us() - start) / iterations;
+
+        start = now_us();
+        for (int it = 0; it < iterations; ++it) {
+            snn_chw_to_hwc(input, transposed, layer->in_channels, layer->input_size);
+        }
+        double transform_us = (now_us() - start) / iterations;
+
+        start = now_us();
+        for (int it = 0; it < iterations; ++it) {
+            snn_chw_to_hwc(input, transposed, layer->in_channels, layer->input_size);
+            snn_conv2d_hwc(transposed, channels_last, ohwi, layer->biases, layer->in_channels, layer->out_channels,
+                           layer->input_size, layer->kernel_size, layer->stride, layer->padding);
+        }
+        double hwc_us = (now_us() - start) / iterations;
+
+        for (int i = 0; i < output_count; ++i) {
+            double e = fabs(channels_last[i] - direct[i]) / (fabs(direct[i]) + 1.0);
+            if (e > error) error = e;
+        }
+        snprintf(map, sizeof(map), "%dx%dx%d", layer->in_channels, layer->input_size, layer->input_size);
+        printf("  %-3d %-10s %-8s %12.1f %12.1f %12.1f %7.2fx%s\n", l, "conv2d", map, chw_us, hwc_us, transform_us,
+               chw_us / hwc_us, error > HWC_TOLERANCE ? "  MISMATCH" : "");
+
+        if (hwc_layer(layer)) {
+            table[l] = ohwi;
+        } else {
+            free(ohwi);
+        }
+        free(input);
+        free(transposed);
+        free(direct);
+        free(channels_last);
+    }
+
+    chw.winograd = NULL;
+    hwc.winograd = NULL;
+    hwc.ohwi = table;
+    compare_build(model, &chw, "chw:", &hwc, "hwc:", timesteps, iterations);
+
+    for (int l = 0; l < network->num_layers; ++l) {
+        free((void*)table[l]);
+    }
+}
+
+// Mean microseconds of the linear layers of a run and of the whole run,
+// keeping a copy of its decoded outputs
+static double time_linear(const SNNNetwork* network, const float* input, int timesteps, int iterations,
+                          float* outputs, int* predicted, double* total_us) {
+    SNNRunConfig config = { timesteps, clock_us, 0 };
+    SNNRunResult result;
+    size_t arena_size = snn_network_arena_size(network, timesteps);
+    void* arena = malloc(arena_size);
+    const SNNLayer* last = &network->layers[network->num_layers - 1];
+    double linear_us = 0;
+
+    double start = now_us();
+    for (int it = 0; it < iterations; ++it) {
+        snn_network_run(network, input, arena, arena_size, &config, &result);
+        for (int l = 0; l < network->num_layers; ++l) {
+            if (network->layers[l].type == SNN_LAYER_LINEAR) linear_us += result.layer_ticks[l];
+        }
+    }
+    *total_us = (now_us() - start) / iterations;
+
+    memcpy(outputs, result.outputs, snn_layer_output_count(last) * sizeof(float));
+    *predicted = result.predicted;
+    free(arena);
+    return linear_us / iterations;
+}
+
+static const float bench_sparsities[] = { 0.5f, 0.75f, 0.9f };
+
+#define NUM_BENCH_SPARSITIES (int)(sizeof(bench_sparsities) / sizeof(bench_sparsities[0]))
+
+// Prune every linear layer to each of bench_sparsities the way snn_sparse
+// does, then time the block-sparse kernels against the dense ones on the
+// same pruned weights (which they must match exactly) and compare the
+// outputs with the unpruned float build
+static void bench_sparse(const BenchModel* model, int timesteps, int iterations) {
+    const SNNNetwork* network = model->network;
+    const SNNLayer* last = &network->layers[network->num_layers - 1];
+    int output_count = snn_layer_output_count(last);
+    float* float_outputs = malloc(output_count * sizeof(float));
+    float* dense_outputs = malloc(output_count * sizeof(float));
+    float* sparse_outputs = malloc(output_count * sizeof(float));
+    int float_predicted;
+    size_t dense_bytes = 0;
+    double total_us;
+
+    for (int l = 0; l < network->num_layers; ++l) {
+        if (network->layers[l].type == SNN_LAYER_LINEAR) {
+            dense_bytes += snn_layer_weight_count(&network->layers[l]) * sizeof(float);
+        }
+    }
+    double float_us = time_linear(network, model->input, timesteps, iterations, float_outputs, &float_predicted,
+                                  &total_us);
+    printf("  %-8s %14s %10s %10s %8s %9s %14s\n", "sparsity", "fc bytes", "dense us", "sparse us", "speedup",
+           "predicted", "max error");
+    printf("  %-8s %14zu %10.1f %10s %8s %9d %14s\n", "0%", dense_bytes, float_us, "", "", float_predicted, "");
+
+    for (int s = 0; s < NUM_BENCH_SPARSITIES; ++s) {
+        SNNLayer layers[SNN_MAX_LAYERS];
+        SNNSparseWeights table[SNN_MAX_LAYERS];
+        SNNNetwork pruned = *network;
+        SNNNetwork sparse = *network;
+        uint32_t sparse_bytes = 0;
+        int dense_predicted;
+        int sparse_predicted;
+        char label[16];
+
+        memcpy(layers, network->layers, network->num_layers * sizeof(SNNLayer));
+        memset(table, 0, sizeof(table));
+        for (int l = 0; l < network->num_layers; ++l) {
+            SNNLayer* layer = &layers[l];
+            if (layer->type != SNN_LAYER_LINEAR || layer->in_channels % SNN_SPARSE_BLOCK != 0) continue;
+
+            float* weights = malloc(snn_layer_weight_count(layer) * sizeof(float));
+            snn_prune_blocks(layer->weights, weights, layer->out_channels, layer->in_channels, bench_sparsities[s]);
+            int blocks = snn_sparse_block_count(weights, layer->out_channels, layer->in_channels);
+            float* values = malloc((size_t)blocks * SNN_SPARSE_BLOCK * sizeof(float));
+            uint16_t* columns = malloc(blocks * sizeof(uint16_t));
+            uint32_t* row_starts = malloc((layer->out_channels + 1) * sizeof(uint32_t));
+            snn_sparse_pack(weights, layer->out_channels, layer->in_channels, values, columns, row_starts);
+
+            layer->weights = weights;
+            table[l].values = values;
+            table[l].columns = columns;
+            table[l].row_starts = row_starts;
+            sparse_bytes += snn_sparse_bytes(blocks, layer->out_channels);
+        }
+        pruned.layers = layers;
+        sparse.layers = layers;
+        sparse.sparse = table;
+
+        double dense_us = time_linear(&pruned, model->input, timesteps, iterations, dense_outputs, &dense_predicted,
+                                      &total_us);
+        double sparse_us = time_linear(&sparse, model->input, timesteps, iterations, sparse_outputs,
+                                       &sparse_predicted, &total_us);
+
+        float max_error = 0;
+        for (int i = 0; i < output_count; ++i) {
+            float error = fabsf(sparse_outputs[i] - float_outputs[i]);
+            if (error > max_error) max_error = error;
+        }
+        snprintf(label, sizeof(label), "%.0f%%", 100.0 * bench_sparsities[s]);
+        printf("  %-8s %14u %10.1f %10.1f %7.2fx %9d %14g%s\n", label, (unsigned)sparse_bytes, dense_us, sparse_us,
+               sparse_us > 0 ? dense_us / sparse_us : 0.0, sparse_predicted, max_error,
+               memcmp(dense_outputs, sparse_outputs, output_count * sizeof(float)) ? "  MISMATCH" : "");
+
+        for (int l = 0; l < network->num_layers; ++l) {
+            if (table[l].values == NULL) continue;
+            free((void*)layers[l].weights);
+            free((void*)table[l].values);
+            free((void*)table[l].columns);
+            free((void*)table[l].row_starts);
+        }
+    }
+
+    free(float_outputs);
+    free(dense_outputs);
+    free(sparse_outputs);
+}
+
+// A copy of network on 4-bit codebook weights, fitted the way snn_codebook
+// fits them for the firmware headers
+static SNNNetwork codebook_network(const SNNNetwork* network, SNNCodebookWeights* table) {
+    SNNNetwork encoded = *network;
+
+    for (int l = 0; l < network->num_layers; ++l) {
+        const SNNLayer* layer = &network->layers[l];
+        int count = snn_layer_weight_count(layer);
+
+        table[l].indices = NULL;
+        table[l].codebook = NULL;
+        if (count == 0) continue;
+
+        uint8_t* indices = malloc(SNN_CODEBOOK_INDEX_BYTES(count));
+        float* codebook = malloc(SNN_CODEBOOK_SIZE * sizeof(float));
+        snn_codebook_fit(layer->weights, count, codebook);
+        snn_codebook_encode(layer->weights, count, codebook, indices);
+        table[l].indices = indices;
+        table[l].codebook = codebook;
+    }
+    encoded.codebook = table;
+    return encoded;
+}
+
+// Accuracy, latency and per-layer decode overhead of the 4-bit codebook
+// build against the float one. Codebook convolutions run direct, so the
+// float build runs without Winograd or OHWI kernels too.
+static void bench_codebook(const BenchModel* model, int timesteps, int iterations) {
+    const SNNNetwork* network = model->network;
+    SNNCodebookWeights table[SNN_MAX_LAYERS];
+    SNNNetwork encoded = codebook_network(network, table);
+    SNNNetwork direct = *network;
+    size_t float_bytes = 0;
+    size_t codebook_bytes = 0;
+
+    for (int l = 0; l < network->num_layers; ++l) {
+        int count = snn_layer_weight_count(&network->layers[l]);
+        float_bytes += count * sizeof(float);
+        codebook_bytes += count > 0 ? SNN_CODEBOOK_INDEX_BYTES(count) + SNN_CODEBOOK_SIZE * sizeof(float) : 0;
+    }
+
+    direct.winograd = NULL;
+    direct.ohwi = NULL;
+    printf("  codebook weights: %zu bytes (float %zu)\n", codebook_bytes, float_bytes);
+
+    // Decoding inside the kernels must match the float kernels run on the
+    // decoded weights exactly
+    SNNLayer layers[SNN_MAX_LAYERS];
+    SNNNetwork decoded = direct;
+    const SNNLayer* last = &network->layers[network->num_layers - 1];
+    int output_count = snn_layer_output_count(last);
+    float* decoded_outputs = malloc(output_count * sizeof(float));
+    float* encoded_outputs = malloc(output_count * sizeof(float));
+    int decoded_predicted;
+    int encoded_predicted;
+
+    memcpy(layers, network->layers, network->num_layers * sizeof(SNNLayer));
+    for (int l = 0; l < network->num_layers; ++l) {
+        int count = snn_layer_weight_count(&layers[l]);
+        if (count == 0) continue;
+        float* weights = malloc(count * sizeof(float));
+        snn_codebook_decode(&table[l], 0, count, weights);
+        layers[l].weights = weights;
+    }
+    decoded.layers = layers;
+    time_run(&decoded, model->input, timesteps, 1, decoded_outputs, &decoded_predicted);
+    time_run(&encoded, model->input, timesteps, 1, encoded_outputs, &encoded_predicted);
+    printf("  decoded float weights: predicted %d, %s\n", decoded_predicted,
+           memcmp(decoded_outputs, encoded_outputs, output_count * sizeof(float)) ? "MISMATCH" : "same outputs");
+
+    bench_layers(&direct, model->input, iterations);
+    compare_build(model, &direct, "float:", &encoded, "4-bit:", timesteps, iterations);
+
+    for (int l = 0; l < network->num_layers; ++l) {
+        if (table[l].indices == NULL) continue;
+        free((void*)layers[l].weights);
+        free((void*)table[l].indices);
+        free((void*)table[l].codebook);
+    }
+    free(decoded_outputs);
+    free(encoded_outputs);
+}
+
+static const int bench_exit_windows[] = { 1, 2, 4 };
+static const float bench_exit_margins[] = { 1, 2, 4, 8, 16 };
+
+#define NUM_EXIT_WINDOWS (int)(sizeof(bench_exit_windows) / sizeof(bench_exit_windows[0]))
+#define NUM_EXIT_MARGINS (int)(sizeof(bench_exit_margins) / sizeof(bench_exit_margins[0]))
+
+// Exits need a summed output, so single-step models run EXIT_TIMESTEPS
+// steps unless -t asks for more than one
+#define EXIT_TIMESTEPS 16
+
+// The test image and SNN_MAX_BATCH - 1 copies of it with random pixels
+// rescaled
+static float* bench_images(const BenchModel* model, const float* inputs[SNN_MAX_BATCH]) {
+    float* images = malloc((size_t)SNN_MAX_BATCH * model->input_count * sizeof(float));
+    unsigned seed = 5;
+
+    for (int b = 0; b < SNN_MAX_BATCH; ++b) {
+        float* image = images + (size_t)b * model->input_count;
+        for (int i = 0; i < model->input_count; ++i) {
+            seed = seed * 1103515245u + 12345u;
+            image[i] = model->input[i] * (b == 0 || (seed >> 8) % 4 != 0 ? 1.0f : (float)((seed >> 12) % 200) / 100);
+        }
+        inputs[b] = image;
+    }
+    return images;
+}
+
+// Early exits over a range of windows and margins against the full run,
+// on the test image and perturbed copies of it (bench_images()): mean
+// steps taken, mean latency and how many predictions the exit changed.
+// The model's own default, if it has one, is marked.
+static void bench_early_exit(const BenchModel* model, int timesteps, int iterations) {
+    const SNNNetwork* network = model->network;
+    const float* inputs[SNN_MAX_BATCH];
+    float* images = bench_images(model, inputs);
+    int full_predicted[SNN_MAX_BATCH];
+    SNNRunResult result;
+    size_t arena_size;
+    void* arena;
+
+    if (timesteps < 2) timesteps = EXIT_TIMESTEPS;
+    arena_size = snn_network_arena_size(network, timesteps);
+    arena = malloc(arena_size);
+
+    printf("  %-7s %-7s %8s %10s %8s\n", "window", "margin", "steps", "us", "changed");
+    for (int w = -1; w < NUM_EXIT_WINDOWS; ++w) {
+        for (int m = 0; m < (w < 0 ? 1 : NUM_EXIT_MARGINS); ++m) {
+            SNNRunConfig config = { timesteps, NULL, 0, w < 0 ? -1 : bench_exit_windows[w],
+                                    w < 0 ? 0 : bench_exit_margins[m] };
+            int steps = 0;
+            int changed = 0;
+
+            double start = now_us();
+            for (int it = 0; it < iterations; ++it) {
+                for (int b = 0; b < SNN_MAX_BATCH; ++b) {
+                    snn_network_run(network, inputs[b], arena, arena_size, &config, &result);
+                    if (it > 0) continue;
+                    steps += result.timesteps;
+                    if (w < 0) {
+                        full_predicted[b] = result.predicted;
+                    } else {
+                        changed += result.predicted != full_predicted[b];
+                    }
+                }
+            }
+            double elapsed = (now_us() - start) / iterations / SNN_MAX_BATCH;
+
+            if (w < 0) {
+                printf("  %-15s %8.1f %10.1f\n", "full run", (double)steps / SNN_MAX_BATCH, elapsed);
+                continue;
+            }
+            printf("  %-7d %-7g %8.1f %10.1f %5d/%d%s\n", config.exit_window, config.exit_margin,
+                   (double)steps / SNN_MAX_BATCH, elapsed, changed, SNN_MAX_BATCH,
+                   config.exit_window == network->exit_window && config.exit_margin == network->exit_margin
+                       ? "  (model default)" : "");
+        }
+    }
+    free(arena);
+    free(images);
+}
+
+// Throughput of snn_network_run_batch() at every power-of-two batch size
+// over SNN_MAX_BATCH images: the test image and copies of it with random
+// pixels rescaled. Every batch must give each image the outputs of a
+// single-image run bit for bit. The host caches hold every model's
+// weights, so the flash traffic a batch saves on the target shows in the
+// weight bytes read per image rather than in the host throughput.
+static void bench_batch(const BenchModel* model, int timesteps, int iterations) {
+    const SNNNetwork* network = model->network;
+    int output_count = snn_layer_output_count(&network->layers[network->num_layers - 1]);
+    float* expected = malloc((size_t)SNN_MAX_BATCH * output_count * sizeof(float));
+    const float* inputs[SNN_MAX_BATCH];
+    float* images = bench_images(model, inputs);
+    SNNRunResult results[SNN_MAX_BATCH];
+    SNNRunConfig config = { timesteps, NULL };
+    double single_rate = 0;
+    size_t weight_bytes = 0;
+
+    for (int l = 0; l < network->num_layers; ++l) {
+        weight_bytes += snn_layer_weight_count(&network->layers[l]) * sizeof(float);
+    }
+
+    size_t single_size = snn_network_arena_size(network, timesteps);
+    void* single = malloc(single_size);
+    for (int b = 0; b < SNN_MAX_BATCH; ++b) {
+        snn_network_run(network, inputs[b], single, single_size, &config, &results[0]);
+        memcpy(expected + b * output_count, results[0].outputs, output_count * sizeof(float));
+    }
+    free(single);
+
+    printf("  %-6s %10s %14s %12s %8s\n", "batch", "arena", "weights/image", "images/s", "speedup");
+    for (int batch = 1; batch <= SNN_MAX_BATCH; batch *= 2) {
+        size_t arena_size = snn_network_batch_arena_size(network, timesteps, batch);
+        void* arena = malloc(arena_size);
+        int same = 1;
+
+        double start = now_us();
+        for (int it = 0; it < iterations; ++it) {
+            for (int first = 0; first < SNN_MAX_BATCH; first += batch) {
+                snn_network_run_batch(network, inputs + first, batch, arena, arena_size, &config, results);
+                for (int b = 0; b < batch; ++b) {
+                    same &= memcmp(results[b].outputs, expected + (first + b) * output_count,
+                                   output_count * sizeof(float)) == 0;
+                }
+            }
+        }
+        double rate = 1e6 * SNN_MAX_BATCH * iterations / (now_us() - start);
+        if (batch == 1) single_rate = rate;
+
+        printf("  %-6d %10zu %14zu %12.1f %7.2fx%s\n", batch, arena_size, weight_bytes / batch, rate,
+               rate / single_rate,
+               same ? "" : "  MISMATCH against single-image runs");
+        free(arena);
+    }
+    free(images);
+    free(expected);
+}
+
+// Memory and latency of the row-streaming run against snn_network_run()
+// of the direct float build, which it must match exactly
+static void bench_stream(const BenchModel* model, int iterations) {
+    SNNNetwork direct = *model->network;
+    direct.winograd = NULL;
+    direct.ohwi = NULL;
+
+    size_t stream_size = snn_stream_memory_size(&direct);
+    if (stream_size == 0) {
+        printf("  stream: %s cannot stream\n", direct.name);
+        return;
+    }
+
+    const SNNLayer* last = &direct.layers[direct.num_layers - 1];
+    int output_count = snn_layer_output_count(last);
+    float* expected = malloc(output_count * sizeof(float));
+    int expected_predicted;
+    double direct_us = time_run(&direct, model->input, 1, iterations, expected, &expected_predicted);
+    void* memory = malloc(stream_size);
+    SNNRunResult result;
+
+    double start = now_us();
+    for (int it = 0; it < iterations; ++it) {
+        snn_stream_run(&direct, model->input, memory, stream_size, &result);
+    }
+    double stream_us = (now_us() - start) / iterations;
+
+    printf("  direct: %zu bytes of arena, predicted %d, %.1f us\n", snn_network_arena_size(&direct, 1),
+           expected_predicted, direct_us);
+    printf("  stream: %zu bytes of rows and maps, predicted %d, %.1f us (%.2fx)%s\n", stream_size,
+           result.predicted, stream_us, direct_us / stream_us,
+           memcmp(result.outputs, expected, output_count * sizeof(float)) == 0 ? ", same outputs"
+                                                                             : "  MISMATCH against the direct run");
+
+    // Row by row as a camera or ADC would deliver them, each row in a
+    // buffer of exactly its size
+    const SNNLayer* first = &direct.layers[0];
+    int row_count = first->in_channels * first->input_size;
+    float* row = malloc(row_count * sizeof(float));
+    SNNStream stream;
+
+    if (snn_stream_begin(&stream, &direct, memory, stream_size) != 0) {
+        printf("  pushed: %s cannot stream\n", direct.name);
+        free(row);
+        free(memory);
+        return;
+    }
+    for (int y = 0; y < first->input_size; ++y) {
+        for (int c = 0; c < first->in_channels; ++c) {
+            memcpy(row + c * first->input_size, model->input + (c * first->input_size + y) * first->input_size,
+                   first->input_size * sizeof(float));
+        }
+        snn_stream_push_row(&stream, row);
+    }
+    snn_stream_finish(&stream, &result);
+    printf("  pushed: predicted %d%s\n", result.predicted,
+           memcmp(result.outputs, expected, output_count * sizeof(float)) == 0 ? ", same outputs"
+                                                                             : "  MISMATCH against the direct run");
+    free(row);
+    free(memory);
+    free(expected);
+}
+
+// The Cortex-M7 L1 D-cache: 4-way, 32-byte lines, LRU
+#define L1_WAYS 4
+#define L1_LINE_BYTES 32
+#define L1_SETS (SNN_L1_DCACHE_BYTES / (L1_WAYS * L1_LINE_BYTES))
+
+typedef struct {
+    uintptr_t lines[L1_SETS][L1_WAYS];  // most recently used first, 0 when empty
+    long fills;
+} L1Model;
+
+static void l1_touch(L1Model* cache, const void* address) {
+    uintptr_t line = (uintptr_t)address / L1_LINE_BYTES + 1;
+    uintptr_t* set = cache->lines[line % L1_SETS];
+    int way = 0;
+
+    while (way < L1_WAYS - 1 && set[way] != line) ++way;
+    if (set[way] != line) ++cache->fills;
+    memmove(set + 1, set, way * sizeof(set[0]));
+    set[0] = line;
+}
+
+// Replay the loads and stores of one conv layer through the D-cache model
+// in the order snn_conv2d_tiled() makes them, and return the line fills.
+// One tile covering the whole map is snn_conv2d()'s order.
+static long conv_l1_fills(const SNNLayer* layer, const float* input, const float* output, int tile_channels,
+                          int tile_rows) {
+    static L1Model cache;
+    int in_channels = layer->in_channels;
+    int out_channels = layer->out_channels;
+    int size = layer->input_size;
+    int kernel = layer->kernel_size;
+    int output_size = snn_conv_output_size(size, kernel, layer->stride, layer->padding);
+    int untiled = tile_channels >= out_channels && tile_rows >= output_size;
+
+    memset(&cache, 0, sizeof(cache));
+    for (int oc = 0; oc < out_channels; oc += tile_channels) {
+        int channels_end = oc + tile_channels < out_channels ? oc + tile_channels : out_channels;
+        for (int oh = 0; oh < output_size; oh += tile_rows) {
+            int rows_end = oh + tile_rows < output_size ? oh + tile_rows : output_size;
+            for (int ic = 0; ic < (untiled ? 1 : in_channels); ++ic) {
+                for (int c = oc; c < channels_end; ++c) {
+                    for (int y = oh; y < rows_end; ++y) {
+                        for (int x = 0; x < output_size; ++x) {
+                            const float* out = output + (c * output_size + y) * output_size + x;
+                            for (int i = untiled ? 0 : ic; i < (untiled ? in_channels : ic + 1); ++i) {
+                                for (int kh = 0; kh < kernel; ++kh) {
+                                    int ih = y * layer->stride - layer->padding + kh;
+                                    for (int kw = 0; kw < kernel; ++kw) {
+                                        int iw = x * layer->stride - layer->padding + kw;
+                                        if (ih < 0 || ih >= size || iw < 0 || iw >= size) continue;
+                                        l1_touch(&cache, input + (i * size + ih) * size + iw);
+                                        l1_touch(&cache, layer->weights + ((c * in_channels + i) * kernel + kh) *
+                                                                              kernel + kw);
+                                    }
+                                }
+                            }
+                            l1_touch(&cache, out);
+                        }
+                    }
+                }
+            }
+        }
+    }
+    return cache.fills;
+}
+
+// Time the float conv layers of the model untiled and tiled to
+// SNN_TILE_BYTES of the Cortex-M7 D-cache on random input; both must agree
+// bit for bit. The host caches are larger and hold these layers whole, so
+// each layer also replays its loads and stores through a model of the
+// board's 16 KB L1 and reports the line fills each order costs. Then the
+// whole model with every conv layer tiled, as SNN_CACHE_ENABLE builds run,
+// against the direct build.
+static void bench_memory(const BenchModel* model, int iterations) {
+    const SNNNetwork* network = model->network;
+    unsigned seed = 11;
+
+    printf("  %-3s %-10s %12s %10s %12s %10s %8s %8s\n", "#", "tile", "untiled us", "L1 fills", "tiled us",
+           "L1 fills", "speedup", "fills");
+    for (int l = 0; l < network->num_layers; ++l) {
+        const SNNLayer* layer = &network->layers[l];
+        if (layer->type != SNN_LAYER_CONV2D || layer->weights == NULL) continue;
+
+        int input_count = snn_layer_input_count(layer);
+        int output_count = snn_layer_output_count(layer);
+        int output_size = snn_layer_output_size(layer);
+        float* input = malloc(input_count * sizeof(float));
+        float* untiled = malloc(output_count * sizeof(float));
+        float* tiled = malloc(output_count * sizeof(float));
+        int tile_channels;
+        int tile_rows;
+        char tile[16];
+
+        for (int i = 0; i < input_count; ++i) {
+            seed = seed * 1103515245u + 12345u;
+            input[i] = (float)((seed >> 8) % 1000) / 1000.0f;
+        }
+        snn_conv2d_tiles(layer->in_channels, layer->out_channels, layer->input_size, layer->kernel_size,
+                         layer->stride, layer->padding, SNN_TILE_BYTES, &tile_channels, &tile_rows);
+        snprintf(tile, sizeof(tile), "%dch x %d", tile_channels, tile_rows);
+        long untiled_fills = conv_l1_fills(layer, input, untiled, layer->out_channels, output_size);
+        long tiled_fills = conv_l1_fills(layer, input, tiled, tile_channels, tile_rows);
+
+        double start = now_us();
+        for (int it = 0; it < iterations; ++it) {
+            snn_conv2d(input, untiled, layer->weights, layer->biases, layer->in_channels, layer->out_channels,
+                       layer->input_size, layer->kernel_size, layer->stride, layer->padding);
+        }
+        double untiled_us = (now_us() - start) / iterations;
+
+        start = now_us();
+        for (int it = 0; it < iterations; ++it) {
+            snn_conv2d_tiled(input, tiled, layer->weights, layer->biases, layer->in_channels, layer->out_channels,
+                             layer->input_size, layer->kernel_size, layer->stride, layer->padding, tile_channels,
+                             tile_rows);
+        }
+        double tiled_us = (now_us() - start) / iterations;
+
+        printf("  %-3d %-10s %12.1f %10ld %12.1f %10ld %7.2fx %7.2fx%s\n", l, tile, untiled_us, untiled_fills,
+               tiled_us, tiled_fills, untiled_us / tiled_us, (double)untiled_fills / tiled_fills,
+               memcmp(untiled, tiled, output_count * sizeof(float)) ? "  MISMATCH" : "");
+
+        free(input);
+        free(untiled);
+        free(tiled);
+    }
+
+    SNNNetwork direct = *network;
+    SNNNetwork tiled_network;
+    SNNLayer layers[SNN_MAX_LAYERS];
+    direct.winograd = NULL;
+    direct.ohwi = NULL;
+    tiled_network = direct;
+    for (int l = 0; l < direct.num_layers; ++l) {
+        layers[l] = direct.layers[l];
+        if (layers[l].type == SNN_LAYER_CONV2D) layers[l].algorithm = SNN_CONV_TILED;
+    }
+    tiled_network.layers = layers;
+
+    const SNNLayer* last = &direct.layers[direct.num_layers - 1];
+    int output_count = snn_layer_output_count(last);
+    float* expected = malloc(output_count * sizeof(float));
+    float* outputs = malloc(output_count * sizeof(float));
+    int expected_predicted;
+    int predicted;
+    double direct_us = time_run(&direct, model->input, 1, iterations, expected, &expected_predicted);
+    double tiled_us = time_run(&tiled_network, model->input, 1, iterations, outputs, &predicted);
+
+    printf("  direct: predicted %d, %.1f us\n", expected_predicted, direct_us);
+    printf("  tiled:  predicted %d, %.1f us (%.2fx)%s\n", predicted, tiled_us, direct_us / tiled_us,
+           memcmp(outputs, expected, output_count * sizeof(float)) == 0 ? ", same outputs"
+                                                                       : "  MISMATCH against the direct run");
+    free(expected);
+    free(outputs);
+}
+
+// Weight image in a file standing in for external memory: 1-line SPI
+// and octal DTR OctoSPI flash, per read a command/address/dummy phase plus
+// the transfer
+static const struct {
+    const char* name;
+    double access_ns;
+    double ns_per_byte;
+} weight_memories[] = {
+    { "spi", 600, 80 },
+    { "octal", 150, 5 },
+};
+
+// Per-layer copies of a prefetching run: how much copy time the kernels
+// did not wait for
+static void print_prefetch_stats(const SNNNetwork* network, const SNNWeightSource* source, int runs) {
+    for (int l = 0; l < network->num_layers; ++l) {
+        const SNNPrefetchStats* stats = &source->stats[l];
+        if (stats->copies == 0) continue;
+
+        double copy_us = (double)stats->copy_ticks / runs;
+        double stall_us = (double)stats->stall_ticks / runs;
+        // A stall also waits out the thread's wakeup, so it can outlast the copy
+        double hidden_us = copy_us > stall_us ? copy_us - stall_us : 0.0;
+        printf("    layer %d: %u copies, %.1f KB, copy %.1f us, stalled %.1f us, %.0f%% hidden\n", l,
+               stats->copies / runs, stats->bytes / 1024.0 / runs, copy_us, stall_us,
+               copy_us > 0 ? 100.0 * hidden_us / copy_us : 0.0);
+    }
+}
+
+// Latency and weight traffic of the float build reading its weights from
+// a file-backed image: mapped, copied through staging of one, four and
+// sixteen channels of the largest layer, and prefetched by a helper
+// thread into twice that, against reading the image in place. Every
+// variant must match the in-place run exactly.
+static void bench_weights(const BenchModel* model, int iterations) {
+    const SNNNetwork* network = model->network;
+    char path[] = "/tmp/snn_weights_XXXXXX";
+    int fd = mkstemp(path);
+    BenchWeightFile file;
+
+    if (fd < 0) {
+        printf("  weights: no temporary file\n");
+        return;
+    }
+    close(fd);
+    if (bench_weight_file_open(&file, path, network) != 0) {
+        printf("  weights: %s has no float weights\n", network->name);
+        unlink(path);
+        return;
+    }
+
+    SNNLayer layers[SNN_MAX_LAYERS];
+    SNNNetwork rebased;
+    snn_network_rebase(network, file.image, file.size, layers, NULL, &rebased);
+
+    const SNNLayer* last = &network->layers[network->num_layers - 1];
+    int output_count = snn_layer_output_count(last);
+    float* expected = malloc(output_count * sizeof(float));
+    float* outputs = malloc(output_count * sizeof(float));
+    int predicted;
+    double in_place_us = time_run(&rebased, model->input, 1, iterations, expected, &predicted);
+    size_t channel_bytes = snn_weights_channel_bytes(network);
+    int slow = iterations < 3 ? iterations : 3;
+
+    printf("  weights: %zu byte image, in place %.1f us\n", file.size, in_place_us);
+    printf("  %-6s %-8s %8s %10s %8s %10s\n", "memory", "source", "staging", "us", "reads", "KB");
+    for (size_t m = 0; m < sizeof(weight_memories) / sizeof(weight_memories[0]); ++m) {
+        for (int prefetch = 0; prefetch <= 1; ++prefetch) {
+            for (int channels = prefetch; channels <= 16; channels = channels == 0 ? 1 : channels * 4) {
+                size_t staging_bytes = (prefetch ? 2 : 1) * channels * channel_bytes;
+                void* staging = channels > 0 ? malloc(staging_bytes) : NULL;
+                SNNWeightSource source;
+                SNNAsyncCopy copy;
+
+                bench_weight_file_source(&file, &source, staging, staging_bytes, weight_memories[m].access_ns,
+                                         weight_memories[m].ns_per_byte);
+                if (prefetch) {
+                    bench_weight_file_async(&file, &copy, clock_us);
+                    snn_weights_prefetch(&source, staging, staging_bytes, &copy, &rebased);
+                }
+                rebased.weight_source = &source;
+                double us = time_run(&rebased, model->input, 1, slow, outputs, &predicted);
+                snn_weights_finish(&source);
+
+                printf("  %-6s %-8s %8zu %10.1f %8u %10.1f%s\n", weight_memories[m].name,
+                       prefetch ? "prefetch" : channels > 0 ? "copy" : "mapped", staging_bytes, us,
+                       source.reads / slow, source.read_bytes / 1024.0 / slow,
+                       memcmp(outputs, expected, output_count * sizeof(float)) == 0 ? ""
+                                                                                  : "  MISMATCH against in place");
+                if (prefetch) {
+                    if (channels == 16) print_prefetch_stats(&rebased, &source, slow);
+                    bench_weight_file_async_stop(&copy);
+                }
+                free(staging);
+            }
+        }
+    }
+    free(expected);
+    free(outputs);
+    bench_weight_file_close(&file);
+    unlink(path);
+}
+
+// A blob the executor cannot run must not load: a convolution on packed
+// spikes over a map beyond SNN_EVENT_MAP_SIZE would overrun the event
+// buffer of the spike kernel
+static void bench_blob_reject(void) {
+    enum { SIZE = 40, CHANNELS = 2 };
+    static float weights[CHANNELS * CHANNELS * 3 * 3];
+    const SNNLayer layers[] = {
+        SNN_CONV2D(1, CHANNELS, SIZE, 3, 1, 1, weights, NULL, SNN_ACT_LIF_SPIKE_BITS, 0.9f, 1.0f),
+        SNN_CONV2D(CHANNELS, CHANNELS, SIZE, 3, 1, 1, weights, NULL, SNN_ACT_NONE, 0, 0),
+    };
+    SNNNetwork network = { "packed_40x40", layers, 2, 1 };
+    size_t size = snn_blob_size(&network);
+    void* blob = malloc(size);
+    SNNBlobModel loaded;
+
+    if (blob == NULL || snn_blob_write(&network, blob) != 0) {
+        printf("  blob: %s cannot be exported\n", network.name);
+    } else {
+        printf("  blob: %s %s\n", network.name,
+               snn_blob_load(&loaded, blob, size) != 0 ? "rejected" : "LOADED, the spike conv would overrun");
+    }
+    free(blob);
+}
+
+// The model exported as a blob (snn_blob.h) to a file, mmap'ed and run in
+// place against the float build it came from, without the tables the blob
+// leaves out; both must agree bit for bit. The blob run borrows the
+// model's specialised kernels, as firmware running a blob can for layers
+// of their shape.
+static void bench_blob(const BenchModel* model, int iterations) {
+    SNNNetwork direct = *model->network;
+    char path[] = "/tmp/snn_blob_XXXXXX";
+    int fd = mkstemp(path);
+    size_t size = snn_blob_size(&direct);
+    void* blob = size > 0 ? malloc(size) : NULL;
+
+    direct.quantized = NULL;
+    direct.winograd = NULL;
+    direct.ohwi = NULL;
+    direct.sparse = NULL;
+    direct.codebook = NULL;
+    if (fd < 0 || blob == NULL || snn_blob_write(&direct, blob) != 0 || write(fd, blob, size) != (ssize_t)size) {
+        printf("  blob: %s cannot be exported\n", direct.name);
+        if (fd >= 0) {
+            close(fd);
+            unlink(path);
+        }
+        free(blob);
+        return;
+    }
+    free(blob);
+    const void* mapped = mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    unlink(path);
+    if (mapped == MAP_FAILED) {
+        printf("  blob: cannot map\n");
+        return;
+    }
+
+    SNNBlobModel loaded;
+    double start = now_us();
+    int status = snn_blob_load(&loaded, mapped, size);
+    double load_us = now_us() - start;
+    start = now_us();
+    int verified = snn_blob_verify(mapped);
+    double verify_us = now_us() - start;
+
+    if (status != 0) {
+        printf("  blob: %zu bytes, does not load\n", size);
+        munmap((void*)mapped, size);
+        return;
+    }
+
+    const SNNLayer* last = &direct.layers[direct.num_layers - 1];
+    int output_count = snn_layer_output_count(last);
+    float* expected = malloc(output_count * sizeof(float));
+    float* outputs = malloc(output_count * sizeof(float));
+    int expected_predicted;
+    int predicted;
+    double direct_us = time_run(&direct, model->input, 1, iterations, expected, &expected_predicted);
+    loaded.network.kernels = direct.kernels;
+    double blob_us = time_run(&loaded.network, model->input, 1, iterations, outputs, &predicted);
+
+    printf("  blob: %zu bytes, loaded in %.1f us, checksum %s in %.1f us\n", size, load_us,
+           verified == 0 ? "verified" : "MISMATCH", verify_us);
+    printf("  direct: predicted %d, %.1f us\n", expected_predicted, direct_us);
+    printf("  blob:   predicted %d, %.1f us (%.2fx)%s\n", predicted, blob_us, direct_us / blob_us,
+           memcmp(outputs, expected, output_count * sizeof(float)) == 0 ? ", same outputs"
+                                                                       : "  MISMATCH against the direct run");
+    free(expected);
+    free(outputs);
+    munmap((void*)mapped, size);
+}
+
+// Accuracy and latency of the int8 build against the float one
+static void bench_quantized(const BenchModel* model, int timesteps, int iterations) {
+    const SNNNetwork* network = model->network;
+    SNNQuantWeights table[SNN_MAX_LAYERS];
+    SNNNetwork quantized = quantize_network(network, table);
+    size_t float_bytes = 0;
+    size_t int8_bytes = 0;
+
+    for (int l = 0; l < network->num_layers; ++l) {
+        int count = snn_layer_weight_count(&network->layers[l]);
+        float_bytes += count * sizeof(float);
+        int8_bytes += count > 0 ? count + network->layers[l].out_channels * sizeof(float) : 0;
+    }
+
+    printf("  int8 weights: %zu bytes (float %zu)\n", int8_bytes, float_bytes);
+    compare_build(model, model->network, "float:", &quantized, "int8:", timesteps, iterations);
+
+    for (int l = 0; l < network->num_layers; ++l) {
+        free((void*)table[l].weights);
+        free((void*)table[l].scales);
+    }
+}
+
+// Accuracy and latency of Q16.16 membranes against float ones. Single-step
+// runs keep no LIF state, so the difference shows with -t 2 and up.
+static void bench_fixed(const BenchModel* model, int timesteps, int iterations) {
+    SNNNetwork fixed = *model->network;
+    int neurons = 0;
+
+    for (int l = 0; l < fixed.num_layers; ++l) {
+        neurons |= snn_layer_has_neurons(&fixed.layers[l]);
+    }
+    if (!neurons) return;
+
+    fixed.fixed_membranes = 1;
+    compare_build(model, model->network, "float:", &fixed, "Q16.16:", timesteps, iterations);
+}
+
+static void bench_model(const BenchModel* model, const BenchOptions* options) {
+    const SNNNetwork* network = model->network;
+    int iterations = options->iterations;
+    int timesteps = options->timesteps;
+    SNNRunConfig config = { timesteps, clock_us, 0 };
+    SNNRunResult result;
+    SNNArenaPlan plan;
+    void* arena;
+
+    if (timesteps == 0) timesteps = network->timesteps;
+
+    printf("%s%s, %d timestep%s\n", network->name, model->synthetic ? " (synthetic weights)" : "",
+           timesteps, timesteps == 1 ? "" : "s");
+    snn_plan_arena(network, timesteps, &plan);
+    arena = malloc(plan.arena_size);
+    printf("  arena: %zu bytes (unplanned %zu)\n", plan.arena_size, plan.unplanned_size);
+
+    double start = now_us();
+    for (int it = 0; it < iterations; ++it) {
+        snn_network_run(network, model->input, arena, plan.arena_size, &config, &result);
+    }
+    double elapsed = (now_us() - start) / iterations;
+
+    if (model->label >= 0) {
+        printf("  predicted: %d (label %d)\n", result.predicted, model->label);
+    } else {
+        printf("  predicted: %d\n", result.predicted);
+    }
+    printf("  inference: %.1f us\n", elapsed);
+
+    // One more run to count synaptic operations, against the MACs of a
+    // dense float pass (every input non-zero) over every step
+    SNNSynapticOps total = { 0, 0 };
+    SNNSynapticOps dense = { 0, 0 };
+    SNNLayerWeights float_weights = { NULL, NULL, NULL, NULL, NULL, NULL };
+    config.count_synops = 1;
+    snn_network_run(network, model->input, arena, plan.arena_size, &config, &result);
+    for (int l = 0; l < network->num_layers; ++l) {
+        int input_count = snn_layer_input_count(&network->layers[l]);
+        float* ones = malloc(input_count * sizeof(float));
+        for (int i = 0; i < input_count; ++i) {
+            ones[i] = 1.0f;
+        }
+        for (int t = 0; t < timesteps; ++t) {
+            snn_layer_count_synops(&network->layers[l], &float_weights, ones, 0, &dense);
+        }
+        total.macs += result.synops[l].macs;
+        total.acs += result.synops[l].acs;
+        free(ones);
+    }
+    printf("  synaptic ops: %lu MAC + %lu AC (dense: %lu MAC)\n", (unsigned long)total.macs,
+           (unsigned long)total.acs, (unsigned long)dense.macs);
+    if (timesteps > 1) {
+        printf("  step us (last run):");
+        for (int t = 0; t < timesteps && t < SNN_MAX_TIMESTEPS; ++t) {
+            printf(" %u", (unsigned)result.step_ticks[t]);
+        }
+        printf("\n");
+    }
+    bench_layers(network, model->input, iterations);
+    if (options->conv) {
+        bench_conv(network, iterations);
+    }
+    if (options->specialized) {
+        bench_specialized(network, iterations);
+    }
+    if (options->event_sweep) {
+        bench_event_sweep(network, iterations);
+    }
+    if (options->quantized) {
+        bench_quantized(model, timesteps, iterations);
+    }
+    if (options->codebook) {
+        bench_codebook(model, timesteps, iterations);
+    }
+    if (options->fixed) {
+        bench_fixed(model, timesteps, iterations);
+    }
+    if (options->layout) {
+        bench_layout(model, timesteps, iterations);
+    }
+    if (options->sparse) {
+        bench_sparse(model, timesteps, iterations);
+    }
+    if (options->early_exit) {
+        bench_early_exit(model, timesteps, iterations);
+    }
+    if (options->batch) {
+        bench_batch(model, timesteps, iterations);
+    }
+    if (options->stream) {
+        bench_stream(model, iterations);
+    }
+    if (options->weights) {
+        bench_weights(model, iterations);
+    }
+    if (options->memory) {
+        bench_memory(model, iterations);
+    }
+    if (options->blob) {
+        bench_blob(model, iterations);
+    }
+    printf("\n");
+
+    free(arena);
+}
+
+// Fraction of spikes that differ between float and Q16.16 membranes past
+// which the fixed-point population counts as broken. Truncating currents
+// to 2^-16 only flips neurons that land within that of the threshold.
+#define FIXED_SPIKE_TOLERANCE 0.001
+
+// Spike-for-spike agreement of a fixed-point population with a float one
+// over a run of fresh random currents every step
+static double fixed_spike_disagreement(int count, int steps) {
+    float* currents = malloc(count * sizeof(float));
+    void* float_memory = malloc(snn_lif_population_bytes(count));
+    void* fixed_memory = malloc(snn_lif_population_bytes(count));
+    SNNSpikeWord* float_spikes = malloc(SNN_SPIKE_WORDS(count) * sizeof(SNNSpikeWord));
+    SNNSpikeWord* fixed_spikes = malloc(SNN_SPIKE_WORDS(count) * sizeof(SNNSpikeWord));
+    LIFPopulation float_population;
+    LIFPopulation fixed_population;
+    unsigned seed = 7;
+    long differing = 0;
+
+    snn_lif_population_init(&float_population, float_memory, count);
+    snn_lif_population_init_fixed(&fixed_population, fixed_memory, count);
+    for (int t = 0; t < steps; ++t) {
+        for (int i = 0; i < count; ++i) {
+            seed = seed * 1103515245u + 12345u;
+            currents[i] = (float)((seed >> 8) % 2000) / 1000.0f - 0.5f;
+        }
+        memset(float_spikes, 0, SNN_SPIKE_WORDS(count) * sizeof(SNNSpikeWord));
+        memset(fixed_spikes, 0, SNN_SPIKE_WORDS(count) * sizeof(SNNSpikeWord));
+        snn_lif_update_spikes(&float_population, 0, currents, count, 0.9f, 1.0f, float_spikes);
+        snn_lif_update_spikes(&fixed_population, 0, currents, count, 0.9f, 1.0f, fixed_spikes);
+        for (int w = 0; w < SNN_SPIKE_WORDS(count); ++w) {
+            differing += __builtin_popcount(float_spikes[w] ^ fixed_spikes[w]);
+        }
+    }
+
+    free(currents);
+    free(float_memory);
+    free(fixed_memory);
+    free(float_spikes);
+    free(fixed_spikes);
+    return (double)differing / ((double)count * steps);
+}
+
+// Stateful LIF update of a cifar_snn conv1 sized layer, as an array of
+// LIFNeuron against a population. Both must fire the same spikes; the
+// fixed-point population must stay within FIXED_SPIKE_TOLERANCE of them.
+static void bench_lif(int iterations) {
+    enum { COUNT = 32 * 32 * 32, STEPS = 4, AGREEMENT_STEPS = 32 };
+    float* currents = malloc(COUNT * sizeof(float));
+    LIFNeuron* neurons = malloc(COUNT * sizeof(LIFNeuron));
+    void* memory = malloc(snn_lif_population_bytes(COUNT));
+    SNNSpikeWord* spikes = malloc(SNN_SPIKE_WORDS(COUNT) * sizeof(SNNSpikeWord));
+    void* fixed_memory = malloc(snn_lif_population_bytes(COUNT));
+    LIFPopulation population;
+    LIFPopulation fixed;
+    unsigned seed = 1;
+    int mismatches = 0;
+
+    for (int i = 0; i < COUNT; ++i) {
+        seed = seed * 1103515245u + 12345u;
+        currents[i] = (float)((seed >> 8) % 2000) / 1000.0f - 0.5f;
+    }
+
+    double start = now_us();
+    for (int it = 0; it < iterations; ++it) {
+        memset(neurons, 0, COUNT * sizeof(LIFNeuron));
+        for (int t = 0; t < STEPS; ++t) {
+            for (int i = 0; i < COUNT; ++i) {
+                snn_update_neuron(&neurons[i], currents[i], 0.9f, 1.0f);
+            }
+        }
+    }
+    double array_us = (now_us() - start) / (iterations * STEPS);
+
+    start = now_us();
+    for (int it = 0; it < iterations; ++it) {
+        snn_lif_population_init(&population, memory, COUNT);
+        for (int t = 0; t < STEPS; ++t) {
+            memset(spikes, 0, SNN_SPIKE_WORDS(COUNT) * sizeof(SNNSpikeWord));
+            snn_lif_update_spikes(&population, 0, currents, COUNT, 0.9f, 1.0f, spikes);
+        }
+    }
+    double population_us = (now_us() - start) / (iterations * STEPS);
+
+    start = now_us();
+    for (int it = 0; it < iterations; ++it) {
+        snn_lif_population_init_fixed(&fixed, fixed_memory, COUNT);
+        for (int t = 0; t < STEPS; ++t) {
+            memset(spikes, 0, SNN_SPIKE_WORDS(COUNT) * sizeof(SNNSpikeWord));
+            snn_lif_update_spikes(&fixed, 0, currents, COUNT, 0.9f, 1.0f, spikes);
+        }
+    }
+    double fixed_us = (now_us() - start) / (iterations * STEPS);
+    double disagreement = fixed_spike_disagreement(COUNT, AGREEMENT_STEPS);
+
+    for (int i = 0; i < COUNT; ++i) {
+        mismatches += neurons[i].should_spike != snn_spike_get(spikes, i) ||
+                      neurons[i].membrane_potential != population.membrane[i];
+    }
+
+    printf("lif update, %d neurons\n", COUNT);
+    printf("  LIFNeuron array:   %8.1f us/step, %zu bytes\n", array_us, COUNT * sizeof(LIFNeuron));
+    printf("  LIFPopulation:     %8.1f us/step, %zu bytes%s\n", population_us, snn_lif_population_bytes(COUNT),
+           mismatches ? "  MISMATCH" : "");
+    printf("  Q16.16 population: %8.1f us/step, %zu bytes, %.3f%% of spikes differ over %d steps%s\n", fixed_us,
+           snn_lif_population_bytes(COUNT), 100.0 * disagreement, AGREEMENT_STEPS,
+           disagreement > FIXED_SPIKE_TOLERANCE ? "  MISMATCH" : "");
+
+    free(currents);
+    free(neurons);
+    free(memory);
+    free(fixed_memory);
+    free(spikes);
+}
+
+// Models named on the command line; all of them when none are named
+static int model_selected(const char* name, int argc, char** argv) {
+    int named = 0;
+    for (int i = 1; i < argc; ++i) {
+        if (strcmp(argv[i], "-n") == 0 || strcmp(argv[i], "-t") == 0) {
+            ++i;
+            continue;
+        }
+        if (argv[i][0] == '-') continue;
+        if (strcmp(argv[i], name) == 0) return 1;
+        named = 1;
+    }
+    return !named;
+}
+
+int main(int argc, char** argv) {
+    BenchOptions options = { 20, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 };
+    int selected = 0;
+
+    for (int i = 1; i < argc; ++i) {
+        if (strcmp(argv[i], "-n") == 0 && i + 1 < argc) {
+            options.iterations = atoi(argv[++i]);
+            if (options.iterations < 1) options.iterations = 1;
+        } else if (strcmp(argv[i], "-t") == 0 && i + 1 < argc) {
+            options.timesteps = atoi(argv[++i]);
+            if (options.timesteps < 0) options.timesteps = 0;
+        } else if (strcmp(argv[i], "-e") == 0) {
+            options.event_sweep = 1;
+        } else if (strcmp(argv[i], "-q") == 0) {
+            options.quantized = 1;
+        } else if (strcmp(argv[i], "-f") == 0) {
+            options.fixed = 1;
+        } else if (strcmp(argv[i], "-c") == 0) {
+            options.conv = 1;
+        } else if (strcmp(argv[i], "-s") == 0) {
+            options.specialized = 1;
+        } else if (strcmp(argv[i], "-l") == 0) {
+            options.layout = 1;
+        } else if (strcmp(argv[i], "-p") == 0) {
+            options.sparse = 1;
+        } else if (strcmp(argv[i], "-k") == 0) {
+            options.codebook = 1;
+        } else if (strcmp(argv[i], "-x") == 0) {
+            options.early_exit = 1;
+        } else if (strcmp(argv[i], "-b") == 0) {
+            options.batch = 1;
+        } else if (strcmp(argv[i], "-r") == 0) {
+            options.stream = 1;
+        } else if (strcmp(argv[i], "-w") == 0) {
+            options.weights = 1;
+        } else if (strcmp(argv[i], "-m") == 0) {
+            options.memory = 1;
+        } else if (strcmp(argv[i], "-z") == 0) {
+            options.blob = 1;
+        }
+    }
+
+    for (int m = 0; m < NUM_BENCH_MODELS; ++m) {
+        if (!model_selected(bench_models[m].name, argc, argv)) continue;
+
+        BenchModel model;
+        bench_models[m].load(&model);
+        bench_model(&model, &options);
+        ++selected;
+    }
+    if (selected > 0 && options.blob) {
+        bench_blob_reject();
+    }
+    if (selected > 0) {
+        bench_lif(options.iterations);
+    }
+
+    if (selected == 0) {
+        fprintf(stderr, "usage: %s [-n iterations] [-t timesteps] [-c] [-s] [-e] [-q] [-k] [-f] [-l] [-p] [-x] [-b] "
+                "[-r] [-w] [-m] [-z] [mnist_snn|mnist_cnn|cifar_snn ...]\n", argv[0]);
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,38 @@
+#ifndef CIFAR_PARAMETERS_H
+#define CIFAR_PARAMETERS_H
+
+// Host stand-in for the exported cifar_parameters.h, which is not committed.
+// Shapes match the .rodata sizes in cifar_snn/Debug/cifar_snn.map; the
+// values are filled in by bench_cifar_snn().
+
+#define CONV1_IN_CHANNELS 3
+#define CONV1_OUT_CHANNELS 32
+#define CONV1_KERNEL_SIZE 3
+#define CONV1_STRIDE 1
+#define CONV1_PADDING 1
+
+#define CONV2_IN_CHANNELS 32
+#define CONV2_OUT_CHANNELS 64
+#define CONV2_KERNEL_SIZE 3
+#define CONV2_STRIDE 1
+#define CONV2_PADDING 1
+
+#define CONV3_IN_CHANNELS 64
+#define CONV3_OUT_CHANNELS 128
+#define CONV3_KERNEL_SIZE 3
+#define CONV3_STRIDE 1
+#define CONV3_PADDING 1
+
+#define FC1_IN_FEATURES 2048
+#define FC1_OUT_FEATURES 512
+
+#define FC2_IN_FEATURES 512
+#define FC2_OUT_FEATURES 10
+
+extern float conv1_weights[CONV1_OUT_CHANNELS][CONV1_IN_CHANNELS][CONV1_KERNEL_SIZE][CONV1_KERNEL_SIZE];
+extern float conv2_weights[CONV2_OUT_CHANNELS][CONV2_IN_CHANNELS][CONV2_KERNEL_SIZE][CONV2_KERNEL_SIZE];
+extern float conv3_weights[CONV3_OUT_CHANNELS][CONV3_IN_CHANNELS][CONV3_KERNEL_SIZE][CONV3_KERNEL_SIZE];
+extern float fc1_weights[FC1_OUT_FEATURES][FC1_IN_FEATURES];
+extern float fc2_weights[FC2_OUT_FEATURES][FC2_IN_FEATURES];
+
+#endif // CIFAR_PARAMETERS_H
@@ -0,0 +1,103 @@
+#ifndef SNN_BLOB_H
+#define SNN_BLOB_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "snn_network.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Model blob: a network's layer table and float weights in one versioned
+// binary, so a model can be swapped by programming flash (or replacing a
+// file) instead of rebuilding the firmware. The runtime executes it in
+// place from internal flash, the OctoSPI mapping or an mmap'ed file: the
+// layers of an SNNBlobModel point straight into the blob and nothing is
+// copied or allocated. Little-endian, as both the Cortex-M7 and the host
+// are:
+//   SNNBlobHeader      at offset 0
+//   SNNBlobLayer       num_layers of them at layers_offset
+//   weight sections    the weights, then the biases, of every weighted
+//                      layer in layer order, each on SNN_BLOB_ALIGNMENT
+// The blob keeps the float build only. Int8, codebook, Winograd, OHWI and
+// sparse tables and the shape-specialised kernels are compiled into the
+// firmware against one model and do not travel with it.
+#define SNN_BLOB_MAGIC 0x4D4E4E53u  // "SNNM"
+#define SNN_BLOB_VERSION 1
+
+// Sections start on D-cache lines, so a blob placed on one (as flash and
+// mmap place it) has every weight section line-aligned for MDMA staging.
+// The blob itself must be at least float aligned.
+#define SNN_BLOB_ALIGNMENT 32
+
+#define SNN_BLOB_NAME_BYTES 24
+
+typedef struct {
+    uint32_t magic;
+    uint16_t version;
+    uint16_t header_bytes;      // sizeof(SNNBlobHeader)
+    uint32_t blob_bytes;        // whole blob, sections included
+    uint32_t checksum;          // CRC-32 of the blob after the header
+    uint32_t num_layers;
+    uint32_t layer_bytes;       // sizeof(SNNBlobLayer)
+    uint32_t layers_offset;
+    uint32_t timesteps;
+    char name[SNN_BLOB_NAME_BYTES];    // NUL-terminated
+    uint32_t reserved[2];
+} SNNBlobHeader;
+
+// One SNNLayer. Offsets count from the start of the blob; a layer without
+// weights or biases has offset and count 0.
+typedef struct {
+    uint32_t type;              // SNNLayerType
+    uint32_t in_channels;
+    uint32_t out_channels;
+    uint32_t input_size;
+    uint32_t kernel_size;
+    uint32_t stride;
+    uint32_t padding;
+    uint32_t activation;        // SNNActivation
+    uint32_t algorithm;         // SNNConvAlgorithm
+    float beta;
+    float threshold;
+    float max_event_rate;
+    uint32_t weights_offset;
+    uint32_t weights_count;     // snn_layer_weight_count()
+    uint32_t biases_offset;
+    uint32_t biases_count;      // out_channels, or 0
+} SNNBlobLayer;
+
+// A network running from a blob. The layer table lives here, the name
+// and weights stay in the blob, which must outlive the model.
+typedef struct {
+    SNNNetwork network;
+    SNNLayer layers[SNN_MAX_LAYERS];
+} SNNBlobModel;
+
+// Bytes of the blob of network, 0 if it has more than SNN_MAX_LAYERS
+size_t snn_blob_size(const SNNNetwork* network);
+
+// Write the blob of network's float layers and weights to blob
+// (snn_blob_size() bytes). Returns -1 if a weighted layer has no float
+// weights.
+int snn_blob_write(const SNNNetwork* network, void* blob);
+
+// Point model at the blob of blob_bytes bytes (the size of the memory
+// holding it, which may be larger). Checks the header, the layer table,
+// that every section lies inside the blob, that the layers chain and that
+// convolutions on packed spikes stay within SNN_EVENT_MAP_SIZE, without
+// reading the weights. Returns 0, or -1 if blob is not a valid blob of
+// this version.
+int snn_blob_load(SNNBlobModel* model, const void* blob, size_t blob_bytes);
+
+// Whether the checksum of a loaded blob matches, reading every byte of it:
+// 0 if so, -1 otherwise. Worth the pass over slow external flash after
+// programming it, not on every boot.
+int snn_blob_verify(const void* blob);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // SNN_BLOB_H
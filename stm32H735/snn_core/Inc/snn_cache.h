@@ -0,0 +1,42 @@
+#ifndef SNN_CACHE_H
+#define SNN_CACHE_H
+
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define SNN_CACHE_LINE_BYTES 32
+
+// Cache and MPU setup of the STM32H735. Builds with SNN_CACHE_ENABLE
+// program the MPU and turn on the 16 KB I-cache and the 16 KB D-cache:
+//   background  4 GB, no access, so stray pointers fault instead of
+//               reaching unmapped memory
+//   flash       write-through, read-only: weights, tables and code
+//   AXI SRAM    write-back, write-allocate: RAM_D1 and RAM_EXEC, the arena
+//               and the staging of copying weight sources outside DTCM
+//   D2 SRAM     the first 1 KB uncached and shareable, for the Ethernet DMA
+//               descriptors the linker scripts place there
+//   OctoSPI     write-through, read-only, in SNN_OSPI_WEIGHTS and
+//               SNN_OSPI_MODEL builds
+// ITCM and DTCM sit beside the caches and are unaffected. The float
+// convolutions then run fastest tiled to the D-cache (snn_conv2d_tiled()),
+// which the models select in these builds. Without the flag, and on the
+// host, every call is a no-op and the firmware keeps running with the
+// caches off.
+void snn_cache_init(void);
+
+// D-cache maintenance around bus masters other than the core, such as
+// MDMA: clean before a master reads what the core wrote, invalidate after
+// it wrote what the core will read. Both round out to whole 32-byte lines,
+// so an invalidated buffer must not share a line with other data, and do
+// nothing while the D-cache is off.
+void snn_cache_clean(const void* address, size_t bytes);
+void snn_cache_invalidate(void* address, size_t bytes);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // SNN_CACHE_H
@@ -0,0 +1,49 @@
+#ifndef SNN_CODEBOOK_H
+#define SNN_CODEBOOK_H
+
+#include <stdint.h>
+#include "snn_spikes.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// 4-bit weight sharing: every weight of a layer is one of the
+// SNN_CODEBOOK_SIZE floats of its codebook, stored as a 4-bit index. Two
+// indices share a byte, the lower-numbered weight in the low nibble, in the
+// float layout of snn_kernels.h, so a layer takes an eighth of its float
+// flash plus 64 bytes. An entry with NULL indices is a float layer.
+#define SNN_CODEBOOK_SIZE 16
+
+typedef struct {
+    const uint8_t* indices;
+    const float* codebook;      // SNN_CODEBOOK_SIZE entries
+} SNNCodebookWeights;
+
+// Bytes of indices of count weights
+#define SNN_CODEBOOK_INDEX_BYTES(count) (((count) + 1) / 2)
+
+// Fit a codebook to count weights by 1-D k-means, starting from centroids
+// spread evenly between the smallest and largest weight
+void snn_codebook_fit(const float* weights, int count, float* codebook);
+
+// Index of the nearest codebook entry of every weight
+void snn_codebook_encode(const float* weights, int count, const float* codebook, uint8_t* indices);
+
+// Decode weights [first, first + count) into floats
+void snn_codebook_decode(const SNNCodebookWeights* weights, int first, int count, float* decoded);
+
+// snn_linear() and snn_linear_spikes() looking every weight up in the
+// codebook as they go. in_features must be even, so each row starts on a
+// byte; the output equals the float kernels' on the decoded weights.
+void snn_linear_codebook(const float* input, float* output, const uint8_t* indices, const float* codebook,
+                         const float* biases, int in_features, int out_features);
+
+void snn_linear_spikes_codebook(const SNNSpikeWord* input, float* output, const uint8_t* indices,
+                                const float* codebook, const float* biases, int in_features, int out_features);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // SNN_CODEBOOK_H
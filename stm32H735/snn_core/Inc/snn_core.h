@@ -0,0 +1,25 @@
+#ifndef SNN_CORE_H
+#define SNN_CORE_H
+
+// Shared inference library for the mnist_snn, mnist_cnn and cifar_snn
+// firmware projects. Builds for arm-none-eabi and for the host, see
+// snn_core/CMakeLists.txt.
+
+#include "snn_spikes.h"
+#include "snn_lif.h"
+#include "snn_quant.h"
+#include "snn_codebook.h"
+#include "snn_sparse.h"
+#include "snn_winograd.h"
+#include "snn_kernels.h"
+#include "snn_specialize.h"
+#include "snn_network.h"
+#include "snn_plan.h"
+#include "snn_stream.h"
+#include "snn_weights.h"
+#include "snn_blob.h"
+#include "snn_mdma.h"
+#include "snn_cache.h"
+#include "snn_placement.h"
+
+#endif // SNN_CORE_H
@@ -0,0 +1,158 @@
+#ifndef SNN_KERNELS_H
+#define SNN_KERNELS_H
+
+#include <stddef.h>
+#include "snn_spikes.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// All feature maps are square and stored channel-major (NCHW without N):
+// element (c, h, w) lives at input[c * size * size + h * size + w].
+// Weights are [out][in][kernel][kernel] for convolutions and [out][in] for
+// fully connected layers, exactly as exported into model_parameters.h.
+
+// Spatial output size of a convolution or pooling window sweep. Inline, so
+// the specialised kernels of snn_specialize.h fold it into a constant.
+static inline int snn_conv_output_size(int input_size, int kernel_size, int stride, int padding) {
+    return (input_size - kernel_size + 2 * padding) / stride + 1;
+}
+
+// Function to perform 2D convolution (biases may be NULL)
+void snn_conv2d(const float* input, float* output, const float* weights, const float* biases,
+                int in_channels, int out_channels, int input_size, int kernel_size, int stride, int padding);
+
+// Output pixels snn_conv2d_gemm() lowers per tile; a multiple of 4
+#define SNN_GEMM_TILE 16
+
+// Floats of im2col scratch snn_conv2d_gemm() needs
+#define SNN_GEMM_COLUMNS(in_channels, kernel_size) ((in_channels) * (kernel_size) * (kernel_size) * SNN_GEMM_TILE)
+
+// 2D convolution lowered to a matrix multiply: the input windows of
+// SNN_GEMM_TILE output pixels at a time are copied into columns (im2col,
+// with zeros for the padding), then every output channel's weight row is
+// multiplied against them by a 4x4 register-blocked micro-kernel. Same
+// results as snn_conv2d(), as every output adds its taps in the same order.
+void snn_conv2d_gemm(const float* input, float* output, const float* weights, const float* biases,
+                     int in_channels, int out_channels, int input_size, int kernel_size, int stride, int padding,
+                     float* columns);
+
+// Channels-last (HWC) layout: element (c, h, w) at input[(h * size + w) *
+// channels + c], so the channels of one pixel are contiguous. Weights for it
+// are OHWI, [out][kernel][kernel][in].
+
+// Transpose a CHW tensor into HWC
+void snn_chw_to_hwc(const float* input, float* output, int channels, int size);
+
+// Reorder [out][in][kernel][kernel] weights into OHWI
+void snn_weights_to_ohwi(const float* weights, float* ohwi, int in_channels, int out_channels, int kernel_size);
+
+// 2D convolution over an HWC input with OHWI weights: the reduction over
+// input channels, innermost, reads both contiguously. Output channels are
+// written CHW like every other kernel's. Results differ from snn_conv2d()
+// by float rounding, as the taps are summed in (kh, kw, ic) order.
+void snn_conv2d_hwc(const float* input, float* output, const float* weights, const float* biases,
+                    int in_channels, int out_channels, int input_size, int kernel_size, int stride, int padding);
+
+// Largest feature map (input_size * input_size) the event-driven
+// convolution can gather in one pass
+#define SNN_EVENT_MAP_SIZE 1024
+
+// Event-driven 2D convolution for sparse inputs such as spike maps: gathers
+// the non-zero positions of each input channel and scatter-adds their
+// weighted kernel patches into the output, so work scales with activity.
+// Produces the same results as snn_conv2d(). Requires
+// input_size * input_size <= SNN_EVENT_MAP_SIZE.
+void snn_conv2d_events(const float* input, float* output, const float* weights, const float* biases,
+                       int in_channels, int out_channels, int input_size, int kernel_size, int stride, int padding);
+
+// Number of non-zero elements, i.e. spikes in a binary map
+int snn_count_nonzero(const float* input, int size);
+
+// Event-driven 2D convolution over a packed spike map, as
+// snn_conv2d_events() but finding the spikes a word at a time. Requires
+// input_size * input_size <= SNN_EVENT_MAP_SIZE.
+void snn_conv2d_spikes(const SNNSpikeWord* input, float* output, const float* weights, const float* biases,
+                       int in_channels, int out_channels, int input_size, int kernel_size, int stride, int padding);
+
+// Function to perform 2D max pooling
+void snn_maxpool2d(const float* input, float* output, int in_channels, int input_size, int kernel_size, int stride);
+
+// Max pooling of a packed spike map, where the max is a logical OR. 2x2
+// windows with stride 2 over maps whose rows pack evenly into words (the
+// width divides 32 or is a multiple of it) run on whole words.
+void snn_maxpool2d_spikes(const SNNSpikeWord* input, SNNSpikeWord* output, int in_channels, int input_size,
+                          int kernel_size, int stride);
+
+// One output row oh of a convolution, [out_channels][output_size], from
+// the kernel_size input rows it reads: rows[kh] is input row
+// oh * stride - padding + kh, [in_channels][input_size], or NULL where that
+// falls in the padding. Taps are added in the order of snn_conv2d() and
+// snn_conv2d_spikes(), so a map computed row by row matches theirs exactly.
+void snn_conv2d_row(const float* const* rows, float* output, const float* weights, const float* biases,
+                    int in_channels, int out_channels, int input_size, int kernel_size, int stride, int padding);
+
+// snn_conv2d_row() over packed spike rows, bit ic * input_size + iw of
+// each row, adding the weight of every spike
+void snn_conv2d_spikes_row(const SNNSpikeWord* const* rows, float* output, const float* weights,
+                           const float* biases, int in_channels, int out_channels, int input_size, int kernel_size,
+                           int stride, int padding);
+
+// One output row of max pooling, [channels][output_size], from the
+// kernel_size rows of its windows (NULL past the bottom edge), float or
+// packed; the packed output row is zeroed first
+void snn_maxpool2d_row(const float* const* rows, float* output, int channels, int input_size, int kernel_size,
+                       int stride);
+void snn_maxpool2d_spikes_row(const SNNSpikeWord* const* rows, SNNSpikeWord* output, int channels, int input_size,
+                              int kernel_size, int stride);
+
+// Function to perform a fully connected layer (biases may be NULL)
+void snn_linear(const float* input, float* output, const float* weights, const float* biases,
+                int in_features, int out_features);
+
+// Fully connected layer over packed spikes: sums the weight column of
+// every spiking input, in the same order as snn_linear()
+void snn_linear_spikes(const SNNSpikeWord* input, float* output, const float* weights, const float* biases,
+                       int in_features, int out_features);
+
+// L1 data cache of the STM32H735's Cortex-M7
+#define SNN_L1_DCACHE_BYTES 16384
+
+// Working set the tiled kernels size their tiles to: half the D-cache,
+// leaving the rest to lines lost to conflicts in its 4-way sets, the stack
+// and data streaming past
+#ifndef SNN_TILE_BYTES
+#define SNN_TILE_BYTES (SNN_L1_DCACHE_BYTES / 2)
+#endif
+
+// snn_conv2d() a tile at a time: tile_rows output rows of tile_channels
+// output channels, channel tiles outermost. A tile starts from the biases
+// and adds one input channel at a time, so the tile's outputs and one
+// channel's band of input rows stay cached while the tile's kernel slices
+// for that channel are applied; the next row tile reuses the kernels, the
+// next channel tile the input. Every output still adds its taps in the
+// order of snn_conv2d(), so the results match. A tile covering the whole
+// map runs snn_conv2d() itself.
+void snn_conv2d_tiled(const float* input, float* output, const float* weights, const float* biases,
+                      int in_channels, int out_channels, int input_size, int kernel_size, int stride, int padding,
+                      int tile_channels, int tile_rows);
+
+// Tiles of snn_conv2d_tiled() whose outputs, input band and kernel slices
+// fit cache_bytes, choosing the ones that move the fewest bytes between
+// memory and the cache. When no tiling beats snn_conv2d() (whose input is
+// reread per output channel unless it fits the D-cache), the whole map.
+void snn_conv2d_tiles(int in_channels, int out_channels, int input_size, int kernel_size, int stride, int padding,
+                      size_t cache_bytes, int* tile_channels, int* tile_rows);
+
+// Function to apply ReLU in place
+void snn_relu(float* input, int size);
+
+// Index of the largest element; ties resolve to the lowest index
+int snn_argmax(const float* input, int size);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // SNN_KERNELS_H
@@ -0,0 +1,80 @@
+#ifndef SNN_LIF_H
+#define SNN_LIF_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "snn_spikes.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct {
+    float membrane_potential;
+    bool should_spike;
+} LIFNeuron;
+
+// Apply one Leaky Integrate and Fire (LIF) update to a single neuron
+void snn_update_neuron(LIFNeuron *neuron, float input_current, float beta, float threshold);
+
+// Q16.16 fixed point: a signed value with 16 fraction bits
+typedef int32_t SNNFixed;
+
+#define SNN_FIXED_FRACTION_BITS 16
+#define SNN_FIXED_ONE ((SNNFixed)1 << SNN_FIXED_FRACTION_BITS)
+
+// Truncates toward zero like the M7's fixed-point VCVT, and saturates
+// outside [-32768, 32768)
+static inline SNNFixed snn_fixed_from_float(float value) {
+    float scaled = value * SNN_FIXED_ONE;
+    if (scaled >= 2147483520.0f) return INT32_MAX;
+    if (scaled < -2147483648.0f) return INT32_MIN;
+    return (SNNFixed)scaled;
+}
+
+static inline float snn_fixed_to_float(SNNFixed value) {
+    return value * (1.0f / SNN_FIXED_ONE);
+}
+
+// A layer's worth of LIF neurons, stored as structure-of-arrays: one
+// contiguous membrane array and a bitmask of the neurons that fired last
+// step and reset on this one. Half the memory of a LIFNeuron array, and
+// the update runs without branches over whole words of neurons.
+//
+// A fixed-point population keeps Q16.16 membranes instead: each current is
+// converted once, the leak is a multiply by beta in Q16 and a shift, and
+// the threshold compare is on integers, so the update needs no FPU.
+typedef struct {
+    float* membrane;            // NULL in a fixed-point population
+    SNNFixed* fixed_membrane;   // NULL in a float population
+    SNNSpikeWord* refractory;
+    int count;
+} LIFPopulation;
+
+// Bytes of memory a population of count neurons occupies, float or fixed
+size_t snn_lif_population_bytes(int count);
+
+// Lay a population out in memory (word aligned, at least
+// snn_lif_population_bytes() long) and put every neuron at rest
+void snn_lif_population_init(LIFPopulation* population, void* memory, int count);
+void snn_lif_population_init_fixed(LIFPopulation* population, void* memory, int count);
+
+// Update neurons [first, first + count) of the population with the same
+// rule as snn_update_neuron() and set bit first + i of spikes (zeroed
+// beforehand) for every neuron i that fires. A NULL population starts each
+// neuron from rest without keeping its state. Fixed-point populations take
+// beta and threshold in float and convert them once per word.
+void snn_lif_update_spikes(LIFPopulation* population, int first, const float* input_currents, int count,
+                           float beta, float threshold, SNNSpikeWord* spikes);
+
+// As snn_lif_update_spikes(), but replace each input current in values
+// with the neuron's membrane potential, or with 1.0/0.0 for its spike
+void snn_lif_update_values(LIFPopulation* population, int first, float* values, int count,
+                           float beta, float threshold, bool membrane);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // SNN_LIF_H
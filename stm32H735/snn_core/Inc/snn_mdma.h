@@ -0,0 +1,28 @@
+#ifndef SNN_MDMA_H
+#define SNN_MDMA_H
+
+#include <stdint.h>
+#include "snn_weights.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// SNNAsyncCopy on MDMA channel 0 for prefetching weight sources. Builds
+// with SNN_MDMA_PREFETCH program a software-triggered block transfer in
+// words and take its completion interrupt; this file then defines
+// MDMA_IRQHandler, so MDMA must stay disabled in the .ioc. One transfer
+// moves at most 64 KB, larger copies run on the core, as does the copy of a
+// transfer that ends in a bus error. MDMA reaches flash, the OctoSPI
+// mapping, AXI SRAM and DTCM. With the D-cache on (SNN_CACHE_ENABLE) the
+// destination is invalidated once a transfer completes, so staging must
+// start and end on 32-byte lines, as snn_weights_chunk_bytes() keeps each
+// half. Other builds, and the host, get a copy that runs on the core when
+// started. clock stamps completions for the prefetch stats.
+void snn_mdma_init(SNNAsyncCopy* copy, uint32_t (*clock)(void));
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // SNN_MDMA_H
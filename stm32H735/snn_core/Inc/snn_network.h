@@ -0,0 +1,308 @@
+#ifndef SNN_NETWORK_H
+#define SNN_NETWORK_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "snn_lif.h"
+#include "snn_quant.h"
+#include "snn_codebook.h"
+#include "snn_sparse.h"
+#include "snn_winograd.h"
+#include "snn_specialize.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Alignment of every buffer in the activation arena
+#define SNN_ARENA_ALIGNMENT 8
+
+// Images snn_network_run_batch() runs at once. Every image keeps an arena
+// of its own, SNN_BATCH_STRIDE() bytes after the one before, so a batch of
+// n takes (n - 1) * SNN_BATCH_STRIDE(size) + size bytes.
+#define SNN_MAX_BATCH 8
+#define SNN_BATCH_STRIDE(arena_size) \
+    (((arena_size) + SNN_ARENA_ALIGNMENT - 1) / SNN_ARENA_ALIGNMENT * SNN_ARENA_ALIGNMENT)
+
+// Largest batch whose arenas of arena_size bytes fit in budget bytes, at
+// most SNN_MAX_BATCH, for sizing a batch at compile time
+#define SNN_BATCH_SIZE(arena_size, budget) \
+    ((budget) / SNN_BATCH_STRIDE(arena_size) < SNN_MAX_BATCH ? (budget) / SNN_BATCH_STRIDE(arena_size) \
+                                                             : SNN_MAX_BATCH)
+
+typedef enum {
+    SNN_LAYER_CONV2D,
+    SNN_LAYER_MAXPOOL2D,
+    SNN_LAYER_LINEAR,
+} SNNLayerType;
+
+typedef enum {
+    SNN_ACT_NONE,
+    SNN_ACT_RELU,
+    SNN_ACT_LIF_MEMBRANE,   // forward the LIF membrane potential (mnist_snn)
+    SNN_ACT_LIF_SPIKE,      // forward the LIF spike as 0.0/1.0 (cifar_snn output)
+    SNN_ACT_LIF_SPIKE_BITS, // forward the LIF spike packed 32 per word (cifar_snn hidden layers)
+} SNNActivation;
+
+// How a convolution computes its dense (float input) output
+typedef enum {
+    SNN_CONV_DIRECT,        // snn_conv2d()
+    SNN_CONV_GEMM,          // snn_conv2d_gemm(), for layers that compute every channel at once
+    SNN_CONV_TILED,         // snn_conv2d_tiled()
+} SNNConvAlgorithm;
+
+// One stage of a feed-forward network. Linear layers use in_channels and
+// out_channels as feature counts and input_size 1; flattening a pooled
+// map into a linear layer is free because both are stored channel-major.
+//
+// A layer with SNN_ACT_LIF_SPIKE_BITS writes a packed spike tensor (see
+// snn_spikes.h). Max pooling keeps its input packed, and convolution and
+// linear layers read packed inputs with their spike kernels, so a network
+// stays packed from the first such layer until one produces floats again.
+// The last layer must produce floats for the decoder.
+typedef struct {
+    SNNLayerType type;
+    int in_channels;
+    int out_channels;
+    int input_size;
+    int kernel_size;
+    int stride;
+    int padding;
+    const float* weights;
+    const float* biases;
+    SNNActivation activation;
+    float beta;
+    float threshold;
+    float max_event_rate;   // conv2d: use the event-driven kernel up to this input firing rate
+    SNNConvAlgorithm algorithm;
+} SNNLayer;
+
+#define SNN_MAX_LAYERS 16
+
+// Where a network's float weights are read from, see snn_weights.h
+typedef struct SNNWeightSource SNNWeightSource;
+
+typedef struct {
+    const char* name;
+    const SNNLayer* layers;
+    int num_layers;
+    int timesteps;          // default simulation length, 1 for a single pass
+    const SNNQuantWeights* quantized;   // int8 weights per layer, NULL for a float network
+    int fixed_membranes;    // LIF layers keep Q16.16 membranes (see LIFPopulation)
+    const float* const* winograd;       // Winograd-domain kernels per layer (snn_winograd.h), or NULL
+    const SNNConvKernel* const* kernels;    // shape-specialised convolutions per layer, or NULL
+    const float* const* ohwi;           // OHWI weights per layer for channels-last convolutions, or NULL
+    const SNNSparseWeights* sparse;     // block-sparse weights per layer, NULL for a dense network
+    const SNNCodebookWeights* codebook; // 4-bit codebook weights per layer, NULL for a float network
+    SNNWeightSource* weight_source;     // reads the float weights, NULL to read them in place
+    int exit_window;        // default early exit of multi-step runs (SNNRunConfig), 0 for none
+    float exit_margin;
+} SNNNetwork;
+
+// Per-step latency is kept for the first SNN_MAX_TIMESTEPS steps
+#define SNN_MAX_TIMESTEPS 32
+
+// Synaptic operations: a MAC multiplies a real-valued input by its weight,
+// an AC only adds the weight of a binary spike
+typedef struct {
+    uint32_t macs;
+    uint32_t acs;
+} SNNSynapticOps;
+
+// Early exit: a multi-step run sums the outputs over windows of
+// exit_window steps and stops at the end of the first window in which the
+// top class leads the runner-up by at least exit_margin (in output units,
+// spikes for a spiking output layer), so easy inputs take fewer steps than
+// hard ones. The windows do not overlap, so a run stops only on a multiple
+// of exit_window steps. The prediction is still the argmax of the outputs
+// summed over every step taken. SNNRunResult reports the steps taken.
+typedef struct {
+    int timesteps;                  // 0 uses the network default
+    uint32_t (*clock)(void);        // optional free-running tick source
+    int count_synops;               // fill SNNRunResult.synops, at a pass over every layer input
+    int exit_window;                // steps per window, 0 for the network default, -1 to run every step
+    float exit_margin;              // lead of the top class over the second within a window
+} SNNRunConfig;
+
+typedef struct {
+    int predicted;                  // argmax of outputs
+    int timesteps;                  // steps simulated, fewer than requested after an early exit
+    const float* outputs;           // last layer output summed over all steps, in the arena
+    uint32_t step_ticks[SNN_MAX_TIMESTEPS];
+    uint32_t layer_ticks[SNN_MAX_LAYERS];   // summed over the steps; a fused pool counts with its conv
+    uint32_t total_ticks;
+    SNNSynapticOps synops[SNN_MAX_LAYERS];  // summed over the steps, if config->count_synops
+} SNNRunResult;
+
+#define SNN_CONV2D(in, out, size, kernel, stride, padding, weights, biases, act, beta, threshold) \
+    { SNN_LAYER_CONV2D, (in), (out), (size), (kernel), (stride), (padding), \
+      (const float*)(weights), (const float*)(biases), (act), (beta), (threshold) }
+
+// Convolution over a spike map: runs event-driven while at most max_rate
+// of the inputs are non-zero, and falls back to the dense kernel above it
+#define SNN_EVENT_CONV2D(in, out, size, kernel, stride, padding, weights, biases, act, beta, threshold, max_rate) \
+    { SNN_LAYER_CONV2D, (in), (out), (size), (kernel), (stride), (padding), \
+      (const float*)(weights), (const float*)(biases), (act), (beta), (threshold), (max_rate) }
+
+// Convolution lowered to a tiled matrix multiply. Only layers that compute
+// all their channels in one call can use it: float output and no packed
+// input, so such a layer never fuses the pool after it. Elsewhere, and on
+// int8 weights, it runs the direct kernel.
+#define SNN_GEMM_CONV2D(in, out, size, kernel, stride, padding, weights, biases, act, beta, threshold) \
+    { SNN_LAYER_CONV2D, (in), (out), (size), (kernel), (stride), (padding), \
+      (const float*)(weights), (const float*)(biases), (act), (beta), (threshold), 0, SNN_CONV_GEMM }
+
+// Convolution computed in tiles sized to the L1 D-cache (SNN_TILE_BYTES),
+// for firmware running with the caches on. Results match the untiled
+// kernel. Packed inputs, int8 and codebook weights, and layers no tiling
+// helps (snn_conv2d_tiles()) run untiled.
+#define SNN_TILED_CONV2D(in, out, size, kernel, stride, padding, weights, biases, act, beta, threshold) \
+    { SNN_LAYER_CONV2D, (in), (out), (size), (kernel), (stride), (padding), \
+      (const float*)(weights), (const float*)(biases), (act), (beta), (threshold), 0, SNN_CONV_TILED }
+
+#define SNN_MAXPOOL2D(channels, size, kernel, stride) \
+    { SNN_LAYER_MAXPOOL2D, (channels), (channels), (size), (kernel), (stride), 0, \
+      NULL, NULL, SNN_ACT_NONE, 0, 0 }
+
+#define SNN_LINEAR(in, out, weights, biases, act, beta, threshold) \
+    { SNN_LAYER_LINEAR, (in), (out), 1, 1, 1, 0, \
+      (const float*)(weights), (const float*)(biases), (act), (beta), (threshold) }
+
+// Spatial output size of a layer (1 for linear layers)
+int snn_layer_output_size(const SNNLayer* layer);
+
+// Number of elements a layer reads and writes
+int snn_layer_input_count(const SNNLayer* layer);
+int snn_layer_output_count(const SNNLayer* layer);
+
+// Number of weights of a conv or linear layer; 0 for pooling
+int snn_layer_weight_count(const SNNLayer* layer);
+
+// Whether the layer writes packed spikes, given whether it reads them
+int snn_layer_output_packed(const SNNLayer* layer, int input_packed);
+
+// Bytes of the layer output: a float or a bit per element
+size_t snn_layer_output_bytes(const SNNLayer* layer, int input_packed);
+
+// Floats of scratch a packed-output or pool-fused layer computes its input
+// currents in, one output channel at a time for convolutions; 0 for other
+// layers. pool is the fused max pool, or NULL.
+int snn_layer_current_count(const SNNLayer* layer, int input_packed, const SNNLayer* pool);
+
+// Whether layer l is a direct convolution the max pool of layer l + 1 can
+// be fused into, see snn_layer_forward_pooled()
+int snn_network_fuses_pool(const SNNNetwork* network, int l);
+
+// Int8 weights of layer l, or NULL if it runs in float
+const SNNQuantWeights* snn_network_quantized(const SNNNetwork* network, int l);
+
+// What a layer runs on besides its float weights and the generic kernels
+typedef struct {
+    const SNNQuantWeights* quant;   // int8 weights, or NULL
+    const float* winograd;          // Winograd-domain kernels, or NULL
+    const SNNConvKernel* conv;      // kernels specialised for the layer's shape, or NULL
+    const float* ohwi;              // OHWI weights of a channels-last convolution, or NULL
+    const SNNSparseWeights* sparse; // block-sparse weights of a pruned linear layer, or NULL
+    const SNNCodebookWeights* codebook; // 4-bit codebook weights, or NULL
+    SNNWeightSource* source;        // reads the float weights, or NULL to read them in place
+} SNNLayerWeights;
+
+// Weights of layer l. Winograd kernels only apply to a float, direct,
+// 3x3 stride-1 convolution, OHWI weights to a float, direct convolution
+// without Winograd kernels, specialised kernels to a float convolution of
+// their exact shape and sparse weights to a float linear layer. Int8
+// weights take precedence over all of them, then codebook weights, which
+// only combine with the specialised kernels.
+SNNLayerWeights snn_network_weights(const SNNNetwork* network, int l);
+
+// Bytes of scratch an int8 layer quantizes a float input into; 0 for float
+// layers and for packed spike inputs, which the int8 kernels read directly
+int snn_layer_input_q8_count(const SNNLayer* layer, const SNNQuantWeights* quant, int input_packed);
+
+// Floats of scratch the layer lowers a float input into: im2col tiles for
+// a GEMM layer, transformed input tiles for a Winograd one, the HWC copy of
+// the input for a channels-last one. A codebook convolution decodes the
+// kernel of one output channel there instead, whatever its input. 0
+// otherwise.
+int snn_layer_scratch_count(const SNNLayer* layer, const SNNLayerWeights* weights, int input_packed,
+                            const SNNLayer* pool);
+
+// Whether snn_layer_forward() would take the event-driven path for this input
+int snn_layer_uses_events(const SNNLayer* layer, const float* input);
+
+// Add the synaptic operations snn_layer_forward() performs on this input to
+// ops: ACs for every weight a spike selects when input is packed, MACs for
+// every weight a non-zero input meets on the event-driven path, and MACs
+// for every connection otherwise. Sparse layers count stored weights only.
+void snn_layer_count_synops(const SNNLayer* layer, const SNNLayerWeights* weights, const void* input,
+                            int input_packed, SNNSynapticOps* ops);
+
+// Whether the layer keeps LIF state (one neuron per output element)
+int snn_layer_has_neurons(const SNNLayer* layer);
+
+// Working memory of one layer step; members the layer does not use may be NULL
+typedef struct {
+    LIFPopulation* neurons; // LIF state, or NULL to start every neuron from rest unrecorded
+    float* currents;        // snn_layer_current_count() floats
+    int8_t* input_q8;       // snn_layer_input_q8_count() bytes
+    float* scratch;         // snn_layer_scratch_count() floats
+} SNNLayerMemory;
+
+// Run one layer: compute its output, then apply its activation in place.
+// input is packed spikes if input_packed, floats otherwise, and output is
+// as snn_layer_output_packed() says. weights selects the int8 or Winograd
+// kernels, see snn_network_weights(). For LIF layers memory->neurons is a
+// population of snn_layer_output_count() neurons.
+void snn_layer_forward(const SNNLayer* layer, const SNNLayerWeights* weights, const void* input, int input_packed,
+                       void* output, const SNNLayerMemory* memory);
+
+// Run a convolution and the max pool after it as one layer: each output
+// channel is convolved, activated and pooled in currents, so only the
+// pooled map (packed if the convolution packs) reaches output. currents
+// holds snn_layer_current_count(layer, input_packed, pool) floats.
+void snn_layer_forward_pooled(const SNNLayer* layer, const SNNLayer* pool, const SNNLayerWeights* weights,
+                              const void* input, int input_packed, void* output, const SNNLayerMemory* memory);
+
+// Bytes of arena a run of the given length needs, as planned by
+// snn_plan_arena(); 0 if the network cannot be planned
+size_t snn_network_arena_size(const SNNNetwork* network, int timesteps);
+
+// Simulate the network for config->timesteps steps (the network default
+// when config is NULL or asks for 0), feeding the same input every step.
+// LIF membranes persist across steps; the last layer's output is summed
+// over the steps (spike counts for spiking outputs) and decoded by argmax.
+// arena must be SNN_ARENA_ALIGNMENT aligned and must not hold the input.
+// Returns the predicted class, or -1 if arena_size is too small or the
+// network's weight source stages less than snn_weights_channel_bytes().
+int snn_network_run(const SNNNetwork* network, const float* input, void* arena, size_t arena_size,
+                    const SNNRunConfig* config, SNNRunResult* result);
+
+// Bytes of arena a batch of images needs for runs of the given length; 0
+// if the network cannot be planned
+size_t snn_network_batch_arena_size(const SNNNetwork* network, int timesteps, int batch);
+
+// Largest batch, at most SNN_MAX_BATCH, whose runs of the given length fit
+// in arena_size bytes; 0 if not even one image fits
+int snn_network_batch_size(const SNNNetwork* network, int timesteps, size_t arena_size);
+
+// snn_network_run() of batch images at once, inputs[b] giving results[b].
+// Layers run weight-stationary: each chunk of a layer's weights is read
+// once for every image of the batch instead of once per image, so weights
+// streamed from flash are fetched once per batch while they sit in the
+// D-cache. Outputs match single-image runs exactly. Early exits are per
+// image; tick counts cover the whole batch for every step an image takes
+// part in. Returns 0, or -1 if batch is not 1..SNN_MAX_BATCH, arena_size
+// is below snn_network_batch_arena_size() or the weight source stages too
+// little, as for snn_network_run().
+int snn_network_run_batch(const SNNNetwork* network, const float* const* inputs, int batch, void* arena,
+                          size_t arena_size, const SNNRunConfig* config, SNNRunResult* results);
+
+// snn_network_run() with the network defaults, for an arena of at least
+// snn_network_arena_size(network, network->timesteps) bytes
+int snn_network_inference(const SNNNetwork* network, const float* input, void* arena);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // SNN_NETWORK_H
@@ -0,0 +1,103 @@
+#ifndef SNN_PLACEMENT_H
+#define SNN_PLACEMENT_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Memory placement on the STM32H735. ITCM and DTCM answer in zero wait
+// states and sit beside the caches. Without SNN_CACHE_ENABLE every fetch
+// from flash stalls on its wait states and all RAM_D1 data crosses the
+// AXI bus; with it, flash and AXI SRAM are cached and the TCMs only save
+// the misses and the evictions of a 16 KB cache, so code and buffers that
+// fit in L1 gain little from them. Hot kernels and buffers carry an
+// SNN_PLACE_<object> tag; a build with SNN_TCM_PLACEMENT includes the
+// project's snn_placement_config.h, generated by Tools/snn_place, which
+// maps each tag onto a region:
+//   SNN_ITCM     code, copied from flash to ITCM by snn_placement_init()
+//   SNN_DTCM     zeroed data in DTCM
+//   SNN_RAM_D2   zeroed data in D2 SRAM, whose clocks the caller enables
+//   SNN_RAM_D3   zeroed data in D3 SRAM
+// The sections are laid out by every project's STM32H735IGKX_*.ld. Tags
+// the config leaves out, and every tag in host builds, keep the default
+// placement: code in flash, data in RAM_D1.
+#if defined(SNN_TCM_PLACEMENT)
+// Functions in ITCM are never inlined into flash-resident callers, which
+// would leave the hot loop behind in flash
+#define SNN_ITCM __attribute__((section(".itcm_text"), noinline))
+#define SNN_DTCM __attribute__((section(".dtcm_bss")))
+#define SNN_RAM_D2 __attribute__((section(".ram_d2_bss")))
+#define SNN_RAM_D3 __attribute__((section(".ram_d3_bss")))
+#include "snn_placement_config.h"
+#else
+#define SNN_ITCM
+#define SNN_DTCM
+#define SNN_RAM_D2
+#define SNN_RAM_D3
+#endif
+
+// Kernels of the float build, one tag per kernel snn_place can place.
+// Cached builds run the conv layers the models tile through
+// snn_conv2d_tiled(), tagged SNN_PLACE_CONV2D_TILED. The checked-in
+// configs were measured on the untiled layer tables of uncached builds and
+// leave that tag out; regenerate them from a layer table with the tiled
+// algorithm before placing a cached build.
+#ifndef SNN_PLACE_CONV2D
+#define SNN_PLACE_CONV2D
+#endif
+#ifndef SNN_PLACE_CONV2D_SPIKES
+#define SNN_PLACE_CONV2D_SPIKES
+#endif
+#ifndef SNN_PLACE_CONV2D_EVENTS
+#define SNN_PLACE_CONV2D_EVENTS
+#endif
+#ifndef SNN_PLACE_CONV2D_GEMM
+#define SNN_PLACE_CONV2D_GEMM
+#endif
+#ifndef SNN_PLACE_CONV2D_HWC
+#define SNN_PLACE_CONV2D_HWC
+#endif
+#ifndef SNN_PLACE_CONV2D_WINOGRAD
+#define SNN_PLACE_CONV2D_WINOGRAD
+#endif
+#ifndef SNN_PLACE_CONV2D_SPECIALIZED
+#define SNN_PLACE_CONV2D_SPECIALIZED
+#endif
+#ifndef SNN_PLACE_CONV2D_TILED
+#define SNN_PLACE_CONV2D_TILED
+#endif
+#ifndef SNN_PLACE_LINEAR
+#define SNN_PLACE_LINEAR
+#endif
+#ifndef SNN_PLACE_LINEAR_SPIKES
+#define SNN_PLACE_LINEAR_SPIKES
+#endif
+#ifndef SNN_PLACE_MAXPOOL2D
+#define SNN_PLACE_MAXPOOL2D
+#endif
+#ifndef SNN_PLACE_MAXPOOL2D_SPIKES
+#define SNN_PLACE_MAXPOOL2D_SPIKES
+#endif
+#ifndef SNN_PLACE_LIF
+#define SNN_PLACE_LIF
+#endif
+
+// Buffers the firmware declares: the activation arena of one image, which
+// also holds the LIF state, and the SNNRunResult kept for the debugger
+#ifndef SNN_PLACE_ARENA
+#define SNN_PLACE_ARENA
+#endif
+#ifndef SNN_PLACE_RESULTS
+#define SNN_PLACE_RESULTS
+#endif
+
+// Copy the ITCM code out of flash and zero the DTCM, D2 and D3 sections.
+// Call once at startup, before the first inference; does nothing without
+// SNN_TCM_PLACEMENT.
+void snn_placement_init(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // SNN_PLACEMENT_H
@@ -0,0 +1,52 @@
+#ifndef SNN_PLAN_H
+#define SNN_PLAN_H
+
+#include <stddef.h>
+#include "snn_network.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define SNN_MAX_BUFFERS (5 * SNN_MAX_LAYERS + 1)
+
+// Placement of every buffer a run needs inside one shared arena.
+//
+// Buffer l (l < num_layers) is the output of layer l: written at step l and
+// last read at step l + 1 (the final output is read by the decoder), and
+// reused by every timestep. Outputs of packed-spike layers take a bit per
+// element, and those layers add a current scratch live only at their own
+// step, as do the int8 copy of a float input of an int8 layer and the
+// im2col or Winograd scratch of a convolution. A convolution fused with the
+// max pool after it writes the pool's buffer directly, so its own output
+// buffer is empty. Multi-step runs also keep the LIF state of each spiking
+// layer, and the decoder's accumulated output with its sum at the start of
+// the early-exit window, live for the whole run.
+// Buffers whose lifetimes do not overlap share memory.
+typedef struct {
+    int num_buffers;
+    size_t offsets[SNN_MAX_BUFFERS];
+    size_t sizes[SNN_MAX_BUFFERS];
+    int first_use[SNN_MAX_BUFFERS];
+    int last_use[SNN_MAX_BUFFERS];
+    int state_buffer[SNN_MAX_LAYERS];   // LIF state of layer l, -1 if none
+    int current_buffer[SNN_MAX_LAYERS]; // packed-output or fused scratch of layer l, -1 if none
+    int input_q8_buffer[SNN_MAX_LAYERS];// quantized input of int8 layer l, -1 if none
+    int scratch_buffer[SNN_MAX_LAYERS]; // im2col or Winograd scratch of layer l, -1 if none
+    int fused_pool[SNN_MAX_LAYERS];     // layer l runs with layer l + 1 fused in
+    int accumulator_buffer;             // decoder output sum, then its early-exit window, -1 if none
+    size_t arena_size;                  // peak memory: highest end offset of any buffer
+    size_t unplanned_size;              // every buffer live for the whole run
+} SNNArenaPlan;
+
+// Plan the arena for runs of the given number of timesteps. One timestep
+// needs no LIF state; any more need the same, larger arena. Returns 0, or
+// -1 if the network has more than SNN_MAX_LAYERS layers or its last layer
+// writes packed spikes.
+int snn_plan_arena(const SNNNetwork* network, int timesteps, SNNArenaPlan* plan);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // SNN_PLAN_H
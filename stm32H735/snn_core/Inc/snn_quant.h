@@ -0,0 +1,77 @@
+#ifndef SNN_QUANT_H
+#define SNN_QUANT_H
+
+#include <stdint.h>
+#include "snn_spikes.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Int8 weights of one layer, quantized symmetrically per output channel:
+// weights[oc][i] stands for weights[oc][i] * scales[oc]. The layout is the
+// float layout of snn_kernels.h. An entry with NULL weights is a float layer.
+typedef struct {
+    const int8_t* weights;
+    const float* scales;
+} SNNQuantWeights;
+
+// Quantize [out_channels][per_channel] float weights, choosing each
+// channel's scale so its largest magnitude maps to 127
+void snn_quantize_weights(const float* weights, int out_channels, int per_channel, int8_t* quantized,
+                          float* scales);
+
+// Quantize an activation tensor with one symmetric scale and return the scale
+float snn_quantize_input(const float* input, int8_t* quantized, int count);
+
+// The int8 kernels accumulate in int32 and convert each output once,
+// output = sum * scales[oc] * input_scale + biases[oc] (biases may be NULL).
+// The spike kernels read packed spikes, so they only add weights. Each
+// output holds its int32 sum until it is converted in place.
+void snn_conv2d_q8(const int8_t* input, float input_scale, float* output, const int8_t* weights,
+                   const float* scales, const float* biases, int in_channels, int out_channels, int input_size,
+                   int kernel_size, int stride, int padding);
+
+// Needs input maps of at most SNN_EVENT_MAP_SIZE elements
+void snn_conv2d_spikes_q8(const SNNSpikeWord* input, float* output, const int8_t* weights, const float* scales,
+                          const float* biases, int in_channels, int out_channels, int input_size, int kernel_size,
+                          int stride, int padding);
+
+void snn_linear_q8(const int8_t* input, float input_scale, float* output, const int8_t* weights,
+                   const float* scales, const float* biases, int in_features, int out_features);
+
+void snn_linear_spikes_q8(const SNNSpikeWord* input, float* output, const int8_t* weights, const float* scales,
+                          const float* biases, int in_features, int out_features);
+
+// The int32 sums of the kernels above, before any conversion
+void snn_conv2d_q8_sums(const int8_t* input, int32_t* sums, const int8_t* weights, int in_channels,
+                        int out_channels, int input_size, int kernel_size, int stride, int padding);
+void snn_conv2d_spikes_q8_sums(const SNNSpikeWord* input, int32_t* sums, const int8_t* weights, int in_channels,
+                               int out_channels, int input_size, int kernel_size, int stride, int padding);
+void snn_linear_q8_sums(const int8_t* input, int32_t* sums, const int8_t* weights, int in_features,
+                        int out_features);
+void snn_linear_spikes_q8_sums(const SNNSpikeWord* input, int32_t* sums, const int8_t* weights, int in_features,
+                               int out_features);
+
+// Convert channels x outputs int32 sums as the kernels do; input_scale is
+// 1 for spike input. sums and output may be the same buffer.
+void snn_q8_dequantize(const int32_t* sums, float* output, const float* scales, float input_scale,
+                       const float* biases, int channels, int outputs);
+
+// The smallest int32 sum whose converted current, sum * scale + bias,
+// reaches threshold (scale > 0). A LIF neuron without membrane state
+// fires on its current alone, so it fires exactly when its sum reaches
+// this limit.
+int32_t snn_q8_threshold(float threshold, float scale, float bias);
+
+// Spikes of a LIF layer without membrane state, compared in the integer
+// domain: output is 1 where the sum reaches the channel's
+// snn_q8_threshold(), 0 elsewhere. sums and output may be the same buffer.
+void snn_q8_fire(const int32_t* sums, float* output, const float* scales, float input_scale, const float* biases,
+                 float threshold, int channels, int outputs);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // SNN_QUANT_H
@@ -0,0 +1,56 @@
+#ifndef SNN_SPARSE_H
+#define SNN_SPARSE_H
+
+#include <stdint.h>
+#include "snn_spikes.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Block-sparse weights of a pruned linear layer. Each output row keeps the
+// 1xSNN_SPARSE_BLOCK blocks of consecutive input weights that survived
+// pruning, in CSR order: row r owns blocks [row_starts[r], row_starts[r + 1]),
+// block b holds values[b * SNN_SPARSE_BLOCK ...] for the inputs starting at
+// columns[b]. in_features must be a multiple of SNN_SPARSE_BLOCK, so a block
+// never straddles a spike word. An entry with NULL values is a dense layer.
+#define SNN_SPARSE_BLOCK 4
+
+typedef struct {
+    const float* values;
+    const uint16_t* columns;
+    const uint32_t* row_starts;     // out_features + 1 offsets
+} SNNSparseWeights;
+
+// Copy [out_features][in_features] weights into pruned, zeroing all but the
+// round((1 - sparsity) * blocks) blocks of largest L1 norm in every row
+void snn_prune_blocks(const float* weights, float* pruned, int out_features, int in_features, float sparsity);
+
+// Number of blocks of [out_features][in_features] weights that are not all zero
+int snn_sparse_block_count(const float* weights, int out_features, int in_features);
+
+// Pack the non-zero blocks of weights into snn_sparse_block_count() blocks
+// of values and columns, and out_features + 1 row_starts
+void snn_sparse_pack(const float* weights, int out_features, int in_features, float* values, uint16_t* columns,
+                     uint32_t* row_starts);
+
+// Bytes of flash the packed weights take
+uint32_t snn_sparse_bytes(int blocks, int out_features);
+
+// snn_linear() and snn_linear_spikes() over the stored blocks only. Zero
+// weights add nothing, so the results equal the dense kernels' on the
+// pruned weights. The spike kernel reads the input bits of a block at once
+// and adds the weights they select without branching on them; as
+// snn_linear_spikes() already skips silent inputs, it only wins at high
+// weight sparsity.
+void snn_linear_sparse(const float* input, float* output, const SNNSparseWeights* weights, const float* biases,
+                       int out_features);
+
+void snn_linear_spikes_sparse(const SNNSpikeWord* input, float* output, const SNNSparseWeights* weights,
+                              const float* biases, int out_features);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // SNN_SPARSE_H
@@ -0,0 +1,286 @@
+#ifndef SNN_SPECIALIZE_H
+#define SNN_SPECIALIZE_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "snn_kernels.h"
+#include "snn_placement.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Convolutions specialised at compile time for one layer shape. The bodies
+// below take every shape parameter as an argument and are always inlined:
+// snn_conv2d() and snn_conv2d_spikes() instantiate them with the runtime
+// values, SNN_SPECIALIZE_CONV2D() with the constants of one layer, so the
+// compiler sees fixed trip counts, unrolls the taps and folds the index
+// arithmetic. Taps are added in the same order either way, so specialised
+// and generic results are bit-identical.
+
+// Unoptimised (Debug) GCC builds would leave the constants unfolded; the
+// specialised kernels are optimised regardless
+#if defined(__GNUC__) && !defined(__clang__) && !defined(__OPTIMIZE__)
+#define SNN_SPECIALIZED __attribute__((optimize("O2")))
+#else
+#define SNN_SPECIALIZED
+#endif
+
+#define SNN_CONV_INLINE static inline __attribute__((always_inline)) SNN_SPECIALIZED
+
+// Output rows (and columns) [*first, *end) whose whole window lies inside
+// the input, so their taps need no bounds checks
+SNN_CONV_INLINE void snn_conv_interior_range(int input_size, int kernel_size, int stride, int padding,
+                                             int output_size, int* first, int* end) {
+    *first = (padding + stride - 1) / stride;
+    *end = input_size + padding >= kernel_size ? (input_size + padding - kernel_size) / stride + 1 : 0;
+    if (*first > output_size) *first = output_size;
+    if (*end < *first) *end = *first;
+}
+
+// One output of a border pixel, skipping the taps that fall in the padding
+SNN_CONV_INLINE float snn_conv_border(const float* input, const float* kernel, float sum, int in_channels,
+                                      int input_size, int kernel_size, int ih0, int iw0) {
+    int taps = kernel_size * kernel_size;
+
+    for (int ic = 0; ic < in_channels; ++ic) {
+        for (int kh = 0; kh < kernel_size; ++kh) {
+            for (int kw = 0; kw < kernel_size; ++kw) {
+                int ih = ih0 + kh;
+                int iw = iw0 + kw;
+                if (ih >= 0 && ih < input_size && iw >= 0 && iw < input_size) {
+                    sum += input[ic * input_size * input_size + ih * input_size + iw] *
+                           kernel[ic * taps + kh * kernel_size + kw];
+                }
+            }
+        }
+    }
+    return sum;
+}
+
+// One output of an interior pixel whose window starts at window
+SNN_CONV_INLINE float snn_conv_interior(const float* window, const float* kernel, float sum, int in_channels,
+                                        int input_size, int kernel_size) {
+    int taps = kernel_size * kernel_size;
+
+    for (int ic = 0; ic < in_channels; ++ic) {
+        const float* channel = window + ic * input_size * input_size;
+        const float* k = kernel + ic * taps;
+        for (int kh = 0; kh < kernel_size; ++kh) {
+            for (int kw = 0; kw < kernel_size; ++kw) {
+                sum += channel[kh * input_size + kw] * k[kh * kernel_size + kw];
+            }
+        }
+    }
+    return sum;
+}
+
+// snn_conv_interior() for 3x3 kernels, unrolled. The taps are added in the
+// same order, so the result is bit-identical.
+SNN_CONV_INLINE float snn_conv_interior_3x3(const float* window, const float* kernel, float sum, int in_channels,
+                                            int input_size) {
+    for (int ic = 0; ic < in_channels; ++ic) {
+        const float* r0 = window + ic * input_size * input_size;
+        const float* r1 = r0 + input_size;
+        const float* r2 = r1 + input_size;
+        const float* k = kernel + ic * 9;
+        sum += r0[0] * k[0];
+        sum += r0[1] * k[1];
+        sum += r0[2] * k[2];
+        sum += r1[0] * k[3];
+        sum += r1[1] * k[4];
+        sum += r1[2] * k[5];
+        sum += r2[0] * k[6];
+        sum += r2[1] * k[7];
+        sum += r2[2] * k[8];
+    }
+    return sum;
+}
+
+// Output channels [oc_first, oc_end) and rows [oh_first, oh_end) of
+// snn_conv2d(). Only the padded border pays for bounds checks: interior
+// rows split into a checked left edge, a check-free middle and a checked
+// right edge.
+SNN_CONV_INLINE void snn_conv2d_tile_body(const float* input, float* output, const float* weights,
+                                          const float* biases, int in_channels, int input_size, int kernel_size,
+                                          int stride, int padding, int oc_first, int oc_end, int oh_first,
+                                          int oh_end) {
+    int output_size = snn_conv_output_size(input_size, kernel_size, stride, padding);
+    int taps = kernel_size * kernel_size;
+    int first;
+    int end;
+
+    snn_conv_interior_range(input_size, kernel_size, stride, padding, output_size, &first, &end);
+
+    for (int oc = oc_first; oc < oc_end; ++oc) {
+        const float* kernel = weights + oc * in_channels * taps;
+        float bias = biases != NULL ? biases[oc] : 0;
+        float* out = output + oc * output_size * output_size;
+
+        for (int oh = oh_first; oh < oh_end; ++oh) {
+            int ih0 = oh * stride - padding;
+            int interior = oh >= first && oh < end;
+
+            for (int ow = 0; ow < output_size; ++ow) {
+                int iw0 = ow * stride - padding;
+                if (!interior || ow < first || ow >= end) {
+                    out[oh * output_size + ow] = snn_conv_border(input, kernel, bias, in_channels, input_size,
+                                                                 kernel_size, ih0, iw0);
+                    continue;
+                }
+                const float* window = input + ih0 * input_size + iw0;
+                out[oh * output_size + ow] = kernel_size == 3
+                    ? snn_conv_interior_3x3(window, kernel, bias, in_channels, input_size)
+                    : snn_conv_interior(window, kernel, bias, in_channels, input_size, kernel_size);
+            }
+        }
+    }
+}
+
+// Body of snn_conv2d(): the whole map as one tile
+SNN_CONV_INLINE void snn_conv2d_body(const float* input, float* output, const float* weights, const float* biases,
+                                     int in_channels, int out_channels, int input_size, int kernel_size, int stride,
+                                     int padding) {
+    snn_conv2d_tile_body(input, output, weights, biases, in_channels, input_size, kernel_size, stride, padding, 0,
+                         out_channels, 0, snn_conv_output_size(input_size, kernel_size, stride, padding));
+}
+
+SNN_CONV_INLINE void snn_conv_fill_biases(float* output, const float* biases, int out_channels, int out_map_size) {
+    for (int oc = 0; oc < out_channels; ++oc) {
+        float bias = biases != NULL ? biases[oc] : 0;
+        for (int i = 0; i < out_map_size; ++i) {
+            output[oc * out_map_size + i] = bias;
+        }
+    }
+}
+
+// Add the kernel patch of every event of input channel ic, weighted by
+// its value in channel, to each output channel
+SNN_CONV_INLINE void snn_conv_scatter(const uint16_t* events, int num_events, const float* channel, float* output,
+                                      const float* weights, int ic, int in_channels, int out_channels,
+                                      int input_size, int kernel_size, int stride, int padding) {
+    int output_size = snn_conv_output_size(input_size, kernel_size, stride, padding);
+    int out_map_size = output_size * output_size;
+    int taps = kernel_size * kernel_size;
+
+    for (int oc = 0; oc < out_channels; ++oc) {
+        const float* kernel = weights + (oc * in_channels + ic) * taps;
+        float* out = output + oc * out_map_size;
+
+        for (int e = 0; e < num_events; ++e) {
+            int ih = events[e] / input_size;
+            int iw = events[e] % input_size;
+            float value = channel[events[e]];
+
+            for (int kh = 0; kh < kernel_size; ++kh) {
+                int oh = ih + padding - kh;
+                if (oh < 0 || oh % stride != 0 || oh / stride >= output_size) continue;
+                oh /= stride;
+                for (int kw = 0; kw < kernel_size; ++kw) {
+                    int ow = iw + padding - kw;
+                    if (ow < 0 || ow % stride != 0 || ow / stride >= output_size) continue;
+                    ow /= stride;
+                    out[oh * output_size + ow] += value * kernel[kh * kernel_size + kw];
+                }
+            }
+        }
+    }
+}
+
+// snn_conv_scatter() for unit spikes: a spike only selects weights, so the
+// patch is accumulated without a multiply (an AC per tap instead of a MAC)
+SNN_CONV_INLINE void snn_conv_accumulate(const uint16_t* events, int num_events, float* output,
+                                         const float* weights, int ic, int in_channels, int out_channels,
+                                         int input_size, int kernel_size, int stride, int padding) {
+    int output_size = snn_conv_output_size(input_size, kernel_size, stride, padding);
+    int out_map_size = output_size * output_size;
+    int taps = kernel_size * kernel_size;
+
+    for (int oc = 0; oc < out_channels; ++oc) {
+        const float* kernel = weights + (oc * in_channels + ic) * taps;
+        float* out = output + oc * out_map_size;
+
+        for (int e = 0; e < num_events; ++e) {
+            int ih = events[e] / input_size;
+            int iw = events[e] % input_size;
+
+            for (int kh = 0; kh < kernel_size; ++kh) {
+                int oh = ih + padding - kh;
+                if (oh < 0 || oh % stride != 0 || oh / stride >= output_size) continue;
+                oh /= stride;
+                for (int kw = 0; kw < kernel_size; ++kw) {
+                    int ow = iw + padding - kw;
+                    if (ow < 0 || ow % stride != 0 || ow / stride >= output_size) continue;
+                    ow /= stride;
+                    out[oh * output_size + ow] += kernel[kh * kernel_size + kw];
+                }
+            }
+        }
+    }
+}
+
+// Body of snn_conv2d_spikes()
+SNN_CONV_INLINE void snn_conv2d_spikes_body(const SNNSpikeWord* input, float* output, const float* weights,
+                                            const float* biases, int in_channels, int out_channels, int input_size,
+                                            int kernel_size, int stride, int padding) {
+    int output_size = snn_conv_output_size(input_size, kernel_size, stride, padding);
+    int map_size = input_size * input_size;
+    uint16_t events[SNN_EVENT_MAP_SIZE];
+
+    snn_conv_fill_biases(output, biases, out_channels, output_size * output_size);
+
+    for (int ic = 0; ic < in_channels; ++ic) {
+        int num_events = snn_spikes_gather(input, ic * map_size, map_size, events);
+        if (num_events == 0) continue;
+
+        snn_conv_accumulate(events, num_events, output, weights, ic, in_channels, out_channels, input_size,
+                            kernel_size, stride, padding);
+    }
+}
+
+// Output channels [0, out_channels) of one fixed convolution shape
+typedef void (*SNNConvFn)(const float* input, float* output, const float* weights, const float* biases,
+                          int out_channels);
+typedef void (*SNNSpikeConvFn)(const SNNSpikeWord* input, float* output, const float* weights,
+                               const float* biases, int out_channels);
+
+// The specialised kernels of one layer shape. A network only runs them on a
+// layer of exactly that shape (see snn_network_weights()).
+typedef struct {
+    SNNConvFn dense;            // snn_conv2d() of this shape, or NULL
+    SNNSpikeConvFn spikes;      // snn_conv2d_spikes() of this shape, or NULL
+    int in_channels;
+    int input_size;
+    int kernel_size;
+    int stride;
+    int padding;
+} SNNConvKernel;
+
+// Define the SNNConvKernel name, running snn_conv2d() on float input of
+// the given shape as name_conv2d()
+#define SNN_SPECIALIZE_CONV2D(name, in, size, kernel, stride, padding)                                        \
+    SNN_PLACE_CONV2D_SPECIALIZED                                                                              \
+    static SNN_SPECIALIZED void name##_conv2d(const float* input, float* output, const float* weights,       \
+                                              const float* biases, int out_channels) {                        \
+        snn_conv2d_body(input, output, weights, biases, (in), out_channels, (size), (kernel), (stride),      \
+                        (padding));                                                                           \
+    }                                                                                                         \
+    static const SNNConvKernel name = { name##_conv2d, NULL, (in), (size), (kernel), (stride), (padding) }
+
+// As SNN_SPECIALIZE_CONV2D(), running snn_conv2d_spikes() on packed spike
+// input as name_conv2d_spikes()
+#define SNN_SPECIALIZE_CONV2D_SPIKES(name, in, size, kernel, stride, padding)                                 \
+    SNN_PLACE_CONV2D_SPECIALIZED                                                                              \
+    static SNN_SPECIALIZED void name##_conv2d_spikes(const SNNSpikeWord* input, float* output,               \
+                                                     const float* weights, const float* biases,              \
+                                                     int out_channels) {                                      \
+        snn_conv2d_spikes_body(input, output, weights, biases, (in), out_channels, (size), (kernel),         \
+                               (stride), (padding));                                                          \
+    }                                                                                                         \
+    static const SNNConvKernel name = { NULL, name##_conv2d_spikes, (in), (size), (kernel), (stride), (padding) }
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // SNN_SPECIALIZE_H
@@ -0,0 +1,42 @@
+#ifndef SNN_SPIKES_H
+#define SNN_SPIKES_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Packed spike tensor: one bit per neuron, 32 neurons per word, in the same
+// channel-major order as a float tensor (element i is bit i % 32 of word
+// i / 32), so flattening a pooled map into a linear layer stays free. Bits
+// past the last element are always zero.
+typedef uint32_t SNNSpikeWord;
+
+// Words needed to hold count spikes
+#define SNN_SPIKE_WORDS(count) (((count) + 31) / 32)
+
+static inline int snn_spike_get(const SNNSpikeWord* spikes, int index) {
+    return (spikes[index >> 5] >> (index & 31)) & 1;
+}
+
+static inline void snn_spike_set(SNNSpikeWord* spikes, int index) {
+    spikes[index >> 5] |= (SNNSpikeWord)1 << (index & 31);
+}
+
+// Convert between float maps (non-zero is a spike) and packed spikes
+void snn_spikes_pack(const float* input, SNNSpikeWord* spikes, int count);
+void snn_spikes_unpack(const SNNSpikeWord* spikes, float* output, int count);
+
+// Number of spikes in the first count elements
+int snn_spikes_count(const SNNSpikeWord* spikes, int count);
+
+// Write the positions of the spikes among elements [first, first + count),
+// relative to first and in increasing order, and return how many there are
+int snn_spikes_gather(const SNNSpikeWord* spikes, int first, int count, uint16_t* positions);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // SNN_SPIKES_H
@@ -0,0 +1,67 @@
+#ifndef SNN_STREAM_H
+#define SNN_STREAM_H
+
+#include <stddef.h>
+#include "snn_network.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Row-streaming execution of a single-step network. The convolution and
+// pooling layers in front of the first linear layer never hold a whole
+// map: each keeps a ring of the kernel_size input rows its next output row
+// reads, and computes that row as soon as the last of them arrives,
+// pushing it into the ring of the layer after it. Only the map that feeds
+// the linear layers is stored whole. Activation memory is then a few rows
+// of every layer, O(width x channels), instead of whole maps, and
+// inference starts with the first input row. Spiking rows stay packed.
+//
+// Streamed layers run the direct convolution on float weights, so the
+// outputs match snn_network_run() of the network without Winograd or OHWI
+// kernels; int8 and codebook networks cannot stream. Multi-step runs
+// re-read the whole input every step and cannot stream either.
+typedef struct {
+    const SNNNetwork* network;
+    int stream_layers;                  // layers [0, stream_layers) run row by row
+    uint8_t* memory;
+    size_t ring_offsets[SNN_MAX_LAYERS];// kernel_size input rows of streamed layer l
+    size_t row_bytes[SNN_MAX_LAYERS];   // one input row of streamed layer l, all channels
+    int input_packed[SNN_MAX_LAYERS];   // layer l reads packed spikes
+    int rows_in[SNN_MAX_LAYERS];        // input rows streamed layer l has received
+    int rows_out[SNN_MAX_LAYERS];       // output rows it has computed
+    size_t map_offset;                  // output of the last streamed layer, whole
+    size_t staging_offset;              // one output row on its way into the map
+    size_t currents_offset;             // one channel of a packed row, or the linear layers' currents
+    size_t tail_offsets[2];             // linear layer outputs, alternating
+    size_t size;                        // bytes of memory
+} SNNStream;
+
+// Bytes of memory snn_stream_begin() needs for the network; 0 if it
+// cannot stream
+size_t snn_stream_memory_size(const SNNNetwork* network);
+
+// Start a streamed inference in memory (SNN_ARENA_ALIGNMENT aligned, at
+// least snn_stream_memory_size() bytes). Returns 0, or -1 if the network
+// cannot stream or memory_size is too small.
+int snn_stream_begin(SNNStream* stream, const SNNNetwork* network, void* memory, size_t memory_size);
+
+// Feed the next input row, [in_channels][input_size] floats of the first
+// layer, running every layer row that becomes computable
+void snn_stream_push_row(SNNStream* stream, const float* row);
+
+// After every input row: run the linear layers and decode. result holds
+// the outputs (in memory) and prediction; tick and synapse counts are 0.
+// Returns the predicted class.
+int snn_stream_finish(SNNStream* stream, SNNRunResult* result);
+
+// Stream a whole CHW input; returns the predicted class, or -1 as
+// snn_stream_begin()
+int snn_stream_run(const SNNNetwork* network, const float* input, void* memory, size_t memory_size,
+                   SNNRunResult* result);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // SNN_STREAM_H
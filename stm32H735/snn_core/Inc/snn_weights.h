@@ -0,0 +1,130 @@
+#ifndef SNN_WEIGHTS_H
+#define SNN_WEIGHTS_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "snn_network.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Where the float weights of a network are read from. Without a source
+// (SNNNetwork.weight_source NULL) the kernels read the layer table's
+// arrays in place, as from internal flash. With one, every chunk of output
+// channels a layer step computes first asks the source for its weights:
+//   mapped  memory the core can address directly, such as internal flash
+//           or OctoSPI in memory-mapped (XIP) mode; the kernels read the
+//           weights in place
+//   copy    the chunk is copied into a RAM staging buffer and the kernels
+//           read the copy, so weights re-read for every output pixel come
+//           from SRAM instead of a slow memory
+//   prefetch  a copying source that splits staging in two and has an
+//           SNNAsyncCopy fill one half with the chunk the executor will ask
+//           for next while the kernels read the other
+// Backends with other costs, such as the host's file-backed source with
+// injected latency (Bench/bench_weight_file.h), set read themselves.
+//
+// Only layer->weights go through the source. Biases, and the Winograd,
+// OHWI, int8, codebook and sparse tables, which are derived copies kept in
+// internal flash, are read in place; snn_stream_run() reads in place too.
+// A copy engine running beside the core: MDMA on the board (snn_mdma.h),
+// a helper thread on the host. At most one copy is in flight.
+typedef struct SNNAsyncCopy SNNAsyncCopy;
+struct SNNAsyncCopy {
+    void (*start)(SNNAsyncCopy* copy, void* destination, const void* source, size_t bytes);
+    void (*wait)(SNNAsyncCopy* copy);   // until the copy in flight completes
+    uint32_t (*clock)(void);            // ticks for the prefetch stats, or NULL
+    volatile uint32_t finished;         // clock when the last copy completed, set by the backend
+    void* context;                      // backend state
+};
+
+// Copies a prefetching source made for one layer. copy_ticks run from the
+// start of each copy to its completion and stall_ticks count the time the
+// kernels waited for it, so copy_ticks - stall_ticks were hidden behind
+// compute. Copies the executor did not ask for next are made on demand
+// and hide nothing.
+typedef struct {
+    uint32_t copies;
+    uint32_t bytes;
+    uint32_t copy_ticks;
+    uint32_t stall_ticks;
+} SNNPrefetchStats;
+
+struct SNNWeightSource {
+    // Make bytes of weights at address readable and return where: address
+    // itself, or staging holding a copy
+    const void* (*read)(SNNWeightSource* source, const void* address, size_t bytes);
+    void* staging;              // RAM a copying source fills, NULL for a mapped one
+    size_t staging_bytes;       // no chunk is larger, see snn_weights_channel_bytes()
+    void* context;              // backend state
+    const void* staged;         // weights staging holds, so a batch reads a chunk once
+    size_t staged_bytes;
+    uint32_t reads;             // chunks read, a staged chunk counting once
+    uint32_t read_bytes;
+    // Prefetching sources only
+    SNNAsyncCopy* async;
+    const SNNNetwork* network;  // whose layers the chunks are predicted from
+    void* current;              // half of staging the kernels read, holding staged
+    const void* pending;        // weights in flight to the other half, or NULL
+    size_t pending_bytes;
+    int pending_layer;
+    uint32_t pending_start;
+    SNNPrefetchStats stats[SNN_MAX_LAYERS];
+};
+
+// A mapped source: internal flash, or OctoSPI once memory-mapped
+void snn_weights_mapped(SNNWeightSource* source);
+
+// A copying source staging every chunk in staging_bytes of RAM
+void snn_weights_copy(SNNWeightSource* source, void* staging, size_t staging_bytes);
+
+// A prefetching source for network, double-buffering staging_bytes of
+// staging (each half at least snn_weights_channel_bytes()) through async.
+// After each chunk it starts copying the next chunk of the layer, or the
+// first of the next layer reading through the source, wrapping to the
+// first layer for the next timestep or inference.
+void snn_weights_prefetch(SNNWeightSource* source, void* staging, size_t staging_bytes, SNNAsyncCopy* async,
+                          const SNNNetwork* network);
+
+// Wait for a prefetch still in flight, as before staging is released or
+// the weights behind it change
+void snn_weights_finish(SNNWeightSource* source);
+
+// The weights of count output channels of layer starting at first,
+// through source
+const float* snn_weights_fetch(SNNWeightSource* source, const SNNLayer* layer, int first, int count);
+
+// Bytes of weights source stages at once: half the staging of a
+// prefetching source in whole cache lines, SIZE_MAX for a mapped one
+size_t snn_weights_chunk_bytes(const SNNWeightSource* source);
+
+// Output channels of layer whose weights fit the staging of source at
+// once; all of them for a mapped source
+int snn_weights_chunk(const SNNWeightSource* source, const SNNLayer* layer);
+
+// Smallest chunk a copying source must stage for network: the float
+// weights of one output channel of its largest layer
+size_t snn_weights_channel_bytes(const SNNNetwork* network);
+
+// Weight image: the float weights of every weighted layer, in layer order,
+// as a file or an external memory holds them. Writing it returns -1 if a
+// weighted layer of network has no float weights.
+size_t snn_weights_image_size(const SNNNetwork* network);
+int snn_weights_image_write(const SNNNetwork* network, void* image);
+
+// network reading its float weights from image through source (NULL to
+// read the image in place): layers (network->num_layers entries) receive
+// the layer table pointed into image. network may leave its float weights
+// NULL, as a build whose weights only live in external memory does. The
+// int8, codebook, Winograd, OHWI and sparse tables are dropped so that
+// every weighted layer reads the image. Returns 0, or -1 if image_size
+// does not match.
+int snn_network_rebase(const SNNNetwork* network, const void* image, size_t image_size, SNNLayer* layers,
+                       SNNWeightSource* source, SNNNetwork* rebased);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // SNN_WEIGHTS_H
@@ -0,0 +1,40 @@
+#ifndef SNN_WINOGRAD_H
+#define SNN_WINOGRAD_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Winograd F(2x2,3x3) for 3x3 stride-1 convolutions: every 2x2 block of
+// outputs comes from a 4x4 input tile in 16 multiplies per input channel
+// instead of 36. Kernels are transformed once, offline (U = G g G^T); each
+// input tile is transformed once per step (V = B^T d B) and shared by all
+// output channels; the 16 products of every tile are summed over the input
+// channels and transformed back (Y = A^T M A).
+//
+// Tiles are stored [tile][in_channels][16] and transformed kernels
+// [out][in][16], so the sum over input channels reads both contiguously.
+// Results differ from snn_conv2d() by float rounding.
+
+// Number of 2x2 output tiles along one side of the output
+int snn_winograd_tiles(int input_size, int padding);
+
+// Floats of transformed input snn_winograd_input() writes
+#define SNN_WINOGRAD_INPUT_FLOATS(in_channels, tiles) ((in_channels) * (tiles) * (tiles) * 16)
+
+// Transform [out][in][3][3] kernels into [out][in][16]
+void snn_winograd_weights(const float* weights, float* transformed, int in_channels, int out_channels);
+
+// Transform every 4x4 input tile, reading zeros for the padding
+void snn_winograd_input(const float* input, float* transformed, int in_channels, int input_size, int padding);
+
+// Output channels [0, out_channels) from the transformed input and the
+// transformed kernels of those channels (biases may be NULL)
+void snn_conv2d_winograd(const float* transformed_input, float* output, const float* transformed_weights,
+                         const float* biases, int in_channels, int out_channels, int input_size, int padding);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // SNN_WINOGRAD_H
@@ -0,0 +1,248 @@
+#include "snn_blob.h"
+
+#include <string.h>
+
+// Largest channel count, spatial size and kernel, and largest map in
+// elements, a blob may describe, so that the executor's counts and byte
+// sizes stay inside an int
+#define BLOB_MAX_DIM 65535u
+#define BLOB_MAX_MAP (INT32_MAX / sizeof(float))
+
+static size_t align(size_t bytes) {
+    return (bytes + SNN_BLOB_ALIGNMENT - 1) / SNN_BLOB_ALIGNMENT * SNN_BLOB_ALIGNMENT;
+}
+
+static size_t section_bytes(int count) {
+    return align((size_t)count * sizeof(float));
+}
+
+static int bias_count(const SNNLayer* layer) {
+    return layer->biases != NULL ? layer->out_channels : 0;
+}
+
+static size_t layers_end(int num_layers) {
+    return align(sizeof(SNNBlobHeader) + (size_t)num_layers * sizeof(SNNBlobLayer));
+}
+
+size_t snn_blob_size(const SNNNetwork* network) {
+    size_t size;
+
+    if (network->num_layers < 1 || network->num_layers > SNN_MAX_LAYERS) {
+        return 0;
+    }
+    size = layers_end(network->num_layers);
+    for (int l = 0; l < network->num_layers; ++l) {
+        size += section_bytes(snn_layer_weight_count(&network->layers[l]));
+        size += section_bytes(bias_count(&network->layers[l]));
+    }
+    return size;
+}
+
+// Bitwise CRC-32 (IEEE, reflected): the blob is checked once after
+// programming, too rarely to pay for a table in flash
+static uint32_t crc32(const uint8_t* bytes, size_t count) {
+    uint32_t crc = 0xFFFFFFFFu;
+
+    for (size_t i = 0; i < count; ++i) {
+        crc ^= bytes[i];
+        for (int bit = 0; bit < 8; ++bit) {
+            crc = (crc >> 1) ^ (0xEDB88320u & (0u - (crc & 1u)));
+        }
+    }
+    return ~crc;
+}
+
+// Copy count floats of section into the blob at offset; 0 for an empty one
+static uint32_t write_section(uint8_t* blob, size_t* offset, const float* section, int count) {
+    uint32_t at = (uint32_t)*offset;
+
+    if (count == 0) {
+        return 0;
+    }
+    memcpy(blob + at, section, (size_t)count * sizeof(float));
+    *offset += section_bytes(count);
+    return at;
+}
+
+int snn_blob_write(const SNNNetwork* network, void* blob) {
+    size_t size = snn_blob_size(network);
+    uint8_t* out = blob;
+    SNNBlobHeader* header = blob;
+    SNNBlobLayer* layers = (SNNBlobLayer*)(out + sizeof(SNNBlobHeader));
+    size_t offset = layers_end(network->num_layers);
+
+    if (size == 0) {
+        return -1;
+    }
+    memset(blob, 0, size);
+    for (int l = 0; l < network->num_layers; ++l) {
+        const SNNLayer* layer = &network->layers[l];
+        SNNBlobLayer* record = &layers[l];
+        int weight_count = snn_layer_weight_count(layer);
+
+        if (weight_count > 0 && layer->weights == NULL) {
+            return -1;
+        }
+        record->type = (uint32_t)layer->type;
+        record->in_channels = (uint32_t)layer->in_channels;
+        record->out_channels = (uint32_t)layer->out_channels;
+        record->input_size = (uint32_t)layer->input_size;
+        record->kernel_size = (uint32_t)layer->kernel_size;
+        record->stride = (uint32_t)layer->stride;
+        record->padding = (uint32_t)layer->padding;
+        record->activation = (uint32_t)layer->activation;
+        record->algorithm = (uint32_t)layer->algorithm;
+        record->beta = layer->beta;
+        record->threshold = layer->threshold;
+        record->max_event_rate = layer->max_event_rate;
+        record->weights_count = (uint32_t)weight_count;
+        record->weights_offset = write_section(out, &offset, layer->weights, weight_count);
+        record->biases_count = (uint32_t)bias_count(layer);
+        record->biases_offset = write_section(out, &offset, layer->biases, bias_count(layer));
+    }
+
+    header->magic = SNN_BLOB_MAGIC;
+    header->version = SNN_BLOB_VERSION;
+    header->header_bytes = sizeof(SNNBlobHeader);
+    header->blob_bytes = (uint32_t)size;
+    header->num_layers = (uint32_t)network->num_layers;
+    header->layer_bytes = sizeof(SNNBlobLayer);
+    header->layers_offset = sizeof(SNNBlobHeader);
+    header->timesteps = (uint32_t)network->timesteps;
+    if (network->name != NULL) {
+        strncpy(header->name, network->name, SNN_BLOB_NAME_BYTES - 1);
+    }
+    header->checksum = crc32(out + sizeof(SNNBlobHeader), size - sizeof(SNNBlobHeader));
+    return 0;
+}
+
+// Whether count floats at offset lie inside a blob of blob_bytes; an
+// empty section is always valid
+static int section_fits(uint32_t offset, uint32_t count, uint32_t blob_bytes) {
+    if (count == 0) {
+        return 1;
+    }
+    return offset >= sizeof(SNNBlobHeader) && offset % sizeof(float) == 0 && count <= blob_bytes / sizeof(float) &&
+           offset <= blob_bytes - count * sizeof(float);
+}
+
+static const float* section(const uint8_t* blob, uint32_t offset, uint32_t count) {
+    return count > 0 ? (const float*)(blob + offset) : NULL;
+}
+
+static int dimension(uint32_t value) {
+    return value >= 1 && value <= BLOB_MAX_DIM;
+}
+
+// The layer a record describes, or -1 if its fields are out of range
+static int read_layer(const uint8_t* blob, uint32_t blob_bytes, const SNNBlobLayer* record, SNNLayer* layer) {
+    uint64_t weight_count;
+
+    if (record->type > SNN_LAYER_LINEAR || record->activation > SNN_ACT_LIF_SPIKE_BITS ||
+        record->algorithm > SNN_CONV_TILED) {
+        return -1;
+    }
+    if (!dimension(record->in_channels) || !dimension(record->out_channels) || !dimension(record->input_size) ||
+        !dimension(record->kernel_size) || !dimension(record->stride) || record->padding >= record->kernel_size ||
+        record->kernel_size > record->input_size + 2 * record->padding ||
+        (uint64_t)record->in_channels * record->input_size * record->input_size > BLOB_MAX_MAP ||
+        (uint64_t)record->out_channels * record->input_size * record->input_size > BLOB_MAX_MAP) {
+        return -1;
+    }
+    switch (record->type) {
+    case SNN_LAYER_CONV2D:
+        weight_count = (uint64_t)record->out_channels * record->in_channels * record->kernel_size *
+                       record->kernel_size;
+        break;
+    case SNN_LAYER_LINEAR:
+        if (record->input_size != 1 || record->kernel_size != 1) return -1;
+        weight_count = (uint64_t)record->out_channels * record->in_channels;
+        break;
+    default:
+        if (record->in_channels != record->out_channels) return -1;
+        weight_count = 0;
+        break;
+    }
+    if (weight_count != record->weights_count || (weight_count > 0 && record->weights_offset == 0) ||
+        (record->biases_count != 0 && record->biases_count != record->out_channels) ||
+        !section_fits(record->weights_offset, record->weights_count, blob_bytes) ||
+        !section_fits(record->biases_offset, record->biases_count, blob_bytes)) {
+        return -1;
+    }
+
+    layer->type = (SNNLayerType)record->type;
+    layer->in_channels = (int)record->in_channels;
+    layer->out_channels = (int)record->out_channels;
+    layer->input_size = (int)record->input_size;
+    layer->kernel_size = (int)record->kernel_size;
+    layer->stride = (int)record->stride;
+    layer->padding = (int)record->padding;
+    layer->weights = section(blob, record->weights_offset, record->weights_count);
+    layer->biases = section(blob, record->biases_offset, record->biases_count);
+    layer->activation = (SNNActivation)record->activation;
+    layer->beta = record->beta;
+    layer->threshold = record->threshold;
+    layer->max_event_rate = record->max_event_rate;
+    layer->algorithm = (SNNConvAlgorithm)record->algorithm;
+    return 0;
+}
+
+int snn_blob_load(SNNBlobModel* model, const void* blob, size_t blob_bytes) {
+    const uint8_t* in = blob;
+    const SNNBlobHeader* header = blob;
+    const SNNBlobLayer* records;
+    int packed = 0;
+
+    if (blob == NULL || (uintptr_t)blob % sizeof(float) != 0 || blob_bytes < sizeof(SNNBlobHeader)) {
+        return -1;
+    }
+    if (header->magic != SNN_BLOB_MAGIC || header->version != SNN_BLOB_VERSION ||
+        header->header_bytes != sizeof(SNNBlobHeader) || header->layer_bytes != sizeof(SNNBlobLayer) ||
+        header->blob_bytes < sizeof(SNNBlobHeader) || header->blob_bytes > blob_bytes ||
+        header->num_layers < 1 || header->num_layers > SNN_MAX_LAYERS || header->timesteps < 1 ||
+        memchr(header->name, '\0', SNN_BLOB_NAME_BYTES) == NULL) {
+        return -1;
+    }
+    if (header->layers_offset < sizeof(SNNBlobHeader) || header->layers_offset % sizeof(uint32_t) != 0 ||
+        header->layers_offset > header->blob_bytes ||
+        header->blob_bytes - header->layers_offset < header->num_layers * sizeof(SNNBlobLayer)) {
+        return -1;
+    }
+
+    records = (const SNNBlobLayer*)(in + header->layers_offset);
+    memset(model, 0, sizeof(*model));
+    for (uint32_t l = 0; l < header->num_layers; ++l) {
+        const SNNLayer* layer = &model->layers[l];
+        if (read_layer(in, header->blob_bytes, &records[l], &model->layers[l]) != 0) {
+            return -1;
+        }
+        // Every layer reads what the one before it writes
+        if (l > 0 && snn_layer_input_count(layer) != snn_layer_output_count(layer - 1)) {
+            return -1;
+        }
+        // A convolution on packed spikes gathers each input channel's
+        // events into a buffer of SNN_EVENT_MAP_SIZE on the stack
+        if (packed && layer->type == SNN_LAYER_CONV2D && layer->input_size * layer->input_size > SNN_EVENT_MAP_SIZE) {
+            return -1;
+        }
+        packed = snn_layer_output_packed(layer, packed);
+    }
+    if (model->layers[header->num_layers - 1].activation == SNN_ACT_LIF_SPIKE_BITS) {
+        return -1;
+    }
+
+    model->network.name = header->name;
+    model->network.layers = model->layers;
+    model->network.num_layers = (int)header->num_layers;
+    model->network.timesteps = (int)header->timesteps;
+    return 0;
+}
+
+int snn_blob_verify(const void* blob) {
+    const SNNBlobHeader* header = blob;
+    const uint8_t* in = blob;
+
+    uint32_t crc = crc32(in + sizeof(SNNBlobHeader), header->blob_bytes - sizeof(SNNBlobHeader));
+
+    return crc == header->checksum ? 0 : -1;
+}
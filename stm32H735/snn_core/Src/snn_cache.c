@@ -0,0 +1,93 @@
+#include "snn_cache.h"
+
+#include <stdint.h>
+
+#if defined(SNN_CACHE_ENABLE)
+#include "main.h"
+
+static void region(uint8_t number, uint32_t base, uint8_t size, uint8_t subregions_off, uint8_t tex,
+                   uint8_t cacheable, uint8_t bufferable, uint8_t shareable, uint8_t access, uint8_t exec) {
+    MPU_Region_InitTypeDef init = { 0 };
+
+    init.Enable = MPU_REGION_ENABLE;
+    init.Number = number;
+    init.BaseAddress = base;
+    init.Size = size;
+    init.SubRegionDisable = subregions_off;
+    init.TypeExtField = tex;
+    init.AccessPermission = access;
+    init.DisableExec = exec;
+    init.IsShareable = shareable;
+    init.IsCacheable = cacheable;
+    init.IsBufferable = bufferable;
+    HAL_MPU_ConfigRegion(&init);
+}
+
+void snn_cache_init(void) {
+    HAL_MPU_Disable();
+    // Everything from 0x60000000 to 0xDFFFFFFF; the subregions switched off
+    // leave code, SRAM, peripherals and the system space to the regions
+    // below and the default map
+    region(MPU_REGION_NUMBER0, 0x00000000, MPU_REGION_SIZE_4GB, 0x87, MPU_TEX_LEVEL0, MPU_ACCESS_NOT_CACHEABLE,
+           MPU_ACCESS_NOT_BUFFERABLE, MPU_ACCESS_SHAREABLE, MPU_REGION_NO_ACCESS, MPU_INSTRUCTION_ACCESS_DISABLE);
+    region(MPU_REGION_NUMBER1, FLASH_BANK1_BASE, MPU_REGION_SIZE_1MB, 0x00, MPU_TEX_LEVEL0, MPU_ACCESS_CACHEABLE,
+           MPU_ACCESS_NOT_BUFFERABLE, MPU_ACCESS_NOT_SHAREABLE, MPU_REGION_PRIV_RO_URO,
+           MPU_INSTRUCTION_ACCESS_ENABLE);
+    // 512 KB of 64 KB subregions, the top three beyond the 320 KB of RAM_D1
+    region(MPU_REGION_NUMBER2, D1_AXISRAM_BASE, MPU_REGION_SIZE_512KB, 0xE0, MPU_TEX_LEVEL1, MPU_ACCESS_CACHEABLE,
+           MPU_ACCESS_BUFFERABLE, MPU_ACCESS_NOT_SHAREABLE, MPU_REGION_FULL_ACCESS, MPU_INSTRUCTION_ACCESS_ENABLE);
+    // .eth_descriptors in every STM32H735IGKX_*.ld
+    region(MPU_REGION_NUMBER3, D2_AHBSRAM_BASE, MPU_REGION_SIZE_1KB, 0x00, MPU_TEX_LEVEL1, MPU_ACCESS_NOT_CACHEABLE,
+           MPU_ACCESS_NOT_BUFFERABLE, MPU_ACCESS_SHAREABLE, MPU_REGION_FULL_ACCESS, MPU_INSTRUCTION_ACCESS_DISABLE);
+#if defined(SNN_OSPI_WEIGHTS) || defined(SNN_OSPI_MODEL)
+    region(MPU_REGION_NUMBER4, OCTOSPI1_BASE, MPU_REGION_SIZE_64MB, 0x00, MPU_TEX_LEVEL0, MPU_ACCESS_CACHEABLE,
+           MPU_ACCESS_NOT_BUFFERABLE, MPU_ACCESS_NOT_SHAREABLE, MPU_REGION_PRIV_RO_URO,
+           MPU_INSTRUCTION_ACCESS_DISABLE);
+#endif
+    HAL_MPU_Enable(MPU_PRIVILEGED_DEFAULT);
+
+    SCB_EnableICache();
+    SCB_EnableDCache();
+}
+
+static int dcache_on(void) {
+    return (SCB->CCR & SCB_CCR_DC_Msk) != 0;
+}
+
+// The whole lines covering bytes at address
+#define LINE_MASK ((uint32_t)(SNN_CACHE_LINE_BYTES - 1))
+
+static uint32_t line_start(const void* address) {
+    return (uint32_t)address & ~LINE_MASK;
+}
+
+static int32_t line_bytes(const void* address, size_t bytes) {
+    uint32_t end = ((uint32_t)address + (uint32_t)bytes + LINE_MASK) & ~LINE_MASK;
+    return (int32_t)(end - line_start(address));
+}
+
+void snn_cache_clean(const void* address, size_t bytes) {
+    if (dcache_on() && bytes > 0) {
+        SCB_CleanDCache_by_Addr((uint32_t*)line_start(address), line_bytes(address, bytes));
+    }
+}
+
+void snn_cache_invalidate(void* address, size_t bytes) {
+    if (dcache_on() && bytes > 0) {
+        SCB_InvalidateDCache_by_Addr((void*)line_start(address), line_bytes(address, bytes));
+    }
+}
+#else
+void snn_cache_init(void) {
+}
+
+void snn_cache_clean(const void* address, size_t bytes) {
+    (void)address;
+    (void)bytes;
+}
+
+void snn_cache_invalidate(void* address, size_t bytes) {
+    (void)address;
+    (void)bytes;
+}
+#endif
@@ -0,0 +1,90 @@
+#include "snn_codebook.h"
+
+#include <math.h>
+#include <stddef.h>
+
+#define CODEBOOK_ITERATIONS 30
+
+static int nearest(float value, const float* codebook) {
+    int best = 0;
+    for (int c = 1; c < SNN_CODEBOOK_SIZE; ++c) {
+        if (fabsf(value - codebook[c]) < fabsf(value - codebook[best])) best = c;
+    }
+    return best;
+}
+
+// Centroids that lose all their weights keep their place
+void snn_codebook_fit(const float* weights, int count, float* codebook) {
+    float low = count > 0 ? weights[0] : 0;
+    float high = low;
+
+    for (int i = 1; i < count; ++i) {
+        if (weights[i] < low) low = weights[i];
+        if (weights[i] > high) high = weights[i];
+    }
+    for (int c = 0; c < SNN_CODEBOOK_SIZE; ++c) {
+        codebook[c] = low + (high - low) * c / (SNN_CODEBOOK_SIZE - 1);
+    }
+
+    for (int it = 0; it < CODEBOOK_ITERATIONS; ++it) {
+        double sums[SNN_CODEBOOK_SIZE] = { 0 };
+        int members[SNN_CODEBOOK_SIZE] = { 0 };
+
+        for (int i = 0; i < count; ++i) {
+            int c = nearest(weights[i], codebook);
+            sums[c] += weights[i];
+            ++members[c];
+        }
+        for (int c = 0; c < SNN_CODEBOOK_SIZE; ++c) {
+            if (members[c] > 0) codebook[c] = (float)(sums[c] / members[c]);
+        }
+    }
+}
+
+void snn_codebook_encode(const float* weights, int count, const float* codebook, uint8_t* indices) {
+    for (int i = 0; i < SNN_CODEBOOK_INDEX_BYTES(count); ++i) {
+        indices[i] = 0;
+    }
+    for (int i = 0; i < count; ++i) {
+        indices[i / 2] |= (uint8_t)(nearest(weights[i], codebook) << (i % 2 * 4));
+    }
+}
+
+void snn_codebook_decode(const SNNCodebookWeights* weights, int first, int count, float* decoded) {
+    for (int i = 0; i < count; ++i) {
+        int w = first + i;
+        decoded[i] = weights->codebook[weights->indices[w / 2] >> (w % 2 * 4) & 0xF];
+    }
+}
+
+void snn_linear_codebook(const float* input, float* output, const uint8_t* indices, const float* codebook,
+                         const float* biases, int in_features, int out_features) {
+    for (int of = 0; of < out_features; ++of) {
+        const uint8_t* row = indices + of * in_features / 2;
+        float sum = biases != NULL ? biases[of] : 0;
+        for (int i = 0; i < in_features / 2; ++i) {
+            sum += input[2 * i] * codebook[row[i] & 0xF];
+            sum += input[2 * i + 1] * codebook[row[i] >> 4];
+        }
+        output[of] = sum;
+    }
+}
+
+void snn_linear_spikes_codebook(const SNNSpikeWord* input, float* output, const uint8_t* indices,
+                                const float* codebook, const float* biases, int in_features, int out_features) {
+    int words = SNN_SPIKE_WORDS(in_features);
+
+    for (int of = 0; of < out_features; ++of) {
+        const uint8_t* row = indices + of * in_features / 2;
+        float sum = biases != NULL ? biases[of] : 0;
+        for (int w = 0; w < words; ++w) {
+            SNNSpikeWord bits = input[w];
+            while (bits != 0) {
+                int i = w * 32 + __builtin_ctz(bits);
+                sum += codebook[row[i / 2] >> (i % 2 * 4) & 0xF];
+                bits &= bits - 1;
+            }
+        }
+        output[of] = sum;
+    }
+}
@@ -0,0 +1,640 @@
+#include "snn_kernels.h"
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include "snn_placement.h"
+#include "snn_specialize.h"
+
+#define UNROLL_FACTOR 4
+
+SNN_PLACE_CONV2D
+void snn_conv2d(const float* input, float* output, const float* weights, const float* biases,
+                int in_channels, int out_channels, int input_size, int kernel_size, int stride, int padding) {
+    snn_conv2d_body(input, output, weights, biases, in_channels, out_channels, input_size, kernel_size, stride,
+                    padding);
+}
+
+// Copy the windows of output pixels [first, first + count) into columns,
+// one row of SNN_GEMM_TILE per tap in weight order
+static void im2col(const float* input, float* columns, int first, int count, int in_channels, int input_size,
+                   int kernel_size, int stride, int padding, int output_size) {
+    float* row = columns;
+
+    for (int ic = 0; ic < in_channels; ++ic) {
+        const float* channel = input + ic * input_size * input_size;
+        for (int kh = 0; kh < kernel_size; ++kh) {
+            for (int kw = 0; kw < kernel_size; ++kw) {
+                for (int j = 0; j < count; ++j) {
+                    int ih = (first + j) / output_size * stride + kh - padding;
+                    int iw = (first + j) % output_size * stride + kw - padding;
+                    int inside = ih >= 0 && ih < input_size && iw >= 0 && iw < input_size;
+                    row[j] = inside ? channel[ih * input_size + iw] : 0.0f;
+                }
+                row += SNN_GEMM_TILE;
+            }
+        }
+    }
+}
+
+// out[r][c] for 4 weight rows and 4 columns, 16 sums held in registers
+static void gemm_4x4(const float* weights, const float* columns, int depth, const float* biases, float* output,
+                     int out_map_size) {
+    const float* w0 = weights;
+    const float* w1 = w0 + depth;
+    const float* w2 = w1 + depth;
+    const float* w3 = w2 + depth;
+    float c00 = biases[0], c01 = biases[0], c02 = biases[0], c03 = biases[0];
+    float c10 = biases[1], c11 = biases[1], c12 = biases[1], c13 = biases[1];
+    float c20 = biases[2], c21 = biases[2], c22 = biases[2], c23 = biases[2];
+    float c30 = biases[3], c31 = biases[3], c32 = biases[3], c33 = biases[3];
+
+    for (int k = 0; k < depth; ++k) {
+        const float* x = columns + k * SNN_GEMM_TILE;
+        float x0 = x[0], x1 = x[1], x2 = x[2], x3 = x[3];
+        c00 += w0[k] * x0; c01 += w0[k] * x1; c02 += w0[k] * x2; c03 += w0[k] * x3;
+        c10 += w1[k] * x0; c11 += w1[k] * x1; c12 += w1[k] * x2; c13 += w1[k] * x3;
+        c20 += w2[k] * x0; c21 += w2[k] * x1; c22 += w2[k] * x2; c23 += w2[k] * x3;
+        c30 += w3[k] * x0; c31 += w3[k] * x1; c32 += w3[k] * x2; c33 += w3[k] * x3;
+    }
+
+    float* o0 = output;
+    float* o1 = o0 + out_map_size;
+    float* o2 = o1 + out_map_size;
+    float* o3 = o2 + out_map_size;
+    o0[0] = c00; o0[1] = c01; o0[2] = c02; o0[3] = c03;
+    o1[0] = c10; o1[1] = c11; o1[2] = c12; o1[3] = c13;
+    o2[0] = c20; o2[1] = c21; o2[2] = c22; o2[3] = c23;
+    o3[0] = c30; o3[1] = c31; o3[2] = c32; o3[3] = c33;
+}
+
+// The rows and columns left over from the 4x4 blocks, one sum at a time
+static void gemm_edge(const float* weights, const float* columns, int depth, const float* biases, float* output,
+                      int out_map_size, int rows, int first_column, int columns_count) {
+    for (int r = 0; r < rows; ++r) {
+        for (int c = first_column; c < columns_count; ++c) {
+            float sum = biases[r];
+            for (int k = 0; k < depth; ++k) {
+                sum += weights[r * depth + k] * columns[k * SNN_GEMM_TILE + c];
+            }
+            output[r * out_map_size + c] = sum;
+        }
+    }
+}
+
+SNN_PLACE_CONV2D_GEMM
+void snn_conv2d_gemm(const float* input, float* output, const float* weights, const float* biases,
+                     int in_channels, int out_channels, int input_size, int kernel_size, int stride, int padding,
+                     float* columns) {
+    int output_size = snn_conv_output_size(input_size, kernel_size, stride, padding);
+    int out_map_size = output_size * output_size;
+    int depth = in_channels * kernel_size * kernel_size;
+    float zeros[4] = { 0, 0, 0, 0 };
+
+    for (int first = 0; first < out_map_size; first += SNN_GEMM_TILE) {
+        int count = out_map_size - first < SNN_GEMM_TILE ? out_map_size - first : SNN_GEMM_TILE;
+        int blocked = count & ~3;
+
+        im2col(input, columns, first, count, in_channels, input_size, kernel_size, stride, padding, output_size);
+
+        for (int oc = 0; oc < out_channels; oc += 4) {
+            int rows = out_channels - oc < 4 ? out_channels - oc : 4;
+            const float* row_biases = biases != NULL ? biases + oc : zeros;
+            const float* row_weights = weights + oc * depth;
+            float* out = output + oc * out_map_size + first;
+
+            if (rows < 4) {
+                gemm_edge(row_weights, columns, depth, row_biases, out, out_map_size, rows, 0, count);
+                continue;
+            }
+            for (int c = 0; c < blocked; c += 4) {
+                gemm_4x4(row_weights, columns + c, depth, row_biases, out + c, out_map_size);
+            }
+            gemm_edge(row_weights, columns, depth, row_biases, out, out_map_size, rows, blocked, count);
+        }
+    }
+}
+
+SNN_PLACE_CONV2D_HWC
+void snn_chw_to_hwc(const float* input, float* output, int channels, int size) {
+    int map_size = size * size;
+
+    for (int i = 0; i < map_size; ++i) {
+        for (int c = 0; c < channels; ++c) {
+            output[i * channels + c] = input[c * map_size + i];
+        }
+    }
+}
+
+void snn_weights_to_ohwi(const float* weights, float* ohwi, int in_channels, int out_channels, int kernel_size) {
+    int taps = kernel_size * kernel_size;
+
+    for (int oc = 0; oc < out_channels; ++oc) {
+        for (int tap = 0; tap < taps; ++tap) {
+            for (int ic = 0; ic < in_channels; ++ic) {
+                ohwi[(oc * taps + tap) * in_channels + ic] = weights[(oc * in_channels + ic) * taps + tap];
+            }
+        }
+    }
+}
+
+// Whole kernel rows and columns that fall in the padding are skipped, so
+// only the contiguous channel runs of valid taps are visited
+SNN_PLACE_CONV2D_HWC
+void snn_conv2d_hwc(const float* input, float* output, const float* weights, const float* biases,
+                    int in_channels, int out_channels, int input_size, int kernel_size, int stride, int padding) {
+    int output_size = snn_conv_output_size(input_size, kernel_size, stride, padding);
+    int run = kernel_size * in_channels;
+
+    for (int oc = 0; oc < out_channels; ++oc) {
+        const float* kernel = weights + oc * kernel_size * run;
+        float bias = biases != NULL ? biases[oc] : 0;
+        float* out = output + oc * output_size * output_size;
+
+        for (int oh = 0; oh < output_size; ++oh) {
+            int ih0 = oh * stride - padding;
+            int kh0 = ih0 < 0 ? -ih0 : 0;
+            int kh1 = input_size - ih0 < kernel_size ? input_size - ih0 : kernel_size;
+
+            for (int ow = 0; ow < output_size; ++ow) {
+                int iw0 = ow * stride - padding;
+                int kw0 = iw0 < 0 ? -iw0 : 0;
+                int kw1 = input_size - iw0 < kernel_size ? input_size - iw0 : kernel_size;
+                int length = (kw1 - kw0) * in_channels;
+                float sum = bias;
+
+                // Valid taps of one kernel row are adjacent pixels, so their
+                // channels form a single contiguous run in input and kernel
+                for (int kh = kh0; kh < kh1; ++kh) {
+                    const float* x = input + ((ih0 + kh) * input_size + iw0 + kw0) * in_channels;
+                    const float* w = kernel + kh * run + kw0 * in_channels;
+                    for (int i = 0; i < length; ++i) {
+                        sum += x[i] * w[i];
+                    }
+                }
+                out[oh * output_size + ow] = sum;
+            }
+        }
+    }
+}
+
+// Visiting events channel by channel in raster order adds every output's
+// contributions in the same (ic, kh, kw) order as snn_conv2d(); the skipped
+// terms are exact zeros, so the sums match exactly.
+SNN_PLACE_CONV2D_EVENTS
+void snn_conv2d_events(const float* input, float* output, const float* weights, const float* biases,
+                       int in_channels, int out_channels, int input_size, int kernel_size, int stride, int padding) {
+    int output_size = snn_conv_output_size(input_size, kernel_size, stride, padding);
+    int map_size = input_size * input_size;
+    uint16_t events[SNN_EVENT_MAP_SIZE];
+
+    snn_conv_fill_biases(output, biases, out_channels, output_size * output_size);
+
+    for (int ic = 0; ic < in_channels; ++ic) {
+        const float* channel = input + ic * map_size;
+        int num_events = 0;
+
+        for (int i = 0; i < map_size; ++i) {
+            if (channel[i] != 0) {
+                events[num_events++] = (uint16_t)i;
+            }
+        }
+        if (num_events == 0) continue;
+
+        snn_conv_scatter(events, num_events, channel, output, weights, ic, in_channels, out_channels,
+                         input_size, kernel_size, stride, padding);
+    }
+}
+
+SNN_PLACE_CONV2D_SPIKES
+void snn_conv2d_spikes(const SNNSpikeWord* input, float* output, const float* weights, const float* biases,
+                       int in_channels, int out_channels, int input_size, int kernel_size, int stride, int padding) {
+    snn_conv2d_spikes_body(input, output, weights, biases, in_channels, out_channels, input_size, kernel_size,
+                           stride, padding);
+}
+
+// As in snn_conv2d(), only the columns whose window crosses the left or
+// right padding check their taps, and 3x3 windows clear of the padding are
+// unrolled
+void snn_conv2d_row(const float* const* rows, float* output, const float* weights, const float* biases,
+                    int in_channels, int out_channels, int input_size, int kernel_size, int stride, int padding) {
+    int output_size = snn_conv_output_size(input_size, kernel_size, stride, padding);
+    int taps = kernel_size * kernel_size;
+    int full = kernel_size == 3 && rows[0] != NULL && rows[1] != NULL && rows[2] != NULL;
+    int first;
+    int end;
+
+    snn_conv_interior_range(input_size, kernel_size, stride, padding, output_size, &first, &end);
+
+    for (int oc = 0; oc < out_channels; ++oc) {
+        const float* kernel = weights + oc * in_channels * taps;
+        for (int ow = 0; ow < output_size; ++ow) {
+            int iw0 = ow * stride - padding;
+            int interior = ow >= first && ow < end;
+            float sum = biases != NULL ? biases[oc] : 0;
+            if (full && interior) {
+                for (int ic = 0; ic < in_channels; ++ic) {
+                    const float* r0 = rows[0] + ic * input_size + iw0;
+                    const float* r1 = rows[1] + ic * input_size + iw0;
+                    const float* r2 = rows[2] + ic * input_size + iw0;
+                    const float* k = kernel + ic * 9;
+                    sum += r0[0] * k[0];
+                    sum += r0[1] * k[1];
+                    sum += r0[2] * k[2];
+                    sum += r1[0] * k[3];
+                    sum += r1[1] * k[4];
+                    sum += r1[2] * k[5];
+                    sum += r2[0] * k[6];
+                    sum += r2[1] * k[7];
+                    sum += r2[2] * k[8];
+                }
+                output[oc * output_size + ow] = sum;
+                continue;
+            }
+            for (int ic = 0; ic < in_channels; ++ic) {
+                for (int kh = 0; kh < kernel_size; ++kh) {
+                    if (rows[kh] == NULL) continue;
+                    const float* row = rows[kh] + ic * input_size + iw0;
+                    const float* k = kernel + ic * taps + kh * kernel_size;
+                    for (int kw = 0; kw < kernel_size; ++kw) {
+                        if (interior || (iw0 + kw >= 0 && iw0 + kw < input_size)) {
+                            sum += row[kw] * k[kw];
+                        }
+                    }
+                }
+            }
+            output[oc * output_size + ow] = sum;
+        }
+    }
+}
+
+// Each spike adds its taps to every output it reaches, in input order,
+// which per output is the tap order of snn_conv2d_row()
+void snn_conv2d_spikes_row(const SNNSpikeWord* const* rows, float* output, const float* weights,
+                           const float* biases, int in_channels, int out_channels, int input_size, int kernel_size,
+                           int stride, int padding) {
+    int output_size = snn_conv_output_size(input_size, kernel_size, stride, padding);
+    int taps = kernel_size * kernel_size;
+
+    snn_conv_fill_biases(output, biases, out_channels, output_size);
+
+    for (int ic = 0; ic < in_channels; ++ic) {
+        for (int kh = 0; kh < kernel_size; ++kh) {
+            if (rows[kh] == NULL) continue;
+            for (int iw = 0; iw < input_size; ++iw) {
+                int bit = ic * input_size + iw;
+                SNNSpikeWord rest = rows[kh][bit >> 5] >> (bit & 31);
+                if (rest == 0) {
+                    // No spike up to the end of the word
+                    iw += 31 - (bit & 31);
+                    continue;
+                }
+                if (!(rest & 1)) {
+                    iw += __builtin_ctz(rest) - 1;
+                    continue;
+                }
+                // Taps [low, high] in steps of stride reach outputs first_ow, first_ow - 1, ...
+                int reach = iw + padding;
+                int low = reach - (output_size - 1) * stride > 0 ? reach - (output_size - 1) * stride : 0;
+                int high = reach < kernel_size - 1 ? reach : kernel_size - 1;
+                low += (reach - low) % stride;
+                int first_ow = (reach - low) / stride;
+                for (int oc = 0; oc < out_channels; ++oc) {
+                    const float* k = weights + (oc * in_channels + ic) * taps + kh * kernel_size;
+                    float* out = output + oc * output_size;
+                    for (int kw = low, ow = first_ow; kw <= high; kw += stride, --ow) {
+                        out[ow] += k[kw];
+                    }
+                }
+            }
+        }
+    }
+}
+
+void snn_maxpool2d_row(const float* const* rows, float* output, int channels, int input_size, int kernel_size,
+                       int stride) {
+    int output_size = snn_conv_output_size(input_size, kernel_size, stride, 0);
+
+    for (int c = 0; c < channels; ++c) {
+        for (int ow = 0; ow < output_size; ++ow) {
+            int iw = ow * stride;
+            float max_value = rows[0][c * input_size + iw];
+            for (int kh = 0; kh < kernel_size; ++kh) {
+                if (rows[kh] == NULL) continue;
+                for (int kw = 0; kw < kernel_size && iw + kw < input_size; ++kw) {
+                    float value = rows[kh][c * input_size + iw + kw];
+                    if (value > max_value) {
+                        max_value = value;
+                    }
+                }
+            }
+            output[c * output_size + ow] = max_value;
+        }
+    }
+}
+
+void snn_maxpool2d_spikes_row(const SNNSpikeWord* const* rows, SNNSpikeWord* output, int channels, int input_size,
+                              int kernel_size, int stride) {
+    int output_size = snn_conv_output_size(input_size, kernel_size, stride, 0);
+
+    memset(output, 0, SNN_SPIKE_WORDS(channels * output_size) * sizeof(SNNSpikeWord));
+    for (int c = 0; c < channels; ++c) {
+        for (int ow = 0; ow < output_size; ++ow) {
+            int spike = 0;
+            for (int kh = 0; kh < kernel_size && !spike; ++kh) {
+                if (rows[kh] == NULL) continue;
+                for (int kw = 0; kw < kernel_size && ow * stride + kw < input_size && !spike; ++kw) {
+                    spike = snn_spike_get(rows[kh], c * input_size + ow * stride + kw);
+                }
+            }
+            if (spike) {
+                snn_spike_set(output, c * output_size + ow);
+            }
+        }
+    }
+}
+
+int snn_count_nonzero(const float* input, int size) {
+    int count = 0;
+    for (int i = 0; i < size; ++i) {
+        count += input[i] != 0;
+    }
+    return count;
+}
+
+SNN_PLACE_MAXPOOL2D
+void snn_maxpool2d(const float* input, float* output, int in_channels, int input_size, int kernel_size, int stride) {
+    int output_size = snn_conv_output_size(input_size, kernel_size, stride, 0);
+
+    for (int ic = 0; ic < in_channels; ++ic) {
+        for (int oh = 0; oh < output_size; ++oh) {
+            for (int ow = 0; ow < output_size; ++ow) {
+                int ih = oh * stride;
+                int iw = ow * stride;
+                float max_value = input[ic * input_size * input_size + ih * input_size + iw];
+                for (int kh = 0; kh < kernel_size; ++kh) {
+                    for (int kw = 0; kw < kernel_size; ++kw) {
+                        int nih = ih + kh;
+                        int niw = iw + kw;
+                        if (nih < input_size && niw < input_size) {
+                            float value = input[ic * input_size * input_size + nih * input_size + niw];
+                            if (value > max_value) {
+                                max_value = value;
+                            }
+                        }
+                    }
+                }
+                output[ic * output_size * output_size + oh * output_size + ow] = max_value;
+            }
+        }
+    }
+}
+
+// Gather the even bits of x into its low half: bit 2i moves to bit i
+static SNNSpikeWord compress_even_bits(SNNSpikeWord x) {
+    x &= 0x55555555u;
+    x = (x | (x >> 1)) & 0x33333333u;
+    x = (x | (x >> 2)) & 0x0F0F0F0Fu;
+    x = (x | (x >> 4)) & 0x00FF00FFu;
+    x = (x | (x >> 8)) & 0x0000FFFFu;
+    return x;
+}
+
+// OR up to 16 bits into a zeroed packed tensor at an arbitrary bit position
+static void put_bits(SNNSpikeWord* output, int position, SNNSpikeWord bits) {
+    int shift = position & 31;
+    output[position >> 5] |= bits << shift;
+    if (shift != 0 && (bits >> (32 - shift)) != 0) {
+        output[(position >> 5) + 1] |= bits >> (32 - shift);
+    }
+}
+
+// With 2x2 windows on an even width the channels are just a run of row
+// pairs: OR the two rows, OR each bit with its right neighbour and keep the
+// even bits. Narrow rows are cut out of their word, wide ones taken a word
+// at a time.
+SNN_PLACE_MAXPOOL2D_SPIKES
+void snn_maxpool2d_spikes(const SNNSpikeWord* input, SNNSpikeWord* output, int in_channels, int input_size,
+                          int kernel_size, int stride) {
+    int output_size = snn_conv_output_size(input_size, kernel_size, stride, 0);
+    int rows = in_channels * input_size;
+    int position = 0;
+
+    memset(output, 0, SNN_SPIKE_WORDS(in_channels * output_size * output_size) * sizeof(SNNSpikeWord));
+
+    if (kernel_size == 2 && stride == 2 && input_size % 32 == 0) {
+        int row_words = input_size / 32;
+        for (int r = 0; r < rows; r += 2) {
+            const SNNSpikeWord* top = input + r * row_words;
+            const SNNSpikeWord* bottom = top + row_words;
+            for (int w = 0; w < row_words; ++w) {
+                SNNSpikeWord pair = top[w] | bottom[w];
+                put_bits(output, position, compress_even_bits(pair | (pair >> 1)));
+                position += 16;
+            }
+        }
+        return;
+    }
+
+    if (kernel_size == 2 && stride == 2 && input_size % 2 == 0 && 32 % input_size == 0) {
+        SNNSpikeWord mask = ((SNNSpikeWord)1 << input_size) - 1;
+        for (int r = 0; r < rows; r += 2) {
+            int bit = r * input_size;
+            SNNSpikeWord top = (input[bit >> 5] >> (bit & 31)) & mask;
+            SNNSpikeWord bottom = (input[(bit + input_size) >> 5] >> ((bit + input_size) & 31)) & mask;
+            SNNSpikeWord pair = top | bottom;
+            put_bits(output, position, compress_even_bits(pair | (pair >> 1)));
+            position += input_size / 2;
+        }
+        return;
+    }
+
+    for (int ic = 0; ic < in_channels; ++ic) {
+        for (int oh = 0; oh < output_size; ++oh) {
+            for (int ow = 0; ow < output_size; ++ow) {
+                int spike = 0;
+                for (int kh = 0; kh < kernel_size && !spike; ++kh) {
+                    for (int kw = 0; kw < kernel_size && !spike; ++kw) {
+                        int ih = oh * stride + kh;
+                        int iw = ow * stride + kw;
+                        if (ih < input_size && iw < input_size) {
+                            spike = snn_spike_get(input, ic * input_size * input_size + ih * input_size + iw);
+                        }
+                    }
+                }
+                if (spike) {
+                    snn_spike_set(output, ic * output_size * output_size + oh * output_size + ow);
+                }
+            }
+        }
+    }
+}
+
+SNN_PLACE_LINEAR
+void snn_linear(const float* input, float* output, const float* weights, const float* biases,
+                int in_features, int out_features) {
+    for (int of = 0; of < out_features; ++of) {
+        float sum = biases != NULL ? biases[of] : 0;
+        int inf;
+        for (inf = 0; inf <= in_features - UNROLL_FACTOR; inf += UNROLL_FACTOR) {
+            sum += input[inf] * weights[of * in_features + inf];
+            sum += input[inf + 1] * weights[of * in_features + inf + 1];
+            sum += input[inf + 2] * weights[of * in_features + inf + 2];
+            sum += input[inf + 3] * weights[of * in_features + inf + 3];
+        }
+        for (; inf < in_features; ++inf) {
+            sum += input[inf] * weights[of * in_features + inf];
+        }
+        output[of] = sum;
+    }
+}
+
+SNN_PLACE_LINEAR_SPIKES
+void snn_linear_spikes(const SNNSpikeWord* input, float* output, const float* weights, const float* biases,
+                       int in_features, int out_features) {
+    int words = SNN_SPIKE_WORDS(in_features);
+
+    for (int of = 0; of < out_features; ++of) {
+        const float* row = weights + of * in_features;
+        float sum = biases != NULL ? biases[of] : 0;
+        for (int w = 0; w < words; ++w) {
+            SNNSpikeWord bits = input[w];
+            while (bits != 0) {
+                sum += row[w * 32 + __builtin_ctz(bits)];
+                bits &= bits - 1;
+            }
+        }
+        output[of] = sum;
+    }
+}
+
+// Add input channel ic's taps to rows [oh_first, oh_end) of output
+// channels [oc_first, oc_end), which already hold the sums of the channels
+// before it. Each output still adds its taps in the order of snn_conv2d().
+static void conv_tile_channel(const float* input, float* output, const float* weights, int ic, int in_channels,
+                              int input_size, int kernel_size, int stride, int padding, int oc_first, int oc_end,
+                              int oh_first, int oh_end) {
+    int output_size = snn_conv_output_size(input_size, kernel_size, stride, padding);
+    int taps = kernel_size * kernel_size;
+    const float* channel = input + ic * input_size * input_size;
+    int first;
+    int end;
+
+    snn_conv_interior_range(input_size, kernel_size, stride, padding, output_size, &first, &end);
+
+    for (int oc = oc_first; oc < oc_end; ++oc) {
+        const float* kernel = weights + (oc * in_channels + ic) * taps;
+        float* out = output + oc * output_size * output_size;
+
+        for (int oh = oh_first; oh < oh_end; ++oh) {
+            int ih0 = oh * stride - padding;
+            int interior = oh >= first && oh < end;
+            float* row = out + oh * output_size;
+
+            for (int ow = 0; ow < output_size; ++ow) {
+                int iw0 = ow * stride - padding;
+                if (!interior || ow < first || ow >= end) {
+                    row[ow] = snn_conv_border(channel, kernel, row[ow], 1, input_size, kernel_size, ih0, iw0);
+                    continue;
+                }
+                const float* window = channel + ih0 * input_size + iw0;
+                row[ow] = kernel_size == 3 ? snn_conv_interior_3x3(window, kernel, row[ow], 1, input_size)
+                                           : snn_conv_interior(window, kernel, row[ow], 1, input_size, kernel_size);
+            }
+        }
+    }
+}
+
+SNN_PLACE_CONV2D_TILED
+void snn_conv2d_tiled(const float* input, float* output, const float* weights, const float* biases,
+                      int in_channels, int out_channels, int input_size, int kernel_size, int stride, int padding,
+                      int tile_channels, int tile_rows) {
+    int output_size = snn_conv_output_size(input_size, kernel_size, stride, padding);
+
+    if (tile_channels >= out_channels && tile_rows >= output_size) {
+        snn_conv2d_body(input, output, weights, biases, in_channels, out_channels, input_size, kernel_size, stride,
+                        padding);
+        return;
+    }
+    for (int oc = 0; oc < out_channels; oc += tile_channels) {
+        int channels_end = oc + tile_channels < out_channels ? oc + tile_channels : out_channels;
+        for (int oh = 0; oh < output_size; oh += tile_rows) {
+            int rows_end = oh + tile_rows < output_size ? oh + tile_rows : output_size;
+            for (int c = oc; c < channels_end; ++c) {
+                float bias = biases != NULL ? biases[c] : 0;
+                float* out = output + (c * output_size + oh) * output_size;
+                for (int i = 0; i < (rows_end - oh) * output_size; ++i) {
+                    out[i] = bias;
+                }
+            }
+            for (int ic = 0; ic < in_channels; ++ic) {
+                conv_tile_channel(input, output, weights, ic, in_channels, input_size, kernel_size, stride, padding,
+                                  oc, channels_end, oh, rows_end);
+            }
+        }
+    }
+}
+
+void snn_conv2d_tiles(int in_channels, int out_channels, int input_size, int kernel_size, int stride, int padding,
+                      size_t cache_bytes, int* tile_channels, int* tile_rows) {
+    int output_size = snn_conv_output_size(input_size, kernel_size, stride, padding);
+    size_t slice_bytes = (size_t)kernel_size * kernel_size * sizeof(float);
+    size_t kernel_bytes = in_channels * slice_bytes;
+    size_t row_bytes = (size_t)input_size * sizeof(float);
+    size_t input_bytes = in_channels * input_size * row_bytes;
+    size_t weight_bytes = out_channels * kernel_bytes;
+    size_t output_bytes = (size_t)out_channels * output_size * output_size * sizeof(float);
+    // Untiled, the input is read again for every output channel unless it
+    // stays in the D-cache beside a kernel
+    size_t best = weight_bytes + output_bytes +
+                  (input_bytes + kernel_bytes <= SNN_L1_DCACHE_BYTES ? input_bytes : input_bytes * out_channels);
+
+    *tile_channels = out_channels;
+    *tile_rows = output_size;
+    for (int rows = 1; rows <= output_size; ++rows) {
+        int band = (rows - 1) * stride + kernel_size;
+        size_t band_bytes = (band < input_size ? band : input_size) * row_bytes;
+        size_t row_tiles = (output_size + rows - 1) / rows;
+
+        for (int channels = 1; channels <= out_channels; ++channels) {
+            size_t tile_bytes = channels * (rows * output_size * sizeof(float) + slice_bytes);
+            if (tile_bytes + band_bytes > cache_bytes) break;
+            // Every row tile reads all the weights, every channel tile the
+            // input bands of all row tiles
+            size_t channel_tiles = (out_channels + channels - 1) / channels;
+            size_t traffic = output_bytes + weight_bytes * row_tiles +
+                             in_channels * band_bytes * row_tiles * channel_tiles;
+            if (traffic < best) {
+                best = traffic;
+                *tile_channels = channels;
+                *tile_rows = rows;
+            }
+        }
+    }
+}
+
+void snn_relu(float* input, int size) {
+    int i;
+    int unrolled_size = size / UNROLL_FACTOR * UNROLL_FACTOR;
+    for (i = 0; i < unrolled_size; i += UNROLL_FACTOR) {
+        if (input[i] < 0) input[i] = 0;
+        if (input[i + 1] < 0) input[i + 1] = 0;
+        if (input[i + 2] < 0) input[i + 2] = 0;
+        if (input[i + 3] < 0) input[i + 3] = 0;
+    }
+    for (; i < size; ++i) {
+        if (input[i] < 0) input[i] = 0;
+    }
+}
+
+int snn_argmax(const float* input, int size) {
+    int index = 0;
+    float max_value = input[0];
+    for (int i = 1; i < size; ++i) {
+        if (input[i] > max_value) {
+            max_value = input[i];
+            index = i;
+        }
+    }
+    return index;
+}
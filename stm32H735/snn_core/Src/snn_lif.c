@@ -0,0 +1,136 @@
+#include "snn_lif.h"
+
+#include <string.h>
+#include "snn_placement.h"
+
+// Function to apply Leaky Integrate and Fire (LIF) neuron update
+SNN_PLACE_LIF
+void snn_update_neuron(LIFNeuron *neuron, float input_current, float beta, float threshold) {
+    neuron->membrane_potential = (beta * neuron->membrane_potential + input_current);
+
+    if (neuron->should_spike) {
+        neuron->membrane_potential = 0;
+        neuron->should_spike = false;
+    } else if (neuron->membrane_potential >= threshold) {
+        neuron->should_spike = true;
+    }
+}
+
+// SNNFixed and float membranes take the same space
+size_t snn_lif_population_bytes(int count) {
+    return (size_t)count * sizeof(float) + SNN_SPIKE_WORDS(count) * sizeof(SNNSpikeWord);
+}
+
+void snn_lif_population_init(LIFPopulation* population, void* memory, int count) {
+    population->membrane = memory;
+    population->fixed_membrane = NULL;
+    population->refractory = (SNNSpikeWord*)(population->membrane + count);
+    population->count = count;
+    memset(memory, 0, snn_lif_population_bytes(count));
+}
+
+void snn_lif_population_init_fixed(LIFPopulation* population, void* memory, int count) {
+    snn_lif_population_init(population, memory, count);
+    population->fixed_membrane = memory;
+    population->membrane = NULL;
+}
+
+static SNNFixed saturate(int64_t value) {
+    if (value > INT32_MAX) return INT32_MAX;
+    if (value < INT32_MIN) return INT32_MIN;
+    return (SNNFixed)value;
+}
+
+// update_word() on Q16.16 membranes. The leak is a 32x32->64 multiply and
+// a shift (SMULL on the M7), so only the current conversion touches floats.
+static SNNSpikeWord update_word_fixed(LIFPopulation* population, int first, const float* input_currents,
+                                      int count, float beta, float threshold, float* membrane_out) {
+    int shift = first & 31;
+    SNNFixed leak = snn_fixed_from_float(beta);
+    SNNFixed limit = snn_fixed_from_float(threshold);
+    SNNFixed* membranes = population->fixed_membrane + first;
+    SNNSpikeWord* word = &population->refractory[first >> 5];
+    SNNSpikeWord refractory = *word >> shift;
+    SNNSpikeWord fired = 0;
+
+    for (int b = 0; b < count; ++b) {
+        int64_t leaked = ((int64_t)membranes[b] * leak) >> SNN_FIXED_FRACTION_BITS;
+        SNNFixed membrane = saturate(leaked + snn_fixed_from_float(input_currents[b]));
+        SNNSpikeWord reset = (refractory >> b) & 1;
+        membranes[b] = reset ? 0 : membrane;
+        fired |= (SNNSpikeWord)(!reset & (membrane >= limit)) << (shift + b);
+        if (membrane_out != NULL) membrane_out[b] = snn_fixed_to_float(membranes[b]);
+    }
+
+    SNNSpikeWord mask = count == 32 ? ~(SNNSpikeWord)0 : (((SNNSpikeWord)1 << count) - 1) << shift;
+    *word = (*word & ~mask) | fired;
+    return fired;
+}
+
+// Update neurons [first, first + count), all within one word of the
+// bitmask, and return their spikes at their bit positions in that word.
+// The reset is a select rather than a branch, so the loop vectorises.
+static SNNSpikeWord update_word(LIFPopulation* population, int first, const float* input_currents, int count,
+                                float beta, float threshold, float* membrane_out) {
+    int shift = first & 31;
+    SNNSpikeWord fired = 0;
+
+    if (population == NULL) {
+        for (int b = 0; b < count; ++b) {
+            float membrane = input_currents[b];
+            fired |= (SNNSpikeWord)(membrane >= threshold) << (shift + b);
+            if (membrane_out != NULL) membrane_out[b] = membrane;
+        }
+        return fired;
+    }
+    if (population->fixed_membrane != NULL) {
+        return update_word_fixed(population, first, input_currents, count, beta, threshold, membrane_out);
+    }
+
+    float* membranes = population->membrane + first;
+    SNNSpikeWord* word = &population->refractory[first >> 5];
+    SNNSpikeWord refractory = *word >> shift;
+
+    for (int b = 0; b < count; ++b) {
+        float membrane = beta * membranes[b] + input_currents[b];
+        SNNSpikeWord reset = (refractory >> b) & 1;
+        membranes[b] = reset ? 0.0f : membrane;
+        fired |= (SNNSpikeWord)(!reset & (membrane >= threshold)) << (shift + b);
+        if (membrane_out != NULL) membrane_out[b] = membranes[b];
+    }
+
+    SNNSpikeWord mask = count == 32 ? ~(SNNSpikeWord)0 : (((SNNSpikeWord)1 << count) - 1) << shift;
+    *word = (*word & ~mask) | fired;
+    return fired;
+}
+
+SNN_PLACE_LIF
+void snn_lif_update_spikes(LIFPopulation* population, int first, const float* input_currents, int count,
+                           float beta, float threshold, SNNSpikeWord* spikes) {
+    for (int i = 0; i < count;) {
+        int neuron = first + i;
+        int chunk = 32 - (neuron & 31);
+        if (chunk > count - i) chunk = count - i;
+        spikes[neuron >> 5] |= update_word(population, neuron, input_currents + i, chunk, beta, threshold, NULL);
+        i += chunk;
+    }
+}
+
+SNN_PLACE_LIF
+void snn_lif_update_values(LIFPopulation* population, int first, float* values, int count,
+                           float beta, float threshold, bool membrane) {
+    for (int i = 0; i < count;) {
+        int neuron = first + i;
+        int shift = neuron & 31;
+        int chunk = 32 - shift;
+        if (chunk > count - i) chunk = count - i;
+        SNNSpikeWord fired = update_word(population, neuron, values + i, chunk, beta, threshold,
+                                         membrane ? values + i : NULL);
+        if (!membrane) {
+            for (int b = 0; b < chunk; ++b) {
+                values[i + b] = (fired >> (shift + b)) & 1 ? 1.0f : 0.0f;
+            }
+        }
+        i += chunk;
+    }
+}
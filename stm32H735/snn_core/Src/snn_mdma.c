@@ -0,0 +1,113 @@
+#include "snn_mdma.h"
+
+#include <string.h>
+#include "snn_cache.h"
+
+#if defined(SNN_MDMA_PREFETCH)
+#include "main.h"
+
+// Largest BlockDataLength of one MDMA block
+#define MDMA_MAX_BLOCK 65536
+
+static MDMA_HandleTypeDef snn_mdma;
+static SNNAsyncCopy* snn_mdma_copy;
+static volatile int snn_mdma_busy;
+static volatile int snn_mdma_failed;
+static void* snn_mdma_destination;
+static const void* snn_mdma_source;
+static size_t snn_mdma_bytes;
+
+static void mdma_complete(MDMA_HandleTypeDef* hmdma) {
+    (void)hmdma;
+    if (snn_mdma_copy->clock != NULL) {
+        snn_mdma_copy->finished = snn_mdma_copy->clock();
+    }
+    snn_mdma_busy = 0;
+}
+
+// A bus error on either side, such as an OctoSPI fault, ends the transfer
+// early; mdma_wait() then copies the chunk on the core
+static void mdma_error(MDMA_HandleTypeDef* hmdma) {
+    (void)hmdma;
+    snn_mdma_failed = 1;
+    snn_mdma_busy = 0;
+}
+
+void MDMA_IRQHandler(void) {
+    HAL_MDMA_IRQHandler(&snn_mdma);
+}
+
+static void mdma_start(SNNAsyncCopy* copy, void* destination, const void* source, size_t bytes) {
+    if (bytes > MDMA_MAX_BLOCK ||
+        HAL_MDMA_Start_IT(&snn_mdma, (uint32_t)source, (uint32_t)destination, (uint32_t)bytes, 1) != HAL_OK) {
+        memcpy(destination, source, bytes);
+        if (copy->clock != NULL) copy->finished = copy->clock();
+        return;
+    }
+    snn_mdma_destination = destination;
+    snn_mdma_source = source;
+    snn_mdma_bytes = bytes;
+    snn_mdma_busy = 1;
+}
+
+static void mdma_wait(SNNAsyncCopy* copy) {
+    while (snn_mdma_busy) {
+    }
+    // Lines of the destination the core read before hold the previous chunk
+    snn_cache_invalidate(snn_mdma_destination, snn_mdma_bytes);
+    if (snn_mdma_failed) {
+        snn_mdma_failed = 0;
+        memcpy(snn_mdma_destination, snn_mdma_source, snn_mdma_bytes);
+        if (copy->clock != NULL) copy->finished = copy->clock();
+    }
+    snn_mdma_bytes = 0;
+}
+
+void snn_mdma_init(SNNAsyncCopy* copy, uint32_t (*clock)(void)) {
+    memset(copy, 0, sizeof(*copy));
+    copy->start = mdma_start;
+    copy->wait = mdma_wait;
+    copy->clock = clock;
+    snn_mdma_copy = copy;
+
+    __HAL_RCC_MDMA_CLK_ENABLE();
+    snn_mdma.Instance = MDMA_Channel0;
+    snn_mdma.Init.Request = MDMA_REQUEST_SW;
+    snn_mdma.Init.TransferTriggerMode = MDMA_BLOCK_TRANSFER;
+    snn_mdma.Init.Priority = MDMA_PRIORITY_HIGH;
+    snn_mdma.Init.Endianness = MDMA_LITTLE_ENDIANNESS_PRESERVE;
+    snn_mdma.Init.SourceInc = MDMA_SRC_INC_WORD;
+    snn_mdma.Init.DestinationInc = MDMA_DEST_INC_WORD;
+    snn_mdma.Init.SourceDataSize = MDMA_SRC_DATASIZE_WORD;
+    snn_mdma.Init.DestDataSize = MDMA_DEST_DATASIZE_WORD;
+    snn_mdma.Init.DataAlignment = MDMA_DATAALIGN_PACKENABLE;
+    snn_mdma.Init.BufferTransferLength = 128;
+    snn_mdma.Init.SourceBurst = MDMA_SOURCE_BURST_32BEATS;
+    snn_mdma.Init.DestBurst = MDMA_DEST_BURST_32BEATS;
+    snn_mdma.Init.SourceBlockAddressOffset = 0;
+    snn_mdma.Init.DestBlockAddressOffset = 0;
+    if (HAL_MDMA_Init(&snn_mdma) != HAL_OK ||
+        HAL_MDMA_RegisterCallback(&snn_mdma, HAL_MDMA_XFER_CPLT_CB_ID, mdma_complete) != HAL_OK ||
+        HAL_MDMA_RegisterCallback(&snn_mdma, HAL_MDMA_XFER_ERROR_CB_ID, mdma_error) != HAL_OK) {
+        Error_Handler();
+    }
+    HAL_NVIC_SetPriority(MDMA_IRQn, 0, 0);
+    HAL_NVIC_EnableIRQ(MDMA_IRQn);
+}
+#else
+static void core_start(SNNAsyncCopy* copy, void* destination, const void* source, size_t bytes) {
+    memcpy(destination, source, bytes);
+    if (copy->clock != NULL) copy->finished = copy->clock();
+}
+
+static void core_wait(SNNAsyncCopy* copy) {
+    (void)copy;
+}
+
+void snn_mdma_init(SNNAsyncCopy* copy, uint32_t (*clock)(void)) {
+    memset(copy, 0, sizeof(*copy));
+    copy->start = core_start;
+    copy->wait = core_wait;
+    copy->clock = clock;
+}
+#endif
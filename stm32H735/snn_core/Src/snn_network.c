@@ -0,0 +1,871 @@
+#include "snn_network.h"
+
+#include <string.h>
+#include "snn_kernels.h"
+#include "snn_plan.h"
+#include "snn_weights.h"
+
+int snn_layer_output_size(const SNNLayer* layer) {
+    switch (layer->type) {
+    case SNN_LAYER_CONV2D:
+        return snn_conv_output_size(layer->input_size, layer->kernel_size, layer->stride, layer->padding);
+    case SNN_LAYER_MAXPOOL2D:
+        return snn_conv_output_size(layer->input_size, layer->kernel_size, layer->stride, 0);
+    default:
+        return 1;
+    }
+}
+
+int snn_layer_input_count(const SNNLayer* layer) {
+    return layer->in_channels * layer->input_size * layer->input_size;
+}
+
+int snn_layer_output_count(const SNNLayer* layer) {
+    int output_size = snn_layer_output_size(layer);
+    return layer->out_channels * output_size * output_size;
+}
+
+int snn_layer_has_neurons(const SNNLayer* layer) {
+    return layer->activation == SNN_ACT_LIF_MEMBRANE || layer->activation == SNN_ACT_LIF_SPIKE ||
+           layer->activation == SNN_ACT_LIF_SPIKE_BITS;
+}
+
+int snn_layer_weight_count(const SNNLayer* layer) {
+    switch (layer->type) {
+    case SNN_LAYER_CONV2D:
+        return layer->out_channels * layer->in_channels * layer->kernel_size * layer->kernel_size;
+    case SNN_LAYER_LINEAR:
+        return layer->out_channels * layer->in_channels;
+    default:
+        return 0;
+    }
+}
+
+int snn_layer_output_packed(const SNNLayer* layer, int input_packed) {
+    if (layer->type == SNN_LAYER_MAXPOOL2D) {
+        return input_packed;
+    }
+    return layer->activation == SNN_ACT_LIF_SPIKE_BITS;
+}
+
+size_t snn_layer_output_bytes(const SNNLayer* layer, int input_packed) {
+    int count = snn_layer_output_count(layer);
+    if (snn_layer_output_packed(layer, input_packed)) {
+        return SNN_SPIKE_WORDS(count) * sizeof(SNNSpikeWord);
+    }
+    return (size_t)count * sizeof(float);
+}
+
+int snn_layer_current_count(const SNNLayer* layer, int input_packed, const SNNLayer* pool) {
+    if (layer->type == SNN_LAYER_MAXPOOL2D || (pool == NULL && !snn_layer_output_packed(layer, input_packed))) {
+        return 0;
+    }
+    if (layer->type == SNN_LAYER_CONV2D) {
+        int output_size = snn_layer_output_size(layer);
+        return output_size * output_size;
+    }
+    return layer->out_channels;
+}
+
+int snn_network_fuses_pool(const SNNNetwork* network, int l) {
+    const SNNLayer* layer = &network->layers[l];
+    const SNNLayer* pool;
+
+    if (l + 1 >= network->num_layers) {
+        return 0;
+    }
+    pool = &network->layers[l + 1];
+    return layer->type == SNN_LAYER_CONV2D && layer->algorithm != SNN_CONV_GEMM &&
+           pool->type == SNN_LAYER_MAXPOOL2D && pool->in_channels == layer->out_channels &&
+           pool->input_size == snn_layer_output_size(layer);
+}
+
+const SNNQuantWeights* snn_network_quantized(const SNNNetwork* network, int l) {
+    if (network->quantized == NULL || network->quantized[l].weights == NULL) {
+        return NULL;
+    }
+    return &network->quantized[l];
+}
+
+int snn_layer_input_q8_count(const SNNLayer* layer, const SNNQuantWeights* quant, int input_packed) {
+    if (quant == NULL || input_packed || layer->type == SNN_LAYER_MAXPOOL2D) {
+        return 0;
+    }
+    return snn_layer_input_count(layer);
+}
+
+SNNLayerWeights snn_network_weights(const SNNNetwork* network, int l) {
+    const SNNLayer* layer = &network->layers[l];
+    SNNLayerWeights weights = { snn_network_quantized(network, l), NULL, NULL, NULL, NULL, NULL, NULL };
+
+    if (weights.quant == NULL && network->codebook != NULL && network->codebook[l].indices != NULL) {
+        weights.codebook = &network->codebook[l];
+    }
+    if (weights.quant == NULL && weights.codebook == NULL && layer->type == SNN_LAYER_LINEAR &&
+        network->sparse != NULL && network->sparse[l].values != NULL) {
+        weights.sparse = &network->sparse[l];
+    }
+    if (weights.quant == NULL && weights.codebook == NULL && weights.sparse == NULL) {
+        weights.source = network->weight_source;
+    }
+    if (weights.quant != NULL || layer->type != SNN_LAYER_CONV2D) {
+        return weights;
+    }
+
+    int direct = weights.codebook == NULL && layer->algorithm == SNN_CONV_DIRECT;
+    if (direct && network->winograd != NULL && layer->kernel_size == 3 && layer->stride == 1) {
+        weights.winograd = network->winograd[l];
+    }
+    if (direct && network->ohwi != NULL && weights.winograd == NULL) {
+        weights.ohwi = network->ohwi[l];
+    }
+    if (network->kernels != NULL && network->kernels[l] != NULL) {
+        const SNNConvKernel* conv = network->kernels[l];
+        if (conv->in_channels == layer->in_channels && conv->input_size == layer->input_size &&
+            conv->kernel_size == layer->kernel_size && conv->stride == layer->stride &&
+            conv->padding == layer->padding) {
+            weights.conv = conv;
+        }
+    }
+    return weights;
+}
+
+int snn_layer_scratch_count(const SNNLayer* layer, const SNNLayerWeights* weights, int input_packed,
+                            const SNNLayer* pool) {
+    if (layer->type == SNN_LAYER_CONV2D && weights->codebook != NULL) {
+        return layer->in_channels * layer->kernel_size * layer->kernel_size;
+    }
+    if (layer->type != SNN_LAYER_CONV2D || weights->quant != NULL || input_packed) {
+        return 0;
+    }
+    if (weights->winograd != NULL) {
+        int tiles = snn_winograd_tiles(layer->input_size, layer->padding);
+        return SNN_WINOGRAD_INPUT_FLOATS(layer->in_channels, tiles);
+    }
+    if (weights->ohwi != NULL) {
+        return snn_layer_input_count(layer);
+    }
+    if (layer->algorithm == SNN_CONV_GEMM && pool == NULL && !snn_layer_output_packed(layer, input_packed)) {
+        return SNN_GEMM_COLUMNS(layer->in_channels, layer->kernel_size);
+    }
+    return 0;
+}
+
+int snn_layer_uses_events(const SNNLayer* layer, const float* input) {
+    int count = snn_layer_input_count(layer);
+
+    if (layer->type != SNN_LAYER_CONV2D || layer->max_event_rate <= 0 ||
+        layer->input_size * layer->input_size > SNN_EVENT_MAP_SIZE) {
+        return 0;
+    }
+    return snn_count_nonzero(input, count) <= layer->max_event_rate * count;
+}
+
+// Output positions along one axis that input position i feeds, per output
+// channel and input channel
+static int conv_fan_out(const SNNLayer* layer, int output_size, int i) {
+    int count = 0;
+    for (int k = 0; k < layer->kernel_size; ++k) {
+        int o = i + layer->padding - k;
+        count += o >= 0 && o % layer->stride == 0 && o / layer->stride < output_size;
+    }
+    return count;
+}
+
+// A MAC per stored weight on float input, an AC per stored weight a spike
+// selects on packed input
+static void count_sparse_synops(const SNNLayer* layer, const SNNSparseWeights* sparse, const void* input,
+                                int input_packed, SNNSynapticOps* ops) {
+    uint32_t first = sparse->row_starts[0];
+    uint32_t end = sparse->row_starts[layer->out_channels];
+
+    if (!input_packed) {
+        ops->macs += (end - first) * SNN_SPARSE_BLOCK;
+        return;
+    }
+    for (uint32_t b = first; b < end; ++b) {
+        for (int i = 0; i < SNN_SPARSE_BLOCK; ++i) {
+            ops->acs += snn_spike_get(input, sparse->columns[b] + i);
+        }
+    }
+}
+
+void snn_layer_count_synops(const SNNLayer* layer, const SNNLayerWeights* weights, const void* input,
+                            int input_packed, SNNSynapticOps* ops) {
+    int input_count = snn_layer_input_count(layer);
+
+    if (layer->type == SNN_LAYER_LINEAR && weights->sparse != NULL) {
+        count_sparse_synops(layer, weights->sparse, input, input_packed, ops);
+        return;
+    }
+    if (layer->type == SNN_LAYER_LINEAR) {
+        if (input_packed) {
+            ops->acs += (uint32_t)snn_spikes_count(input, input_count) * layer->out_channels;
+        } else {
+            ops->macs += (uint32_t)input_count * layer->out_channels;
+        }
+        return;
+    }
+    if (layer->type != SNN_LAYER_CONV2D) {
+        return;
+    }
+
+    int size = layer->input_size;
+    int output_size = snn_layer_output_size(layer);
+    int events = !input_packed && weights->quant == NULL && snn_layer_uses_events(layer, input);
+    uint32_t connections = 0;
+
+    for (int i = 0; i < input_count; ++i) {
+        int active = input_packed ? snn_spike_get(input, i) : !events || ((const float*)input)[i] != 0;
+        if (active) {
+            connections += conv_fan_out(layer, output_size, i / size % size) *
+                           conv_fan_out(layer, output_size, i % size);
+        }
+    }
+    connections *= layer->out_channels;
+    if (input_packed) {
+        ops->acs += connections;
+    } else {
+        ops->macs += connections;
+    }
+}
+
+// Everything a layer step decides once before computing its channels
+typedef struct {
+    int events;
+    float input_scale;
+    int fires;          // int8 layer spiking without membrane state: currents hold spikes
+} StepInput;
+
+// layer_currents() of a codebook layer. Linear layers look their weights
+// up as they go; convolutions decode the kernel of one output channel at a
+// time into scratch and run the float kernel for that input on it.
+static void codebook_currents(const SNNLayer* layer, const SNNLayerWeights* layer_weights, const void* input,
+                              int input_packed, const StepInput* step, float* scratch, float* output, int first,
+                              int count) {
+    const SNNCodebookWeights* codebook = layer_weights->codebook;
+    const SNNConvKernel* conv = layer_weights->conv;
+    const float* biases = layer->biases != NULL ? layer->biases + first : NULL;
+
+    if (layer->type == SNN_LAYER_LINEAR) {
+        const uint8_t* indices = codebook->indices + first * layer->in_channels / 2;
+        if (input_packed) {
+            snn_linear_spikes_codebook(input, output, indices, codebook->codebook, biases, layer->in_channels,
+                                       count);
+        } else {
+            snn_linear_codebook(input, output, indices, codebook->codebook, biases, layer->in_channels, count);
+        }
+        return;
+    }
+
+    int per_channel = layer->in_channels * layer->kernel_size * layer->kernel_size;
+    int output_size = snn_layer_output_size(layer);
+
+    for (int c = 0; c < count; ++c) {
+        const float* bias = biases != NULL ? biases + c : NULL;
+        float* out = output + c * output_size * output_size;
+
+        snn_codebook_decode(codebook, (first + c) * per_channel, per_channel, scratch);
+        if (input_packed && conv != NULL && conv->spikes != NULL) {
+            conv->spikes(input, out, scratch, bias, 1);
+        } else if (input_packed) {
+            snn_conv2d_spikes(input, out, scratch, bias, layer->in_channels, 1, layer->input_size,
+                              layer->kernel_size, layer->stride, layer->padding);
+        } else if (step->events) {
+            snn_conv2d_events(input, out, scratch, bias, layer->in_channels, 1, layer->input_size,
+                              layer->kernel_size, layer->stride, layer->padding);
+        } else if (conv != NULL && conv->dense != NULL) {
+            conv->dense(input, out, scratch, bias, 1);
+        } else {
+            snn_conv2d(input, out, scratch, bias, layer->in_channels, 1, layer->input_size, layer->kernel_size,
+                       layer->stride, layer->padding);
+        }
+    }
+}
+
+// Tiles for count output channels of a SNN_CONV_TILED conv layer; 0 when
+// the layer touches fewer lines untiled, so it runs as the direct kernel
+static int conv_tiles(const SNNLayer* layer, int count, int* tile_channels, int* tile_rows) {
+    snn_conv2d_tiles(layer->in_channels, count, layer->input_size, layer->kernel_size, layer->stride, layer->padding,
+                     SNN_TILE_BYTES, tile_channels, tile_rows);
+    return *tile_channels < count || *tile_rows < snn_layer_output_size(layer);
+}
+
+// Compute output channels [first, first + count) of a conv or linear layer.
+// Int8 layers on float input read memory->input_q8, Winograd layers the
+// tiles and channels-last layers the HWC input in memory->scratch, all
+// prepared once per step; GEMM layers lower their input into
+// memory->scratch as they go.
+static void layer_currents(const SNNLayer* layer, const SNNLayerWeights* layer_weights, const void* input,
+                           int input_packed, const StepInput* step, const SNNLayerMemory* memory,
+                           float* output, int first, int count) {
+    const SNNQuantWeights* quant = layer_weights->quant;
+    const SNNConvKernel* conv = layer_weights->conv;
+    int per_channel = layer->type == SNN_LAYER_LINEAR ? layer->in_channels
+                                                      : layer->in_channels * layer->kernel_size * layer->kernel_size;
+    const float* biases = layer->biases != NULL ? layer->biases + first : NULL;
+
+    if (quant != NULL) {
+        const int8_t* weights = quant->weights + first * per_channel;
+        const float* scales = quant->scales + first;
+        int32_t* sums = (int32_t*)output;
+        int output_size = snn_layer_output_size(layer);
+        int outputs = layer->type == SNN_LAYER_LINEAR ? 1 : output_size * output_size;
+        if (layer->type == SNN_LAYER_LINEAR && input_packed) {
+            snn_linear_spikes_q8_sums(input, sums, weights, layer->in_channels, count);
+        } else if (layer->type == SNN_LAYER_LINEAR) {
+            snn_linear_q8_sums(memory->input_q8, sums, weights, layer->in_channels, count);
+        } else if (input_packed) {
+            snn_conv2d_spikes_q8_sums(input, sums, weights, layer->in_channels, count, layer->input_size,
+                                      layer->kernel_size, layer->stride, layer->padding);
+        } else {
+            snn_conv2d_q8_sums(memory->input_q8, sums, weights, layer->in_channels, count, layer->input_size,
+                               layer->kernel_size, layer->stride, layer->padding);
+        }
+        // The threshold is scaled into the sums' domain instead of every
+        // sum into the threshold's
+        if (step->fires) {
+            snn_q8_fire(sums, output, scales, step->input_scale, biases, layer->threshold, count, outputs);
+        } else {
+            snn_q8_dequantize(sums, output, scales, step->input_scale, biases, count, outputs);
+        }
+        return;
+    }
+
+    if (layer_weights->codebook != NULL) {
+        codebook_currents(layer, layer_weights, input, input_packed, step, memory->scratch, output, first, count);
+        return;
+    }
+    if (layer_weights->sparse != NULL) {
+        // Row offsets are absolute, so rows from first on are a table of their own
+        const SNNSparseWeights* sparse = layer_weights->sparse;
+        SNNSparseWeights rows = { sparse->values, sparse->columns, sparse->row_starts + first };
+        if (input_packed) {
+            snn_linear_spikes_sparse(input, output, &rows, biases, count);
+        } else {
+            snn_linear_sparse(input, output, &rows, biases, count);
+        }
+        return;
+    }
+
+    const float* weights = layer->weights + first * per_channel;
+    int tile_channels;
+    int tile_rows;
+    int derived = !input_packed && !step->events && (layer_weights->winograd != NULL || layer_weights->ohwi != NULL);
+    if (layer_weights->source != NULL && !derived) {
+        // A chunk larger than the source stages runs as several
+        int chunk = snn_weights_chunk(layer_weights->source, layer);
+        if (count > chunk) {
+            int output_size = snn_layer_output_size(layer);
+            int outputs = layer->type == SNN_LAYER_LINEAR ? 1 : output_size * output_size;
+            for (int done = 0; done < count; done += chunk) {
+                int part = count - done < chunk ? count - done : chunk;
+                layer_currents(layer, layer_weights, input, input_packed, step, memory, output + done * outputs,
+                               first + done, part);
+            }
+            return;
+        }
+        weights = snn_weights_fetch(layer_weights->source, layer, first, count);
+    }
+    if (layer->type == SNN_LAYER_LINEAR) {
+        if (input_packed) {
+            snn_linear_spikes(input, output, weights, biases, layer->in_channels, count);
+        } else {
+            snn_linear(input, output, weights, biases, layer->in_channels, count);
+        }
+    } else if (input_packed && conv != NULL && conv->spikes != NULL) {
+        conv->spikes(input, output, weights, biases, count);
+    } else if (input_packed) {
+        snn_conv2d_spikes(input, output, weights, biases, layer->in_channels, count,
+                          layer->input_size, layer->kernel_size, layer->stride, layer->padding);
+    } else if (step->events) {
+        snn_conv2d_events(input, output, weights, biases, layer->in_channels, count,
+                          layer->input_size, layer->kernel_size, layer->stride, layer->padding);
+    } else if (layer_weights->winograd != NULL) {
+        const float* transformed = layer_weights->winograd + first * layer->in_channels * 16;
+        snn_conv2d_winograd(memory->scratch, output, transformed, biases, layer->in_channels, count,
+                            layer->input_size, layer->padding);
+    } else if (layer_weights->ohwi != NULL) {
+        const float* ohwi = layer_weights->ohwi + first * per_channel;
+        snn_conv2d_hwc(memory->scratch, output, ohwi, biases, layer->in_channels, count, layer->input_size,
+                       layer->kernel_size, layer->stride, layer->padding);
+    } else if (memory->scratch != NULL) {
+        snn_conv2d_gemm(input, output, weights, biases, layer->in_channels, count,
+                        layer->input_size, layer->kernel_size, layer->stride, layer->padding, memory->scratch);
+    } else if (layer->algorithm == SNN_CONV_TILED && conv_tiles(layer, count, &tile_channels, &tile_rows)) {
+        snn_conv2d_tiled(input, output, weights, biases, layer->in_channels, count, layer->input_size,
+                         layer->kernel_size, layer->stride, layer->padding, tile_channels, tile_rows);
+    } else if (conv != NULL && conv->dense != NULL) {
+        conv->dense(input, output, weights, biases, count);
+    } else {
+        snn_conv2d(input, output, weights, biases, layer->in_channels, count,
+                   layer->input_size, layer->kernel_size, layer->stride, layer->padding);
+    }
+}
+
+static StepInput prepare_input(const SNNLayer* layer, const SNNLayerWeights* weights, const void* input,
+                               int input_packed, const SNNLayerMemory* memory) {
+    StepInput step = { 0, 1.0f, 0 };
+    if (weights->quant != NULL) {
+        step.fires = memory->neurons == NULL &&
+                     (layer->activation == SNN_ACT_LIF_SPIKE || layer->activation == SNN_ACT_LIF_SPIKE_BITS);
+    }
+    if (input_packed) {
+        return step;
+    }
+    if (weights->quant != NULL) {
+        step.input_scale = snn_quantize_input(input, memory->input_q8, snn_layer_input_count(layer));
+        return step;
+    }
+    step.events = snn_layer_uses_events(layer, input);
+    if (!step.events && weights->winograd != NULL) {
+        snn_winograd_input(input, memory->scratch, layer->in_channels, layer->input_size, layer->padding);
+    }
+    if (!step.events && weights->ohwi != NULL) {
+        snn_chw_to_hwc(input, memory->scratch, layer->in_channels, layer->input_size);
+    }
+    return step;
+}
+
+// Apply the layer activation in place to neurons [first, first + count)
+static void activate(const SNNLayer* layer, LIFPopulation* neurons, int first, float* values, int count) {
+    switch (layer->activation) {
+    case SNN_ACT_RELU:
+        snn_relu(values, count);
+        break;
+    case SNN_ACT_LIF_MEMBRANE:
+        snn_lif_update_values(neurons, first, values, count, layer->beta, layer->threshold, true);
+        break;
+    case SNN_ACT_LIF_SPIKE:
+    case SNN_ACT_LIF_SPIKE_BITS:
+        snn_lif_update_values(neurons, first, values, count, layer->beta, layer->threshold, false);
+        break;
+    default:
+        break;
+    }
+}
+
+// The images a layer step runs on: image i reads inputs[i] and writes
+// outputs[i] with working memory memory[i], whose LIF state is neurons[i]
+typedef struct {
+    int count;
+    const void* inputs[SNN_MAX_BATCH];
+    void* outputs[SNN_MAX_BATCH];
+    SNNLayerMemory memory[SNN_MAX_BATCH];
+    LIFPopulation neurons[SNN_MAX_BATCH];
+} LayerBatch;
+
+// Bytes of weights a dense layer step of a batch computes before moving on
+// to the next output channels: every image uses them while they are in
+// the D-cache, so each is fetched from flash once per batch
+#define BATCH_CHUNK_BYTES 8192
+
+// Output channels of a dense layer step computed for every image at once.
+// Single images and GEMM layers, which lower their input anew for every
+// call, compute the whole layer.
+static int batch_chunk(const SNNLayer* layer, const SNNLayerWeights* weights, int batch) {
+    int per_channel = snn_layer_weight_count(layer) / layer->out_channels;
+    int bytes = weights->quant != NULL ? per_channel
+              : weights->codebook != NULL ? SNN_CODEBOOK_INDEX_BYTES(per_channel)
+              : per_channel * (int)sizeof(float);
+    int chunk = BATCH_CHUNK_BYTES / (bytes > 0 ? bytes : 1);
+
+    if (batch == 1 || layer->algorithm == SNN_CONV_GEMM || chunk > layer->out_channels) {
+        chunk = layer->out_channels;
+    }
+    // No larger than a copying weight source stages, so that every image
+    // of the batch reads the staged copy
+    if (weights->source != NULL && snn_weights_chunk(weights->source, layer) < chunk) {
+        chunk = snn_weights_chunk(weights->source, layer);
+    }
+    return chunk > 0 ? chunk : 1;
+}
+
+// Packed-output and pool-fused layers never hold their full float output:
+// each output channel of a convolution (all features of a linear layer) is
+// computed into currents, activated there, then pooled and/or packed into
+// the output. Pooling runs in place, as no window starts before the
+// element it writes. A batch goes a chunk of channels (batch_chunk()) at a
+// time, each image computing the whole chunk before the next image starts:
+// the chunk's weights stay cached across the images, and each image's
+// input across the channels of the chunk. Cycling every image through
+// each single channel instead kept the weights cached but evicted the
+// inputs of a larger batch on every channel, which was slower on the host
+// than running the images one by one.
+static void forward_by_channel(const SNNLayer* layer, const SNNLayer* pool, const SNNLayerWeights* weights,
+                               int input_packed, const LayerBatch* batch) {
+    int packed = snn_layer_output_packed(layer, input_packed);
+    int group = snn_layer_current_count(layer, input_packed, pool);
+    int pooled = pool != NULL ? snn_layer_output_size(pool) * snn_layer_output_size(pool) : group;
+    int channels = layer->type == SNN_LAYER_CONV2D ? 1 : layer->out_channels;
+    int chunk = batch_chunk(layer, weights, batch->count);
+    StepInput steps[SNN_MAX_BATCH];
+
+    for (int i = 0; i < batch->count; ++i) {
+        steps[i] = prepare_input(layer, weights, batch->inputs[i], input_packed, &batch->memory[i]);
+        if (packed) {
+            memset(batch->outputs[i], 0,
+                   SNN_SPIKE_WORDS(layer->out_channels / channels * pooled) * sizeof(SNNSpikeWord));
+        }
+    }
+    if (chunk < channels) chunk = channels;
+    for (int start = 0; start < layer->out_channels; start += chunk) {
+        int end = layer->out_channels - start < chunk ? layer->out_channels : start + chunk;
+        // Stage the chunk whole, so that no image's channel restages it
+        if (weights->source != NULL && batch->count > 1) {
+            snn_weights_fetch(weights->source, layer, start, end - start);
+        }
+        for (int i = 0; i < batch->count; ++i) {
+            for (int first = start; first < end; first += channels) {
+                int g = first / channels;
+                const SNNLayerMemory* memory = &batch->memory[i];
+                float* currents = memory->currents;
+                void* output = batch->outputs[i];
+                layer_currents(layer, weights, batch->inputs[i], input_packed, &steps[i], memory, currents, first,
+                               channels);
+
+                if (pool == NULL && packed && !steps[i].fires) {
+                    snn_lif_update_spikes(memory->neurons, g * group, currents, group, layer->beta,
+                                          layer->threshold, output);
+                    continue;
+                }
+                if (!steps[i].fires) {
+                    activate(layer, memory->neurons, g * group, currents, group);
+                }
+                if (!packed) {
+                    snn_maxpool2d(currents, (float*)output + g * pooled, 1, pool->input_size, pool->kernel_size,
+                                  pool->stride);
+                    continue;
+                }
+                if (pool != NULL) {
+                    snn_maxpool2d(currents, currents, 1, pool->input_size, pool->kernel_size, pool->stride);
+                }
+                for (int p = 0; p < pooled; ++p) {
+                    if (currents[p] != 0) {
+                        snn_spike_set(output, g * pooled + p);
+                    }
+                }
+            }
+        }
+    }
+}
+
+// snn_layer_forward() of every image of a batch, weight-stationary: each
+// chunk of output channels is computed for all images before the next
+static void forward_batch(const SNNLayer* layer, const SNNLayerWeights* weights, int input_packed,
+                          const LayerBatch* batch) {
+    if (layer->type == SNN_LAYER_MAXPOOL2D) {
+        for (int i = 0; i < batch->count; ++i) {
+            if (input_packed) {
+                snn_maxpool2d_spikes(batch->inputs[i], batch->outputs[i], layer->in_channels, layer->input_size,
+                                     layer->kernel_size, layer->stride);
+            } else {
+                snn_maxpool2d(batch->inputs[i], batch->outputs[i], layer->in_channels, layer->input_size,
+                              layer->kernel_size, layer->stride);
+            }
+        }
+        return;
+    }
+    if (snn_layer_output_packed(layer, input_packed)) {
+        forward_by_channel(layer, NULL, weights, input_packed, batch);
+        return;
+    }
+
+    int output_size = snn_layer_output_size(layer);
+    int chunk = batch_chunk(layer, weights, batch->count);
+    StepInput steps[SNN_MAX_BATCH];
+
+    for (int i = 0; i < batch->count; ++i) {
+        steps[i] = prepare_input(layer, weights, batch->inputs[i], input_packed, &batch->memory[i]);
+    }
+    for (int first = 0; first < layer->out_channels; first += chunk) {
+        int count = layer->out_channels - first < chunk ? layer->out_channels - first : chunk;
+        for (int i = 0; i < batch->count; ++i) {
+            float* output = (float*)batch->outputs[i] + first * output_size * output_size;
+            layer_currents(layer, weights, batch->inputs[i], input_packed, &steps[i], &batch->memory[i], output,
+                           first, count);
+        }
+    }
+    for (int i = 0; i < batch->count; ++i) {
+        if (!steps[i].fires) {
+            activate(layer, batch->memory[i].neurons, 0, batch->outputs[i], snn_layer_output_count(layer));
+        }
+    }
+}
+
+static LayerBatch single_image(const void* input, void* output, const SNNLayerMemory* memory) {
+    LayerBatch batch;
+    batch.count = 1;
+    batch.inputs[0] = input;
+    batch.outputs[0] = output;
+    batch.memory[0] = *memory;
+    return batch;
+}
+
+void snn_layer_forward(const SNNLayer* layer, const SNNLayerWeights* weights, const void* input, int input_packed,
+                       void* output, const SNNLayerMemory* memory) {
+    LayerBatch batch = single_image(input, output, memory);
+    forward_batch(layer, weights, input_packed, &batch);
+}
+
+void snn_layer_forward_pooled(const SNNLayer* layer, const SNNLayer* pool, const SNNLayerWeights* weights,
+                              const void* input, int input_packed, void* output, const SNNLayerMemory* memory) {
+    LayerBatch batch = single_image(input, output, memory);
+    forward_by_channel(layer, pool, weights, input_packed, &batch);
+}
+
+size_t snn_network_arena_size(const SNNNetwork* network, int timesteps) {
+    SNNArenaPlan plan;
+    if (snn_plan_arena(network, timesteps, &plan) != 0) {
+        return 0;
+    }
+    return plan.arena_size;
+}
+
+size_t snn_network_batch_arena_size(const SNNNetwork* network, int timesteps, int batch) {
+    size_t arena_size = snn_network_arena_size(network, timesteps);
+    if (arena_size == 0 || batch < 1) {
+        return 0;
+    }
+    return (size_t)(batch - 1) * SNN_BATCH_STRIDE(arena_size) + arena_size;
+}
+
+int snn_network_batch_size(const SNNNetwork* network, int timesteps, size_t arena_size) {
+    int batch = 0;
+    while (batch < SNN_MAX_BATCH) {
+        size_t needed = snn_network_batch_arena_size(network, timesteps, batch + 1);
+        if (needed == 0 || needed > arena_size) break;
+        ++batch;
+    }
+    return batch;
+}
+
+// Lead of the largest of count outputs over the second largest
+static float output_lead(const float* outputs, int count) {
+    int best = snn_argmax(outputs, count);
+    float second = 0;
+    int found = 0;
+
+    for (int i = 0; i < count; ++i) {
+        if (i != best && (!found || outputs[i] > second)) {
+            second = outputs[i];
+            found = 1;
+        }
+    }
+    return found ? outputs[best] - second : 0;
+}
+
+static void* offset_pointer(void* pointer, size_t offset) {
+    return pointer != NULL ? (uint8_t*)pointer + offset : NULL;
+}
+
+// Working memory of the image whose arena starts offset bytes after that of
+// image 0, given image 0's; its LIF state is written to *neurons
+static SNNLayerMemory image_memory(const SNNLayerMemory* memory, size_t offset, LIFPopulation* neurons) {
+    SNNLayerMemory moved = *memory;
+
+    if (memory->neurons != NULL) {
+        *neurons = *memory->neurons;
+        neurons->membrane = offset_pointer(neurons->membrane, offset);
+        neurons->fixed_membrane = offset_pointer(neurons->fixed_membrane, offset);
+        neurons->refractory = offset_pointer(neurons->refractory, offset);
+        moved.neurons = neurons;
+    }
+    moved.currents = offset_pointer(moved.currents, offset);
+    moved.input_q8 = offset_pointer(moved.input_q8, offset);
+    moved.scratch = offset_pointer(moved.scratch, offset);
+    return moved;
+}
+
+// A single-step run starts every neuron from rest and never reads its state
+// again, so the plan keeps no LIF state and the layers run stateless.
+// Images that exit early drop out of the batch for the remaining steps.
+int snn_network_run_batch(const SNNNetwork* network, const float* const* inputs, int batch, void* arena,
+                          size_t arena_size, const SNNRunConfig* config, SNNRunResult* results) {
+    SNNArenaPlan plan;
+    const SNNLayer* last = &network->layers[network->num_layers - 1];
+    int output_count = snn_layer_output_count(last);
+    int timesteps = network->timesteps;
+    uint32_t (*clock)(void) = NULL;
+    int count_synops = 0;
+    int exit_window = network->exit_window;
+    float exit_margin = network->exit_margin;
+    int active[SNN_MAX_BATCH];
+    LIFPopulation populations[SNN_MAX_LAYERS];
+    SNNLayerMemory memory[SNN_MAX_LAYERS];
+    LayerBatch step_batch;
+    size_t stride;
+    int accumulated = 0;
+    int output_buffer = -1;
+
+    if (config != NULL) {
+        if (config->timesteps > 0) timesteps = config->timesteps;
+        clock = config->clock;
+        count_synops = config->count_synops;
+        if (config->exit_window != 0) {
+            exit_window = config->exit_window;
+            exit_margin = config->exit_margin;
+        }
+    }
+    if (batch < 1 || batch > SNN_MAX_BATCH || timesteps < 1 || snn_plan_arena(network, timesteps, &plan) != 0) {
+        return -1;
+    }
+    if (network->weight_source != NULL &&
+        snn_weights_chunk_bytes(network->weight_source) < snn_weights_channel_bytes(network)) {
+        return -1;
+    }
+    stride = SNN_BATCH_STRIDE(plan.arena_size);
+    if ((size_t)(batch - 1) * stride + plan.arena_size > arena_size) {
+        return -1;
+    }
+
+    for (int l = 0; l < network->num_layers; ++l) {
+        memory[l].neurons = NULL;
+        if (plan.state_buffer[l] >= 0) {
+            int count = snn_layer_output_count(&network->layers[l]);
+            for (int b = batch - 1; b >= 0; --b) {
+                void* state = (uint8_t*)arena + b * stride + plan.offsets[plan.state_buffer[l]];
+                if (network->fixed_membranes) {
+                    snn_lif_population_init_fixed(&populations[l], state, count);
+                } else {
+                    snn_lif_population_init(&populations[l], state, count);
+                }
+            }
+            memory[l].neurons = &populations[l];
+        }
+        memory[l].currents = NULL;
+        if (plan.current_buffer[l] >= 0) {
+            memory[l].currents = (float*)((uint8_t*)arena + plan.offsets[plan.current_buffer[l]]);
+        }
+        memory[l].input_q8 = NULL;
+        if (plan.input_q8_buffer[l] >= 0) {
+            memory[l].input_q8 = (int8_t*)((uint8_t*)arena + plan.offsets[plan.input_q8_buffer[l]]);
+        }
+        memory[l].scratch = NULL;
+        if (plan.scratch_buffer[l] >= 0) {
+            memory[l].scratch = (float*)((uint8_t*)arena + plan.offsets[plan.scratch_buffer[l]]);
+        }
+    }
+    for (int b = 0; b < batch; ++b) {
+        for (int l = 0; l < network->num_layers; ++l) {
+            results[b].layer_ticks[l] = 0;
+            results[b].synops[l].macs = 0;
+            results[b].synops[l].acs = 0;
+        }
+        if (plan.accumulator_buffer >= 0) {
+            memset((uint8_t*)arena + b * stride + plan.offsets[plan.accumulator_buffer], 0,
+                   2 * output_count * sizeof(float));
+            accumulated = 1;
+        }
+        results[b].total_ticks = 0;
+        results[b].timesteps = 0;
+        active[b] = 1;
+    }
+
+    for (int t = 0; t < timesteps; ++t) {
+        uint32_t start = clock != NULL ? clock() : 0;
+        int images[SNN_MAX_BATCH];
+        int count = 0;
+
+        for (int b = 0; b < batch; ++b) {
+            if (active[b]) images[count++] = b;
+        }
+        if (count == 0) break;
+        step_batch.count = count;
+
+        int packed = 0;
+        int input_buffer = -1;
+        for (int l = 0; l < network->num_layers; ++l) {
+            const SNNLayer* layer = &network->layers[l];
+            SNNLayerWeights weights = snn_network_weights(network, l);
+            int fused = plan.fused_pool[l];
+            int buffer = fused ? l + 1 : l;
+
+            for (int i = 0; i < count; ++i) {
+                size_t offset = images[i] * stride;
+                step_batch.inputs[i] = input_buffer < 0 ? (const void*)inputs[images[i]]
+                                                        : (uint8_t*)arena + offset + plan.offsets[input_buffer];
+                step_batch.outputs[i] = (uint8_t*)arena + offset + plan.offsets[buffer];
+                step_batch.memory[i] = image_memory(&memory[l], offset, &step_batch.neurons[i]);
+                if (count_synops) {
+                    snn_layer_count_synops(layer, &weights, step_batch.inputs[i], packed,
+                                           &results[images[i]].synops[l]);
+                }
+            }
+            uint32_t layer_start = clock != NULL ? clock() : 0;
+            if (fused) {
+                const SNNLayer* pool = &network->layers[l + 1];
+                forward_by_channel(layer, pool, &weights, packed, &step_batch);
+                packed = snn_layer_output_packed(pool, snn_layer_output_packed(layer, packed));
+            } else {
+                forward_batch(layer, &weights, packed, &step_batch);
+                packed = snn_layer_output_packed(layer, packed);
+            }
+            if (clock != NULL) {
+                uint32_t ticks = clock() - layer_start;
+                for (int i = 0; i < count; ++i) {
+                    results[images[i]].layer_ticks[l] += ticks;
+                }
+            }
+            input_buffer = buffer;
+            l += fused;
+        }
+        output_buffer = input_buffer;
+
+        for (int i = 0; i < count; ++i) {
+            int b = images[i];
+            uint8_t* image_arena = (uint8_t*)arena + b * stride;
+            if (accumulated) {
+                float* accumulator = (float*)(image_arena + plan.offsets[plan.accumulator_buffer]);
+                const float* outputs = (const float*)(image_arena + plan.offsets[output_buffer]);
+                for (int o = 0; o < output_count; ++o) {
+                    accumulator[o] += outputs[o];
+                }
+            }
+        }
+
+        uint32_t ticks = clock != NULL ? clock() - start : 0;
+        for (int i = 0; i < count; ++i) {
+            int b = images[i];
+            if (t < SNN_MAX_TIMESTEPS) {
+                results[b].step_ticks[t] = ticks;
+            }
+            results[b].total_ticks += ticks;
+            results[b].timesteps = t + 1;
+
+            if (exit_window > 0 && accumulated && (t + 1) % exit_window == 0) {
+                // The sums at the window's start become the window's own
+                // sums, then the start of the next window
+                float* accumulator = (float*)((uint8_t*)arena + b * stride + plan.offsets[plan.accumulator_buffer]);
+                float* window = accumulator + output_count;
+                for (int o = 0; o < output_count; ++o) {
+                    window[o] = accumulator[o] - window[o];
+                }
+                active[b] = output_lead(window, output_count) < exit_margin;
+                memcpy(window, accumulator, output_count * sizeof(float));
+            }
+        }
+    }
+
+    for (int b = 0; b < batch; ++b) {
+        uint8_t* image_arena = (uint8_t*)arena + b * stride;
+        int buffer = accumulated ? plan.accumulator_buffer : output_buffer;
+        results[b].outputs = (const float*)(image_arena + plan.offsets[buffer]);
+        results[b].predicted = snn_argmax(results[b].outputs, output_count);
+    }
+    return 0;
+}
+
+int snn_network_run(const SNNNetwork* network, const float* input, void* arena, size_t arena_size,
+                    const SNNRunConfig* config, SNNRunResult* result) {
+    if (snn_network_run_batch(network, &input, 1, arena, arena_size, config, result) != 0) {
+        return -1;
+    }
+    return result->predicted;
+}
+
+int snn_network_inference(const SNNNetwork* network, const float* input, void* arena) {
+    SNNRunResult result;
+    return snn_network_run(network, input, arena, snn_network_arena_size(network, network->timesteps),
+                           NULL, &result);
+}
@@ -0,0 +1,28 @@
+#include "snn_placement.h"
+
+#include <stdint.h>
+#include <string.h>
+
+#if defined(SNN_TCM_PLACEMENT)
+// Section bounds from STM32H735IGKX_*.ld
+extern uint32_t _siitcm, _sitcm, _eitcm;
+extern uint32_t _sdtcm_bss, _edtcm_bss;
+extern uint32_t _sd2_bss, _ed2_bss;
+extern uint32_t _sd3_bss, _ed3_bss;
+
+static void zero(uint32_t* start, uint32_t* end) {
+    memset(start, 0, (size_t)((uint8_t*)end - (uint8_t*)start));
+}
+
+void snn_placement_init(void) {
+    memcpy(&_sitcm, &_siitcm, (size_t)((uint8_t*)&_eitcm - (uint8_t*)&_sitcm));
+    zero(&_sdtcm_bss, &_edtcm_bss);
+    zero(&_sd2_bss, &_ed2_bss);
+    zero(&_sd3_bss, &_ed3_bss);
+    // The copied code must reach the instruction side before it runs
+    __asm volatile("dsb\n\tisb" ::: "memory");
+}
+#else
+void snn_placement_init(void) {
+}
+#endif
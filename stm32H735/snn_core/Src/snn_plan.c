@@ -0,0 +1,122 @@
+#include "snn_plan.h"
+
+static size_t align_up(size_t value) {
+    return (value + SNN_ARENA_ALIGNMENT - 1) & ~(size_t)(SNN_ARENA_ALIGNMENT - 1);
+}
+
+static int lifetimes_overlap(const SNNArenaPlan* plan, int a, int b) {
+    return plan->first_use[a] <= plan->last_use[b] && plan->first_use[b] <= plan->last_use[a];
+}
+
+static int add_buffer(SNNArenaPlan* plan, size_t bytes, int first_use, int last_use) {
+    int buffer = plan->num_buffers++;
+    plan->sizes[buffer] = align_up(bytes);
+    plan->first_use[buffer] = first_use;
+    plan->last_use[buffer] = last_use;
+    plan->unplanned_size += plan->sizes[buffer];
+    return buffer;
+}
+
+// Greedy by size: place the largest buffers first, each at the lowest offset
+// that does not collide with an already placed buffer it is live with.
+int snn_plan_arena(const SNNNetwork* network, int timesteps, SNNArenaPlan* plan) {
+    int num_layers = network->num_layers;
+    int order[SNN_MAX_BUFFERS];
+    int placed = 0;
+    int packed = 0;
+
+    if (num_layers > SNN_MAX_LAYERS) {
+        return -1;
+    }
+
+    plan->num_buffers = 0;
+    plan->accumulator_buffer = -1;
+    plan->arena_size = 0;
+    plan->unplanned_size = 0;
+    for (int l = 0; l < num_layers; ++l) {
+        plan->fused_pool[l] = l > 0 && plan->fused_pool[l - 1] ? 0 : snn_network_fuses_pool(network, l);
+        if (plan->fused_pool[l]) {
+            add_buffer(plan, 0, l, l);
+        } else {
+            // The output of a fused pool is written one step early
+            int first_use = l > 0 && plan->fused_pool[l - 1] ? l - 1 : l;
+            add_buffer(plan, snn_layer_output_bytes(&network->layers[l], packed), first_use, l + 1);
+        }
+        packed = snn_layer_output_packed(&network->layers[l], packed);
+    }
+    if (packed) {
+        return -1;
+    }
+    for (int l = 0; l < num_layers; ++l) {
+        const SNNLayer* layer = &network->layers[l];
+        const SNNLayer* pool = plan->fused_pool[l] ? &network->layers[l + 1] : NULL;
+        int currents = snn_layer_current_count(layer, packed, pool);
+
+        SNNLayerWeights weights = snn_network_weights(network, l);
+        int input_q8 = snn_layer_input_q8_count(layer, weights.quant, packed);
+        int scratch = snn_layer_scratch_count(layer, &weights, packed, pool);
+
+        plan->current_buffer[l] = -1;
+        if (currents > 0) {
+            plan->current_buffer[l] = add_buffer(plan, (size_t)currents * sizeof(float), l, l);
+        }
+        plan->input_q8_buffer[l] = -1;
+        if (input_q8 > 0) {
+            plan->input_q8_buffer[l] = add_buffer(plan, (size_t)input_q8, l, l);
+        }
+        plan->scratch_buffer[l] = -1;
+        if (scratch > 0) {
+            plan->scratch_buffer[l] = add_buffer(plan, (size_t)scratch * sizeof(float), l, l);
+        }
+        packed = snn_layer_output_packed(layer, packed);
+
+        plan->state_buffer[l] = -1;
+        if (timesteps > 1 && snn_layer_has_neurons(layer)) {
+            plan->state_buffer[l] = add_buffer(plan, snn_lif_population_bytes(snn_layer_output_count(layer)),
+                                               0, num_layers);
+        }
+    }
+    if (timesteps > 1) {
+        const SNNLayer* last = &network->layers[num_layers - 1];
+        plan->accumulator_buffer = add_buffer(plan, 2 * (size_t)snn_layer_output_count(last) * sizeof(float),
+                                              0, num_layers);
+    }
+
+    for (int i = 0; i < plan->num_buffers; ++i) {
+        int key = i;
+        int j = i - 1;
+        while (j >= 0 && plan->sizes[order[j]] < plan->sizes[key]) {
+            order[j + 1] = order[j];
+            --j;
+        }
+        order[j + 1] = key;
+    }
+
+    for (int i = 0; i < plan->num_buffers; ++i) {
+        int buffer = order[i];
+        size_t offset = 0;
+        int moved = 1;
+
+        // Bump past every live neighbour we collide with until none is left
+        while (moved) {
+            moved = 0;
+            for (int p = 0; p < placed; ++p) {
+                int other = order[p];
+                if (!lifetimes_overlap(plan, buffer, other)) continue;
+                if (offset < plan->offsets[other] + plan->sizes[other] &&
+                    plan->offsets[other] < offset + plan->sizes[buffer]) {
+                    offset = plan->offsets[other] + plan->sizes[other];
+                    moved = 1;
+                }
+            }
+        }
+
+        plan->offsets[buffer] = offset;
+        if (offset + plan->sizes[buffer] > plan->arena_size) {
+            plan->arena_size = offset + plan->sizes[buffer];
+        }
+        ++placed;
+    }
+
+    return 0;
+}
@@ -0,0 +1,288 @@
+#include "snn_quant.h"
+
+#include <math.h>
+#include <stddef.h>
+#include <string.h>
+#include "snn_kernels.h"
+#include "snn_specialize.h"
+
+static int8_t quantize(float value, float scale) {
+    float q = roundf(value / scale);
+    if (q > 127) q = 127;
+    if (q < -127) q = -127;
+    return (int8_t)q;
+}
+
+void snn_quantize_weights(const float* weights, int out_channels, int per_channel, int8_t* quantized,
+                          float* scales) {
+    for (int oc = 0; oc < out_channels; ++oc) {
+        const float* channel = weights + oc * per_channel;
+        float max_abs = 0;
+        for (int i = 0; i < per_channel; ++i) {
+            if (fabsf(channel[i]) > max_abs) max_abs = fabsf(channel[i]);
+        }
+        scales[oc] = max_abs > 0 ? max_abs / 127 : 1;
+        for (int i = 0; i < per_channel; ++i) {
+            quantized[oc * per_channel + i] = quantize(channel[i], scales[oc]);
+        }
+    }
+}
+
+float snn_quantize_input(const float* input, int8_t* quantized, int count) {
+    float max_abs = 0;
+    for (int i = 0; i < count; ++i) {
+        if (fabsf(input[i]) > max_abs) max_abs = fabsf(input[i]);
+    }
+    float scale = max_abs > 0 ? max_abs / 127 : 1;
+    for (int i = 0; i < count; ++i) {
+        quantized[i] = quantize(input[i], scale);
+    }
+    return scale;
+}
+
+// snn_conv_border() on int8 input and weights
+static int32_t conv_border_q8(const int8_t* input, const int8_t* kernel, int in_channels, int input_size,
+                              int kernel_size, int ih0, int iw0) {
+    int taps = kernel_size * kernel_size;
+    int32_t sum = 0;
+
+    for (int ic = 0; ic < in_channels; ++ic) {
+        for (int kh = 0; kh < kernel_size; ++kh) {
+            int ih = ih0 + kh;
+            if (ih < 0 || ih >= input_size) continue;
+            for (int kw = 0; kw < kernel_size; ++kw) {
+                int iw = iw0 + kw;
+                if (iw >= 0 && iw < input_size) {
+                    sum += input[ic * input_size * input_size + ih * input_size + iw] *
+                           kernel[ic * taps + kh * kernel_size + kw];
+                }
+            }
+        }
+    }
+    return sum;
+}
+
+// snn_conv_interior() on int8 input and weights
+static int32_t conv_interior_q8(const int8_t* window, const int8_t* kernel, int in_channels, int input_size,
+                                int kernel_size) {
+    int taps = kernel_size * kernel_size;
+    int32_t sum = 0;
+
+    for (int ic = 0; ic < in_channels; ++ic) {
+        const int8_t* channel = window + ic * input_size * input_size;
+        const int8_t* k = kernel + ic * taps;
+        for (int kh = 0; kh < kernel_size; ++kh) {
+            for (int kw = 0; kw < kernel_size; ++kw) {
+                sum += channel[kh * input_size + kw] * k[kh * kernel_size + kw];
+            }
+        }
+    }
+    return sum;
+}
+
+// conv_interior_q8() for 3x3 kernels, unrolled
+static int32_t conv_interior_3x3_q8(const int8_t* window, const int8_t* kernel, int in_channels, int input_size) {
+    int32_t sum = 0;
+
+    for (int ic = 0; ic < in_channels; ++ic) {
+        const int8_t* r0 = window + ic * input_size * input_size;
+        const int8_t* r1 = r0 + input_size;
+        const int8_t* r2 = r1 + input_size;
+        const int8_t* k = kernel + ic * 9;
+        sum += r0[0] * k[0] + r0[1] * k[1] + r0[2] * k[2];
+        sum += r1[0] * k[3] + r1[1] * k[4] + r1[2] * k[5];
+        sum += r2[0] * k[6] + r2[1] * k[7] + r2[2] * k[8];
+    }
+    return sum;
+}
+
+// Split into border and interior pixels as snn_conv2d(): only the padded
+// border pays for bounds checks. Integer sums are exact, so the split
+// leaves the outputs unchanged.
+void snn_conv2d_q8_sums(const int8_t* input, int32_t* sums, const int8_t* weights, int in_channels,
+                        int out_channels, int input_size, int kernel_size, int stride, int padding) {
+    int output_size = snn_conv_output_size(input_size, kernel_size, stride, padding);
+    int taps = kernel_size * kernel_size;
+    int first;
+    int end;
+
+    snn_conv_interior_range(input_size, kernel_size, stride, padding, output_size, &first, &end);
+
+    for (int oc = 0; oc < out_channels; ++oc) {
+        const int8_t* kernel = weights + oc * in_channels * taps;
+        int32_t* out = sums + oc * output_size * output_size;
+
+        for (int oh = 0; oh < output_size; ++oh) {
+            int ih0 = oh * stride - padding;
+            int interior = oh >= first && oh < end;
+
+            for (int ow = 0; ow < output_size; ++ow) {
+                int iw0 = ow * stride - padding;
+                int32_t sum;
+
+                if (!interior || ow < first || ow >= end) {
+                    sum = conv_border_q8(input, kernel, in_channels, input_size, kernel_size, ih0, iw0);
+                } else if (kernel_size == 3) {
+                    sum = conv_interior_3x3_q8(input + ih0 * input_size + iw0, kernel, in_channels, input_size);
+                } else {
+                    sum = conv_interior_q8(input + ih0 * input_size + iw0, kernel, in_channels, input_size,
+                                           kernel_size);
+                }
+                out[oh * output_size + ow] = sum;
+            }
+        }
+    }
+}
+
+void snn_conv2d_q8(const int8_t* input, float input_scale, float* output, const int8_t* weights,
+                   const float* scales, const float* biases, int in_channels, int out_channels, int input_size,
+                   int kernel_size, int stride, int padding) {
+    int output_size = snn_conv_output_size(input_size, kernel_size, stride, padding);
+
+    snn_conv2d_q8_sums(input, (int32_t*)output, weights, in_channels, out_channels, input_size, kernel_size, stride,
+                       padding);
+    snn_q8_dequantize((const int32_t*)output, output, scales, input_scale, biases, out_channels,
+                      output_size * output_size);
+}
+
+// Taps [*low, *high] in steps of stride of a spike at input row (or
+// column) i reach outputs *first, *first - 1, ... as in
+// snn_conv2d_spikes_row()
+static void spike_taps(int i, int kernel_size, int stride, int padding, int output_size, int* low, int* high,
+                       int* first) {
+    int reach = i + padding;
+
+    *low = reach - (output_size - 1) * stride > 0 ? reach - (output_size - 1) * stride : 0;
+    *high = reach < kernel_size - 1 ? reach : kernel_size - 1;
+    *low += (reach - *low) % stride;
+    *first = (reach - *low) / stride;
+}
+
+// The spikes of each input channel are gathered once and scattered into
+// the int32 sums of every output channel
+void snn_conv2d_spikes_q8_sums(const SNNSpikeWord* input, int32_t* sums, const int8_t* weights, int in_channels,
+                               int out_channels, int input_size, int kernel_size, int stride, int padding) {
+    int output_size = snn_conv_output_size(input_size, kernel_size, stride, padding);
+    int map_size = input_size * input_size;
+    int out_map_size = output_size * output_size;
+    int taps = kernel_size * kernel_size;
+    uint16_t events[SNN_EVENT_MAP_SIZE];
+
+    memset(sums, 0, (size_t)out_channels * out_map_size * sizeof(int32_t));
+
+    for (int ic = 0; ic < in_channels; ++ic) {
+        int num_events = snn_spikes_gather(input, ic * map_size, map_size, events);
+        if (num_events == 0) continue;
+
+        for (int oc = 0; oc < out_channels; ++oc) {
+            const int8_t* kernel = weights + (oc * in_channels + ic) * taps;
+            int32_t* out = sums + oc * out_map_size;
+
+            for (int e = 0; e < num_events; ++e) {
+                int kh_low, kh_high, first_oh;
+                int kw_low, kw_high, first_ow;
+                spike_taps(events[e] / input_size, kernel_size, stride, padding, output_size, &kh_low, &kh_high,
+                           &first_oh);
+                spike_taps(events[e] % input_size, kernel_size, stride, padding, output_size, &kw_low, &kw_high,
+                           &first_ow);
+                for (int kh = kh_low, oh = first_oh; kh <= kh_high; kh += stride, --oh) {
+                    const int8_t* k = kernel + kh * kernel_size;
+                    int32_t* row = out + oh * output_size;
+                    for (int kw = kw_low, ow = first_ow; kw <= kw_high; kw += stride, --ow) {
+                        row[ow] += k[kw];
+                    }
+                }
+            }
+        }
+    }
+}
+
+void snn_conv2d_spikes_q8(const SNNSpikeWord* input, float* output, const int8_t* weights, const float* scales,
+                          const float* biases, int in_channels, int out_channels, int input_size, int kernel_size,
+                          int stride, int padding) {
+    int output_size = snn_conv_output_size(input_size, kernel_size, stride, padding);
+
+    snn_conv2d_spikes_q8_sums(input, (int32_t*)output, weights, in_channels, out_channels, input_size, kernel_size,
+                              stride, padding);
+    snn_q8_dequantize((const int32_t*)output, output, scales, 1.0f, biases, out_channels,
+                      output_size * output_size);
+}
+
+void snn_linear_q8_sums(const int8_t* input, int32_t* sums, const int8_t* weights, int in_features,
+                        int out_features) {
+    for (int of = 0; of < out_features; ++of) {
+        const int8_t* row = weights + of * in_features;
+        int32_t sum = 0;
+        for (int i = 0; i < in_features; ++i) {
+            sum += input[i] * row[i];
+        }
+        sums[of] = sum;
+    }
+}
+
+void snn_linear_q8(const int8_t* input, float input_scale, float* output, const int8_t* weights,
+                   const float* scales, const float* biases, int in_features, int out_features) {
+    snn_linear_q8_sums(input, (int32_t*)output, weights, in_features, out_features);
+    snn_q8_dequantize((const int32_t*)output, output, scales, input_scale, biases, out_features, 1);
+}
+
+void snn_linear_spikes_q8_sums(const SNNSpikeWord* input, int32_t* sums, const int8_t* weights, int in_features,
+                               int out_features) {
+    int words = SNN_SPIKE_WORDS(in_features);
+
+    for (int of = 0; of < out_features; ++of) {
+        const int8_t* row = weights + of * in_features;
+        int32_t sum = 0;
+        for (int w = 0; w < words; ++w) {
+            SNNSpikeWord bits = input[w];
+            while (bits != 0) {
+                sum += row[w * 32 + __builtin_ctz(bits)];
+                bits &= bits - 1;
+            }
+        }
+        sums[of] = sum;
+    }
+}
+
+void snn_linear_spikes_q8(const SNNSpikeWord* input, float* output, const int8_t* weights, const float* scales,
+                          const float* biases, int in_features, int out_features) {
+    snn_linear_spikes_q8_sums(input, (int32_t*)output, weights, in_features, out_features);
+    snn_q8_dequantize((const int32_t*)output, output, scales, 1.0f, biases, out_features, 1);
+}
+
+// Each sum is read before its output is written, so sums and output may
+// share memory
+void snn_q8_dequantize(const int32_t* sums, float* output, const float* scales, float input_scale,
+                       const float* biases, int channels, int outputs) {
+    for (int c = 0; c < channels; ++c) {
+        float scale = scales[c] * input_scale;
+        float bias = biases != NULL ? biases[c] : 0;
+        for (int i = 0; i < outputs; ++i) {
+            output[c * outputs + i] = sums[c * outputs + i] * scale + bias;
+        }
+    }
+}
+
+int32_t snn_q8_threshold(float threshold, float scale, float bias) {
+    double estimate = ceil(((double)threshold - bias) / scale);
+    int32_t limit;
+
+    if (estimate >= INT32_MAX) return INT32_MAX;
+    if (estimate <= INT32_MIN + 1.0) return INT32_MIN;
+    limit = (int32_t)estimate;
+    // The float conversion rounds; settle on the sum where it first
+    // reaches the threshold, so spikes match the float comparison
+    while (limit > INT32_MIN && (float)(limit - 1) * scale + bias >= threshold) --limit;
+    while (limit < INT32_MAX && (float)limit * scale + bias < threshold) ++limit;
+    return limit;
+}
+
+void snn_q8_fire(const int32_t* sums, float* output, const float* scales, float input_scale, const float* biases,
+                 float threshold, int channels, int outputs) {
+    for (int c = 0; c < channels; ++c) {
+        int32_t limit = snn_q8_threshold(threshold, scales[c] * input_scale, biases != NULL ? biases[c] : 0);
+        for (int i = 0; i < outputs; ++i) {
+            output[c * outputs + i] = sums[c * outputs + i] >= limit ? 1.0f : 0.0f;
+        }
+    }
+}
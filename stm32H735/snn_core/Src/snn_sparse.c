@@ -0,0 +1,122 @@
+#include "snn_sparse.h"
+
+#include <math.h>
+#include <stddef.h>
+#include <string.h>
+
+static float block_norm(const float* block) {
+    float norm = 0;
+    for (int i = 0; i < SNN_SPARSE_BLOCK; ++i) {
+        norm += fabsf(block[i]);
+    }
+    return norm;
+}
+
+static int block_zero(const float* block) {
+    for (int i = 0; i < SNN_SPARSE_BLOCK; ++i) {
+        if (block[i] != 0) return 0;
+    }
+    return 1;
+}
+
+// A block is kept when fewer than keep blocks of its row rank above it;
+// ties go to the lower column, so every row keeps exactly keep blocks
+void snn_prune_blocks(const float* weights, float* pruned, int out_features, int in_features, float sparsity) {
+    int blocks = in_features / SNN_SPARSE_BLOCK;
+    int keep = (int)lroundf((1.0f - sparsity) * blocks);
+
+    if (keep < 0) keep = 0;
+    if (keep > blocks) keep = blocks;
+
+    for (int of = 0; of < out_features; ++of) {
+        const float* row = weights + of * in_features;
+        float* out = pruned + of * in_features;
+
+        for (int b = 0; b < blocks; ++b) {
+            float norm = block_norm(row + b * SNN_SPARSE_BLOCK);
+            int above = 0;
+            for (int other = 0; other < blocks && above < keep; ++other) {
+                float n = block_norm(row + other * SNN_SPARSE_BLOCK);
+                above += n > norm || (n == norm && other < b);
+            }
+            for (int i = 0; i < SNN_SPARSE_BLOCK; ++i) {
+                out[b * SNN_SPARSE_BLOCK + i] = above < keep ? row[b * SNN_SPARSE_BLOCK + i] : 0.0f;
+            }
+        }
+    }
+}
+
+int snn_sparse_block_count(const float* weights, int out_features, int in_features) {
+    int count = 0;
+    for (int i = 0; i < out_features * in_features; i += SNN_SPARSE_BLOCK) {
+        count += !block_zero(weights + i);
+    }
+    return count;
+}
+
+void snn_sparse_pack(const float* weights, int out_features, int in_features, float* values, uint16_t* columns,
+                     uint32_t* row_starts) {
+    uint32_t count = 0;
+
+    for (int of = 0; of < out_features; ++of) {
+        row_starts[of] = count;
+        for (int c = 0; c < in_features; c += SNN_SPARSE_BLOCK) {
+            const float* block = weights + of * in_features + c;
+            if (block_zero(block)) continue;
+            for (int i = 0; i < SNN_SPARSE_BLOCK; ++i) {
+                values[count * SNN_SPARSE_BLOCK + i] = block[i];
+            }
+            columns[count++] = (uint16_t)c;
+        }
+    }
+    row_starts[out_features] = count;
+}
+
+uint32_t snn_sparse_bytes(int blocks, int out_features) {
+    return (uint32_t)blocks * (SNN_SPARSE_BLOCK * sizeof(float) + sizeof(uint16_t)) +
+           (uint32_t)(out_features + 1) * sizeof(uint32_t);
+}
+
+// Both kernels are unrolled for SNN_SPARSE_BLOCK 4
+void snn_linear_sparse(const float* input, float* output, const SNNSparseWeights* weights, const float* biases,
+                       int out_features) {
+    for (int of = 0; of < out_features; ++of) {
+        float sum = biases != NULL ? biases[of] : 0;
+        for (uint32_t b = weights->row_starts[of]; b < weights->row_starts[of + 1]; ++b) {
+            const float* x = input + weights->columns[b];
+            const float* v = weights->values + b * SNN_SPARSE_BLOCK;
+            sum += x[0] * v[0];
+            sum += x[1] * v[1];
+            sum += x[2] * v[2];
+            sum += x[3] * v[3];
+        }
+        output[of] = sum;
+    }
+}
+
+// value if bit is 1, +0 if it is 0, by masking the float's bits: a spike
+// pattern costs no branch, and adding +0 leaves a sum unchanged
+static inline float masked(float value, unsigned bit) {
+    uint32_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+    bits &= 0u - bit;
+    memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+void snn_linear_spikes_sparse(const SNNSpikeWord* input, float* output, const SNNSparseWeights* weights,
+                              const float* biases, int out_features) {
+    for (int of = 0; of < out_features; ++of) {
+        float sum = biases != NULL ? biases[of] : 0;
+        for (uint32_t b = weights->row_starts[of]; b < weights->row_starts[of + 1]; ++b) {
+            int column = weights->columns[b];
+            unsigned bits = (input[column / 32] >> (column % 32)) & ((1u << SNN_SPARSE_BLOCK) - 1);
+            const float* v = weights->values + b * SNN_SPARSE_BLOCK;
+            sum += masked(v[0], bits & 1);
+            sum += masked(v[1], bits >> 1 & 1);
+            sum += masked(v[2], bits >> 2 & 1);
+            sum += masked(v[3], bits >> 3);
+        }
+        output[of] = sum;
+    }
+}
@@ -0,0 +1,50 @@
+#include "snn_spikes.h"
+
+#include <string.h>
+
+void snn_spikes_pack(const float* input, SNNSpikeWord* spikes, int count) {
+    memset(spikes, 0, SNN_SPIKE_WORDS(count) * sizeof(SNNSpikeWord));
+    for (int i = 0; i < count; ++i) {
+        if (input[i] != 0) {
+            snn_spike_set(spikes, i);
+        }
+    }
+}
+
+void snn_spikes_unpack(const SNNSpikeWord* spikes, float* output, int count) {
+    for (int i = 0; i < count; ++i) {
+        output[i] = snn_spike_get(spikes, i) ? 1.0f : 0.0f;
+    }
+}
+
+int snn_spikes_count(const SNNSpikeWord* spikes, int count) {
+    int total = 0;
+    for (int w = 0; w < count / 32; ++w) {
+        total += __builtin_popcount(spikes[w]);
+    }
+    for (int i = count / 32 * 32; i < count; ++i) {
+        total += snn_spike_get(spikes, i);
+    }
+    return total;
+}
+
+// Ranges need not start on a word boundary; mask off the bits before first
+// and after the end in the first and last word. Silent words cost one load.
+int snn_spikes_gather(const SNNSpikeWord* spikes, int first, int count, uint16_t* positions) {
+    int end = first + count;
+    int num = 0;
+
+    for (int i = first; i < end; i = (i | 31) + 1) {
+        SNNSpikeWord bits = spikes[i >> 5] >> (i & 31);
+        if (bits == 0) continue;
+        int span = 32 - (i & 31);
+        if (span > end - i) {
+            bits &= ((SNNSpikeWord)1 << (end - i)) - 1;
+        }
+        while (bits != 0) {
+            positions[num++] = (uint16_t)(i - first + __builtin_ctz(bits));
+            bits &= bits - 1;
+        }
+    }
+    return num;
+}
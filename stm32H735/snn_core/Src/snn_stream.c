@@ -0,0 +1,298 @@
+#include "snn_stream.h"
+
+#include <string.h>
+#include "snn_kernels.h"
+
+// Largest kernel of a streamed layer, for its window of row pointers
+#define MAX_KERNEL 8
+
+// Floats of currents a packed-output convolution computes a group of
+// output channels of a row in, before packing them: enough channels to
+// share the row scan between them, few enough to stay a small buffer
+#define GROUP_CURRENTS 256
+
+// Output channels of a packed-output convolution row computed at once
+static int channel_group(const SNNLayer* layer) {
+    int output_size = snn_layer_output_size(layer);
+    int group = GROUP_CURRENTS / output_size;
+    if (group < 1) group = 1;
+    return group < layer->out_channels ? group : layer->out_channels;
+}
+
+static size_t align(size_t size) {
+    return (size + SNN_ARENA_ALIGNMENT - 1) / SNN_ARENA_ALIGNMENT * SNN_ARENA_ALIGNMENT;
+}
+
+// Bytes of count elements, packed or float
+static size_t elements_bytes(int count, int packed) {
+    return packed ? SNN_SPIKE_WORDS(count) * sizeof(SNNSpikeWord) : count * sizeof(float);
+}
+
+// Lay the stream memory out: rings, map, staging row, currents, then the
+// two linear layer outputs. Returns -1 if the network cannot stream.
+static int layout(const SNNNetwork* network, SNNStream* stream) {
+    int packed = 0;
+    int currents = 0;
+    size_t tail_bytes = 0;
+    size_t offset = 0;
+
+    if (network->num_layers < 1 || network->num_layers > SNN_MAX_LAYERS || network->timesteps != 1) {
+        return -1;
+    }
+    stream->network = network;
+    stream->stream_layers = 0;
+    while (stream->stream_layers < network->num_layers &&
+           network->layers[stream->stream_layers].type != SNN_LAYER_LINEAR) {
+        ++stream->stream_layers;
+    }
+    if (stream->stream_layers == 0) {
+        return -1;
+    }
+
+    for (int l = 0; l < network->num_layers; ++l) {
+        const SNNLayer* layer = &network->layers[l];
+        SNNLayerWeights weights = snn_network_weights(network, l);
+        int output_size = snn_layer_output_size(layer);
+
+        if (weights.quant != NULL || weights.codebook != NULL) return -1;
+        stream->input_packed[l] = packed;
+        if (l < stream->stream_layers) {
+            if (layer->kernel_size > MAX_KERNEL) return -1;
+            stream->row_bytes[l] = align(elements_bytes(layer->in_channels * layer->input_size, packed));
+            stream->ring_offsets[l] = offset;
+            offset += layer->kernel_size * stream->row_bytes[l];
+            int packs = layer->type == SNN_LAYER_CONV2D && snn_layer_output_packed(layer, packed);
+            if (packs && channel_group(layer) * output_size > currents) currents = channel_group(layer) * output_size;
+        } else {
+            int count = snn_layer_current_count(layer, packed, NULL);
+            size_t bytes = snn_layer_output_bytes(layer, packed);
+            if (layer->type != SNN_LAYER_LINEAR) return -1;
+            if (count > currents) currents = count;
+            if (bytes > tail_bytes) tail_bytes = bytes;
+        }
+        packed = snn_layer_output_packed(layer, packed);
+    }
+    if (packed) {
+        return -1;
+    }
+
+    const SNNLayer* last = &network->layers[stream->stream_layers - 1];
+    int last_packed = stream->input_packed[stream->stream_layers - 1];
+    int row_count = last->out_channels * snn_layer_output_size(last);
+
+    stream->map_offset = offset;
+    offset += align(snn_layer_output_bytes(last, last_packed));
+    stream->staging_offset = offset;
+    offset += align(elements_bytes(row_count, snn_layer_output_packed(last, last_packed)));
+    stream->currents_offset = offset;
+    offset += align(currents * sizeof(float));
+    stream->tail_offsets[0] = offset;
+    offset += align(tail_bytes);
+    stream->tail_offsets[1] = offset;
+    offset += align(tail_bytes);
+    stream->size = offset;
+    return 0;
+}
+
+size_t snn_stream_memory_size(const SNNNetwork* network) {
+    SNNStream stream;
+    return layout(network, &stream) == 0 ? stream.size : 0;
+}
+
+int snn_stream_begin(SNNStream* stream, const SNNNetwork* network, void* memory, size_t memory_size) {
+    if (layout(network, stream) != 0 || stream->size > memory_size) {
+        return -1;
+    }
+    stream->memory = memory;
+    for (int l = 0; l < stream->stream_layers; ++l) {
+        stream->rows_in[l] = 0;
+        stream->rows_out[l] = 0;
+    }
+    memset(stream->memory + stream->map_offset, 0, stream->staging_offset - stream->map_offset);
+    return 0;
+}
+
+// Ring slot of input row y of streamed layer l
+static void* ring_row(const SNNStream* stream, int l, int y) {
+    const SNNLayer* layer = &stream->network->layers[l];
+    return stream->memory + stream->ring_offsets[l] + (size_t)(y % layer->kernel_size) * stream->row_bytes[l];
+}
+
+// The layer activation of snn_layer_forward() on one stateless float row
+static void activate_row(const SNNLayer* layer, float* values, int count) {
+    switch (layer->activation) {
+    case SNN_ACT_RELU:
+        snn_relu(values, count);
+        break;
+    case SNN_ACT_LIF_MEMBRANE:
+        snn_lif_update_values(NULL, 0, values, count, layer->beta, layer->threshold, true);
+        break;
+    case SNN_ACT_LIF_SPIKE:
+    case SNN_ACT_LIF_SPIKE_BITS:
+        snn_lif_update_values(NULL, 0, values, count, layer->beta, layer->threshold, false);
+        break;
+    default:
+        break;
+    }
+}
+
+// Output row oy of streamed layer l into output, packed if the layer packs
+static void layer_row(const SNNStream* stream, int l, int oy, void* output) {
+    const SNNLayer* layer = &stream->network->layers[l];
+    int input_packed = stream->input_packed[l];
+    int output_size = snn_layer_output_size(layer);
+    const void* rows[MAX_KERNEL];
+
+    for (int kh = 0; kh < layer->kernel_size; ++kh) {
+        int y = oy * layer->stride - layer->padding + kh;
+        rows[kh] = y >= 0 && y < layer->input_size ? ring_row(stream, l, y) : NULL;
+    }
+
+    if (layer->type == SNN_LAYER_MAXPOOL2D) {
+        if (input_packed) {
+            snn_maxpool2d_spikes_row((const SNNSpikeWord* const*)rows, output, layer->in_channels,
+                                     layer->input_size, layer->kernel_size, layer->stride);
+        } else {
+            snn_maxpool2d_row((const float* const*)rows, output, layer->in_channels, layer->input_size,
+                              layer->kernel_size, layer->stride);
+        }
+        return;
+    }
+
+    if (!snn_layer_output_packed(layer, input_packed)) {
+        if (input_packed) {
+            snn_conv2d_spikes_row((const SNNSpikeWord* const*)rows, output, layer->weights, layer->biases,
+                                  layer->in_channels, layer->out_channels, layer->input_size, layer->kernel_size,
+                                  layer->stride, layer->padding);
+        } else {
+            snn_conv2d_row((const float* const*)rows, output, layer->weights, layer->biases, layer->in_channels,
+                           layer->out_channels, layer->input_size, layer->kernel_size, layer->stride,
+                           layer->padding);
+        }
+        activate_row(layer, output, layer->out_channels * output_size);
+        return;
+    }
+
+    // Packed output: a group of channels at a time through currents
+    float* currents = (float*)(stream->memory + stream->currents_offset);
+    int per_channel = layer->in_channels * layer->kernel_size * layer->kernel_size;
+    int group = channel_group(layer);
+
+    memset(output, 0, SNN_SPIKE_WORDS(layer->out_channels * output_size) * sizeof(SNNSpikeWord));
+    for (int first = 0; first < layer->out_channels; first += group) {
+        int count = layer->out_channels - first < group ? layer->out_channels - first : group;
+        const float* weights = layer->weights + first * per_channel;
+        const float* biases = layer->biases != NULL ? layer->biases + first : NULL;
+        if (input_packed) {
+            snn_conv2d_spikes_row((const SNNSpikeWord* const*)rows, currents, weights, biases,
+                                  layer->in_channels, count, layer->input_size, layer->kernel_size, layer->stride,
+                                  layer->padding);
+        } else {
+            snn_conv2d_row((const float* const*)rows, currents, weights, biases, layer->in_channels, count,
+                           layer->input_size, layer->kernel_size, layer->stride, layer->padding);
+        }
+        snn_lif_update_spikes(NULL, first * output_size, currents, count * output_size, layer->beta,
+                              layer->threshold, output);
+    }
+}
+
+// Copy output row oy of the last streamed layer from the staging row into
+// the map
+static void store_row(const SNNStream* stream, int oy) {
+    int l = stream->stream_layers - 1;
+    const SNNLayer* layer = &stream->network->layers[l];
+    int output_size = snn_layer_output_size(layer);
+    const void* staging = stream->memory + stream->staging_offset;
+    void* map = stream->memory + stream->map_offset;
+
+    for (int c = 0; c < layer->out_channels; ++c) {
+        int first = (c * output_size + oy) * output_size;
+        if (!snn_layer_output_packed(layer, stream->input_packed[l])) {
+            memcpy((float*)map + first, (const float*)staging + c * output_size, output_size * sizeof(float));
+            continue;
+        }
+        for (int ow = 0; ow < output_size; ++ow) {
+            if (snn_spike_get(staging, c * output_size + ow)) {
+                snn_spike_set(map, first + ow);
+            }
+        }
+    }
+}
+
+// Layer l has received another input row: compute every output row whose
+// last input row is in, and pass each on
+static void advance(SNNStream* stream, int l) {
+    const SNNLayer* layer = &stream->network->layers[l];
+    int output_size = snn_layer_output_size(layer);
+
+    ++stream->rows_in[l];
+    while (stream->rows_out[l] < output_size) {
+        int oy = stream->rows_out[l];
+        int last_row = oy * layer->stride - layer->padding + layer->kernel_size - 1;
+        if (last_row > layer->input_size - 1) last_row = layer->input_size - 1;
+        if (last_row >= stream->rows_in[l]) break;
+
+        ++stream->rows_out[l];
+        if (l + 1 < stream->stream_layers) {
+            layer_row(stream, l, oy, ring_row(stream, l + 1, stream->rows_in[l + 1]));
+            advance(stream, l + 1);
+        } else {
+            layer_row(stream, l, oy, stream->memory + stream->staging_offset);
+            store_row(stream, oy);
+        }
+    }
+}
+
+void snn_stream_push_row(SNNStream* stream, const float* row) {
+    const SNNLayer* first = &stream->network->layers[0];
+    // row_bytes[0] is padded to the arena alignment; the caller's row is not
+    size_t bytes = (size_t)first->in_channels * first->input_size * sizeof(float);
+
+    memcpy(ring_row(stream, 0, stream->rows_in[0]), row, bytes);
+    advance(stream, 0);
+}
+
+int snn_stream_finish(SNNStream* stream, SNNRunResult* result) {
+    const SNNNetwork* network = stream->network;
+    const SNNLayer* last = &network->layers[network->num_layers - 1];
+    int packed = snn_layer_output_packed(&network->layers[stream->stream_layers - 1],
+                                         stream->input_packed[stream->stream_layers - 1]);
+    const void* input = stream->memory + stream->map_offset;
+    SNNLayerMemory memory = { NULL, (float*)(stream->memory + stream->currents_offset), NULL, NULL };
+
+    for (int l = stream->stream_layers; l < network->num_layers; ++l) {
+        const SNNLayer* layer = &network->layers[l];
+        SNNLayerWeights weights = snn_network_weights(network, l);
+        void* output = stream->memory + stream->tail_offsets[(l - stream->stream_layers) % 2];
+        snn_layer_forward(layer, &weights, input, packed, output, &memory);
+        packed = snn_layer_output_packed(layer, packed);
+        input = output;
+    }
+
+    memset(result, 0, sizeof(*result));
+    result->timesteps = 1;
+    result->outputs = input;
+    result->predicted = snn_argmax(result->outputs, snn_layer_output_count(last));
+    return result->predicted;
+}
+
+int snn_stream_run(const SNNNetwork* network, const float* input, void* memory, size_t memory_size,
+                   SNNRunResult* result) {
+    SNNStream stream;
+    const SNNLayer* first = &network->layers[0];
+
+    if (snn_stream_begin(&stream, network, memory, memory_size) != 0) {
+        return -1;
+    }
+    // The input is CHW, so an input row gathers one row of every channel,
+    // straight into the first ring
+    for (int y = 0; y < first->input_size; ++y) {
+        float* row = ring_row(&stream, 0, y);
+        for (int c = 0; c < first->in_channels; ++c) {
+            memcpy(row + c * first->input_size, input + (c * first->input_size + y) * first->input_size,
+                   first->input_size * sizeof(float));
+        }
+        advance(&stream, 0);
+    }
+    return snn_stream_finish(&stream, result);
+}
@@ -0,0 +1,246 @@
+#include "snn_weights.h"
+
+#include <stdint.h>
+#include <string.h>
+#include "snn_cache.h"
+
+static const void* read_mapped(SNNWeightSource* source, const void* address, size_t bytes) {
+    (void)source;
+    (void)bytes;
+    return address;
+}
+
+static const void* read_copy(SNNWeightSource* source, const void* address, size_t bytes) {
+    memcpy(source->staging, address, bytes);
+    return source->staging;
+}
+
+void snn_weights_mapped(SNNWeightSource* source) {
+    memset(source, 0, sizeof(*source));
+    source->read = read_mapped;
+}
+
+void snn_weights_copy(SNNWeightSource* source, void* staging, size_t staging_bytes) {
+    memset(source, 0, sizeof(*source));
+    source->read = read_copy;
+    source->staging = staging;
+    source->staging_bytes = staging_bytes;
+}
+
+void snn_weights_prefetch(SNNWeightSource* source, void* staging, size_t staging_bytes, SNNAsyncCopy* async,
+                          const SNNNetwork* network) {
+    snn_weights_copy(source, staging, staging_bytes);
+    source->async = async;
+    source->network = network;
+    source->current = staging;
+}
+
+static int per_channel(const SNNLayer* layer) {
+    return layer->out_channels > 0 ? snn_layer_weight_count(layer) / layer->out_channels : 0;
+}
+
+static int contains(const void* start, size_t bytes, const void* address, size_t length) {
+    const uint8_t* first = start;
+    const uint8_t* wanted = address;
+    return first != NULL && wanted >= first && wanted + length <= first + bytes;
+}
+
+static uint32_t ticks(const SNNAsyncCopy* async) {
+    return async->clock != NULL ? async->clock() : 0;
+}
+
+// The half of staging the kernels are not reading
+static void* other_half(const SNNWeightSource* source) {
+    uint8_t* staging = source->staging;
+    return source->current == staging ? staging + snn_weights_chunk_bytes(source) : staging;
+}
+
+static void start_copy(SNNWeightSource* source, const void* weights, size_t bytes, int layer) {
+    source->pending = weights;
+    source->pending_bytes = bytes;
+    source->pending_layer = layer;
+    source->pending_start = ticks(source->async);
+    source->async->start(source->async, other_half(source), weights, bytes);
+}
+
+// Wait for the copy in flight and charge it to its layer
+static void finish_copy(SNNWeightSource* source) {
+    SNNAsyncCopy* async = source->async;
+    SNNPrefetchStats* stats = &source->stats[source->pending_layer];
+    uint32_t start = ticks(async);
+
+    async->wait(async);
+    ++stats->copies;
+    stats->bytes += (uint32_t)source->pending_bytes;
+    stats->copy_ticks += async->finished - source->pending_start;
+    stats->stall_ticks += ticks(async) - start;
+    ++source->reads;
+    source->read_bytes += (uint32_t)source->pending_bytes;
+    source->pending = NULL;
+}
+
+void snn_weights_finish(SNNWeightSource* source) {
+    if (source->async != NULL && source->pending != NULL) {
+        finish_copy(source);
+    }
+}
+
+// Layers the executor reads through the source, as it picks their weights
+static int sourced_layer(const SNNNetwork* network, int l) {
+    SNNLayerWeights weights = snn_network_weights(network, l);
+    return weights.source != NULL && weights.winograd == NULL && weights.ohwi == NULL &&
+           network->layers[l].weights != NULL && snn_layer_weight_count(&network->layers[l]) > 0;
+}
+
+// Start copying the chunk after the staged one of layer l: the rest of l,
+// else the first chunk of the next sourced layer
+static void prefetch_next(SNNWeightSource* source, int l) {
+    const SNNNetwork* network = source->network;
+    const SNNLayer* layer = &network->layers[l];
+    const uint8_t* next = (const uint8_t*)source->staged + source->staged_bytes;
+    const uint8_t* end = (const uint8_t*)(layer->weights + snn_layer_weight_count(layer));
+
+    if (next >= end) {
+        int n = l;
+        for (int i = 1; i <= network->num_layers; ++i) {
+            n = (l + i) % network->num_layers;
+            if (sourced_layer(network, n)) break;
+        }
+        l = n;
+        layer = &network->layers[l];
+        next = (const uint8_t*)layer->weights;
+        end = (const uint8_t*)(layer->weights + snn_layer_weight_count(layer));
+        if (next == source->staged) return;
+    }
+    size_t bytes = (size_t)snn_weights_chunk(source, layer) * per_channel(layer) * sizeof(float);
+    if (bytes > (size_t)(end - next)) bytes = (size_t)(end - next);
+    start_copy(source, next, bytes, l);
+}
+
+// Stage the chunk at weights from the prefetch in flight, or on demand if
+// that is another one, and start prefetching the chunk after it
+static void stage_prefetched(SNNWeightSource* source, const SNNLayer* layer, const float* weights, size_t bytes) {
+    int l = (int)(layer - source->network->layers);
+    const void* pending = source->pending;
+    size_t pending_bytes = source->pending_bytes;
+
+    if (pending != NULL) {
+        finish_copy(source);
+    }
+    if (!contains(pending, pending_bytes, weights, bytes)) {
+        // Not the chunk predicted: copy it on demand
+        pending = weights;
+        pending_bytes = bytes;
+        start_copy(source, weights, bytes, l);
+        finish_copy(source);
+    }
+    source->current = other_half(source);
+    source->staged = pending;
+    source->staged_bytes = pending_bytes;
+    prefetch_next(source, l);
+}
+
+const float* snn_weights_fetch(SNNWeightSource* source, const SNNLayer* layer, int first, int count) {
+    const float* weights = layer->weights + first * per_channel(layer);
+    size_t bytes = (size_t)count * per_channel(layer) * sizeof(float);
+
+    // Images of a batch ask for the same chunk in turn, and a prefetched
+    // chunk may cover several smaller ones
+    if (!contains(source->staged, source->staged_bytes, weights, bytes)) {
+        if (source->async != NULL) {
+            stage_prefetched(source, layer, weights, bytes);
+        } else {
+            const void* readable = source->read(source, weights, bytes);
+            ++source->reads;
+            source->read_bytes += (uint32_t)bytes;
+            if (source->staging == NULL) {
+                return readable;
+            }
+            source->current = source->staging;
+            source->staged = weights;
+            source->staged_bytes = bytes;
+        }
+    }
+    return (const float*)((const uint8_t*)source->current +
+                          ((const uint8_t*)weights - (const uint8_t*)source->staged));
+}
+
+size_t snn_weights_chunk_bytes(const SNNWeightSource* source) {
+    if (source->staging == NULL) {
+        return SIZE_MAX;
+    }
+    if (source->async != NULL) {
+        // Whole D-cache lines, for the invalidation after each copy
+        return (source->staging_bytes / 2) & ~(size_t)(SNN_CACHE_LINE_BYTES - 1);
+    }
+    return source->staging_bytes;
+}
+
+int snn_weights_chunk(const SNNWeightSource* source, const SNNLayer* layer) {
+    size_t bytes = (size_t)per_channel(layer) * sizeof(float);
+
+    if (source == NULL || source->staging == NULL || bytes == 0) {
+        return layer->out_channels;
+    }
+    int chunk = (int)(snn_weights_chunk_bytes(source) / bytes);
+    return chunk < layer->out_channels ? chunk : layer->out_channels;
+}
+
+size_t snn_weights_channel_bytes(const SNNNetwork* network) {
+    size_t largest = 0;
+
+    for (int l = 0; l < network->num_layers; ++l) {
+        size_t bytes = (size_t)per_channel(&network->layers[l]) * sizeof(float);
+        if (bytes > largest) largest = bytes;
+    }
+    return largest;
+}
+
+size_t snn_weights_image_size(const SNNNetwork* network) {
+    size_t size = 0;
+
+    for (int l = 0; l < network->num_layers; ++l) {
+        size += (size_t)snn_layer_weight_count(&network->layers[l]) * sizeof(float);
+    }
+    return size;
+}
+
+int snn_weights_image_write(const SNNNetwork* network, void* image) {
+    uint8_t* out = image;
+
+    for (int l = 0; l < network->num_layers; ++l) {
+        const SNNLayer* layer = &network->layers[l];
+        size_t bytes = (size_t)snn_layer_weight_count(layer) * sizeof(float);
+        if (bytes == 0) continue;
+        if (layer->weights == NULL) return -1;
+        memcpy(out, layer->weights, bytes);
+        out += bytes;
+    }
+    return 0;
+}
+
+int snn_network_rebase(const SNNNetwork* network, const void* image, size_t image_size, SNNLayer* layers,
+                       SNNWeightSource* source, SNNNetwork* rebased) {
+    const uint8_t* in = image;
+
+    if (image_size == 0 || image_size != snn_weights_image_size(network)) {
+        return -1;
+    }
+    for (int l = 0; l < network->num_layers; ++l) {
+        size_t bytes = (size_t)snn_layer_weight_count(&network->layers[l]) * sizeof(float);
+        layers[l] = network->layers[l];
+        if (bytes > 0) {
+            layers[l].weights = (const float*)in;
+            in += bytes;
+        }
+    }
+    *rebased = *network;
+    rebased->layers = layers;
+    rebased->quantized = NULL;
+    rebased->winograd = NULL;
+    rebased->ohwi = NULL;
+    rebased->sparse = NULL;
+    rebased->codebook = NULL;
+    rebased->weight_source = source;
+    return 0;
+}
@@ -0,0 +1,121 @@
+#include "snn_winograd.h"
+
+#include <stddef.h>
+#include "snn_kernels.h"
+#include "snn_placement.h"
+
+int snn_winograd_tiles(int input_size, int padding) {
+    return (snn_conv_output_size(input_size, 3, 1, padding) + 1) / 2;
+}
+
+// U = G g G^T with G = [1 0 0; 1/2 1/2 1/2; 1/2 -1/2 1/2; 0 0 1]
+void snn_winograd_weights(const float* weights, float* transformed, int in_channels, int out_channels) {
+    for (int k = 0; k < out_channels * in_channels; ++k) {
+        const float* g = weights + k * 9;
+        float* u = transformed + k * 16;
+        float t[4][3];
+
+        for (int c = 0; c < 3; ++c) {
+            t[0][c] = g[c];
+            t[1][c] = 0.5f * (g[c] + g[3 + c] + g[6 + c]);
+            t[2][c] = 0.5f * (g[c] - g[3 + c] + g[6 + c]);
+            t[3][c] = g[6 + c];
+        }
+        for (int r = 0; r < 4; ++r) {
+            u[r * 4 + 0] = t[r][0];
+            u[r * 4 + 1] = 0.5f * (t[r][0] + t[r][1] + t[r][2]);
+            u[r * 4 + 2] = 0.5f * (t[r][0] - t[r][1] + t[r][2]);
+            u[r * 4 + 3] = t[r][2];
+        }
+    }
+}
+
+// V = B^T d B with B^T = [1 0 -1 0; 0 1 1 0; 0 -1 1 0; 0 1 0 -1]
+static void transform_tile(const float d[4][4], float* v) {
+    float t[4][4];
+
+    for (int c = 0; c < 4; ++c) {
+        t[0][c] = d[0][c] - d[2][c];
+        t[1][c] = d[1][c] + d[2][c];
+        t[2][c] = d[2][c] - d[1][c];
+        t[3][c] = d[1][c] - d[3][c];
+    }
+    for (int r = 0; r < 4; ++r) {
+        v[r * 4 + 0] = t[r][0] - t[r][2];
+        v[r * 4 + 1] = t[r][1] + t[r][2];
+        v[r * 4 + 2] = t[r][2] - t[r][1];
+        v[r * 4 + 3] = t[r][1] - t[r][3];
+    }
+}
+
+SNN_PLACE_CONV2D_WINOGRAD
+void snn_winograd_input(const float* input, float* transformed, int in_channels, int input_size, int padding) {
+    int tiles = snn_winograd_tiles(input_size, padding);
+
+    for (int ty = 0; ty < tiles; ++ty) {
+        for (int tx = 0; tx < tiles; ++tx) {
+            float* tile = transformed + (ty * tiles + tx) * in_channels * 16;
+            int ih0 = 2 * ty - padding;
+            int iw0 = 2 * tx - padding;
+            int interior = ih0 >= 0 && iw0 >= 0 && ih0 + 4 <= input_size && iw0 + 4 <= input_size;
+
+            for (int ic = 0; ic < in_channels; ++ic) {
+                const float* channel = input + ic * input_size * input_size;
+                float d[4][4];
+
+                for (int r = 0; r < 4; ++r) {
+                    for (int c = 0; c < 4; ++c) {
+                        int ih = ih0 + r;
+                        int iw = iw0 + c;
+                        int inside = interior || (ih >= 0 && ih < input_size && iw >= 0 && iw < input_size);
+                        d[r][c] = inside ? channel[ih * input_size + iw] : 0.0f;
+                    }
+                }
+                transform_tile(d, tile + ic * 16);
+            }
+        }
+    }
+}
+
+// Y = A^T M A with A^T = [1 1 1 0; 0 1 -1 -1], written where it falls
+// inside the output (odd sizes cut the last row and column of tiles)
+SNN_PLACE_CONV2D_WINOGRAD
+void snn_conv2d_winograd(const float* transformed_input, float* output, const float* transformed_weights,
+                         const float* biases, int in_channels, int out_channels, int input_size, int padding) {
+    int output_size = snn_conv_output_size(input_size, 3, 1, padding);
+    int tiles = snn_winograd_tiles(input_size, padding);
+
+    for (int oc = 0; oc < out_channels; ++oc) {
+        const float* u = transformed_weights + oc * in_channels * 16;
+        float bias = biases != NULL ? biases[oc] : 0;
+        float* out = output + oc * output_size * output_size;
+
+        for (int t = 0; t < tiles * tiles; ++t) {
+            const float* v = transformed_input + t * in_channels * 16;
+            float m[16] = { 0 };
+
+            for (int ic = 0; ic < in_channels; ++ic) {
+                for (int i = 0; i < 16; ++i) {
+                    m[i] += u[ic * 16 + i] * v[ic * 16 + i];
+                }
+            }
+
+            float s[4];
+            float d[4];
+            for (int c = 0; c < 4; ++c) {
+                s[c] = m[c] + m[4 + c] + m[8 + c];
+                d[c] = m[4 + c] - m[8 + c] - m[12 + c];
+            }
+
+            int oh = t / tiles * 2;
+            int ow = t % tiles * 2;
+            int wide = ow + 1 < output_size;
+            out[oh * output_size + ow] = bias + s[0] + s[1] + s[2];
+            if (wide) out[oh * output_size + ow + 1] = bias + s[1] - s[2] - s[3];
+            if (oh + 1 < output_size) {
+                out[(oh + 1) * output_size + ow] = bias + d[0] + d[1] + d[2];
+                if (wide) out[(oh + 1) * output_size + ow + 1] = bias + d[1] - d[2] - d[3];
+            }
+        }
+    }
+}
@@ -0,0 +1,133 @@
+// Model blob exporter for the firmware models.
+//
+//   snn_blob MODEL FILE      write the model blob of MODEL to FILE
+//   snn_blob --check FILE    load FILE, verify its checksum and list its layers
+//
+// The blob (snn_blob.h) holds the layer table and float weights the
+// model's headers compile in, for SNN_OSPI_MODEL builds to run from the
+// start of the OctoSPI flash, or for the host to mmap. Program it with
+// STM32CubeProgrammer and the board's external loader.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "snn_core.h"
+#include "bench_models.h"
+
+typedef void (*BenchModelFn)(BenchModel* model);
+
+static const struct {
+    const char* name;
+    BenchModelFn load;
+} blob_models[] = {
+    { "mnist_snn", bench_mnist_snn },
+    { "mnist_cnn", bench_mnist_cnn },
+    { "cifar_snn", bench_cifar_snn },
+};
+
+#define NUM_BLOB_MODELS (int)(sizeof(blob_models) / sizeof(blob_models[0]))
+
+static int write_blob(const SNNNetwork* network, const char* path) {
+    size_t size = snn_blob_size(network);
+    void* blob = size > 0 ? malloc(size) : NULL;
+    FILE* out;
+
+    if (blob == NULL || snn_blob_write(network, blob) != 0) {
+        fprintf(stderr, "%s: no float weights\n", network->name);
+        free(blob);
+        return 1;
+    }
+    out = fopen(path, "wb");
+    if (out == NULL || fwrite(blob, 1, size, out) != size) {
+        fprintf(stderr, "%s: cannot write\n", path);
+        if (out != NULL) fclose(out);
+        free(blob);
+        return 1;
+    }
+    fclose(out);
+    free(blob);
+    printf("%s: %zu byte blob of %s, %d layers\n", path, size, network->name, network->num_layers);
+    return 0;
+}
+
+static const char* layer_name(const SNNLayer* layer) {
+    switch (layer->type) {
+    case SNN_LAYER_CONV2D:    return "conv2d";
+    case SNN_LAYER_MAXPOOL2D: return "maxpool2d";
+    case SNN_LAYER_LINEAR:    return "linear";
+    }
+    return "?";
+}
+
+static int check_blob(const char* path) {
+    FILE* in = fopen(path, "rb");
+    long size;
+    void* blob;
+    SNNBlobModel model;
+
+    if (in == NULL || fseek(in, 0, SEEK_END) != 0 || (size = ftell(in)) < 0 || fseek(in, 0, SEEK_SET) != 0) {
+        fprintf(stderr, "%s: cannot read\n", path);
+        if (in != NULL) fclose(in);
+        return 1;
+    }
+    blob = malloc(size > 0 ? (size_t)size : 1);
+    if (blob == NULL || fread(blob, 1, (size_t)size, in) != (size_t)size) {
+        fprintf(stderr, "%s: cannot read\n", path);
+        fclose(in);
+        free(blob);
+        return 1;
+    }
+    fclose(in);
+
+    if (snn_blob_load(&model, blob, (size_t)size) != 0) {
+        fprintf(stderr, "%s: not a version %d model blob\n", path, SNN_BLOB_VERSION);
+        free(blob);
+        return 1;
+    }
+    if (snn_blob_verify(blob) != 0) {
+        fprintf(stderr, "%s: checksum mismatch\n", path);
+        free(blob);
+        return 1;
+    }
+
+    const SNNNetwork* network = &model.network;
+    printf("%s: %s, %d layers, %d timestep%s, arena %zu bytes\n", path, network->name, network->num_layers,
+           network->timesteps, network->timesteps == 1 ? "" : "s",
+           snn_network_arena_size(network, network->timesteps));
+    for (int l = 0; l < network->num_layers; ++l) {
+        const SNNLayer* layer = &network->layers[l];
+        printf("  %-3d %-10s %6d -> %-6d %8d weights @ %zu\n", l, layer_name(layer),
+               snn_layer_input_count(layer), snn_layer_output_count(layer), snn_layer_weight_count(layer),
+               layer->weights != NULL ? (size_t)((const char*)layer->weights - (const char*)blob) : (size_t)0);
+    }
+    free(blob);
+    return 0;
+}
+
+int main(int argc, char** argv) {
+    if (argc == 3 && strcmp(argv[1], "--check") == 0) {
+        return check_blob(argv[2]);
+    }
+    if (argc != 3) {
+        fprintf(stderr, "usage: %s mnist_snn|mnist_cnn|cifar_snn FILE\n       %s --check FILE\n", argv[0],
+                argv[0]);
+        return 1;
+    }
+
+    for (int m = 0; m < NUM_BLOB_MODELS; ++m) {
+        BenchModel model;
+
+        if (strcmp(argv[1], blob_models[m].name) != 0) continue;
+
+        blob_models[m].load(&model);
+        if (model.synthetic) {
+            fprintf(stderr, "%s: only synthetic weights are available\n", blob_models[m].name);
+            return 1;
+        }
+        return write_blob(model.network, argv[2]);
+    }
+
+    fprintf(stderr, "unknown model %s\n", argv[1]);
+    return 1;
+}
@@ -0,0 +1,122 @@
+// 4-bit codebook weight generator for the firmware models.
+//
+//   snn_codebook --header MODEL   print Core/Inc/<model>_codebook.h for MODEL
+//
+// The header holds every conv and linear layer of the model as a
+// SNN_CODEBOOK_SIZE-entry codebook fitted to the layer and one 4-bit index
+// per weight, and the <model>_codebook table the model file installs when
+// the firmware is built with SNN_CODEBOOK_WEIGHTS. Rerun the
+// snn_codebook_headers target whenever model_parameters.h changes.
+
+#include <ctype.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "snn_core.h"
+#include "bench_models.h"
+
+typedef void (*BenchModelFn)(BenchModel* model);
+
+static const struct {
+    const char* name;
+    BenchModelFn load;
+} codebook_models[] = {
+    { "mnist_snn", bench_mnist_snn },
+    { "mnist_cnn", bench_mnist_cnn },
+    { "cifar_snn", bench_cifar_snn },
+};
+
+#define NUM_CODEBOOK_MODELS (int)(sizeof(codebook_models) / sizeof(codebook_models[0]))
+
+static void print_layer(const SNNNetwork* network, int l) {
+    const SNNLayer* layer = &network->layers[l];
+    int count = snn_layer_weight_count(layer);
+    int bytes = SNN_CODEBOOK_INDEX_BYTES(count);
+    uint8_t* indices = malloc(bytes);
+    float codebook[SNN_CODEBOOK_SIZE];
+
+    snn_codebook_fit(layer->weights, count, codebook);
+    snn_codebook_encode(layer->weights, count, codebook, indices);
+
+    printf("static const uint8_t %s_layer%d_indices[%d] = {", network->name, l, bytes);
+    for (int i = 0; i < bytes; ++i) {
+        printf("%s0x%02x,", i % 16 == 0 ? "\n    " : " ", indices[i]);
+    }
+    printf("\n};\n\n");
+
+    printf("static const float %s_layer%d_codebook[%d] = {", network->name, l, SNN_CODEBOOK_SIZE);
+    for (int c = 0; c < SNN_CODEBOOK_SIZE; ++c) {
+        printf("%s%.9gf,", c % 4 == 0 ? "\n    " : " ", codebook[c]);
+    }
+    printf("\n};\n\n");
+
+    free(indices);
+}
+
+static void print_header(const SNNNetwork* network) {
+    char upper[64];
+    size_t i;
+
+    for (i = 0; network->name[i] != '\0' && i < sizeof(upper) - 1; ++i) {
+        upper[i] = (char)toupper((unsigned char)network->name[i]);
+    }
+    upper[i] = '\0';
+
+    printf("// Generated by snn_core/Tools/snn_codebook from the %s weights.\n", network->name);
+    printf("// Regenerate with the snn_codebook_headers target after retraining the model.\n");
+    printf("#ifndef %s_CODEBOOK_H\n", upper);
+    printf("#define %s_CODEBOOK_H\n\n", upper);
+    printf("#include <stddef.h>\n");
+    printf("#include <stdint.h>\n");
+    printf("#include \"snn_codebook.h\"\n\n");
+
+    for (int l = 0; l < network->num_layers; ++l) {
+        if (snn_layer_weight_count(&network->layers[l]) > 0) {
+            print_layer(network, l);
+        }
+    }
+
+    printf("// One entry per layer; pooling layers have none\n");
+    printf("static const SNNCodebookWeights %s_codebook[%d] = {\n", network->name, network->num_layers);
+    for (int l = 0; l < network->num_layers; ++l) {
+        if (snn_layer_weight_count(&network->layers[l]) > 0) {
+            printf("    { %s_layer%d_indices, %s_layer%d_codebook },\n", network->name, l, network->name, l);
+        } else {
+            printf("    { NULL, NULL },\n");
+        }
+    }
+    printf("};\n\n");
+    printf("#endif // %s_CODEBOOK_H\n", upper);
+}
+
+int main(int argc, char** argv) {
+    if (argc != 3 || strcmp(argv[1], "--header") != 0) {
+        fprintf(stderr, "usage: %s --header mnist_snn|mnist_cnn|cifar_snn\n", argv[0]);
+        return 1;
+    }
+
+    for (int m = 0; m < NUM_CODEBOOK_MODELS; ++m) {
+        BenchModel model;
+
+        if (strcmp(argv[2], codebook_models[m].name) != 0) continue;
+
+        codebook_models[m].load(&model);
+        if (model.synthetic) {
+            fprintf(stderr, "%s: only synthetic weights are available\n", codebook_models[m].name);
+            return 1;
+        }
+        for (int l = 0; l < model.network->num_layers; ++l) {
+            const SNNLayer* layer = &model.network->layers[l];
+            if (layer->type == SNN_LAYER_LINEAR && layer->in_channels % 2 != 0) {
+                fprintf(stderr, "layer %d: linear layers need an even number of inputs\n", l);
+                return 1;
+            }
+        }
+        print_header(model.network);
+        return 0;
+    }
+
+    fprintf(stderr, "unknown model %s\n", argv[2]);
+    return 1;
+}
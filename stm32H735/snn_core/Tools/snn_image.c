@@ -0,0 +1,74 @@
+// Weight image writer for the firmware models.
+//
+//   snn_image MODEL FILE   write the weight image of MODEL to FILE
+//
+// The image holds the float weights of every weighted layer in layer order
+// (snn_weights_image_write), the layout SNN_OSPI_WEIGHTS builds expect at
+// the start of the OctoSPI flash. Program it there with STM32CubeProgrammer
+// and the board's external loader after every retraining.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "snn_core.h"
+#include "bench_models.h"
+
+typedef void (*BenchModelFn)(BenchModel* model);
+
+static const struct {
+    const char* name;
+    BenchModelFn load;
+} image_models[] = {
+    { "mnist_snn", bench_mnist_snn },
+    { "mnist_cnn", bench_mnist_cnn },
+    { "cifar_snn", bench_cifar_snn },
+};
+
+#define NUM_IMAGE_MODELS (int)(sizeof(image_models) / sizeof(image_models[0]))
+
+static int write_image(const SNNNetwork* network, const char* path) {
+    size_t size = snn_weights_image_size(network);
+    void* image = malloc(size);
+    FILE* out;
+
+    if (image == NULL || snn_weights_image_write(network, image) != 0) {
+        fprintf(stderr, "%s: no float weights\n", network->name);
+        free(image);
+        return 1;
+    }
+    out = fopen(path, "wb");
+    if (out == NULL || fwrite(image, 1, size, out) != size) {
+        fprintf(stderr, "%s: cannot write\n", path);
+        if (out != NULL) fclose(out);
+        free(image);
+        return 1;
+    }
+    fclose(out);
+    free(image);
+    printf("%s: %zu bytes of weights\n", path, size);
+    return 0;
+}
+
+int main(int argc, char** argv) {
+    if (argc != 3) {
+        fprintf(stderr, "usage: %s mnist_snn|mnist_cnn|cifar_snn FILE\n", argv[0]);
+        return 1;
+    }
+
+    for (int m = 0; m < NUM_IMAGE_MODELS; ++m) {
+        BenchModel model;
+
+        if (strcmp(argv[1], image_models[m].name) != 0) continue;
+
+        image_models[m].load(&model);
+        if (model.synthetic) {
+            fprintf(stderr, "%s: only synthetic weights are available\n", image_models[m].name);
+            return 1;
+        }
+        return write_image(model.network, argv[2]);
+    }
+
+    fprintf(stderr, "unknown model %s\n", argv[1]);
+    return 1;
+}
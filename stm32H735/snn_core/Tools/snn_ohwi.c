@@ -0,0 +1,111 @@
+// OHWI weight generator for the firmware models.
+//
+//   snn_ohwi --header MODEL   print Core/Inc/<model>_ohwi.h for MODEL
+//
+// The header holds the weights of every conv layer with at least
+// OHWI_MIN_CHANNELS input channels reordered to OHWI, and the <model>_ohwi
+// table the model file installs in SNN_CHANNELS_LAST builds. Rerun the
+// snn_ohwi_headers target whenever model_parameters.h changes.
+
+#include <ctype.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "snn_core.h"
+#include "bench_models.h"
+
+typedef void (*BenchModelFn)(BenchModel* model);
+
+static const struct {
+    const char* name;
+    BenchModelFn load;
+} ohwi_models[] = {
+    { "mnist_snn", bench_mnist_snn },
+    { "mnist_cnn", bench_mnist_cnn },
+    { "cifar_snn", bench_cifar_snn },
+};
+
+#define NUM_OHWI_MODELS (int)(sizeof(ohwi_models) / sizeof(ohwi_models[0]))
+
+// Runs of fewer input channels are too short to pay for the HWC transform
+// of the layer input
+#define OHWI_MIN_CHANNELS 4
+
+static int ohwi_layer(const SNNLayer* layer) {
+    return layer->type == SNN_LAYER_CONV2D && layer->in_channels >= OHWI_MIN_CHANNELS;
+}
+
+static void print_layer(const SNNNetwork* network, int l) {
+    const SNNLayer* layer = &network->layers[l];
+    int count = snn_layer_weight_count(layer);
+    float* ohwi = malloc(count * sizeof(float));
+
+    snn_weights_to_ohwi(layer->weights, ohwi, layer->in_channels, layer->out_channels, layer->kernel_size);
+
+    printf("static const float %s_layer%d_ohwi[%d] = {", network->name, l, count);
+    for (int i = 0; i < count; ++i) {
+        printf("%s%.9gf,", i % 4 == 0 ? "\n    " : " ", ohwi[i]);
+    }
+    printf("\n};\n\n");
+
+    free(ohwi);
+}
+
+static void print_header(const SNNNetwork* network) {
+    char upper[64];
+    size_t i;
+
+    for (i = 0; network->name[i] != '\0' && i < sizeof(upper) - 1; ++i) {
+        upper[i] = (char)toupper((unsigned char)network->name[i]);
+    }
+    upper[i] = '\0';
+
+    printf("// Generated by snn_core/Tools/snn_ohwi from the %s weights.\n", network->name);
+    printf("// Regenerate with the snn_ohwi_headers target after retraining the model.\n");
+    printf("#ifndef %s_OHWI_H\n", upper);
+    printf("#define %s_OHWI_H\n\n", upper);
+    printf("#include <stddef.h>\n\n");
+
+    for (int l = 0; l < network->num_layers; ++l) {
+        if (ohwi_layer(&network->layers[l])) {
+            print_layer(network, l);
+        }
+    }
+
+    printf("// One entry per layer; only convolutions of %d or more input channels have one\n", OHWI_MIN_CHANNELS);
+    printf("static const float* const %s_ohwi[%d] = {\n", network->name, network->num_layers);
+    for (int l = 0; l < network->num_layers; ++l) {
+        if (ohwi_layer(&network->layers[l])) {
+            printf("    %s_layer%d_ohwi,\n", network->name, l);
+        } else {
+            printf("    NULL,\n");
+        }
+    }
+    printf("};\n\n");
+    printf("#endif // %s_OHWI_H\n", upper);
+}
+
+int main(int argc, char** argv) {
+    if (argc != 3 || strcmp(argv[1], "--header") != 0) {
+        fprintf(stderr, "usage: %s --header mnist_snn|mnist_cnn|cifar_snn\n", argv[0]);
+        return 1;
+    }
+
+    for (int m = 0; m < NUM_OHWI_MODELS; ++m) {
+        BenchModel model;
+
+        if (strcmp(argv[2], ohwi_models[m].name) != 0) continue;
+
+        ohwi_models[m].load(&model);
+        if (model.synthetic) {
+            fprintf(stderr, "%s: only synthetic weights are available\n", ohwi_models[m].name);
+            return 1;
+        }
+        print_header(model.network);
+        return 0;
+    }
+
+    fprintf(stderr, "unknown model %s\n", argv[2]);
+    return 1;
+}
@@ -0,0 +1,491 @@
+// Memory placement planner for the firmware models.
+//
+//   snn_place --sizes FILE                report the placement of every model
+//   snn_place --sizes FILE --header MODEL print Core/Inc/snn_placement_config.h
+//                                         for MODEL
+//
+// FILE is `nm -S -t d` output of libsnn_core and the model objects, for
+// the code size of every kernel: the snn_placement_headers target passes
+// the host build's, arm-none-eabi-nm on the firmware objects gives the
+// Cortex-M7 sizes. The time each kernel takes is measured by running the
+// model on the host, and the arena traffic is counted from the layer
+// table. Kernels go into ITCM by measured time per byte of code, buffers
+// into DTCM by accesses per byte, while the ones touched less than once
+// per byte and inference are cold and go to D3, then D2, SRAM.
+//
+// Host timings only rank the kernels; the latency the placement saves on
+// the board is read from SNNRunResult.layer_ticks of a firmware build with
+// SNN_TCM_PLACEMENT against one without.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "snn_core.h"
+#include "bench_models.h"
+
+typedef void (*BenchModelFn)(BenchModel* model);
+
+static const struct {
+    const char* name;
+    BenchModelFn load;
+} place_models[] = {
+    { "mnist_snn", bench_mnist_snn },
+    { "mnist_cnn", bench_mnist_cnn },
+    { "cifar_snn", bench_cifar_snn },
+};
+
+#define NUM_PLACE_MODELS (int)(sizeof(place_models) / sizeof(place_models[0]))
+
+// Region capacities of STM32H735IGKX_FLASH.ld. The first 8 bytes of ITCM
+// are kept free so that no function sits at address 0.
+#define ITCM_BYTES (64 * 1024 - 8)
+#define DTCM_BYTES (128 * 1024)
+#define RAM_D2_BYTES (32 * 1024)
+#define RAM_D3_BYTES (16 * 1024)
+
+// Buffers touched less often than this per byte and inference are cold
+#define COLD_ACCESSES_PER_BYTE 1.0
+
+// Host time spent measuring each model
+#define MEASURE_SECONDS 0.5
+
+typedef enum {
+    PLACE_DEFAULT,  // flash for code, RAM_D1 for data
+    PLACE_ITCM,
+    PLACE_DTCM,
+    PLACE_RAM_D2,
+    PLACE_RAM_D3,
+} Region;
+
+static const char* region_name(Region region) {
+    switch (region) {
+    case PLACE_DEFAULT: return "-";
+    case PLACE_ITCM:    return "ITCM";
+    case PLACE_DTCM:    return "DTCM";
+    case PLACE_RAM_D2:  return "D2";
+    case PLACE_RAM_D3:  return "D3";
+    }
+    return "?";
+}
+
+static const char* region_macro(Region region) {
+    switch (region) {
+    case PLACE_ITCM:   return "SNN_ITCM";
+    case PLACE_DTCM:   return "SNN_DTCM";
+    case PLACE_RAM_D2: return "SNN_RAM_D2";
+    case PLACE_RAM_D3: return "SNN_RAM_D3";
+    default:           return "";
+    }
+}
+
+// The SNN_PLACE_<tag> kernels of snn_placement.h and the symbols each
+// covers. Specialised convolutions are the model's own name_conv2d and
+// name_conv2d_spikes functions.
+typedef enum {
+    KERNEL_CONV2D,
+    KERNEL_CONV2D_SPIKES,
+    KERNEL_CONV2D_EVENTS,
+    KERNEL_CONV2D_GEMM,
+    KERNEL_CONV2D_HWC,
+    KERNEL_CONV2D_WINOGRAD,
+    KERNEL_CONV2D_SPECIALIZED,
+    KERNEL_CONV2D_TILED,
+    KERNEL_LINEAR,
+    KERNEL_LINEAR_SPIKES,
+    KERNEL_MAXPOOL2D,
+    KERNEL_MAXPOOL2D_SPIKES,
+    KERNEL_LIF,
+    NUM_KERNELS
+} Kernel;
+
+static const struct {
+    const char* tag;
+    const char* symbols[4];
+} kernels[NUM_KERNELS] = {
+    [KERNEL_CONV2D]             = { "CONV2D", { "snn_conv2d" } },
+    [KERNEL_CONV2D_SPIKES]      = { "CONV2D_SPIKES", { "snn_conv2d_spikes" } },
+    [KERNEL_CONV2D_EVENTS]      = { "CONV2D_EVENTS", { "snn_conv2d_events" } },
+    [KERNEL_CONV2D_GEMM]        = { "CONV2D_GEMM", { "snn_conv2d_gemm" } },
+    [KERNEL_CONV2D_HWC]         = { "CONV2D_HWC", { "snn_conv2d_hwc", "snn_chw_to_hwc" } },
+    [KERNEL_CONV2D_WINOGRAD]    = { "CONV2D_WINOGRAD", { "snn_conv2d_winograd", "snn_winograd_input" } },
+    [KERNEL_CONV2D_SPECIALIZED] = { "CONV2D_SPECIALIZED", { NULL } },
+    [KERNEL_CONV2D_TILED]       = { "CONV2D_TILED", { "snn_conv2d_tiled" } },
+    [KERNEL_LINEAR]             = { "LINEAR", { "snn_linear" } },
+    [KERNEL_LINEAR_SPIKES]      = { "LINEAR_SPIKES", { "snn_linear_spikes" } },
+    [KERNEL_MAXPOOL2D]          = { "MAXPOOL2D", { "snn_maxpool2d" } },
+    [KERNEL_MAXPOOL2D_SPIKES]   = { "MAXPOOL2D_SPIKES", { "snn_maxpool2d_spikes" } },
+    [KERNEL_LIF]                = { "LIF", { "snn_lif_update_spikes", "snn_lif_update_values", "snn_update_neuron" } },
+};
+
+// One object to place: a kernel, or a buffer the firmware declares
+typedef struct {
+    const char* name;
+    const char* tag;        // SNN_PLACE_<tag>
+    int code;
+    size_t bytes;
+    int used;               // the model runs the kernel
+    double share;           // kernels: fraction of the measured inference time
+    double accesses;        // buffers: element accesses per inference
+    Region region;
+} PlaceObject;
+
+#define MAX_SYMBOLS 512
+
+typedef struct {
+    char name[96];
+    size_t size;
+} Symbol;
+
+static Symbol symbols[MAX_SYMBOLS];
+static int num_symbols;
+
+static int read_sizes(const char* path) {
+    FILE* file = fopen(path, "r");
+    char line[256];
+
+    if (file == NULL) {
+        return -1;
+    }
+    while (fgets(line, sizeof(line), file) != NULL && num_symbols < MAX_SYMBOLS) {
+        Symbol* symbol = &symbols[num_symbols];
+        unsigned long size;
+        char type;
+        if (sscanf(line, "%*s %lu %c %95s", &size, &type, symbol->name) == 3 && (type == 'T' || type == 't')) {
+            symbol->size = size;
+            ++num_symbols;
+        }
+    }
+    fclose(file);
+    return 0;
+}
+
+static int ends_with(const char* name, const char* suffix) {
+    size_t length = strlen(name);
+    size_t suffix_length = strlen(suffix);
+    return length >= suffix_length && strcmp(name + length - suffix_length, suffix) == 0;
+}
+
+// Code bytes of kernel k; the specialised convolutions of network only
+static size_t kernel_bytes(const SNNNetwork* network, Kernel k) {
+    size_t prefix_length = strlen(network->name);
+    size_t bytes = 0;
+
+    for (int s = 0; s < num_symbols; ++s) {
+        const char* name = symbols[s].name;
+        if (k == KERNEL_CONV2D_SPECIALIZED) {
+            if (strncmp(name, network->name, prefix_length) == 0 && name[prefix_length] == '_' &&
+                (ends_with(name, "_conv2d") || ends_with(name, "_conv2d_spikes"))) {
+                bytes += symbols[s].size;
+            }
+            continue;
+        }
+        for (int i = 0; i < 4 && kernels[k].symbols[i] != NULL; ++i) {
+            if (strcmp(name, kernels[k].symbols[i]) == 0) {
+                bytes += symbols[s].size;
+            }
+        }
+    }
+    return bytes;
+}
+
+// Nanosecond tick source for SNNRunConfig.clock; wraps, as layer ticks
+// are differences
+static uint32_t clock_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t)(ts.tv_sec * 1000000000ull + ts.tv_nsec);
+}
+
+static double now_s(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+// The kernel snn_layer_forward() runs layer l on, mirroring its dispatch
+// in the float build; a fused pool runs with its convolution
+static Kernel layer_kernel(const SNNNetwork* network, int l, int packed) {
+    const SNNLayer* layer = &network->layers[l];
+    SNNLayerWeights weights = snn_network_weights(network, l);
+
+    if (layer->type == SNN_LAYER_MAXPOOL2D) {
+        return packed ? KERNEL_MAXPOOL2D_SPIKES : KERNEL_MAXPOOL2D;
+    }
+    if (layer->type == SNN_LAYER_LINEAR) {
+        return packed ? KERNEL_LINEAR_SPIKES : KERNEL_LINEAR;
+    }
+    if (packed) {
+        return weights.conv != NULL && weights.conv->spikes != NULL ? KERNEL_CONV2D_SPECIALIZED
+                                                                    : KERNEL_CONV2D_SPIKES;
+    }
+    if (layer->max_event_rate > 0) return KERNEL_CONV2D_EVENTS;
+    if (weights.winograd != NULL) return KERNEL_CONV2D_WINOGRAD;
+    if (weights.ohwi != NULL) return KERNEL_CONV2D_HWC;
+    if (layer->algorithm == SNN_CONV_GEMM) return KERNEL_CONV2D_GEMM;
+    if (layer->algorithm == SNN_CONV_TILED) return KERNEL_CONV2D_TILED;
+    if (weights.conv != NULL && weights.conv->dense != NULL) return KERNEL_CONV2D_SPECIALIZED;
+    return KERNEL_CONV2D;
+}
+
+// Host seconds of the LIF updates of layer l over one inference, which
+// layer_ticks count with the layer's kernel
+static double lif_seconds(const SNNLayer* layer, int timesteps) {
+    int count = snn_layer_output_count(layer);
+    float* values = calloc(count, sizeof(float));
+    void* state = calloc(1, snn_lif_population_bytes(count));
+    LIFPopulation population;
+    int repeats = 0;
+    double start = now_s();
+
+    snn_lif_population_init(&population, state, count);
+    do {
+        for (int t = 0; t < timesteps; ++t) {
+            snn_lif_update_values(&population, 0, values, count, layer->beta, layer->threshold, true);
+        }
+        ++repeats;
+    } while (now_s() - start < MEASURE_SECONDS / 20);
+    double seconds = (now_s() - start) / repeats;
+    free(values);
+    free(state);
+    return seconds;
+}
+
+// Element reads of layer l's input per output element written: every
+// input feeds out_channels x kernel taps of a convolution, every output
+// of a linear layer and one window of a pool
+static double input_reuse(const SNNLayer* layer) {
+    switch (layer->type) {
+    case SNN_LAYER_CONV2D:
+        return (double)layer->out_channels * layer->kernel_size * layer->kernel_size /
+               ((double)layer->stride * layer->stride);
+    case SNN_LAYER_LINEAR:
+        return layer->out_channels;
+    default:
+        return 1;
+    }
+}
+
+// Greedy placement: objects in descending heat, each into the first
+// region on its list with room left
+static void place(PlaceObject* objects, int count) {
+    size_t itcm_free = ITCM_BYTES;
+    size_t dtcm_free = DTCM_BYTES;
+    size_t d2_free = RAM_D2_BYTES;
+    size_t d3_free = RAM_D3_BYTES;
+    int order[NUM_KERNELS + 4];
+
+    for (int i = 0; i < count; ++i) {
+        order[i] = i;
+    }
+    for (int i = 1; i < count; ++i) {
+        for (int j = i; j > 0; --j) {
+            const PlaceObject* a = &objects[order[j - 1]];
+            const PlaceObject* b = &objects[order[j]];
+            double heat_a = a->code ? a->share / (a->bytes + 1) : a->accesses / a->bytes;
+            double heat_b = b->code ? b->share / (b->bytes + 1) : b->accesses / b->bytes;
+            if (heat_a >= heat_b) break;
+            int swap = order[j - 1];
+            order[j - 1] = order[j];
+            order[j] = swap;
+        }
+    }
+
+    for (int i = 0; i < count; ++i) {
+        PlaceObject* object = &objects[order[i]];
+        object->region = PLACE_DEFAULT;
+        if (object->code) {
+            if (object->used && object->bytes > 0 && object->bytes <= itcm_free) {
+                object->region = PLACE_ITCM;
+                itcm_free -= object->bytes;
+            }
+        } else if (object->accesses / object->bytes >= COLD_ACCESSES_PER_BYTE) {
+            if (object->bytes <= dtcm_free) {
+                object->region = PLACE_DTCM;
+                dtcm_free -= object->bytes;
+            }
+        } else if (object->bytes <= d3_free) {
+            object->region = PLACE_RAM_D3;
+            d3_free -= object->bytes;
+        } else if (object->bytes <= d2_free) {
+            object->region = PLACE_RAM_D2;
+            d2_free -= object->bytes;
+        }
+    }
+}
+
+// Measure and place the kernels and buffers of network; returns the
+// object count and the host time of one inference in *seconds
+static int plan_model(const BenchModel* model, PlaceObject* objects, double* seconds) {
+    const SNNNetwork* network = model->network;
+    int timesteps = network->timesteps;
+    size_t arena_size = snn_network_arena_size(network, timesteps);
+    void* arena = malloc(arena_size);
+    double layer_seconds[SNN_MAX_LAYERS] = { 0 };
+    SNNRunConfig config = { 0, clock_ns };
+    SNNRunResult result;
+    int runs = 0;
+    int count = 0;
+
+    double start = now_s();
+    do {
+        snn_network_run(network, model->input, arena, arena_size, &config, &result);
+        for (int l = 0; l < network->num_layers; ++l) {
+            layer_seconds[l] += result.layer_ticks[l] / 1e9;
+        }
+        ++runs;
+    } while (now_s() - start < MEASURE_SECONDS);
+    *seconds = (now_s() - start) / runs;
+    free(arena);
+
+    for (int k = 0; k < NUM_KERNELS; ++k) {
+        PlaceObject* object = &objects[count++];
+        memset(object, 0, sizeof(*object));
+        object->name = kernels[k].tag;
+        object->tag = kernels[k].tag;
+        object->code = 1;
+        object->bytes = kernel_bytes(network, (Kernel)k);
+    }
+
+    double accesses = 0;
+    int packed = 0;
+    for (int l = 0; l < network->num_layers; ++l) {
+        const SNNLayer* layer = &network->layers[l];
+        double layer_time = layer_seconds[l] / runs;
+        int fused = snn_network_fuses_pool(network, l);
+
+        if (snn_layer_has_neurons(layer)) {
+            double lif = lif_seconds(layer, timesteps);
+            if (lif > layer_time) lif = layer_time;
+            objects[KERNEL_LIF].used = 1;
+            objects[KERNEL_LIF].share += lif / *seconds;
+            layer_time -= lif;
+        }
+        Kernel k = layer_kernel(network, l, packed);
+        objects[k].used = 1;
+        objects[k].share += layer_time / *seconds;
+        if (fused) {
+            // Pooled channel by channel on float currents
+            objects[KERNEL_MAXPOOL2D].used = 1;
+        }
+
+        accesses += (double)timesteps * snn_layer_output_count(layer) *
+                    (input_reuse(layer) + 1 + 2 * snn_layer_has_neurons(layer));
+        packed = snn_layer_output_packed(layer, packed);
+        if (fused) {
+            packed = snn_layer_output_packed(&network->layers[l + 1], packed);
+            ++l;
+        }
+    }
+
+    PlaceObject* buffer = &objects[count++];
+    memset(buffer, 0, sizeof(*buffer));
+    buffer->name = "arena";
+    buffer->tag = "ARENA";
+    buffer->bytes = snn_network_arena_size(network, timesteps);
+    buffer->accesses = accesses;
+
+    // snn_result, and the batch results of mnist_snn: the tick counts of
+    // every layer and step, written once each
+    buffer = &objects[count++];
+    memset(buffer, 0, sizeof(*buffer));
+    buffer->name = "results";
+    buffer->tag = "RESULTS";
+    buffer->bytes = (1 + SNN_MAX_BATCH) * sizeof(SNNRunResult);
+    buffer->accesses = 2.0 * (network->num_layers + 2) * timesteps;
+
+    place(objects, count);
+    return count;
+}
+
+static size_t region_bytes(const PlaceObject* objects, int count, Region region) {
+    size_t bytes = 0;
+    for (int i = 0; i < count; ++i) {
+        if (objects[i].region == region) bytes += objects[i].bytes;
+    }
+    return bytes;
+}
+
+static void print_report(const SNNNetwork* network, const PlaceObject* objects, int count, double seconds) {
+    double placed = 0;
+
+    printf("%s, %d timestep%s, %.1f us per inference on the host\n", network->name, network->timesteps,
+           network->timesteps == 1 ? "" : "s", seconds * 1e6);
+    printf("  %-20s %8s %8s  %s\n", "object", "bytes", "region", "heat");
+    for (int i = 0; i < count; ++i) {
+        const PlaceObject* object = &objects[i];
+        if (object->code && !object->used) continue;
+        if (object->code) {
+            printf("  %-20s %8zu %8s  %5.1f%% of the time\n", object->name, object->bytes,
+                   region_name(object->region), 100 * object->share);
+            if (object->region == PLACE_ITCM) placed += object->share;
+        } else {
+            printf("  %-20s %8zu %8s  %5.1f accesses per byte\n", object->name, object->bytes,
+                   region_name(object->region), object->accesses / object->bytes);
+        }
+    }
+    printf("  ITCM %zu of %d bytes running %.1f%% of the inference; DTCM %zu of %d bytes\n",
+           region_bytes(objects, count, PLACE_ITCM), ITCM_BYTES, 100 * placed,
+           region_bytes(objects, count, PLACE_DTCM), DTCM_BYTES);
+    printf("  on the board, compare SNNRunResult.layer_ticks with and without SNN_TCM_PLACEMENT\n\n");
+}
+
+static void print_header(const SNNNetwork* network, const PlaceObject* objects, int count) {
+    printf("// Generated by snn_core/Tools/snn_place from the %s layer table, host\n", network->name);
+    printf("// timings and code sizes. Regenerate with the snn_placement_headers target\n");
+    printf("// after changing the model; included by snn_placement.h in builds with\n");
+    printf("// SNN_TCM_PLACEMENT. Tags left out keep flash and RAM_D1.\n");
+    printf("#ifndef SNN_PLACEMENT_CONFIG_H\n");
+    printf("#define SNN_PLACEMENT_CONFIG_H\n\n");
+    for (int i = 0; i < count; ++i) {
+        const PlaceObject* object = &objects[i];
+        char define[64];
+        if (object->region == PLACE_DEFAULT) continue;
+        snprintf(define, sizeof(define), "SNN_PLACE_%s %s", object->tag, region_macro(object->region));
+        if (object->code) {
+            printf("#define %-44s // %zu bytes, %.0f%% of the time\n", define, object->bytes, 100 * object->share);
+        } else {
+            printf("#define %-44s // %zu bytes, %.1f accesses per byte\n", define, object->bytes,
+                   object->accesses / object->bytes);
+        }
+    }
+    printf("\n#endif // SNN_PLACEMENT_CONFIG_H\n");
+}
+
+int main(int argc, char** argv) {
+    const char* header_model = NULL;
+
+    if (argc == 5 && strcmp(argv[1], "--sizes") == 0 && strcmp(argv[3], "--header") == 0) {
+        header_model = argv[4];
+    } else if (argc != 3 || strcmp(argv[1], "--sizes") != 0) {
+        fprintf(stderr, "usage: %s --sizes nm-output [--header mnist_snn|mnist_cnn|cifar_snn]\n", argv[0]);
+        return 1;
+    }
+    if (read_sizes(argv[2]) != 0) {
+        fprintf(stderr, "cannot read %s\n", argv[2]);
+        return 1;
+    }
+
+    for (int m = 0; m < NUM_PLACE_MODELS; ++m) {
+        BenchModel model;
+        PlaceObject objects[NUM_KERNELS + 2];
+        double seconds;
+
+        if (header_model != NULL && strcmp(header_model, place_models[m].name) != 0) continue;
+
+        place_models[m].load(&model);
+        int count = plan_model(&model, objects, &seconds);
+        if (header_model != NULL) {
+            print_header(model.network, objects, count);
+            return 0;
+        }
+        print_report(model.network, objects, count, seconds);
+    }
+
+    if (header_model != NULL) {
+        fprintf(stderr, "unknown model %s\n", header_model);
+        return 1;
+    }
+    return 0;
+}
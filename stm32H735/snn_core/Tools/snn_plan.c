@@ -0,0 +1,212 @@
+// Activation arena planner for the firmware models.
+//
+//   snn_plan [-t timesteps]   report the plan of every model
+//   snn_plan --header MODEL   print Core/Inc/<model>_arena.h for MODEL
+//
+// The firmware sizes its static arena from the generated header, so rerun
+// the snn_arena_headers target whenever a layer table changes.
+
+#include <ctype.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "snn_core.h"
+#include "bench_models.h"
+
+typedef void (*BenchModelFn)(BenchModel* model);
+
+static const struct {
+    const char* name;
+    BenchModelFn load;
+} plan_models[] = {
+    { "mnist_snn", bench_mnist_snn },
+    { "mnist_cnn", bench_mnist_cnn },
+    { "cifar_snn", bench_cifar_snn },
+};
+
+#define NUM_PLAN_MODELS (int)(sizeof(plan_models) / sizeof(plan_models[0]))
+
+static const char* layer_name(const SNNLayer* layer) {
+    switch (layer->type) {
+    case SNN_LAYER_CONV2D:    return "conv2d";
+    case SNN_LAYER_MAXPOOL2D: return "maxpool2d";
+    case SNN_LAYER_LINEAR:    return "linear";
+    }
+    return "?";
+}
+
+static void buffer_name(const SNNNetwork* network, const SNNArenaPlan* plan, int buffer,
+                        char* name, size_t size) {
+    if (buffer < network->num_layers) {
+        snprintf(name, size, "%d %s%s", buffer, layer_name(&network->layers[buffer]),
+                 plan->fused_pool[buffer] ? "+pool" : "");
+        return;
+    }
+    for (int l = 0; l < network->num_layers; ++l) {
+        if (plan->state_buffer[l] == buffer) {
+            snprintf(name, size, "%d LIF state", l);
+            return;
+        }
+        if (plan->current_buffer[l] == buffer) {
+            snprintf(name, size, "%d currents", l);
+            return;
+        }
+        if (plan->input_q8_buffer[l] == buffer) {
+            snprintf(name, size, "%d int8 input", l);
+            return;
+        }
+        if (plan->scratch_buffer[l] == buffer) {
+            SNNLayerWeights weights = snn_network_weights(network, l);
+            const char* use = weights.codebook != NULL ? "codebook" : weights.winograd != NULL ? "winograd"
+                            : weights.ohwi != NULL ? "hwc" : "im2col";
+            snprintf(name, size, "%d %s", l, use);
+            return;
+        }
+    }
+    snprintf(name, size, "accumulator");
+}
+
+static void print_report(const SNNNetwork* network, int timesteps, const SNNArenaPlan* plan) {
+    printf("%s, %d timestep%s\n", network->name, timesteps, timesteps == 1 ? "" : "s");
+    printf("  %-16s %10s %10s %8s\n", "buffer", "bytes", "offset", "live");
+    for (int b = 0; b < plan->num_buffers; ++b) {
+        char name[32];
+        char live[16];
+        buffer_name(network, plan, b, name, sizeof(name));
+        snprintf(live, sizeof(live), "%d-%d", plan->first_use[b], plan->last_use[b]);
+        printf("  %-16s %10zu %10zu %8s\n", name, plan->sizes[b], plan->offsets[b], live);
+    }
+    size_t stack_bytes = 0;
+    for (int l = 0; l < network->num_layers; ++l) {
+        const SNNLayer* layer = &network->layers[l];
+        stack_bytes += (size_t)snn_layer_output_count(layer) * sizeof(float);
+        if (snn_layer_has_neurons(layer)) {
+            stack_bytes += (size_t)snn_layer_output_count(layer) * sizeof(LIFNeuron);
+        }
+    }
+    printf("  peak: %zu bytes (unplanned %zu bytes, %.1fx smaller)\n", plan->arena_size,
+           plan->unplanned_size, (double)plan->unplanned_size / (double)plan->arena_size);
+    if (timesteps == 1) {
+        printf("  all float outputs plus LIF state, as on the old inference() stack: %zu bytes\n",
+               stack_bytes);
+    }
+    if (timesteps == 1 && snn_stream_memory_size(network) > 0) {
+        printf("  rows and maps of a row-streamed run (snn_stream_run): %zu bytes\n",
+               snn_stream_memory_size(network));
+    }
+    printf("\n");
+}
+
+// The SNN_INT8_WEIGHTS build of network. Planning only looks at which
+// layers have int8 weights, so every entry points at one placeholder.
+static SNNNetwork int8_network(const SNNNetwork* network, SNNQuantWeights* table) {
+    static const int8_t placeholder_weight = 0;
+    static const float placeholder_scale = 1;
+    SNNNetwork quantized = *network;
+
+    for (int l = 0; l < network->num_layers; ++l) {
+        int weighted = snn_layer_weight_count(&network->layers[l]) > 0;
+        table[l].weights = weighted ? &placeholder_weight : NULL;
+        table[l].scales = weighted ? &placeholder_scale : NULL;
+    }
+    quantized.quantized = table;
+    return quantized;
+}
+
+// The SNN_CODEBOOK_WEIGHTS build of network, with placeholder entries as
+// in int8_network()
+static SNNNetwork codebook_network(const SNNNetwork* network, SNNCodebookWeights* table) {
+    static const uint8_t placeholder_index = 0;
+    static const float placeholder_codebook[SNN_CODEBOOK_SIZE] = { 0 };
+    SNNNetwork encoded = *network;
+
+    for (int l = 0; l < network->num_layers; ++l) {
+        int weighted = snn_layer_weight_count(&network->layers[l]) > 0;
+        table[l].indices = weighted ? &placeholder_index : NULL;
+        table[l].codebook = weighted ? placeholder_codebook : NULL;
+    }
+    encoded.codebook = table;
+    return encoded;
+}
+
+static void print_header(const SNNNetwork* network, const SNNArenaPlan* plan, const SNNArenaPlan* int8_plan,
+                         const SNNArenaPlan* codebook_plan) {
+    char upper[64];
+    size_t i;
+
+    for (i = 0; network->name[i] != '\0' && i < sizeof(upper) - 1; ++i) {
+        upper[i] = (char)toupper((unsigned char)network->name[i]);
+    }
+    upper[i] = '\0';
+
+    printf("// Generated by snn_core/Tools/snn_plan from the %s layer table.\n", network->name);
+    printf("// Regenerate with the snn_arena_headers target after changing the model.\n");
+    printf("#ifndef %s_ARENA_H\n", upper);
+    printf("#define %s_ARENA_H\n\n", upper);
+    printf("// Peak activation memory of snn_network_inference(); keeping every\n");
+    printf("// layer output live for the whole inference would take %zu bytes.\n", plan->unplanned_size);
+    printf("#if defined(SNN_INT8_WEIGHTS)\n");
+    printf("#define %s_ARENA_SIZE %zu\n", upper, int8_plan->arena_size);
+    printf("#elif defined(SNN_CODEBOOK_WEIGHTS)\n");
+    printf("#define %s_ARENA_SIZE %zu\n", upper, codebook_plan->arena_size);
+    printf("#else\n");
+    printf("#define %s_ARENA_SIZE %zu\n", upper, plan->arena_size);
+    printf("#endif\n\n");
+    if (snn_stream_memory_size(network) > 0) {
+        printf("// Memory of snn_stream_run(); int8 and codebook builds cannot stream.\n");
+        printf("#if !defined(SNN_INT8_WEIGHTS) && !defined(SNN_CODEBOOK_WEIGHTS)\n");
+        printf("#define %s_STREAM_SIZE %zu\n", upper, snn_stream_memory_size(network));
+        printf("#endif\n\n");
+    }
+    printf("#endif // %s_ARENA_H\n", upper);
+}
+
+int main(int argc, char** argv) {
+    const char* header_model = NULL;
+    int timesteps = 0;
+
+    if (argc == 3 && strcmp(argv[1], "--header") == 0) {
+        header_model = argv[2];
+    } else if (argc == 3 && strcmp(argv[1], "-t") == 0 && atoi(argv[2]) > 0) {
+        timesteps = atoi(argv[2]);
+    } else if (argc != 1) {
+        fprintf(stderr, "usage: %s [-t timesteps | --header mnist_snn|mnist_cnn|cifar_snn]\n", argv[0]);
+        return 1;
+    }
+
+    for (int m = 0; m < NUM_PLAN_MODELS; ++m) {
+        BenchModel model;
+        SNNArenaPlan plan;
+
+        if (header_model != NULL && strcmp(header_model, plan_models[m].name) != 0) continue;
+
+        plan_models[m].load(&model);
+        int steps = timesteps > 0 ? timesteps : model.network->timesteps;
+        if (snn_plan_arena(model.network, steps, &plan) != 0) {
+            fprintf(stderr, "%s: more than %d layers, or packed spikes out of the last layer\n",
+                    plan_models[m].name, SNN_MAX_LAYERS);
+            return 1;
+        }
+
+        if (header_model != NULL) {
+            SNNQuantWeights table[SNN_MAX_LAYERS];
+            SNNNetwork quantized = int8_network(model.network, table);
+            SNNArenaPlan int8_plan;
+            SNNCodebookWeights codebook_table[SNN_MAX_LAYERS];
+            SNNNetwork encoded = codebook_network(model.network, codebook_table);
+            SNNArenaPlan codebook_plan;
+            snn_plan_arena(&quantized, steps, &int8_plan);
+            snn_plan_arena(&encoded, steps, &codebook_plan);
+            print_header(model.network, &plan, &int8_plan, &codebook_plan);
+            return 0;
+        }
+        print_report(model.network, steps, &plan);
+    }
+
+    if (header_model != NULL) {
+        fprintf(stderr, "unknown model %s\n", header_model);
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,113 @@
+// Int8 weight generator for the firmware models.
+//
+//   snn_quantize --header MODEL   print Core/Inc/<model>_q8.h for MODEL
+//
+// The header holds every conv and linear layer of the model quantized per
+// output channel, and the <model>_quantized table the model file installs
+// when the firmware is built with SNN_INT8_WEIGHTS. Rerun the
+// snn_q8_headers target whenever model_parameters.h changes.
+
+#include <ctype.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "snn_core.h"
+#include "bench_models.h"
+
+typedef void (*BenchModelFn)(BenchModel* model);
+
+static const struct {
+    const char* name;
+    BenchModelFn load;
+} quantize_models[] = {
+    { "mnist_snn", bench_mnist_snn },
+    { "mnist_cnn", bench_mnist_cnn },
+    { "cifar_snn", bench_cifar_snn },
+};
+
+#define NUM_QUANTIZE_MODELS (int)(sizeof(quantize_models) / sizeof(quantize_models[0]))
+
+static void print_layer(const SNNNetwork* network, int l) {
+    const SNNLayer* layer = &network->layers[l];
+    int count = snn_layer_weight_count(layer);
+    int per_channel = count / layer->out_channels;
+    int8_t* weights = malloc(count);
+    float* scales = malloc(layer->out_channels * sizeof(float));
+
+    snn_quantize_weights(layer->weights, layer->out_channels, per_channel, weights, scales);
+
+    printf("static const int8_t %s_layer%d_weights[%d] = {", network->name, l, count);
+    for (int i = 0; i < count; ++i) {
+        printf("%s%d,", i % 16 == 0 ? "\n    " : " ", weights[i]);
+    }
+    printf("\n};\n\n");
+
+    printf("static const float %s_layer%d_scales[%d] = {", network->name, l, layer->out_channels);
+    for (int oc = 0; oc < layer->out_channels; ++oc) {
+        printf("%s%.9gf,", oc % 4 == 0 ? "\n    " : " ", scales[oc]);
+    }
+    printf("\n};\n\n");
+
+    free(weights);
+    free(scales);
+}
+
+static void print_header(const SNNNetwork* network) {
+    char upper[64];
+    size_t i;
+
+    for (i = 0; network->name[i] != '\0' && i < sizeof(upper) - 1; ++i) {
+        upper[i] = (char)toupper((unsigned char)network->name[i]);
+    }
+    upper[i] = '\0';
+
+    printf("// Generated by snn_core/Tools/snn_quantize from the %s weights.\n", network->name);
+    printf("// Regenerate with the snn_q8_headers target after retraining the model.\n");
+    printf("#ifndef %s_Q8_H\n", upper);
+    printf("#define %s_Q8_H\n\n", upper);
+    printf("#include <stddef.h>\n");
+    printf("#include \"snn_quant.h\"\n\n");
+
+    for (int l = 0; l < network->num_layers; ++l) {
+        if (snn_layer_weight_count(&network->layers[l]) > 0) {
+            print_layer(network, l);
+        }
+    }
+
+    printf("// One entry per layer; pooling layers have none\n");
+    printf("static const SNNQuantWeights %s_quantized[%d] = {\n", network->name, network->num_layers);
+    for (int l = 0; l < network->num_layers; ++l) {
+        if (snn_layer_weight_count(&network->layers[l]) > 0) {
+            printf("    { %s_layer%d_weights, %s_layer%d_scales },\n", network->name, l, network->name, l);
+        } else {
+            printf("    { NULL, NULL },\n");
+        }
+    }
+    printf("};\n\n");
+    printf("#endif // %s_Q8_H\n", upper);
+}
+
+int main(int argc, char** argv) {
+    if (argc != 3 || strcmp(argv[1], "--header") != 0) {
+        fprintf(stderr, "usage: %s --header mnist_snn|mnist_cnn|cifar_snn\n", argv[0]);
+        return 1;
+    }
+
+    for (int m = 0; m < NUM_QUANTIZE_MODELS; ++m) {
+        BenchModel model;
+
+        if (strcmp(argv[2], quantize_models[m].name) != 0) continue;
+
+        quantize_models[m].load(&model);
+        if (model.synthetic) {
+            fprintf(stderr, "%s: only synthetic weights are available\n", quantize_models[m].name);
+            return 1;
+        }
+        print_header(model.network);
+        return 0;
+    }
+
+    fprintf(stderr, "unknown model %s\n", argv[2]);
+    return 1;
+}
@@ -0,0 +1,162 @@
+// Block-sparse weight generator for the firmware models.
+//
+//   snn_sparse --header MODEL LAYER=SPARSITY ...   print Core/Inc/<model>_sparse.h
+//
+// Every linear layer named on the command line is magnitude-pruned to the
+// given fraction of zero 1xSNN_SPARSE_BLOCK blocks per output row (see
+// snn_prune_blocks()) and stored block-sparse; the <model>_sparse table
+// holds them for SNN_SPARSE_FC firmware builds. Rerun the
+// snn_sparse_headers target whenever model_parameters.h changes, and
+// check the pruned model with snn_bench -p first: pruning is not followed
+// by retraining.
+
+#include <ctype.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "snn_core.h"
+#include "bench_models.h"
+
+typedef void (*BenchModelFn)(BenchModel* model);
+
+static const struct {
+    const char* name;
+    BenchModelFn load;
+} sparse_models[] = {
+    { "mnist_snn", bench_mnist_snn },
+    { "mnist_cnn", bench_mnist_cnn },
+    { "cifar_snn", bench_cifar_snn },
+};
+
+#define NUM_SPARSE_MODELS (int)(sizeof(sparse_models) / sizeof(sparse_models[0]))
+
+static void print_layer(const SNNNetwork* network, int l, float sparsity) {
+    const SNNLayer* layer = &network->layers[l];
+    int count = snn_layer_weight_count(layer);
+    float* pruned = malloc(count * sizeof(float));
+
+    snn_prune_blocks(layer->weights, pruned, layer->out_channels, layer->in_channels, sparsity);
+
+    int blocks = snn_sparse_block_count(pruned, layer->out_channels, layer->in_channels);
+    float* values = malloc((size_t)blocks * SNN_SPARSE_BLOCK * sizeof(float));
+    uint16_t* columns = malloc(blocks * sizeof(uint16_t));
+    uint32_t* row_starts = malloc((layer->out_channels + 1) * sizeof(uint32_t));
+
+    snn_sparse_pack(pruned, layer->out_channels, layer->in_channels, values, columns, row_starts);
+
+    printf("// layer %d: %.0f%% of the %dx%d blocks pruned, %d kept, %u bytes (dense %zu)\n", l,
+           100.0 * sparsity, 1, SNN_SPARSE_BLOCK, blocks, (unsigned)snn_sparse_bytes(blocks, layer->out_channels),
+           count * sizeof(float));
+    printf("static const float %s_layer%d_values[%d] = {", network->name, l, blocks * SNN_SPARSE_BLOCK);
+    for (int i = 0; i < blocks * SNN_SPARSE_BLOCK; ++i) {
+        printf("%s%.9gf,", i % 4 == 0 ? "\n    " : " ", values[i]);
+    }
+    printf("\n};\n\n");
+
+    printf("static const uint16_t %s_layer%d_columns[%d] = {", network->name, l, blocks);
+    for (int b = 0; b < blocks; ++b) {
+        printf("%s%u,", b % 12 == 0 ? "\n    " : " ", columns[b]);
+    }
+    printf("\n};\n\n");
+
+    printf("static const uint32_t %s_layer%d_row_starts[%d] = {", network->name, l, layer->out_channels + 1);
+    for (int of = 0; of <= layer->out_channels; ++of) {
+        printf("%s%u,", of % 8 == 0 ? "\n    " : " ", (unsigned)row_starts[of]);
+    }
+    printf("\n};\n\n");
+
+    free(pruned);
+    free(values);
+    free(columns);
+    free(row_starts);
+}
+
+static void print_header(const SNNNetwork* network, const float* sparsity) {
+    char upper[64];
+    size_t i;
+
+    for (i = 0; network->name[i] != '\0' && i < sizeof(upper) - 1; ++i) {
+        upper[i] = (char)toupper((unsigned char)network->name[i]);
+    }
+    upper[i] = '\0';
+
+    printf("// Generated by snn_core/Tools/snn_sparse from the %s weights.\n", network->name);
+    printf("// Regenerate with the snn_sparse_headers target after retraining the model.\n");
+    printf("#ifndef %s_SPARSE_H\n", upper);
+    printf("#define %s_SPARSE_H\n\n", upper);
+    printf("#include <stddef.h>\n");
+    printf("#include <stdint.h>\n");
+    printf("#include \"snn_sparse.h\"\n\n");
+
+    for (int l = 0; l < network->num_layers; ++l) {
+        if (sparsity[l] >= 0) {
+            print_layer(network, l, sparsity[l]);
+        }
+    }
+
+    printf("// One entry per layer; dense layers have none\n");
+    printf("static const SNNSparseWeights %s_sparse[%d] = {\n", network->name, network->num_layers);
+    for (int l = 0; l < network->num_layers; ++l) {
+        if (sparsity[l] >= 0) {
+            printf("    { %s_layer%d_values, %s_layer%d_columns, %s_layer%d_row_starts },\n", network->name, l,
+                   network->name, l, network->name, l);
+        } else {
+            printf("    { NULL, NULL, NULL },\n");
+        }
+    }
+    printf("};\n\n");
+    printf("#endif // %s_SPARSE_H\n", upper);
+}
+
+// Parse LAYER=SPARSITY arguments into sparsity[], -1 for dense layers
+static int parse_layers(const SNNNetwork* network, int argc, char** argv, float* sparsity) {
+    for (int l = 0; l < network->num_layers; ++l) {
+        sparsity[l] = -1;
+    }
+    for (int i = 0; i < argc; ++i) {
+        int l;
+        float s;
+
+        if (sscanf(argv[i], "%d=%f", &l, &s) != 2 || l < 0 || l >= network->num_layers || s < 0 || s > 1) {
+            fprintf(stderr, "bad layer sparsity %s, expected LAYER=0..1\n", argv[i]);
+            return 1;
+        }
+        if (network->layers[l].type != SNN_LAYER_LINEAR ||
+            network->layers[l].in_channels % SNN_SPARSE_BLOCK != 0) {
+            fprintf(stderr, "layer %d: only linear layers of a multiple of %d inputs can be sparse\n", l,
+                    SNN_SPARSE_BLOCK);
+            return 1;
+        }
+        sparsity[l] = s;
+    }
+    return 0;
+}
+
+int main(int argc, char** argv) {
+    if (argc < 4 || strcmp(argv[1], "--header") != 0) {
+        fprintf(stderr, "usage: %s --header mnist_snn|mnist_cnn|cifar_snn LAYER=SPARSITY ...\n", argv[0]);
+        return 1;
+    }
+
+    for (int m = 0; m < NUM_SPARSE_MODELS; ++m) {
+        BenchModel model;
+        float sparsity[SNN_MAX_LAYERS];
+
+        if (strcmp(argv[2], sparse_models[m].name) != 0) continue;
+
+        sparse_models[m].load(&model);
+        if (model.synthetic) {
+            fprintf(stderr, "%s: only synthetic weights are available\n", sparse_models[m].name);
+            return 1;
+        }
+        if (parse_layers(model.network, argc - 3, argv + 3, sparsity) != 0) {
+            return 1;
+        }
+        print_header(model.network, sparsity);
+        return 0;
+    }
+
+    fprintf(stderr, "unknown model %s\n", argv[2]);
+    return 1;
+}
@@ -0,0 +1,107 @@
+// Winograd kernel generator for the firmware models.
+//
+//   snn_winograd --header MODEL   print Core/Inc/<model>_winograd.h for MODEL
+//
+// The header holds the F(2x2,3x3) transform of every 3x3 stride-1 conv
+// layer of the model, and the <model>_winograd table the model file
+// installs so those layers skip the kernel transform at run time. Rerun the
+// snn_winograd_headers target whenever model_parameters.h changes.
+
+#include <ctype.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "snn_core.h"
+#include "bench_models.h"
+
+typedef void (*BenchModelFn)(BenchModel* model);
+
+static const struct {
+    const char* name;
+    BenchModelFn load;
+} winograd_models[] = {
+    { "mnist_snn", bench_mnist_snn },
+    { "mnist_cnn", bench_mnist_cnn },
+    { "cifar_snn", bench_cifar_snn },
+};
+
+#define NUM_WINOGRAD_MODELS (int)(sizeof(winograd_models) / sizeof(winograd_models[0]))
+
+static int winograd_layer(const SNNLayer* layer) {
+    return layer->type == SNN_LAYER_CONV2D && layer->kernel_size == 3 && layer->stride == 1;
+}
+
+static void print_layer(const SNNNetwork* network, int l) {
+    const SNNLayer* layer = &network->layers[l];
+    int count = layer->out_channels * layer->in_channels * 16;
+    float* transformed = malloc(count * sizeof(float));
+
+    snn_winograd_weights(layer->weights, transformed, layer->in_channels, layer->out_channels);
+
+    printf("static const float %s_layer%d_winograd[%d] = {", network->name, l, count);
+    for (int i = 0; i < count; ++i) {
+        printf("%s%.9gf,", i % 4 == 0 ? "\n    " : " ", transformed[i]);
+    }
+    printf("\n};\n\n");
+
+    free(transformed);
+}
+
+static void print_header(const SNNNetwork* network) {
+    char upper[64];
+    size_t i;
+
+    for (i = 0; network->name[i] != '\0' && i < sizeof(upper) - 1; ++i) {
+        upper[i] = (char)toupper((unsigned char)network->name[i]);
+    }
+    upper[i] = '\0';
+
+    printf("// Generated by snn_core/Tools/snn_winograd from the %s weights.\n", network->name);
+    printf("// Regenerate with the snn_winograd_headers target after retraining the model.\n");
+    printf("#ifndef %s_WINOGRAD_H\n", upper);
+    printf("#define %s_WINOGRAD_H\n\n", upper);
+    printf("#include <stddef.h>\n\n");
+
+    for (int l = 0; l < network->num_layers; ++l) {
+        if (winograd_layer(&network->layers[l])) {
+            print_layer(network, l);
+        }
+    }
+
+    printf("// One entry per layer; only 3x3 stride-1 convolutions have one\n");
+    printf("static const float* const %s_winograd[%d] = {\n", network->name, network->num_layers);
+    for (int l = 0; l < network->num_layers; ++l) {
+        if (winograd_layer(&network->layers[l])) {
+            printf("    %s_layer%d_winograd,\n", network->name, l);
+        } else {
+            printf("    NULL,\n");
+        }
+    }
+    printf("};\n\n");
+    printf("#endif // %s_WINOGRAD_H\n", upper);
+}
+
+int main(int argc, char** argv) {
+    if (argc != 3 || strcmp(argv[1], "--header") != 0) {
+        fprintf(stderr, "usage: %s --header mnist_snn|mnist_cnn|cifar_snn\n", argv[0]);
+        return 1;
+    }
+
+    for (int m = 0; m < NUM_WINOGRAD_MODELS; ++m) {
+        BenchModel model;
+
+        if (strcmp(argv[2], winograd_models[m].name) != 0) continue;
+
+        winograd_models[m].load(&model);
+        if (model.synthetic) {
+            fprintf(stderr, "%s: only synthetic weights are available\n", winograd_models[m].name);
+            return 1;
+        }
+        print_header(model.network);
+        return 0;
+    }
+
+    fprintf(stderr, "unknown model %s\n", argv[2]);
+    return 1;
+}